@@ -45,6 +45,7 @@ typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
 typedef struct ie_blob ie_blob_t;
+typedef struct ie_completion_queue ie_completion_queue_t;
 
 /**
  * @struct ie_core_version
@@ -199,7 +200,9 @@ typedef enum {
 typedef enum {
     NO_RESIZE = 0,
     RESIZE_BILINEAR,
-    RESIZE_AREA
+    RESIZE_AREA,
+    RESIZE_NEAREST,
+    RESIZE_CUBIC
 }resize_alg_e;
 
 /**
@@ -275,6 +278,15 @@ typedef struct ie_complete_call_back {
     void *args;
 }ie_complete_call_back_t;
 
+/**
+ * @struct ie_completed_request
+ * @brief Represents an infer request which finished the asynchronous inference and was collected by a completion queue
+ */
+typedef struct ie_completed_request {
+    ie_infer_request_t *request;
+    void *args;
+}ie_completed_request_t;
+
 /**
  * @brief Returns number of version that is exported.
  * @return Version number of the API.
@@ -555,6 +567,17 @@ INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_infer_async(ie_infer_reque
  */
 INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_set_completion_callback(ie_infer_request_t *infer_request, ie_complete_call_back_t *callback);
 
+/**
+ * @brief Makes the infer request put itself to the completion queue on success or failure of each asynchronous request.
+ * It replaces the completion callback of the infer request.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param queue A pointer to ie_completion_queue_t instance. The queue must outlive the asynchronous requests.
+ * @param args The user data returned together with the infer request by ie_completion_queue_get_completed().
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_set_completion_queue(ie_infer_request_t *infer_request, ie_completion_queue_t *queue, void *args);
+
 /**
  * @brief Waits for the result to become available. Blocks until specified timeout elapses or the result becomes available, whichever comes first.
  * @ingroup InferRequest
@@ -578,6 +601,62 @@ INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_set_batch(ie_infer_request
 
 /** @} */ // end of InferRequest
 
+// CompletionQueue
+
+/**
+ * @defgroup CompletionQueue CompletionQueue
+ * Set of functions collecting the infer requests which finished the asynchronous inference,
+ * so one thread can drive many infer requests without waiting for them one by one.
+ * @{
+ */
+
+/**
+ * @brief Constructs an empty completion queue. Use the ie_completion_queue_free() method to free memory.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to the newly created ie_completion_queue_t instance.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_completion_queue_create(ie_completion_queue_t **queue);
+
+/**
+ * @brief Releases memory occupied by ie_completion_queue_t instance. The infer requests set to the queue must not run.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to the ie_completion_queue_t to free memory.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_completion_queue_free(ie_completion_queue_t **queue);
+
+/**
+ * @brief Wakes the consumer blocked in ie_completion_queue_get_completed(), which no longer blocks afterwards.
+ * The infer requests finishing after the shutdown are still collected and can be taken.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_completion_queue_shutdown(ie_completion_queue_t *queue);
+
+/**
+ * @brief Takes the infer requests which finished since the previous call, in the order of their completion.
+ * Blocks until specified timeout elapses or at least one infer request finishes, whichever comes first.
+ * After ie_completion_queue_shutdown() it returns the finished infer requests without blocking.
+ * The queue is meant to be drained by one thread at a time.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param completed A pointer to the array of max_num elements getting the finished infer requests.
+ * @param max_num The maximum number of the infer requests to take.
+ * @param timeout Maximum duration in milliseconds to block for
+ * @note There are special cases when timeout is equal some value of the WaitMode enum:
+ * * 0 - Immediately returns the finished infer requests. It does not block.
+ * * -1 - waits until an infer request finishes
+ * @param num A pointer to the number of the infer requests taken.
+ * @return Status code of the operation: OK(0) for success, RESULT_NOT_READY if no infer request finished in time
+ * or the queue is shut down.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_completion_queue_get_completed(ie_completion_queue_t *queue, ie_completed_request_t *completed,
+                                                                       const size_t max_num, const int64_t timeout, size_t *num);
+
+/** @} */ // end of CompletionQueue
+
 // Network
 
 /**
@@ -14,6 +14,9 @@
 #include <chrono>
 #include <tuple>
 #include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 #include <ie_extension.h>
 #include "inference_engine.hpp"
 #include "details/ie_exception.hpp"
@@ -61,6 +64,93 @@ struct ie_network {
     IE::CNNNetwork object;
 };
 
+/**
+ * @struct ie_completion_queue
+ * @brief This struct collects the finished infer requests. The completion callbacks push them without locks,
+ * a single consumer takes them and sleeps only when the queue is empty.
+ */
+struct ie_completion_queue {
+    struct node {
+        std::atomic<node *> next {nullptr};
+        ie_completed_request_t value {};
+    };
+
+    ie_completion_queue() : head(&stub), tail(&stub) {}
+
+    ~ie_completion_queue() {
+        ie_completed_request_t value;
+        while (pop(value)) {}
+        if (tail != &stub)
+            delete tail;
+    }
+
+    void push(const ie_completed_request_t &value) {
+        node *item = new node;
+        item->value = value;
+        node *prev = head.exchange(item, std::memory_order_acq_rel);
+        // Pairs with the consumer which announces the sleep before the last check of the queue
+        prev->next.store(item);
+        if (waiting.load()) {
+            std::lock_guard<std::mutex> lock(mutex);
+            cv.notify_one();
+        }
+    }
+
+    bool pop(ie_completed_request_t &value) {
+        node *next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr)
+            return false;
+        value = next->value;
+        if (tail != &stub)
+            delete tail;
+        tail = next;
+        return true;
+    }
+
+    bool empty() const {
+        return tail->next.load() == nullptr;
+    }
+
+    size_t get(ie_completed_request_t *completed, size_t max_num, int64_t timeout) {
+        size_t num = 0;
+        while (num < max_num && pop(completed[num]))
+            num++;
+        if (num != 0 || timeout == 0 || max_num == 0 || closed.load())
+            return num;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            waiting.store(true);
+            auto ready = [this] { return !empty() || closed.load(); };
+            if (timeout < 0)
+                cv.wait(lock, ready);
+            else
+                cv.wait_for(lock, std::chrono::milliseconds(timeout), ready);
+            waiting.store(false);
+        }
+
+        while (num < max_num && pop(completed[num]))
+            num++;
+        return num;
+    }
+
+    void shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed.store(true);
+        }
+        cv.notify_all();
+    }
+
+    node stub;
+    std::atomic<node *> head;
+    node *tail;
+    std::atomic<bool> waiting {false};
+    std::atomic<bool> closed {false};
+    std::mutex mutex;
+    std::condition_variable cv;
+};
+
 std::map<IE::StatusCode, IEStatusCode> status_map = {{IE::StatusCode::GENERAL_ERROR, IEStatusCode::GENERAL_ERROR},
                                                         {IE::StatusCode::INFER_NOT_STARTED, IEStatusCode::INFER_NOT_STARTED},
                                                         {IE::StatusCode::NETWORK_NOT_LOADED,  IEStatusCode::NETWORK_NOT_LOADED},
@@ -105,7 +195,9 @@ std::map<IE::Layout, layout_e> layout_map = {{IE::Layout::ANY, layout_e::ANY},
 
 std::map<IE::ResizeAlgorithm, resize_alg_e> resize_alg_map = {{IE::ResizeAlgorithm::NO_RESIZE, resize_alg_e::NO_RESIZE},
                                                                 {IE::ResizeAlgorithm::RESIZE_AREA, resize_alg_e::RESIZE_AREA},
-                                                                {IE::ResizeAlgorithm::RESIZE_BILINEAR, resize_alg_e::RESIZE_BILINEAR}};
+                                                                {IE::ResizeAlgorithm::RESIZE_BILINEAR, resize_alg_e::RESIZE_BILINEAR},
+                                                                {IE::ResizeAlgorithm::RESIZE_NEAREST, resize_alg_e::RESIZE_NEAREST},
+                                                                {IE::ResizeAlgorithm::RESIZE_CUBIC, resize_alg_e::RESIZE_CUBIC}};
 
 std::map<IE::ColorFormat, colorformat_e> colorformat_map = {{IE::ColorFormat::RAW, colorformat_e::RAW},
                                                             {IE::ColorFormat::RGB, colorformat_e::RGB},
@@ -1252,6 +1344,28 @@ IEStatusCode ie_infer_set_completion_callback(ie_infer_request_t *infer_request,
     return status;
 }
 
+IEStatusCode ie_infer_request_set_completion_queue(ie_infer_request_t *infer_request, ie_completion_queue_t *queue, void *args) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr || queue == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        auto fun = [=]() {
+            queue->push({infer_request, args});
+        };
+        infer_request->object.SetCompletionCallback(fun);
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (const std::exception& e) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
 IEStatusCode ie_infer_request_wait(ie_infer_request_t *infer_request, const int64_t timeout) {
     IEStatusCode status = IEStatusCode::OK;
 
@@ -1291,6 +1405,54 @@ IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const
     return status;
 }
 
+IEStatusCode ie_completion_queue_create(ie_completion_queue_t **queue) {
+    if (queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        *queue = new ie_completion_queue_t;
+    } catch (const std::exception& e) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_completion_queue_free(ie_completion_queue_t **queue) {
+    if (queue) {
+        delete *queue;
+        *queue = NULL;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_completion_queue_shutdown(ie_completion_queue_t *queue) {
+    if (queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    queue->shutdown();
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_completion_queue_get_completed(ie_completion_queue_t *queue, ie_completed_request_t *completed,
+                                               const size_t max_num, const int64_t timeout, size_t *num) {
+    if (queue == nullptr || completed == nullptr || num == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        *num = queue->get(completed, max_num, timeout);
+    } catch (const std::exception& e) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return *num == 0 && max_num != 0 ? IEStatusCode::RESULT_NOT_READY : IEStatusCode::OK;
+}
+
 IEStatusCode ie_blob_make_memory(const tensor_desc_t *tensorDesc, ie_blob_t **blob) {
     if (tensorDesc == nullptr || blob == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
@@ -0,0 +1,184 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <c_api/ie_c_api.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const char *model = R"V0G0N(
+<net name="CompletionQueue" version="7" batch="1">
+    <layers>
+        <layer id="0" name="data" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="relu" precision="FP32" type="ReLU">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+}  // namespace
+
+class CompletionQueueTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::ofstream file(modelFile);
+        file << model;
+        file.close();
+
+        ASSERT_EQ(IEStatusCode::OK, ie_core_create("", &core));
+        ASSERT_EQ(IEStatusCode::OK, ie_core_read_network(core, modelFile.c_str(), nullptr, &network));
+        ie_config_t config = {nullptr, nullptr, nullptr};
+        ASSERT_EQ(IEStatusCode::OK, ie_core_load_network(core, network, "CPU", &config, &exeNetwork));
+        ASSERT_EQ(IEStatusCode::OK, ie_completion_queue_create(&queue));
+    }
+
+    void TearDown() override {
+        for (auto &request : requests)
+            ie_infer_request_free(&request);
+        ie_completion_queue_free(&queue);
+        if (exeNetwork)
+            ie_exec_network_free(&exeNetwork);
+        if (network)
+            ie_network_free(&network);
+        if (core)
+            ie_core_free(&core);
+        std::remove(modelFile.c_str());
+    }
+
+    std::string modelFile = "CompletionQueueTests.xml";
+    ie_core_t *core = nullptr;
+    ie_network_t *network = nullptr;
+    ie_executable_network_t *exeNetwork = nullptr;
+    ie_completion_queue_t *queue = nullptr;
+    std::vector<ie_infer_request_t *> requests;
+};
+
+TEST_F(CompletionQueueTests, deliversEveryCompletionOnce) {
+    const size_t requestsNum = 8;
+    const size_t rounds = 4;
+    std::vector<size_t> ids(requestsNum);
+    for (size_t i = 0; i < requestsNum; i++) {
+        ids[i] = i;
+        ie_infer_request_t *request = nullptr;
+        ASSERT_EQ(IEStatusCode::OK, ie_exec_network_create_infer_request(exeNetwork, &request));
+        requests.push_back(request);
+        ASSERT_EQ(IEStatusCode::OK, ie_infer_request_set_completion_queue(request, queue, &ids[i]));
+    }
+
+    std::vector<size_t> completions(requestsNum, 0);
+    for (size_t round = 0; round < rounds; round++) {
+        for (auto request : requests)
+            ASSERT_EQ(IEStatusCode::OK, ie_infer_request_infer_async(request));
+
+        size_t taken = 0;
+        std::vector<ie_completed_request_t> completed(requestsNum);
+        while (taken < requestsNum) {
+            size_t num = 0;
+            ASSERT_EQ(IEStatusCode::OK, ie_completion_queue_get_completed(queue, completed.data(), completed.size(), -1, &num));
+            ASSERT_GT(num, 0u);
+            for (size_t i = 0; i < num; i++) {
+                const size_t id = *static_cast<size_t *>(completed[i].args);
+                ASSERT_LT(id, requestsNum);
+                ASSERT_EQ(requests[id], completed[i].request);
+                completions[id]++;
+            }
+            taken += num;
+        }
+        ASSERT_EQ(requestsNum, taken);
+
+        // the requests may still finish the callbacks, so they are waited for before the next round
+        for (auto request : requests)
+            ASSERT_EQ(IEStatusCode::OK, ie_infer_request_wait(request, -1));
+        for (size_t i = 0; i < requestsNum; i++)
+            ASSERT_EQ(round + 1, completions[i]) << "request " << i;
+    }
+
+    ie_completed_request_t extra;
+    size_t num = 0;
+    ASSERT_EQ(IEStatusCode::RESULT_NOT_READY, ie_completion_queue_get_completed(queue, &extra, 1, 0, &num));
+    ASSERT_EQ(0u, num);
+}
+
+TEST_F(CompletionQueueTests, timesOutWithoutCompletions) {
+    ie_completed_request_t completed;
+    size_t num = 0;
+    ASSERT_EQ(IEStatusCode::RESULT_NOT_READY, ie_completion_queue_get_completed(queue, &completed, 1, 10, &num));
+    ASSERT_EQ(0u, num);
+}
+
+TEST_F(CompletionQueueTests, shutdownWakesBlockedConsumer) {
+    IEStatusCode status = IEStatusCode::OK;
+    size_t num = 1;
+    std::thread consumer([&]() {
+        ie_completed_request_t completed;
+        status = ie_completion_queue_get_completed(queue, &completed, 1, -1, &num);
+    });
+
+    // gives the consumer the time to block on the empty queue
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(IEStatusCode::OK, ie_completion_queue_shutdown(queue));
+    consumer.join();
+
+    ASSERT_EQ(IEStatusCode::RESULT_NOT_READY, status);
+    ASSERT_EQ(0u, num);
+
+    // the queue doesn't block after the shutdown, but still delivers the requests finishing later
+    ie_completed_request_t completed;
+    ASSERT_EQ(IEStatusCode::RESULT_NOT_READY, ie_completion_queue_get_completed(queue, &completed, 1, -1, &num));
+
+    ie_infer_request_t *request = nullptr;
+    ASSERT_EQ(IEStatusCode::OK, ie_exec_network_create_infer_request(exeNetwork, &request));
+    requests.push_back(request);
+    int args = 0;
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_set_completion_queue(request, queue, &args));
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_infer_async(request));
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_wait(request, -1));
+
+    // the completion callback may run after the wait returns, and the queue doesn't wait for it anymore
+    num = 0;
+    for (int attempt = 0; attempt < 1000 && num == 0; attempt++) {
+        ie_completion_queue_get_completed(queue, &completed, 1, 0, &num);
+        if (num == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(1u, num);
+    ASSERT_EQ(request, completed.request);
+    ASSERT_EQ(&args, completed.args);
+}
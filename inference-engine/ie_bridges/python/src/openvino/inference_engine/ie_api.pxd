@@ -27,11 +27,16 @@ cdef class InferRequest:
     cpdef get_perf_counts(self)
     cdef void user_callback(self, int status) with gil
     cdef public:
-        _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called
+        _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called, _bound_inputs
 
 cdef class IENetwork:
     cdef C.IENetwork impl
 
+cdef class CompletionQueue:
+    cdef unique_ptr[C.CompletionQueue] impl
+    cdef public:
+        _requests
+
 cdef class ExecutableNetwork:
     cdef unique_ptr[C.IEExecNetwork] impl
     cdef C.IEPlugin plugin_impl
@@ -552,6 +552,7 @@ cdef class InferRequest:
         self._py_callback_used = False
         self._py_callback_called = threading.Event()
         self._py_data = None
+        self._bound_inputs = {}
 
     cdef void user_callback(self, int status) with gil:
         if self._py_callback:
@@ -609,7 +610,8 @@ cdef class InferRequest:
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer()
+        with nogil:
+            deref(self.impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
@@ -627,7 +629,8 @@ cdef class InferRequest:
         if inputs is not None:
             self._fill_inputs(inputs)
         self._py_callback_called.clear()
-        deref(self.impl).infer_async()
+        with nogil:
+            deref(self.impl).infer_async()
 
     ## Waits for the result to become available. Blocks until specified timeout elapses or the result
     #  becomes available, whichever comes first.
@@ -642,6 +645,8 @@ cdef class InferRequest:
     #
     #  Usage example: See `async_infer()` method of the the `InferRequest` class.
     cpdef wait(self, timeout=None):
+        cdef int64_t c_timeout
+        cdef int status
         if self._py_callback_used:
             while not self._py_callback_called.is_set():
                 if not self._py_callback_called.wait(timeout):
@@ -650,7 +655,10 @@ cdef class InferRequest:
         else:
             if timeout is None:
                 timeout = -1
-            return deref(self.impl).wait(<int64_t> timeout)
+            c_timeout = <int64_t> timeout
+            with nogil:
+                status = deref(self.impl).wait(c_timeout)
+            return status
 
     ## Queries performance measures per layer to get feedback of what is the most time consuming layer.
     #  NOTE: Performance counters data and format depends on the plugin
@@ -702,6 +710,42 @@ cdef class InferRequest:
             outputs[output] = self._get_blob_buffer(output.encode()).to_numpy()
         return deepcopy(outputs)
 
+    ## A dictionary that maps output layer names to `numpy.ndarray` views over the output blobs of the request.
+    #  Unlike `outputs`, the data is not copied, the views are overwritten by the next inference of the request.
+    @property
+    def output_views(self):
+        outputs = {}
+        for output in self._outputs_list:
+            outputs[output] = self._get_blob_buffer(output.encode()).to_numpy()
+        return outputs
+
+    ## Binds `numpy.ndarray` objects as the input blobs of the request, so the inferences read the arrays in place
+    #  instead of copying them into the request memory. The request keeps the arrays alive until they are bound
+    #  again, the arrays must not be modified while an asynchronous inference is running, and the data passed to
+    #  the following `infer()` and `async_infer()` calls is copied into the bound arrays.
+    #  The arrays of a different data type or a non-contiguous layout are converted, the shapes must match.
+    #
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape
+    #  @return None
+    #
+    #  Usage example:\n
+    #  ```python
+    #  exec_net = ie.load_network(network=net, device_name="CPU", num_requests=2)
+    #  exec_net.requests[0].bind_inputs({input_blob: image})
+    #  exec_net.requests[0].infer()
+    #  res = exec_net.requests[0].output_views['prob']
+    #  ```
+    def bind_inputs(self, inputs):
+        for k, v in inputs.items():
+            assert k in self._inputs_list, "No input with name {} found in network".format(k)
+            blob = self._get_blob_buffer(k.encode()).to_numpy()
+            array = np.ascontiguousarray(v, dtype=blob.dtype)
+            if array.shape != blob.shape:
+                raise ValueError("Shape {} of the data does not match shape {} of input {}".format(array.shape,
+                                                                                                   blob.shape, k))
+            deref(self.impl).setBlobBuffer(k.encode(), <void *> <size_t> array.ctypes.data)
+            self._bound_inputs[k] = array
+
     ## Current infer request inference time in milliseconds
     @property
     def latency(self):
@@ -736,6 +780,60 @@ cdef class InferRequest:
             self.inputs[k][:] = v
 
 
+## This class collects the infer requests which finished the asynchronous inference, so one thread can drive
+#  many infer requests without waiting for them one by one.
+cdef class CompletionQueue:
+    def __cinit__(self):
+        self.impl.reset(new C.CompletionQueue())
+
+    ## Class constructor
+    #  @return Instance of CompletionQueue class
+    def __init__(self):
+        self._requests = []
+
+    ## Makes the infer request put itself to the queue on success or failure of each asynchronous inference.
+    #  The queue must be alive while the infer requests added to it run.
+    #
+    #  @param request: An `InferRequest` instance
+    #  @return None
+    def add(self, InferRequest request):
+        deref(request.impl).setCompletionQueue(self.impl.get(), len(self._requests))
+        self._requests.append(request)
+
+    ## Takes the infer requests which finished since the previous call, in the order of their completion.
+    #  Blocks until the specified timeout elapses or at least one infer request finishes, whichever comes first.
+    #  The queue is meant to be drained by one thread at a time.
+    #
+    #  @param num: The maximum number of the infer requests to take
+    #  @param timeout: Time to wait in milliseconds, 0 does not block, -1 waits until an infer request finishes.
+    #                  If not specified, `timeout` value is set to -1 by default.
+    #  @return A list of `(InferRequest, status)` tuples, empty if no infer request finished in time
+    #
+    #  Usage example:\n
+    #  ```python
+    #  exec_net = ie.load_network(network=net, device_name="CPU", num_requests=4)
+    #  queue = CompletionQueue()
+    #  for req in exec_net.requests:
+    #      queue.add(req)
+    #      req.async_infer({input_blob: next(images)})
+    #  while True:
+    #      for req, status in queue.get_completed(num=len(exec_net.requests)):
+    #          process(req.outputs[out_blob])
+    #          req.async_infer({input_blob: next(images)})
+    #  ```
+    def get_completed(self, num, timeout=None):
+        cdef vector[pair[size_t, int]] c_completed
+        cdef pair[size_t, int] c_item
+        cdef size_t c_num = num
+        cdef int64_t c_timeout = -1 if timeout is None else timeout
+        with nogil:
+            c_completed = deref(self.impl).getCompleted(c_num, c_timeout)
+        completed = []
+        for c_item in c_completed:
+            completed.append((self._requests[c_item.first], c_item.second))
+        return completed
+
+
 ## Layer calibration statistic container.
 class LayerStats:
 
@@ -471,6 +471,41 @@ void InferenceEnginePython::InferRequestWrap::getBlobPtr(const std::string &blob
     IE_CHECK_CALL(request_ptr->GetBlob(blob_name.c_str(), blob_ptr, &response));
 }
 
+// Binds the external memory of the caller in place of the blob of the request, the memory keeps the same layout.
+void InferenceEnginePython::InferRequestWrap::setBlobBuffer(const std::string &blob_name, void *data) {
+    InferenceEngine::ResponseDesc response;
+    InferenceEngine::Blob::Ptr blob_ptr;
+    IE_CHECK_CALL(request_ptr->GetBlob(blob_name.c_str(), blob_ptr, &response));
+    const InferenceEngine::TensorDesc &desc = blob_ptr->getTensorDesc();
+    InferenceEngine::Blob::Ptr external_blob;
+    switch (desc.getPrecision()) {
+        case InferenceEngine::Precision::FP32:
+            external_blob = InferenceEngine::make_shared_blob<float>(desc, static_cast<float *>(data));
+            break;
+        case InferenceEngine::Precision::FP16:
+        case InferenceEngine::Precision::I16:
+            external_blob = InferenceEngine::make_shared_blob<int16_t>(desc, static_cast<int16_t *>(data));
+            break;
+        case InferenceEngine::Precision::U16:
+            external_blob = InferenceEngine::make_shared_blob<uint16_t>(desc, static_cast<uint16_t *>(data));
+            break;
+        case InferenceEngine::Precision::U8:
+            external_blob = InferenceEngine::make_shared_blob<uint8_t>(desc, static_cast<uint8_t *>(data));
+            break;
+        case InferenceEngine::Precision::I8:
+            external_blob = InferenceEngine::make_shared_blob<int8_t>(desc, static_cast<int8_t *>(data));
+            break;
+        case InferenceEngine::Precision::I32:
+            external_blob = InferenceEngine::make_shared_blob<int32_t>(desc, static_cast<int32_t *>(data));
+            break;
+        case InferenceEngine::Precision::I64:
+            external_blob = InferenceEngine::make_shared_blob<int64_t>(desc, static_cast<int64_t *>(data));
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported precision " << desc.getPrecision().name() << " of blob " << blob_name;
+    }
+    IE_CHECK_CALL(request_ptr->SetBlob(blob_name.c_str(), external_blob, &response));
+}
 
 void InferenceEnginePython::InferRequestWrap::setBatch(int size) {
     InferenceEngine::ResponseDesc response;
@@ -478,18 +513,24 @@ void InferenceEnginePython::InferRequestWrap::setBatch(int size) {
 }
 
 void latency_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) {
-    if (code != InferenceEngine::StatusCode::OK) {
-        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
-    }
     InferenceEnginePython::InferRequestWrap *requestWrap;
     InferenceEngine::ResponseDesc dsc;
     request->GetUserData(reinterpret_cast<void **>(&requestWrap), &dsc);
+    if (code != InferenceEngine::StatusCode::OK) {
+        if (requestWrap->completion_queue) {
+            requestWrap->completion_queue->push(requestWrap->completion_tag, code);
+        }
+        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
+    }
     auto end_time = Time::now();
     auto execTime = std::chrono::duration_cast<ns>(end_time - requestWrap->start_time);
     requestWrap->exec_time = static_cast<double>(execTime.count()) * 0.000001;
     if (requestWrap->user_callback) {
         requestWrap->user_callback(requestWrap->user_data, code);
     }
+    if (requestWrap->completion_queue) {
+        requestWrap->completion_queue->push(requestWrap->completion_tag, code);
+    }
 }
 
 void InferenceEnginePython::InferRequestWrap::setCyCallback(cy_callback callback, void *data) {
@@ -497,6 +538,79 @@ void InferenceEnginePython::InferRequestWrap::setCyCallback(cy_callback callback
     user_data = data;
 }
 
+void InferenceEnginePython::InferRequestWrap::setCompletionQueue(CompletionQueue *queue, size_t tag) {
+    completion_queue = queue;
+    completion_tag = tag;
+}
+
+InferenceEnginePython::CompletionQueue::CompletionQueue() : head(&stub), tail(&stub) {}
+
+InferenceEnginePython::CompletionQueue::~CompletionQueue() {
+    completed_request value;
+    while (pop(value)) {}
+    if (tail != &stub) {
+        delete tail;
+    }
+}
+
+void InferenceEnginePython::CompletionQueue::push(size_t tag, int status) {
+    node *item = new node;
+    item->value = {tag, status};
+    node *prev = head.exchange(item, std::memory_order_acq_rel);
+    // Pairs with the consumer which announces the sleep before the last check of the queue
+    prev->next.store(item);
+    if (waiting.load()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_one();
+    }
+}
+
+bool InferenceEnginePython::CompletionQueue::pop(completed_request &value) {
+    node *next = tail->next.load(std::memory_order_acquire);
+    if (next == nullptr) {
+        return false;
+    }
+    value = next->value;
+    if (tail != &stub) {
+        delete tail;
+    }
+    tail = next;
+    return true;
+}
+
+bool InferenceEnginePython::CompletionQueue::empty() const {
+    return tail->next.load() == nullptr;
+}
+
+std::vector<InferenceEnginePython::CompletionQueue::completed_request>
+InferenceEnginePython::CompletionQueue::getCompleted(size_t max_num, int64_t timeout) {
+    std::vector<completed_request> completed;
+    completed_request value;
+    while (completed.size() < max_num && pop(value)) {
+        completed.push_back(value);
+    }
+    if (!completed.empty() || timeout == 0 || max_num == 0) {
+        return completed;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        waiting.store(true);
+        auto ready = [this] { return !empty(); };
+        if (timeout < 0) {
+            cv.wait(lock, ready);
+        } else {
+            cv.wait_for(lock, std::chrono::milliseconds(timeout), ready);
+        }
+        waiting.store(false);
+    }
+
+    while (completed.size() < max_num && pop(value)) {
+        completed.push_back(value);
+    }
+    return completed;
+}
+
 void InferenceEnginePython::InferRequestWrap::infer() {
     InferenceEngine::ResponseDesc response;
     start_time = Time::now();
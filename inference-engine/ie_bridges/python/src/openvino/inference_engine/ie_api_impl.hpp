@@ -16,6 +16,9 @@
 #include <algorithm>
 #include <sstream>
 #include <chrono>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 #include <ie_extension.h>
 #include "inference_engine.hpp"
@@ -72,6 +75,37 @@ struct IENetwork {
     IENetwork() = default;
 };
 
+// Collects the tags of the finished infer requests. The completion callbacks push them without locks,
+// a single consumer takes them and sleeps only when the queue is empty.
+struct CompletionQueue {
+    using completed_request = std::pair<size_t, int>;
+
+    CompletionQueue();
+
+    ~CompletionQueue();
+
+    void push(size_t tag, int status);
+
+    std::vector<completed_request> getCompleted(size_t max_num, int64_t timeout);
+
+private:
+    struct node {
+        std::atomic<node *> next {nullptr};
+        completed_request value;
+    };
+
+    bool pop(completed_request &value);
+
+    bool empty() const;
+
+    node stub;
+    std::atomic<node *> head;
+    node *tail;
+    std::atomic<bool> waiting {false};
+    std::mutex mutex;
+    std::condition_variable cv;
+};
+
 struct InferRequestWrap {
     using cy_callback = void (*)(void*, int);
 
@@ -80,6 +114,8 @@ struct InferRequestWrap {
     double exec_time;
     cy_callback user_callback;
     void *user_data;
+    CompletionQueue *completion_queue;
+    size_t completion_tag;
     int status;
 
     void infer();
@@ -90,8 +126,12 @@ struct InferRequestWrap {
 
     void setCyCallback(cy_callback callback, void *data);
 
+    void setCompletionQueue(CompletionQueue *queue, size_t tag);
+
     void getBlobPtr(const std::string &blob_name, InferenceEngine::Blob::Ptr &blob_ptr);
 
+    void setBlobBuffer(const std::string &blob_name, void *data);
+
     void setBatch(int size);
 
     std::map<std::string, InferenceEnginePython::ProfileInfo> getPerformanceCounts();
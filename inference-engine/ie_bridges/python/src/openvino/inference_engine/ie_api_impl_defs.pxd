@@ -151,15 +151,21 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         string device_name
         string version
 
+    cdef cppclass CompletionQueue:
+        CompletionQueue() except +
+        vector[pair[size_t, int]] getCompleted(size_t max_num, int64_t timeout) nogil except +
+
     cdef cppclass InferRequestWrap:
         double exec_time;
         void getBlobPtr(const string & blob_name, Blob.Ptr & blob_ptr) except +
+        void setBlobBuffer(const string & blob_name, void * data) except +
         map[string, ProfileInfo] getPerformanceCounts() except +
-        void infer() except +
-        void infer_async() except +
-        int wait(int64_t timeout) except +
+        void infer() nogil except +
+        void infer_async() nogil except +
+        int wait(int64_t timeout) nogil except +
         void setBatch(int size) except +
         void setCyCallback(void (*)(void*, int), void *) except +
+        void setCompletionQueue(CompletionQueue * queue, size_t tag) except +
 
     cdef cppclass IECore:
         IECore() except +
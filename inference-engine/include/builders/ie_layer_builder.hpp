@@ -71,6 +71,14 @@ public:
      */
     Layer(idx_t id, const Layer& layer);
 
+    /**
+     * @brief The constructor creates a Layer builder with layer ID and takes the ports and the parameters of the
+     * given layer builder
+     * @param id Layer ID
+     * @param layer layer builder to move
+     */
+    Layer(idx_t id, Layer&& layer);
+
     /**
      * @brief Compares the given Layer builder with the current one
      * @param rhs Layer builder to compare with
@@ -124,6 +124,41 @@ public:
      * @return Id of new builder for the current network
      */
     idx_t addLayer(const Layer& layer);
+    /**
+     * @brief Adds new layer and connects it with previous layers, the ports and the parameters of the layer builder
+     * are moved into the network
+     *
+     * @param inputs Vector with PortInfo objects from previous layers
+     * @param layer Layer builder for new layer
+     *
+     * @return Id of new builder for the current network
+     */
+    idx_t addLayer(const std::vector<PortInfo>& inputs, Layer&& layer);
+    /**
+     * @brief Adds new layer, the ports and the parameters of the layer builder are moved into the network
+     *
+     * @param layer Layer builder for new layer
+     *
+     * @return Id of new builder for the current network
+     */
+    idx_t addLayer(Layer&& layer);
+    /**
+     * @brief Adds new layers at once. The ids and the names are generated as addLayer does, but the existing
+     * layers are looked through only once
+     *
+     * @param layers Layer builders for new layers
+     *
+     * @return Ids of new builders in the order of the given layers
+     */
+    std::vector<idx_t> addLayers(const std::vector<Layer>& layers);
+    /**
+     * @brief Adds new layers at once, the ports and the parameters of the layer builders are moved into the network
+     *
+     * @param layers Layer builders for new layers
+     *
+     * @return Ids of new builders in the order of the given layers
+     */
+    std::vector<idx_t> addLayers(std::vector<Layer>&& layers);
     /**
      * @brief Removes a layer by ID
      *
@@ -10,9 +10,17 @@
  */
 #pragma once
 
+#include <map>
 #include <string>
 #include "ie_plugin_config.hpp"
 
+/**
+ * @def CLDNN_METRIC(name)
+ * @brief Shortcut for defining clDNN metrics
+ */
+#define CLDNN_METRIC(name) METRIC_KEY(CLDNN_##name)
+#define DECLARE_CLDNN_METRIC(name, ...) DECLARE_METRIC_KEY(CLDNN_##name, __VA_ARGS__)
+
 namespace InferenceEngine {
 
 /**
@@ -70,6 +78,94 @@ DECLARE_CLDNN_CONFIG_KEY(INT8_ENABLED);
 */
 DECLARE_CLDNN_CONFIG_KEY(NV12_TWO_INPUTS);
 
+/**
+* @brief This key defines the directory the compiled OpenCL programs are cached in, so they are not compiled again
+* by the following runs on the same device and driver. The directory is created if it does not exist.
+* Empty by default (means no caching).
+*/
+DECLARE_CLDNN_CONFIG_KEY(KERNELS_CACHE_DIR);
+
+/**
+* @brief This key defines the size limit of the kernels cache directory in megabytes, the least recently used
+* programs are removed when it is exceeded. 0 (default) means no limit.
+*/
+DECLARE_CLDNN_CONFIG_KEY(KERNELS_CACHE_MAX_SIZE);
+
+/**
+* @brief This key turns the background tuning on: the network is served with the kernels already found in the
+* tuning file set with KEY_TUNING_FILE (or the default ones), while the kernels are tuned on a separate low priority
+* GPU queue. Once the tuning is completed, the tuning file is updated and the running infer requests switch
+* to the tuned kernels starting from their next inference. Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(BACKGROUND_TUNING);
+
+/**
+* @brief This key turns the out-of-order execution on: the primitives wait only for the primitives they depend on,
+* so the independent branches of the network run concurrently. Applicable to the NEO driver only.
+* Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(OUT_OF_ORDER_EXECUTION);
+
+/**
+* @brief This key turns the memory arena on: the intermediate buffers of a network are placed at offsets
+* of a single allocation, packed by their sizes and lifetimes regardless of their layouts.
+* Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(MEMORY_ARENA);
+
+/**
+* @brief This key turns the lazy compilation of the kernels on: LoadNetwork returns before the OpenCL programs are built,
+* they are built in the background and the inference builds the kernels it runs if they are not built yet, so the first
+* inference waits only for its own kernels. Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(LAZY_KERNELS_COMPILATION);
+
+/**
+* @brief This key defines the number of the host threads the layers implemented on the CPU (e.g. DetectionOutput,
+* Proposal) run on. The inference request keeps enqueueing the GPU layers while they wait for their inputs, and the GPU
+* layers depending on them wait on the device. 0 (default) means they run on the thread enqueueing the inference.
+*/
+DECLARE_CLDNN_CONFIG_KEY(HOST_THREADS);
+
+/**
+* @brief This key makes the dynamic batch (KEY_DYN_BATCH_ENABLED) compile a single program for the maximal batch
+* instead of one program per power of two up to it. Every batch from 1 to the maximal one runs on it, so the compile time
+* and the device memory of one program are traded for the computation of the whole batch on every inference.
+* Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(DYN_BATCH_SINGLE_PROGRAM);
+
+/**
+* @brief This key makes the DetectionOutput layers run on the OpenCL kernels instead of the host implementation.
+* The layers whose priors of an image do not fit the local memory of the device still run on the host.
+* Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(DETECTION_OUTPUT_GPU);
 
 }  // namespace CLDNNConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric of ExecutableNetwork to get a std::map<std::string, uint64_t> of the kernels cache statistics:
+ * "HITS" and "MISSES" count the programs loaded from the cache and the ones compiled and stored to it,
+ * "EVICTIONS" counts the removed programs and "SIZE" is the cache size in bytes.
+ * Available only if CLDNN_KERNELS_CACHE_DIR is set. String value is "CLDNN_KERNELS_CACHE_STATISTICS"
+ */
+DECLARE_CLDNN_METRIC(KERNELS_CACHE_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric of ExecutableNetwork to get the peak size of device memory in bytes allocated for the network,
+ * summed over its streams. String value is "CLDNN_MAX_USED_DEVICE_MEMORY"
+ */
+DECLARE_CLDNN_METRIC(MAX_USED_DEVICE_MEMORY, uint64_t);
+
+/**
+ * @brief Metric of ExecutableNetwork to get a std::map<std::string, std::string> of the precisions the network computes
+ * its inputs and outputs in, by their names. The blobs of these precisions (e.g. FP16 for an FP16 network) are used without
+ * any conversion on the host or on the device. String value is "CLDNN_PREFERRED_IO_PRECISIONS"
+ */
+DECLARE_CLDNN_METRIC(PREFERRED_IO_PRECISIONS, std::map<std::string, std::string>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
@@ -277,6 +277,9 @@ public:
      * @param xmlPath Path to output IR file.
      * @param binPath Path to output weights file. The parameter is skipped in case
      * of executable graph info serialization.
+     *
+     * If xmlPath has the .ienb extension, the network and its weights are written to that single file of the binary
+     * network format instead, Core::ReadNetwork maps it without parsing the XML and binPath is skipped.
      */
     void serialize(const std::string& xmlPath, const std::string& binPath = "") const {
         CALL_STATUS_FNC(serialize, xmlPath, binPath);
@@ -12,7 +12,9 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "cpp/ie_memory_state.hpp"
 #include "details/ie_exception_conversion.hpp"
 #include "ie_iinfer_request.hpp"
 #include "ie_plugin_ptr.hpp"
@@ -190,6 +192,64 @@ public:
         CALL_STATUS_FNC(SetBatch, batch);
     }
 
+    /**
+     * @brief Sets the priority the following asynchronous inferences of this request are scheduled with.
+     *
+     * @param priority Requests with a higher priority are started first among the queued ones, the default is 0
+     */
+    void SetPriority(const int priority) {
+        CALL_STATUS_FNC(SetPriority, priority);
+    }
+
+    /**
+     * @brief Gets a file descriptor which becomes readable every time an asynchronous inference completes.
+     * See IInferRequest::GetCompletionFd
+     *
+     * @return The eventfd descriptor owned by the request
+     */
+    int GetCompletionFd() {
+        int fd = -1;
+        CALL_STATUS_FNC(GetCompletionFd, fd);
+        return fd;
+    }
+
+    /**
+     * @copybrief IInferRequest::QueryState
+     *
+     * Wraps IInferRequest::QueryState
+     * @return A vector of Memory State objects of the request
+     */
+    std::vector<MemoryState> QueryState() {
+        IMemoryState::Ptr pState = nullptr;
+        auto res = OK;
+        std::vector<MemoryState> controller;
+        for (size_t idx = 0; res == OK; ++idx) {
+            ResponseDesc resp;
+            res = actual->QueryState(pState, idx, &resp);
+            if (res != OK && res != OUT_OF_BOUNDS) {
+                InferenceEngine::details::extract_exception(res, resp.msg);
+            }
+            if (res != OUT_OF_BOUNDS) {
+                controller.push_back(MemoryState(pState));
+            }
+        }
+
+        return controller;
+    }
+
+    /**
+     * @copybrief IInferRequest::InferBatch
+     *
+     * Wraps IInferRequest::InferBatch
+     * @param inputs The input blobs of each inference
+     * @param outputs The output blobs of each inference, resized to the number of the inferences. The outputs
+     * missing in the maps are allocated
+     */
+    void InferBatch(const std::vector<BlobMap>& inputs, std::vector<BlobMap>& outputs) {
+        outputs.resize(inputs.size());
+        CALL_STATUS_FNC(InferBatch, inputs.data(), outputs.data(), inputs.size());
+    }
+
     /**
      * constructs InferRequest from the initialized shared_pointer
      * @param request Initialized shared pointer
@@ -9,6 +9,9 @@
 #pragma once
 #include <string>
 
+#include "details/ie_exception_conversion.hpp"
+#include "ie_imemory_state.hpp"
+
 namespace InferenceEngine {
 
 /**
@@ -63,6 +66,15 @@ public:
     void SetState(Blob::Ptr state) {
         CALL_STATUS_FNC(SetState, state);
     }
+
+    /**
+     * @copybrief IMemoryState::BindState
+     *
+     * Wraps IMemoryState::BindState
+     */
+    void BindState(Blob::Ptr state) {
+        CALL_STATUS_FNC(BindState, state);
+    }
 };
 
 }  // namespace InferenceEngine
\ No newline at end of file
@@ -0,0 +1,250 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for CPU plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods of plugins
+ *
+ * @file cpu_config.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ie_plugin_config.hpp"
+
+/**
+ * @def CPU_METRIC(name)
+ * @brief Shortcut for defining CPU metrics
+ */
+#define CPU_METRIC(name) METRIC_KEY(CPU_##name)
+#define DECLARE_CPU_METRIC(name, ...) DECLARE_METRIC_KEY(CPU_##name, __VA_ARGS__)
+
+namespace InferenceEngine {
+
+namespace Metrics {
+
+/**
+ * @brief Metric of ExecutableNetwork to get a std::map<int, uint64_t> of memory bytes allocated on each
+ * NUMA node: intermediate tensors of all streams pinned to the node plus weights used by them.
+ * Weights might be shared with other networks loaded to the plugin. String value is "CPU_MEMORY_PER_NUMA_NODE"
+ */
+DECLARE_CPU_METRIC(MEMORY_PER_NUMA_NODE, std::map<int, uint64_t>);
+
+/**
+ * @brief Metric of ExecutableNetwork to get a number of Infer Requests which wait for a vacant stream.
+ * Available only if the network is loaded with more than one stream. String value is "CPU_STREAMS_QUEUE_DEPTH"
+ */
+DECLARE_CPU_METRIC(STREAMS_QUEUE_DEPTH, unsigned int);
+
+/**
+ * @brief Metric of ExecutableNetwork to get an average time in milliseconds the started Infer Requests
+ * spent waiting for a vacant stream. Available only if the network is loaded with more than one stream.
+ * String value is "CPU_STREAMS_AVERAGE_WAIT_TIME"
+ */
+DECLARE_CPU_METRIC(STREAMS_AVERAGE_WAIT_TIME, float);
+
+/**
+ * @brief Metric of ExecutableNetwork to get a maximum time in milliseconds an Infer Request
+ * spent waiting for a vacant stream. Available only if the network is loaded with more than one stream.
+ * String value is "CPU_STREAMS_MAX_WAIT_TIME"
+ */
+DECLARE_CPU_METRIC(STREAMS_MAX_WAIT_TIME, float);
+
+/**
+ * @brief Metric of ExecutableNetwork to get a std::map<std::string, float> of average times in milliseconds the
+ * started Infer Requests spent waiting for a vacant stream per request priority, see InferRequest::SetPriority.
+ * Available only if the network is loaded with more than one stream.
+ * String value is "CPU_STREAMS_AVERAGE_WAIT_TIME_PER_PRIORITY"
+ */
+DECLARE_CPU_METRIC(STREAMS_AVERAGE_WAIT_TIME_PER_PRIORITY, std::map<std::string, float>);
+
+/**
+ * @brief Metric of ExecutableNetwork to get a std::vector<std::string> of inputs and outputs which were bound
+ * to user blobs without copying during the last inference. A blob is bound if it has the same precision and
+ * layout as the internal tensor, is properly aligned and no mean image or dynamic batch is applied to it.
+ * String value is "CPU_ZERO_COPY_PORTS"
+ */
+DECLARE_CPU_METRIC(ZERO_COPY_PORTS, std::vector<std::string>);
+
+/**
+ * @brief Metric of the CPU plugin to get a number of primitives which were taken from the process-wide
+ * primitive cache instead of being created. String value is "CPU_PRIMITIVE_CACHE_HITS"
+ */
+DECLARE_CPU_METRIC(PRIMITIVE_CACHE_HITS, uint64_t);
+
+/**
+ * @brief Metric of the CPU plugin to get a number of cacheable primitives which were not found in the
+ * process-wide primitive cache and were created. String value is "CPU_PRIMITIVE_CACHE_MISSES"
+ */
+DECLARE_CPU_METRIC(PRIMITIVE_CACHE_MISSES, uint64_t);
+
+/**
+ * @brief Metric of ExecutableNetwork to get a std::map<std::string, std::vector<uint64_t>> of the histograms of
+ * the execution times of the layers sampled with KEY_CPU_PERF_COUNT_SAMPLING_PERIOD or collected with KEY_PERF_COUNT.
+ * The histograms of all the streams are summed up. Bucket 0 counts the executions shorter than 1 microsecond,
+ * bucket i counts the ones in [2^(i-1), 2^i) microseconds. Layers without samples are not listed.
+ * String value is "CPU_SAMPLED_PERF_COUNTERS"
+ */
+DECLARE_CPU_METRIC(SAMPLED_PERF_COUNTERS, std::map<std::string, std::vector<uint64_t>>);
+
+/**
+ * @brief Metric of ExecutableNetwork to get a number of reorders which KEY_CPU_LAYOUT_ASSIGNMENT eliminated
+ * compared to the layouts selected by the nodes one by one. The value is 0 without the layout assignment.
+ * It is the count of one graph: the graphs of all the streams are built from the same network and get the same layouts.
+ * String value is "CPU_ELIMINATED_REORDERS"
+ */
+DECLARE_CPU_METRIC(ELIMINATED_REORDERS, unsigned int);
+
+/**
+ * @brief Metric of ExecutableNetwork to get the reorders which run on the reference code, since neither MKLDNN nor
+ * the plugin have a JIT kernel for their formats and precisions. Every entry is the name of the reorder node with
+ * its source and destination, e.g. "conv1_nChw16c_nchw_conv2: FP32 nChw16c -> FP32 nchw".
+ * String value is "CPU_REFERENCE_REORDERS"
+ */
+DECLARE_CPU_METRIC(REFERENCE_REORDERS, std::vector<std::string>);
+
+}  // namespace Metrics
+
+/**
+ * @brief CPU plugin configuration
+ */
+namespace CPUConfigParams {
+
+/**
+ * @def CPU_CONFIG_KEY(name)
+ * @brief Shortcut for defining CPU configuration keys
+ */
+#define CPU_CONFIG_KEY(name) InferenceEngine::CPUConfigParams::_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_KEY(name) DECLARE_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(CPU_##name)
+
+/**
+ * @brief The key enables concurrent execution of independent branches of a network inside a stream.
+ * Nodes which do not depend on each other are grouped into waves and the nodes of a wave are executed
+ * in parallel. Memory reuse between intermediate tensors is computed for this schedule, so the
+ * memory footprint might be higher than for the sequential execution.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_CPU_CONFIG_KEY(PARALLEL_BRANCHES);
+
+/**
+ * @brief The key allows infer requests to take inputs with dims other than the network was loaded with.
+ * When a request meets new input dims, the network is reshaped and compiled for them once, and the result is
+ * kept for the next requests with the same dims (up to 16 different shapes, the least recently used ones
+ * are dropped). Reordered weights are shared between all the shapes. Output blobs are reallocated when
+ * their dims change, so they should be taken with GetBlob after inference.
+ * Cannot be used together with several streams or dynamic batch.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_CPU_CONFIG_KEY(DYNAMIC_SHAPES);
+
+/**
+ * @brief The key sets how many created primitives (with their JIT code) are kept in the process-wide cache after
+ * the networks using them are destroyed. Networks loaded later reuse the cached primitives of layers with the same
+ * shapes and attributes, so reshaped or similar networks are loaded faster. The setting is applied with SetConfig
+ * and affects all the networks. Value 0 disables the cache.
+ * This option should be used with a non-negative integer value, default is 1024
+ */
+DECLARE_CPU_CONFIG_KEY(PRIMITIVE_CACHE_CAPACITY);
+
+/**
+ * @brief The key sets the number of threads pre-processing the inputs (resize, color conversion) of asynchronous
+ * infer requests. With a non-zero value the pre-processing is a separate stage of the request pipeline, so the
+ * pre-processing of a request runs while other requests are being inferred. The threads are not counted in
+ * KEY_CPU_THREADS_NUM. Value 0 makes the pre-processing a part of the inference.
+ * This option should be used with a non-negative integer value, default is 0
+ */
+DECLARE_CPU_CONFIG_KEY(PREPROCESSING_THREADS);
+
+/**
+ * @brief The key sets the time in microseconds InferRequest::Wait(RESULT_READY) polls the request completion
+ * before the waiting thread is blocked. With short inferences and many requests in flight this saves the context
+ * switches of the waiting threads at the cost of a busy core while polling. Value 0 blocks the thread at once.
+ * This option should be used with a non-negative integer value, default is 0
+ */
+DECLARE_CPU_CONFIG_KEY(WAIT_SPIN_TIME);
+
+/**
+ * @brief The key enables the mixed BF16 execution on the CPUs with the AVX-512 BF16 instructions. Convolutions and
+ * fully connected layers which are not quantized are executed in BF16, their weights are converted to BF16 when
+ * the network is loaded. The layers which are sensitive to the precision (softmax, normalization, detection output)
+ * are executed in FP32, network inputs and outputs are in FP32 as well. The key is ignored on other CPUs.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_CPU_CONFIG_KEY(ENFORCE_BF16);
+
+/**
+ * @brief The key sets the format the weights of fully connected layers are stored in. The weights are compressed
+ * when the network is loaded and converted back to FP32 by the kernel block by block, activations stay in FP32.
+ * FP16 halves and I8 (symmetric, with a scale per output channel) quarters the memory traffic of the weights, which
+ * speeds memory bound layers with small batches up. Only the layers with 2D FP32 inputs and FP32 weights, without
+ * fused operations other than ReLU are compressed, quantized layers are not affected.
+ * This option should be used with values: CONFIG_VALUE(NO) (default), CPUConfigParams::FP16 or CPUConfigParams::I8
+ */
+DECLARE_CPU_CONFIG_KEY(WEIGHTS_COMPRESSION);
+DECLARE_CONFIG_VALUE(FP16);
+DECLARE_CONFIG_VALUE(I8);
+
+/**
+ * @brief The key sets the sparsity the weights of fully connected layers need to be executed by the sparse kernel.
+ * The sparsity is the share of the zero blocks of 16 consecutive input channels of the weights, it is measured when
+ * the network is loaded. The weights of sparse layers are stored as the non-zero blocks only, so the kernel skips the
+ * pruned blocks both in the memory traffic and in the computation. The layers supported are the ones of
+ * KEY_CPU_WEIGHTS_COMPRESSION, the sparse kernel is preferred to the compressed one. Value 0 disables the kernel.
+ * This option should be used with a floating point value in the range [0, 1], default is 0.8
+ */
+DECLARE_CPU_CONFIG_KEY(SPARSE_WEIGHTS_THRESHOLD);
+
+/**
+ * @brief The key sets how often the execution times of the layers are sampled without KEY_PERF_COUNT: the layers
+ * of 1 in N inferences of a stream are timed and their times are accumulated into the histograms of
+ * CPU_METRIC(SAMPLED_PERF_COUNTERS), the other inferences don't call timers. With KEY_PERF_COUNT every inference
+ * is timed. Value 0 disables the sampling.
+ * This option should be used with a non-negative integer value, default is 0
+ */
+DECLARE_CPU_CONFIG_KEY(PERF_COUNT_SAMPLING_PERIOD);
+
+/**
+ * @brief The key sets the outputs of the network the application takes, as a comma separated list of their names.
+ * The other outputs are removed when the network is loaded, together with the layers which compute only them, so
+ * the auxiliary heads of the network are neither executed nor given memory. The removed outputs are not reported by
+ * GetOutputsInfo of the executable network and cannot be taken from its requests. An empty value keeps all outputs.
+ * This option should be used with a comma separated list of the output names, default is empty
+ */
+DECLARE_CPU_CONFIG_KEY(REQUESTED_OUTPUTS);
+
+/**
+ * @brief The key enables the graph wide layout assignment. The layouts the nodes select one by one are reselected
+ * jointly, weighting the cost of the less preferred implementations against the cost of the reorders between the
+ * nodes, so fewer reorders are inserted into the graph. CPU_METRIC(ELIMINATED_REORDERS) reports the effect.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_CPU_CONFIG_KEY(LAYOUT_ASSIGNMENT);
+
+/**
+ * @brief The key enables the rewrite of the strided FP32 deconvolutions into the stride 1 convolutions producing
+ * the phases of the output as the channels, which are interleaved into the output by the pixel shuffle. The weights
+ * are rearranged when the network is loaded, so the deconvolutions run by the forward convolution kernels. The
+ * deconvolutions which the rewrite would cost more than 9/4 of their multiplications are kept.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_CPU_CONFIG_KEY(SUBPIXEL_DECONVOLUTION);
+
+/**
+ * @brief The value of KEY_CPU_THROUGHPUT_STREAMS which chooses the streams and the threads per stream from the
+ * network when it is loaded, instead of the number of the cores alone as CPU_THROUGHPUT_AUTO does. The operations
+ * per byte of the layers with weights tell the compute bound networks, which get the streams with the activations
+ * fitting the L2 caches of their threads, from the memory bound ones, which get as many streams as their working
+ * sets fit the last level cache. KEY_CPU_THREADS_NUM limits the threads of all the streams. GetConfig of the
+ * executable network reports the chosen KEY_CPU_THROUGHPUT_STREAMS and KEY_CPU_THREADS_NUM.
+ */
+DECLARE_CPU_CONFIG_VALUE(THROUGHPUT_TUNED);
+
+}  // namespace CPUConfigParams
+}  // namespace InferenceEngine
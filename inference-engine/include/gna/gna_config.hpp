@@ -11,7 +11,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
+#include "ie_icnn_network_stats.hpp"
 #include "ie_plugin_config.hpp"
 
 #ifdef GNA_LIB_VER
@@ -109,5 +112,73 @@ DECLARE_GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN);
 * of issuing. Additionally, in this case, software modes do not implement any serializations.
 */
 DECLARE_GNA_CONFIG_KEY(LIB_N_THREADS);
+
+/**
+* @brief Enables the streaming input mode for networks which inputs are sliding windows of frames.
+* The value is the number of new frames every inference brings in, "0" (default) disables the mode.
+* In the streaming mode only the last INPUT_FRAMES_SHIFT frames of an input blob are imported
+* while the other frames are taken, already converted to the device format, from the previous inference.
+* The stream is started over by resetting memory states of the network.
+*/
+DECLARE_GNA_CONFIG_KEY(INPUT_FRAMES_SHIFT);
+
+/**
+* @brief The option to collect minimum and maximum output values of every layer over all inferences
+* of the executable network, see GNA_METRIC(LAYER_STATISTICS). Supported in the GNA_SW_FP32 mode only,
+* so a calibration dataset can be run through the floating point model. By default (NO) the values are not collected.
+*/
+DECLARE_GNA_CONFIG_KEY(COLLECT_STATISTICS);
+
+/**
+* @brief Name of the blob to be set into an infer request with SetBlob() to compute only the listed elements
+* of the network output, every inference of the request uses the last blob set (GNA active list).
+* The blob is 1D I32 or U32 of the indices of the needed output elements. Every output frame holds only
+* the listed elements, packed in the order of the list, the rest of the frame is zero.
+* An empty blob or nullptr makes the request compute all the elements again.
+* Supported for networks with one output produced by an affine (fully connected) layer.
+*/
+DECLARE_GNA_CONFIG_VALUE(ACTIVE_OUTPUTS);
+
+/**
+* @brief The number of the last inferences the hardware counters of GetPerformanceCounts() are averaged over
+* for long running streams, the maximums over the window are reported too. "0" (default) reports the counters
+* of the last inference. Takes effect with KEY_PERF_COUNT enabled.
+*/
+DECLARE_GNA_CONFIG_KEY(PERF_COUNT_WINDOW);
+
+/**
+* @brief The option to pack frames of independent streams into the batch of the network: with YES every position
+* of the batch dimension is a stream of its own, the memory states are kept per stream and QueryState() returns
+* a state per batch position. A state can be saved with GetLastState() and restored into any position with SetState(),
+* so streams of concurrent users can share one device pass. By default (NO) the batch holds frames of one stream.
+* Cannot be combined with GNA_INPUT_FRAMES_SHIFT.
+*/
+DECLARE_GNA_CONFIG_KEY(BATCH_STREAMS);
 }  // namespace GNAConfigParams
+
+/**
+ * @def GNA_METRIC(name)
+ * @brief Shortcut for defining GNA metrics
+ */
+#define GNA_METRIC(name) METRIC_KEY(GNA_##name)
+#define DECLARE_GNA_METRIC(name, ...) DECLARE_METRIC_KEY(GNA_##name, __VA_ARGS__)
+
+namespace Metrics {
+
+/**
+ * @brief Metric of ExecutableNetwork to get the layer statistics collected with GNA_COLLECT_STATISTICS.
+ * Once set to the network with ICNNNetworkStats::setNodesStats(), the statistics are used to calculate
+ * the output scale factors of activation layers and the scale factors of inputs which GNA_SCALE_FACTOR
+ * is not set for, when the network is quantized. String value is "GNA_LAYER_STATISTICS"
+ */
+DECLARE_GNA_METRIC(LAYER_STATISTICS, NetworkStatsMap);
+
+/**
+ * @brief Metric of ExecutableNetwork to get the bytes of GNA memory every layer reads and writes per inference:
+ * its inputs, outputs, weights, biases and PWL segments, keyed by the IR layer names.
+ * String value is "GNA_LAYER_MEMORY_TRAFFIC"
+ */
+DECLARE_GNA_METRIC(LAYER_MEMORY_TRAFFIC, std::map<std::string, uint64_t>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
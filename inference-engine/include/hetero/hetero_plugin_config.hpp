@@ -11,11 +11,19 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 
 #include "ie_plugin_config.hpp"
 
+/**
+ * @def HETERO_METRIC(name)
+ * @brief Shortcut for defining HETERO metrics
+ */
+#define HETERO_METRIC(name) METRIC_KEY(HETERO_##name)
+#define DECLARE_HETERO_METRIC(name, ...) DECLARE_METRIC_KEY(HETERO_##name, __VA_ARGS__)
+
 namespace InferenceEngine {
 
 /**
@@ -38,5 +46,33 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of merging the small subgraphs of the fallback policy into their neighbours.
+ * A group of connected layers assigned to one device is moved to a device it exchanges data with if this device
+ * supports all the layers of the group and the group is estimated to compute less than it copies to this device.
+ * The chosen assignment is returned by QueryNetwork() and can be reused as layer affinities.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(MERGE_SUBGRAPHS);
+
+/**
+ * @brief The key for enabling of sharing the blobs passed between subgraphs of different devices.
+ * A blob between a device with a remote context (e.g. GPU) and another one is allocated in this context,
+ * the other device accesses it through the mapped host memory, so on the unified memory of integrated GPU
+ * the blob is not copied between the devices.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(SHARE_BOUNDARY_BLOBS);
+
 }  // namespace HeteroConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric of ExecutableNetwork to get the time in milliseconds spent to load the subnetworks of every device,
+ * the devices load their subnetworks concurrently. String value is "HETERO_SUBNETWORKS_LOAD_TIME"
+ */
+DECLARE_HETERO_METRIC(SUBNETWORKS_LOAD_TIME, std::map<std::string, float>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
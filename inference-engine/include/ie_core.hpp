@@ -75,7 +75,9 @@ public:
      * @brief Reads IR xml and bin files
      * @param modelPath path to IR file
      * @param binPath path to bin file, if path is empty, will try to read bin file with the same name as xml and
-     * if bin file with the same name was not found, will load IR without weights.
+     * if bin file with the same name was not found, will load IR without weights. The file written by
+     * CNNNetwork::serialize in the binary network format is recognized by its magic number and mapped, binPath is
+     * skipped for it.
      * @return CNNNetwork
      */
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath = "") const;
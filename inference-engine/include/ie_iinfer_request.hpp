@@ -18,6 +18,7 @@
 #include <string>
 
 #include "ie_common.h"
+#include "ie_imemory_state.hpp"
 #include "ie_preprocess.hpp"
 
 namespace InferenceEngine {
@@ -177,6 +178,69 @@ public:
      * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
      */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc* resp) noexcept = 0;
+
+    /**
+     * @brief Sets the priority the following asynchronous inferences of this request are scheduled with.
+     *
+     * Executors of the plugin start the queued requests with a higher priority first. A request waiting in the queue
+     * gains priority over time, so requests with a lower priority are delayed but not starved.
+     * Plugins which do not queue requests ignore the priority.
+     *
+     * @param priority Priority of the request, the default is 0
+     * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if
+     * occurred)
+     * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
+     */
+    virtual InferenceEngine::StatusCode SetPriority(int priority, ResponseDesc* resp) noexcept = 0;
+
+    /**
+     * @brief Gets a file descriptor which becomes readable every time an asynchronous inference of this request
+     * completes, so event loops (epoll, poll, select) wait for many requests without a thread per request.
+     *
+     * The descriptor is an eventfd counter owned by the request, it is incremented on every completion and reading it
+     * (8 bytes) resets it. Wait(STATUS_ONLY) then gives the status of the completed inference.
+     * The descriptor is closed when the request is released.
+     * Available on Linux only, NOT_IMPLEMENTED is returned otherwise.
+     *
+     * @param fd The file descriptor, the same for all the calls
+     * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if
+     * occurred)
+     * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
+     */
+    virtual InferenceEngine::StatusCode GetCompletionFd(int& fd, ResponseDesc* resp) noexcept = 0;
+
+    /**
+     * @brief Gets the memory states of this request.
+     *
+     * Unlike the states of IExecutableNetwork::QueryState, which are shared by all the requests of the network, these
+     * ones belong to the request, so every request keeps a session of a recurrent network of its own. A request
+     * starts using its own states on the first call, they are zero at first.
+     *
+     * @param pState reference to a pointer that receives the memory state
+     * @param idx requested index for receiving memory state
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: InferenceEngine::OK (0) for success, OUT_OF_BOUNDS (-6) no memory state for
+     * given index, NOT_IMPLEMENTED if the plugin keeps the states in the executable network only
+     */
+    virtual StatusCode QueryState(IMemoryState::Ptr& pState, size_t idx, ResponseDesc* resp) noexcept = 0;
+
+    /**
+     * @brief Infers several independent sets of the inputs in one synchronous call.
+     *
+     * The checks of the request and the entry to the threads of the plugin are done once for the whole call, which
+     * is the most of the time of an inference of a small network. The blobs set to the request are restored after
+     * the call.
+     *
+     * @param inputs The input blobs of each inference, by the names of the inputs. The inputs missing in a map use
+     * the blobs of the request
+     * @param outputs The blobs receiving the outputs of each inference, by the names of the outputs. The outputs
+     * missing in a map are allocated and added to it
+     * @param count The number of the inferences, the number of the elements of inputs and outputs
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: InferenceEngine::OK (0) for success
+     */
+    virtual StatusCode InferBatch(const BlobMap* inputs, BlobMap* outputs, size_t count,
+                                  ResponseDesc* resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
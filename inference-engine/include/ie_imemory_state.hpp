@@ -63,6 +63,21 @@ public:
      * @return Status code of the operation: InferenceEngine::OK (0) for success
      * */
     virtual StatusCode GetLastState(Blob::CPtr& lastState, ResponseDesc* resp) const noexcept = 0;
+
+    /**
+     * @brief Makes the state live in the given blob, so the inferences read and write the memory of the application.
+     *
+     * Unlike SetState and GetLastState, nothing is copied: a server keeping one blob per session swaps the sessions of
+     * a request by binding their blobs. The blob is not touched until the next inference of the request, so the
+     * application may fill or prefetch it meanwhile. The blob must have the precision, dims and layout of the state and
+     * outlive its binding. The state must not be bound while the request is running.
+     *
+     * @param state The blob to keep the state in, nullptr binds the state back to the memory of the plugin
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: InferenceEngine::OK (0) for success, NOT_IMPLEMENTED if the state cannot be
+     * bound (e.g. the states of IExecutableNetwork::QueryState shared by the requests)
+     */
+    virtual StatusCode BindState(Blob::Ptr state, ResponseDesc* resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
\ No newline at end of file
@@ -255,6 +255,26 @@ public:
      */
     Port(const Port& port);
 
+    /**
+     * @brief Move constructor, the parameters and the data are taken from the given port
+     * @param port object to move
+     */
+    Port(Port&& port) noexcept;
+
+    /**
+     * @brief Copy operator.
+     * @param port object to copy
+     * @return Reference to the current port
+     */
+    Port& operator=(const Port& port);
+
+    /**
+     * @brief Move operator, the parameters and the data are taken from the given port
+     * @param port object to move
+     * @return Reference to the current port
+     */
+    Port& operator=(Port&& port) noexcept;
+
     /**
      * @brief Compares the given Port with the current one
      *
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
 
 #define IE_THREAD_TBB 0
 #define IE_THREAD_OMP 1
@@ -414,6 +415,123 @@ void parallel_for2d(const T0& D0, const T1& D1, const F& func) {
 #endif
 }
 
+/**
+ * @brief Keeps the threads the chunks of the work ran on between the calls of parallel_for_affine(), so the data
+ * a chunk touches stays in the cache of the same thread across consecutive loops over the same range
+ */
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+using parallel_affinity = tbb::affinity_partitioner;
+#else
+/* The static schedule of OpenMP runs the same chunks on the same threads already */
+struct parallel_affinity {};
+#endif
+
+/**
+ * @brief Runs the iterations of uneven cost: the threads take the chunks of at least grain iterations while
+ * the work lasts instead of one even chunk each, as parallel_for() does
+ */
+template <typename T0, typename F>
+void parallel_for_dynamic(const T0& D0, size_t grain, const F& func) {
+    const size_t work_amount = static_cast<size_t>(D0);
+    if (grain == 0) grain = 1;
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, work_amount, grain),
+        [&](const tbb::blocked_range<size_t>& r) {
+            for (size_t d0 = r.begin(); d0 < r.end(); ++d0) func(static_cast<T0>(d0));
+        },
+        tbb::auto_partitioner());
+#elif IE_THREAD == IE_THREAD_OMP
+    using T0_IT = typename std::make_signed<size_t>::type;
+    const int chunk = static_cast<int>(grain);
+#pragma omp parallel for schedule(dynamic, chunk)
+    for (T0_IT d0 = 0; d0 < static_cast<T0_IT>(work_amount); d0++) func(static_cast<T0>(d0));
+#elif IE_THREAD == IE_THREAD_SEQ
+    for (size_t d0 = 0; d0 < work_amount; ++d0) func(static_cast<T0>(d0));
+#endif
+}
+
+template <typename T0, typename T1, typename F>
+void parallel_for2d_dynamic(const T0& D0, const T1& D1, size_t grain, const F& func) {
+    const size_t work_amount = (size_t)D0 * D1;
+    if (work_amount == 0) return;
+    if (grain == 0) grain = 1;
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, work_amount, grain),
+        [&](const tbb::blocked_range<size_t>& r) {
+            T0 d0 {0};
+            T1 d1 {0};
+            parallel_it_init(r.begin(), d0, D0, d1, D1);
+            for (size_t iwork = r.begin(); iwork < r.end(); ++iwork) {
+                func(d0, d1);
+                parallel_it_step(d0, D0, d1, D1);
+            }
+        },
+        tbb::auto_partitioner());
+#elif IE_THREAD == IE_THREAD_OMP
+    using T0_IT = typename std::make_signed<size_t>::type;
+    const int chunk = static_cast<int>(grain);
+#pragma omp parallel for schedule(dynamic, chunk)
+    for (T0_IT iwork = 0; iwork < static_cast<T0_IT>(work_amount); iwork++) {
+        func(static_cast<T0>(iwork / D1), static_cast<T1>(iwork % D1));
+    }
+#elif IE_THREAD == IE_THREAD_SEQ
+    for_2d(0, 1, D0, D1, func);
+#endif
+}
+
+/**
+ * @brief Runs the iterations on the threads they ran on in the previous call with the same affinity, the first
+ * call records the threads
+ */
+template <typename T0, typename F>
+void parallel_for_affine(const T0& D0, parallel_affinity& affinity, const F& func) {
+    const size_t work_amount = static_cast<size_t>(D0);
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, work_amount),
+        [&](const tbb::blocked_range<size_t>& r) {
+            for (size_t d0 = r.begin(); d0 < r.end(); ++d0) func(static_cast<T0>(d0));
+        },
+        affinity);
+#elif IE_THREAD == IE_THREAD_OMP
+    using T0_IT = typename std::make_signed<size_t>::type;
+#pragma omp parallel for schedule(static)
+    for (T0_IT d0 = 0; d0 < static_cast<T0_IT>(work_amount); d0++) func(static_cast<T0>(d0));
+#elif IE_THREAD == IE_THREAD_SEQ
+    for (size_t d0 = 0; d0 < work_amount; ++d0) func(static_cast<T0>(d0));
+#endif
+}
+
+template <typename T0, typename T1, typename F>
+void parallel_for2d_affine(const T0& D0, const T1& D1, parallel_affinity& affinity, const F& func) {
+    const size_t work_amount = (size_t)D0 * D1;
+    if (work_amount == 0) return;
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, work_amount),
+        [&](const tbb::blocked_range<size_t>& r) {
+            T0 d0 {0};
+            T1 d1 {0};
+            parallel_it_init(r.begin(), d0, D0, d1, D1);
+            for (size_t iwork = r.begin(); iwork < r.end(); ++iwork) {
+                func(d0, d1);
+                parallel_it_step(d0, D0, d1, D1);
+            }
+        },
+        affinity);
+#elif IE_THREAD == IE_THREAD_OMP
+    using T0_IT = typename std::make_signed<size_t>::type;
+#pragma omp parallel for schedule(static)
+    for (T0_IT iwork = 0; iwork < static_cast<T0_IT>(work_amount); iwork++) {
+        func(static_cast<T0>(iwork / D1), static_cast<T1>(iwork % D1));
+    }
+#elif IE_THREAD == IE_THREAD_SEQ
+    for_2d(0, 1, D0, D1, func);
+#endif
+}
+
 template <typename T0, typename T1, typename T2, typename F>
 void for_3d(const int& ithr, const int& nthr, const T0& D0, const T1& D1, const T2& D2, const F& func) {
     const size_t work_amount = (size_t)D0 * D1 * D2;
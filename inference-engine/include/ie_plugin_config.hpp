@@ -12,8 +12,11 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace InferenceEngine {
@@ -92,6 +95,7 @@ DECLARE_METRIC_KEY(FULL_DEVICE_NAME, std::string);
  * The possible values:
  *  - "FP32" - device can support FP32 models
  *  - "FP16" - device can support FP16 models
+ *  - "BF16" - device can support BF16 computations for models
  *  - "INT8" - device can support models with INT8 layers
  *  - "BIN" - device can support models with BIN layers
  *  - "WINOGRAD" - device can support models where convolution implemented via Winograd transformations
@@ -100,6 +104,7 @@ DECLARE_METRIC_KEY(OPTIMIZATION_CAPABILITIES, std::vector<std::string>);
 
 DECLARE_METRIC_VALUE(FP32);
 DECLARE_METRIC_VALUE(FP16);
+DECLARE_METRIC_VALUE(BF16);
 DECLARE_METRIC_VALUE(INT8);
 DECLARE_METRIC_VALUE(BIN);
 DECLARE_METRIC_VALUE(WINOGRAD);
@@ -155,6 +160,24 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get the phases of the network loading and their durations in milliseconds, in the order the phases
+ * are started. The phases nest, the phases run by several streams report the longest stream.
+ *
+ * String value is "LOAD_NETWORK_PROFILE"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(LOAD_NETWORK_PROFILE, std::vector<std::pair<std::string, float>>);
+
+/**
+ * @brief Metric to get a std::map<std::string, uint64_t> of the memory bytes used by the executable network:
+ * "CONST" - weights and other constant data, counted once even if they are shared by the streams,
+ * "SCRATCH" - intermediate tensors of all the streams, "SCRATCH_PER_STREAM" - the ones of the largest stream,
+ * "PEAK" - the most memory used at once. A device reports only the entries it can measure.
+ *
+ * String value is "MEMORY_FOOTPRINT"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MEMORY_FOOTPRINT, std::map<std::string, uint64_t>);
+
 }  // namespace Metrics
 
 /**
@@ -339,5 +362,59 @@ DECLARE_CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS);
  */
 DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
 
+/**
+ * @brief This key defines the directory used by Core to keep compiled networks between application runs.
+ *
+ * It is passed to Core::SetConfig() without a device name. When it is set, Core::LoadNetwork imports
+ * a network previously exported for the same network, device, config and plugin version, and exports
+ * freshly compiled networks into the directory. Devices which do not support import and export
+ * are loaded as usual. An empty value disables the cache.
+ */
+DECLARE_CONFIG_KEY(CACHE_DIR);
+
+/**
+ * @brief This key enables automatic batching of inference requests in Core::LoadNetwork.
+ *
+ * The value is the number N > 1 of requests executed at once. The network is loaded with the batch of N, while
+ * the requests of the returned executable network keep the batch of 1 of the original network. Requests started
+ * within PluginConfigParams::KEY_AUTO_BATCH_TIMEOUT are packed into one request of the batched network, if the batch
+ * is not filled up by then it is run partially filled. With PluginConfigParams::KEY_DYN_BATCH_ENABLED set to
+ * PluginConfigParams::YES only the filled part of the batch is computed. "1" (default) disables the batching.
+ * The batch must be the outer dimension of all inputs and outputs, otherwise the network is not loaded
+ * (e.g. DetectionOutput gathers the batch into another dimension).
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_SIZE);
+
+/**
+ * @brief The time in milliseconds a request waits for other requests to fill the batch up,
+ * see PluginConfigParams::KEY_AUTO_BATCH_SIZE. Default value is "1".
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+
+/**
+ * @brief The limit of the memory in bytes an executable network may use, see Metrics::METRIC_MEMORY_FOOTPRINT.
+ *
+ * A device which supports the key loads fewer streams than requested when all of them do not fit the budget, and
+ * fails the loading when even one stream does not fit it. "0" (default) means no limit.
+ */
+DECLARE_CONFIG_KEY(MEMORY_BUDGET);
+
+/**
+ * @brief The number of bytes of the freed blobs the default allocator keeps for the next blobs of the same size.
+ *
+ * It is passed to Core::SetConfig() without a device name and applies to the whole process. The blobs of the infer
+ * requests created again and again are then served without the system allocator. "0" (default) disables the pool.
+ */
+DECLARE_CONFIG_KEY(BLOB_ALLOCATOR_POOL_SIZE);
+
+/**
+ * @brief This key backs the blobs of at least 2 MB allocated by the default allocator with the huge pages.
+ *
+ * It is passed to Core::SetConfig() without a device name and applies to the whole process. The explicit huge
+ * pages are used when the system reserves them, the transparent huge pages otherwise. The values are
+ * PluginConfigParams::YES and PluginConfigParams::NO (default).
+ */
+DECLARE_CONFIG_KEY(BLOB_ALLOCATOR_HUGE_PAGES);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
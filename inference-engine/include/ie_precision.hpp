@@ -27,6 +27,7 @@ public:
         MIXED = 0,         /**< Mixed value. Can be received from network. No applicable for tensors */
         FP32 = 10,         /**< 32bit floating point value */
         FP16 = 11,         /**< 16bit floating point value */
+        BF16 = 12,         /**< 16bit floating point value, 8 bit for exponent, 7 bit for mantisa*/
         Q78 = 20,          /**< 16bit specific signed fixed point precision */
         I16 = 30,          /**< 16bit signed integer value */
         U8 = 40,           /**< 8bit unsigned integer value */
@@ -105,6 +106,7 @@ public:
             switch (precisionInfo.value) {
                 CASE(FP32, float);
                 CASE2(FP16, int16_t, uint16_t);
+                CASE2(BF16, int16_t, uint16_t);
                 CASE(I16, int16_t);
                 CASE(I32, int32_t);
                 CASE(I64, int64_t);
@@ -176,6 +178,7 @@ public:
             PRECISION_NAME(Q78),  PRECISION_NAME(U8),    PRECISION_NAME(I8),  PRECISION_NAME(I16),
             PRECISION_NAME(I32),  PRECISION_NAME(I64),   PRECISION_NAME(U16), PRECISION_NAME(FP32),
             PRECISION_NAME(FP16), PRECISION_NAME(MIXED), PRECISION_NAME(BIN), PRECISION_NAME(BOOL),
+            PRECISION_NAME(BF16),
 #undef PRECISION_NAME
         };
         auto i = names.find(str);
@@ -202,6 +205,7 @@ public:
     bool isSigned() const noexcept {
         return (precisionInfo.value == Precision::UNSPECIFIED) || (precisionInfo.value == Precision::MIXED) ||
                (precisionInfo.value == Precision::FP32) || (precisionInfo.value == Precision::FP16) ||
+               (precisionInfo.value == Precision::BF16) ||
                (precisionInfo.value == Precision::Q78) || (precisionInfo.value == Precision::I16) ||
                (precisionInfo.value == Precision::I8) || (precisionInfo.value == Precision::I32) ||
                (precisionInfo.value == Precision::I64) || (precisionInfo.value == Precision::BIN) ||
@@ -245,6 +249,7 @@ protected:
         switch (v) {
             CASE(FP32);
             CASE(FP16);
+            CASE(BF16);
             CASE(I16);
             CASE(I32);
             CASE(I64);
@@ -279,6 +284,10 @@ struct PrecisionTrait<Precision::FP16> {
     using value_type = int16_t;
 };
 template <>
+struct PrecisionTrait<Precision::BF16> {
+    using value_type = int16_t;
+};
+template <>
 struct PrecisionTrait<Precision::Q78> {
     using value_type = uint16_t;
 };
@@ -335,6 +344,8 @@ inline uint8_t type_size_or_zero<void>() {
 
 template <Precision::ePrecision T>
 inline typename std::enable_if<std::is_same<std::integral_constant<Precision::ePrecision, Precision::FP16>,
+                                            std::integral_constant<Precision::ePrecision, T>>::value ||
+                               std::is_same<std::integral_constant<Precision::ePrecision, Precision::BF16>,
                                             std::integral_constant<Precision::ePrecision, T>>::value,
                                bool>::type
 is_floating() {
@@ -343,6 +354,8 @@ is_floating() {
 
 template <Precision::ePrecision T>
 inline typename std::enable_if<!std::is_same<std::integral_constant<Precision::ePrecision, Precision::FP16>,
+                                             std::integral_constant<Precision::ePrecision, T>>::value &&
+                               !std::is_same<std::integral_constant<Precision::ePrecision, Precision::BF16>,
                                              std::integral_constant<Precision::ePrecision, T>>::value,
                                bool>::type
 is_floating() {
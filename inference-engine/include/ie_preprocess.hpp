@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <vector>
 
@@ -47,7 +49,22 @@ enum MeanVariant {
  * @enum ResizeAlgorithm
  * @brief Represents the list of supported resize algorithms.
  */
-enum ResizeAlgorithm { NO_RESIZE = 0, RESIZE_BILINEAR, RESIZE_AREA };
+enum ResizeAlgorithm { NO_RESIZE = 0, RESIZE_BILINEAR, RESIZE_AREA, RESIZE_NEAREST, RESIZE_CUBIC };
+
+/**
+ * @brief This structure describes how an input is placed to the network input by the letterbox resize.
+ *
+ * The input is resized by `scale` keeping its aspect ratio to `sizeX` x `sizeY` region at (`posX`, `posY`),
+ * the rest of the network input is padded. A point (x, y) of the network input maps to
+ * ((x - posX) / scale, (y - posY) / scale) of the input.
+ */
+struct LetterboxInfo {
+    float scale;   // Factor the input is resized with
+    size_t posX;   // W upper left coordinate of the resized input
+    size_t posY;   // H upper left coordinate of the resized input
+    size_t sizeX;  // W size of the resized input
+    size_t sizeY;  // H size of the resized input
+};
 
 /**
  * @brief This class stores pre-process information for the input
@@ -63,6 +80,14 @@ class PreProcessInfo {
     // Color format to be used in on-demand color conversions applied to input before inference
     ColorFormat _colorFormat = ColorFormat::RAW;
 
+    // Region of the input to be cropped and resized, if any
+    ROI _roi = {};
+    bool _hasROI = false;
+
+    // Letterbox resize keeping the aspect ratio of the input, the rest is padded with the value
+    bool _letterbox = false;
+    float _padValue = 0.f;
+
 public:
     /**
      * @brief Overloaded [] operator to safely get the channel by an index
@@ -221,5 +246,114 @@ public:
     ColorFormat getColorFormat() const {
         return _colorFormat;
     }
+
+    /**
+     * @brief Sets a region of the input blob to be pre-processed instead of the whole blob
+     *
+     * The region is cropped as a part of the resize, so only the input rows it covers are read.
+     * For NV12 and I420 inputs the region is set in the Y plane coordinates and must be aligned by 2.
+     *
+     * @param roi A region of the input blob
+     */
+    void setROI(const ROI& roi) {
+        _roi = roi;
+        _hasROI = true;
+    }
+
+    /**
+     * @brief Makes the whole input blob to be pre-processed again
+     */
+    void resetROI() {
+        _roi = {};
+        _hasROI = false;
+    }
+
+    /**
+     * @brief Checks if a region of the input blob is set to be pre-processed
+     *
+     * @return true if ROI is set, false otherwise
+     */
+    bool hasROI() const {
+        return _hasROI;
+    }
+
+    /**
+     * @brief Gets the region of the input blob to be pre-processed
+     *
+     * @return ROI, valid only if hasROI() returns true
+     */
+    const ROI& getROI() const {
+        return _roi;
+    }
+
+    /**
+     * @brief Makes the resize keep the aspect ratio of the input (letterbox)
+     *
+     * The input is resized to fit the network input and centered in it, the rest of the network input
+     * is filled with the pad value. The pad value is given in the range of the input data, so it goes
+     * through the mean and scale normalization, if any. Resize algorithm must be set as well.
+     *
+     * @param padValue A value to fill the network input around the resized input with
+     */
+    void setLetterbox(float padValue = 0.f) {
+        _letterbox = true;
+        _padValue = padValue;
+    }
+
+    /**
+     * @brief Makes the input be resized to the whole network input again
+     */
+    void resetLetterbox() {
+        _letterbox = false;
+        _padValue = 0.f;
+    }
+
+    /**
+     * @brief Checks if the letterbox resize is set
+     *
+     * @return true if the letterbox resize is set, false otherwise
+     */
+    bool hasLetterbox() const {
+        return _letterbox;
+    }
+
+    /**
+     * @brief Gets the value the network input is padded with by the letterbox resize
+     *
+     * @return The pad value, valid only if hasLetterbox() returns true
+     */
+    float getLetterboxPadValue() const {
+        return _padValue;
+    }
+
+    /**
+     * @brief Gets the scale and the offset the letterbox resize applies to an input
+     *
+     * Post-processing can use them to map the coordinates on the network input back to the input.
+     *
+     * @param srcWidth Width of the input (or of its ROI, if set)
+     * @param srcHeight Height of the input (or of its ROI, if set)
+     * @param dstWidth Width of the network input
+     * @param dstHeight Height of the network input
+     * @return The letterbox placement of the input
+     */
+    static LetterboxInfo getLetterboxInfo(size_t srcWidth, size_t srcHeight, size_t dstWidth, size_t dstHeight) {
+        if (srcWidth == 0 || srcHeight == 0 || dstWidth == 0 || dstHeight == 0) {
+            THROW_IE_EXCEPTION << "Letterbox resize is not applicable to empty images";
+        }
+        const float scale = std::min(static_cast<float>(dstWidth) / srcWidth,
+                                     static_cast<float>(dstHeight) / srcHeight);
+        const auto fit = [scale](size_t src, size_t dst) {
+            const auto size = static_cast<size_t>(std::lround(src * scale));
+            return std::min(std::max(size, static_cast<size_t>(1)), dst);
+        };
+        LetterboxInfo info;
+        info.scale = scale;
+        info.sizeX = fit(srcWidth, dstWidth);
+        info.sizeY = fit(srcHeight, dstHeight);
+        info.posX = (dstWidth - info.sizeX) / 2;
+        info.posY = (dstHeight - info.sizeY) / 2;
+        return info;
+    }
 };
 }  // namespace InferenceEngine
@@ -85,6 +85,22 @@ static const char progress_message[] = "Optional. Show progress bar (can affect
 // @brief message for performance counters option
 static const char pc_message[] = "Optional. Report performance counters.";
 
+// @brief message for open-loop target rate option
+static const char qps_message[] = "Optional. Enable the open-loop mode of the asynchronous API: requests arrive at the given rate "
+                                  "(requests per second) regardless of the completion of the previous ones and wait in a queue "
+                                  "for an idle infer request. The reported latency percentiles include the queueing time. "
+                                  "Default value is 0, which is the closed-loop mode, each request is restarted once it completes.";
+
+// @brief message for multi-model scenario option
+static const char scenario_message[] = "Optional. Path to a scenario file to run several networks concurrently instead of -m. "
+                                       "Every line is a path to an .xml file followed by the options of the network: "
+                                       "d=<device>, nstreams=<integer>, nireq=<integer>, b=<integer>, qps=<float> "
+                                       "and arrival=<poisson/constant>. The networks are run for -t seconds.";
+
+// @brief message for open-loop arrival distribution option
+static const char arrival_message[] = "Optional. Distribution of the request arrivals in the open-loop mode: "
+                                      "\"poisson\" (default) or \"constant\".";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -155,6 +171,15 @@ DEFINE_bool(progress, false, progress_message);
 /// @brief Define flag for showing performance counters <br>
 DEFINE_bool(pc, false, pc_message);
 
+/// @brief Target arrival rate of the open-loop mode, 0 means the closed loop
+DEFINE_double(qps, 0.0, qps_message);
+
+/// @brief Arrival distribution of the open-loop mode
+DEFINE_string(arrival, "poisson", arrival_message);
+
+/// @brief Path to the multi-model scenario file
+DEFINE_string(scenario, "", scenario_message);
+
 /**
 * @brief This function show a help message
 */
@@ -177,6 +202,9 @@ static void showUsage() {
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
+    std::cout << "    -qps \"<float>\"            " << qps_message << std::endl;
+    std::cout << "    -arrival \"<type>\"         " << arrival_message << std::endl;
+    std::cout << "    -scenario \"<path>\"        " << scenario_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
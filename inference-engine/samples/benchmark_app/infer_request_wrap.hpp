@@ -43,6 +43,14 @@ public:
 
     void startAsync() {
         _startTime = Time::now();
+        _submitTime = _startTime;
+        _request.StartAsync();
+    }
+
+    /// @brief Starts the request which arrived at arrivalTime, so the latency includes the time it waited for the request
+    void startAsync(Time::time_point arrivalTime) {
+        _startTime = Time::now();
+        _submitTime = arrivalTime;
         _request.StartAsync();
     }
 
@@ -52,6 +60,7 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _submitTime = _startTime;
         _request.Infer();
         _endTime = Time::now();
         _callbackQueue(_id, getExecutionTimeInMilliseconds());
@@ -66,12 +75,17 @@ public:
     }
 
     double getExecutionTimeInMilliseconds() const {
-        auto execTime = std::chrono::duration_cast<ns>(_endTime - _startTime);
+        auto execTime = std::chrono::duration_cast<ns>(_endTime - _submitTime);
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    StatisticsReport::RequestTimes getTimes() const {
+        return {_id, _submitTime, _startTime, _endTime};
+    }
+
 private:
     InferenceEngine::InferRequest _request;
+    Time::time_point _submitTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -102,6 +116,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _timeline.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -112,6 +127,7 @@ public:
                         const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _timeline.push_back(requests.at(id)->getTimes());
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -135,6 +151,10 @@ public:
         return _latencies;
     }
 
+    std::vector<StatisticsReport::RequestTimes> getTimeline() {
+        return _timeline;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -144,4 +164,5 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<StatisticsReport::RequestTimes> _timeline;
 };
@@ -6,7 +6,9 @@
 #include <chrono>
 #include <memory>
 #include <map>
+#include <random>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -22,6 +24,7 @@
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
 #include "inputs_filling.hpp"
+#include "scenario.hpp"
 #include "utils.hpp"
 
 #ifdef __linux__
@@ -51,7 +54,7 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_scenario.empty()) {
         throw std::logic_error("Model is required but not set. Please set -m option.");
     }
 
@@ -70,6 +73,18 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (FLAGS_qps < 0) {
+        throw std::logic_error("Incorrect target rate. Please set -qps option to a positive value or 0.");
+    }
+
+    if (FLAGS_qps > 0 && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode requires the asynchronous API. Please set -api option to `async` value.");
+    }
+
+    if (FLAGS_arrival != "poisson" && FLAGS_arrival != "constant") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `poisson` or `constant` value.");
+    }
+
     return true;
 }
 
@@ -121,6 +136,17 @@ int main(int argc, char *argv[]) {
             return 0;
         }
 
+        if (!FLAGS_scenario.empty()) {
+            auto scenario = parseScenario(FLAGS_scenario);
+            uint32_t duration_seconds = FLAGS_t;
+            for (auto& model : scenario) {
+                if (FLAGS_t == 0)
+                    duration_seconds = std::max(duration_seconds, deviceDefaultDeviceDurationInSeconds(model.device));
+            }
+            runScenario(scenario, duration_seconds, FLAGS_l);
+            return 0;
+        }
+
         bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
         if (isNetworkCompiled) {
             slog::info << "Network is compiled" << slog::endl;
@@ -314,6 +340,22 @@ int main(int argc, char *argv[]) {
                                           {
                                               {"load network time (ms)", duration_ms}
                                           });
+
+            std::vector<std::string> supportedMetrics = exeNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+            if (std::find(supportedMetrics.begin(), supportedMetrics.end(), METRIC_KEY(LOAD_NETWORK_PROFILE)) !=
+                supportedMetrics.end()) {
+                std::vector<std::pair<std::string, float>> loadProfile = exeNetwork.GetMetric(METRIC_KEY(LOAD_NETWORK_PROFILE));
+                slog::info << "Load network phases:" << slog::endl;
+                for (auto&& phase : loadProfile) {
+                    const auto phase_ms = double_to_string(phase.second);
+                    slog::info << "    " << phase.first << ": " << phase_ms << " ms" << slog::endl;
+                    if (statistics)
+                        statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                                  {
+                                                      {"load phase " + phase.first + " (ms)", phase_ms}
+                                                  });
+                }
+            }
         } else {
             next_step();
             slog::info << "Skipping the step for compiled network" << slog::endl;
@@ -353,9 +395,12 @@ int main(int argc, char *argv[]) {
             }
         }
 
+        // Open-loop mode, the requests arrive at the target rate
+        const bool openLoop = FLAGS_qps > 0;
+
         // Iteration limit
         uint32_t niter = FLAGS_niter;
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        if ((niter > 0) && (FLAGS_api == "async") && !openLoop) {
             niter = ((niter + nireq - 1)/nireq)*nireq;
             if (FLAGS_niter != niter) {
                 slog::warn << "Number of iterations was aligned by request number from "
@@ -386,6 +431,13 @@ int main(int argc, char *argv[]) {
                                             {"number of parallel infer requests", std::to_string(nireq)},
                                             {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
                                       });
+            if (openLoop) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                          {
+                                                {"target rate (requests/s)", double_to_string(FLAGS_qps)},
+                                                {"arrival distribution", FLAGS_arrival},
+                                          });
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -430,6 +482,9 @@ int main(int argc, char *argv[]) {
         if (duration_seconds > 0) {
             ss << getDurationInMilliseconds(duration_seconds) << " ms duration";
         }
+        if (openLoop) {
+            ss << ", " << FLAGS_arrival << " arrivals at " << FLAGS_qps << " requests/s";
+        }
         if (niter != 0) {
             if (duration_seconds == 0) {
                 progressBarTotalCount = niter;
@@ -462,15 +517,42 @@ int main(int argc, char *argv[]) {
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+        // open-loop arrivals are scheduled from the start time independently of the completions, a request arriving
+        // while all the infer requests are busy waits for the first one to become idle
+        std::mt19937 arrivalGenerator(0);
+        std::exponential_distribution<double> poissonIntervals(openLoop ? FLAGS_qps : 1.0);
+        auto arrivalTime = startTime;
+        auto reachedLimits = [&] {
+            if (openLoop) {
+                auto arrivalOffset = std::chrono::duration_cast<ns>(arrivalTime - startTime).count();
+                return !((niter != 0LL && iteration < niter) ||
+                         (duration_nanoseconds != 0LL && (uint64_t)arrivalOffset < duration_nanoseconds));
+            }
+            return !((niter != 0LL && iteration < niter) ||
+                     (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                     (FLAGS_api == "async" && iteration % nireq != 0));
+        };
+        double maxQueueingTime = 0.0;
+
+        while (!reachedLimits()) {
+            if (openLoop) {
+                std::this_thread::sleep_until(arrivalTime);
+            }
+
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 THROW_IE_EXCEPTION << "No idle Infer Requests!";
             }
 
-            if (FLAGS_api == "sync") {
+            if (openLoop) {
+                maxQueueingTime = std::max(maxQueueingTime,
+                                           std::chrono::duration_cast<ns>(Time::now() - arrivalTime).count() * 0.000001);
+                inferRequest->wait();
+                inferRequest->startAsync(arrivalTime);
+
+                const double interval = FLAGS_arrival == "constant" ? 1.0 / FLAGS_qps : poissonIntervals(arrivalGenerator);
+                arrivalTime += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+            } else if (FLAGS_api == "sync") {
                 inferRequest->infer();
             } else {
                 // As the inference request is currently idle, the wait() adds no additional overhead (and should return immediately).
@@ -506,6 +588,21 @@ int main(int argc, char *argv[]) {
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
                                              batchSize * 1000.0 * iteration / totalDuration;
 
+        // the device is saturated if it doesn't keep up with the arrivals, so the queue grows during the run
+        std::vector<std::pair<std::string, double>> latencyPercentiles;
+        double sustainedRate = 1000.0 * iteration / totalDuration;
+        bool saturated = openLoop && sustainedRate < 0.95 * FLAGS_qps;
+        if (openLoop) {
+            auto sortedLatencies = inferRequestsQueue.getLatencies();
+            std::sort(sortedLatencies.begin(), sortedLatencies.end());
+            const std::vector<std::pair<std::string, double>> percentiles = {
+                {"p50", 50.0}, {"p90", 90.0}, {"p99", 99.0}, {"p99.9", 99.9}};
+            for (auto& percentile : percentiles) {
+                latencyPercentiles.emplace_back(percentile.first,
+                                                getPercentileValue(sortedLatencies, percentile.second));
+            }
+        }
+
         if (statistics) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
@@ -522,6 +619,20 @@ int main(int argc, char *argv[]) {
                                       {
                                           {"throughput", double_to_string(fps)}
                                       });
+            if (openLoop) {
+                for (auto& percentile : latencyPercentiles) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                  {percentile.first + " latency (ms)", double_to_string(percentile.second)},
+                                              });
+                }
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                              {"sustained rate (requests/s)", double_to_string(sustainedRate)},
+                                              {"max queueing time (ms)", double_to_string(maxQueueingTime)},
+                                              {"saturated", saturated ? "YES" : "NO"},
+                                          });
+            }
         }
 
         progressBar.finish();
@@ -554,14 +665,30 @@ int main(int argc, char *argv[]) {
             }
         }
 
-        if (statistics)
+        if (statistics) {
             statistics->dump();
+            statistics->dumpLatencyHistogram(inferRequestsQueue.getLatencies());
+            statistics->dumpRequestsTimeline(inferRequestsQueue.getTimeline());
+        }
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
         if (device_name.find("MULTI") == std::string::npos)
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        if (openLoop) {
+            std::cout << "Latency percentiles including queueing:";
+            for (auto& percentile : latencyPercentiles) {
+                std::cout << " " << percentile.first << " " << double_to_string(percentile.second) << " ms";
+            }
+            std::cout << std::endl;
+            std::cout << "Sustained rate: " << double_to_string(sustainedRate) << " of " << double_to_string(FLAGS_qps)
+                      << " requests/s" << std::endl;
+            if (saturated) {
+                slog::warn << "The device is saturated: it doesn't sustain the target rate, the requests were queued up to "
+                           << double_to_string(maxQueueingTime) << " ms" << slog::endl;
+            }
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
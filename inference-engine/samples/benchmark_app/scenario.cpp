@@ -0,0 +1,245 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <inference_engine.hpp>
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "scenario.hpp"
+#include "utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+std::string doubleToString(const double number) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << number;
+    return ss.str();
+}
+
+struct ModelRun {
+    ScenarioModel config;
+    ExecutableNetwork network;
+    size_t batchSize = 1;
+    std::unique_ptr<InferRequestsQueue> queue;
+    size_t iterations = 0;
+    double maxQueueingTime = 0.0;
+    std::string error;
+};
+
+/// @brief Drives the network in closed loop or with open-loop arrivals like the single network mode does
+void drive(ModelRun& run, Time::time_point startTime, uint64_t durationNanoseconds, unsigned seed) {
+    const bool openLoop = run.config.qps > 0;
+    std::mt19937 arrivalGenerator(seed);
+    std::exponential_distribution<double> poissonIntervals(openLoop ? run.config.qps : 1.0);
+    auto arrivalTime = startTime;
+
+    while (true) {
+        if (openLoop) {
+            if (static_cast<uint64_t>(std::chrono::duration_cast<ns>(arrivalTime - startTime).count()) >= durationNanoseconds)
+                break;
+            std::this_thread::sleep_until(arrivalTime);
+        } else if (static_cast<uint64_t>(std::chrono::duration_cast<ns>(Time::now() - startTime).count()) >= durationNanoseconds) {
+            break;
+        }
+
+        auto inferRequest = run.queue->getIdleRequest();
+        // rechecks the exceptions of the previous inference of the request
+        inferRequest->wait();
+        if (openLoop) {
+            run.maxQueueingTime = std::max(run.maxQueueingTime,
+                                           std::chrono::duration_cast<ns>(Time::now() - arrivalTime).count() * 0.000001);
+            inferRequest->startAsync(arrivalTime);
+
+            const double interval = run.config.arrival == "constant" ? 1.0 / run.config.qps : poissonIntervals(arrivalGenerator);
+            arrivalTime += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+        } else {
+            inferRequest->startAsync();
+        }
+        run.iterations++;
+    }
+    run.queue->waitAll();
+}
+
+std::string latencyPercentilesToString(std::vector<double> latencies) {
+    if (latencies.empty())
+        return "no inferences";
+    std::sort(latencies.begin(), latencies.end());
+    return "p50 " + doubleToString(getPercentileValue(latencies, 50.0)) +
+           " ms, p90 " + doubleToString(getPercentileValue(latencies, 90.0)) +
+           " ms, p99 " + doubleToString(getPercentileValue(latencies, 99.0)) + " ms";
+}
+
+}  // namespace
+
+std::vector<ScenarioModel> parseScenario(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::logic_error("Cannot open scenario file " + path);
+    }
+
+    std::vector<ScenarioModel> scenario;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream tokens(line);
+        ScenarioModel model;
+        if (!(tokens >> model.model) || model.model[0] == '#')
+            continue;
+
+        std::string option;
+        while (tokens >> option) {
+            const auto delimiter = option.find('=');
+            if (delimiter == std::string::npos) {
+                throw std::logic_error("Scenario option " + option + " of " + model.model + " is not a key=value pair");
+            }
+            const auto key = option.substr(0, delimiter);
+            const auto value = option.substr(delimiter + 1);
+            try {
+                if (key == "d") {
+                    model.device = value;
+                } else if (key == "nstreams") {
+                    model.nstreams = std::stoi(value);
+                } else if (key == "nireq") {
+                    model.nireq = std::stoi(value);
+                } else if (key == "b") {
+                    model.batch = std::stoi(value);
+                } else if (key == "qps") {
+                    model.qps = std::stod(value);
+                } else if (key == "arrival") {
+                    model.arrival = value;
+                } else {
+                    throw std::logic_error("Unknown scenario option " + key + " of " + model.model);
+                }
+            } catch (const std::invalid_argument&) {
+                throw std::logic_error("Wrong value of scenario option " + option + " of " + model.model);
+            }
+        }
+        if (model.qps < 0 || (model.arrival != "poisson" && model.arrival != "constant")) {
+            throw std::logic_error("Wrong arrivals of " + model.model + ", expected qps >= 0 and poisson or constant arrival");
+        }
+        scenario.push_back(model);
+    }
+
+    if (scenario.empty()) {
+        throw std::logic_error("Scenario file " + path + " has no networks");
+    }
+    return scenario;
+}
+
+void runScenario(const std::vector<ScenarioModel>& scenario, uint32_t durationSeconds, const std::string& cpuExtension) {
+    Core ie;
+    if (!cpuExtension.empty()) {
+        const auto extension_ptr = InferenceEngine::make_so_pointer<InferenceEngine::IExtension>(cpuExtension);
+        ie.AddExtension(extension_ptr, "CPU");
+        slog::info << "CPU (MKLDNN) extensions is loaded " << cpuExtension << slog::endl;
+    }
+
+    // all the networks are loaded before any of them is started, so they are measured under the same load
+    std::vector<std::unique_ptr<ModelRun>> runs;
+    for (auto& model : scenario) {
+        std::unique_ptr<ModelRun> run(new ModelRun);
+        run->config = model;
+
+        CNNNetwork network = ie.ReadNetwork(model.model);
+        if (model.batch != 0)
+            network.setBatchSize(model.batch);
+        run->batchSize = network.getBatchSize();
+
+        std::map<std::string, std::string> config;
+        if (model.nstreams != 0) {
+            if (model.device == "CPU") {
+                config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = std::to_string(model.nstreams);
+            } else if (model.device == "GPU") {
+                config[CONFIG_KEY(GPU_THROUGHPUT_STREAMS)] = std::to_string(model.nstreams);
+            } else {
+                slog::warn << "Number of streams is ignored for " << model.model << " on " << model.device << slog::endl;
+            }
+        }
+        run->network = ie.LoadNetwork(network, model.device, config);
+
+        uint32_t nireq = model.nireq;
+        if (nireq == 0)
+            nireq = run->network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        run->queue.reset(new InferRequestsQueue(run->network, nireq));
+        fillBlobs({}, run->batchSize, run->network.GetInputsInfo(), run->queue->requests);
+
+        slog::info << "Loaded " << model.model << " to " << model.device << " with " << nireq << " infer requests, "
+                   << (model.qps > 0 ? model.arrival + " arrivals at " + doubleToString(model.qps) + " requests/s"
+                                     : std::string("closed loop")) << slog::endl;
+        runs.push_back(std::move(run));
+    }
+
+    // warming up - out of scope
+    for (auto& run : runs) {
+        run->queue->getIdleRequest()->startAsync();
+        run->queue->waitAll();
+        run->queue->resetTimes();
+    }
+
+    slog::info << "Start inference of " << runs.size() << " networks for " << durationSeconds << " s" << slog::endl;
+    const uint64_t durationNanoseconds = durationSeconds * 1000000000ULL;
+    const auto startTime = Time::now();
+    std::vector<std::thread> drivers;
+    for (size_t i = 0; i < runs.size(); i++) {
+        auto run = runs[i].get();
+        drivers.emplace_back([run, startTime, durationNanoseconds, i] {
+            try {
+                drive(*run, startTime, durationNanoseconds, static_cast<unsigned>(i));
+            } catch (const std::exception& ex) {
+                run->error = ex.what();
+            }
+        });
+    }
+    for (auto& driver : drivers)
+        driver.join();
+
+    for (auto& run : runs) {
+        if (!run->error.empty())
+            throw std::runtime_error(run->config.model + ": " + run->error);
+    }
+
+    double aggregateThroughput = 0.0;
+    std::vector<double> allLatencies;
+    for (auto& run : runs) {
+        const auto latencies = run->queue->getLatencies();
+        const double duration = run->queue->getDurationInMilliseconds();
+        const double throughput = run->batchSize * 1000.0 * run->iterations / duration;
+        aggregateThroughput += throughput;
+        allLatencies.insert(allLatencies.end(), latencies.begin(), latencies.end());
+
+        std::cout << run->config.model << " on " << run->config.device << ":" << std::endl;
+        std::cout << "    Count:      " << run->iterations << " iterations" << std::endl;
+        std::cout << "    Throughput: " << doubleToString(throughput) << " FPS" << std::endl;
+        std::cout << "    Latency:    " << latencyPercentilesToString(latencies) << std::endl;
+        if (run->config.qps > 0) {
+            const double sustainedRate = 1000.0 * run->iterations / duration;
+            std::cout << "    Sustained rate: " << doubleToString(sustainedRate) << " of "
+                      << doubleToString(run->config.qps) << " requests/s" << std::endl;
+            if (sustainedRate < 0.95 * run->config.qps) {
+                slog::warn << "The device is saturated by " << run->config.model << ": the requests were queued up to "
+                           << doubleToString(run->maxQueueingTime) << " ms" << slog::endl;
+            }
+        }
+    }
+
+    std::cout << "All networks:" << std::endl;
+    std::cout << "    Throughput: " << doubleToString(aggregateThroughput) << " FPS" << std::endl;
+    std::cout << "    Latency:    " << latencyPercentilesToString(allLatencies) << std::endl;
+}
@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+/// @brief A network of the multi-model scenario, the device it is loaded to and the way it is driven
+struct ScenarioModel {
+    std::string model;
+    std::string device = "CPU";
+    uint32_t nstreams = 0;          // 0 - determined automatically for the device
+    uint32_t nireq = 0;             // 0 - the optimal number of requests of the device
+    uint32_t batch = 0;             // 0 - the batch of the IR
+    double qps = 0.0;               // 0 - closed loop
+    std::string arrival = "poisson";
+};
+
+/**
+ * @brief Parses the scenario file: a network per line, the path to the .xml followed by the options
+ * as key=value pairs: d=<device>, nstreams=<integer>, nireq=<integer>, b=<integer>, qps=<float>,
+ * arrival=poisson/constant. Empty lines and lines starting with # are skipped
+ */
+std::vector<ScenarioModel> parseScenario(const std::string& path);
+
+/**
+ * @brief Loads the networks of the scenario to the same Core and drives all of them concurrently
+ * for the given duration, then reports the throughput and the latency of each network and the aggregate ones
+ */
+void runScenario(const std::vector<ScenarioModel>& scenario, uint32_t durationSeconds, const std::string& cpuExtension);
@@ -7,6 +7,8 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <cmath>
+#include <fstream>
 
 #include "statistics_report.hpp"
 
@@ -132,3 +134,87 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Pefromance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+void StatisticsReport::dumpLatencyHistogram(const std::vector<double> &latencies) {
+    if (latencies.empty())
+        return;
+
+    // HDR-style buckets: every power of two of microseconds is split into the same number of linear buckets,
+    // so the width of a bucket is within 1/subBuckets of its bound at any latency
+    const size_t subBuckets = 16;
+    auto bucketOf = [&] (double latency) {
+        const double us = std::max(1.0, latency * 1000.0);
+        const int exponent = static_cast<int>(std::floor(std::log2(us)));
+        const double base = std::ldexp(1.0, exponent);
+        const size_t sub = std::min(subBuckets - 1, static_cast<size_t>((us - base) / base * subBuckets));
+        return static_cast<size_t>(exponent) * subBuckets + sub;
+    };
+    auto lowerBoundOf = [&] (size_t bucket) {
+        const double base = std::ldexp(1.0, static_cast<int>(bucket / subBuckets));
+        return (base + base * (bucket % subBuckets) / subBuckets) / 1000.0;
+    };
+
+    std::map<size_t, size_t> histogram;
+    for (auto latency : latencies)
+        histogram[bucketOf(latency)]++;
+
+    CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_latency_histogram.csv");
+    dumper << "lower bound (ms)" << "upper bound (ms)" << "count" << "percentile";
+    dumper.endLine();
+
+    size_t cumulative = 0;
+    for (auto& bucket : histogram) {
+        cumulative += bucket.second;
+        dumper << std::to_string(lowerBoundOf(bucket.first)) << std::to_string(lowerBoundOf(bucket.first + 1));
+        dumper << bucket.second << std::to_string(100.0 * cumulative / latencies.size());
+        dumper.endLine();
+    }
+    slog::info << "Latency histogram is stored to " << dumper.getFilename() << slog::endl;
+}
+
+void StatisticsReport::dumpRequestsTimeline(const std::vector<RequestTimes> &timeline) {
+    if (timeline.empty())
+        return;
+
+    auto origin = std::min_element(timeline.begin(), timeline.end(), [] (const RequestTimes &a, const RequestTimes &b) {
+        return a.submitTime < b.submitTime;
+    })->submitTime;
+    auto toUs = [&] (std::chrono::high_resolution_clock::time_point time) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time - origin).count() * 0.001;
+    };
+
+    CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_requests_timeline.csv");
+    dumper << "request" << "submit (ms)" << "start (ms)" << "complete (ms)" << "queueing (ms)" << "latency (ms)";
+    dumper.endLine();
+    for (auto& times : timeline) {
+        dumper << times.requestId;
+        dumper << std::to_string(toUs(times.submitTime) / 1000.0) << std::to_string(toUs(times.startTime) / 1000.0);
+        dumper << std::to_string(toUs(times.endTime) / 1000.0);
+        dumper << std::to_string((toUs(times.startTime) - toUs(times.submitTime)) / 1000.0);
+        dumper << std::to_string((toUs(times.endTime) - toUs(times.submitTime)) / 1000.0);
+        dumper.endLine();
+    }
+    slog::info << "Requests timeline is stored to " << dumper.getFilename() << slog::endl;
+
+    // every infer request is a thread of the trace, the time an inference waited for it is a separate slice
+    const std::string traceName = _config.report_folder + _separator + "benchmark_requests_trace.json";
+    std::ofstream trace(traceName);
+    if (!trace) {
+        slog::warn << "Cannot create trace file " << traceName << slog::endl;
+        return;
+    }
+    trace << std::fixed << "{\"traceEvents\":[";
+    bool first = true;
+    auto addEvent = [&] (const char *name, size_t tid, double begin, double end) {
+        trace << (first ? "" : ",") << "\n{\"name\":\"" << name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << tid
+              << ",\"ts\":" << begin << ",\"dur\":" << end - begin << "}";
+        first = false;
+    };
+    for (auto& times : timeline) {
+        if (times.startTime > times.submitTime)
+            addEvent("queued", times.requestId, toUs(times.submitTime), toUs(times.startTime));
+        addEvent("infer", times.requestId, toUs(times.startTime), toUs(times.endTime));
+    }
+    trace << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    slog::info << "Requests trace is stored to " << traceName << slog::endl;
+}
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <string>
 #include <vector>
 #include <utility>
@@ -36,6 +37,14 @@ public:
         EXECUTION_RESULTS,
     };
 
+    /// @brief Timeline of an inference: the time it was submitted (arrived), started on the infer request and completed
+    struct RequestTimes {
+        size_t requestId;
+        std::chrono::high_resolution_clock::time_point submitTime;
+        std::chrono::high_resolution_clock::time_point startTime;
+        std::chrono::high_resolution_clock::time_point endTime;
+    };
+
     explicit StatisticsReport(Config config) : _config(std::move(config)) {
         _separator =
 #if defined _WIN32 || defined __CYGWIN__
@@ -57,6 +66,12 @@ public:
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
 
+    /// @brief Dumps the histogram of the latencies in milliseconds with the buckets of the same relative width
+    void dumpLatencyHistogram(const std::vector<double> &latencies);
+
+    /// @brief Dumps the inferences timeline as .csv and as the Chrome trace .json (chrome://tracing)
+    void dumpRequestsTimeline(const std::vector<RequestTimes> &timeline);
+
 private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper,
                                         const PerformaceCounters& perfCounts);
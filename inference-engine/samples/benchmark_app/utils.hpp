@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 #include <map>
@@ -12,3 +14,10 @@ std::vector<std::string> parseDevices(const std::string& device_string);
 uint32_t deviceDefaultDeviceDurationInSeconds(const std::string& device);
 std::map<std::string, uint32_t> parseValuePerDevice(const std::vector<std::string>& devices,
                                                     const std::string& values_string);
+
+/// @brief Returns the nearest-rank percentile of the sorted values
+template <typename T>
+T getPercentileValue(const std::vector<T> &sortedVec, double percentile) {
+    size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sortedVec.size()));
+    return sortedVec[std::min(sortedVec.size(), std::max<size_t>(rank, 1)) - 1];
+}
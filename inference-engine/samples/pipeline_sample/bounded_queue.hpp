@@ -0,0 +1,122 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+/**
+ * @brief Bounded lock-free queue of many producers and many consumers.
+ *
+ * Every cell keeps a sequence number which tells whose turn it is: a producer may fill the cell when the number
+ * equals its position, a consumer may take the value when the number is the position plus one. The positions are
+ * claimed with compare-and-swap, so the threads never block each other, the full and the empty queue are reported
+ * to the caller, which decides whether to spin or to do something else.
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        if (size < 2) {
+            size = 2;
+        }
+        mask = size - 1;
+        cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /**
+     * @brief Adds the value unless the queue is full
+     * @return false if the queue is full
+     */
+    bool tryPush(T value) {
+        size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[position & mask];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (difference == 0) {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Takes the oldest value unless the queue is empty
+     * @return false if the queue is empty
+     */
+    bool tryPop(T& value) {
+        size_t position = dequeuePosition.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[position & mask];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+            if (difference == 0) {
+                if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell.value);
+                    cell.sequence.store(position + mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Adds the value, yields the thread while the queue is full
+     */
+    void push(T value) {
+        while (!tryPush(value)) {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief Takes the oldest value, yields the thread while the queue is empty
+     */
+    T pop() {
+        T value;
+        while (!tryPop(value)) {
+            std::this_thread::yield();
+        }
+        return value;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    // the positions of the producers and the consumers are on different cache lines
+    alignas(64) std::atomic<size_t> enqueuePosition{0};
+    alignas(64) std::atomic<size_t> dequeuePosition{0};
+    size_t mask = 0;
+    std::unique_ptr<Cell[]> cells;
+};
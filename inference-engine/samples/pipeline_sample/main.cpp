@@ -0,0 +1,398 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <format_reader_ptr.h>
+#include <inference_engine.hpp>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+#include <samples/args_helper.hpp>
+
+#include "pipeline_sample.h"
+#include "bounded_queue.hpp"
+
+using namespace InferenceEngine;
+
+using Clock = std::chrono::high_resolution_clock;
+
+bool ParseAndCheckCommandLine(int argc, char *argv[]) {
+    // ---------------------------Parsing and validation of input args--------------------------------------
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_h) {
+        showUsage();
+        showAvailableDevices();
+        return false;
+    }
+
+    slog::info << "Parsing input parameters" << slog::endl;
+
+    if (FLAGS_i.empty()) {
+        throw std::logic_error("Parameter -i is not set");
+    }
+
+    if (FLAGS_m.empty()) {
+        throw std::logic_error("Parameter -m is not set");
+    }
+
+    if (FLAGS_cameras == 0) {
+        throw std::logic_error("Parameter -cameras must be positive");
+    }
+
+    if (FLAGS_qsize == 0) {
+        throw std::logic_error("Parameter -qsize must be positive");
+    }
+
+    return true;
+}
+
+/**
+ * @brief Busy time of the workers of a pipeline stage
+ */
+class StageStatistics {
+public:
+    StageStatistics(const std::string& name, size_t workers) : _name(name), _workers(workers) {}
+
+    void add(Clock::time_point start, Clock::time_point end) {
+        _busy += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        _items++;
+    }
+
+    void report(double wallMs) const {
+        const double busyMs = _busy.load() / 1e6;
+        const double utilization = wallMs > 0 ? 100.0 * busyMs / (wallMs * _workers) : 0.0;
+        slog::info << std::left << std::setw(14) << _name << std::right
+                   << " workers: " << std::setw(3) << _workers
+                   << "  items: " << std::setw(6) << _items.load()
+                   << "  avg: " << std::fixed << std::setprecision(2) << std::setw(8)
+                   << (_items.load() ? busyMs / _items.load() : 0.0) << " ms"
+                   << "  utilization: " << std::setw(6) << utilization << " %" << slog::endl;
+    }
+
+private:
+    std::string _name;
+    size_t _workers;
+    std::atomic<int64_t> _busy{0};
+    std::atomic<size_t> _items{0};
+};
+
+/**
+ * @brief Decoded frame at the resolution of the source, the interleaved BGR pixels
+ */
+struct Frame {
+    std::shared_ptr<unsigned char> pixels;
+    size_t width = 0;
+    size_t height = 0;
+    size_t camera = 0;
+    Clock::time_point decoded;
+};
+
+using FramePtr = std::shared_ptr<Frame>;
+
+struct RequestContext {
+    InferRequest request;
+    FramePtr frame;
+    Clock::time_point started;
+    Clock::time_point completed;
+    StatusCode status = StatusCode::OK;
+};
+
+/**
+* \brief The entry point for the Inference Engine pipeline sample application
+* \file pipeline_sample/main.cpp
+* \example pipeline_sample/main.cpp
+*/
+int main(int argc, char *argv[]) {
+    try {
+        slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
+
+        // --------------------------- 1. Parsing and validation of input args ---------------------------------
+        if (!ParseAndCheckCommandLine(argc, argv)) {
+            return 0;
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 2. Read input -----------------------------------------------------------
+        /** This vector stores paths to the images the cameras play **/
+        std::vector<std::string> images;
+        parseInputFilesArguments(images);
+        if (images.empty()) throw std::logic_error("No suitable images were found");
+
+        const size_t cameras = FLAGS_cameras;
+        const size_t totalFrames = FLAGS_n != 0 ? FLAGS_n : images.size() * cameras;
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 3. Load inference engine -------------------------------------
+        slog::info << "Loading Inference Engine" << slog::endl;
+        Core ie;
+
+        slog::info << "Device info: " << slog::endl;
+        std::cout << ie.GetVersions(FLAGS_d);
+
+        if (!FLAGS_l.empty()) {
+            // CPU(MKLDNN) extensions are loaded as a shared library and passed as a pointer to base extension
+            IExtensionPtr extension_ptr = make_so_pointer<IExtension>(FLAGS_l);
+            ie.AddExtension(extension_ptr, "CPU");
+            slog::info << "CPU Extension loaded: " << FLAGS_l << slog::endl;
+        }
+
+        if (!FLAGS_c.empty()) {
+            // clDNN Extensions are loaded from an .xml description and OpenCL kernel files
+            ie.SetConfig({ { PluginConfigParams::KEY_CONFIG_FILE, FLAGS_c } }, "GPU");
+            slog::info << "GPU Extension loaded: " << FLAGS_c << slog::endl;
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 4. Read IR Generated by ModelOptimizer (.xml and .bin files) ------------
+        slog::info << "Loading network files:\n\t" << FLAGS_m << slog::endl;
+        CNNNetwork network = ie.ReadNetwork(FLAGS_m);
+        network.setBatchSize(1);
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 5. Configure input & output ---------------------------------------------
+        InputsDataMap inputsInfo(network.getInputsInfo());
+        if (inputsInfo.size() != 1) throw std::logic_error("Sample supports topologies with 1 input only");
+        const std::string inputName = inputsInfo.begin()->first;
+        InputInfo::Ptr inputInfo = inputsInfo.begin()->second;
+        if (inputInfo->getTensorDesc().getDims().size() != 4 || inputInfo->getTensorDesc().getDims()[1] != 3) {
+            throw std::logic_error("Sample supports topologies with a 3-channel image input only");
+        }
+
+        /**
+         * The frames come at the resolution of the source and in the interleaved layout of the decoder,
+         * the request resizes and reorders them with the G-API pre-processing before the inference
+         */
+        inputInfo->setPrecision(Precision::U8);
+        inputInfo->setLayout(Layout::NHWC);
+        inputInfo->getPreProcess().setResizeAlgorithm(ResizeAlgorithm::RESIZE_BILINEAR);
+
+        OutputsDataMap outputsInfo(network.getOutputsInfo());
+        if (outputsInfo.empty()) throw std::logic_error("The network has no outputs");
+        const std::string outputName = outputsInfo.begin()->first;
+        outputsInfo.begin()->second->setPrecision(Precision::FP32);
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 6. Loading model to the device ------------------------------------------
+        std::map<std::string, std::string> config;
+        if (!FLAGS_nstreams.empty()) {
+            if (FLAGS_d.find("CPU") != std::string::npos) {
+                config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = FLAGS_nstreams;
+            } else if (FLAGS_d.find("GPU") != std::string::npos) {
+                config[CONFIG_KEY(GPU_THROUGHPUT_STREAMS)] = FLAGS_nstreams;
+            }
+        }
+        ExecutableNetwork executableNetwork = ie.LoadNetwork(network, FLAGS_d, config);
+
+        size_t nireq = FLAGS_nireq;
+        if (nireq == 0) {
+            try {
+                nireq = executableNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))
+                            .as<unsigned int>();
+            } catch (const std::exception&) {
+                // the devices without the metric infer one request at a time
+            }
+            nireq = std::max<size_t>(nireq, 1);
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 7. Build the pipeline ---------------------------------------------------
+        /**
+         * decode (a thread per camera) -> decoded -> dispatch (this thread) -> N requests in the streams
+         * of the device -> completed -> post-process (a thread) -> free requests -> dispatch
+         *
+         * The empty frame and the empty request tell the next stage its producer has finished.
+         */
+        BoundedQueue<FramePtr> decoded(FLAGS_qsize);
+        // every request is in one of the queues or in flight, so neither of them ever is full
+        BoundedQueue<RequestContext*> completed(nireq);
+        BoundedQueue<RequestContext*> freeRequests(nireq);
+
+        StageStatistics decodeStats("decode", cameras);
+        StageStatistics dispatchStats("dispatch", 1);
+        StageStatistics inferStats("preproc+infer", nireq);
+        StageStatistics postprocessStats("postprocess", 1);
+
+        std::vector<std::unique_ptr<RequestContext>> contexts;
+        for (size_t i = 0; i < nireq; i++) {
+            std::unique_ptr<RequestContext> context(new RequestContext);
+            context->request = executableNetwork.CreateInferRequest();
+            RequestContext* contextPtr = context.get();
+            context->request.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                [contextPtr, &completed, &inferStats](InferRequest, StatusCode status) {
+                    contextPtr->completed = Clock::now();
+                    contextPtr->status = status;
+                    inferStats.add(contextPtr->started, contextPtr->completed);
+                    completed.push(contextPtr);
+                });
+            freeRequests.push(contextPtr);
+            contexts.push_back(std::move(context));
+        }
+
+        slog::info << "Running " << totalFrames << " frames of " << cameras << " camera(s) on " << nireq
+                   << " infer request(s), the queues keep " << FLAGS_qsize << " frames" << slog::endl;
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 8. Run the pipeline -----------------------------------------------------
+        const auto pipelineStart = Clock::now();
+
+        std::atomic<size_t> unreadFrames{0};
+        std::vector<std::thread> decoders;
+        for (size_t camera = 0; camera < cameras; camera++) {
+            const size_t frames = totalFrames / cameras + (camera < totalFrames % cameras ? 1 : 0);
+            decoders.emplace_back([camera, frames, &images, &decoded, &decodeStats, &unreadFrames] {
+                for (size_t i = 0; i < frames; i++) {
+                    const auto start = Clock::now();
+                    // the cameras start from different images, so they do not decode the same one at a time
+                    const std::string& path = images[(camera + i) % images.size()];
+                    FormatReader::ReaderPtr reader(path.c_str());
+                    FramePtr frame;
+                    if (reader.get() != nullptr) {
+                        frame = std::make_shared<Frame>();
+                        frame->width = reader->width();
+                        frame->height = reader->height();
+                        frame->pixels = reader->getData();
+                    }
+                    if (frame == nullptr || frame->pixels == nullptr) {
+                        unreadFrames++;
+                        continue;
+                    }
+                    frame->camera = camera;
+                    frame->decoded = Clock::now();
+                    decodeStats.add(start, frame->decoded);
+                    decoded.push(frame);
+                }
+                decoded.push(nullptr);
+            });
+        }
+
+        std::exception_ptr postprocessError;
+        size_t detections = 0;
+        double latencySumMs = 0.0;
+        double latencyMaxMs = 0.0;
+        std::vector<size_t> cameraFrames(cameras, 0);
+        const double threshold = FLAGS_t;
+        std::thread postprocessor([&] {
+            for (RequestContext* context = completed.pop(); context != nullptr; context = completed.pop()) {
+                const auto start = Clock::now();
+                try {
+                    if (context->status != StatusCode::OK) {
+                        THROW_IE_EXCEPTION << "Infer request failed with status " << context->status;
+                    }
+                    Blob::Ptr output = context->request.GetBlob(outputName);
+                    const SizeVector& dims = output->getTensorDesc().getDims();
+                    const auto* data = output->cbuffer().as<const float*>();
+                    if (!dims.empty() && dims.back() == 7) {
+                        /** SSD-like output [1, 1, N, 7], the image id is negative after the last detection **/
+                        const size_t maxProposals = output->size() / 7;
+                        for (size_t i = 0; i < maxProposals && data[i * 7] >= 0; i++) {
+                            if (data[i * 7 + 2] > threshold) {
+                                detections++;
+                            }
+                        }
+                    } else {
+                        /** classification output, the top-1 class **/
+                        const float* top = std::max_element(data, data + output->size());
+                        if (output->size() != 0 && *top > threshold) {
+                            detections++;
+                        }
+                    }
+                    const double latencyMs =
+                        std::chrono::duration<double, std::milli>(Clock::now() - context->frame->decoded).count();
+                    latencySumMs += latencyMs;
+                    latencyMaxMs = std::max(latencyMaxMs, latencyMs);
+                    cameraFrames[context->frame->camera]++;
+                } catch (...) {
+                    if (!postprocessError) {
+                        postprocessError = std::current_exception();
+                    }
+                }
+                // the request gives the frame back to the decoder only here, the inference used it in place
+                context->frame = nullptr;
+                postprocessStats.add(start, Clock::now());
+                freeRequests.push(context);
+            }
+        });
+
+        /** the dispatcher takes a decoded frame and a free request and starts it on the frame **/
+        for (size_t finished = 0; finished < cameras;) {
+            FramePtr frame = decoded.pop();
+            if (frame == nullptr) {
+                finished++;
+                continue;
+            }
+            RequestContext* context = freeRequests.pop();
+            const auto start = Clock::now();
+            TensorDesc frameDesc(Precision::U8, {1, 3, frame->height, frame->width}, Layout::NHWC);
+            context->request.SetBlob(inputName, make_shared_blob<uint8_t>(frameDesc, frame->pixels.get()));
+            context->frame = std::move(frame);
+            context->started = Clock::now();
+            context->request.StartAsync();
+            dispatchStats.add(start, Clock::now());
+        }
+
+        /** all the requests return to the free queue once the post-processing is done with them **/
+        for (size_t i = 0; i < nireq; i++) {
+            freeRequests.pop();
+        }
+        completed.push(nullptr);
+        postprocessor.join();
+        for (auto& decoder : decoders) {
+            decoder.join();
+        }
+
+        const auto pipelineEnd = Clock::now();
+        if (postprocessError) {
+            std::rethrow_exception(postprocessError);
+        }
+        // -----------------------------------------------------------------------------------------------------
+
+        // --------------------------- 9. Report ---------------------------------------------------------------
+        const double wallMs = std::chrono::duration<double, std::milli>(pipelineEnd - pipelineStart).count();
+        size_t processed = 0;
+        for (size_t camera = 0; camera < cameras; camera++) {
+            processed += cameraFrames[camera];
+        }
+        if (unreadFrames != 0) {
+            slog::warn << unreadFrames << " frames cannot be read and are skipped" << slog::endl;
+        }
+
+        slog::info << "Processed " << processed << " frames in " << std::fixed << std::setprecision(2)
+                   << wallMs << " ms" << slog::endl;
+        slog::info << "Throughput: " << (wallMs > 0 ? processed * 1000.0 / wallMs : 0.0) << " FPS, "
+                   << (wallMs > 0 ? processed * 1000.0 / wallMs / cameras : 0.0) << " FPS per camera" << slog::endl;
+        slog::info << "Latency from decode to post-process: average "
+                   << (processed ? latencySumMs / processed : 0.0) << " ms, max " << latencyMaxMs << " ms"
+                   << slog::endl;
+        slog::info << "Detections above the threshold: " << detections << slog::endl;
+
+        slog::info << "Per-stage utilization:" << slog::endl;
+        decodeStats.report(wallMs);
+        dispatchStats.report(wallMs);
+        inferStats.report(wallMs);
+        postprocessStats.report(wallMs);
+        // -----------------------------------------------------------------------------------------------------
+    }
+    catch (const std::exception& error) {
+        slog::err << error.what() << slog::endl;
+        return 1;
+    }
+    catch (...) {
+        slog::err << "Unknown/internal exception happened." << slog::endl;
+        return 1;
+    }
+
+    slog::info << "Execution successful" << slog::endl;
+    return 0;
+}
@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <gflags/gflags.h>
+#include <iostream>
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message.";
+
+/// @brief message for images argument
+static const char image_message[] = "Required. Path to a folder with images or path to an image files, "
+"every camera plays them in a loop.";
+
+/// @brief message for model argument
+static const char model_message[] = "Required. Path to an .xml file with a trained model.";
+
+/// @brief message for assigning cnn calculation to device
+static const char target_device_message[] = "Optional. Specify the target device to infer on (the list of available devices is shown below). " \
+"Default value is CPU. Sample will look for a suitable plugin for device specified.";
+
+/// @brief message for clDNN custom kernels desc
+static const char custom_cldnn_message[] = "Required for GPU custom kernels. "\
+"Absolute path to the .xml file with the kernels descriptions.";
+
+/// @brief message for user library argument
+static const char custom_cpu_library_message[] = "Required for CPU custom layers. " \
+"Absolute path to a shared library with the kernels implementations.";
+
+/// @brief message for cameras argument
+static const char cameras_message[] = "Optional. Number of the cameras, every camera decodes its frames in its own thread. "
+"Default value is 1.";
+
+/// @brief message for frames argument
+static const char frames_message[] = "Optional. Number of the frames all the cameras produce. Default value is 0, "
+"every camera plays the images once.";
+
+/// @brief message for infer requests argument
+static const char infer_requests_message[] = "Optional. Number of the infer requests. Default value is 0, "
+"the optimal number for the device.";
+
+/// @brief message for streams argument
+static const char streams_message[] = "Optional. Number of the streams of the CPU or GPU device. "
+"Default value is the number the device finds optimal.";
+
+/// @brief message for queue size argument
+static const char queue_size_message[] = "Optional. Capacity of the queues between the stages. Default value is 8.";
+
+/// @brief message for threshold argument
+static const char threshold_message[] = "Optional. Probability threshold of the detections. Default value is 0.5.";
+
+/// \brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// \brief Define parameter for set image file <br>
+/// It is a required parameter
+DEFINE_string(i, "", image_message);
+
+/// \brief Define parameter for set model file <br>
+/// It is a required parameter
+DEFINE_string(m, "", model_message);
+
+/// \brief device the target device to infer on <br>
+DEFINE_string(d, "CPU", target_device_message);
+
+/// @brief Define parameter for clDNN custom kernels path <br>
+DEFINE_string(c, "", custom_cldnn_message);
+
+/// @brief Absolute path to CPU library with user layers <br>
+DEFINE_string(l, "", custom_cpu_library_message);
+
+/// @brief Number of the cameras <br>
+DEFINE_uint32(cameras, 1, cameras_message);
+
+/// @brief Number of the frames <br>
+DEFINE_uint32(n, 0, frames_message);
+
+/// @brief Number of the infer requests <br>
+DEFINE_uint32(nireq, 0, infer_requests_message);
+
+/// @brief Number of the streams <br>
+DEFINE_string(nstreams, "", streams_message);
+
+/// @brief Capacity of the queues <br>
+DEFINE_uint32(qsize, 8, queue_size_message);
+
+/// @brief Probability threshold of the detections <br>
+DEFINE_double(t, 0.5, threshold_message);
+
+/**
+* \brief This function show a help message
+*/
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "pipeline_sample [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h                      " << help_message << std::endl;
+    std::cout << "    -i \"<path>\"             " << image_message << std::endl;
+    std::cout << "    -m \"<path>\"             " << model_message << std::endl;
+    std::cout << "      -l \"<absolute_path>\"  " << custom_cpu_library_message << std::endl;
+    std::cout << "          Or" << std::endl;
+    std::cout << "      -c \"<absolute_path>\"  " << custom_cldnn_message << std::endl;
+    std::cout << "    -d \"<device>\"           " << target_device_message << std::endl;
+    std::cout << "    -cameras \"<integer>\"    " << cameras_message << std::endl;
+    std::cout << "    -n \"<integer>\"          " << frames_message << std::endl;
+    std::cout << "    -nireq \"<integer>\"      " << infer_requests_message << std::endl;
+    std::cout << "    -nstreams \"<integer>\"   " << streams_message << std::endl;
+    std::cout << "    -qsize \"<integer>\"      " << queue_size_message << std::endl;
+    std::cout << "    -t \"<double>\"           " << threshold_message << std::endl;
+}
@@ -19,6 +19,12 @@
 #include <chrono>
 #include <limits>
 #include <iomanip>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <mutex>
 #include <inference_engine.hpp>
 #include <gna/gna_config.hpp>
 
@@ -398,6 +404,165 @@ void sumPerformanceCounters(std::map<std::string, InferenceEngine::InferenceEngi
     }
 }
 
+struct StreamingUtterance {
+    std::vector<std::vector<uint8_t>> features;  // frames of every input ark file
+    uint32_t numFrames = 0;
+};
+
+struct StreamContext {
+    ExecutableNetwork network;
+    InferRequest request;
+    size_t utteranceIndex;
+    uint32_t frameIndex;
+    Time::time_point started;
+    std::vector<double> frameLatencies;
+    std::exception_ptr error;
+};
+
+/**
+ * @brief Interleaves the utterances over the networks, every network infers one utterance at a time
+ * with its own memory state, the next utterance is taken once the previous one is done
+ */
+void RunStreamingBenchmark(std::vector<ExecutableNetwork> &networks,
+                           const std::vector<StreamingUtterance> &utterances,
+                           uint32_t batchSize) {
+    std::vector<std::string> inputNames;
+    for (auto &input : networks.front().GetInputsInfo()) {
+        inputNames.push_back(input.first);
+    }
+
+    std::vector<std::unique_ptr<StreamContext>> streams;
+    for (auto &network : networks) {
+        std::unique_ptr<StreamContext> stream(new StreamContext);
+        stream->network = network;
+        stream->request = network.CreateInferRequest();
+        streams.push_back(std::move(stream));
+    }
+
+    std::atomic<size_t> nextUtterance{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+    size_t running = 0;
+
+    // starts the next batch of frames of the utterance, or the next utterance, false if nothing is left
+    auto startNext = [&](StreamContext &stream) {
+        if (stream.frameIndex >= utterances[stream.utteranceIndex].numFrames) {
+            stream.utteranceIndex = nextUtterance++;
+            stream.frameIndex = 0;
+            if (stream.utteranceIndex >= utterances.size()) {
+                return false;
+            }
+            // the memory state of the utterance starts from scratch
+            for (auto &&state : stream.network.QueryState()) {
+                state.Reset();
+            }
+        }
+
+        const StreamingUtterance &utterance = utterances[stream.utteranceIndex];
+        const uint32_t numFramesThisBatch = std::min(batchSize, utterance.numFrames - stream.frameIndex);
+        for (size_t i = 0; i < inputNames.size(); i++) {
+            MemoryBlob::Ptr minput = as<MemoryBlob>(stream.request.GetBlob(inputNames[i]));
+            if (!minput) {
+                throw std::logic_error("We expect input blobs to be inherited from MemoryBlob");
+            }
+            // locked memory holder should be alive all time while access to its buffer happens
+            auto minputHolder = minput->wmap();
+            const size_t frameBytes = minput->byteSize() / batchSize;
+            if (utterance.features[i].size() != frameBytes * utterance.numFrames) {
+                throw std::logic_error("network input size(" + std::to_string(minput->size() / batchSize) +
+                                       ") mismatch to ark file size");
+            }
+            std::memcpy(minputHolder.as<uint8_t *>(),
+                        utterance.features[i].data() + frameBytes * stream.frameIndex,
+                        frameBytes * numFramesThisBatch);
+            std::memset(minputHolder.as<uint8_t *>() + frameBytes * numFramesThisBatch, 0,
+                        frameBytes * (batchSize - numFramesThisBatch));
+        }
+
+        stream.frameIndex += numFramesThisBatch;
+        stream.started = Time::now();
+        stream.request.StartAsync();
+        return true;
+    };
+
+    auto onFinished = [&] {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--running == 0) {
+            finished.notify_one();
+        }
+    };
+
+    for (auto &stream : streams) {
+        StreamContext *context = stream.get();
+        context->request.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+            [&, context](InferRequest, StatusCode code) {
+                bool started = false;
+                try {
+                    if (code != StatusCode::OK) {
+                        throw std::logic_error("Inference of the utterance " + std::to_string(context->utteranceIndex) +
+                                               " failed with the code " + std::to_string(code));
+                    }
+                    // every frame of the batch waits for the whole batch
+                    const double latency = std::chrono::duration_cast<ms>(Time::now() - context->started).count();
+                    const uint32_t framesDone = (context->frameIndex - 1) % batchSize + 1;
+                    context->frameLatencies.insert(context->frameLatencies.end(), framesDone, latency);
+                    started = startNext(*context);
+                } catch (...) {
+                    context->error = std::current_exception();
+                }
+                if (!started) {
+                    onFinished();
+                }
+            });
+    }
+
+    auto t0 = Time::now();
+    running = streams.size();
+    for (auto &stream : streams) {
+        // the utterance is taken by startNext() as if the previous one was over
+        stream->utteranceIndex = 0;
+        stream->frameIndex = utterances.front().numFrames;
+        bool started = false;
+        try {
+            started = startNext(*stream);
+        } catch (...) {
+            stream->error = std::current_exception();
+        }
+        if (!started) {
+            onFinished();
+        }
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&] { return running == 0; });
+    }
+    ms totalTime = std::chrono::duration_cast<ms>(Time::now() - t0);
+
+    std::vector<double> latencies;
+    for (auto &stream : streams) {
+        if (stream->error) {
+            std::rethrow_exception(stream->error);
+        }
+        latencies.insert(latencies.end(), stream->frameLatencies.begin(), stream->frameLatencies.end());
+    }
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) {
+        return latencies.empty() ? 0.0 : latencies[static_cast<size_t>(p / 100.0 * (latencies.size() - 1))];
+    };
+
+    const double audioTime = latencies.size() * FLAGS_frame_ms;
+    std::cout << "Concurrent utterances:\t\t\t" << streams.size() << std::endl;
+    std::cout << "Utterances:\t\t\t\t" << utterances.size() << std::endl;
+    std::cout << "Frames:\t\t\t\t\t" << latencies.size() << " frames" << std::endl;
+    std::cout << "Total time in Infer (HW and SW):\t" << totalTime.count() << " ms" << std::endl;
+    std::cout << "Real-time factor:\t\t\t" << (audioTime > 0.0 ? totalTime.count() / audioTime : 0.0)
+              << " (" << FLAGS_frame_ms << " ms per frame)" << std::endl;
+    std::cout << "Frame latency median:\t\t\t" << percentile(50.0) << " ms" << std::endl;
+    std::cout << "Frame latency 90th percentile:\t\t" << percentile(90.0) << " ms" << std::endl;
+    std::cout << "Frame latency 99th percentile:\t\t" << percentile(99.0) << " ms" << std::endl;
+    std::cout << "Frame latency max:\t\t\t" << (latencies.empty() ? 0.0 : latencies.back()) << " ms" << std::endl;
+}
+
 bool ParseAndCheckCommandLine(int argc, char *argv[]) {
     // ---------------------------Parsing and validation of input args--------------------------------------
     slog::info << "Parsing input parameters" << slog::endl;
@@ -482,6 +647,18 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("Invalid value for 'cw_l' argument. It must be greater than or equal to 0");
     }
 
+    if (FLAGS_streams < 0) {
+        throw std::logic_error("Invalid value for 'streams' argument. It must be greater than or equal to 0");
+    }
+
+    if (FLAGS_streams > 0 && (FLAGS_cw_l > 0 || FLAGS_cw_r > 0)) {
+        throw std::logic_error("The streaming benchmark mode does not support context window networks.");
+    }
+
+    if (FLAGS_frame_ms <= 0.0) {
+        throw std::logic_error("Invalid value for 'frame_ms' argument. It must be positive");
+    }
+
     return true;
 }
 
@@ -662,6 +839,49 @@ int main(int argc, char *argv[]) {
             return 0;
         }
 
+        // --------------------------- Streaming benchmark mode -------------------------------------------------
+        if (FLAGS_streams > 0) {
+            if (!FLAGS_o.empty() || !FLAGS_r.empty()) {
+                slog::warn << "The scores are not written or compared in the streaming benchmark mode" << slog::endl;
+            }
+            /** Every concurrent utterance needs its own memory state, so its own copy of the network **/
+            std::vector<ExecutableNetwork> networks = {executableNet};
+            for (int i = 1; i < FLAGS_streams; i++) {
+                networks.push_back(FLAGS_m.empty() ? ie.ImportNetwork(FLAGS_rg.c_str(), deviceStr, genericPluginConfig)
+                                                   : ie.LoadNetwork(network, deviceStr, genericPluginConfig));
+            }
+
+            std::vector<StreamingUtterance> utterances(numUtterances);
+            for (uint32_t utteranceIndex = 0; utteranceIndex < numUtterances; ++utteranceIndex) {
+                StreamingUtterance &utterance = utterances[utteranceIndex];
+                utterance.features.resize(numInputArkFiles);
+                for (size_t i = 0; i < numInputArkFiles; i++) {
+                    std::string uttName;
+                    uint32_t numFrames(0), numFrameElements(0), numBytesPerElement(0), numBytes(0), n(0);
+                    GetKaldiArkInfo(inputArkFiles[i].c_str(), utteranceIndex, &n, &numBytes);
+                    utterance.features[i].resize(numBytes);
+                    LoadKaldiArkArray(inputArkFiles[i].c_str(), utteranceIndex, uttName, utterance.features[i],
+                                      &numFrames, &numFrameElements, &numBytesPerElement);
+                    if (i != 0 && numFrames != utterance.numFrames) {
+                        throw std::logic_error("Number of frames in ark files is different: " +
+                                               std::to_string(utterance.numFrames) + " and " + std::to_string(numFrames));
+                    }
+                    utterance.numFrames = numFrames;
+                }
+            }
+            utterances.erase(std::remove_if(utterances.begin(), utterances.end(),
+                                            [](const StreamingUtterance &u) { return u.numFrames == 0; }),
+                             utterances.end());
+            if (utterances.empty()) {
+                throw std::logic_error("No frames found in the input ark files");
+            }
+
+            RunStreamingBenchmark(networks, utterances, batchSize);
+            slog::info << "Execution successful" << slog::endl;
+            return 0;
+        }
+        // -----------------------------------------------------------------------------------------------------
+
         std::vector<InferRequestStruct> inferRequests((FLAGS_cw_r > 0 || FLAGS_cw_l > 0) ? 1 : FLAGS_nthreads);
         for (auto& inferRequest : inferRequests) {
             inferRequest = {executableNet.CreateInferRequest(), -1, batchSize};
@@ -80,6 +80,15 @@ static const char context_window_message_r[] = "Optional. Number of frames for r
                                                "Works only with context window networks."
                                                " If you use the cw_r or cw_l flag, then batch size and nthreads arguments are ignored.";
 
+/// @brief message for streaming benchmark argument
+static const char streams_message[] = "Optional. Number of utterances processed concurrently in the streaming benchmark mode " \
+                                      "(default is 0, the mode is off). Every utterance keeps its memory state in its own copy of the network. "
+                                      "The scores are not written or compared in the mode.";
+
+/// @brief message for frame shift argument
+static const char frame_shift_message[] = "Optional. Time between the frames in milliseconds the real-time factor of the streaming " \
+                                          "benchmark mode is computed with (default is 10).";
+
 /// \brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -144,6 +153,12 @@ DEFINE_int32(cw_r, 0, context_window_message_r);
 /// @brief Left context window size (default 0)
 DEFINE_int32(cw_l, 0, context_window_message_l);
 
+/// @brief Number of concurrent utterances of the streaming benchmark mode (default 0, the mode is off)
+DEFINE_int32(streams, 0, streams_message);
+
+/// @brief Time between the frames in milliseconds (default 10)
+DEFINE_double(frame_ms, 10.0, frame_shift_message);
+
 /**
  * \brief This function show a help message
  */
@@ -172,5 +187,7 @@ static void showUsage() {
     std::cout << "    -nthreads \"<integer>\"   " << infer_num_threads_message << std::endl;
     std::cout << "    -cw_l \"<integer>\"       " << context_window_message_l << std::endl;
     std::cout << "    -cw_r \"<integer>\"       " << context_window_message_r << std::endl;
+    std::cout << "    -streams \"<integer>\"    " << streams_message << std::endl;
+    std::cout << "    -frame_ms \"<double>\"    " << frame_shift_message << std::endl;
 }
 
@@ -3,6 +3,7 @@
 //
 
 #include <sys/stat.h>
+#include <cerrno>
 
 #include <cldnn/cldnn_config.hpp>
 #include "cldnn_config.h"
@@ -135,6 +136,83 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
                     THROW_IE_EXCEPTION << "Couldn't create clDNN source dump directory!";
                 }
             }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_BACKGROUND_TUNING) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                backgroundTuning = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                backgroundTuning = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported background tuning flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_OUT_OF_ORDER_EXECUTION) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                outOfOrderExecution = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                outOfOrderExecution = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported out-of-order execution flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_MEMORY_ARENA) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                memoryArena = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                memoryArena = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported memory arena flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_LAZY_KERNELS_COMPILATION) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                lazyKernelsCompilation = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                lazyKernelsCompilation = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported lazy kernels compilation flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_DETECTION_OUTPUT_GPU) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                detectionOutputGpu = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                detectionOutputGpu = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported detection output GPU flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_HOST_THREADS) == 0) {
+            std::stringstream ss(val);
+            uint16_t uVal(0);
+            ss >> uVal;
+            if (ss.fail() || val[0] == '-') {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported host threads number value: " << val;
+            }
+            host_threads = uVal;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_DYN_BATCH_SINGLE_PROGRAM) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                dynBatchSingleProgram = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                dynBatchSingleProgram = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported dynamic batch single program flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_KERNELS_CACHE_DIR) == 0) {
+            if (!val.empty() && mkdir(val.c_str(), 0755) != 0 && errno != EEXIST) {
+                THROW_IE_EXCEPTION << "Couldn't create clDNN kernels cache directory!";
+            }
+            kernels_cache_dir = val;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_KERNELS_CACHE_MAX_SIZE) == 0) {
+            std::stringstream ss(val);
+            uint64_t uVal(0);
+            ss >> uVal;
+            if (ss.fail()) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported kernels cache size value: " << val;
+            }
+            kernels_cache_max_size = uVal;
+        } else if (key.compare(PluginConfigParams::KEY_MEMORY_BUDGET) == 0) {
+            std::stringstream ss(val);
+            uint64_t uVal(0);
+            ss >> uVal;
+            if (ss.fail() || val[0] == '-') {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported memory budget value: " << val;
+            }
+            memory_budget = uVal;
         } else if (key.compare(PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0) {
                 exclusiveAsyncRequests = true;
@@ -218,11 +296,43 @@ void Config::adjustKeyMapValues() {
     else
         key_config_map[PluginConfigParams::KEY_DYN_BATCH_ENABLED] = PluginConfigParams::NO;
 
+    if (dynBatchSingleProgram)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_DYN_BATCH_SINGLE_PROGRAM] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_DYN_BATCH_SINGLE_PROGRAM] = PluginConfigParams::NO;
+
     if (nv12_two_inputs)
         key_config_map[CLDNNConfigParams::KEY_CLDNN_NV12_TWO_INPUTS] = PluginConfigParams::YES;
     else
         key_config_map[CLDNNConfigParams::KEY_CLDNN_NV12_TWO_INPUTS] = PluginConfigParams::NO;
 
+    if (backgroundTuning)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_BACKGROUND_TUNING] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_BACKGROUND_TUNING] = PluginConfigParams::NO;
+
+    if (outOfOrderExecution)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_OUT_OF_ORDER_EXECUTION] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_OUT_OF_ORDER_EXECUTION] = PluginConfigParams::NO;
+
+    if (memoryArena)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_MEMORY_ARENA] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_MEMORY_ARENA] = PluginConfigParams::NO;
+
+    if (lazyKernelsCompilation)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_LAZY_KERNELS_COMPILATION] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_LAZY_KERNELS_COMPILATION] = PluginConfigParams::NO;
+
+    if (detectionOutputGpu)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_DETECTION_OUTPUT_GPU] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_DETECTION_OUTPUT_GPU] = PluginConfigParams::NO;
+
+    key_config_map[CLDNNConfigParams::KEY_CLDNN_HOST_THREADS] = std::to_string(host_threads);
+
     {
         std::string qp = "0";
         switch (queuePriority) {
@@ -260,6 +370,11 @@ void Config::adjustKeyMapValues() {
     if (!sources_dumps_dir.empty())
         key_config_map[CLDNNConfigParams::KEY_CLDNN_SOURCES_DUMPS_DIR] = sources_dumps_dir;
 
+    if (!kernels_cache_dir.empty())
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_KERNELS_CACHE_DIR] = kernels_cache_dir;
+    key_config_map[CLDNNConfigParams::KEY_CLDNN_KERNELS_CACHE_MAX_SIZE] = std::to_string(kernels_cache_max_size);
+    key_config_map[PluginConfigParams::KEY_MEMORY_BUDGET] = std::to_string(memory_budget);
+
     key_config_map[PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS] = std::to_string(throughput_streams);
     key_config_map[PluginConfigParams::KEY_DEVICE_ID] = device_id;
 }
@@ -27,8 +27,15 @@ struct Config {
                exclusiveAsyncRequests(false),
                memory_pool_on(true),
                enableDynamicBatch(false),
+               dynBatchSingleProgram(false),
                enableInt8(false),
                nv12_two_inputs(false),
+               backgroundTuning(false),
+               outOfOrderExecution(false),
+               memoryArena(false),
+               lazyKernelsCompilation(false),
+               detectionOutputGpu(false),
+               host_threads(0),
                queuePriority(cldnn::priority_mode_types::disabled),
                queueThrottle(cldnn::throttle_mode_types::disabled),
                max_dynamic_batch(1),
@@ -36,6 +43,9 @@ struct Config {
                tuningConfig(),
                graph_dumps_dir(""),
                sources_dumps_dir(""),
+               kernels_cache_dir(""),
+               kernels_cache_max_size(0),
+               memory_budget(0),
                device_id("") {
         adjustKeyMapValues();
     }
@@ -49,8 +59,15 @@ struct Config {
     bool exclusiveAsyncRequests;
     bool memory_pool_on;
     bool enableDynamicBatch;
+    bool dynBatchSingleProgram;
     bool enableInt8;
     bool nv12_two_inputs;
+    bool backgroundTuning;
+    bool outOfOrderExecution;
+    bool memoryArena;
+    bool lazyKernelsCompilation;
+    bool detectionOutputGpu;
+    uint16_t host_threads;
     cldnn::priority_mode_types queuePriority;
     cldnn::throttle_mode_types queueThrottle;
     int max_dynamic_batch;
@@ -58,6 +75,9 @@ struct Config {
     cldnn::tuning_config_options tuningConfig;
     std::string graph_dumps_dir;
     std::string sources_dumps_dir;
+    std::string kernels_cache_dir;
+    uint64_t kernels_cache_max_size;  // in megabytes
+    uint64_t memory_budget;  // in bytes
     std::string device_id;
 
     std::map<std::string, std::string> key_config_map;
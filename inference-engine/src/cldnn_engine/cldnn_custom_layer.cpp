@@ -166,6 +166,10 @@ void CLDNNCustomLayer::ProcessWorkSizesNode(const pugi::xml_node & node) {
     }
 
     std::string lws = node.attribute("local").as_string("");
+    if (lws == "auto") {
+        m_tuneLocalSize = true;
+        lws.clear();
+    }
     while (!lws.empty()) {
         auto pos = lws.find_first_of(',');
         auto rule = lws.substr(0, pos);
@@ -53,12 +53,14 @@ public:
     const std::string& CompilerOptions()const { return m_compilerOptions; }
     const std::vector<std::string>& GlobalSizeRules()const { return m_globalSizeRules; }
     const std::vector<std::string>& LocalSizeRules()const { return m_localSizeRules; }
+    bool TuneLocalSize()const { return m_tuneLocalSize; }
     const std::vector<KerenlParam>& KernelParams()const { return m_kernelParams; }
     int InputDimSourceIndex() { return m_wgDimInputIdx; }
 
 protected:
-    CLDNNCustomLayer() : m_wgDimInputIdx(0) {}
-    explicit CLDNNCustomLayer(const std::string dirname) : m_configDir(dirname), m_wgDimInputIdx(0) {}
+    CLDNNCustomLayer() : m_wgDimInputIdx(0), m_tuneLocalSize(false) {}
+    explicit CLDNNCustomLayer(const std::string dirname)
+        : m_configDir(dirname), m_wgDimInputIdx(0), m_tuneLocalSize(false) {}
 
     bool Error() const { return m_ErrorMessage.length() > 0; }
     void LoadSingleLayer(const pugi::xml_node& node);
@@ -78,6 +80,7 @@ protected:
     int m_wgDimInputIdx;
     std::vector<std::string> m_globalSizeRules;
     std::vector<std::string> m_localSizeRules;
+    bool m_tuneLocalSize;  // local="auto", the local work sizes are chosen by the on-line tuning
     std::vector<KerenlParam> m_kernelParams;
     std::string m_ErrorMessage;
 };
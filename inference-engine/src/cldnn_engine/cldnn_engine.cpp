@@ -126,6 +126,12 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceEn
                context_config.queueThrottle == current_config.queueThrottle &&
                context_config.queuePriority == current_config.queuePriority &&
                context_config.sources_dumps_dir == current_config.sources_dumps_dir &&
+               context_config.kernels_cache_dir == current_config.kernels_cache_dir &&
+               context_config.kernels_cache_max_size == current_config.kernels_cache_max_size &&
+               context_config.outOfOrderExecution == current_config.outOfOrderExecution &&
+               context_config.memoryArena == current_config.memoryArena &&
+               context_config.lazyKernelsCompilation == current_config.lazyKernelsCompilation &&
+               context_config.host_threads == current_config.host_threads &&
                context_config.tuningConfig.mode == current_config.tuningConfig.mode &&
                context_config.tuningConfig.cache_file_path == current_config.tuningConfig.cache_file_path;
     };
@@ -28,6 +28,7 @@
 #include <sys/types.h>
 
 #include <exec_graph_info.hpp>
+#include <ie_util_internal.hpp>
 #include "cldnn_executable_network.h"
 #include "cldnn_streams_task_executor.h"
 
@@ -36,6 +37,18 @@ using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
 namespace CLDNNPlugin {
+namespace {
+
+// the intermediate buffers of the stream, the weights are allocated by the program and are not counted
+uint64_t GetScratchBytes(const CLDNNGraph& graph) {
+    uint64_t memory = 0;
+    for (size_t i = 0; i < graph.GetNetworksCount(); i++)
+        memory += graph.GetNetwork(i)->get_max_used_device_memory_size();
+    return memory;
+}
+
+}  // namespace
+
 unsigned int CLDNNExecNetwork::GetWaitingCounter() { return MultiWorkerTaskExecutor::GetWaitingCounter(); }
 unsigned int CLDNNExecNetwork::GetRunningCounter() { return CLDNNInferRequest::GetRunningCounter(); }
 
@@ -48,13 +61,26 @@ CLDNNExecNetwork::CLDNNExecNetwork(InferenceEngine::ICNNNetwork &network, Remote
 
     m_context = casted_context;
 
-    // graph(s) initialization in taskExecutor threads (streams), in parallel (in case of streams)
-    std::vector<InferenceEngine::Task> tasks;
+    Config servingConfig = m_config;
+    if (m_config.backgroundTuning) {
+        if (m_config.tuningConfig.cache_file_path.empty()) {
+            THROW_IE_EXCEPTION << "Background tuning requires " << PluginConfigParams::KEY_TUNING_FILE << " to be set";
+        }
+        // the network is served with the kernels tuned so far until the tuning is completed
+        servingConfig.tuningConfig.mode = std::ifstream(m_config.tuningConfig.cache_file_path).good() ?
+                                          cldnn::tuning_mode::tuning_use_cache : cldnn::tuning_mode::tuning_disabled;
+    }
 
-    auto graph_base = std::make_shared<CLDNNGraph>(network, m_context, m_config, 0);
-    for (uint16_t n = 0; n < m_config.throughput_streams; n++) {
-        auto graph = n == 0 ? graph_base : std::make_shared<CLDNNGraph>(graph_base, n);
-        m_graphs.push_back(graph);
+    auto graphs = BuildGraphs(network, servingConfig);
+    if (graphs.size() < m_config.throughput_streams) {
+        m_config.throughput_streams = static_cast<uint16_t>(graphs.size());
+        m_config.adjustKeyMapValues();
+    }
+    m_graphs.Reset(graphs);
+
+    // the streams pick their graphs up in taskExecutor threads
+    std::vector<InferenceEngine::Task> tasks;
+    for (auto& graph : graphs) {
         tasks.push_back([=]() {
             CLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph = graph;
         });
@@ -69,15 +95,82 @@ CLDNNExecNetwork::CLDNNExecNetwork(InferenceEngine::ICNNNetwork &network, Remote
             _taskExecutor = executorManager->getExecutor("GPU");
         }
     }
+
+    if (m_config.backgroundTuning) {
+        StartBackgroundTuning(network);
+    }
+}
+
+CLDNNExecNetwork::~CLDNNExecNetwork() {
+    // a program being built can not be interrupted, so the tuning is waited for
+    if (m_tuningThread.joinable()) {
+        m_tuningThread.join();
+    }
+}
+
+std::vector<std::shared_ptr<CLDNNGraph>> CLDNNExecNetwork::BuildGraphs(InferenceEngine::ICNNNetwork &network,
+                                                                       const Config& config) {
+    std::vector<std::shared_ptr<CLDNNGraph>> graphs;
+    auto graph_base = std::make_shared<CLDNNGraph>(network, m_context, config, 0);
+    // the streams share the program, so all of them allocate as many intermediate buffers as the first one
+    const uint64_t scratch = GetScratchBytes(*graph_base);
+    if (config.memory_budget > 0 && scratch > config.memory_budget) {
+        THROW_IE_EXCEPTION << "The network needs " << scratch << " bytes, which exceeds "
+                           << PluginConfigParams::KEY_MEMORY_BUDGET << " of " << config.memory_budget << " bytes";
+    }
+    for (uint16_t n = 0; n < m_config.throughput_streams; n++) {
+        if (n > 0 && config.memory_budget > 0 && scratch * (n + 1) > config.memory_budget)
+            break;
+        graphs.push_back(n == 0 ? graph_base : std::make_shared<CLDNNGraph>(graph_base, n));
+    }
+    return graphs;
+}
+
+void CLDNNExecNetwork::StartBackgroundTuning(InferenceEngine::ICNNNetwork &network) {
+    std::shared_ptr<ICNNNetwork> clonedNetwork = cloneNet(network);
+    auto plugin = getContextImpl(m_context)->GetPlugin();
+
+    m_tuningThread = std::thread([this, clonedNetwork, plugin]() {
+        try {
+            // The kernels are benchmarked within own context, so the inference is not blocked by the tuning;
+            // the low priority queue lets the driver prefer the inference kernels if the hints are supported.
+            Config tuningConfig = m_config;
+            tuningConfig.tuningConfig.mode = cldnn::tuning_mode::tuning_tune_and_cache;
+            tuningConfig.throughput_streams = 1;
+            tuningConfig.graph_dumps_dir = "";
+            tuningConfig.queuePriority = cldnn::priority_mode_types::low;
+            try {
+                auto tuningContext = std::make_shared<CLDNNRemoteCLContext>(plugin, ParamMap(), tuningConfig);
+                CLDNNGraph tuningGraph(*clonedNetwork, tuningContext, tuningConfig);
+            } catch (const std::exception&) {
+                tuningConfig.queuePriority = cldnn::priority_mode_types::disabled;
+                auto tuningContext = std::make_shared<CLDNNRemoteCLContext>(plugin, ParamMap(), tuningConfig);
+                CLDNNGraph tuningGraph(*clonedNetwork, tuningContext, tuningConfig);
+            }
+
+            Config servingConfig = m_config;
+            servingConfig.tuningConfig.mode = cldnn::tuning_mode::tuning_use_cache;
+            // the memory budget may let fewer streams be built at this time; such a set is dropped, as the
+            // requests of all streams look their graphs up by the stream ids
+            m_graphs.Replace(BuildGraphs(*clonedNetwork, servingConfig));
+        } catch (const std::exception&) {
+            // the network keeps being served with the current kernels
+        }
+    });
+}
+
+std::shared_ptr<CLDNNGraph> CLDNNExecNetwork::GetGraph(uint16_t stream_id) const {
+    return m_graphs.Get(stream_id);
 }
 
 InferRequestInternal::Ptr CLDNNExecNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
                                                                    OutputsDataMap networkOutputs) {
-    if (m_graphs.empty()) {
+    const auto graphs = m_graphs.Snapshot();
+    if (graphs.empty()) {
         THROW_IE_EXCEPTION << NETWORK_NOT_LOADED_str;
     }
 
-    for (auto& graph : m_graphs) {
+    for (auto& graph : graphs) {
         if (graph == nullptr) {
             THROW_IE_EXCEPTION << NETWORK_NOT_LOADED_str;
         }
@@ -93,7 +186,7 @@ InferRequestInternal::Ptr CLDNNExecNetwork::CreateInferRequestImpl(InputsDataMap
     }
     if (m_config.useProfiling)
         ptr->EnableProfiling();
-    ptr->SetGraph(m_graphs.front());
+    ptr->SetGraph(graphs.front());
 
     return ptr;
 }
@@ -109,10 +202,11 @@ void CLDNNExecNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
 }
 
 void CLDNNExecNetwork::GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) {
-    if (m_graphs.empty())
+    const auto graphs = m_graphs.Snapshot();
+    if (graphs.empty())
         THROW_IE_EXCEPTION << NETWORK_NOT_LOADED_str;
 
-    m_graphs.front()->GetExecGraphInfo(graphPtr);
+    graphs.front()->GetExecGraphInfo(graphPtr);
 }
 
 void CLDNNExecNetwork::GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const {
@@ -125,15 +219,24 @@ void CLDNNExecNetwork::GetConfig(const std::string &name, InferenceEngine::Param
 }
 
 void CLDNNExecNetwork::GetMetric(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const {
+    // the graphs can be replaced by the background tuning meanwhile, so all of them are taken from one set
+    const auto graphs = m_graphs.Snapshot();
     if (name == METRIC_KEY(NETWORK_NAME)) {
-        IE_ASSERT(!m_graphs.empty());
-        result = IE_SET_METRIC(NETWORK_NAME, m_graphs[0]->getName());
+        IE_ASSERT(!graphs.empty());
+        result = IE_SET_METRIC(NETWORK_NAME, graphs.front()->getName());
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         std::vector<std::string> metrics;
         metrics.push_back(METRIC_KEY(NETWORK_NAME));
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(MEMORY_FOOTPRINT));
+        metrics.push_back(CLDNN_METRIC(MAX_USED_DEVICE_MEMORY));
+        metrics.push_back(CLDNN_METRIC(PREFERRED_IO_PRECISIONS));
+        if (!m_config.kernels_cache_dir.empty())
+            metrics.push_back(CLDNN_METRIC(KERNELS_CACHE_STATISTICS));
+        if (_loadProfile)
+            metrics.push_back(METRIC_KEY(LOAD_NETWORK_PROFILE));
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -143,6 +246,34 @@ void CLDNNExecNetwork::GetMetric(const std::string &name, InferenceEngine::Param
     } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
         unsigned int nr = m_config.throughput_streams * 2u;
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, nr);
+    } else if (name == METRIC_KEY(MEMORY_FOOTPRINT)) {
+        uint64_t scratch = 0, scratchPerStream = 0;
+        for (const auto& graph : graphs) {
+            const uint64_t streamScratch = GetScratchBytes(*graph);
+            scratch += streamScratch;
+            scratchPerStream = std::max(scratchPerStream, streamScratch);
+        }
+        result = IE_SET_METRIC(MEMORY_FOOTPRINT, std::map<std::string, uint64_t>({
+            {"SCRATCH", scratch}, {"SCRATCH_PER_STREAM", scratchPerStream}}));
+    } else if (name == CLDNN_METRIC(MAX_USED_DEVICE_MEMORY)) {
+        uint64_t memory = 0;
+        for (const auto& graph : graphs)
+            memory += GetScratchBytes(*graph);
+        result = IE_SET_METRIC(CLDNN_MAX_USED_DEVICE_MEMORY, memory);
+    } else if (name == CLDNN_METRIC(PREFERRED_IO_PRECISIONS)) {
+        IE_ASSERT(!graphs.empty());
+        std::map<std::string, std::string> precisions;
+        for (const auto& io : graphs.front()->GetIOPrecisions())
+            precisions[io.first] = io.second.name();
+        result = IE_SET_METRIC(CLDNN_PREFERRED_IO_PRECISIONS, precisions);
+    } else if (!m_config.kernels_cache_dir.empty() && name == CLDNN_METRIC(KERNELS_CACHE_STATISTICS)) {
+        IE_ASSERT(!graphs.empty());
+        const auto stats = graphs.front()->GetEngine()->get_kernels_cache_statistics();
+        std::map<std::string, uint64_t> statistics = {
+            {"HITS", stats.hits}, {"MISSES", stats.misses}, {"EVICTIONS", stats.evictions}, {"SIZE", stats.size}};
+        result = IE_SET_METRIC(CLDNN_KERNELS_CACHE_STATISTICS, statistics);
+    } else if (_loadProfile && name == METRIC_KEY(LOAD_NETWORK_PROFILE)) {
+        result = IE_SET_METRIC(LOAD_NETWORK_PROFILE, _loadProfile->get());
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
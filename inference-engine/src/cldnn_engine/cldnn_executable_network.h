@@ -8,7 +8,9 @@
 #include <map>
 #include <set>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include "ie_blob.h"
 #include "ie_plugin.hpp"
@@ -19,6 +21,7 @@
 #include "cldnn_graph.h"
 #include "cldnn_config.h"
 #include "cldnn_remote_context.h"
+#include "cldnn_stream_graphs.h"
 
 namespace CLDNNPlugin {
 
@@ -27,6 +30,7 @@ public:
     typedef std::shared_ptr<CLDNNExecNetwork> Ptr;
 
     explicit CLDNNExecNetwork(InferenceEngine::ICNNNetwork &network, RemoteContext::Ptr context, Config config);
+    ~CLDNNExecNetwork() override;
 
     void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) override;
     void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
@@ -39,9 +43,18 @@ public:
     void GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
     void GetContext(RemoteContext::Ptr &pContext, ResponseDesc *resp) const override;
 
-    std::vector<std::shared_ptr<CLDNNGraph>> m_graphs;
+    // Gets the current graph of the stream, which is replaced once the background tuning is completed
+    std::shared_ptr<CLDNNGraph> GetGraph(uint16_t stream_id) const;
+
+    CLDNNStreamGraphs<CLDNNGraph> m_graphs;
     gpu::ClContext::Ptr m_context;
     Config m_config;
+
+protected:
+    std::vector<std::shared_ptr<CLDNNGraph>> BuildGraphs(InferenceEngine::ICNNNetwork &network, const Config& config);
+    void StartBackgroundTuning(InferenceEngine::ICNNNetwork &network);
+
+    std::thread m_tuningThread;
 };
 
 };  // namespace CLDNNPlugin
@@ -28,6 +28,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <exec_graph_info.hpp>
+#include <ie_profiling.hpp>
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
@@ -81,6 +82,7 @@ void CLDNNGraph::Build() {
 }
 
 std::shared_ptr<cldnn::network> CLDNNGraph::BuildNetwork(std::shared_ptr<cldnn::program> program) {
+    IE_PROFILING_AUTO_SCOPE(CLDNNGraph::BuildNetwork)
     auto network = std::make_shared<cldnn::network>(*program, m_stream_id);
 
     if (!m_config.graph_dumps_dir.empty() && m_stream_id == 0) {
@@ -249,6 +251,12 @@ InferenceEngine::ICNNNetwork::Ptr CLDNNGraph::GetExecGraphInfoByPrimitivesInfo(s
         layer->params[ExecGraphInfoSerialization::PERF_COUNTER] = exec_time;
         layer->params[ExecGraphInfoSerialization::OUTPUT_LAYOUTS] = prim_info.layout_str;
         layer->params[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(prim_info.exec_id);
+        if (!prim_info.c_fused_ops.empty()) {
+            std::vector<std::string> fusedOps;
+            for (auto& fused_type : prim_info.c_fused_ops)
+                fusedOps.push_back(to_IE_type_name(fused_type));
+            layer->params[ExecGraphInfoSerialization::FUSED_OPS] = concat_strings(fusedOps, ',');
+        }
 
         node2layer.emplace_back(prim_info, layer);
 
@@ -712,6 +720,26 @@ std::string CLDNNGraph::MapOutputName(std::string outName) const {
     return outputID;
 }
 
+void CLDNNGraph::BindOutputMemory(const cldnn::primitive_id& outputID, const cldnn::memory& mem) {
+    auto network = GetNetwork();
+    auto current = network->get_output_memory(outputID);
+    if (current == mem)
+        return;
+
+    if (allocatedOutputs.find(outputID) == allocatedOutputs.end())
+        allocatedOutputs.emplace(outputID, current);
+    network->set_output_memory(outputID, mem);
+}
+
+void CLDNNGraph::ResetOutputMemory(const cldnn::primitive_id& outputID) {
+    auto allocated = allocatedOutputs.find(outputID);
+    if (allocated == allocatedOutputs.end())
+        return;
+
+    GetNetwork()->set_output_memory(outputID, allocated->second);
+    allocatedOutputs.erase(allocated);
+}
+
 InferenceEngine::SizeVector CLDNNGraph::GetOutputSize(std::string outName) const {
     auto res_output = outputDims.find(outName);
 
@@ -53,14 +53,29 @@ public:
     const Config& getConfig() const { return m_config; }
     gpu::ClContext::Ptr GetContext() { return m_context; }
     std::shared_ptr<const cldnn::engine> GetEngine() const { return getContextImpl(m_context)->GetEngine(); }
+    uint16_t GetStreamID() const { return m_stream_id; }
     int GetMaxDynamicBatchSize() const { return getConfig().max_dynamic_batch; }
     const std::map<std::string, cldnn::layout>& GetInputLayouts() const { return m_program->getInputLayouts(); }
+    const std::map<std::string, InferenceEngine::Precision>& GetIOPrecisions() const {
+        return m_program->getIOPrecisions();
+    }
     size_t GetNetworksCount() const { return m_networks.size(); }
+    // the batch the network compiled for the dynamic batch processes, and the images of the batch it runs
+    int GetNetworkBatch(size_t idx) const { return m_program->GetBatchOfProgram(static_cast<int>(idx)); }
+    int GetNetworkImages(size_t idx, int batch) const {
+        return getConfig().dynBatchSingleProgram ? (idx == 0 ? batch : 0) : (batch & GetNetworkBatch(idx));
+    }
     std::shared_ptr<cldnn::network> GetNetwork(size_t idx = 0) const;
     InferenceEngine::SizeVector GetOutputSize(std::string outName) const;
     std::string MapOutputName(std::string outName) const;
     std::string getName() const { return m_networkName; }
 
+    // Binds the given memory (e.g. of a remote blob) as the network output, so the results are written to it directly.
+    // The graph may be shared by several infer requests, so the binding is kept until it is reset.
+    void BindOutputMemory(const cldnn::primitive_id& outputID, const cldnn::memory& mem);
+    // Restores the output memory allocated by the network, if another one was bound
+    void ResetOutputMemory(const cldnn::primitive_id& outputID);
+
 protected:
     std::string m_networkName;
     Config m_config;
@@ -77,6 +92,9 @@ protected:
 
     std::map<std::string, InferenceEngine::SizeVector> outputDims;
 
+    // output memory allocated by the network for the outputs which have other memory bound
+    std::map<cldnn::primitive_id, cldnn::memory> allocatedOutputs;
+
     std::shared_ptr<Program> m_program;
     uint16_t m_stream_id;
 
@@ -10,6 +10,7 @@
 #include <api/detection_output.hpp>  // todo: find a way to remove this
 #include <description_buffer.hpp>
 #include "cldnn_infer_request.h"
+#include "cldnn_executable_network.h"
 #include "cldnn_streams_task_executor.h"
 #include "cldnn_remote_context.h"
 
@@ -101,6 +102,27 @@ void CLDNNInferRequest::input_alloc(cldnn::primitive_id name, const cldnn::layou
     input_attach(name, input_mem);
 }
 
+const cldnn::memory* CLDNNInferRequest::shareHostBlob(host_ptr_memory& shared, const cldnn::primitive_id& name,
+                                                      const cldnn::layout& layout, const Blob& blob) {
+    if (!m_useHostPtr)
+        return nullptr;
+
+    // the blob is used in place only when its data is the memory as is and the driver does not copy it
+    auto ptr = const_cast<void*>(blob.cbuffer().as<const void*>());
+    if (ptr == nullptr || reinterpret_cast<uintptr_t>(ptr) % cldnn::memory::host_ptr_alignment != 0 ||
+        layout.bytes_count() != blob.byteSize())
+        return nullptr;
+
+    auto it = shared.find(name);
+    if (it == shared.end() || it->second.first != ptr || it->second.second.get_layout() != layout) {
+        if (it != shared.end())
+            shared.erase(it);
+        auto mem = cldnn::memory::share_host_ptr(*(m_graph->GetEngine()), layout, ptr);
+        it = shared.emplace(name, std::make_pair(ptr, mem)).first;
+    }
+    return &it->second.second;
+}
+
 void CLDNNInferRequest::copyOutputData(const cldnn::memory& outputMemory,
                                         Blob::Ptr bptr,
                                         buf_info* bi) {
@@ -475,9 +497,18 @@ void CLDNNInferRequest::SetBlob(const char *name, const Blob::Ptr &data) {
         }
 
         if (is_remote) {
+            if (m_graph->GetMaxDynamicBatchSize() > 1) {
+                THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Remote output blobs are not supported with dynamic batch."
+                    << " Output name: \'" << name << "\'";
+            }
+            // the remote blob is bound as the network output right before the execution,
+            // so it has to be interchangeable with the memory allocated by the network
             std::string outputID = m_graph->MapOutputName(name);
-            auto impl = getBlobImpl(remote_ptr);
-            m_graph->GetNetwork()->set_output_memory(outputID, impl->getMemory());
+            auto outputLayout = m_graph->GetNetwork()->get_output_memory(outputID).get_layout();
+            if (getBlobImpl(remote_ptr)->getMemory().get_layout() != outputLayout) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Remote output blob layout doesn't match the network output layout."
+                    << " Output name: \'" << name << "\'";
+            }
         } else {
             size_t outputSize = desc.getLayout() != SCALAR
                 ? details::product(desc.getDims())
@@ -573,6 +604,7 @@ void CLDNNInferRequest::AllocateOutputs() {
 
         if (can_reuse_internal_mem) {
             _outputs[no.first] = createOutputBlob(desc, output_mem_ptr.data());
+            internalOutputs[no.first] = _outputs[no.first];
         } else {
             Blob::Ptr outputBlob = createOutputBlob(desc);
             outputBlob->allocate();
@@ -603,11 +635,15 @@ void CLDNNInferRequest::AllocateOutputsDyn() {
 
 void CLDNNInferRequest::SetGraph(std::shared_ptr<CLDNNPlugin::CLDNNGraph> graph) {
     m_graph = graph;
+    m_allocatedGraph = graph;
 
     if (m_graph == nullptr) {
         THROW_IE_EXCEPTION << NETWORK_NOT_LOADED_str;
     }
 
+    // the integrated GPU shares the memory with the host, so it reads and writes the user blobs directly
+    m_useHostPtr = m_graph->GetEngine()->get_info().supports_host_unified_memory != 0;
+
     if (m_graph->GetMaxDynamicBatchSize() > 1) {
         SetBatch(m_graph->GetMaxDynamicBatchSize());
         AllocateInputsDyn();
@@ -641,18 +677,13 @@ void CLDNNInferRequest::SetBatch(int new_batch) {
         std::vector<buf_info> in_buf;
 
         size_t offset = 0;
-        size_t bsz = single_batch;
 
-        // calculate metadata for input buffers
+        // calculate metadata for input buffers, the inputs of a network hold the whole batch it is compiled for
         for (unsigned nb = 0; nb < m_graph->GetNetworksCount(); nb++) {
-            unsigned int mask = 1 << nb;
-
-            buf_info ib = { offset, bsz };
+            buf_info ib = { offset, single_batch * m_graph->GetNetworkBatch(nb) };
             in_buf.push_back(ib);
 
-            if (new_batch & mask)
-                offset += bsz;
-            bsz <<= 1;
+            offset += single_batch * m_graph->GetNetworkImages(nb, new_batch);
         }
 
         batchInputs[input.first] = in_buf;
@@ -666,18 +697,13 @@ void CLDNNInferRequest::SetBatch(int new_batch) {
         std::vector<buf_info> out_buf;
 
         size_t offset = 0;
-        size_t bsz = single_batch;
-        // calculate metadata for output buffers
+        // calculate metadata for output buffers, only the images of the requested batch are read
         for (uint32_t nb = 0; nb < m_graph->GetNetworksCount(); nb++) {
-            uint32_t mask = 1 << nb;
-
-            buf_info ob = { offset, bsz };
+            const size_t images = m_graph->GetNetworkImages(nb, new_batch);
+            buf_info ob = { offset, single_batch * images };
             out_buf.push_back(ob);
 
-            if (new_batch & mask)
-                offset += bsz;
-
-            bsz <<= 1;
+            offset += single_batch * images;
         }
 
         batchOutputs[no.first] = out_buf;
@@ -694,28 +720,74 @@ CLDNNInferRequest::CLDNNInferRequest(InputsDataMap networkInputs, OutputsDataMap
 
 void CLDNNInferRequest::execAndParse() {
     runningCounter++;
-    auto networkOutputs = m_graph->GetNetwork()->execute();
+    auto network = m_graph->GetNetwork();
+
+    // remote output blobs are written by the network directly, and so are the user blobs on the integrated GPU,
+    // others get the network's own memory back, as the graph might have been used by another request with remote outputs
+    std::map<std::string, const cldnn::memory*> sharedOutputs;
+    for (auto& no : _networkOutputs) {
+        std::string outputID = outputsMap[no.first];
+        Blob::Ptr bptr = _outputs[no.first];
+        auto remote_ptr = bptr->as<gpu::ClBlob>();
+        auto internal = internalOutputs.find(no.first);
+        bool is_internal = m_graph == m_allocatedGraph && internal != internalOutputs.end() && internal->second == bptr;
+        const cldnn::memory* shared = nullptr;
+        if (remote_ptr == nullptr && !is_internal) {
+            m_graph->ResetOutputMemory(outputID);
+            shared = shareHostBlob(hostPtrOutputs, outputID, network->get_output_memory(outputID).get_layout(), *bptr);
+        }
+
+        if (remote_ptr != nullptr) {
+            m_graph->BindOutputMemory(outputID, getBlobImpl(remote_ptr)->getMemory());
+        } else if (shared != nullptr) {
+            m_graph->BindOutputMemory(outputID, *shared);
+            sharedOutputs[no.first] = shared;
+        } else {
+            m_graph->ResetOutputMemory(outputID);
+        }
+    }
 
-    // Collect outputs as requested by the model
+    auto networkOutputs = network->execute(inputsEvents);
+
+    // Collect outputs as requested by the model; the copies are enqueued after the outputs are computed
+    // and waited for all together
+    std::vector<cldnn::event> transferEvents;
     for (auto& no : _networkOutputs) {
         Blob::Ptr bptr = _outputs[no.first];
 
         std::string outputID = outputsMap[no.first];
-        auto outputMemory = networkOutputs.at(outputID).get_memory();
+        auto outputEvent = networkOutputs.at(outputID).get_event();
+        auto outputMemory = network->get_output_memory(outputID);
 
         // mapping remote blobs not needed -
         // let the user take care of them explicitly
-        if (!bptr->is<gpu::ClBlob>()) {
-            auto out_ptr = outputMemory.pointer<uint8_t>();
-            auto blob_ptr = bptr->buffer().as<uint8_t*>();
-
-            // If Async API is used, copy of output blobs is not needed, unless SetBlob function was called.
-            // But in the case when old API is used we have to copy data to memory provided by user.
-            if (blob_ptr != &out_ptr[0]) {
-                copyOutputData(outputMemory, bptr);
-            }
+        if (bptr->is<gpu::ClBlob>()) {
+            transferEvents.push_back(outputEvent);
+            continue;
+        }
+
+        // If Async API is used, copy of output blobs is not needed, unless SetBlob function was called.
+        // But in the case when old API is used we have to copy data to memory provided by user.
+        auto internal = internalOutputs.find(no.first);
+        if (m_graph == m_allocatedGraph && internal != internalOutputs.end() && internal->second == bptr) {
+            transferEvents.push_back(outputEvent);
+        } else if (sharedOutputs.count(no.first) != 0) {
+            // written in place; mapping the memory after the execution makes the data visible to the host
+            outputEvent.wait();
+            sharedOutputs.at(no.first)->pointer<uint8_t>();
+        } else if (outputMemory.get_layout().bytes_count() == bptr->byteSize()) {
+            // not padded output is read to the blob as is
+            transferEvents.push_back(network->copy_to_host(outputMemory, bptr->buffer().as<void*>(), outputEvent));
+        } else {
+            outputEvent.wait();
+            copyOutputData(outputMemory, bptr);
         }
     }
+    for (auto& ev : inputsEvents)
+        ev.wait();
+    for (auto& ev : transferEvents)
+        ev.wait();
+    inputsEvents.clear();
     runningCounter--;
 
     // finally collect profiling info
@@ -730,18 +802,14 @@ void CLDNNInferRequest::execAndParseDyn() {
 
     // set up exection and put all graphs into driver queue
     for (unsigned nb = 0; nb < m_graph->GetNetworksCount(); nb++) {
-        unsigned int mask = 1 << nb;
-
-        if (m_curBatch & mask) {
+        if (m_graph->GetNetworkImages(nb, m_curBatch) > 0) {
             networkOutputs[nb] = m_graph->GetNetwork(nb)->execute();
         }
     }
 
     // now try to get execution results
     for (unsigned nb = 0; nb < m_graph->GetNetworksCount(); nb++) {
-        unsigned int mask = 1 << nb;
-
-        if (m_curBatch & mask) {
+        if (m_graph->GetNetworkImages(nb, m_curBatch) > 0) {
             for (auto& no : _networkOutputs) {
                 std::string outputID = m_graph->MapOutputName(no.first);
                 auto outputMemory = networkOutputs[nb].at(outputID).get_memory();
@@ -761,9 +829,17 @@ void CLDNNInferRequest::InferImpl() {
         m_graph = CLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph;
     }
 
+    // switch to the graph rebuilt with the kernels found by the background tuning, if any;
+    // the outputs are copied from the new graph as they do not share the memory with it
+    auto exeNetwork = std::dynamic_pointer_cast<CLDNNExecNetwork>(_exeNetwork);
+    if (exeNetwork != nullptr && exeNetwork->m_config.backgroundTuning) {
+        m_graph = exeNetwork->GetGraph(m_graph->GetStreamID());
+    }
+
     // execute input pre-processing.
     execDataPreprocessing(_inputs, true);  // "true" stands for serial preprocessing in case of OpenMP
 
+    inputsEvents.clear();
     for (auto &item : _inputs) {
         std::string name = item.first;
         Blob::Ptr inputBlob = item.second;
@@ -847,8 +923,15 @@ void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const
             default:
                 THROW_IE_EXCEPTION << "Unsupported input precision " << prec;
         }
+    } else if (auto shared = shareHostBlob(hostPtrInputs, inputName, memory.get_layout(), inputBlob)) {
+        // The integrated GPU reads the user blob in place.
+        _nw_ptr->set_input_data(internalName, *shared);
+    } else if (memory.get_layout().bytes_count() == inputBlob.byteSize()) {
+        // Otherwise, the data is uploaded to the input memory without blocking, the execution waits for the upload.
+        inputsEvents.push_back(_nw_ptr->copy_from_host(memory, inputBlob.cbuffer().as<const void*>()));
+        _nw_ptr->set_input_data(internalName, memory);
     } else {
-        // Otherwise, we have to attach to user memory and then copy the data.
+        // or we have to attach to user memory and then copy the data.
         copyInputData(_nw_ptr, inputName, inputLayout, inputBlob);
     }
 }
@@ -856,11 +939,9 @@ void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const
 void CLDNNInferRequest::PrepareInputDyn(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
     // now try to get execution results
     for (unsigned nb = 0; nb < m_graph->GetNetworksCount(); nb++) {
-        unsigned int mask = 1 << nb;
-
-        if (m_curBatch & mask) {
+        if (m_graph->GetNetworkImages(nb, m_curBatch) > 0) {
             auto inputLayout = m_graph->GetInputLayouts().at(inputName);
-            inputLayout.size.batch[0] = mask;
+            inputLayout.size.batch[0] = m_graph->GetNetworkBatch(nb);
             copyInputData(m_graph->GetNetwork(nb), inputName, inputLayout, inputBlob, &batchInputs[inputName][nb]);
         }
     }
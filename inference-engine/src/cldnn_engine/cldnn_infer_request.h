@@ -8,6 +8,7 @@
 #include <map>
 #include <vector>
 #include <memory>
+#include <utility>
 #include <atomic>
 #include <ie_plugin.hpp>
 #include <inference_engine.hpp>
@@ -50,10 +51,21 @@ public:
 protected:
     std::map<std::string, cldnn::memory> inputsMemory;
     std::map<std::string, cldnn::primitive_id> outputsMap;
+    // the output blobs sharing the memory with the outputs of the graph they were allocated for
+    std::map<std::string, InferenceEngine::Blob::Ptr> internalOutputs;
+    // the uploads of the input data the next execution waits for
+    std::vector<cldnn::event> inputsEvents;
+    // the memory the integrated GPU uses the user blobs through in place, with the pointers of the blobs
+    using host_ptr_memory = std::map<cldnn::primitive_id, std::pair<void*, cldnn::memory>>;
+    host_ptr_memory hostPtrInputs;
+    host_ptr_memory hostPtrOutputs;
+    bool m_useHostPtr = false;
 
     bool m_useProfiling;
     bool m_useStreams;
     std::shared_ptr<CLDNNGraph> m_graph;
+    // the graph the blobs were allocated for, they might point to its memory after the graph is replaced
+    std::shared_ptr<CLDNNGraph> m_allocatedGraph;
 
     // dynamic batch stuff
     std::map<std::string, std::vector<buf_info>> batchInputs;
@@ -75,6 +87,8 @@ protected:
     void execAndParse();
     void execAndParseDyn();
 
+    const cldnn::memory* shareHostBlob(host_ptr_memory& shared, const cldnn::primitive_id& name,
+                                       const cldnn::layout& layout, const InferenceEngine::Blob& blob);
     void PrepareInput(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
     void PrepareInputDyn(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
 
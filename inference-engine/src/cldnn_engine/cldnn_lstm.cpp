@@ -6,6 +6,7 @@
 #include <vector>
 #include <sstream>
 #include <utility>
+#include <algorithm>
 #include <api/cldnn.hpp>
 #include <api/data.hpp>
 #include <api/mutable_data.hpp>
@@ -370,6 +371,7 @@ void Program::CreateDynamicLSTM(cldnn::topology& topology, InferenceEngine::CNNL
     cldnn::primitive_id biasID = layerName + m_biasesTag;
     auto rnnLayer = as<RNNSequenceLayer*>(layer);
     bool permute_input = (1 != rnnLayer->axis);
+    bool hasSeqLengths = layer->insData.size() > 3;
     int32_t directions = 1;
 
     /* check incoming CNN layer and setup required variables */
@@ -386,12 +388,13 @@ void Program::CreateDynamicLSTM(cldnn::topology& topology, InferenceEngine::CNNL
 
         auto in_data1 = layer->insData[1].lock();
         auto in_data2 = layer->insData[2].lock();
-        auto in_data3 = layer->insData[3].lock();
 
         if (in_dims0.size() != 3 ||
             in_data1->getTensorDesc().getDims().size() != 2 ||
-            in_data2->getTensorDesc().getDims().size() != 2 ||
-            in_data3->getTensorDesc().getDims().size() != 1)
+            in_data2->getTensorDesc().getDims().size() != 2)
+            THROW_IE_EXCEPTION << "Wrong input shapes for dynamic RNN Layer " << layer->name;
+
+        if (hasSeqLengths && layer->insData[3].lock()->getTensorDesc().getDims().size() != 1)
             THROW_IE_EXCEPTION << "Wrong input shapes for dynamic RNN Layer " << layer->name;
 
         if (!permute_input) {
@@ -501,11 +504,24 @@ void Program::CreateDynamicLSTM(cldnn::topology& topology, InferenceEngine::CNNL
     cldnn::primitive_id dynReshapeID = layerName + "_dynReshape";
     cldnn::tensor dynShape = { 1, 1, lstm_batch_size, 1 };
     cldnn::layout dynLayout = cldnn::layout(DataTypeFromPrecision(lstmPrecision), cldnn::format::bfyx, dynShape);
-    topology.add(cldnn::reshape(dynReshapeID, inputPrimitives[3], dynShape));
-    topology.add(cldnn::reorder(dynID, dynReshapeID, dynLayout));
+    if (hasSeqLengths) {
+        topology.add(cldnn::reshape(dynReshapeID, inputPrimitives[3], dynShape));
+        topology.add(cldnn::reorder(dynID, dynReshapeID, dynLayout));
 
-    addInnerPrimitiveToProfiler(dynReshapeID, layerName, layer);
-    addInnerPrimitiveToProfiler(dynID, layerName, layer);
+        addInnerPrimitiveToProfiler(dynReshapeID, layerName, layer);
+        addInnerPrimitiveToProfiler(dynID, layerName, layer);
+    } else {
+        // all the sequences of the batch take the whole length
+        auto dynMem = cldnn::memory::allocate(*m_engine, dynLayout);
+        if (dynLayout.data_type == cldnn::data_types::f16) {
+            auto dynPointer = dynMem.pointer<uint16_t>();
+            std::fill(dynPointer.begin(), dynPointer.end(), cldnn::float_to_half(static_cast<float>(lstm_sequence_len)));
+        } else {
+            auto dynPointer = dynMem.pointer<float>();
+            std::fill(dynPointer.begin(), dynPointer.end(), static_cast<float>(lstm_sequence_len));
+        }
+        topology.add(cldnn::data(dynID, dynMem));
+    }
 
     cldnn::primitive_id inputID = permuteID;
     cldnn::primitive_id prevInputID = permuteID;
@@ -575,7 +591,10 @@ void Program::CreateDynamicLSTM(cldnn::topology& topology, InferenceEngine::CNNL
 }
 
 void Program::CreateRNNPrimitive(cldnn::topology& topology, InferenceEngine::CNNLayerPtr &layer) {
-    if (layer->insData.size() > 3) {
+    // The dynamic LSTM runs the whole sequence in a single timeloop kernel instead of
+    // the gemm and eltwise kernels per timestep, the bidirectional sequences keep the per-step primitives
+    auto rnnLayer = as<RNNSequenceLayer*>(layer);
+    if (layer->insData.size() > 3 || rnnLayer->direction != RNNSequenceLayer::BDR) {
         CreateDynamicLSTM(topology, layer);
     } else {
         CreateRegularLSTM(topology, layer);
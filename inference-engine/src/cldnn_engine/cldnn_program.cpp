@@ -77,6 +77,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <exec_graph_info.hpp>
+#include <ie_profiling.hpp>
 #include "cnn_network_int8_normalizer.hpp"
 
 #include "low_precision_transformations/transformer.hpp"
@@ -211,6 +212,7 @@ Program::Program(InferenceEngine::ICNNNetwork& network, std::shared_ptr<const cl
     InitFormat(network);
 
     if (config.enableInt8) {
+        IE_PROFILING_AUTO_SCOPE(Program::LowPrecisionTransformations)
         auto params = LayerTransformation::Params(true,  // updatePrecisions
                                                   true,  // quantizeOutputs
                                                   true,  // weightsToConst
@@ -267,7 +269,7 @@ Program::Program(InferenceEngine::ICNNNetwork& network, std::shared_ptr<const cl
             primitiveIDs.clear();
             blobMemCache.clear();
 
-            changeInputBatch(1U << static_cast<unsigned>(b));
+            changeInputBatch(GetBatchOfProgram(b));
             m_programs.insert(m_programs.begin(), BuildProgram(network));
             m_engine->release_pending_memory(0);
         }
@@ -278,6 +280,9 @@ Program::Program(InferenceEngine::ICNNNetwork& network, std::shared_ptr<const cl
 }
 
 int Program::GetMaxBatchSizeForSingleProgram() {
+    if (m_config.max_dynamic_batch > 1 && m_config.dynBatchSingleProgram)
+        return 1;
+
     if (m_config.max_dynamic_batch > 1) {
         // calculate number of networks necessary based on binary log
         unsigned int tmp = m_config.max_dynamic_batch;
@@ -295,6 +300,14 @@ int Program::GetMaxBatchSizeForSingleProgram() {
     return 0;
 }
 
+int Program::GetBatchOfProgram(int program_id) const {
+    // the single program serves every batch up to the maximal one, otherwise the batch is the sum of the programs
+    // of its binary digits
+    if (m_config.dynBatchSingleProgram)
+        return m_config.max_dynamic_batch;
+    return 1 << program_id;
+}
+
 std::shared_ptr<cldnn::program> Program::getCompiledProgram(int program_id) {
     if (program_id >= m_programs.size())
         THROW_CLDNN_EXCEPTION("Invalid program ID");
@@ -350,12 +363,15 @@ void Program::InitFormat(InferenceEngine::ICNNNetwork &network) {
 }
 
 std::shared_ptr<cldnn::program> Program::BuildProgram(InferenceEngine::ICNNNetwork &network) {
+    IE_PROFILING_AUTO_SCOPE(Program::BuildProgram)
     cldnn::build_options options;
     if (!m_config.graph_dumps_dir.empty()) {
         options.set_option(cldnn::build_option::graph_dumps_dir(m_config.graph_dumps_dir));
     }
     options.set_option(cldnn::build_option::optimize_data(true));
     options.set_option(cldnn::build_option::tuning_config(m_config.tuningConfig));
+    // the detection outputs whose priors do not fit SLM still run on the host
+    options.set_option(cldnn::build_option::detection_output_gpu(m_config.detectionOutputGpu));
 
     cldnn::topology topology;
 
@@ -442,6 +458,8 @@ std::shared_ptr<cldnn::program> Program::BuildProgram(InferenceEngine::ICNNNetwo
     // 5. profit
     p_currentOutputs.clear();
 
+    // the graph optimizations and the compilation of the kernels
+    IE_PROFILING_AUTO_SCOPE(Program::CompileProgram)
     return std::make_shared<cldnn::program>(*m_engine, topology, options);
 }
 
@@ -2080,7 +2098,8 @@ void Program::CreateCustomLayerPrimitive(cldnn::topology& topology, InferenceEng
         customLayer->CompilerOptions(),
         outputLayout,
         gws,
-        lws);
+        lws,
+        customLayer->TuneLocalSize());
 
     auto prevLayerName = genericLayerName;
     if (outputLayout.format != cldnn::format::any &&
@@ -4147,6 +4166,7 @@ void Program::AddInputPrimitive(cldnn::topology& topology, InputInfo::Ptr inputI
     networkInputLayout.size = networkInputLayout.size.transform(inputFormat, 1);
     networkInputLayout.data_type = DataTypeFromPrecision(layerPrecision);
     auto preprocessPrimID = "reorder:" + inputName + m_preProcessTag;
+    ioPrecisions[inputInfo->name()] = layerPrecision;
 
     if (ColorFormat::NV12 == preProcess.getColorFormat() && m_config.nv12_two_inputs) {
         // for NV12, create two input layouts with reorder instead of one,
@@ -4320,6 +4340,9 @@ void Program::AddOutputPrimitive(cldnn::topology& topology, std::string outputNa
 
     auto outputReorderID = "reorder:" + outputName + m_postProcessTag;
     Precision precision = outputPrecision == Precision::UNSPECIFIED ? outputData->getPrecision() : outputPrecision;
+    const Precision creatorPrecision = outputCreator->precision;
+    ioPrecisions[outputName] = creatorPrecision == Precision::UNSPECIFIED || creatorPrecision == Precision::MIXED
+                               ? precision : creatorPrecision;
 
     // Find correct output ID. Start with name stored in IR.
     std::string outputID = outLayerName;
@@ -98,6 +98,8 @@ public:
 
     std::map<std::string, InferenceEngine::SizeVector> outputDims;
     std::map<std::string, cldnn::layout> inputLayouts;
+    // the precisions the network computes its inputs and outputs in, the blobs of these precisions are not converted
+    std::map<std::string, InferenceEngine::Precision> ioPrecisions;
     std::map<const char *, cldnn::primitive_id> blobMemCache;
 
     int m_max_batch;
@@ -107,7 +109,10 @@ public:
 
     std::vector<cldnn::primitive_id> GetPrevLayersPrimitives(const InferenceEngine::CNNLayerPtr layer) const;
     const std::map<std::string, cldnn::layout>& getInputLayouts() const { return inputLayouts; }
+    const std::map<std::string, InferenceEngine::Precision>& getIOPrecisions() const { return ioPrecisions; }
     int GetMaxBatchSizeForSingleProgram();
+    // the batch the program compiled for the dynamic batch processes
+    int GetBatchOfProgram(int program_id) const;
 
     void addPrimitiveToProfiler(cldnn::primitive_id id, const InferenceEngine::CNNLayerPtr &layer,
                                 cldnn::primitive_id customOutputId = "");
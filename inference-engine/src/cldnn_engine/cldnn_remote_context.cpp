@@ -261,7 +261,16 @@ CLDNNExecutionContextImpl::CLDNNExecutionContextImpl(const std::shared_ptr<Infer
             m_config.queuePriority,
             m_config.queueThrottle,
             m_config.memory_pool_on,
-            m_config.throughput_streams));
+            m_config.throughput_streams,
+            "cache.json",
+            0,
+            10,
+            m_config.kernels_cache_dir,
+            m_config.kernels_cache_max_size * 1024 * 1024,
+            m_config.outOfOrderExecution,
+            m_config.memoryArena,
+            m_config.lazyKernelsCompilation,
+            m_config.host_threads));
 }
 
 ParamMap CLDNNExecutionContextImpl::getParams() const {
@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace CLDNNPlugin {
+
+/**
+ * The graphs of the streams of an executable network, one per stream. The whole set can be replaced
+ * (e.g. by the graphs with the tuned kernels) while the requests pick their graphs up, so every access
+ * takes the lock and callers iterating over the graphs work with a snapshot.
+ */
+template <typename Graph>
+class CLDNNStreamGraphs {
+public:
+    using GraphPtr = std::shared_ptr<Graph>;
+
+    CLDNNStreamGraphs() = default;
+    explicit CLDNNStreamGraphs(std::vector<GraphPtr> graphs) : m_graphs(std::move(graphs)) {}
+    CLDNNStreamGraphs(const CLDNNStreamGraphs&) = delete;
+    CLDNNStreamGraphs& operator=(const CLDNNStreamGraphs&) = delete;
+
+    std::vector<GraphPtr> Snapshot() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_graphs;
+    }
+
+    GraphPtr Get(uint16_t stream_id) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_graphs.at(stream_id);
+    }
+
+    size_t Size() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_graphs.size();
+    }
+
+    /**
+     * Sets the graphs the streams are created with.
+     */
+    void Reset(std::vector<GraphPtr> graphs) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_graphs = std::move(graphs);
+    }
+
+    /**
+     * Replaces the graphs if there are as many of them as the streams, the stream ids of the requests
+     * index the set, so a set of another size is dropped and the current graphs are kept.
+     * @return true if the graphs were replaced
+     */
+    bool Replace(std::vector<GraphPtr> graphs) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (graphs.size() != m_graphs.size())
+            return false;
+        m_graphs = std::move(graphs);
+        return true;
+    }
+
+private:
+    std::vector<GraphPtr> m_graphs;
+    mutable std::mutex m_mutex;
+};
+
+};  // namespace CLDNNPlugin
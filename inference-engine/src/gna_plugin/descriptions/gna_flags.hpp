@@ -9,6 +9,8 @@
 namespace GNAPluginNS {
 struct GNAFlags {
     uint8_t gna_lib_async_threads_num = 1;
+    uint32_t input_frames_shift = 0;
+    uint32_t perf_count_window = 0;
 
     bool compact_mode = true;
     bool exclusive_async_requests = false;
@@ -16,5 +18,7 @@ struct GNAFlags {
     bool gna_openmp_multithreading = false;
     bool sw_fp32 = false;
     bool performance_counting = false;
+    bool collect_statistics = false;
+    bool batch_streams = false;
 };
 }  // namespace GNAPluginNS
@@ -16,6 +16,8 @@ struct InputDesc {
     std::unordered_map<std::string, intel_dnn_orientation_t> orientation_in;
     /// order of scale factors matches inputs order in original topology
     std::vector<float> inputScaleFactors;
+    /// scale factors are set by the user, otherwise they come from the network statistics if any
+    bool inputScaleFactorsFromConfig = false;
     std::map<std::string, int> bytes_allocated_for_input;
     std::unordered_map<std::string, std::list<std::vector<void *>>::iterator> ptr_inputs_global_id;
     std::list<std::vector<void *>> ptr_inputs_global_storage;
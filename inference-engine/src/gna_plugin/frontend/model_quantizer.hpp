@@ -7,6 +7,10 @@
 #include <vector>
 #include <utility>
 #include <string>
+#include <algorithm>
+#include <cmath>
+
+#include <ie_icnn_network_stats.hpp>
 
 #include "layer_transform.hpp"
 #include "gna_graph_tools.hpp"
@@ -17,6 +21,20 @@
 
 namespace GNAPluginNS {
 
+/**
+ * @brief max absolute value over all channels of the layer statistics
+ */
+inline float StatsMaxAbsValue(const InferenceEngine::NetworkNodeStats &stats) {
+    float maxAbs = 0.0f;
+    for (auto value : stats._minOutputs) {
+        maxAbs = std::max(maxAbs, std::fabs(value));
+    }
+    for (auto value : stats._maxOutputs) {
+        maxAbs = std::max(maxAbs, std::fabs(value));
+    }
+    return maxAbs;
+}
+
 /**
  * Quantize entire cnn - network
  * @tparam T - type trait for weights and biases
@@ -86,6 +104,19 @@ class ModelQuantizer {
             scaleIndex++;
         }
 
+        // output ranges collected on a calibration dataset, layers inserted by the passes have none
+        InferenceEngine::ICNNNetworkStats* stats = nullptr;
+        if (model.getStats(&stats, nullptr) == InferenceEngine::StatusCode::OK && stats != nullptr && !stats->isEmpty()) {
+            auto & nodesStats = stats->getNodesStats();
+            for (auto &&layer : sortedNewNet) {
+                auto layerStats = nodesStats.find(layer->name);
+                auto quantData = InferenceEngine::getInjectedData<QuantizedLayerParams>(layer);
+                if (layerStats != nodesStats.end() && quantData != nullptr) {
+                    quantData->_dst_max_abs = StatsMaxAbsValue(*layerStats->second);
+                }
+            }
+        }
+
         propagateScaleFactor(sortedNewNet, T::mandatory().getWeightsPrecision().size());
 
         // sorted order gives possibility for propagate quantisation along depended layers
@@ -19,6 +19,8 @@ struct QuantizedLayerParams {
     Quantization _bias_quant;
     float _o_shift = 0.0f;
     float _b_shift = 0.0f;
+    // max absolute output value from the network statistics, 0 if the layer has no statistics
+    float _dst_max_abs = 0.0f;
 };
 
 }  // namespace GNAPluginNS
\ No newline at end of file
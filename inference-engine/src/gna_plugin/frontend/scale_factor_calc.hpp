@@ -16,6 +16,7 @@
 #include "layers/gna_layer_info.hpp"
 #include "gna_plugin_log.hpp"
 #include "gna_slope_scale.h"
+#include "quantization.h"
 
 namespace GNAPluginNS {
 namespace frontend {
@@ -100,11 +101,16 @@ class ScaleFactorPerLayer<InferenceEngine::CNNLayer *> {
             result = fabs(scale_extra) > fabs(scale_default) ?  identity_scale_factor / 2 : identity_scale_factor;
 
 #endif
-        } else if (layer.isRelu() &&
-                static_cast<uint64_t>(activation_scale_factor * quantizedParams->_src_quant.scale)
-                                                            > std::numeric_limits<int32_t>::max()-1) {
-            // if activation is one from relu family, we need to apply heuristic to avoid activation output overflow
-            result = (activation_scale_factor * 0.5);
+        } else {
+            if (quantizedParams->_dst_max_abs > 0.0f) {
+                // the output range is known from the statistics, so it is fit into int16 with the same margin as inputs
+                result = MAX_VAL_2B_FEAT / quantizedParams->_dst_max_abs;
+            }
+            if (layer.isRelu() &&
+                static_cast<uint64_t>(result * quantizedParams->_src_quant.scale) > std::numeric_limits<int32_t>::max()-1) {
+                // if activation is one from relu family, we need to apply heuristic to avoid activation output overflow
+                result = (result * 0.5);
+            }
         }
         return result;
     }
@@ -24,7 +24,58 @@
 #include "details/ie_exception.hpp"
 #include "gna_plugin_log.hpp"
 
+#if GNA_LIB_VER == 2
+namespace {
+// the helpers of different settings share the device, it is opened once and closed with the last helper
+std::mutex openedDevicesMutex;
+std::map<gna_device_id, int> openedDevices;
+}  // namespace
+#endif
+
+#if GNA_LIB_VER == 1
+std::shared_ptr<GNADeviceHelper> GNADeviceHelper::getShared(intel_gna_proc_t proc_type,
+                                                            uint8_t lib_async_n_threads,
+                                                            bool use_openmp,
+                                                            bool isPerformanceMeasuring) {
+    const SharedKey key {proc_type, lib_async_n_threads, use_openmp, isPerformanceMeasuring};
+#else
+std::shared_ptr<GNADeviceHelper> GNADeviceHelper::getShared(Gna2AccelerationMode gna2accMode,
+                                                            Gna2DeviceVersion gna2HwConsistency,
+                                                            uint8_t lib_async_n_threads,
+                                                            bool use_openmp,
+                                                            bool isPerformanceMeasuring) {
+    const SharedKey key {gna2accMode, gna2HwConsistency, lib_async_n_threads, use_openmp, isPerformanceMeasuring};
+#endif
+    static std::mutex devicesMutex;
+    static std::map<SharedKey, std::weak_ptr<GNADeviceHelper>> devices;
+
+    std::lock_guard<std::mutex> lock(devicesMutex);
+    auto device = devices[key].lock();
+    if (!device) {
+#if GNA_LIB_VER == 1
+        device = std::make_shared<GNADeviceHelper>(proc_type, lib_async_n_threads, use_openmp, isPerformanceMeasuring);
+#else
+        device = std::make_shared<GNADeviceHelper>(gna2accMode, gna2HwConsistency, lib_async_n_threads, use_openmp,
+                                                   isPerformanceMeasuring);
+#endif
+        devices[key] = device;
+    }
+    return device;
+}
+
 uint8_t* GNADeviceHelper::alloc(uint32_t size_requested, uint32_t *size_granted) {
+    std::lock_guard<std::mutex> lock(memoryMutex);
+    // the smallest freed region the request fits in
+    auto region = freeRegions.lower_bound(size_requested);
+    if (region != freeRegions.end()) {
+        *size_granted = region->first;
+        auto memPtr = region->second;
+        freeRegions.erase(region);
+        dumpXNNROPtr = memPtr;
+        dumpXNNROSize = *size_granted;
+        return static_cast<uint8_t *>(memPtr);
+    }
+
     void * memPtr;
 #if GNA_LIB_VER == 1
     memPtr = GNAAlloc(nGNAHandle, size_requested, size_granted);
@@ -35,18 +86,37 @@ uint8_t* GNADeviceHelper::alloc(uint32_t size_requested, uint32_t *size_granted)
     if (memPtr == nullptr) {
         THROW_GNA_EXCEPTION << "GNAAlloc failed to allocate memory. Requested: " << size_requested << " Granted: " << *(size_granted);
     }
+    allocations[memPtr] = *size_granted;
     dumpXNNROPtr = memPtr;
     dumpXNNROSize = *size_granted;
     return static_cast<uint8_t *>(memPtr);
 }
 
 void GNADeviceHelper::free(void * ptr) {
+    std::lock_guard<std::mutex> lock(memoryMutex);
+    auto allocation = allocations.find(ptr);
+    if (allocation != allocations.end()) {
+        freeRegions.emplace(allocation->second, ptr);
+    }
+}
+
+void GNADeviceHelper::releaseMemory() {
+    std::lock_guard<std::mutex> lock(memoryMutex);
 #if GNA_LIB_VER == 1
-    GNAFree(nGNAHandle);
+    // the memory of the handle is freed at once
+    if (!allocations.empty()) {
+        GNAFree(nGNAHandle);
+    }
 #else
-    const auto status = Gna2MemoryFree(ptr);
-    checkGna2Status(status);
+    for (auto&& allocation : allocations) {
+        const auto status = Gna2MemoryFree(allocation.first);
+        checkGna2Status(status);
+    }
 #endif
+    allocations.clear();
+    freeRegions.clear();
+    dumpXNNROPtr = nullptr;
+    dumpXNNROSize = 0;
 }
 
 #if GNA_LIB_VER == 1
@@ -171,7 +241,7 @@ GNADeviceHelper::DumpResult GNADeviceHelper::dumpXnn(const uint32_t modelId) {
 
 #if GNA_LIB_VER == 2
 
-void GNADeviceHelper::dumpXnnNoMmu(const uint32_t modelId, std::ostream & outStream) {
+void GNADeviceHelper::dumpXnnNoMmu(const uint32_t modelId, std::ostream & outStream, const void * roPtr) {
     Gna2ModelSueCreekHeader sueHeader;
     auto ptr = ExportSueLegacyUsingGnaApi2(modelId, &sueHeader);
     gnaUserFree(ptr);
@@ -179,10 +249,18 @@ void GNADeviceHelper::dumpXnnNoMmu(const uint32_t modelId, std::ostream & outStr
     ExportGnaDescriptorPartiallyFilled(sueHeader.NumberOfLayers, outStream);
 
     ExportLdForNoMmu(modelId, outStream);
-    if (dumpXNNROPtr == nullptr) {
-        THROW_GNA_EXCEPTION << "Bad RO pointer (nullptr)";
+    uint32_t roSize = 0;
+    {
+        std::lock_guard<std::mutex> lock(memoryMutex);
+        auto allocation = allocations.find(const_cast<void *>(roPtr));
+        if (allocation != allocations.end()) {
+            roSize = allocation->second;
+        }
     }
-    outStream.write(static_cast<const char*>(dumpXNNROPtr), dumpXNNROSize);
+    if (roPtr == nullptr || roSize == 0) {
+        THROW_GNA_EXCEPTION << "Bad RO pointer (not allocated by the device)";
+    }
+    outStream.write(static_cast<const char*>(roPtr), roSize);
 
     // TODO: GNA2: remove
     outStream.write("Gna2ModelSueCreekHeader", 24);
@@ -209,8 +287,14 @@ void GNADeviceHelper::open(uint8_t n_threads) {
         detectedGnaDevVersion == Gna2DeviceVersionSoftwareEmulation) {
         gnalog() << "GNA Device not detected, consider using other mode of acceleration";
     }
-    status = Gna2DeviceOpen(nGnaDeviceIndex);
-    checkGna2Status(status);
+    {
+        std::lock_guard<std::mutex> lock(openedDevicesMutex);
+        if (openedDevices[nGnaDeviceIndex] == 0) {
+            status = Gna2DeviceOpen(nGnaDeviceIndex);
+            checkGna2Status(status);
+        }
+        openedDevices[nGnaDeviceIndex]++;
+    }
     // TODO: GNA2: uncomment when scratchpad repaired
     // status = Gna2DeviceSetNumberOfThreads(nGnaDeviceIndex, n_threads);
     // checkGna2Status(status);
@@ -219,12 +303,16 @@ void GNADeviceHelper::open(uint8_t n_threads) {
 }
 
 void GNADeviceHelper::close() {
+    releaseMemory();
 #if GNA_LIB_VER == 1
     GNADeviceClose(nGNAHandle);
     nGNAHandle = 0;
 #else
-    const auto status = Gna2DeviceClose(nGnaDeviceIndex);
-    checkGna2Status(status);
+    std::lock_guard<std::mutex> lock(openedDevicesMutex);
+    if (--openedDevices[nGnaDeviceIndex] == 0) {
+        const auto status = Gna2DeviceClose(nGnaDeviceIndex);
+        checkGna2Status(status);
+    }
 #endif
     deviceOpened = false;
 }
@@ -284,3 +372,13 @@ void GNADeviceHelper::getGnaPerfCounters(std::map<std::string, InferenceEngine::
 #endif
     retPerfCounters["1.2 Stall scoring time in HW"] = info;
 }
+
+void GNADeviceHelper::getGnaPerfCycles(uint64_t &totalCycles, uint64_t &stallCycles) const {
+#if GNA_LIB_VER == 1
+    totalCycles = nGNAPerfResultsTotal.hw.total;
+    stallCycles = nGNAPerfResultsTotal.hw.stall;
+#else
+    totalCycles = instrumentationTotal[0];
+    stallCycles = instrumentationTotal[1];
+#endif
+}
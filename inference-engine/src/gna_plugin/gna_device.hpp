@@ -6,9 +6,11 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <map>
 #include <thread>
+#include <tuple>
 
 #include <ie_common.h>
 
@@ -57,6 +59,11 @@ class GNADeviceHelper {
     const uint32_t GNA_TIMEOUT = MAX_TIMEOUT;
     bool isPerformanceMeasuring = false;
     bool deviceOpened = false;
+
+    // the GNA memory is pinned, so the freed regions are kept for the next allocations until the device is closed
+    std::mutex memoryMutex;
+    std::map<void *, uint32_t> allocations;
+    std::multimap<uint32_t, void *> freeRegions;
 public:
 #if GNA_LIB_VER == 1
     explicit GNADeviceHelper(intel_gna_proc_t proc_type = GNA_AUTO,
@@ -84,6 +91,25 @@ public:
         }
     }
 
+#if GNA_LIB_VER == 1
+    using SharedKey = std::tuple<intel_gna_proc_t, uint8_t, bool, bool>;
+    static std::shared_ptr<GNADeviceHelper> getShared(intel_gna_proc_t proc_type = GNA_AUTO,
+                                                      uint8_t lib_async_n_threads = 1,
+                                                      bool use_openmp = false,
+                                                      bool isPerformanceMeasuring = false);
+#else
+    using SharedKey = std::tuple<Gna2AccelerationMode, Gna2DeviceVersion, uint8_t, bool, bool>;
+    /**
+     * returns the device helper shared by all the networks of the process loaded with the same settings, so they use
+     * one device handle and one pool of the GNA memory; the device is closed once the last network releases it
+     */
+    static std::shared_ptr<GNADeviceHelper> getShared(Gna2AccelerationMode gna2accMode = Gna2AccelerationModeAuto,
+                                                      Gna2DeviceVersion gna2HwConsistency = Gna2DeviceVersionSoftwareEmulation,
+                                                      uint8_t lib_async_n_threads = 1,
+                                                      bool use_openmp = false,
+                                                      bool isPerformanceMeasuring = false);
+#endif
+
     GNADeviceHelper(const GNADeviceHelper&) = delete;
     GNADeviceHelper& operator= (const GNADeviceHelper&) = delete;
     ~GNADeviceHelper() {
@@ -142,17 +168,26 @@ public:
 #else
 
     DumpResult dumpXnn(const uint32_t modelId);
-    void dumpXnnNoMmu(const uint32_t modelId, std::ostream & outStream);
+    /**
+     * @param roPtr - the memory region allocated for the model
+     */
+    void dumpXnnNoMmu(const uint32_t modelId, std::ostream & outStream, const void * roPtr);
 #endif
     void free(void * ptr);
 
     void updateGnaPerfCounters();
     void getGnaPerfCounters(std::map<std::string,
                         InferenceEngine::InferenceEngineProfileInfo>& retPerfCounters);
+    /**
+     * @brief gets the hardware total and stall cycles of the last request waited for
+     */
+    void getGnaPerfCycles(uint64_t &totalCycles, uint64_t &stallCycles) const;
  private:
     void open(uint8_t const n_threads);
 
     void close();
+
+    void releaseMemory();
 #if GNA_LIB_VER == 1
     void checkStatus() const;
 #endif
@@ -46,6 +46,11 @@ class GNAExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafe
         return plg->QueryState();
     }
 
+    void GetMetric(const std::string &name, InferenceEngine::Parameter &result,
+                   InferenceEngine::ResponseDesc*) const override {
+        result = plg->GetMetric(name, {});
+    }
+
     void Export(const std::string &modelFileName) override {
         plg->Export(modelFileName);
     }
@@ -1660,3 +1660,18 @@ void GNAGraphCompiler::Reset() {
         std::memset(concatLayer.second.gna_ptr, 0, concatLayer.second.reserved_size);
     }
 }
+
+void GNAGraphCompiler::ResetStream(uint32_t stream, uint32_t num_streams) {
+    auto resetColumn = [&](void *ptr, size_t size, size_t element_size) {
+        auto bytes = reinterpret_cast<uint8_t *>(ptr);
+        for (size_t offset = stream * element_size; offset + element_size <= size; offset += num_streams * element_size) {
+            std::memset(bytes + offset, 0, element_size);
+        }
+    };
+    for (auto && memLayer : memory_connection) {
+        resetColumn(memLayer.second.gna_ptr, memLayer.second.stateSizeBytes(), memLayer.second.elementSizeBytes());
+    }
+    for (auto && concatLayer : concat_connection) {
+        resetColumn(concatLayer.second.gna_ptr, concatLayer.second.reserved_size, gnaFlags->sw_fp32 ? 4 : 2);
+    }
+}
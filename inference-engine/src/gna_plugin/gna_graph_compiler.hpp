@@ -117,5 +117,12 @@ public:
     void CopyPrimitive(InferenceEngine::CNNLayerPtr);
 
     void Reset();
+    /**
+     * @brief zeroes the memory of one stream in GNA_BATCH_STREAMS mode, where the streams are the interleaved
+     * columns of the memory buffers
+     * @param stream - batch position of the stream
+     * @param num_streams - batch size of the network
+     */
+    void ResetStream(uint32_t stream, uint32_t num_streams);
 };
 }  // namespace GNAPluginNS
@@ -4,24 +4,36 @@
 
 #pragma once
 
+#include <cstring>
+#include <future>
 #include <memory>
 #include <string>
 #include <map>
 
+#include "blob_factory.hpp"
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
 #include "gna_plugin.hpp"
+#include <gna/gna_config.hpp>
 
 namespace GNAPluginNS {
 
 class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
     std::shared_ptr<GNAPlugin> plg;
     uint32_t inferRequestIdx = -1;
+    InferenceEngine::ITaskExecutor::Ptr importExecutor;
+    // ready once the inputs are imported and the request is queued to the device
+    std::future<void> queued;
+    // copies of the inputs the import executor reads, so the caller may refill the inputs once StartAsync returns
+    InferenceEngine::BlobMap stagedInputs;
+    // indices of the output elements to compute, set as GNA_CONFIG_VALUE(ACTIVE_OUTPUTS) blob
+    InferenceEngine::Blob::Ptr activeOutputs;
 
  public:
     GNAInferRequest(const std::shared_ptr<GNAPlugin>& plg,
                     InferenceEngine::InputsDataMap networkInputs,
                     InferenceEngine::OutputsDataMap networkOutputs)
-        : InferenceEngine::AsyncInferRequestInternal(networkInputs, networkOutputs), plg(plg) {
+        : InferenceEngine::AsyncInferRequestInternal(networkInputs, networkOutputs), plg(plg),
+          importExecutor(plg->GetImportExecutor()) {
         // TODO: internal connection API - better to generalize
         if (networkOutputs.empty()) {
             THROW_GNA_EXCEPTION << "GNAInferRequest :: network has zero outputs";
@@ -41,6 +53,12 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
                 plg->GetInputBlob(input.first, input.second->getTensorDesc().getPrecision());
         }
     }
+
+    ~GNAInferRequest() override {
+        if (queued.valid()) {
+            queued.wait();
+        }
+    }
     /**
      * @brief Infers specified input(s) in synchronous mode
      * @note blocks all method of IInferRequest while request is ongoing (running or waiting in queue)
@@ -48,7 +66,29 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
     void InferImpl() override {
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
-        plg->Infer(_inputs, _outputs);
+        plg->Infer(_inputs, _outputs, activeOutputs);
+    }
+
+    using InferenceEngine::AsyncInferRequestInternal::SetBlob;
+
+    /**
+     * @brief Sets the input or output blob, or the active outputs of the request if the name is GNA_CONFIG_VALUE(ACTIVE_OUTPUTS)
+     */
+    void SetBlob(const char *name, const InferenceEngine::Blob::Ptr &data) override {
+        if (name != nullptr && std::string(name) == GNA_CONFIG_VALUE(ACTIVE_OUTPUTS)) {
+            plg->CheckActiveOutputs(data);
+            activeOutputs = data;
+            return;
+        }
+        InferenceEngine::AsyncInferRequestInternal::SetBlob(name, data);
+    }
+
+    void GetBlob(const char *name, InferenceEngine::Blob::Ptr &data) override {
+        if (name != nullptr && std::string(name) == GNA_CONFIG_VALUE(ACTIVE_OUTPUTS)) {
+            data = activeOutputs;
+            return;
+        }
+        InferenceEngine::AsyncInferRequestInternal::GetBlob(name, data);
     }
 
     /**
@@ -66,16 +106,45 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
         * or in default wrapper (e.g. AsyncInferRequestThreadSafeDefault)
         */
     void StartAsyncImpl() override {
+        // the copies of the previous start are not read anymore once it is queued
+        if (queued.valid()) {
+            queued.wait();
+        }
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
-        inferRequestIdx = plg->QueueInference(_inputs, _outputs);
+        // the inputs are read before the call returns as for other devices, then they are imported on the import
+        // executor from the copies, so the caller can refill them or start the next request meanwhile
+        for (auto &&input : _inputs) {
+            auto &staged = stagedInputs[input.first];
+            if (!staged || staged->getTensorDesc() != input.second->getTensorDesc()) {
+                staged = make_blob_with_precision(input.second->getTensorDesc());
+                staged->allocate();
+            }
+            std::memcpy(staged->buffer().as<uint8_t *>(), input.second->cbuffer().as<const uint8_t *>(),
+                        input.second->byteSize());
+        }
+        auto promise = std::make_shared<std::promise<void>>();
+        queued = promise->get_future();
+        auto active = activeOutputs;
+        importExecutor->run([this, promise, active] {
+            try {
+                inferRequestIdx = plg->QueueInference(stagedInputs, _outputs, active);
+                promise->set_value();
+            } catch (...) {
+                promise->set_exception(std::current_exception());
+            }
+        });
     }
 
     InferenceEngine::StatusCode Wait(int64_t millis_timeout) override {
+        if (millis_timeout < -1) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str;
+        }
+        if (queued.valid()) {
+            queued.get();
+        }
         if (inferRequestIdx == -1) {
             return InferenceEngine::INFER_NOT_STARTED;
-        } else if (millis_timeout < -1) {
-            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str;
         }
 
         plg->Wait(inferRequestIdx);
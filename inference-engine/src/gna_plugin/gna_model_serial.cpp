@@ -8,10 +8,19 @@
 #include <ios>
 #include <iomanip>
 #include <map>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstddef>
+#include <cstring>
 #ifdef _WIN32
 #include <malloc.h>
 #else
 #include <mm_malloc.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 #include "gna_plugin.hpp"
@@ -65,11 +74,17 @@ bool is_little_endian() {
 
 const int gna_header_magic = is_little_endian() ?  0x4d414e47 : 0x474e414d;
 
+// the GNA memory is aligned to the page in the exported file to be mapped on import
+constexpr uint64_t gna_memory_alignment = 4096;
+
+// size of the header written before the GNA memory offset was added
+constexpr size_t gna_header_min_size = offsetof(ModelHeader, gnaMemOffset);
+
 ModelHeader GNAModelSerial::ReadHeader(std::istream &is) {
     is.exceptions(std::istream::failbit);
 
     ModelHeader header;
-    readBits(header, is);
+    readNBytes(&header, gna_header_min_size, is);
     if (*reinterpret_cast<int*>(header.gnam) != gna_header_magic) {
         THROW_GNA_EXCEPTION << "Imported file unsupported: magic number should be GNAM(0x474e414d), but was 0x"
                            << std::setfill('0') <<
@@ -81,12 +96,19 @@ ModelHeader GNAModelSerial::ReadHeader(std::istream &is) {
     if (header.version.major != HEADER_MAJOR) {
         THROW_GNA_EXCEPTION << "Imported file unsupported: major version should be == " << HEADER_MAJOR;
     }
-    if (header.headerSize < sizeof(header)) {
-        THROW_GNA_EXCEPTION << "Unsupported header size minimal value is : " << sizeof (header) << ", but read: " << header.headerSize;
+    if (header.headerSize < gna_header_min_size) {
+        THROW_GNA_EXCEPTION << "Unsupported header size minimal value is : " << gna_header_min_size << ", but read: " << header.headerSize;
     }
     /*
      * extra data need to be added into new header and modify check as appropriate
      */
+    if (header.headerSize >= sizeof(header)) {
+        readBits(header.gnaMemOffset, is);
+    }
+    if (header.gnaMemOffset % gna_memory_alignment != 0) {
+        THROW_GNA_EXCEPTION << "Imported file unsupported: GNA memory offset " << header.gnaMemOffset
+                            << " is not aligned to " << gna_memory_alignment;
+    }
 
     //  forward compatible
     if (header.headerSize > sizeof(header)) {
@@ -98,6 +120,59 @@ ModelHeader GNAModelSerial::ReadHeader(std::istream &is) {
 #define offsetFromBase(field)\
 getOffsetFromBase(field, #field)
 
+/**
+ * @brief writes the header, the structure of the model and the GNA memory at the page aligned offset,
+ * the padding is written as the reserved data of the header
+ */
+static void writeModel(ModelHeader header, const std::ostringstream &structure,
+                       void *basePointer, size_t gnaGraphSize, std::ostream &os) {
+    const auto data = structure.str();
+    const uint64_t structureEnd = sizeof(ModelHeader) + data.size();
+    header.gnaMemOffset = (structureEnd + gna_memory_alignment - 1) / gna_memory_alignment * gna_memory_alignment;
+    header.headerSize = static_cast<uint32_t>(sizeof(ModelHeader) + header.gnaMemOffset - structureEnd);
+
+    writeBits(header, os);
+    const std::vector<char> padding(header.headerSize - sizeof(ModelHeader), 0);
+    writeNBytes(padding.data(), static_cast<uint32_t>(padding.size()), os);
+    writeNBytes(data.data(), static_cast<uint32_t>(data.size()), os);
+
+    // once structure has been written lets push gna graph
+    os.write(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+}
+
+void GNAModelSerial::ImportMemory(void *basePointer, const ModelHeader &header, const std::string &modelFileName) {
+#ifdef _WIN32
+    std::ifstream is(modelFileName, std::ios_base::in | std::ios_base::binary);
+    is.exceptions(std::istream::failbit);
+    is.seekg(header.gnaMemOffset);
+    is.read(reinterpret_cast<char*>(basePointer), header.gnaMemSize);
+#else
+    const int fd = open(modelFileName.c_str(), O_RDONLY);
+    if (fd == -1) {
+        THROW_GNA_EXCEPTION << "Cannot open file to import model: " << modelFileName;
+    }
+    struct stat st = {};
+    if (fstat(fd, &st) != 0 || static_cast<uint64_t>(st.st_size) < header.gnaMemOffset + header.gnaMemSize) {
+        close(fd);
+        THROW_GNA_EXCEPTION << "Imported file unsupported: GNA memory of " << header.gnaMemSize
+                            << " bytes at offset " << header.gnaMemOffset << " is out of the file";
+    }
+    // the offset is aligned to the export page, the system page might be larger
+    const auto pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    const auto mapOffset = header.gnaMemOffset / pageSize * pageSize;
+    const auto mapShift = header.gnaMemOffset - mapOffset;
+    const auto mapSize = static_cast<size_t>(mapShift + header.gnaMemSize);
+    void *mapped = mmap(nullptr, mapSize, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(mapOffset));
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        THROW_GNA_EXCEPTION << "Cannot map GNA memory of the model: " << modelFileName;
+    }
+    madvise(mapped, mapSize, MADV_SEQUENTIAL);
+    std::memcpy(basePointer, reinterpret_cast<uint8_t*>(mapped) + mapShift, header.gnaMemSize);
+    munmap(mapped, mapSize);
+#endif
+}
+
 #if GNA_LIB_VER == 2
 
 bool IsEmptyTensor(const Gna2Tensor& t) {
@@ -119,7 +194,7 @@ const std::map<Gna2OperationType, std::vector<uint32_t>> GnaParamSize{
         sizeof(Gna2Shape)}},
 };
 
-void GNAModelSerial::Import(void *basePointer, size_t gnaGraphSize, std::istream & is) {
+void GNAModelSerial::Import(void *basePointer, size_t gnaGraphSize, std::istream & is, bool readMemory) {
     is.exceptions(std::istream::failbit);
 
     for (auto operation = gna2Model->Operations; operation != gna2Model->Operations + gna2Model->NumberOfOperations; ++operation) {
@@ -194,7 +269,9 @@ void GNAModelSerial::Import(void *basePointer, size_t gnaGraphSize, std::istream
 
 
     // once structure has been read lets read whole gna graph
-    is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    if (readMemory) {
+        is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    }
 }
 
 
@@ -211,6 +288,8 @@ uint32_t guessGrouping(Gna2Model const& model) {
 
 void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostream & os) const {
     os.exceptions(std::ostream::failbit);
+    // the header is written once the size of the structure is known
+    std::ostringstream structure;
 
     const std::vector<Gna2Operation>
         layers(gna2Model->Operations, gna2Model->Operations + gna2Model->NumberOfOperations);
@@ -262,20 +341,18 @@ void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostrea
     header.nRotateColumns = nRotateColumns;
 
 
-    writeBits(header, os);
-
     for (const auto & layer : layers) {
-        writeBits(static_cast<uint32_t>(layer.Type), os);
-        writeBits(layer.NumberOfOperands, os);
+        writeBits(static_cast<uint32_t>(layer.Type), structure);
+        writeBits(layer.NumberOfOperands, structure);
 
         for (uint32_t i = 0; i < layer.NumberOfOperands; i++) {
             if (layer.Operands[i] == nullptr)
-                writeBits(Gna2Tensor{}, os);
+                writeBits(Gna2Tensor{}, structure);
             else
-                writeBits(getTensorWithProperOffset(*layer.Operands[i]), os);
+                writeBits(getTensorWithProperOffset(*layer.Operands[i]), structure);
         }
 
-        writeBits(layer.NumberOfParameters, os);
+        writeBits(layer.NumberOfParameters, structure);
 
         // writing parameters
         switch (layer.Type) {
@@ -294,27 +371,26 @@ void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostrea
         }
         for (uint32_t i = 0; i < layer.NumberOfParameters; i++) {
             if (layer.Parameters[i] == nullptr) {
-                writeBits(static_cast<uint32_t>(0), os);
+                writeBits(static_cast<uint32_t>(0), structure);
                 continue;
             }
             const auto paramSize = GnaParamSize.at(layer.Type).at(i);
-            writeBits(paramSize, os);
-            writeNBytes(layer.Parameters[i], paramSize, os);
+            writeBits(paramSize, structure);
+            writeNBytes(layer.Parameters[i], paramSize, structure);
         }
     }
     // writing memory information
-    writeBits(static_cast<uint32_t>(states.size()), os);
+    writeBits(static_cast<uint32_t>(states.size()), structure);
     for (auto && state : states) {
-        writeBits(offsetFromBase(state.first), os);
-        writeBits(state.second, os);
+        writeBits(offsetFromBase(state.first), structure);
+        writeBits(state.second, structure);
     }
 
-    // once structure has been written lets push gna graph
-    os.write(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    writeModel(header, structure, basePointer, gnaGraphSize, os);
 }
 #else
 
-void GNAModelSerial::Import(void *basePointer, size_t gnaGraphSize, std::istream & is) {
+void GNAModelSerial::Import(void *basePointer, size_t gnaGraphSize, std::istream & is, bool readMemory) {
     is.exceptions(std::istream::failbit);
 
     auto readPwl = [&is, basePointer](intel_pwl_func_t & value) {
@@ -414,7 +490,9 @@ void GNAModelSerial::Import(void *basePointer, size_t gnaGraphSize, std::istream
 
 
     // once structure has been read lets read whole gna graph
-    is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    if (readMemory) {
+        is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    }
 }
 
 /**
@@ -427,6 +505,8 @@ void GNAModelSerial::Import(void *basePointer, size_t gnaGraphSize, std::istream
 
 void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostream & os) const {
     os.exceptions(std::ostream::failbit);
+    // the header is written once the size of the structure is known
+    std::ostringstream structure;
 
     std::vector<intel_nnet_layer_t>
         layers(ptr_nnet->pLayers, ptr_nnet->pLayers + ptr_nnet->nLayers);
@@ -443,11 +523,11 @@ void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostrea
         return offset;
     };
 
-    auto writePwl = [&os, getOffsetFromBase] (intel_pwl_func_t & value) {
-        writeBits(value.nSegments, os);
+    auto writePwl = [&structure, getOffsetFromBase] (intel_pwl_func_t & value) {
+        writeBits(value.nSegments, structure);
         // export require certain offset, since offset from base to nullptr cannot be correct, we are not store it at all
         if (value.nSegments != 0) {
-            writeBits(offsetFromBase(value.pSegments), os);
+            writeBits(offsetFromBase(value.pSegments), structure);
         }
     };
 
@@ -479,45 +559,43 @@ void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostrea
     header.nRotateColumns = nRotateColumns;
 
 
-    writeBits(header, os);
-
     for (auto & layer : layers) {
-        writeBits(layer.nInputColumns, os);
-        writeBits(layer.nInputRows, os);
-        writeBits(layer.nOutputColumns, os);
-        writeBits(layer.nOutputRows, os);
-        writeBits(layer.nBytesPerInput, os);
-        writeBits(layer.nBytesPerOutput, os);
-        writeBits(layer.nBytesPerIntermediateOutput, os);
-        writeBits(static_cast<uint32_t>(layer.nLayerKind), os);
+        writeBits(layer.nInputColumns, structure);
+        writeBits(layer.nInputRows, structure);
+        writeBits(layer.nOutputColumns, structure);
+        writeBits(layer.nOutputRows, structure);
+        writeBits(layer.nBytesPerInput, structure);
+        writeBits(layer.nBytesPerOutput, structure);
+        writeBits(layer.nBytesPerIntermediateOutput, structure);
+        writeBits(static_cast<uint32_t>(layer.nLayerKind), structure);
 
         // writing layers structs
         switch (layer.nLayerKind) {
             case INTEL_AFFINE_DIAGONAL:
             case INTEL_AFFINE: {
                 auto &affine = *reinterpret_cast<intel_affine_layer_t *>(layer.pLayerStruct);
-                writeBits(affine.affine.nBytesPerWeight, os);
-                writeBits(affine.affine.nBytesPerBias, os);
-                writeBits(offsetFromBase(affine.affine.pWeights), os);
-                writeBits(offsetFromBase(affine.affine.pBiases), os);
+                writeBits(affine.affine.nBytesPerWeight, structure);
+                writeBits(affine.affine.nBytesPerBias, structure);
+                writeBits(offsetFromBase(affine.affine.pWeights), structure);
+                writeBits(offsetFromBase(affine.affine.pBiases), structure);
                 writePwl(affine.pwl);
                 break;
             }
             case INTEL_CONVOLUTIONAL: {
                 auto &convolution = *reinterpret_cast<intel_convolutional_layer_t *>(layer.pLayerStruct);
-                writeBits(convolution.nFilterCoefficients, os);
-                writeBits(convolution.nBytesFilterCoefficient, os);
-                writeBits(convolution.nBytesBias, os);
-                writeBits(convolution.nFilters, os);
-                writeBits(convolution.nFeatureMaps, os);
-                writeBits(convolution.nFeatureMapRows, os);
-                writeBits(convolution.nFeatureMapColumns, os);
-                writeBits(convolution.nFilterRows, os);
-                writeBits(offsetFromBase(convolution.pFilters), os);
-                writeBits(offsetFromBase(convolution.pBiases), os);
-                writeBits(convolution.nPoolSize, os);
-                writeBits(convolution.nPoolStride, os);
-                writeBits(convolution.poolType, os);
+                writeBits(convolution.nFilterCoefficients, structure);
+                writeBits(convolution.nBytesFilterCoefficient, structure);
+                writeBits(convolution.nBytesBias, structure);
+                writeBits(convolution.nFilters, structure);
+                writeBits(convolution.nFeatureMaps, structure);
+                writeBits(convolution.nFeatureMapRows, structure);
+                writeBits(convolution.nFeatureMapColumns, structure);
+                writeBits(convolution.nFilterRows, structure);
+                writeBits(offsetFromBase(convolution.pFilters), structure);
+                writeBits(offsetFromBase(convolution.pBiases), structure);
+                writeBits(convolution.nPoolSize, structure);
+                writeBits(convolution.nPoolStride, structure);
+                writeBits(convolution.poolType, structure);
                 writePwl(convolution.pwl);
                 break;
             }
@@ -535,19 +613,18 @@ void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostrea
         }
 
         // writing offsets from base.
-        writeBits(offsetFromBase(layer.pInputs), os);
-        writeBits(offsetFromBase(layer.pOutputsIntermediate), os);
-        writeBits(offsetFromBase(layer.pOutputs), os);
+        writeBits(offsetFromBase(layer.pInputs), structure);
+        writeBits(offsetFromBase(layer.pOutputsIntermediate), structure);
+        writeBits(offsetFromBase(layer.pOutputs), structure);
     }
     // writing memory information
-    writeBits(static_cast<uint32_t>(states.size()), os);
+    writeBits(static_cast<uint32_t>(states.size()), structure);
     for (auto && state : states) {
-        writeBits(offsetFromBase(state.first), os);
-        writeBits(state.second, os);
+        writeBits(offsetFromBase(state.first), structure);
+        writeBits(state.second, structure);
     }
 
-    // once structure has been written lets push gna graph
-    os.write(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    writeModel(header, structure, basePointer, gnaGraphSize, os);
 }
 
 #endif
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <istream>
+#include <string>
 #include <vector>
 #include <utility>
 #include "gna-api.h"
@@ -20,13 +21,14 @@
  * 1.0 - basic support
  * 1.1 - added memory information
  * 2.0 - for use with GNA2 library
+ * 1.2, 2.1 - the GNA memory is page aligned in the file to be mapped on import
  */
 #if GNA_LIB_VER == 2
 #define HEADER_MAJOR 2
-#define HEADER_MINOR 0
+#define HEADER_MINOR 1
 #else
 #define HEADER_MAJOR 1
-#define HEADER_MINOR 1
+#define HEADER_MINOR 2
 #endif
 
 
@@ -96,6 +98,14 @@ struct ModelHeader {
     EndPoint input;
     EndPoint output;
 
+    /**
+     * @brief Offset in bytes of the GNA memory from the beginning of the model, it is page aligned
+     * since version 1.2 (2.1) and zero for the models of the previous versions
+     * @details the padding up to the aligned offset is a part of the header, so the readers
+     * of the previous versions skip it as the reserved data
+     */
+    uint64_t gnaMemOffset = 0ull;
+
     /**
      * Reserved Data might be here
      */
@@ -218,8 +228,18 @@ private:
      * @param ptr_nnet
      * @param basePointer
      * @param is - stream without header structure - TBD heder might be needed
+     * @param readMemory - if false the stream is left at the GNA memory, it is expected to be read with ImportMemory
+     */
+    void Import(void *basePointer, size_t gnaGraphSize, std::istream &is, bool readMemory = true);
+
+    /**
+     * @brief Reads the page aligned GNA memory of the model into preallocated buffer,
+     * the file is mapped instead of being read through the stream where it is supported
+     * @param basePointer
+     * @param header - header of the model with non zero gnaMemOffset
+     * @param modelFileName - file the model is imported from
      */
-    void Import(void *basePointer, size_t gnaGraphSize, std::istream &is);
+    static void ImportMemory(void *basePointer, const ModelHeader &header, const std::string &modelFileName);
 
     /**
      * save gna graph to an outpus stream
@@ -17,6 +17,7 @@
 #include <memory>
 #include <utility>
 #include <limits>
+#include <numeric>
 
 #include <low_precision_transformations/blob_transformation.hpp>
 #include <graph_tools.hpp>
@@ -79,11 +80,15 @@ void GNAPlugin::copyInputData(T *dst,
                 uint32_t num_vector_elements,
                 uint32_t num_vector_stride,
                 intel_dnn_orientation_t orientation,
-                float scaleFactor) {
+                float scaleFactor,
+                uint32_t num_frames_offset) {
     if (!dst || !src) {
         return;
     }
+    // frames before the offset are kept as is, the source starts from the frame at the offset
+    const uint32_t num_group_rest = num_group - num_frames_offset;
     if (orientation == kDnnInterleavedOrientation) {
+        dst += num_frames_offset;
         for (uint32_t i = 0; i < num_frames; i++) {
             for (uint32_t j = 0; j < num_vector_elements; j++) {
                 if (!std::is_same<T, U>::value) {
@@ -98,12 +103,13 @@ void GNAPlugin::copyInputData(T *dst,
             }
         }
         // pad partial group
-        for (uint32_t i = num_frames; i < num_group; i++) {
+        for (uint32_t i = num_frames; i < num_group_rest; i++) {
             for (uint32_t j = 0; j < num_vector_stride; j++) {
                 dst[j * num_group + i] = 0;
             }
         }
     } else {
+        dst += num_frames_offset * num_vector_stride;
         if (!std::is_same<T, U>::value) {
             for (uint32_t i = 0; i < num_frames; i++) {
                 T *ptr_dst_vec = reinterpret_cast<T *>(dst) + i * num_vector_stride;
@@ -124,7 +130,7 @@ void GNAPlugin::copyInputData(T *dst,
             }
         }
 
-        for (uint32_t i = num_frames; i < num_group; i++) {
+        for (uint32_t i = num_frames; i < num_group_rest; i++) {
             void *ptr_dst_vec = reinterpret_cast<uint8_t *>(dst) + i * num_vector_stride * sizeof(T);
             std::memset(ptr_dst_vec, 0, num_vector_stride * sizeof(T));
         }
@@ -249,26 +255,27 @@ void GNAPlugin::ImportFrames(
                   uint32_t num_frames,
                   uint32_t num_group,
                   uint32_t num_vector_elements,
-                  uint32_t num_vector_stride) {
+                  uint32_t num_vector_stride,
+                  uint32_t num_frames_offset) {
     if (orientation == kDnnInterleavedOrientation) {
         // TODO : fix that as well
         if (input_precision == Precision::U8) {
             auto src = reinterpret_cast<const uint8_t *>(ptr_src);
             auto dst = reinterpret_cast<int16_t *>(ptr_dst);
-            copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
+            copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor, num_frames_offset);
         } else if (input_precision.size() == 2) {
             auto dst = reinterpret_cast<int16_t *>(ptr_dst);
             auto src = reinterpret_cast<const int16_t *>(ptr_src);
-            copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
+            copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor, num_frames_offset);
         } else if (input_precision.size() == 4) {
             if (!gnadevice) {
                 auto dst = reinterpret_cast<float *>(ptr_dst);
                 auto src = reinterpret_cast<const float *>(ptr_src);
-                copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
+                copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor, num_frames_offset);
             } else {
                 auto dst = reinterpret_cast<int16_t *>(ptr_dst);
                 auto src = reinterpret_cast<const float *>(ptr_src);
-                copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
+                copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor, num_frames_offset);
             }
         }
     } else {
@@ -276,30 +283,57 @@ void GNAPlugin::ImportFrames(
             auto src = reinterpret_cast<const uint8_t *>(ptr_src);
             if (!gnadevice) {
                 auto dst = reinterpret_cast<float *>(ptr_dst);
-                copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
+                copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor, num_frames_offset);
             } else {
                 auto dst = reinterpret_cast<int16_t *>(ptr_dst);
-                copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
+                copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor, num_frames_offset);
             }
 
         } else if (input_precision.size()== 2) {
             auto dst = reinterpret_cast<int16_t *>(ptr_dst);
             auto src = reinterpret_cast<const int16_t *>(ptr_src);
-            copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
+            copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor, num_frames_offset);
         } else if (input_precision.size() == 4) {
             if (!gnadevice) {
                 auto dst = reinterpret_cast<float *>(ptr_dst);
                 auto src = reinterpret_cast<const float *>(ptr_src);
-                copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
+                copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor, num_frames_offset);
             } else {
                 auto dst = reinterpret_cast<uint16_t *>(ptr_dst);
                 auto src = reinterpret_cast<const float *>(ptr_src);
-                copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
+                copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor, num_frames_offset);
             }
         }
     }
 }
 
+void GNAPlugin::ShiftFrames(
+                  void *ptr_dst,
+                  const void *ptr_src,
+                  Precision input_precision,
+                  intel_dnn_orientation_t orientation,
+                  uint32_t num_frames,
+                  uint32_t num_group,
+                  uint32_t num_vector_stride,
+                  uint32_t num_frames_shift) {
+    // the same element types ImportFrames converts the inputs to
+    const size_t element_size = (gnadevice || input_precision.size() == 2 ||
+        (orientation == kDnnInterleavedOrientation && input_precision == Precision::U8)) ? 2 : 4;
+    auto dst = reinterpret_cast<uint8_t *>(ptr_dst);
+    auto src = reinterpret_cast<const uint8_t *>(ptr_src);
+    const uint32_t num_kept_frames = num_frames - num_frames_shift;
+    if (orientation == kDnnInterleavedOrientation) {
+        for (uint32_t j = 0; j < num_vector_stride; j++) {
+            std::memmove(dst + j * num_group * element_size,
+                         src + (j * num_group + num_frames_shift) * element_size,
+                         num_kept_frames * element_size);
+        }
+    } else {
+        std::memmove(dst, src + num_frames_shift * num_vector_stride * element_size,
+                     num_kept_frames * num_vector_stride * element_size);
+    }
+}
+
 GNAPlugin::GNAPlugin() {
     Init();
 }
@@ -321,12 +355,12 @@ void GNAPlugin::Init() {
 
 void GNAPlugin::InitGNADevice() {
 #if GNA_LIB_VER == 1
-    gnadevice = std::make_shared<GNADeviceHelper>(gna_proc_type,
+    gnadevice = GNADeviceHelper::getShared(gna_proc_type,
                                         gnaFlags->gna_lib_async_threads_num,
                                         gnaFlags->gna_openmp_multithreading,
                                         gnaFlags->performance_counting);
 #else
-    gnadevice = std::make_shared<GNADeviceHelper>(pluginGna2AccMode,
+    gnadevice = GNADeviceHelper::getShared(pluginGna2AccMode,
                 pluginGna2DeviceConsistent,
                 gnaFlags->gna_lib_async_threads_num,
                 gnaFlags->gna_openmp_multithreading,
@@ -373,6 +407,28 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
         passes->run();
     };
 
+    // scale factors of the inputs which are not set by the user fit the calibrated input ranges into int16
+    ICNNNetworkStats* stats = nullptr;
+    if (!gnaFlags->sw_fp32 && !inputsDesc->inputScaleFactorsFromConfig &&
+        network.getStats(&stats, nullptr) == StatusCode::OK && stats != nullptr && !stats->isEmpty()) {
+        InputsDataMap networkInputs;
+        network.getInputsInfo(networkInputs);
+        inputsDesc->inputScaleFactors.resize(std::max(inputsDesc->inputScaleFactors.size(), networkInputs.size()), 1.f);
+        int scaleIndex = 0;
+        for (auto && input : networkInputs) {
+            auto inputStats = stats->getNodesStats().find(input.first);
+            if (inputStats != stats->getNodesStats().end()) {
+                auto maxAbs = StatsMaxAbsValue(*inputStats->second);
+                if (maxAbs > 0.0f) {
+                    inputsDesc->inputScaleFactors[scaleIndex] = MAX_VAL_2B_FEAT / maxAbs;
+                    gnalog() << "input scale factor for " << input.first << " from statistics: "
+                             << inputsDesc->inputScaleFactors[scaleIndex] << "\n";
+                }
+            }
+            scaleIndex++;
+        }
+    }
+
     ICNNNetwork::Ptr newNet;
     if (gnaFlags->sw_fp32) {
         auto visitor = [&](InferenceEngine::CNNLayerPtr lp) {
@@ -752,7 +808,7 @@ void GNAPlugin::DumpXNNToFile() const {
         dumpStream.write(reinterpret_cast<char*>(&dump.header), sizeof(Gna2ModelSueCreekHeader));
         dumpStream.write(reinterpret_cast<char*>(dump.model.get()), dump.header.ModelSize);
     } else {
-        gnadevice->dumpXnnNoMmu(modelId, dumpStream);
+        gnadevice->dumpXnnNoMmu(modelId, dumpStream, gnamem->getBasePtr());
     }
     gnadevice->releseModel(modelId);
 #endif
@@ -785,28 +841,7 @@ void RotateFeatures(uint8_t *ptr_feat,
     }
 }
 
-uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, InferenceEngine::BlobMap &result) {
-#if GNA_LIB_VER == 2
-    auto& nnets = gnaRequestConfigToRequestIdMap;
-#endif
-    auto freeNnet = std::find_if(std::begin(nnets), std::end(nnets), [](decltype(nnets.front()) & item) {
-        return std::get<1>(item) == -1;
-    });
-
-    if (freeNnet == nnets.end()) {
-        if (!graphCompiler.memory_connection.empty()) {
-            Wait(0);
-            freeNnet = nnets.begin();
-        } else {
-            THROW_IE_EXCEPTION << as_status << REQUEST_BUSY
-                               << "GNA executable network has max of "
-                               << static_cast<uint32_t >(gnaFlags->gna_lib_async_threads_num)
-                               << " parallel infer requests, please sync one of already running";
-        }
-    }
-
-    auto idx = static_cast<uint32_t>(std::distance(std::begin(nnets), freeNnet));
-
+void GNAPlugin::ImportInputs(const InferenceEngine::BlobMap &inputs, uint32_t idx) {
     int inputNum = 0;
     for (auto &input : inputs) {
         auto inputLayout = input.second->getTensorDesc().getLayout();
@@ -843,21 +878,44 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
         }
 
         auto dims = input.second->getTensorDesc().getDims();
+        const uint32_t num_frames = dims[0];
+        const uint32_t num_group = is2D ? dims[dims.size() - 2] : dims[0];
+        const uint32_t num_vector_elements =
+            is2D ? dims[dims.size() - 1] : dims[dims.size() - 1] * dims[dims.size() - 2] * dims[dims.size() - 3];
+
+        bool isOneChannel = input.second->getTensorDesc().getDims()[1] == 1;
+        bool needsRotation = ((inputLayout == Layout::NC || inputLayout == Layout::NCHW)
+            != (inputsDesc->orientation_in[input.first] == kDnnInterleavedOrientation))
+            && !isOneChannel;
+
+        // in the streaming mode the frames the previous inference already imported are only moved
+        uint32_t num_frames_offset = 0;
+        if (gnaFlags->input_frames_shift != 0 && gnaFlags->input_frames_shift < num_frames &&
+            streaming_request_idx != -1 && !needsRotation) {
+            num_frames_offset = num_frames - gnaFlags->input_frames_shift;
+            ShiftFrames(inputsDesc->get_ptr_inputs_global(input.first)[idx],
+                        inputsDesc->get_ptr_inputs_global(input.first)[streaming_request_idx],
+                        input.second->getTensorDesc().getPrecision(),
+                        inputsDesc->orientation_in[input.first],
+                        num_frames,
+                        num_group,
+                        num_vector_elements,
+                        gnaFlags->input_frames_shift);
+        }
 
         ImportFrames(inputsDesc->get_ptr_inputs_global(input.first)[idx],
-                     input.second->cbuffer().as<float *>(),
+                     input.second->cbuffer().as<uint8_t *>() +
+                        num_frames_offset * num_vector_elements * input.second->element_size(),
                      input.second->getTensorDesc().getPrecision(),
                      gnaFlags->sw_fp32 ? 1.0f : inputsDesc->inputScaleFactors[inputNum],
                      inputsDesc->orientation_in[input.first],
-                     dims[0],
-                     is2D ? dims[dims.size() - 2] : dims[0],
-                     is2D ? dims[dims.size() - 1] : dims[dims.size() - 1] * dims[dims.size() - 2] * dims[dims.size() - 3],
-                     is2D ? dims[dims.size() - 1] : dims[dims.size() - 1] * dims[dims.size() - 2] * dims[dims.size() - 3]);
+                     num_frames - num_frames_offset,
+                     num_group,
+                     num_vector_elements,
+                     num_vector_elements,
+                     num_frames_offset);
 
-        bool isOneChannel = input.second->getTensorDesc().getDims()[1] == 1;
-        if (((inputLayout == Layout::NC || inputLayout == Layout::NCHW)
-            != (inputsDesc->orientation_in[input.first] == kDnnInterleavedOrientation))
-            && !isOneChannel) {
+        if (needsRotation) {
             RotateFeatures(reinterpret_cast<uint8_t *>(inputsDesc->get_ptr_inputs_global(input.first)[idx]),
                            gnadevice ? 2 : 4,
                            // TODO: only works for cnn4a and google command so far
@@ -868,22 +926,176 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
         }
         ++inputNum;
     }
+}
 
-    if (!gnadevice) {
-        dnn->Propagate();
-        if (freeNnet != nnets.end()) {
-            std::get<1>(*freeNnet) = 1;
-        }
+void GNAPlugin::CheckActiveOutputs(const InferenceEngine::Blob::Ptr &activeOutputs) const {
+    if (activeOutputs == nullptr || activeOutputs->size() == 0) {
+        return;
+    }
+    const auto &desc = activeOutputs->getTensorDesc();
+    if (desc.getPrecision() != Precision::I32 && desc.getPrecision() != Precision::U32) {
+        THROW_GNA_EXCEPTION << "Active outputs blob should have I32 or U32 precision, but was: " << desc.getPrecision();
+    }
+    if (desc.getDims().size() != 1) {
+        THROW_GNA_EXCEPTION << "Active outputs blob should be 1D, but has " << desc.getDims().size() << " dimensions";
+    }
+    if (outputsDataMap.size() != 1 || outputsDesc.size() != 1) {
+        THROW_GNA_EXCEPTION << "Active outputs are supported for networks with one output, but network has "
+                            << outputsDataMap.size();
+    }
+
+    bool affineOutput = false;
+    if (gnadevice) {
+#if GNA_LIB_VER == 2
+        const auto &model = std::get<0>(gnaModels.front())->obj;
+        affineOutput = model.NumberOfOperations != 0 &&
+            model.Operations[model.NumberOfOperations - 1].Type == Gna2OperationTypeFullyConnectedAffine;
+#else
+        const auto &nnet = std::get<0>(nnets.front())->obj;
+        affineOutput = nnet.nLayers != 0 && nnet.pLayers[nnet.nLayers - 1].nLayerKind == INTEL_AFFINE;
+#endif
     } else {
+        affineOutput = !dnn->component.empty() && dnn->component.back().operation == kDnnAffineOp;
+    }
+    if (!affineOutput || outputsDesc.front().orientation != kDnnInterleavedOrientation) {
+        THROW_GNA_EXCEPTION << "Active outputs are supported for networks which output is produced by an affine layer";
+    }
+
+    const auto num_elements = outputsDataMap.begin()->second->getTensorDesc().getDims().back();
+    if (activeOutputs->size() > num_elements) {
+        THROW_GNA_EXCEPTION << "Active outputs blob has " << activeOutputs->size()
+                            << " indices, but output has " << num_elements << " elements";
+    }
+    auto indices = activeOutputs->cbuffer().as<const uint32_t *>();
+    for (size_t i = 0; i < activeOutputs->size(); i++) {
+        if (indices[i] >= num_elements) {
+            THROW_GNA_EXCEPTION << "Active output index " << static_cast<int32_t>(indices[i])
+                                << " is out of output elements range [0, " << num_elements << ")";
+        }
+    }
+}
+
+void GNAPlugin::SetActiveOutputs(const InferenceEngine::Blob::Ptr &activeOutputs, uint32_t idx) {
+    auto &indices = requestActiveOutputs[idx].indices;
+    if (activeOutputs == nullptr || activeOutputs->size() == 0) {
+        indices.clear();
+        return;
+    }
+    CheckActiveOutputs(activeOutputs);
+    auto ptr_indices = activeOutputs->cbuffer().as<const uint32_t *>();
+    indices.assign(ptr_indices, ptr_indices + activeOutputs->size());
+}
+
+void GNAPlugin::PackActiveOutputs(void *ptr_outputs,
+                                  uint32_t num_group,
+                                  uint32_t num_bytes_per_element,
+                                  const std::vector<uint32_t> &indices) {
+    // outputs are interleaved, so all the frames of an element are contiguous
+    const size_t row_size = num_group * num_bytes_per_element;
+    auto ptr_dst = reinterpret_cast<uint8_t *>(ptr_outputs);
+    const auto num_rows = *std::max_element(indices.begin(), indices.end()) + 1;
+    const std::vector<uint8_t> outputs(ptr_dst, ptr_dst + num_rows * row_size);
+    for (size_t i = 0; i < indices.size(); i++) {
+        std::memcpy(ptr_dst + i * row_size, outputs.data() + indices[i] * row_size, row_size);
+    }
+}
+
+uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, InferenceEngine::BlobMap &result,
+                                   const InferenceEngine::Blob::Ptr &activeOutputs) {
+#if GNA_LIB_VER == 2
+    auto& nnets = gnaRequestConfigToRequestIdMap;
+#endif
+    std::unique_lock<std::mutex> lock(queueMutex);
+    auto freeNnet = std::find_if(std::begin(nnets), std::end(nnets), [](decltype(nnets.front()) & item) {
+        return std::get<1>(item) == -1;
+    });
+
+    while (freeNnet == nnets.end()) {
+        if (!graphCompiler.memory_connection.empty()) {
+            lock.unlock();
+            Wait(0);
+            lock.lock();
+            freeNnet = std::find_if(std::begin(nnets), std::end(nnets), [](decltype(nnets.front()) & item) {
+                return std::get<1>(item) == -1;
+            });
+        } else {
+            THROW_IE_EXCEPTION << as_status << REQUEST_BUSY
+                               << "GNA executable network has max of "
+                               << static_cast<uint32_t >(gnaFlags->gna_lib_async_threads_num)
+                               << " parallel infer requests, please sync one of already running";
+        }
+    }
+
+    auto idx = static_cast<uint32_t>(std::distance(std::begin(nnets), freeNnet));
+
+    // once the request is reserved, its inputs are imported into own buffers while other requests are queued,
+    // stateful and streaming networks depend on the previous inference so they are imported in the order of issuing
+    std::get<1>(*freeNnet) = RESERVED_REQUEST_ID;
+    if (requestActiveOutputs.size() != nnets.size()) {
+        requestActiveOutputs.resize(nnets.size());
+    }
+    if (graphCompiler.memory_connection.empty() && gnaFlags->input_frames_shift == 0 && gnadevice) {
+        lock.unlock();
+    }
+
+    try {
+        ImportInputs(inputs, idx);
+        SetActiveOutputs(activeOutputs, idx);
+        auto &active = requestActiveOutputs[idx];
+
+        if (!lock.owns_lock()) {
+            lock.lock();
+        }
+        streaming_request_idx = idx;
+
+        if (!gnadevice) {
+            dnn->Propagate();
+            if (gnaFlags->collect_statistics) {
+                CollectStatistics(inputs);
+            }
+            if (!active.indices.empty()) {
+                const auto &dims = result.begin()->second->getTensorDesc().getDims();
+                PackActiveOutputs(outputsDesc.front().ptrs[idx],
+                                  dims[dims.size() - 2],
+                                  outputsDesc.front().num_bytes_per_element,
+                                  active.indices);
+            }
+            if (freeNnet != nnets.end()) {
+                std::get<1>(*freeNnet) = 1;
+            }
+        } else {
 #if GNA_LIB_VER == 1
-        auto nnet = std::get<0>(*freeNnet).get();
-        std::get<1>(*freeNnet) = gnadevice->propagate(&nnet->obj, ptr_active_indices, num_active_indices);
+            auto nnet = std::get<0>(*freeNnet).get();
+            if (!active.indices.empty()) {
+                std::get<1>(*freeNnet) = gnadevice->propagate(&nnet->obj, active.indices.data(),
+                                                              static_cast<uint32_t>(active.indices.size()));
+            } else {
+                std::get<1>(*freeNnet) = gnadevice->propagate(&nnet->obj, ptr_active_indices, num_active_indices);
+            }
 #else
-        const auto reqConfigId = std::get<0>(*freeNnet);
-        if (ptr_active_indices != nullptr && num_active_indices > 0 && activeLayerIndex != 0xffffffff)
-            gnadevice->setUpActiveList(reqConfigId, activeLayerIndex, ptr_active_indices, num_active_indices);
-        std::get<1>(*freeNnet) = gnadevice->propagate(reqConfigId);
+            const auto reqConfigId = std::get<0>(*freeNnet);
+            if (!active.indices.empty() || active.listEnabled) {
+                // the list cannot be disabled in the request config, so all the elements are listed instead
+                if (active.indices.empty()) {
+                    active.indices.resize(outputsDataMap.begin()->second->getTensorDesc().getDims().back());
+                    std::iota(active.indices.begin(), active.indices.end(), 0);
+                }
+                const auto &model = std::get<0>(gnaModels.front())->obj;
+                gnadevice->setUpActiveList(reqConfigId, model.NumberOfOperations - 1,
+                                           active.indices.data(), static_cast<uint32_t>(active.indices.size()));
+                active.listEnabled = true;
+            } else if (ptr_active_indices != nullptr && num_active_indices > 0 && activeLayerIndex != 0xffffffff) {
+                gnadevice->setUpActiveList(reqConfigId, activeLayerIndex, ptr_active_indices, num_active_indices);
+            }
+            std::get<1>(*freeNnet) = gnadevice->propagate(reqConfigId);
 #endif
+        }
+    } catch (...) {
+        if (!lock.owns_lock()) {
+            lock.lock();
+        }
+        std::get<1>(*freeNnet) = -1;
+        throw;
     }
 
 #ifdef PLOT
@@ -910,9 +1122,26 @@ void GNAPlugin::Wait(uint32_t request_idx) {
 
     if (gnadevice) {
         gnadevice->wait(std::get<1>(nnets[request_idx]));
+        if (gnaFlags->performance_counting) {
+            uint64_t totalCycles = 0, stallCycles = 0;
+            gnadevice->getGnaPerfCycles(totalCycles, stallCycles);
+            std::lock_guard<std::mutex> lock(perfCyclesMutex);
+            perfCycles.emplace_back(totalCycles, stallCycles);
+            while (perfCycles.size() > std::max<uint32_t>(1, gnaFlags->perf_count_window)) {
+                perfCycles.pop_front();
+            }
+        }
     }
 
-    std::get<1>(nnets[request_idx]) = -1;
+    // the request is released once its outputs are exported, so a request queued meanwhile does not overwrite them
+    struct RequestRelease {
+        std::mutex &mutex;
+        decltype(std::get<1>(nnets[request_idx])) state;
+        ~RequestRelease() {
+            std::lock_guard<std::mutex> lock(mutex);
+            state = -1;
+        }
+    } release {queueMutex, std::get<1>(nnets[request_idx])};
     auto &request = std::get<2>(nnets[request_idx]);
 #ifdef PLOT
     if (dnn->num_components() != 0) {
@@ -924,6 +1153,9 @@ void GNAPlugin::Wait(uint32_t request_idx) {
     dnn->WriteInputAndOutputTextGNA(std::get<0>(gnaModels[request_idx])->obj);
 #endif
 #endif
+    // with the active outputs only the listed elements are computed, packed to the beginning of every frame
+    const auto numActiveOutputs = requestActiveOutputs.size() > request_idx ?
+        static_cast<uint32_t>(requestActiveOutputs[request_idx].indices.size()) : 0u;
     int output_idx = 0;
     for (auto && outputBlobIt : request) {
         auto & outputBlob = outputBlobIt.second;
@@ -951,7 +1183,7 @@ void GNAPlugin::Wait(uint32_t request_idx) {
                          exportOutputDims[0],
                          exportOutputDims[exportOutputDims.size() - 2],
                          exportOutputDims[exportOutputDims.size() - 1],
-                         exportOutputDims[exportOutputDims.size() - 1],
+                         numActiveOutputs == 0 ? exportOutputDims[exportOutputDims.size() - 1] : numActiveOutputs,
                          exportOutputDims[exportOutputDims.size() - 1],
                          outputDesc.num_bytes_per_element,
                          sizeof(float));
@@ -1001,8 +1233,110 @@ void GNAPlugin::Wait(uint32_t request_idx) {
     }
 }
 
+void GNAPlugin::CollectStatistics(const InferenceEngine::BlobMap &inputs) {
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    auto update = [this](const std::string &name, const float *values, size_t size) {
+        if (values == nullptr || size == 0) {
+            return;
+        }
+        auto &layerStats = layerStatistics[name];
+        if (!layerStats) {
+            layerStats = std::make_shared<NetworkNodeStats>(1);
+            layerStats->_minOutputs[0] = std::numeric_limits<float>::max();
+            layerStats->_maxOutputs[0] = std::numeric_limits<float>::lowest();
+        }
+        auto range = std::minmax_element(values, values + size);
+        layerStats->_minOutputs[0] = std::min(layerStats->_minOutputs[0], *range.first);
+        layerStats->_maxOutputs[0] = std::max(layerStats->_maxOutputs[0], *range.second);
+    };
+
+    for (auto && input : inputs) {
+        if (input.second->getTensorDesc().getPrecision() == Precision::FP32) {
+            update(input.first, input.second->cbuffer().as<const float *>(), input.second->size());
+        }
+    }
+
+    // components of the model follow the order they were created by the graph compiler in
+    auto component = dnn->component.begin();
+    for (auto && element : graphCompiler.dnnComponents.components) {
+        if (component == dnn->component.end()) {
+            break;
+        }
+        update(element.first, reinterpret_cast<const float *>(component->ptr_outputs),
+               static_cast<size_t>(component->num_rows_out) * component->num_columns_out);
+        ++component;
+    }
+}
+
+InferenceEngine::ITaskExecutor::Ptr GNAPlugin::GetImportExecutor() {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    if (importExecutors.empty()) {
+        for (int i = 0; i != gnaFlags->gna_lib_async_threads_num; i++) {
+            importExecutors.push_back(std::make_shared<TaskExecutor>("GNAImport" + std::to_string(i)));
+        }
+    }
+    return importExecutors[nextImportExecutor++ % importExecutors.size()];
+}
+
 void GNAPlugin::Reset() {
     graphCompiler.Reset();
+    // the input stream starts over together with the memory states
+    streaming_request_idx = -1;
+}
+
+uint32_t GNAPlugin::StreamsNum() const {
+    if (inputsDataMap.empty()) {
+        return 1;
+    }
+    return static_cast<uint32_t>(inputsDataMap.begin()->second->getTensorDesc().getDims().front());
+}
+
+void GNAPlugin::ResetStream(uint32_t stream) {
+    graphCompiler.ResetStream(stream, StreamsNum());
+}
+
+Blob::Ptr GNAPlugin::GetStreamState(uint32_t stream) const {
+    const auto num_streams = StreamsNum();
+    const size_t element_size = gnaFlags->sw_fp32 ? 4 : 2;
+    size_t num_elements = 0;
+    for (auto && memory : graphCompiler.memory_connection) {
+        num_elements += memory.second.stateSizeBytes() / element_size / num_streams;
+    }
+
+    auto state = make_blob_with_precision(TensorDesc(gnaFlags->sw_fp32 ? Precision::FP32 : Precision::I16, {num_elements}, C));
+    state->allocate();
+    // the streams are the interleaved columns of the memory buffers
+    auto dst = state->buffer().as<uint8_t *>();
+    for (auto && memory : graphCompiler.memory_connection) {
+        auto src = reinterpret_cast<const uint8_t *>(memory.second.gna_ptr);
+        const auto num_rows = memory.second.stateSizeBytes() / element_size / num_streams;
+        for (size_t i = 0; i < num_rows; i++, dst += element_size) {
+            std::memcpy(dst, src + (i * num_streams + stream) * element_size, element_size);
+        }
+    }
+    return state;
+}
+
+void GNAPlugin::SetStreamState(uint32_t stream, const Blob::Ptr &state) {
+    const auto num_streams = StreamsNum();
+    const size_t element_size = gnaFlags->sw_fp32 ? 4 : 2;
+    size_t num_elements = 0;
+    for (auto && memory : graphCompiler.memory_connection) {
+        num_elements += memory.second.stateSizeBytes() / element_size / num_streams;
+    }
+    if (!state || state->size() != num_elements || state->element_size() != element_size) {
+        THROW_GNA_EXCEPTION << "State of stream " << stream << " should have " << num_elements << " elements of "
+                            << element_size << " bytes, as returned by GetLastState()";
+    }
+
+    auto src = state->cbuffer().as<const uint8_t *>();
+    for (auto && memory : graphCompiler.memory_connection) {
+        auto dst = reinterpret_cast<uint8_t *>(memory.second.gna_ptr);
+        const auto num_rows = memory.second.stateSizeBytes() / element_size / num_streams;
+        for (size_t i = 0; i < num_rows; i++, src += element_size) {
+            std::memcpy(dst + (i * num_streams + stream) * element_size, src, element_size);
+        }
+    }
 }
 
 void GNAPlugin::Infer(const InferenceEngine::Blob &input, InferenceEngine::Blob &output) {
@@ -1019,8 +1353,9 @@ void GNAPlugin::Infer(const InferenceEngine::Blob &input, InferenceEngine::Blob
     Infer(bmInput, bmOutput);
 }
 
-void GNAPlugin::Infer(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result) {
-    Wait(QueueInference(input, result));
+void GNAPlugin::Infer(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result,
+                      const InferenceEngine::Blob::Ptr &activeOutputs) {
+    Wait(QueueInference(input, result, activeOutputs));
 }
 
 Blob::Ptr GNAPlugin::GetOutputBlob(const std::string& name, InferenceEngine::Precision precision) {
@@ -1047,6 +1382,14 @@ std::vector<InferenceEngine::MemoryStateInternal::Ptr>  GNAPlugin::QueryState()
         return {};
     }
 
+    if (gnaFlags->batch_streams) {
+        std::vector<InferenceEngine::MemoryStateInternal::Ptr> states;
+        for (uint32_t stream = 0; stream < StreamsNum(); stream++) {
+            states.push_back(std::make_shared<memory::GNAMemoryState>(shared_from_this(), stream));
+        }
+        return states;
+    }
+
     return {std::make_shared<memory::GNAMemoryState>(shared_from_this())};
 }
 
@@ -1085,7 +1428,13 @@ InferenceEngine::IExecutableNetwork::Ptr GNAPlugin::ImportNetwork(const std::str
 #else
     auto serial = GNAModelSerial(&std::get<0>(nnets.back())->obj, mt);
 #endif
-    serial.Import(basePtr, header.gnaMemSize, inputStream);
+    // the page aligned memory is mapped from the file rather than read through the stream
+    const bool mapMemory = header.gnaMemOffset != 0;
+    serial.Import(basePtr, header.gnaMemSize, inputStream, !mapMemory);
+    if (mapMemory) {
+        inputStream.close();
+        GNAModelSerial::ImportMemory(basePtr, header, modelFileName);
+    }
 
     inputsDesc->get_ptr_inputs_global("input").push_back(reinterpret_cast<float*>(reinterpret_cast<uint8_t *> (basePtr) + header.input.descriptor_offset));
     // TODO: import of multioutput network not supported
@@ -1195,9 +1544,117 @@ void GNAPlugin::Export(const std::string &fileName) {
     serial.Export(gnamem->getBasePtr(), gnamem->getTotalBytes(), outStream);
 }
 
+namespace {
+uint64_t ComponentMemoryTraffic(const intel_dnn_component_t &component) {
+    uint64_t bytes = static_cast<uint64_t>(component.num_rows_in) * component.num_columns_in * component.num_bytes_per_input +
+        static_cast<uint64_t>(component.num_rows_out) * component.num_columns_out * component.num_bytes_per_output;
+    switch (component.operation) {
+        case kDnnAffineOp:
+            bytes += static_cast<uint64_t>(component.num_rows_out) * component.num_rows_in * component.op.affine.num_bytes_per_weight +
+                static_cast<uint64_t>(component.num_rows_out) * component.op.affine.num_bytes_per_bias;
+            break;
+        case kDnnDiagonalOp:
+            bytes += static_cast<uint64_t>(component.num_rows_out) *
+                (component.op.affine.num_bytes_per_weight + component.op.affine.num_bytes_per_bias);
+            break;
+        case kDnnConvolutional1dOp:
+            bytes += static_cast<uint64_t>(component.op.conv1D.num_filters) *
+                (component.op.conv1D.num_filter_coefficients * component.op.conv1D.num_bytes_per_weight +
+                 component.op.conv1D.num_bytes_per_bias);
+            break;
+        case kDnnRecurrentOp:
+            bytes += static_cast<uint64_t>(component.num_columns_out) * (component.num_columns_in + component.num_columns_out) *
+                component.op.recurrent.num_bytes_per_weight +
+                static_cast<uint64_t>(component.num_columns_out) * component.op.recurrent.num_bytes_per_bias;
+            break;
+        case kDnnPiecewiselinearOp:
+            bytes += static_cast<uint64_t>(component.op.pwl.num_segments) * sizeof(intel_pwl_segment_t);
+            break;
+        default:
+            break;
+    }
+    return bytes;
+}
+}  // namespace
+
+std::map<std::string, uint64_t> GNAPlugin::LayersMemoryTraffic() const {
+    std::map<std::string, uint64_t> traffic;
+    // components of the model follow the order they were created by the graph compiler in
+    auto component = dnn->component.begin();
+    for (auto && element : graphCompiler.dnnComponents.components) {
+        if (component == dnn->component.end()) {
+            break;
+        }
+        traffic[element.first] += ComponentMemoryTraffic(*component);
+        ++component;
+    }
+    return traffic;
+}
+
 void GNAPlugin::GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) {
-    if (gnaFlags->performance_counting) {
-        gnadevice->getGnaPerfCounters(perfMap);
+    if (!gnaFlags->performance_counting || !gnadevice) {
+        return;
+    }
+    gnadevice->getGnaPerfCounters(perfMap);
+
+    uint64_t totalCycles = 0, stallCycles = 0, maxTotalCycles = 0, maxStallCycles = 0;
+    {
+        std::lock_guard<std::mutex> lock(perfCyclesMutex);
+        if (perfCycles.empty()) {
+            return;
+        }
+        for (auto && cycles : perfCycles) {
+            totalCycles += cycles.first;
+            stallCycles += cycles.second;
+            maxTotalCycles = std::max(maxTotalCycles, cycles.first);
+            maxStallCycles = std::max(maxStallCycles, cycles.second);
+        }
+        totalCycles /= perfCycles.size();
+        stallCycles /= perfCycles.size();
+    }
+
+    InferenceEngine::InferenceEngineProfileInfo info = {};
+    info.status = InferenceEngine::InferenceEngineProfileInfo::EXECUTED;
+    info.realTime_uSec = totalCycles;
+    perfMap["1.1 Total scoring time in HW"] = info;
+    info.realTime_uSec = stallCycles;
+    perfMap["1.2 Stall scoring time in HW"] = info;
+    if (gnaFlags->perf_count_window > 1) {
+        info.realTime_uSec = maxTotalCycles;
+        perfMap["1.3 Max total scoring time in HW"] = info;
+        info.realTime_uSec = maxStallCycles;
+        perfMap["1.4 Max stall scoring time in HW"] = info;
+    }
+
+    // the library measures whole requests only, so the scoring time is split between the layers by the memory
+    // they move, which bounds the time of GNA layers
+    const auto traffic = LayersMemoryTraffic();
+    uint64_t totalTraffic = 0;
+    for (auto && layer : traffic) {
+        totalTraffic += layer.second;
+    }
+    if (totalTraffic == 0) {
+        return;
+    }
+    unsigned executionIndex = 0;
+    auto component = dnn->component.begin();
+    for (auto && element : graphCompiler.dnnComponents.components) {
+        if (component == dnn->component.end()) {
+            break;
+        }
+        if (perfMap.count(element.first) == 0) {
+            InferenceEngine::InferenceEngineProfileInfo layerInfo = {};
+            layerInfo.status = InferenceEngine::InferenceEngineProfileInfo::EXECUTED;
+            layerInfo.realTime_uSec = static_cast<long long>(
+                static_cast<double>(totalCycles) * traffic.at(element.first) / totalTraffic);
+            layerInfo.execution_index = executionIndex++;
+            std::string execType = "gna_estimated";
+            execType.copy(layerInfo.exec_type, sizeof(layerInfo.exec_type) - 1, 0);
+            std::string layerType = intel_dnn_operation_name[component->operation];
+            layerType.copy(layerInfo.layer_type, sizeof(layerInfo.layer_type) - 1, 0);
+            perfMap[element.first] = layerInfo;
+        }
+        ++component;
     }
 }
 
@@ -1259,6 +1716,7 @@ void GNAPlugin::SetConfig(const std::map<std::string, std::string> &config) {
             inputsDesc->inputScaleFactors.resize(scaleForInput + 1, 1.f);
         }
         inputsDesc->inputScaleFactors[scaleForInput] = InferenceEngine::CNNLayer::ie_parse_float(value);
+        inputsDesc->inputScaleFactorsFromConfig = true;
     });
 
     if (inputsDesc->inputScaleFactors.empty()) {
@@ -1268,6 +1726,7 @@ void GNAPlugin::SetConfig(const std::map<std::string, std::string> &config) {
                 THROW_GNA_EXCEPTION << "input scale factor of 0.0f not supported";
             }
             inputsDesc->inputScaleFactors.push_back(scaleFactor);
+            inputsDesc->inputScaleFactorsFromConfig = true;
         });
     }
 
@@ -1410,6 +1869,24 @@ void GNAPlugin::SetConfig(const std::map<std::string, std::string> &config) {
         gnaFlags->gna_lib_async_threads_num = lib_threads;
     });
 
+    if_set(GNA_CONFIG_KEY(INPUT_FRAMES_SHIFT), [&] {
+        uint64_t frames_shift = std::stoul(value, NULL, 10);
+        if (frames_shift > std::numeric_limits<uint32_t>::max()) {
+            log << "Unsupported number of input frames shift: " << value;
+            THROW_GNA_EXCEPTION << "Unsupported number of input frames shift: " << value;
+        }
+        gnaFlags->input_frames_shift = static_cast<uint32_t>(frames_shift);
+    });
+
+    if_set(GNA_CONFIG_KEY(PERF_COUNT_WINDOW), [&] {
+        uint64_t window = std::stoul(value, NULL, 10);
+        if (window > std::numeric_limits<uint32_t>::max()) {
+            log << "Unsupported performance counters window: " << value;
+            THROW_GNA_EXCEPTION << "Unsupported performance counters window: " << value;
+        }
+        gnaFlags->perf_count_window = static_cast<uint32_t>(window);
+    });
+
     if_set(CONFIG_KEY(SINGLE_THREAD), [&] {
         if (value == PluginConfigParams::YES) {
             gnaFlags->gna_openmp_multithreading  = false;
@@ -1421,9 +1898,39 @@ void GNAPlugin::SetConfig(const std::map<std::string, std::string> &config) {
         }
     });
 
+    if_set(GNA_CONFIG_KEY(COLLECT_STATISTICS), [&] {
+        if (value == PluginConfigParams::YES) {
+            gnaFlags->collect_statistics = true;
+        } else if (value == PluginConfigParams::NO) {
+            gnaFlags->collect_statistics = false;
+        } else {
+            log << "GNA statistics collection parameter should be equal to YES/NO, but not" << value;
+            THROW_GNA_EXCEPTION << "GNA statistics collection parameter should be equal to YES/NO, but not" << value;
+        }
+    });
+
+    if_set(GNA_CONFIG_KEY(BATCH_STREAMS), [&] {
+        if (value == PluginConfigParams::YES) {
+            gnaFlags->batch_streams = true;
+        } else if (value == PluginConfigParams::NO) {
+            gnaFlags->batch_streams = false;
+        } else {
+            log << "GNA batch streams parameter should be equal to YES/NO, but not" << value;
+            THROW_GNA_EXCEPTION << "GNA batch streams parameter should be equal to YES/NO, but not" << value;
+        }
+    });
+
+    if (gnaFlags->batch_streams && gnaFlags->input_frames_shift != 0) {
+        THROW_GNA_EXCEPTION << "GNA plugin does not support GNA_BATCH_STREAMS together with GNA_INPUT_FRAMES_SHIFT";
+    }
+
     if (gnaFlags->sw_fp32 && gnaFlags->gna_lib_async_threads_num > 1) {
         THROW_GNA_EXCEPTION << "GNA plugin not support async mode on GNA_SW_FP32!";
     }
+
+    if (gnaFlags->collect_statistics && !gnaFlags->sw_fp32) {
+        THROW_GNA_EXCEPTION << "GNA plugin collects statistics on GNA_SW_FP32 only!";
+    }
 }
 
 void GNAPlugin::QueryNetwork(const InferenceEngine::ICNNNetwork& network,
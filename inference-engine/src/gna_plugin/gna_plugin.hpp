@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <deque>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <list>
 #include <string>
@@ -14,6 +16,8 @@
 #include <tuple>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include <cpp_interfaces/interface/ie_imemory_state_internal.hpp>
+#include <cpp_interfaces/ie_task_executor.hpp>
+#include <ie_icnn_network_stats.hpp>
 #include "descriptions/gna_flags.hpp"
 #include "descriptions/gna_input_desc.hpp"
 #include "descriptions/gna_output_desc.hpp"
@@ -49,6 +53,29 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
     std::vector<std::tuple<dnn_ptr>> gnaModels;
     std::vector<std::tuple<uint32_t, int64_t, InferenceEngine::BlobMap>> gnaRequestConfigToRequestIdMap;
 #endif
+    /**
+     * @brief - state of the request which inputs are being imported, it is neither free(-1) nor propagated yet
+     */
+    static constexpr int32_t RESERVED_REQUEST_ID = -2;
+    /**
+     * @brief - guards the states of the requests, inputs of different requests are imported without holding it
+     */
+    std::mutex queueMutex;
+    /**
+     * @brief - LIB_N_THREADS executors the import stages of asynchronous requests run on in turn
+     */
+    std::vector<InferenceEngine::ITaskExecutor::Ptr> importExecutors;
+    uint32_t nextImportExecutor = 0;
+    /**
+     * @brief - min and max output values of layers collected in the GNA_SW_FP32 mode
+     */
+    InferenceEngine::NetworkStatsMap layerStatistics;
+    mutable std::mutex statisticsMutex;
+    /**
+     * @brief - hardware total and stall cycles of the last GNA_PERF_COUNT_WINDOW inferences
+     */
+    std::deque<std::pair<uint64_t, uint64_t>> perfCycles;
+    std::mutex perfCyclesMutex;
 
 #if GNA_LIB_VER == 2
     uint32_t activeLayerIndex = 0xffffffff;
@@ -59,6 +86,20 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
     uint32_t num_active_indices = 0;
     uint32_t num_group_in = 0;
     uint32_t dnn_dump_write_index = 0;
+    /**
+     * @brief - index of the infer request which inputs the next one shifts in the streaming input mode, -1 if none
+     */
+    int32_t streaming_request_idx = -1;
+    /**
+     * @brief - output elements the request slots compute, set with GNA_CONFIG_VALUE(ACTIVE_OUTPUTS)
+     */
+    struct ActiveOutputs {
+        // empty if all the elements are computed
+        std::vector<uint32_t> indices;
+        // GNA2: the active list stays enabled in the request config once it is set up
+        bool listEnabled = false;
+    };
+    std::vector<ActiveOutputs> requestActiveOutputs;
 
     // index matches iterating order of cnnnetwork outputs info
     std::vector<GNAPluginNS::OutputDesc> outputsDesc = std::vector<OutputDesc>();
@@ -100,7 +141,8 @@ void createRequestConfigsForGnaModels();
 
     void LoadNetwork(InferenceEngine::ICNNNetwork &network);
 
-    void Infer(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result);
+    void Infer(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result,
+               const InferenceEngine::Blob::Ptr &activeOutputs = nullptr);
     void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap);
     void AddExtension(InferenceEngine::IExtensionPtr extension) override;
 
@@ -119,11 +161,37 @@ void createRequestConfigsForGnaModels();
     void SetCore(InferenceEngine::ICore*) noexcept override {}
     const InferenceEngine::ICore* GetCore() const noexcept override {return nullptr;}
     void Reset();
+    /**
+     * @brief number of the streams the batch holds in GNA_BATCH_STREAMS mode
+     */
+    uint32_t StreamsNum() const;
+    void ResetStream(uint32_t stream);
+    /**
+     * @brief gathers the memory states of the stream, the states of all memory layers follow each other;
+     * should be called between inferences
+     */
+    InferenceEngine::Blob::Ptr GetStreamState(uint32_t stream) const;
+    /**
+     * @brief scatters the state gathered with GetStreamState() into the memory of the stream
+     */
+    void SetStreamState(uint32_t stream, const InferenceEngine::Blob::Ptr &state);
     void QueryNetwork(const InferenceEngine::ICNNNetwork &network,
                       const std::map<std::string, std::string>& config,
                       InferenceEngine::QueryNetworkResult &res) const override;
-    uint32_t QueueInference(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result);
+    /**
+     * @brief queues the inference of the inputs, only the elements of the output listed in activeOutputs are computed if it is set
+     */
+    uint32_t QueueInference(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result,
+                            const InferenceEngine::Blob::Ptr &activeOutputs = nullptr);
+    /**
+     * @brief checks that the blob is a valid GNA_CONFIG_VALUE(ACTIVE_OUTPUTS) list for the loaded network
+     */
+    void CheckActiveOutputs(const InferenceEngine::Blob::Ptr &activeOutputs) const;
     void Wait(uint32_t idx = 0);
+    /**
+     * @brief executor to import the inputs and queue an asynchronous request on, so the caller does not wait for that
+     */
+    InferenceEngine::ITaskExecutor::Ptr GetImportExecutor();
 
     InferenceEngine::Parameter GetConfig(const std::string& name,
                                          const std::map<std::string, InferenceEngine::Parameter> & options) const override;
@@ -179,6 +247,35 @@ void createRequestConfigsForGnaModels();
 
     void DumpXNNToFile() const;
 
+    /**
+     * @brief imports the inputs into the buffers of the reserved request
+     */
+    void ImportInputs(const InferenceEngine::BlobMap &inputs, uint32_t idx);
+
+    /**
+     * @brief sets the output elements the reserved request computes
+     */
+    void SetActiveOutputs(const InferenceEngine::Blob::Ptr &activeOutputs, uint32_t idx);
+
+    /**
+     * @brief packs the listed elements of the interleaved outputs computed in full to the beginning of the buffer,
+     * the way the device writes the outputs of an active list
+     */
+    static void PackActiveOutputs(void *ptr_outputs,
+                                  uint32_t num_group,
+                                  uint32_t num_bytes_per_element,
+                                  const std::vector<uint32_t> &indices);
+
+    /**
+     * @brief updates the layer statistics with the inputs and the outputs of all components of the floating point model
+     */
+    void CollectStatistics(const InferenceEngine::BlobMap &inputs);
+
+    /**
+     * @brief bytes of GNA memory every layer of the model reads and writes per inference
+     */
+    std::map<std::string, uint64_t> LayersMemoryTraffic() const;
+
     void ImportFrames(void *ptr_dst,
                      const void *ptr_src,
                      InferenceEngine::Precision input_precision,
@@ -187,7 +284,20 @@ void createRequestConfigsForGnaModels();
                      uint32_t num_frames,
                      uint32_t num_group,
                      uint32_t num_vector_elements,
-                     uint32_t num_vector_stride);
+                     uint32_t num_vector_stride,
+                     uint32_t num_frames_offset = 0);
+
+    /**
+     * @brief moves imported frames [num_frames_shift, num_frames) of the source buffer to the beginning of the destination one
+     */
+    void ShiftFrames(void *ptr_dst,
+                     const void *ptr_src,
+                     InferenceEngine::Precision input_precision,
+                     intel_dnn_orientation_t orientation,
+                     uint32_t num_frames,
+                     uint32_t num_group,
+                     uint32_t num_vector_stride,
+                     uint32_t num_frames_shift);
 
     void ExportScores(void *ptr_dst,
                      const void *ptr_src,
@@ -208,7 +318,8 @@ void createRequestConfigsForGnaModels();
                     uint32_t num_vector_elements,
                     uint32_t num_vector_stride,
                     intel_dnn_orientation_t orientation,
-                    float scaleFactor);
+                    float scaleFactor,
+                    uint32_t num_frames_offset = 0);
 
     template <typename T, typename U>
     void copyInputDataWithSplit(T *const dst,
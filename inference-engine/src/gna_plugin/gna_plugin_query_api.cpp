@@ -47,6 +47,18 @@ Parameter GNAPlugin::GetMetric(const std::string& name, const std::map<std::stri
             auto deviceName = options.at(KEY_DEVICE_ID).as<std::string>();
             return deviceName;
         }},
+        {GNA_METRIC(LAYER_STATISTICS), [this]() {
+            std::lock_guard<std::mutex> lock(statisticsMutex);
+            // the statistics keep being updated by the next inferences, so a copy is returned
+            NetworkStatsMap statistics;
+            for (auto && layerStats : layerStatistics) {
+                statistics[layerStats.first] = std::make_shared<NetworkNodeStats>(*layerStats.second);
+            }
+            return statistics;
+        }},
+        {GNA_METRIC(LAYER_MEMORY_TRAFFIC), [this]() {
+            return LayersMemoryTraffic();
+        }},
         {METRIC_KEY(SUPPORTED_METRICS), [&queryApiSupported, this]() {
             std::vector<std::string> availablesMetrics;
             for (auto && supportedAPI : queryApiSupported) {
@@ -112,6 +124,10 @@ std::map<std::string, std::string> GNAPlugin::supportedConfigKeysWithDefaults()
         {GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN), CONFIG_VALUE(YES)},
         {CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(NO)},
         {GNA_CONFIG_KEY(LIB_N_THREADS), "1"},
+        {GNA_CONFIG_KEY(INPUT_FRAMES_SHIFT), "0"},
+        {GNA_CONFIG_KEY(COLLECT_STATISTICS), CONFIG_VALUE(NO)},
+        {GNA_CONFIG_KEY(BATCH_STREAMS), CONFIG_VALUE(NO)},
+        {GNA_CONFIG_KEY(PERF_COUNT_WINDOW), "0"},
         {CONFIG_KEY(SINGLE_THREAD), CONFIG_VALUE(YES)}
     };
     return options;
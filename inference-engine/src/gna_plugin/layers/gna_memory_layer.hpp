@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <ie_algorithm.hpp>
 #include "inference_engine.hpp"
 
 namespace GNAPluginNS {
@@ -33,6 +34,17 @@ public:
         return elementSize;
     }
 
+    /**
+     * @brief bytes of the state itself, imported networks have no layers so the whole reserved memory is the state
+     */
+    size_t stateSizeBytes() const {
+        if (!inputLayer) {
+            return reserved_size;
+        }
+        auto dims = getDims();
+        return InferenceEngine::details::product(dims.begin(), dims.end()) * elementSize;
+    }
+
     /**
      * pointer to gna memory request
      */
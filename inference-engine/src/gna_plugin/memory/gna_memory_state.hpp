@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <cpp_interfaces/impl/ie_memory_state_internal.hpp>
 #include "gna_plugin.hpp"
@@ -13,13 +14,37 @@ namespace  GNAPluginNS {
 namespace memory {
 class GNAMemoryState : public InferenceEngine::MemoryStateInternal {
     std::shared_ptr<GNAPlugin> plg;
+    int stream = -1;
  public:
     using Ptr = InferenceEngine::MemoryStateInternal::Ptr;
 
     explicit GNAMemoryState(std::shared_ptr<GNAPlugin> plg)
         : InferenceEngine::MemoryStateInternal("GNAResetState"), plg(plg) {}
+    /**
+     * @brief state of the stream at the batch position in GNA_BATCH_STREAMS mode
+     */
+    GNAMemoryState(std::shared_ptr<GNAPlugin> plg, uint32_t stream)
+        : InferenceEngine::MemoryStateInternal("GNAResetState" + std::to_string(stream)), plg(plg),
+          stream(static_cast<int>(stream)) {}
     void Reset() override {
-        plg->Reset();
+        if (stream < 0) {
+            plg->Reset();
+        } else {
+            plg->ResetStream(static_cast<uint32_t>(stream));
+        }
+    }
+    void SetState(InferenceEngine::Blob::Ptr newState) override {
+        if (stream < 0) {
+            InferenceEngine::MemoryStateInternal::SetState(newState);
+        } else {
+            plg->SetStreamState(static_cast<uint32_t>(stream), newState);
+        }
+    }
+    InferenceEngine::Blob::CPtr GetLastState() const override {
+        if (stream < 0) {
+            return InferenceEngine::MemoryStateInternal::GetLastState();
+        }
+        return plg->GetStreamState(static_cast<uint32_t>(stream));
     }
 };
 }  // namespace memory
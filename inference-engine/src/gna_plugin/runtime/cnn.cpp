@@ -8,6 +8,7 @@
 #include <gna_plugin_log.hpp>
 
 #include "cnn.h"
+#include "floatmath.h"
 #include "backend/dnn_types.h"
 
 
@@ -30,11 +31,8 @@ void CNNFilter32(intel_dnn_component_t *component) {
         float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
         for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
             float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
-            }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
+            ptr_outputs[j * component->op.conv1D.num_filters + i] =
+                    ptr_biases[i] + sdot(num_filter_coefficients, ptr_in, ptr_coef);
         }
     }
 }
@@ -96,29 +94,33 @@ void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number
         uint32_t num_pool_step = component->op.maxpool.num_inputs_step;
         uint32_t num_rows_in = num_inputs / component->op.maxpool.num_inputs_stride;
 
-        for (uint32_t i = 0; i < num_columns; i++) {
-            int32_t m = 0;
+        // whole rows of the pooling window are combined, so the innermost loop runs over contiguous columns
+        int32_t m = 0;
+        for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
+            float *ptr_out = ptr_outputs + m * num_columns;
+            uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
             if (component->op.maxpool.do_sum_not_max) {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float sum = 0.0;
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
-                    for (uint32_t k = j; k < num_end; k++) {
-                        sum += ptr_inputs[k * num_columns + i];
+                for (uint32_t i = 0; i < num_columns; i++) {
+                    ptr_out[i] = 0.0f;
+                }
+                for (uint32_t k = j; k < num_end; k++) {
+                    const float *ptr_in = ptr_inputs + k * num_columns;
+                    for (uint32_t i = 0; i < num_columns; i++) {
+                        ptr_out[i] += ptr_in[i];
                     }
-                    ptr_outputs[m * num_columns + i] = sum;
-                    m++;
                 }
             } else {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float max = -1e20f;
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
-                    for (uint32_t k = j; k < num_end; k++) {
-                        if (ptr_inputs[k * num_columns + i] > max) max = ptr_inputs[k * num_columns + i];
+                for (uint32_t i = 0; i < num_columns; i++) {
+                    ptr_out[i] = -1e20f;
+                }
+                for (uint32_t k = j; k < num_end; k++) {
+                    const float *ptr_in = ptr_inputs + k * num_columns;
+                    for (uint32_t i = 0; i < num_columns; i++) {
+                        ptr_out[i] = (ptr_in[i] > ptr_out[i]) ? ptr_in[i] : ptr_out[i];
                     }
-                    ptr_outputs[m * num_columns + i] = max;
-                    m++;
                 }
             }
+            m++;
         }
     }
 }
@@ -1,7 +1,8 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines used by the software emulation
+// (the loops are laid out so that compilers can vectorize them)
 //
 
 #include <cstdint>
@@ -13,13 +14,52 @@
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
 #endif
 
+float sdot(const uint32_t K, const float *A, const float *B) {
+    // independent partial sums break the dependency chain of a single accumulator,
+    // so the loop can be mapped onto vector registers without fast-math reassociation
+    constexpr uint32_t num_partial_sums = 8;
+    float partial[num_partial_sums] = {};
+    uint32_t k = 0;
+    for (; k + num_partial_sums <= K; k += num_partial_sums) {
+        for (uint32_t p = 0; p < num_partial_sums; p++) {
+            partial[p] += A[k + p] * B[k + p];
+        }
+    }
+    float sum = 0.0f;
+    for (; k < K; k++) {
+        sum += A[k] * B[k];
+    }
+    for (uint32_t p = 0; p < num_partial_sums; p++) {
+        sum += partial[p];
+    }
+    return sum;
+}
+
+// C_row = (beta == 1 ? C_row : 0) + a_0 * B_row_0 + ... + a_(K-1) * B_row_(K-1),
+// where a_k = A[k * incA], so the innermost loop runs over contiguous rows of B and C
+static void sgemm_row(const MKL_INT N, const MKL_INT K, const float *A, const MKL_INT incA,
+                      const float *B, const MKL_INT ldb, const float beta, float *C) {
+    if (beta != 1.0) {
+        for (MKL_INT j = 0; j < N; j++) {
+            C[j] = 0.0f;
+        }
+    }
+    for (MKL_INT k = 0; k < K; k++) {
+        const float a = A[k * incA];
+        const float *b = B + k * ldb;
+        for (MKL_INT j = 0; j < N; j++) {
+            C[j] += a * b[j];
+        }
+    }
+}
+
 #ifdef _NO_MKL_
 void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                   const CBLAS_TRANSPOSE TransB, const MKL_INT M, const MKL_INT N,
                   const MKL_INT K, const float alpha, const float *A,
                   const MKL_INT lda, const float *B, const MKL_INT ldb,
                   const float beta, float *C, const MKL_INT ldc) {
-    int i, j, k;
+    int i, j;
 
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm!\n");
@@ -28,34 +68,17 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
         for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
+            sgemm_row(N, K, A + i * lda, 1, B, ldb, beta, C + i * ldc);
         }
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
-                float sum;
-                sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + j] = sum;
+                C[i * ldc + j] = beta * C[i * ldc + j] + alpha * sdot(K, A + i * lda, B + j * ldb);
             }
         }
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
         for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
+            sgemm_row(N, K, A + i, lda, B, ldb, beta, C + i * ldc);
         }
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm!\n");
@@ -97,7 +120,7 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                         const MKL_INT lda, const float *B, const MKL_INT ldb,
                         const float beta, float *C, const MKL_INT ldc,
                         const uint32_t *OutputList, const MKL_INT L) {
-    int i, j, k, l;
+    int i, j, l;
 
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm_subset!\n");
@@ -107,36 +130,19 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
         for (l = 0; l < L; l++) {
             i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
+            sgemm_row(N, K, A + i * lda, 1, B, ldb, beta, C + l * ldc);
         }
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
-                float sum;
                 j = OutputList[l];
-                sum = beta * C[i * ldc + l];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + l] = sum;
+                C[i * ldc + l] = beta * C[i * ldc + l] + alpha * sdot(K, A + i * lda, B + j * ldb);
             }
         }
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
         for (l = 0; l < L; l++) {
             i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
+            sgemm_row(N, K, A + i, lda, B, ldb, beta, C + l * ldc);
         }
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm_subset!\n");
@@ -155,17 +161,11 @@ void sgemv_split(const uint32_t N,
                  float *C) {
     uint32_t num_columns = K1 + K2;
     uint32_t num_rows = N;
-    uint32_t i, j;
+    uint32_t i;
 
     for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
+        const float *x = X + i * num_columns;
+        C[i] = B[i] + sdot(K1, A1, x) + sdot(K2, A2, x + K1);
     }
 }
 
@@ -6,6 +6,7 @@
 
 #include <cstdlib>
 #include <cstdio>
+#include <cstdint>
 
 #ifndef _NO_MKL_
 #include <mkl_dnn.h>
@@ -33,6 +34,8 @@ typedef CBLAS_LAYOUT CBLAS_ORDER; /* this for backward compatibility with CBLAS_
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
 #endif
 
+// sum of A[k] * B[k] over k < K
+float sdot(const uint32_t K, const float *A, const float *B);
 #ifdef _NO_MKL_
 void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                   const CBLAS_TRANSPOSE TransB, const MKL_INT M, const MKL_INT N,
@@ -5,9 +5,14 @@
 //
 
 #include <vector>
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <cstdint>
+#include <future>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 #ifdef _NO_MKL_
 #include <cmath>
@@ -251,9 +256,12 @@ std::vector<pwl_t> pwl_search(const DnnActivationType fun,
         std::vector<pwl_t> pwl2;
         double err_pct1 = 0.0, err_pct2 = 0.0;
 
-        pwl = pwl_search(fun, l_bound, 0.0, threshold, allowed_err_pct, samples, err_pct1);
-        pwl = negative_pwl(pwl);
+        // the halves are independent, so the negative one is searched in another thread
+        auto negative_half = std::async(std::launch::async, [&] {
+            return negative_pwl(pwl_search(fun, l_bound, 0.0, threshold, allowed_err_pct, samples, err_pct1));
+        });
         pwl2 = pwl_search(fun, 0.0, u_bound, threshold, allowed_err_pct, samples, err_pct2);
+        pwl = negative_half.get();
 
         // merge
         pwl.pop_back();  // remove final alpha and beta from first half
@@ -323,19 +331,53 @@ std::vector<pwl_t> pwl_search(const DnnActivationType fun,
 }
 
 
+namespace {
+// the designs are shared by the layers of all the networks loaded in the process, the search depends on the function
+// and its domain only, while the segments also depend on the scale factors
+std::mutex pwl_cache_mutex;
+std::map<std::tuple<DnnActivationType, double, double>, std::vector<pwl_t>> pwl_search_cache;
+std::map<std::tuple<DnnActivationType, float, float, float>, std::vector<intel_pwl_segment_t>> pwl_segments_cache;
+
+std::vector<pwl_t> cached_pwl_search(const DnnActivationType fun, const double l_bound, const double u_bound) {
+    const auto key = std::make_tuple(fun, l_bound, u_bound);
+    {
+        std::lock_guard<std::mutex> lock(pwl_cache_mutex);
+        auto cached = pwl_search_cache.find(key);
+        if (cached != pwl_search_cache.end()) {
+            return cached->second;
+        }
+    }
+    // the same function might be designed concurrently, both results are the same
+    double err_pct = 0.0;
+    auto pwl = pwl_search(fun, l_bound, u_bound, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+    std::lock_guard<std::mutex> lock(pwl_cache_mutex);
+    pwl_search_cache.emplace(key, pwl);
+    return pwl;
+}
+}  // namespace
+
 void PwlDesignOpt16(const DnnActivation activation_type,
                     std::vector<intel_pwl_segment_t> &ptr_segment,
                     const float scale_in,
                     const float scale_out) {
+    const auto key = std::make_tuple(activation_type.type, activation_type.negative_slope, scale_in, scale_out);
+    {
+        std::lock_guard<std::mutex> lock(pwl_cache_mutex);
+        auto cached = pwl_segments_cache.find(key);
+        if (cached != pwl_segments_cache.end()) {
+            ptr_segment = cached->second;
+            return;
+        }
+    }
+
     std::vector<pwl_t> pwl;
-    double err_pct = 0.0;
     switch (activation_type) {
         case kActSigmoid:
-            pwl = pwl_search(kActSigmoid, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = cached_pwl_search(kActSigmoid, -SIGMOID_DOMAIN, SIGMOID_DOMAIN);
             make_gna_pwl(activation_type, pwl, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, scale_in, scale_out, ptr_segment);
             break;
         case kActTanh:
-            pwl = pwl_search(kActTanh, -TANH_DOMAIN, TANH_DOMAIN, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = cached_pwl_search(kActTanh, -TANH_DOMAIN, TANH_DOMAIN);
             make_gna_pwl(activation_type, pwl, -TANH_DOMAIN, TANH_DOMAIN, scale_in, scale_out, ptr_segment);
             break;
         case kActRelu:
@@ -351,8 +393,11 @@ void PwlDesignOpt16(const DnnActivation activation_type,
             make_gna_pwl(activation_type, pwl, KALDI_LSTM_CLIP_LOWER, KALDI_LSTM_CLIP_UPPER, scale_in, scale_out, ptr_segment);
             break;
         default:
-            break;
+            return;
     }
+
+    std::lock_guard<std::mutex> lock(pwl_cache_mutex);
+    pwl_segments_cache.emplace(key, ptr_segment);
 }
 
 void PwlDesign16(const DnnActivation activation_type,
@@ -620,34 +665,32 @@ void PwlApply32(intel_dnn_component_t *component,
                 }
             }
             break;
-        case kActRelu:
+        case kActRelu: {
+            // branch-free selects let the row loops be vectorized
+            const float negative_slope = transform->func_id.negative_slope;
             for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+                const float *in = ptr_in + i * num_columns;
+                float *out = ptr_out + i * num_columns;
                 for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] =
-                            (ptr_in[i * num_columns + j] < 0.0f) ? ptr_in[i * num_columns + j] *
-                                                                   transform->func_id.negative_slope : ptr_in[
-                                    i * num_columns + j];
+                    out[j] = (in[j] < 0.0f) ? in[j] * negative_slope : in[j];
                 }
             }
             break;
+        }
         case kActIdentity:
             for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j];
-                }
+                std::copy(ptr_in + i * num_columns + num_col_start,
+                          ptr_in + i * num_columns + num_col_end + 1,
+                          ptr_out + i * num_columns + num_col_start);
             }
             break;
         case kActKaldiLstmClipping:
             for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+                const float *in = ptr_in + i * num_columns;
+                float *out = ptr_out + i * num_columns;
                 for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    float val = ptr_in[i * num_columns + j];
-                    if (val > KALDI_LSTM_CLIP_UPPER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_UPPER;
-                    } else if (val < KALDI_LSTM_CLIP_LOWER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_LOWER;
-                    } else {
-                        ptr_out[i * num_columns + j] = val;
-                    }
+                    const float val = (in[j] > KALDI_LSTM_CLIP_UPPER) ? KALDI_LSTM_CLIP_UPPER : in[j];
+                    out[j] = (val < KALDI_LSTM_CLIP_LOWER) ? KALDI_LSTM_CLIP_LOWER : val;
                 }
             }
             break;
@@ -18,26 +18,35 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const HeteroInferRequest::Ptr&
     _heteroInferRequest(request),
     _statusCodes{_heteroInferRequest->_inferRequests.size(), StatusCode::OK} {
     _pipeline.clear();
+    // Every subgraph request is a pipeline stage executed by its own device, so the stages of different
+    // requests in flight overlap: subgraph k of one request runs while subgraph k - 1 of the next one does
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(InferRequest* inferRequest) : _inferRequest{inferRequest} {
+            RequestExecutor(HeteroInferRequest* heteroInferRequest, std::size_t requestId) :
+                _heteroInferRequest{heteroInferRequest},
+                _requestId{requestId},
+                _inferRequest{heteroInferRequest->_inferRequests[requestId]._request.get()} {
                 _inferRequest->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
                 [this] (InferRequest, StatusCode sts) mutable {
                     _status = sts;
+                    _heteroInferRequest->unmapSharedBlobs(_requestId);
                     auto capturedTask = std::move(_task);
                     capturedTask();
                 });
             }
             void run(Task task) override {
                 _task = std::move(task);
+                _heteroInferRequest->mapSharedBlobs(_requestId);
                 _inferRequest->StartAsync();
             };
-            InferRequest*   _inferRequest = nullptr;
-            StatusCode      _status = StatusCode::OK;
-            Task            _task;
+            HeteroInferRequest* _heteroInferRequest = nullptr;
+            std::size_t         _requestId = 0;
+            InferRequest*       _inferRequest = nullptr;
+            StatusCode          _status = StatusCode::OK;
+            Task                _task;
         };
 
-        auto reuestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request.get());
+        auto reuestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest.get(), requestId);
         _pipeline.emplace_back(reuestExecutor, [reuestExecutor] {
             if (StatusCode::OK != reuestExecutor->_status) {
                 THROW_IE_EXCEPTION << InferenceEngine::details::as_status << reuestExecutor->_status;
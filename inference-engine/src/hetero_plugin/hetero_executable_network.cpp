@@ -21,6 +21,9 @@
 #include <unordered_set>
 #include <array>
 #include <cstdint>
+#include <chrono>
+#include <future>
+#include <sstream>
 
 #include <ie_plugin_dispatcher.hpp>
 #include "details/caseless.hpp"
@@ -315,26 +318,37 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(InferenceEngine::ICNNNetwork&
         descs.emplace_back(std::move(desc));
     }
 
+    // Subnetworks of different devices are loaded concurrently, so the load time is the one of the slowest device
+    // rather than the sum. The subnetworks of one device are loaded one after another as plugins are not required
+    // to support concurrent LoadNetwork calls.
+    std::map<std::string, std::vector<NetworkDesc*>> deviceDescs;
     for (auto &&d : descs) {
-        IExecutableNetwork::Ptr ret;
-        ResponseDesc resp;
-
-        auto subnetworkInputs = d._clonedNetwork.getInputsInfo();
-        bool isInputSubnetwork = (subnetworkInputs.end() != std::find_first_of(
-            subnetworkInputs.begin(), subnetworkInputs.end(),
-            externalInputsData.begin(), externalInputsData.end(),
-            [] (const InputsDataMap::value_type& lhs, const InputsDataMap::value_type& rhs) {
-                return lhs.first == rhs.first;
-            }));
+        deviceDescs[d._device].push_back(&d);
+    }
 
-        auto cfg = config;
-        cfg[IE_INTERNAL_CONFIG_KEY(SUBNETWORK_WITH_NETWORK_INPUTS)] = isInputSubnetwork
-                                                                    ? CONFIG_VALUE(YES)
-                                                                    : CONFIG_VALUE(NO);
+    std::vector<std::future<void>> loads;
+    for (auto &&deviceDesc : deviceDescs) {
         IE_SUPPRESS_DEPRECATED_START
-        auto plugin = _plugin->_plugins[d._device];
-        d._network = plugin.LoadNetwork(d._clonedNetwork, Engine::GetSupportedConfig(config, plugin));
+        auto plugin = _plugin->_plugins[deviceDesc.first];
         IE_SUPPRESS_DEPRECATED_END
+        auto supportedConfig = Engine::GetSupportedConfig(config, plugin);
+        auto& deviceNetworks = deviceDesc.second;
+        loads.emplace_back(std::async(std::launch::async, [plugin, supportedConfig, &deviceNetworks] () mutable {
+            for (auto &&d : deviceNetworks) {
+                auto start = std::chrono::steady_clock::now();
+                IE_SUPPRESS_DEPRECATED_START
+                d->_network = plugin.LoadNetwork(d->_clonedNetwork, supportedConfig);
+                IE_SUPPRESS_DEPRECATED_END
+                d->_loadTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+            }
+        }));
+    }
+    // all the loads have to finish before an error of any of them is rethrown
+    for (auto &&load : loads) {
+        load.wait();
+    }
+    for (auto &&load : loads) {
+        load.get();
     }
 
     networks = std::move(descs);
@@ -397,7 +411,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
         importedConfigs[config.first] = config.second;
     }
 
-    std::vector<NetworkDesc> descs;
+    std::vector<pugi::xml_node> subnetworkNodes;
     pugi::xml_node subnetworksNode = heteroNode.child("subnetworks");
     for (auto subnetworkNode = subnetworksNode.child("subnetwork"); !subnetworkNode.empty();
             subnetworkNode = subnetworkNode.next_sibling("subnetwork")) {
@@ -409,85 +423,211 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
             _plugin->_plugins[device] = _plugin->GetDevicePlugin(device);
             IE_SUPPRESS_DEPRECATED_END
         }
+        subnetworkNodes.push_back(subnetworkNode);
+    }
+
+    // A subnetwork is imported by its device plugin. The plugins which can't import get the IR, which is only parsed
+    // here: its LoadNetwork is deferred until the subnetwork is used, so an import is not slowed down by the devices
+    // the network falls back to.
+    auto importSubnetwork = [&] (const pugi::xml_node& subnetworkNode, std::istream& model) {
+        NetworkDesc desc;
+        auto start = std::chrono::steady_clock::now();
+        desc._device = GetStrAttr(subnetworkNode, "device");
 
-        auto& plugin = _plugin->_plugins[device];
-        auto supportedConfig = Engine::GetSupportedConfig(importedConfigs, plugin);
         IE_SUPPRESS_DEPRECATED_START
+        auto& plugin = _plugin->_plugins.at(desc._device);
         auto pluginAPI = getInferencePluginAPIInterface(plugin);
         IE_SUPPRESS_DEPRECATED_END
+        auto supportedConfig = Engine::GetSupportedConfig(importedConfigs, plugin);
 
-        InferenceEngine::ExecutableNetwork executableNetwork;
-        CNNNetwork cnnnetwork;
-        bool loaded = false;
-        try {
-            executableNetwork = pluginAPI->ImportNetwork(heteroModel, supportedConfig);
-        } catch(InferenceEngine::details::InferenceEngineException& ie_ex) {
-            if (std::string::npos != std::string{ie_ex.what()}.find(NOT_IMPLEMENTED_str)) {
-                IE_SUPPRESS_DEPRECATED_START
-                CNNNetReader reader;
-                std::string xmlString;
-                std::getline(heteroModel, xmlString);
-                reader.ReadNetwork(xmlString.data(), xmlString.size());
-                std::uint64_t dataSize = 0;
-                heteroModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
-                if (0 != dataSize) {
-                    auto dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-                        InferenceEngine::TensorDesc(InferenceEngine::Precision::U8,
-                                                    {static_cast<std::size_t>(dataSize)},
-                                                    InferenceEngine::Layout::C));
-                    dataBlob->allocate();
-                    heteroModel.read(dataBlob->buffer(), dataSize);
-                    reader.SetWeights(std::move(dataBlob));
+        desc._exportedAsIR = GetStrAttr(subnetworkNode, "format", "blob") == "ir";
+        if (!desc._exportedAsIR) {
+            try {
+                desc._network = pluginAPI->ImportNetwork(model, supportedConfig);
+            } catch(InferenceEngine::details::InferenceEngineException& ie_ex) {
+                if (std::string::npos == std::string{ie_ex.what()}.find(NOT_IMPLEMENTED_str)) {
+                    throw;
                 }
-                cnnnetwork = reader.getNetwork();
-                IE_SUPPRESS_DEPRECATED_END
-                auto inputs = cnnnetwork.getInputsInfo();
-                auto inputsNode = subnetworkNode.child("inputs");
-                for (auto inputNode = inputsNode.child("input"); !inputNode.empty(); inputNode = inputNode.next_sibling("input")) {
-                    auto inputName = GetStrAttr(inputNode, "name");
-                    inputs[inputName]->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+                desc._exportedAsIR = true;
+            }
+        }
+
+        if (desc._exportedAsIR) {
+            IE_SUPPRESS_DEPRECATED_START
+            CNNNetReader reader;
+            std::string xmlString;
+            std::getline(model, xmlString);
+            reader.ReadNetwork(xmlString.data(), xmlString.size());
+            std::uint64_t dataSize = 0;
+            model.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+            if (0 != dataSize) {
+                auto dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
+                    InferenceEngine::TensorDesc(InferenceEngine::Precision::U8,
+                                                {static_cast<std::size_t>(dataSize)},
+                                                InferenceEngine::Layout::C));
+                dataBlob->allocate();
+                model.read(dataBlob->buffer(), dataSize);
+                reader.SetWeights(std::move(dataBlob));
+            }
+            CNNNetwork cnnnetwork = reader.getNetwork();
+            IE_SUPPRESS_DEPRECATED_END
+            auto inputs = cnnnetwork.getInputsInfo();
+            auto inputsNode = subnetworkNode.child("inputs");
+            for (auto inputNode = inputsNode.child("input"); !inputNode.empty(); inputNode = inputNode.next_sibling("input")) {
+                auto inputName = GetStrAttr(inputNode, "name");
+                inputs[inputName]->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+            }
+
+            auto outputsNode = subnetworkNode.child("outputs");
+            for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+                cnnnetwork.addOutput(GetStrAttr(outputNode, "creatorName"), GetUInt64Attr(outputNode, "index"));
+            }
+            auto outputs = cnnnetwork.getOutputsInfo();
+            for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+                outputs[GetStrAttr(outputNode, "name")]->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+            }
+            desc._clonedNetwork = CNNNetwork{cloneNet(static_cast<InferenceEngine::ICNNNetwork&>(cnnnetwork))};
+        }
+
+        desc._loadTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return desc;
+    };
+
+    std::vector<NetworkDesc> descs(subnetworkNodes.size());
+    const bool indexed = std::all_of(subnetworkNodes.begin(), subnetworkNodes.end(), [] (const pugi::xml_node& node) {
+        return !node.attribute("size").empty();
+    });
+    if (!indexed) {
+        // the sizes of the subnetworks are not known, so they are read one after another
+        for (size_t i = 0; i < subnetworkNodes.size(); i++) {
+            descs[i] = importSubnetwork(subnetworkNodes[i], heteroModel);
+        }
+    } else {
+        std::vector<std::string> sections(subnetworkNodes.size());
+        for (size_t i = 0; i < subnetworkNodes.size(); i++) {
+            sections[i].resize(static_cast<std::size_t>(GetUInt64Attr(subnetworkNodes[i], "size")));
+            if (!sections[i].empty()) {
+                heteroModel.read(&sections[i][0], sections[i].size());
+            }
+            if (!heteroModel.good()) {
+                THROW_IE_EXCEPTION << "Error reading HETERO plugin subnetwork " << i << " : unexpected end of the stream";
+            }
+        }
+
+        // Subnetworks of different devices are imported concurrently, the ones of one device one after another,
+        // the same way as they are loaded
+        std::map<std::string, std::vector<size_t>> deviceSubnetworks;
+        for (size_t i = 0; i < subnetworkNodes.size(); i++) {
+            deviceSubnetworks[GetStrAttr(subnetworkNodes[i], "device")].push_back(i);
+        }
+
+        std::vector<std::future<void>> imports;
+        for (auto&& deviceSubnetwork : deviceSubnetworks) {
+            auto& indices = deviceSubnetwork.second;
+            imports.emplace_back(std::async(std::launch::async, [&] () {
+                for (auto i : indices) {
+                    std::istringstream section(sections[i]);
+                    descs[i] = importSubnetwork(subnetworkNodes[i], section);
                 }
+            }));
+        }
+        // all the imports have to finish before an error of any of them is rethrown
+        for (auto&& import : imports) {
+            import.wait();
+        }
+        for (auto&& import : imports) {
+            import.get();
+        }
+    }
 
-                auto outputsNode = subnetworkNode.child("outputs");
-                for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
-                    cnnnetwork.addOutput(GetStrAttr(outputNode, "creatorName"), GetUInt64Attr(outputNode, "index"));
+    for (auto&& desc : descs) {
+        if (desc._exportedAsIR) {
+            for (auto&& input : desc._clonedNetwork.getInputsInfo()) {
+                if (networkInputs.end() != networkInputs.find(input.first)) {
+                    _networkInputs.emplace(input.first, input.second);
                 }
-                auto outputs = cnnnetwork.getOutputsInfo();
-                for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
-                    outputs[GetStrAttr(outputNode, "name")]->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+            }
+            for (auto&& output : desc._clonedNetwork.getOutputsInfo()) {
+                if (networkOutputs.end() != networkOutputs.find(output.first)) {
+                    _networkOutputs.emplace(output.first, output.second);
                 }
-                IE_SUPPRESS_DEPRECATED_START
-                executableNetwork = plugin.LoadNetwork(cnnnetwork, supportedConfig);
-                IE_SUPPRESS_DEPRECATED_END
-                loaded = true;
-            } else {
-                throw;
             }
+            continue;
         }
 
-        for (auto&& input : executableNetwork.GetInputsInfo()) {
+        for (auto&& input : desc._network.GetInputsInfo()) {
             if (networkInputs.end() != networkInputs.find(input.first)) {
                 _networkInputs.emplace(input.first, std::const_pointer_cast<InputInfo>(input.second));
             }
         }
 
-        for (auto&& output : executableNetwork.GetOutputsInfo()) {
+        for (auto&& output : desc._network.GetOutputsInfo()) {
             if (networkOutputs.end() != networkOutputs.find(output.first)) {
                 _networkOutputs.emplace(output.first, std::const_pointer_cast<Data>(output.second));
             }
         }
-
-        descs.emplace_back(NetworkDesc{
-            device,
-            loaded ? CNNNetwork{cloneNet(static_cast<InferenceEngine::ICNNNetwork&>(cnnnetwork))} : CNNNetwork{},
-            executableNetwork,
-        });
     }
 
     networks = std::move(descs);
+
+    for (auto&& desc : networks) {
+        if (!desc._exportedAsIR) {
+            continue;
+        }
+        IE_SUPPRESS_DEPRECATED_START
+        auto plugin = _plugin->_plugins[desc._device];
+        IE_SUPPRESS_DEPRECATED_END
+        auto supportedConfig = Engine::GetSupportedConfig(importedConfigs, plugin);
+        auto d = &desc;
+        desc._deferredLoad = std::async(std::launch::deferred, [d, plugin, supportedConfig] () mutable {
+            auto start = std::chrono::steady_clock::now();
+            IE_SUPPRESS_DEPRECATED_START
+            d->_network = plugin.LoadNetwork(d->_clonedNetwork, supportedConfig);
+            IE_SUPPRESS_DEPRECATED_END
+            d->_loadTime += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }).share();
+    }
+}
+
+void HeteroExecutableNetwork::WaitForDeferredLoads() const {
+    for (auto&& desc : networks) {
+        if (desc._deferredLoad.valid()) {
+            desc._deferredLoad.get();
+        }
+    }
 }
 
 void HeteroExecutableNetwork::ExportImpl(std::ostream& heteroModel) {
+    // Every subnetwork is written to own section first, so the header keeps the sizes of the sections and an import
+    // can read them all and import the subnetworks of different devices concurrently
+    std::vector<std::string> sections;
+    std::vector<bool> exportedAsIR;
+    for (auto&& subnetwork : networks) {
+        std::ostringstream section;
+        bool asIR = subnetwork._exportedAsIR;
+        if (!asIR) {
+            try {
+                subnetwork._network.Export(section);
+            } catch(InferenceEngine::details::InferenceEngineException& ie_ex) {
+                if (std::string::npos == std::string{ie_ex.what()}.find(NOT_IMPLEMENTED_str)) {
+                    throw;
+                }
+                asIR = true;
+                section.str({});
+            }
+        }
+        if (asIR) {
+            pugi::xml_document doc;
+            auto dataSize = static_cast<std::uint64_t>(InferenceEngine::details::NetworkSerializer::fillXmlDoc(subnetwork._clonedNetwork, doc));
+            doc.save(section, nullptr, pugi::format_raw);
+            section << std::endl;
+            section.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+            InferenceEngine::details::NetworkSerializer::serializeBlobs(section, subnetwork._clonedNetwork);
+        }
+        sections.push_back(section.str());
+        exportedAsIR.push_back(asIR);
+    }
+
     pugi::xml_document doc;
     auto heteroNode = doc.append_child("hetero");
     heteroNode.append_attribute("name").set_value(_name.c_str());
@@ -503,9 +643,12 @@ void HeteroExecutableNetwork::ExportImpl(std::ostream& heteroModel) {
     }
 
     auto subnetworksNode = heteroNode.append_child("subnetworks");
-    for (auto&& subnetwork : networks) {
+    for (size_t i = 0; i < networks.size(); i++) {
+        auto&& subnetwork = networks[i];
         auto subnetworkNode = subnetworksNode.append_child("subnetwork");
         subnetworkNode.append_attribute("device").set_value(subnetwork._device.c_str());
+        subnetworkNode.append_attribute("format").set_value(exportedAsIR[i] ? "ir" : "blob");
+        subnetworkNode.append_attribute("size").set_value(std::to_string(sections[i].size()).c_str());
         auto subnetworkInputsNode = subnetworkNode.append_child("inputs");
         auto inputInfo = subnetwork._clonedNetwork.getInputsInfo();
         for (auto&& input : inputInfo) {
@@ -541,27 +684,15 @@ void HeteroExecutableNetwork::ExportImpl(std::ostream& heteroModel) {
     doc.save(heteroModel, nullptr, pugi::format_raw);
     heteroModel << std::endl;
 
-    for (auto&& subnetwork : networks) {
-        try {
-            subnetwork._network.Export(heteroModel);
-        } catch(InferenceEngine::details::InferenceEngineException& ie_ex) {
-            if (std::string::npos != std::string{ie_ex.what()}.find(NOT_IMPLEMENTED_str)) {
-                pugi::xml_document doc;
-                auto dataSize = static_cast<std::uint64_t>(InferenceEngine::details::NetworkSerializer::fillXmlDoc(subnetwork._clonedNetwork, doc));
-                doc.save(heteroModel, nullptr, pugi::format_raw);
-                heteroModel << std::endl;
-                heteroModel.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
-                InferenceEngine::details::NetworkSerializer::serializeBlobs(heteroModel, subnetwork._clonedNetwork);
-            } else {
-                throw;
-            }
-        }
+    for (auto&& section : sections) {
+        heteroModel.write(section.data(), section.size());
     }
 }
 
 InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         InputsDataMap networkInputs,
         OutputsDataMap networkOutputs) {
+    WaitForDeferredLoads();
     HeteroInferRequest::SubRequestsList inferRequests;
     int index = 0;
     for (auto&& subnetwork : networks) {
@@ -570,9 +701,11 @@ InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         desc._profilingTask = ProfilingTask{"Infer" + std::to_string(index++)};
         inferRequests.push_back(desc);
     }
+    auto itShare = _config.find(HETERO_CONFIG_KEY(SHARE_BOUNDARY_BLOBS));
     return std::make_shared<HeteroInferRequest>(networkInputs,
                                                 networkOutputs,
-                                                inferRequests);
+                                                inferRequests,
+                                                itShare != _config.end() && itShare->second == YES);
 }
 
 void HeteroExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
@@ -594,6 +727,8 @@ void HeteroExecutableNetwork::GetConfig(const std::string &name, InferenceEngine
             result = std::string{};
         }
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) ||
+               name == HETERO_CONFIG_KEY(MERGE_SUBGRAPHS) ||
+               name == HETERO_CONFIG_KEY(SHARE_BOUNDARY_BLOBS) ||
                name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
@@ -609,20 +744,34 @@ void HeteroExecutableNetwork::GetMetric(const std::string &name, InferenceEngine
             METRIC_KEY(NETWORK_NAME),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)});
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            HETERO_METRIC(SUBNETWORKS_LOAD_TIME)});
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(MERGE_SUBGRAPHS),
+            HETERO_CONFIG_KEY(SHARE_BOUNDARY_BLOBS),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)});
     } else if (METRIC_KEY(NETWORK_NAME) == name) {
         result = IE_SET_METRIC(NETWORK_NAME, _name);
     } else if (METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
+        // Subgraphs of a request are executed as pipeline stages by HeteroAsyncInferRequest, so while one request
+        // runs on some device the next ones can already run on the others. To keep every stage busy, as many requests
+        // as each subgraph's device wants for itself have to be in flight at once.
+        WaitForDeferredLoads();
         unsigned int value = 0u;
         for (auto&& desc : networks) {
-            value = std::max(value, desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            value += desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
         }
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
+    } else if (HETERO_METRIC(SUBNETWORKS_LOAD_TIME) == name) {
+        WaitForDeferredLoads();
+        std::map<std::string, float> loadTime;
+        for (auto&& desc : networks) {
+            loadTime[desc._device] += desc._loadTime;
+        }
+        result = IE_SET_METRIC(HETERO_SUBNETWORKS_LOAD_TIME, loadTime);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -14,6 +14,7 @@
 #include <map>
 #include <unordered_map>
 #include <unordered_set>
+#include <future>
 
 #include <ie_common.h>
 #include <cpp/ie_plugin_cpp.hpp>
@@ -68,9 +69,17 @@ private:
         std::string                                 _device;
         InferenceEngine::CNNNetwork                 _clonedNetwork;
         InferenceEngine::ExecutableNetwork          _network;
+        float                                       _loadTime = 0.f;  // milliseconds
+        bool                                        _exportedAsIR = false;
+        std::shared_future<void>                    _deferredLoad;  // loads _network on the first use if valid
     };
     std::vector<NetworkDesc> networks;
 
+    /**
+    * @brief Loads the imported subnetworks whose load was deferred until the first use
+    */
+    void WaitForDeferredLoads() const;
+
     Engine*                             _plugin;
     std::string                         _name;
     std::vector<std::string>            _affinities;
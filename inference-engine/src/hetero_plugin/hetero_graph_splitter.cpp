@@ -6,12 +6,17 @@
 #include "hetero_ade_util.hpp"
 
 #include <cassert>
+#include <algorithm>
+#include <map>
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 #include <string>
 
+#include <details/ie_cnn_network_iterator.hpp>
+
 #include <ade/typed_graph.hpp>
 #include <ade/helpers/subgraphs.hpp>
 
@@ -233,4 +238,112 @@ void sortSubgraphs(std::vector<LayersSet>& subgraphs) {
     subgraphs = std::move(ret);
 }
 
+namespace {
+std::size_t elementsCount(const DataPtr& data) {
+    std::size_t count = 1;
+    for (auto&& dim : data->getTensorDesc().getDims()) {
+        count *= dim;
+    }
+    return count;
+}
+
+/// Rough number of operations of the layer: one per output element, layers with weights
+/// do one multiply-accumulate per weight used for every output element
+std::size_t operationsCount(const CNNLayerPtr& layer) {
+    std::size_t count = 0;
+    for (auto&& out : layer->outData) {
+        count += elementsCount(out);
+    }
+    auto weightable = dynamic_cast<const WeightableLayer*>(layer.get());
+    if (nullptr != weightable && nullptr != weightable->_weights && !layer->outData.empty()) {
+        const auto& dims = layer->outData[0]->getTensorDesc().getDims();
+        const std::size_t outChannels = dims.size() > 1 ? dims[1] : 1;
+        if (outChannels > 0) {
+            count *= std::max<std::size_t>(1, weightable->_weights->size() / outChannels);
+        }
+    }
+    return count;
+}
+}  // namespace
+
+void mergeSmallSubgraphs(ICNNNetwork& network,
+                         const std::function<bool(const CNNLayerPtr&, const std::string&)>& isSupported,
+                         std::map<std::string, std::string>& layerDevices) {
+    std::vector<CNNLayerPtr> layers;
+    for (details::CNNNetworkIterator i(&network); i != details::CNNNetworkIterator(); i++) {
+        if (layerDevices.end() != layerDevices.find((*i)->name)) {
+            layers.emplace_back(*i);
+        }
+    }
+
+    // every merge joins a group with a neighbouring one, so the loop ends when no group can be moved anymore
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        LayersSet visited;
+        for (auto&& layer : layers) {
+            if (!visited.insert(layer).second) {
+                continue;
+            }
+            const auto device = layerDevices[layer->name];
+
+            std::vector<CNNLayerPtr> group{layer};
+            std::size_t operations = 0;
+            std::map<std::string, std::size_t> exchanged;
+            std::set<std::pair<Data*, std::string>> countedData;
+            auto visitNeighbour = [&](const CNNLayerPtr& neighbour, const DataPtr& data) {
+                auto it = layerDevices.find(neighbour->name);
+                if (layerDevices.end() == it) {
+                    return;
+                }
+                if (it->second == device) {
+                    if (visited.insert(neighbour).second) {
+                        group.emplace_back(neighbour);
+                    }
+                } else if (countedData.emplace(data.get(), it->second).second) {
+                    exchanged[it->second] += elementsCount(data);
+                }
+            };
+            for (std::size_t i = 0; i < group.size(); ++i) {
+                auto current = group[i];
+                operations += operationsCount(current);
+                for (auto&& dataIt : current->insData) {
+                    auto data = dataIt.lock();
+                    assert(nullptr != data);
+                    auto prevLayer = data->getCreatorLayer().lock();
+                    if (nullptr != prevLayer) {
+                        visitNeighbour(prevLayer, data);
+                    }
+                }
+                for (auto&& data : current->outData) {
+                    for (auto&& nextLayer : data->getInputTo()) {
+                        visitNeighbour(nextLayer.second, data);
+                    }
+                }
+            }
+
+            std::string target;
+            std::size_t maxExchanged = 0;
+            for (auto&& candidate : exchanged) {
+                if (candidate.second < operations || candidate.second <= maxExchanged) {
+                    continue;
+                }
+                if (std::all_of(group.begin(), group.end(), [&](const CNNLayerPtr& l) {
+                        return isSupported(l, candidate.first);
+                    })) {
+                    target = candidate.first;
+                    maxExchanged = candidate.second;
+                }
+            }
+
+            if (!target.empty()) {
+                for (auto&& l : group) {
+                    layerDevices[l->name] = target;
+                }
+                changed = true;
+            }
+        }
+    }
+}
+
 }  // namespace InferenceEngine
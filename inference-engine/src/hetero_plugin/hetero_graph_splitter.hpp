@@ -9,6 +9,7 @@
 
 #include <string>
 #include <functional>
+#include <map>
 #include <unordered_set>
 #include <vector>
 #include <utility>
@@ -35,5 +36,18 @@ splitGraph(ICNNNetwork& network,
 void
 sortSubgraphs(std::vector<LayersSet>& subgraphs);
 
+/// Reassign groups of connected layers placed on one device to the device of
+/// their neighbours if it supports all layers of the group and the estimated
+/// number of operations of the group does not exceed the number of elements
+/// the group exchanges with this device
+///
+/// @param network - source network
+/// @param isSupported - checks if the layer is supported by the device
+/// @param layerDevices - map of layer names to the assigned devices, updated in place
+void
+mergeSmallSubgraphs(ICNNNetwork& network,
+                    const std::function<bool(const CNNLayerPtr&, const std::string&)>& isSupported,
+                    std::map<std::string, std::string>& layerDevices);
+
 }  // namespace InferenceEngine
 
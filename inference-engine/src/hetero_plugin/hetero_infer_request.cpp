@@ -9,23 +9,34 @@
 #include <description_buffer.hpp>
 #include <debug.h>
 #include <ie_layouts.h>
+#include <blob_factory.hpp>
+#include <algorithm>
 #include <cassert>
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace HeteroPlugin;
 using namespace InferenceEngine;
 
 HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                        InferenceEngine::OutputsDataMap networkOutputs,
-                                       const SubRequestsList &inferRequests) :
+                                       const SubRequestsList &inferRequests,
+                                       bool shareBoundaryBlobs) :
         InferRequestInternal(networkInputs, networkOutputs),
         _inferRequests(inferRequests) {
     if (_networkOutputs.empty() || _networkInputs.empty()) {
         THROW_IE_EXCEPTION << "Internal error: no information about network's output/input";
     }
 
-    auto requestBlob([&](const std::string &e, InferenceEngine::InferRequest::Ptr r) {
+    auto requestBlob([&](const std::string &e, std::size_t requestId) {
+        auto itShared = _sharedBlobs.find(e);
+        if (itShared != _sharedBlobs.end() && contains(itShared->second._hostRequests, requestId)) {
+            // the host memory of the blob is set to the request every time it is mapped
+            return;
+        }
+        auto& r = _inferRequests[requestId]._request;
         if (networkInputs.find(e) != networkInputs.end()) {
             if (_blobs.find(e) != _blobs.end()) {
                 r->SetBlob(e.c_str(), _blobs[e]);
@@ -52,28 +63,119 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
     // go over all subnet and create requests
     for (auto&& desc : _inferRequests) {
         desc._request = desc._network.CreateInferRequestPtr();
-        // go over all inputs and get blobs from subnet infer requests
-        for (auto&& outputInfo : desc._network.GetOutputsInfo()) {
-            requestBlob(outputInfo.first, desc._request);
+    }
+
+    if (shareBoundaryBlobs) {
+        for (auto&& desc : _inferRequests) {
+            for (auto&& outputInfo : desc._network.GetOutputsInfo()) {
+                if (networkOutputs.find(outputInfo.first) == networkOutputs.end()) {
+                    shareBlob(outputInfo.first);
+                }
+            }
+        }
+    }
+
+    // go over all inputs and get blobs from subnet infer requests
+    for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+        for (auto&& outputInfo : _inferRequests[requestId]._network.GetOutputsInfo()) {
+            requestBlob(outputInfo.first, requestId);
         }
     }
 
     // go over all outputs and get blobs from subnet infer requests
-    for (auto&& desc : _inferRequests) {
-        for (auto&& inputInfo : desc._network.GetInputsInfo()) {
-            requestBlob(inputInfo.first, desc._request);
+    for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+        for (auto&& inputInfo : _inferRequests[requestId]._network.GetInputsInfo()) {
+            requestBlob(inputInfo.first, requestId);
+        }
+    }
+}
+
+void HeteroInferRequest::shareBlob(const std::string& name) {
+    // the producer and the consumers of the blob with their contexts, devices without remote context have none
+    std::vector<std::pair<std::size_t, RemoteContext::Ptr>> users;
+    TensorDesc tensorDesc;
+    for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+        auto& network = _inferRequests[requestId]._network;
+        auto outputs = network.GetOutputsInfo();
+        auto inputs = network.GetInputsInfo();
+        auto itOutput = outputs.find(name);
+        auto itInput = inputs.find(name);
+        if (itOutput == outputs.end() && itInput == inputs.end()) {
+            continue;
+        }
+        const auto& desc = itOutput != outputs.end() ? itOutput->second->getTensorDesc()
+                                                     : itInput->second->getTensorDesc();
+        if (users.empty()) {
+            tensorDesc = desc;
+        } else if (!(tensorDesc == desc)) {
+            // the devices need different precisions or layouts, so the blob has to be converted anyway
+            return;
+        }
+        RemoteContext::Ptr context;
+        try {
+            context = network.GetContext();
+        } catch (InferenceEngine::details::InferenceEngineException&) {}
+        users.emplace_back(requestId, context);
+    }
+
+    auto owner = std::find_if(users.begin(), users.end(),
+                              [](const std::pair<std::size_t, RemoteContext::Ptr>& user) { return nullptr != user.second; });
+    if (owner == users.end()) {
+        return;
+    }
+
+    SharedBlobDesc shared;
+    for (auto&& user : users) {
+        if (user.second != owner->second) {
+            shared._hostRequests.insert(user.first);
+        }
+    }
+    if (shared._hostRequests.empty()) {
+        return;
+    }
+
+    shared._remoteBlob = owner->second->CreateBlob(tensorDesc);
+    shared._remoteBlob->allocate();
+    _blobs[name] = shared._remoteBlob;
+    _sharedBlobs[name] = std::move(shared);
+}
+
+void HeteroInferRequest::mapSharedBlobs(std::size_t requestId) {
+    for (auto&& sharedBlob : _sharedBlobs) {
+        auto& shared = sharedBlob.second;
+        if (!contains(shared._hostRequests, requestId)) {
+            continue;
+        }
+        shared._mapped.reset(new LockedMemory<void>(shared._remoteBlob->rwmap()));
+        auto hostBlob = make_blob_with_precision(shared._remoteBlob->getTensorDesc(), shared._mapped->as<void*>());
+        _inferRequests[requestId]._request->SetBlob(sharedBlob.first.c_str(), hostBlob);
+    }
+}
+
+void HeteroInferRequest::unmapSharedBlobs(std::size_t requestId) {
+    for (auto&& sharedBlob : _sharedBlobs) {
+        auto& shared = sharedBlob.second;
+        if (contains(shared._hostRequests, requestId)) {
+            shared._mapped.reset();
         }
     }
 }
 
 void HeteroInferRequest::InferImpl() {
     updateInOutIfNeeded();
-    size_t i = 0;
-    for (auto &&desc : _inferRequests) {
+    for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+        auto &desc = _inferRequests[requestId];
         IE_PROFILING_AUTO_SCOPE_TASK(desc._profilingTask);
         auto &r = desc._request;
         assert(nullptr != r);
-        r->Infer();
+        mapSharedBlobs(requestId);
+        try {
+            r->Infer();
+        } catch (...) {
+            unmapSharedBlobs(requestId);
+            throw;
+        }
+        unmapSharedBlobs(requestId);
     }
 }
 
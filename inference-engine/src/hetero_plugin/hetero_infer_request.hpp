@@ -15,6 +15,7 @@
 #include <memory>
 #include <unordered_set>
 #include <ie_common.h>
+#include <ie_remote_context.hpp>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 #include <cpp_interfaces/impl/ie_executable_network_internal.hpp>
 #include <cpp/ie_infer_request.hpp>
@@ -33,9 +34,20 @@ public:
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
+    /**
+     * @brief A blob passed between subgraphs allocated in the remote context of one of them,
+     * the sub-requests of other devices access it through the host memory mapped while they run
+     */
+    struct SharedBlobDesc {
+        InferenceEngine::RemoteBlob::Ptr                        _remoteBlob;
+        std::unordered_set<std::size_t>                         _hostRequests;
+        std::unique_ptr<InferenceEngine::LockedMemory<void>>    _mapped;
+    };
+
     explicit HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                 InferenceEngine::OutputsDataMap networkOutputs,
-                                const SubRequestsList &inferRequests);
+                                const SubRequestsList &inferRequests,
+                                bool shareBoundaryBlobs = false);
 
     void InferImpl() override;
 
@@ -43,8 +55,23 @@ public:
 
     void updateInOutIfNeeded();
 
+    /**
+     * @brief Maps the shared blobs accessed by the sub-request through the host memory and sets them to it,
+     * should be called before the sub-request is started
+     */
+    void mapSharedBlobs(std::size_t requestId);
+
+    /**
+     * @brief Unmaps the shared blobs mapped for the sub-request, should be called once it is done
+     */
+    void unmapSharedBlobs(std::size_t requestId);
+
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
+    std::map<std::string, SharedBlobDesc> _sharedBlobs;
+
+private:
+    void shareBlob(const std::string& name);
 };
 
 }  // namespace HeteroPlugin
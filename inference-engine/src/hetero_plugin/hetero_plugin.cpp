@@ -16,6 +16,7 @@
 #include "hetero/hetero_plugin_config.hpp"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
 #include "hetero_executable_network.hpp"
+#include "hetero_graph_splitter.hpp"
 #include "cpp_interfaces/base/ie_inference_plugin_api.hpp"
 
 using namespace InferenceEngine;
@@ -38,6 +39,8 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[InferenceEngine::PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS] = "YES";
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(MERGE_SUBGRAPHS)] = NO;
+    _config[HETERO_CONFIG_KEY(SHARE_BOUNDARY_BLOBS)] = NO;
 }
 
 InferenceEngine::ExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(const ICore*                     core,
@@ -298,6 +301,19 @@ void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, Que
         }
         i++;
     }
+
+    auto itMerge = config.find(HETERO_CONFIG_KEY(MERGE_SUBGRAPHS));
+    bool mergeSubgraphs = itMerge != config.end() ? itMerge->second == YES :
+                          _config.at(HETERO_CONFIG_KEY(MERGE_SUBGRAPHS)) == YES;
+    if (mergeSubgraphs) {
+        // the copies between devices can cost more than computing the layers of a small subgraph on its neighbour
+        mergeSmallSubgraphs(const_cast<ICNNNetwork&>(network),
+                            [&](const CNNLayerPtr& layer, const std::string& device) {
+                                const auto& supported = queryResults[device].supportedLayersMap;
+                                return supported.find(layer->name) != supported.end();
+                            },
+                            qr.supportedLayersMap);
+    }
 }
 
 Parameter Engine::GetMetric(const std::string& name, const std::map<std::string, Parameter> & options) const {
@@ -308,6 +324,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(MERGE_SUBGRAPHS),
+            HETERO_CONFIG_KEY(SHARE_BOUNDARY_BLOBS),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)});
     } else {
@@ -316,11 +334,13 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter> & options) const {
-    if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)) {
-        auto it = _config.find(HETERO_CONFIG_KEY(DUMP_GRAPH_DOT));
+    if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) ||
+        name == HETERO_CONFIG_KEY(MERGE_SUBGRAPHS) ||
+        name == HETERO_CONFIG_KEY(SHARE_BOUNDARY_BLOBS)) {
+        auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
-        bool dump = it->second == YES;
-        return { dump };
+        bool value = it->second == YES;
+        return { value };
     } else {
         THROW_IE_EXCEPTION << "Unsupported config key: " << name;
     }
@@ -5,9 +5,17 @@
 #include "blob_transform.hpp"
 
 #include "cpu_detector.hpp"
+#include "ie_parallel.hpp"
+#include "precision_utils.h"
 #ifdef HAVE_SSE
 #include "blob_transform_sse42.hpp"
 #endif
+#ifdef HAVE_AVX2
+#include "blob_transform_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "blob_transform_avx512.hpp"
+#endif
 
 #include <cstdint>
 #include <cstdlib>
@@ -16,12 +24,156 @@
 
 namespace InferenceEngine {
 
-template <InferenceEngine::Precision::ePrecision PRC>
+namespace {
+
+// Converts elements of the source precision to the destination one while copying them
+template <Precision::ePrecision SRC_PRC, Precision::ePrecision DST_PRC>
+struct element_converter {
+    using src_t = typename PrecisionTrait<SRC_PRC>::value_type;
+    using dst_t = typename PrecisionTrait<DST_PRC>::value_type;
+    static dst_t convert(src_t value) { return static_cast<dst_t>(value); }
+};
+
+template <Precision::ePrecision SRC_PRC>
+struct element_converter<SRC_PRC, Precision::FP16> {
+    using src_t = typename PrecisionTrait<SRC_PRC>::value_type;
+    using dst_t = ie_fp16;
+    static dst_t convert(src_t value) { return PrecisionUtils::f32tof16(static_cast<float>(value)); }
+};
+
+template <>
+struct element_converter<Precision::FP16, Precision::FP32> {
+    using src_t = ie_fp16;
+    using dst_t = float;
+    static dst_t convert(src_t value) { return PrecisionUtils::f16tof32(value); }
+};
+
+// Row kernels for the transposition of 3-channel images, C_stride is the distance between planes
+template <typename src_t, typename dst_t>
+using split_c3_row_t = void (*)(const src_t* src, dst_t* dst, size_t C_stride, int W);
+
+template <typename src_t, typename dst_t>
+using merge_c3_row_t = void (*)(const src_t* src, size_t C_stride, dst_t* dst, int W);
+
+template <typename src_t, typename dst_t, void (*kernel)(const src_t*, dst_t*, dst_t*, dst_t*, int)>
+void split_c3_row(const src_t* src, dst_t* dst, size_t C_stride, int W) {
+    kernel(src, dst, dst + C_stride, dst + 2 * C_stride, W);
+}
+
+template <typename src_t, typename dst_t, void (*kernel)(const src_t*, const src_t*, const src_t*, dst_t*, int)>
+void merge_c3_row(const src_t* src, size_t C_stride, dst_t* dst, int W) {
+    kernel(src, src + C_stride, src + 2 * C_stride, dst, W);
+}
+
+#ifdef HAVE_SSE
+// SSE4.2 code processes a single row if called for one image of one row height
+void split_c3_row_u8_sse42(const uint8_t* src, uint8_t* dst, size_t C_stride, int W) {
+    blob_copy_4d_split_u8c3(src, dst, 0, 0, 0, 0, C_stride, 1, 1, W);
+}
+
+void split_c3_row_f32_sse42(const float* src, float* dst, size_t C_stride, int W) {
+    blob_copy_4d_split_f32c3(src, dst, 0, 0, 0, 0, C_stride, 1, 1, W);
+}
+
+void merge_c3_row_u8_sse42(const uint8_t* src, size_t C_stride, uint8_t* dst, int W) {
+    blob_copy_4d_merge_u8c3(src, dst, 0, 0, C_stride, 0, 0, 1, 1, W);
+}
+
+void merge_c3_row_f32_sse42(const float* src, size_t C_stride, float* dst, int W) {
+    blob_copy_4d_merge_f32c3(src, dst, 0, 0, C_stride, 0, 0, 1, 1, W);
+}
+#endif  // HAVE_SSE
+
+// Picks the widest vectored row kernel the CPU supports, nullptr if there are none for the pair
+template <typename src_t, typename dst_t>
+struct c3_row_kernels {
+    static split_c3_row_t<src_t, dst_t> split() { return nullptr; }
+    static merge_c3_row_t<src_t, dst_t> merge() { return nullptr; }
+};
+
+template <>
+struct c3_row_kernels<uint8_t, uint8_t> {
+    static split_c3_row_t<uint8_t, uint8_t> split() {
+#ifdef HAVE_AVX512
+        if (with_cpu_x86_avx512_core()) return split_c3_row<uint8_t, uint8_t, avx512::blob_copy_row_split_u8c3>;
+#endif
+#ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) return split_c3_row<uint8_t, uint8_t, avx::blob_copy_row_split_u8c3>;
+#endif
+#ifdef HAVE_SSE
+        if (with_cpu_x86_sse42()) return split_c3_row_u8_sse42;
+#endif
+        return nullptr;
+    }
+
+    static merge_c3_row_t<uint8_t, uint8_t> merge() {
+#ifdef HAVE_AVX512
+        if (with_cpu_x86_avx512_core()) return merge_c3_row<uint8_t, uint8_t, avx512::blob_copy_row_merge_u8c3>;
+#endif
+#ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) return merge_c3_row<uint8_t, uint8_t, avx::blob_copy_row_merge_u8c3>;
+#endif
+#ifdef HAVE_SSE
+        if (with_cpu_x86_sse42()) return merge_c3_row_u8_sse42;
+#endif
+        return nullptr;
+    }
+};
+
+template <>
+struct c3_row_kernels<float, float> {
+    static split_c3_row_t<float, float> split() {
+#ifdef HAVE_AVX512
+        if (with_cpu_x86_avx512_core()) return split_c3_row<float, float, avx512::blob_copy_row_split_f32c3>;
+#endif
+#ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) return split_c3_row<float, float, avx::blob_copy_row_split_f32c3>;
+#endif
+#ifdef HAVE_SSE
+        if (with_cpu_x86_sse42()) return split_c3_row_f32_sse42;
+#endif
+        return nullptr;
+    }
+
+    static merge_c3_row_t<float, float> merge() {
+#ifdef HAVE_AVX512
+        if (with_cpu_x86_avx512_core()) return merge_c3_row<float, float, avx512::blob_copy_row_merge_f32c3>;
+#endif
+#ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) return merge_c3_row<float, float, avx::blob_copy_row_merge_f32c3>;
+#endif
+#ifdef HAVE_SSE
+        if (with_cpu_x86_sse42()) return merge_c3_row_f32_sse42;
+#endif
+        return nullptr;
+    }
+};
+
+template <>
+struct c3_row_kernels<uint8_t, float> {
+    static split_c3_row_t<uint8_t, float> split() {
+#ifdef HAVE_AVX512
+        if (with_cpu_x86_avx512_core()) return split_c3_row<uint8_t, float, avx512::blob_copy_row_split_u8c3_to_f32>;
+#endif
+#ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) return split_c3_row<uint8_t, float, avx::blob_copy_row_split_u8c3_to_f32>;
+#endif
+        return nullptr;
+    }
+
+    static merge_c3_row_t<uint8_t, float> merge() { return nullptr; }
+};
+
+}  // namespace
+
+template <Precision::ePrecision SRC_PRC, Precision::ePrecision DST_PRC>
 static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
-    using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
+    using converter = element_converter<SRC_PRC, DST_PRC>;
+    using src_t = typename converter::src_t;
+    using dst_t = typename converter::dst_t;
 
-    auto* src_ptr = src->buffer().as<data_t*>();
-    auto* dst_ptr = dst->buffer().as<data_t*>();
+    const auto* src_ptr = src->buffer().as<const src_t*>();
+    auto* dst_ptr = dst->buffer().as<dst_t*>();
 
     SizeVector dims = src->getTensorDesc().getDims();
 
@@ -46,102 +198,89 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto C_dst_stride = dst_l == NHWC ? dst_strides[3] : dst_strides[1];
     const auto H_dst_stride = dst_l == NHWC ? dst_strides[1] : dst_strides[2];
     const auto W_dst_stride = dst_l == NHWC ? dst_strides[2] : dst_strides[3];
-
-    src_ptr += dst_blk_desc.getOffsetPadding();
-
-#ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
+    dst_ptr += dst_blk_desc.getOffsetPadding();
+
+    // Rows of all images are independent, so they are split between threads
+    if (src_l == NHWC && dst_l == NCHW && C == 3 && C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1) {
+        if (auto split_row = c3_row_kernels<src_t, dst_t>::split()) {
+            parallel_for2d(N, H, [&](size_t n, size_t h) {
+                split_row(src_ptr + n * N_src_stride + h * H_src_stride, dst_ptr + n * N_dst_stride + h * H_dst_stride,
+                          C_dst_stride, static_cast<int>(W));
+            });
             return;
         }
     }
 
-    if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
+    if (src_l == NCHW && dst_l == NHWC && C == 3 && C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1) {
+        if (auto merge_row = c3_row_kernels<src_t, dst_t>::merge()) {
+            parallel_for2d(N, H, [&](size_t n, size_t h) {
+                merge_row(src_ptr + n * N_src_stride + h * H_src_stride, C_src_stride,
+                          dst_ptr + n * N_dst_stride + h * H_dst_stride, static_cast<int>(W));
+            });
             return;
         }
     }
-#endif  // HAVE_SSE
 
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
-                }
+    if (src_l != dst_l) {
+        parallel_for3d(N, C, H, [&](size_t n, size_t c, size_t h) {
+            const src_t* src_row = src_ptr + n * N_src_stride + c * C_src_stride + h * H_src_stride;
+            dst_t* dst_row = dst_ptr + n * N_dst_stride + c * C_dst_stride + h * H_dst_stride;
+            for (size_t w = 0; w < W; w++) {
+                dst_row[w * W_dst_stride] = converter::convert(src_row[w * W_src_stride]);
             }
-        }
+        });
     } else {
-        for (int i = 0; i < N * C * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        const size_t total = N * C * H * W;
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(total, nthr, ithr, start, end);
+            for (size_t i = start; i < end; i++) {
+                dst_ptr[i] = converter::convert(src_ptr[i]);
+            }
+        });
     }
 }
 
 static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
-    switch (src->getTensorDesc().getPrecision()) {
-    case Precision::FP32:
-    case Precision::I32:
-        blob_copy_4d_t<Precision::FP32>(src, dst);
-        break;
-
-    case Precision::FP16:
-    case Precision::U16:
-    case Precision::I16:
-        blob_copy_4d_t<Precision::U16>(src, dst);
-        break;
-
-    case Precision::U8:
-    case Precision::I8:
-        blob_copy_4d_t<Precision::U8>(src, dst);
-        break;
+    const auto src_precision = src->getTensorDesc().getPrecision();
+    const auto dst_precision = dst->getTensorDesc().getPrecision();
+
+    if (src_precision == dst_precision) {
+        switch (src_precision) {
+        case Precision::FP32:
+        case Precision::I32:
+            blob_copy_4d_t<Precision::FP32, Precision::FP32>(src, dst);
+            break;
+
+        case Precision::FP16:
+        case Precision::U16:
+        case Precision::I16:
+            blob_copy_4d_t<Precision::U16, Precision::U16>(src, dst);
+            break;
+
+        case Precision::U8:
+        case Precision::I8:
+            blob_copy_4d_t<Precision::U8, Precision::U8>(src, dst);
+            break;
+
+        default:
+            THROW_IE_EXCEPTION << "Unsupported blob transformation for precision " << src_precision;
+        }
+        return;
+    }
 
-    default:
-        THROW_IE_EXCEPTION << "Unsupported blob transformation for precision " << src->getTensorDesc().getPrecision();
+    // The precision is converted along with the layout, so there is no intermediate blob
+    if (src_precision == Precision::U8 && dst_precision == Precision::FP32) {
+        blob_copy_4d_t<Precision::U8, Precision::FP32>(src, dst);
+    } else if (src_precision == Precision::U8 && dst_precision == Precision::FP16) {
+        blob_copy_4d_t<Precision::U8, Precision::FP16>(src, dst);
+    } else if (src_precision == Precision::FP16 && dst_precision == Precision::FP32) {
+        blob_copy_4d_t<Precision::FP16, Precision::FP32>(src, dst);
+    } else if (src_precision == Precision::FP32 && dst_precision == Precision::FP16) {
+        blob_copy_4d_t<Precision::FP32, Precision::FP16>(src, dst);
+    } else {
+        THROW_IE_EXCEPTION << "Unimplemented blob transformation from precision " << src_precision << " to "
+                           << dst_precision;
     }
 }
 
@@ -287,13 +426,15 @@ void blob_copy(Blob::Ptr src, Blob::Ptr dst) {
 
     if (dst->buffer() == nullptr) THROW_IE_EXCEPTION << "Cannot copy blob data. Destination is not allocated.";
 
-    if (src->getTensorDesc().getPrecision() != dst->getTensorDesc().getPrecision())
-        THROW_IE_EXCEPTION << "Unimplemented blob transformation from precision " << src->getTensorDesc().getPrecision()
-                           << " to " << src->getTensorDesc().getPrecision();
-
     if (src->getTensorDesc().getDims() != dst->getTensorDesc().getDims())
         THROW_IE_EXCEPTION << "Unimplemented blob transformation from different shapes ";
 
+    // 4d blobs may also change precision, see blob_copy_4d
+    if (src->getTensorDesc().getDims().size() != 4 &&
+        src->getTensorDesc().getPrecision() != dst->getTensorDesc().getPrecision())
+        THROW_IE_EXCEPTION << "Unimplemented blob transformation from precision " << src->getTensorDesc().getPrecision()
+                           << " to " << dst->getTensorDesc().getPrecision();
+
     if (src->getTensorDesc().getDims().size() == 4)
         blob_copy_4d(src, dst);
     else if (src->getTensorDesc().getDims().size() == 5)
@@ -11,6 +11,8 @@ namespace InferenceEngine {
 
 /**
  * @brief Data copy with taking into account layout and precision params
+ *
+ * 4D blobs may also be converted from U8 to FP32 or FP16 and between FP16 and FP32 within the same copy.
  */
 INFERENCE_ENGINE_API_CPP(void) blob_copy(Blob::Ptr src, Blob::Ptr dst);
 
@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace InferenceEngine;
@@ -28,6 +29,10 @@ Builder::Layer::Layer(idx_t id, const Builder::Layer& layer): Layer(layer) {
     this->id = id;
 }
 
+Builder::Layer::Layer(idx_t id, Builder::Layer&& layer): Layer(std::move(layer)) {
+    this->id = id;
+}
+
 idx_t Builder::Layer::getId() const noexcept {
     return id;
 }
@@ -9,8 +9,10 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <set>
 #include <shape_infer/ie_reshaper.hpp>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -39,20 +41,18 @@ Builder::Network::Network(const Context& ieContext, const std::string& name) {
 }
 
 Builder::Network::Network(const Context& ieContext, const INetwork& network): Network(ieContext, network.getName()) {
+    auto& layers = parameters["layers"].as<std::vector<Layer::Ptr>>();
+    auto& connections = parameters["connections"].as<std::vector<Connection>>();
+    // every connection is reported by both of its layers
+    std::set<std::tuple<idx_t, idx_t, idx_t, idx_t>> addedConnections;
     for (const auto& layer : network) {
-        parameters["layers"].as<std::vector<Layer::Ptr>>().push_back(std::make_shared<Layer>(layer));
-        const auto layerConnections = network.getLayerConnections(layer->getId());
-        for (const auto& connection : layerConnections) {
-            bool found = false;
-            for (const auto& con : parameters["connections"].as<std::vector<Connection>>()) {
-                if (con == connection) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                parameters["connections"].as<std::vector<Connection>>().push_back(connection);
-            }
+        layers.push_back(std::make_shared<Layer>(layer));
+        for (const auto& connection : network.getLayerConnections(layer->getId())) {
+            if (addedConnections
+                    .emplace(connection.from().layerId(), connection.from().portId(), connection.to().layerId(),
+                             connection.to().portId())
+                    .second)
+                connections.push_back(connection);
         }
     }
 }
@@ -89,8 +89,9 @@ Builder::Network::Network(const Context& ieContext, const ICNNNetwork& network):
             if (!lockedData) continue;
             inputsCount++;
         }
-        const auto layer = builderFromCNNLayer(cnnLayer);
-        idx_t layerId = addLayer(layer);
+        auto layer = builderFromCNNLayer(cnnLayer);
+        const auto layerName = layer.getName();
+        idx_t layerId = addLayer(std::move(layer));
 
         if (blobs.find("weights") != blobs.end()) {
             idx_t constLayerId = addLayer(ConstLayer("weights").setData(blobs["weights"]));
@@ -107,7 +108,7 @@ Builder::Network::Network(const Context& ieContext, const ICNNNetwork& network):
             idx_t constLayerId = addLayer(ConstLayer(it.first).setData(it.second));
             connect({constLayerId}, {layerId, inputsCount++});
         }
-        name2id[layer.getName()] = layerId;
+        name2id[layerName] = layerId;
         return layerId;
     };
 
@@ -260,55 +261,92 @@ std::vector<Builder::Layer::Ptr>& Builder::Network::getLayers() {
 }
 
 idx_t Builder::Network::addLayer(const std::vector<PortInfo>& inputs, const Layer& layer) {
+    return addLayer(inputs, Layer(layer));
+}
+
+idx_t Builder::Network::addLayer(const std::vector<PortInfo>& inputs, Layer&& layer) {
     IE_PROFILING_AUTO_SCOPE(Builder::Network::addLayer)
-    auto layer_id = addLayer(layer);
+    auto layer_id = addLayer(std::move(layer));
     for (size_t i = 0; i < inputs.size(); i++) {
         connect({inputs[i].layerId(), inputs[i].portId()}, {layer_id, i});
     }
     return layer_id;
 }
 
-idx_t Builder::Network::addLayer(const Layer& layer) {
-    auto getAvailableId = [&](idx_t defaultId) {
-        if (defaultId == (std::numeric_limits<idx_t>::max)()) defaultId = 0;
+namespace {
 
-        auto it = parameters["layers"].as<std::vector<Layer::Ptr>>().begin();
-        while (it != parameters["layers"].as<std::vector<Layer::Ptr>>().end()) {
-            for (it = parameters["layers"].as<std::vector<Layer::Ptr>>().begin();
-                 it != parameters["layers"].as<std::vector<Layer::Ptr>>().end(); it++) {
-                if ((*it)->getId() == defaultId) {
-                    defaultId++;
-                    break;
-                }
-            }
+// The ids and the names taken by the layers of the network, so the new layers get the unique ones without
+// looking through the layers again for every candidate
+class LayerNames {
+public:
+    explicit LayerNames(const std::vector<Builder::Layer::Ptr>& layers) {
+        for (const auto& layer : layers) {
+            ids.insert(layer->getId());
+            names.insert(layer->getName());
         }
+    }
+
+    idx_t takeId(idx_t defaultId) {
+        if (defaultId == (std::numeric_limits<idx_t>::max)()) defaultId = 0;
+        while (ids.find(defaultId) != ids.end()) defaultId++;
+        ids.insert(defaultId);
         return defaultId;
-    };
-    auto generateAvailableName = [&](const std::string& name, idx_t id) {
+    }
+
+    std::string takeName(const std::string& name, idx_t id) {
         const std::string idName = "id" + std::to_string(id);
         std::string generatedName(name);
         if (generatedName.empty()) generatedName = idName;
-        bool nameIsUnique(false);
-        while (!nameIsUnique) {
-            nameIsUnique = true;
-            for (const auto& layer : parameters["layers"].as<std::vector<Layer::Ptr>>()) {
-                if (generatedName == layer->getName()) {
-                    nameIsUnique = false;
-                    generatedName += "_" + idName;
-                }
-            }
-        }
+        while (names.find(generatedName) != names.end()) generatedName += "_" + idName;
+        names.insert(generatedName);
         return generatedName;
-    };
-    idx_t generatedId = getAvailableId(layer.getId());
-    const auto name = generateAvailableName(layer.getName(), generatedId);
-    parameters["layers"].as<std::vector<Layer::Ptr>>().emplace_back(std::make_shared<Layer>(generatedId, layer));
-    parameters["layers"]
-        .as<std::vector<Layer::Ptr>>()[parameters["layers"].as<std::vector<Layer::Ptr>>().size() - 1]
-        ->setName(name);
+    }
+
+private:
+    std::unordered_set<idx_t> ids;
+    std::unordered_set<std::string> names;
+};
+
+idx_t insertLayer(std::vector<Builder::Layer::Ptr>& layers, LayerNames& names, Builder::Layer&& layer) {
+    idx_t generatedId = names.takeId(layer.getId());
+    const auto name = names.takeName(layer.getName(), generatedId);
+    layers.emplace_back(std::make_shared<Builder::Layer>(generatedId, std::move(layer)));
+    layers.back()->setName(name);
     return generatedId;
 }
 
+}  // namespace
+
+idx_t Builder::Network::addLayer(const Layer& layer) {
+    return addLayer(Layer(layer));
+}
+
+idx_t Builder::Network::addLayer(Layer&& layer) {
+    auto& layers = getLayers();
+    LayerNames names(layers);
+    return insertLayer(layers, names, std::move(layer));
+}
+
+std::vector<idx_t> Builder::Network::addLayers(const std::vector<Layer>& layers) {
+    auto& networkLayers = getLayers();
+    networkLayers.reserve(networkLayers.size() + layers.size());
+    LayerNames names(networkLayers);
+    std::vector<idx_t> ids;
+    ids.reserve(layers.size());
+    for (const auto& layer : layers) ids.push_back(insertLayer(networkLayers, names, Layer(layer)));
+    return ids;
+}
+
+std::vector<idx_t> Builder::Network::addLayers(std::vector<Layer>&& layers) {
+    auto& networkLayers = getLayers();
+    networkLayers.reserve(networkLayers.size() + layers.size());
+    LayerNames names(networkLayers);
+    std::vector<idx_t> ids;
+    ids.reserve(layers.size());
+    for (auto& layer : layers) ids.push_back(insertLayer(networkLayers, names, std::move(layer)));
+    return ids;
+}
+
 void Builder::Network::connect(const PortInfo& input, const PortInfo& output) {
     const auto mergePortData = [&]() -> bool {
         const auto blobEqualOrEmpty = [](const Blob::Ptr& ref, const Blob::Ptr& test) -> bool {
@@ -400,8 +438,13 @@ void Builder::Network::disconnect(const Connection& connection) {
 
 const INetwork::CPtr Builder::Network::build() {
     validate();
+    // The layers are copied directly, the copy through INetwork builds every layer again on each lookup
     InferenceEngine::Builder::Network::Ptr network =
-        std::make_shared<InferenceEngine::Builder::Network>(static_cast<const INetwork&>(*this));
+        std::make_shared<InferenceEngine::Builder::Network>(getContext(), getName());
+    auto& layers = network->getLayers();
+    layers.reserve(getLayers().size());
+    for (const auto& layer : getLayers()) layers.push_back(std::make_shared<Layer>(*layer));
+    network->parameters["connections"] = getConnections();
     return network;
 }
 
@@ -633,7 +676,7 @@ const std::vector<Connection>& Builder::Network::getConnections() const {
 const std::vector<Connection> Builder::Network::getLayerConnections(idx_t layerId) const noexcept {
     std::vector<Connection> layerConnections;
     try {
-        for (const auto connection : parameters.at("connections").as<std::vector<Connection>>()) {
+        for (const auto& connection : parameters.at("connections").as<std::vector<Connection>>()) {
             if (connection.from().layerId() == layerId || connection.to().layerId() == layerId)
                 layerConnections.push_back(connection);
         }
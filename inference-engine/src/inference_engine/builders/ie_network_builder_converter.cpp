@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <vector>
+#include <unordered_map>
 #include <unordered_set>
 #include <string>
 
@@ -189,8 +190,37 @@ const std::shared_ptr<ICNNNetwork> Builder::convertToICNNNetwork(const INetwork:
 
     std::unique_ptr<details::CNNNetworkImpl> cnnNetworkImpl(new details::CNNNetworkImpl());
 
-    Precision detectedPrecision = Precision::UNSPECIFIED;
+    // The layers and their connections are collected once, as the lookups of INetwork are linear in its size
+    std::vector<ILayer::CPtr> layers;
+    std::unordered_map<idx_t, ILayer::CPtr> layersById;
     for (const auto& layer : *network) {
+        layers.push_back(layer);
+        layersById[layer->getId()] = layer;
+    }
+    std::unordered_map<idx_t, std::vector<Connection>> layersConnections;
+    if (auto builderNetwork = std::dynamic_pointer_cast<const Builder::Network>(network)) {
+        for (const auto& connection : builderNetwork->getConnections()) {
+            layersConnections[connection.from().layerId()].push_back(connection);
+            if (connection.to().layerId() != connection.from().layerId())
+                layersConnections[connection.to().layerId()].push_back(connection);
+        }
+    } else {
+        for (const auto& layer : layers)
+            layersConnections[layer->getId()] = network->getLayerConnections(layer->getId());
+    }
+    auto getLayer = [&](idx_t layerId) -> const ILayer::CPtr& {
+        auto it = layersById.find(layerId);
+        if (it == layersById.end())
+            THROW_IE_EXCEPTION << "Cannot find layer with id: " << layerId;
+        return it->second;
+    };
+    auto getLayerConnections = [&](idx_t layerId) -> const std::vector<Connection>& {
+        return layersConnections[layerId];
+    };
+    std::unordered_map<idx_t, CNNLayerPtr> cnnLayers;
+
+    Precision detectedPrecision = Precision::UNSPECIFIED;
+    for (const auto& layer : layers) {
         for (const auto& port : layer->getInputPorts()) {
             Precision prc = port.getData()->getData()->getTensorDesc().getPrecision();
             if (prc != Precision::UNSPECIFIED) {
@@ -214,14 +244,14 @@ const std::shared_ptr<ICNNNetwork> Builder::convertToICNNNetwork(const INetwork:
     details::CaselessEq<std::string> eq;
     cnnNetworkImpl->setName(network->getName());
     cnnNetworkImpl->setPrecision(Precision::UNSPECIFIED);
-    for (const auto& layer : *network) {
+    for (const auto& layer : layers) {
         bool isInternalLayer = eq(layer->getType(), "Const");
-        for (const auto& connection : network->getLayerConnections(layer->getId())) {
+        for (const auto& connection : getLayerConnections(layer->getId())) {
             if (!isInternalLayer)
                 break;
             if (connection.from().layerId() != layer->getId())
                 continue;
-            const auto& port = network->getLayer(connection.to().layerId())->getInputPorts()[connection.to().portId()];
+            const auto& port = getLayer(connection.to().layerId())->getInputPorts()[connection.to().portId()];
             isInternalLayer = isInternalLayer &&
                     port.getParameters().find("type") != port.getParameters().end();
         }
@@ -240,7 +270,7 @@ const std::shared_ptr<ICNNNetwork> Builder::convertToICNNNetwork(const INetwork:
             cnnNetworkImpl->setPrecision(Precision::MIXED);
         }
 
-        auto connections = network->getLayerConnections(layer->getId());
+        const auto& connections = getLayerConnections(layer->getId());
         std::unordered_set<idx_t> inputNum, outputNum;
         for (const auto& connection : connections) {
             if (connection.from().layerId() != layer->getId()) {
@@ -254,27 +284,28 @@ const std::shared_ptr<ICNNNetwork> Builder::convertToICNNNetwork(const INetwork:
         cnnLayer->insData.resize(inputNum.size());
         cnnLayer->outData.resize(outputNum.size());
         cnnNetworkImpl->addLayer(cnnLayer);
+        cnnLayers[layer->getId()] = cnnLayer;
     }
 
-    for (const auto& layer : *network) {
-        auto connections = network->getLayerConnections(layer->getId());
-        CNNLayerPtr cnnLayer;
-        StatusCode sts = cnnNetworkImpl->getLayerByName(layer->getName().c_str(), cnnLayer, nullptr);
+    for (const auto& layer : layers) {
+        const auto& connections = getLayerConnections(layer->getId());
+        auto cnnLayerIt = cnnLayers.find(layer->getId());
 
-        if (sts != OK && (eq(layer->getType(), "Output") || eq(layer->getType(), "Const")))
+        if (cnnLayerIt == cnnLayers.end() && (eq(layer->getType(), "Output") || eq(layer->getType(), "Const")))
             continue;
-        else if (sts != OK)
+        else if (cnnLayerIt == cnnLayers.end())
             THROW_IE_EXCEPTION << "Cannot find CNNLayer by name " << layer->getName();
+        const CNNLayerPtr& cnnLayer = cnnLayerIt->second;
 
         for (const auto& connection : connections) {
             if (connection.from().layerId() != layer->getId())
                 continue;
 
-            const auto& outLayer = network->getLayer(connection.to().layerId());
+            const auto& outLayer = getLayer(connection.to().layerId());
 
-            CNNLayerPtr cnnOutLayer;
-            sts = cnnNetworkImpl->getLayerByName(outLayer->getName().c_str(), cnnOutLayer, nullptr);
-            if (sts != OK && !eq(outLayer->getType(), "Output") && !eq(layer->getType(), "Const"))
+            auto cnnOutLayerIt = cnnLayers.find(outLayer->getId());
+            CNNLayerPtr cnnOutLayer = cnnOutLayerIt != cnnLayers.end() ? cnnOutLayerIt->second : nullptr;
+            if (!cnnOutLayer && !eq(outLayer->getType(), "Output") && !eq(layer->getType(), "Const"))
                 THROW_IE_EXCEPTION << "Cannot find CNNLayer by name " << outLayer->getName();
 
             std::string dataName = layer->getName();
@@ -291,7 +322,7 @@ const std::shared_ptr<ICNNNetwork> Builder::convertToICNNNetwork(const INetwork:
             cnnLayer->outData[connection.from().portId()] = data;
 
             idx_t realPortId(0);
-            const auto inputPorts = outLayer->getInputPorts();
+            const auto& inputPorts = outLayer->getInputPorts();
             for (size_t i = 0; i < connection.to().portId() && i < inputPorts.size(); i++) {
                 if (inputPorts[i].getParameters().find("type") == inputPorts[i].getParameters().end())
                     realPortId++;
@@ -187,6 +187,14 @@ using details::CNNNetworkNGraphImpl;
 using InferenceEngine::details::CNNNetworkNGraphImpl;
 using ngraph::Function;
 
+// TODO: remove this code after the fix on the nGraph side
+static void eliminateGetOutputElements(const std::shared_ptr<ngraph::Function>& func) {
+    ::ngraph::pass::GetOutputElementElimination goe_elimination;
+    for (auto n : func->get_ops()) {
+        goe_elimination.run_on_node(n);
+    }
+}
+
 static std::shared_ptr<ngraph::Function> copyFunction(const std::shared_ptr<ngraph::Function>& func,
                                                       bool constFolding,
                                                       const std::map<std::string, std::vector<size_t>>& inputShapes) {
@@ -209,14 +217,36 @@ static std::shared_ptr<ngraph::Function> copyFunction(const std::shared_ptr<ngra
 
     auto specialized_function = ::ngraph::specialize_function(func, new_types, new_shapes,
                                                               std::vector<void*>(new_shapes.size(), nullptr), constFolding, true);
-    // TODO: remove this code after the fix on the nGraph side
-    ::ngraph::pass::GetOutputElementElimination goe_elimination;
-    for (auto n : specialized_function->get_ops()) {
-        goe_elimination.run_on_node(n);
-    }
+    eliminateGetOutputElements(specialized_function);
     return specialized_function;
 }
 
+// Revalidates only the nodes which depend on the changed ones, the changed nodes are added to the set
+static void revalidateDownstream(const std::shared_ptr<ngraph::Function>& func,
+                                 std::unordered_set<::ngraph::Node*>& changedNodes) {
+    for (const auto& op : func->get_ordered_ops()) {
+        if (changedNodes.find(op.get()) != changedNodes.end())
+            continue;
+        for (const auto& input : op->inputs()) {
+            if (changedNodes.find(input.get_source_output().get_node()) != changedNodes.end()) {
+                op->revalidate_and_infer_types();
+                changedNodes.insert(op.get());
+                break;
+            }
+        }
+    }
+}
+
+static bool hasStaticShapes(const std::shared_ptr<ngraph::Function>& func) {
+    for (const auto& op : func->get_ops()) {
+        for (const auto& output : op->outputs()) {
+            if (output.get_partial_shape().is_dynamic())
+                return false;
+        }
+    }
+    return true;
+}
+
 // WA: for cnnNetwork ngraph constructor
 CNNNetwork::CNNNetwork(const std::shared_ptr<ngraph::Function>& graph) {
 #if defined(ENABLE_NGRAPH)
@@ -494,6 +524,7 @@ CNNNetworkNGraphImpl::reshape(const std::map<std::string, std::vector<size_t>>&
         return cnnNetwork->reshape(inputShapes, responseDesc);
     try {
         auto params = _ngraph_function->get_parameters();
+        std::unordered_set<::ngraph::Node*> changedNodes;
 
         for (size_t i = 0; i < params.size(); i++) {
             const auto& param = params[i];
@@ -503,11 +534,31 @@ CNNNetworkNGraphImpl::reshape(const std::map<std::string, std::vector<size_t>>&
             auto newParam = std::make_shared<::ngraph::op::Parameter>(param->get_element_type(), shape);
             newParam->set_friendly_name(param->get_friendly_name());
             _ngraph_function->replace_parameter(i, newParam);
+            changedNodes.insert(newParam.get());
+        }
+
+        const bool incremental = !changedNodes.empty() && !_data.empty();
+        if (incremental) {
+            revalidateDownstream(_ngraph_function, changedNodes);
+        } else {
+            _ngraph_function->validate_nodes_and_infer_types();
         }
-        _ngraph_function->validate_nodes_and_infer_types();
 
         if (cnnNetwork) {
             convertToCNNNetworkImpl();
+        } else if (incremental && hasStaticShapes(_ngraph_function)) {
+            // All the shapes are known without constant folding, so the datas are updated from the function itself
+            // instead of its specialized copy. The datas of the nodes the specialized copy folds are absent.
+            for (const auto& node : changedNodes) {
+                for (const auto& output : node->outputs()) {
+                    std::string outName = node->get_friendly_name();
+                    if (node->outputs().size() != 1)
+                        outName += "." + std::to_string(output.get_index());
+                    auto it = _data.find(outName);
+                    if (it != _data.end())
+                        createDataForResult(output, outName, it->second);
+                }
+            }
         } else {
             auto specialized_ngraph_function = cloneFunction(true, inputShapes);
             // Call this transformation because OneHot IE and nGraph have different output precisions
@@ -641,9 +692,25 @@ void CNNNetworkNGraphImpl::convertToCNNNetworkImpl() {
     if (cnnNetwork && !networksEqual)
         return;
     IE_PROFILING_AUTO_SCOPE(convertToCNNNetworkImpl)
+    convertFunction(cloneFunction());
+}
+
+void CNNNetworkNGraphImpl::convertToCNNNetworkImplInPlace() {
+    if (!cnnNetwork) {
+        IE_PROFILING_AUTO_SCOPE(convertToCNNNetworkImplInPlace)
+        eliminateGetOutputElements(_ngraph_function);
+        convertFunction(_ngraph_function);
+    }
+    // The converted function keeps the Constants the blobs of the layers point to,
+    // the rest of the network is represented by CNNNetworkImpl only since now
+    _ngraph_function.reset();
+    networksEqual = false;
+}
+
+void CNNNetworkNGraphImpl::convertFunction(const std::shared_ptr<::ngraph::Function>& function) {
     InputsDataMap thisInputDataMap;
     getInputsInfo(thisInputDataMap);
-    _converted_function = cloneFunction();
+    _converted_function = function;
     cnnNetwork.reset();
     convertFunctionToICNNNetwork(_converted_function, cnnNetwork);
 
@@ -1227,6 +1294,9 @@ void CNNNetworkNGraphImpl::convertFunctionToICNNNetwork(std::shared_ptr<::ngraph
 }
 
 std::shared_ptr<CNNNetworkNGraphImpl> CNNNetworkNGraphImpl::cloneNGraphImpl() const {
+    if (!_ngraph_function) {
+        THROW_IE_EXCEPTION << "Cannot clone the network, its nGraph function was released by the in-place conversion";
+    }
     auto result = std::make_shared<CNNNetworkNGraphImpl>(cloneFunction());
     for (const auto& outputInfo : _outputData) {
         result->_outputData[outputInfo.first]->setPrecision(outputInfo.second->getPrecision());
@@ -106,6 +106,14 @@ public:
 
     void convertToCNNNetworkImpl();
 
+    /**
+     * @brief Converts the function to CNNNetworkImpl without copying it, so the blobs of the layers are views
+     * over the Constants of the function and the peak memory is not doubled. The function is modified by the
+     * conversion and is not available after it, so it is only for the networks owning their function,
+     * e.g. the ones created with cloneNGraphImpl()
+     */
+    void convertToCNNNetworkImplInPlace();
+
     std::shared_ptr<CNNNetworkNGraphImpl> cloneNGraphImpl() const;
     void transformConstants();
 protected:
@@ -133,6 +141,11 @@ private:
     void createDataForResult(const ::ngraph::Output<::ngraph::Node>& output, const std::string& outName, DataPtr& ptr);
     void convertFunctionToICNNNetwork(std::shared_ptr<::ngraph::Function>& graph, std::shared_ptr<CNNNetworkImpl>& cnnNetwork) const;
 
+    /**
+     * @brief Converts the function to cnnNetwork, keeping the function as the converted one
+     */
+    void convertFunction(const std::shared_ptr<::ngraph::Function>& function);
+
     /**
      * @brief Reshape on the same shape
      */
@@ -7,8 +7,11 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "cpp_interfaces/base/ie_memory_state_base.hpp"
 #include "cpp_interfaces/exception2status.hpp"
+#include "cpp_interfaces/interface/ie_imemory_state_internal.hpp"
 #include "ie_iinfer_request.hpp"
 #include "ie_preprocess.hpp"
 #include "ie_profiling.hpp"
@@ -85,6 +88,32 @@ public:
         TO_STATUS(_impl->SetBatch(batch_size));
     }
 
+    StatusCode SetPriority(int priority, ResponseDesc* resp) noexcept override {
+        TO_STATUS(_impl->SetPriority(priority));
+    }
+
+    StatusCode GetCompletionFd(int& fd, ResponseDesc* resp) noexcept override {
+        TO_STATUS(fd = _impl->GetCompletionFd());
+    }
+
+    StatusCode QueryState(IMemoryState::Ptr& pState, size_t idx, ResponseDesc* resp) noexcept override {
+        std::vector<IMemoryStateInternal::Ptr> states;
+        StatusCode status;
+        TO_STATUSVAR(states = _impl->QueryState(), status, resp);
+        if (status != OK) {
+            return status;
+        }
+        if (idx >= states.size()) {
+            return OUT_OF_BOUNDS;
+        }
+        TO_STATUS(pState = std::make_shared<MemoryStateBase<IMemoryStateInternal>>(states[idx]));
+    }
+
+    StatusCode InferBatch(const BlobMap* inputs, BlobMap* outputs, size_t count, ResponseDesc* resp) noexcept override {
+        IE_PROFILING_AUTO_SCOPE(InferBatch);
+        TO_STATUS(_impl->InferBatch(inputs, outputs, count));
+    }
+
 protected:
     ~InferRequestBase() = default;
 };
@@ -47,6 +47,10 @@ public:
     StatusCode GetLastState(Blob::CPtr& lastState, ResponseDesc* resp) const noexcept override {
         TO_STATUS(lastState = impl->GetLastState());
     }
+
+    StatusCode BindState(Blob::Ptr state, ResponseDesc* resp) noexcept override {
+        TO_STATUS(impl->BindState(state));
+    }
 };
 
 }  // namespace InferenceEngine
\ No newline at end of file
@@ -5,12 +5,17 @@
 #include "cpp_interfaces/ie_executor_manager.hpp"
 #include "cpp_interfaces/ie_task_executor.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace InferenceEngine {
 
 ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
+    std::lock_guard<std::mutex> lock(mutex);
     auto foundEntry = executors.find(id);
     if (foundEntry == executors.end()) {
         auto newExec = std::make_shared<TaskExecutor>(id);
@@ -20,13 +25,53 @@ ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
     return foundEntry->second;
 }
 
+int ExecutorManagerImpl::reserveCores(int count, int coresNum) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (coresNum <= 0) return 0;
+    const int rangeSize = std::min(std::max(count, 0), coresNum);
+
+    std::vector<int> reservations(coresNum, 0);
+    for (auto&& range : reservedCores) {
+        for (int i = 0; i < std::min(range.second, coresNum); i++) {
+            reservations[(range.first + i) % coresNum]++;
+        }
+    }
+
+    // the range with the fewest reservations of its cores, the lowest first core among equal ones
+    int firstCore = 0;
+    int minReservations = std::numeric_limits<int>::max();
+    for (int first = 0; first < coresNum; first++) {
+        int rangeReservations = 0;
+        for (int i = 0; i < rangeSize; i++) {
+            rangeReservations += reservations[(first + i) % coresNum];
+        }
+        if (rangeReservations < minReservations) {
+            minReservations = rangeReservations;
+            firstCore = first;
+        }
+    }
+    reservedCores.emplace_back(firstCore, count);
+    return firstCore;
+}
+
+void ExecutorManagerImpl::releaseCores(int firstCore, int count) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto range = std::find(reservedCores.begin(), reservedCores.end(), std::make_pair(firstCore, count));
+    if (range != reservedCores.end()) {
+        reservedCores.erase(range);
+    }
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
+    std::lock_guard<std::mutex> lock(mutex);
     return executors.size();
 }
 
 void ExecutorManagerImpl::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
     executors.clear();
+    reservedCores.clear();
 }
 
 ExecutorManager* ExecutorManager::_instance = nullptr;
@@ -35,6 +80,14 @@ ITaskExecutor::Ptr ExecutorManager::getExecutor(std::string id) {
     return _impl.getExecutor(id);
 }
 
+int ExecutorManager::reserveCores(int count, int coresNum) {
+    return _impl.reserveCores(count, coresNum);
+}
+
+void ExecutorManager::releaseCores(int firstCore, int count) {
+    _impl.releaseCores(firstCore, count);
+}
+
 size_t ExecutorManager::getExecutorsNumber() {
     return _impl.getExecutorsNumber();
 }
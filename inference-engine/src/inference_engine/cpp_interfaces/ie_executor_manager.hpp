@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "cpp_interfaces/ie_itask_executor.hpp"
 #include "ie_api.h"
@@ -22,13 +24,31 @@ class ExecutorManagerImpl {
 public:
     ITaskExecutor::Ptr getExecutor(std::string id);
 
+    /**
+     * @brief Reserves a contiguous range of cores for the compute threads of a plugin. The range starts at the core
+     * with the fewest reservations, so the threads of networks loaded together (by one or different plugins) are
+     * pinned to different cores while there are vacant ones.
+     * @param count - number of cores to reserve
+     * @param coresNum - number of cores available for the compute threads, the range wraps around it
+     * @return index of the first reserved core
+     */
+    int reserveCores(int count, int coresNum);
+
+    /**
+     * @brief Releases the cores reserved with reserveCores()
+     */
+    void releaseCores(int firstCore, int count);
+
     // for tests purposes
     size_t getExecutorsNumber();
 
     void clear();
 
 private:
+    std::mutex mutex;
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
+    // reserved ranges of cores as pairs of the first core and the number of cores
+    std::vector<std::pair<int, int>> reservedCores;
 };
 
 /**
@@ -58,6 +78,22 @@ public:
      */
     ITaskExecutor::Ptr getExecutor(std::string id);
 
+    /**
+     * @brief Reserves a contiguous range of cores for the compute threads of a plugin, so the plugins pinning their
+     * threads do not oversubscribe the same cores
+     * @param count number of cores to reserve
+     * @param coresNum number of cores available for the compute threads
+     * @return index of the first reserved core, the range wraps around coresNum
+     */
+    int reserveCores(int count, int coresNum);
+
+    /**
+     * @brief Releases the cores reserved with reserveCores()
+     * @param firstCore index of the first reserved core
+     * @param count number of the reserved cores
+     */
+    void releaseCores(int firstCore, int count);
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -6,6 +6,7 @@
 
 #include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "ie_api.h"
@@ -82,6 +83,17 @@ public:
      */
     virtual void run(Task task) = 0;
 
+    /**
+     * @brief Execute InferenceEngine::Task inside task executor context with the given priority.
+     * Executors queueing the tasks start the ones with a higher priority first, the default implementation
+     * ignores the priority and calls run()
+     * @param task - task to start
+     * @param priority - priority of the task, the default priority is 0
+     */
+    virtual void runWithPriority(Task task, int priority) {
+        run(std::move(task));
+    }
+
     /**
      * @brief Execute all of the tasks and waits for its completion.
      * Default runAndWait() method implementation uses run() pure virtual method
@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_priority_task_queue.hpp
+ * @brief A header file for the task queue of the executors scheduling the tasks by priority
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "cpp_interfaces/ie_itask_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Queue of the tasks popped in the order of their priority, the tasks of the same priority are popped in the
+ *        order they are pushed.
+ *        To prevent starvation a waiting task gains one priority level per aging step of its waiting time, so a task
+ *        pushed with the priority lower by N is started first if it has waited for N aging steps longer.
+ *        As all the queued tasks age at the same rate, this is the same as ordering the tasks by the virtual
+ *        deadline `enqueue time - priority * aging step`, which does not change while the tasks wait.
+ *        Keeps the queue-wait time statistics per priority.
+ * @note  The queue is not thread-safe, it is guarded by the executor using it.
+ */
+class PriorityTaskQueue {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Queue-wait time statistics of the started tasks of a priority
+     */
+    struct WaitStats {
+        std::uint64_t _startedTasks = 0;
+        std::chrono::nanoseconds _totalWaitTime {0};
+        std::chrono::nanoseconds _maxWaitTime {0};
+    };
+
+    explicit PriorityTaskQueue(std::chrono::milliseconds agingStep = std::chrono::milliseconds {10})
+        : _agingStep(agingStep) {}
+
+    void push(Task task, int priority = 0) {
+        const auto now = Clock::now();
+        _heap.push_back({std::move(task), priority, now, now - priority * _agingStep, _pushed++});
+        std::push_heap(_heap.begin(), _heap.end(), Later {});
+    }
+
+    /**
+     * @brief Removes the task with the earliest virtual deadline from the non-empty queue and updates the statistics
+     */
+    Task pop() {
+        std::pop_heap(_heap.begin(), _heap.end(), Later {});
+        auto entry = std::move(_heap.back());
+        _heap.pop_back();
+
+        const auto waitTime = Clock::now() - entry._enqueued;
+        for (auto stats : {&_stats, &_priorityStats[entry._priority]}) {
+            stats->_startedTasks++;
+            stats->_totalWaitTime += waitTime;
+            stats->_maxWaitTime = std::max<std::chrono::nanoseconds>(stats->_maxWaitTime, waitTime);
+        }
+        return std::move(entry._task);
+    }
+
+    bool empty() const {
+        return _heap.empty();
+    }
+
+    std::size_t size() const {
+        return _heap.size();
+    }
+
+    /**
+     * @brief Statistics of all the started tasks
+     */
+    const WaitStats& waitStats() const {
+        return _stats;
+    }
+
+    /**
+     * @brief Statistics of the started tasks per priority
+     */
+    const std::map<int, WaitStats>& priorityWaitStats() const {
+        return _priorityStats;
+    }
+
+private:
+    struct Entry {
+        Task _task;
+        int _priority;
+        Clock::time_point _enqueued;
+        Clock::time_point _deadline;
+        std::uint64_t _order;
+    };
+
+    // std::push_heap keeps the greatest element first, so the later deadline is the lesser one
+    struct Later {
+        bool operator()(const Entry& lhs, const Entry& rhs) const {
+            return lhs._deadline == rhs._deadline ? lhs._order > rhs._order : lhs._deadline > rhs._deadline;
+        }
+    };
+
+    std::chrono::milliseconds _agingStep;
+    std::vector<Entry> _heap;
+    std::uint64_t _pushed = 0;
+    WaitStats _stats;
+    std::map<int, WaitStats> _priorityStats;
+};
+
+}  // namespace InferenceEngine
@@ -8,7 +8,6 @@
 #include <ie_profiling.hpp>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <string>
 #include <thread>
 #include <utility>
@@ -30,13 +29,16 @@ TaskExecutor::TaskExecutor(std::string name): _isStopped(false), _name(name) {
                     return !_taskQueue.empty() || _isStopped;
                 });
                 isQueueEmpty = _taskQueue.empty();
-                if (!isQueueEmpty) currentTask = _taskQueue.front();
+                if (!isQueueEmpty) {
+                    currentTask = _taskQueue.pop();
+                    _isTaskRunning = true;
+                }
             }
             if (_isStopped && isQueueEmpty) break;
             if (!isQueueEmpty) {
                 currentTask();
                 std::unique_lock<std::mutex> lock(_queueMutex);
-                _taskQueue.pop();
+                _isTaskRunning = false;
                 isQueueEmpty = _taskQueue.empty();
                 if (isQueueEmpty) {
                     // notify dtor, that all tasks were completed
@@ -50,9 +52,9 @@ TaskExecutor::TaskExecutor(std::string name): _isStopped(false), _name(name) {
 TaskExecutor::~TaskExecutor() {
     {
         std::unique_lock<std::mutex> lock(_queueMutex);
-        if (!_taskQueue.empty()) {
+        if (!_taskQueue.empty() || _isTaskRunning) {
             _queueCondVar.wait(lock, [this]() {
-                return _taskQueue.empty();
+                return _taskQueue.empty() && !_isTaskRunning;
             });
         }
         _isStopped = true;
@@ -65,8 +67,12 @@ TaskExecutor::~TaskExecutor() {
 }
 
 void TaskExecutor::run(Task task) {
+    runWithPriority(std::move(task), 0);
+}
+
+void TaskExecutor::runWithPriority(Task task, int priority) {
     std::unique_lock<std::mutex> lock(_queueMutex);
-    _taskQueue.push(std::move(task));
+    _taskQueue.push(std::move(task), priority);
     _queueCondVar.notify_all();
 }
 
@@ -7,13 +7,13 @@
 #include <condition_variable>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <string>
 #include <thread>
 #include <vector>
 
 #include "cpp_interfaces/exception2status.hpp"
 #include "cpp_interfaces/ie_itask_executor.hpp"
+#include "cpp_interfaces/ie_priority_task_queue.hpp"
 #include "details/ie_exception.hpp"
 #include "ie_api.h"
 
@@ -29,11 +29,17 @@ public:
 
     void run(Task task) override;
 
+    /**
+     * @brief Queues the task to be started before the queued tasks of a lower priority
+     */
+    void runWithPriority(Task task, int priority) override;
+
 private:
     std::shared_ptr<std::thread> _thread;
     std::mutex _queueMutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    PriorityTaskQueue _taskQueue;
+    bool _isTaskRunning = false;
     bool _isStopped;
     std::string _name;
 };
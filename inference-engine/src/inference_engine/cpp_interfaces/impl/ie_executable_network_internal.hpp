@@ -17,6 +17,7 @@
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
+#include "ie_profiling.hpp"
 
 namespace InferenceEngine {
 /**
@@ -86,6 +87,14 @@ public:
         _plugin = plugin;
     }
 
+    /**
+     * @brief Sets the profile of the network loading, plugins report it by the LOAD_NETWORK_PROFILE metric
+     * @param loadProfile - the profile recorded while the network is loaded
+     */
+    void SetLoadProfile(LoadProfile::Ptr loadProfile) {
+        _loadProfile = loadProfile;
+    }
+
     std::vector<IMemoryStateInternal::Ptr> QueryState() override {
         // meaning base plugin reports as no state available - plugin owners need to create proper override of this
         return {};
@@ -116,6 +125,7 @@ protected:
     InferenceEngine::OutputsDataMap _networkOutputs;
 
     IInferencePluginInternal::Ptr _plugin;
+    LoadProfile::Ptr _loadProfile;
 };
 
 }  // namespace InferenceEngine
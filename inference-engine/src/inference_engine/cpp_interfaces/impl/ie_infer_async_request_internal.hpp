@@ -36,6 +36,14 @@ public:
         _userData = data;
     }
 
+    void SetPriority(int priority) override {
+        _priority = priority;
+    }
+
+    int GetCompletionFd() override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
     /**
      * @brief Set weak pointer to the corresponding public interface: IInferRequest. This allow to pass it to
      * IInferRequest::CompletionCallback
@@ -61,6 +69,7 @@ protected:
     IInferRequest::WeakPtr _publicInterface;
     InferenceEngine::IInferRequest::CompletionCallback _callback;
     void* _userData;
+    int _priority = 0;
 };
 
 }  // namespace InferenceEngine
@@ -8,12 +8,18 @@
 #include <cpp_interfaces/ie_immediate_executor.hpp>
 #include <cpp_interfaces/ie_task_executor.hpp>
 #include <cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
 #include <exception>
 #include <future>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -21,6 +27,11 @@
 #include "ie_infer_async_request_thread_safe_internal.hpp"
 #include "ie_util_internal.hpp"
 
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
 namespace InferenceEngine {
 /**
  * @class AsyncInferRequestThreadSafeDefault
@@ -90,18 +101,51 @@ public:
     using Pipeline = std::vector<Stage>;
     enum Stage_e : std::uint8_t { executor, task };
 
+    /**
+     * @brief Creates the request with the inference stage run by taskExecutor.
+     * @param preprocessExecutor - if given, the input pre-processing is a separate stage run by this executor, so
+     *        it is overlapped with the inference of other requests. Each of its tasks pre-processes a request in
+     *        the executor's thread only, so the number of threads used for the pre-processing is the number of
+     *        the executor's threads.
+     */
     explicit AsyncInferRequestThreadSafeDefault(const InferRequestInternal::Ptr& request,
                                                 const ITaskExecutor::Ptr& taskExecutor,
-                                                const ITaskExecutor::Ptr& callbackExecutor)
+                                                const ITaskExecutor::Ptr& callbackExecutor,
+                                                const ITaskExecutor::Ptr& preprocessExecutor = nullptr)
         : _syncRequest {request},
           _requestExecutor {taskExecutor},
           _callbackExecutor {callbackExecutor},
           _pipeline {{_requestExecutor, [this] {
                           _syncRequest->Infer();
-                      }}} {}
+                      }}} {
+        if (nullptr != preprocessExecutor) {
+            _pipeline = {
+                {preprocessExecutor, [this] {
+                    _syncRequest->Preprocess(true);
+                }},
+                {_requestExecutor, [this] {
+                    _syncRequest->InferPreprocessed();
+                }},
+            };
+        }
+    }
 
     ~AsyncInferRequestThreadSafeDefault() {
         StopAndWait();
+#ifdef __linux__
+        if (_completionFd >= 0) {
+            close(_completionFd);
+        }
+#endif
+    }
+
+    /**
+     * @brief Sets the time Wait(RESULT_READY) polls the completion of the pipeline before it blocks on the future.
+     *        Spinning avoids the context switch of a blocked thread when requests finish within microseconds.
+     *        Zero (default) blocks at once.
+     */
+    void SetWaitSpinTime(std::chrono::microseconds spinTime) {
+        _waitSpinTime = spinTime;
     }
 
     /**
@@ -127,6 +171,13 @@ public:
 
         switch (millis_timeout) {
         case IInferRequest::WaitMode::RESULT_READY: {
+            if (_waitSpinTime.count() > 0) {
+                const auto deadline = std::chrono::steady_clock::now() + _waitSpinTime;
+                while (!_pipelineDone.load(std::memory_order_acquire) &&
+                       std::chrono::steady_clock::now() < deadline) {
+                    std::this_thread::yield();
+                }
+            }
             future.wait();
             status = std::future_status::ready;
         } break;
@@ -193,6 +244,33 @@ public:
         _syncRequest->SetBatch(batch);
     }
 
+    void SetPriority_ThreadUnsafe(int priority) override {
+        _priority = priority;
+    }
+
+    std::vector<IMemoryStateInternal::Ptr> QueryState_ThreadUnsafe() override {
+        return _syncRequest->QueryState();
+    }
+
+    void InferBatch_ThreadUnsafe(const BlobMap* inputs, BlobMap* outputs, size_t count) override {
+        _syncRequest->InferBatch(inputs, outputs, count);
+    }
+
+    int GetCompletionFd_ThreadUnsafe() override {
+#ifdef __linux__
+        if (_completionFd < 0) {
+            const int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (fd < 0) {
+                THROW_IE_EXCEPTION << "Cannot create the completion eventfd: " << std::strerror(errno);
+            }
+            _completionFd = fd;
+        }
+        return _completionFd;
+#else
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Completion file descriptors are available on Linux only";
+#endif
+    }
+
     void SetPointerToPublicInterface(InferenceEngine::IInferRequest::Ptr ptr) {
         _publicInterface = std::shared_ptr<IInferRequest>(ptr.get(), [](IInferRequest*) {});
     }
@@ -225,10 +303,11 @@ protected:
         }();
 
         if (!stop) {
+            _pipelineDone.store(false, std::memory_order_release);
             try {
                 auto& firstStageExecutor = std::get<Stage_e::executor>(*_itStage);
                 IE_ASSERT(nullptr != firstStageExecutor);
-                firstStageExecutor->run(MakeNextStageTask());
+                firstStageExecutor->runWithPriority(MakeNextStageTask(), _priority);
             } catch (...) {
                 _promise.set_exception(std::current_exception());
                 throw;
@@ -261,7 +340,7 @@ protected:
                     auto nextStage = *_itStage;
                     auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
                     IE_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(MakeNextStageTask());
+                    nextStageExecutor->runWithPriority(MakeNextStageTask(), _priority);
                 }
             } catch (InferenceEngine::details::InferenceEngineException& ie_ex) {
                 requestStatus = ie_ex.hasStatus() ? ie_ex.getStatus() : StatusCode::GENERAL_ERROR;
@@ -290,10 +369,14 @@ protected:
                         } else {
                             promise.set_exception(localCurrentException);
                         }
+                        _pipelineDone.store(true, std::memory_order_release);
+                        SignalCompletionFd();
                     }
                 };
 
-                if (nullptr == _callbackExecutor) {
+                // without a user callback the last stage only completes the promise, so it is not worth
+                // the queue lock and the thread switch of the callback executor
+                if (nullptr == _callbackExecutor || nullptr == _callback.load()) {
                     lastStageTask();
                 } else {
                     _callbackExecutor->run(std::move(lastStageTask));
@@ -302,6 +385,21 @@ protected:
         };
     }
 
+    /**
+     * @brief Makes the completion file descriptor readable, if it was requested
+     */
+    void SignalCompletionFd() {
+#ifdef __linux__
+        const int fd = _completionFd;
+        if (fd >= 0) {
+            const std::uint64_t completed = 1;
+            // the counter cannot overflow in practice and the request is completed anyway, so the result is ignored
+            auto written = write(fd, &completed, sizeof(completed));
+            (void)written;
+        }
+#endif
+    }
+
     /**
      * @brief Forbids pipeline start and wait for all started piplenes.
      * @note Should be called in derived class destrutor to wait for completion of usage of derived context captured by
@@ -343,6 +441,8 @@ protected:
     ITaskExecutor::Ptr _requestExecutor;
     ITaskExecutor::Ptr _callbackExecutor;
     void* _userData = nullptr;
+    // the stage tasks are passed to the executors with this priority
+    int _priority = 0;
     AtomicCallback _callback = {nullptr};
     IInferRequest::Ptr _publicInterface;
     Pipeline _pipeline;
@@ -351,5 +451,10 @@ protected:
     mutable std::mutex _mutex;
     Futures _futures;
     bool _stop = false;
+    // set once the last started pipeline completed its promise, polled by the spinning Wait()
+    std::atomic<bool> _pipelineDone = {true};
+    std::chrono::microseconds _waitSpinTime {0};
+    // eventfd signalled on every completion, created on the first GetCompletionFd() call
+    std::atomic<int> _completionFd = {-1};
 };
 }  // namespace InferenceEngine
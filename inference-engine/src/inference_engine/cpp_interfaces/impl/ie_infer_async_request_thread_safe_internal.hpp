@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
 #include "cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp"
@@ -110,6 +111,32 @@ public:
         SetBatch_ThreadUnsafe(batch);
     };
 
+    void SetPriority(int priority) override {
+        CheckBusy();
+        SetPriority_ThreadUnsafe(priority);
+    }
+
+    int GetCompletionFd() override {
+        CheckBusy();
+        return GetCompletionFd_ThreadUnsafe();
+    }
+
+    std::vector<IMemoryStateInternal::Ptr> QueryState() override {
+        CheckBusy();
+        return QueryState_ThreadUnsafe();
+    }
+
+    void InferBatch(const BlobMap* inputs, BlobMap* outputs, size_t count) override {
+        if (setIsRequestBusy(true)) ThrowBusy();
+        try {
+            InferBatch_ThreadUnsafe(inputs, outputs, count);
+        } catch (...) {
+            setIsRequestBusy(false);
+            throw;
+        }
+        setIsRequestBusy(false);
+    }
+
     /**
      * @brief methods with _ThreadUnsafe prefix are to implement in plugins
      * or in default wrapper (e.g. AsyncInferRequestThreadSafeDefault)
@@ -136,6 +163,14 @@ public:
     virtual void GetPreProcess_ThreadUnsafe(const char* name, const PreProcessInfo** info) const = 0;
 
     virtual void SetBatch_ThreadUnsafe(int batch) = 0;
+
+    virtual void SetPriority_ThreadUnsafe(int priority) = 0;
+
+    virtual int GetCompletionFd_ThreadUnsafe() = 0;
+
+    virtual std::vector<IMemoryStateInternal::Ptr> QueryState_ThreadUnsafe() = 0;
+
+    virtual void InferBatch_ThreadUnsafe(const BlobMap* inputs, BlobMap* outputs, size_t count) = 0;
 };
 
 }  // namespace InferenceEngine
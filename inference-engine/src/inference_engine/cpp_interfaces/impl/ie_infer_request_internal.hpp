@@ -7,10 +7,12 @@
 #include <blob_factory.hpp>
 #include <ie_icnn_network.hpp>
 #include <ie_input_info.hpp>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cpp_interfaces/exception2status.hpp"
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
@@ -94,12 +96,16 @@ public:
         DataPtr foundOutput;
         size_t dataSize = data->size();
         if (findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
-            if (foundInput->getPrecision() != data->getTensorDesc().getPrecision()) {
+            const bool preProcRequired = preProcessingRequired(foundInput, data);
+            // the pre-processing also converts U8 data to the FP32 or FP16 network's input
+            const bool convertedByPreProc = preProcRequired &&
+                data->getTensorDesc().getPrecision() == Precision::U8 &&
+                (foundInput->getPrecision() == Precision::FP32 || foundInput->getPrecision() == Precision::FP16);
+            if (foundInput->getPrecision() != data->getTensorDesc().getPrecision() && !convertedByPreProc) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
                                    << "Failed to set Blob with precision not corresponding to user input precision";
             }
 
-            const bool preProcRequired = preProcessingRequired(foundInput, data);
             if (compoundBlobPassed && !preProcRequired) {
                 THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
                                    << "cannot set compound blob: supported only for input pre-processing";
@@ -222,10 +228,26 @@ public:
         THROW_IE_EXCEPTION << "Dynamic batch is not supported";
     };
 
+    std::vector<IMemoryStateInternal::Ptr> QueryState() override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Memory states of the requests are not supported";
+    }
+
+    /**
+     * @brief Default common implementation for all plugins, the inferences are run by Infer() one after another
+     */
+    void InferBatch(const BlobMap* inputs, BlobMap* outputs, size_t count) override {
+        inferBatchItems(inputs, outputs, count, [this] {
+            Infer();
+        });
+    }
+
     /**
      * @brief Checks and executes input data pre-processing if needed.
      */
     void execDataPreprocessing(InferenceEngine::BlobMap& inputs, bool serial = false) {
+        // already done by Preprocess()
+        if (_inputsPreprocessed) return;
+
         for (auto& input : inputs) {
             // If there is a pre-process entry for an input then it must be pre-processed
             // using preconfigured resize algorithm.
@@ -237,6 +259,38 @@ public:
         }
     }
 
+    /**
+     * @brief Executes input data pre-processing ahead of the inference, e.g. by a separate stage of an
+     * asynchronous pipeline. The inference is to be run by InferPreprocessed() then.
+     * @param serial - whether the pre-processing must run in the calling thread only
+     */
+    void Preprocess(bool serial = false) {
+        execDataPreprocessing(_inputs, serial);
+    }
+
+    /**
+     * @brief Infers the inputs pre-processed by Preprocess(), so the plugin's execDataPreprocessing call does nothing
+     */
+    void InferPreprocessed() {
+        _inputsPreprocessed = true;
+        try {
+            Infer();
+        } catch (...) {
+            _inputsPreprocessed = false;
+            throw;
+        }
+        _inputsPreprocessed = false;
+    }
+
+    /**
+     * @brief Adds performance counters of input data pre-processing to the map.
+     */
+    void getPreprocessingPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo>& perfMap) const {
+        for (const auto& preProcData : _preProcData) {
+            preProcData.second->getPerformanceCounts(preProcData.first, perfMap);
+        }
+    }
+
 protected:
     InferenceEngine::InputsDataMap _networkInputs;
     InferenceEngine::OutputsDataMap _networkOutputs;
@@ -245,8 +299,54 @@ protected:
     ExecutableNetworkInternalPtr _exeNetwork;
     std::map<std::string, PreProcessDataPtr> _preProcData;  // pre-process data per input
     int m_curBatch;                                         // current batch value used in dynamic batching
+    bool _inputsPreprocessed = false;                       // inputs are pre-processed by Preprocess() already
 
 protected:
+    /**
+     * @brief Sets the blobs of each inference of InferBatch to the request and runs it, the blobs of the request
+     * are restored afterwards. The plugins call it from InferBatch with the inference of their own, e.g. to enter
+     * their threads once for the whole batch.
+     * @param inputs - the input blobs of each inference
+     * @param outputs - the output blobs of each inference, the missing outputs are allocated and added
+     * @param count - the number of the inferences
+     * @param infer - runs the inference of the blobs set to the request
+     */
+    void inferBatchItems(const BlobMap* inputs, BlobMap* outputs, size_t count, const std::function<void()>& infer) {
+        if (count != 0 && (inputs == nullptr || outputs == nullptr))
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to infer the batch: the blobs are not set";
+
+        BlobMap requestBlobs;
+        for (const auto& input : _networkInputs) GetBlob(input.first.c_str(), requestBlobs[input.first]);
+        for (const auto& output : _networkOutputs) GetBlob(output.first.c_str(), requestBlobs[output.first]);
+        auto restore = [&] {
+            for (const auto& blob : requestBlobs) {
+                if (blob.second) SetBlob(blob.first.c_str(), blob.second);
+            }
+        };
+
+        try {
+            for (size_t k = 0; k < count; k++) {
+                for (const auto& input : _networkInputs) {
+                    auto it = inputs[k].find(input.first);
+                    SetBlob(input.first.c_str(), it != inputs[k].end() ? it->second : requestBlobs[input.first]);
+                }
+                for (const auto& output : _networkOutputs) {
+                    auto& blob = outputs[k][output.first];
+                    if (!blob) {
+                        blob = make_blob_with_precision(requestBlobs[output.first]->getTensorDesc());
+                        blob->allocate();
+                    }
+                    SetBlob(output.first.c_str(), blob);
+                }
+                infer();
+            }
+        } catch (...) {
+            restore();
+            throw;
+        }
+        restore();
+    }
+
     /**
      * @brief helper to find input or output blob by name
      * @param name - a name of input or output blob.
@@ -354,6 +454,7 @@ protected:
         // 2. color format specified:
         // 2.a. color format is not equal to network's expected (color conversion required)
         // 2.b. network's layout != blob's layout (reorder required)
+        // 3. ROI is specified (crop required)
         const auto& preProcessInfo = info->getPreProcess();
         const auto inputColorFormat = preProcessInfo.getColorFormat();
         // FIXME: support other network's input formats once the API is ready. Assuming input is in
@@ -363,7 +464,8 @@ protected:
         const bool colorFormatSpecified = inputColorFormat != ColorFormat::RAW;
         return preProcessInfo.getResizeAlgorithm() != ResizeAlgorithm::NO_RESIZE ||
                (colorFormatSpecified && inputColorFormat != networkColorFormat) ||
-               (colorFormatSpecified && info->getLayout() != blob->getTensorDesc().getLayout());
+               (colorFormatSpecified && info->getLayout() != blob->getTensorDesc().getLayout()) ||
+               preProcessInfo.hasROI();
     }
 };
 
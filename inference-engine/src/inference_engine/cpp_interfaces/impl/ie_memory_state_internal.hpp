@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cpp_interfaces/exception2status.hpp>
 #include <cpp_interfaces/interface/ie_imemory_state_internal.hpp>
 #include <string>
 
@@ -27,6 +28,9 @@ public:
     Blob::CPtr GetLastState() const override {
         return state;
     }
+    void BindState(Blob::Ptr /* state */) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Binding of the memory state is not supported";
+    }
 };
 
 }  // namespace InferenceEngine
\ No newline at end of file
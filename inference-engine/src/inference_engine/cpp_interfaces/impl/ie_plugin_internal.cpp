@@ -12,6 +12,8 @@ std::shared_ptr<InferenceEngine::ICNNNetwork> InferenceEngine::InferencePluginIn
 #ifdef ENABLE_NGRAPH
     if (auto networkNGraph = dynamic_cast<CNNNetworkNGraphImpl*>(&network)) {
         auto nGraphNetwork = networkNGraph->cloneNGraphImpl();
+        // the clone is owned by the plugin, so there is no need to copy the function once more to convert it
+        nGraphNetwork->convertToCNNNetworkImplInPlace();
         nGraphNet = nGraphNetwork;
         return nGraphNetwork->getCNNNetwork();
     }
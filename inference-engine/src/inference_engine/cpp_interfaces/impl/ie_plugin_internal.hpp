@@ -22,6 +22,7 @@
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "graph_transformer.h"
 #include "ie_memcpy.h"
+#include "ie_profiling.hpp"
 #include "ie_util_internal.hpp"
 #include "net_pass.h"
 #include "low_precision_transformations/blob_transformation.hpp"
@@ -90,7 +91,15 @@ public:
     void cloneAndCreateExecutableNetwork(IExecutableNetwork::Ptr& executableNetwork, ICNNNetwork& network,
                                          const std::map<std::string, std::string>& config,
                                          RemoteContext::Ptr context = nullptr) {
-        auto clonedNetwork = ConvertAndCloneNetwork(network);
+        // the profiling scopes of the loading report their durations to the profile of the network
+        auto loadProfile = std::make_shared<LoadProfile>();
+        LoadProfile::Bind bindLoadProfile(loadProfile.get());
+
+        std::shared_ptr<ICNNNetwork> clonedNetwork;
+        {
+            IE_PROFILING_AUTO_SCOPE(InferencePluginInternal::ConvertAndCloneNetwork)
+            clonedNetwork = ConvertAndCloneNetwork(network);
+        }
 
         InputsDataMap networkInputs;
         OutputsDataMap networkOutputs;
@@ -129,19 +138,28 @@ public:
             _networkOutputs[it.first] = newData;
         }
 
-        // Default precision conversion for all plugins. No one natively supports int64/bool
-        NetPass::ConvertPrecision(*clonedNetwork, Precision::I64, Precision::I32);
+        ICNNNetwork* trimmedNetwork = nullptr;
+        {
+            IE_PROFILING_AUTO_SCOPE(InferencePluginInternal::RemoveConstLayers)
+            // Default precision conversion for all plugins. No one natively supports int64/bool
+            NetPass::ConvertPrecision(*clonedNetwork, Precision::I64, Precision::I32);
+            trimmedNetwork = &RemoveConstLayers(*clonedNetwork);
+        }
 
         ExecutableNetworkInternal::Ptr impl;
-        if (nullptr == context) {
-            impl = LoadExeNetworkImpl(GetCore(), RemoveConstLayers(*clonedNetwork), config);
-        } else {
-            impl = LoadExeNetworkImpl(GetCore(), RemoveConstLayers(*clonedNetwork), context, config);
+        {
+            IE_PROFILING_AUTO_SCOPE(InferencePluginInternal::LoadExeNetworkImpl)
+            if (nullptr == context) {
+                impl = LoadExeNetworkImpl(GetCore(), *trimmedNetwork, config);
+            } else {
+                impl = LoadExeNetworkImpl(GetCore(), *trimmedNetwork, context, config);
+            }
         }
 
         impl->setNetworkInputs(_networkInputs);
         impl->setNetworkOutputs(_networkOutputs);
         impl->SetPointerToPluginInternal(shared_from_this());
+        impl->SetLoadProfile(loadProfile);
 
         executableNetwork.reset(new ExecutableNetworkBase<ExecutableNetworkInternal>(impl), [](details::IRelease* p) {
             p->Release();
@@ -60,6 +60,18 @@ public:
      * * @return Enumeration of the resulted action: OK (0) for success.
      */
     virtual void SetCompletionCallback(IInferRequest::CompletionCallback callback) = 0;
+
+    /**
+     * @brief Sets the priority the request is scheduled with by the executors running its asynchronous inference
+     * @param priority - requests with a higher priority are started first among the queued ones
+     */
+    virtual void SetPriority(int priority) = 0;
+
+    /**
+     * @brief Gets the file descriptor signalled on every completion of the asynchronous inference
+     * @return eventfd descriptor owned by the request
+     */
+    virtual int GetCompletionFd() = 0;
 };
 
 }  // namespace InferenceEngine
@@ -10,6 +10,9 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
+
+#include "cpp_interfaces/interface/ie_imemory_state_internal.hpp"
 
 namespace InferenceEngine {
 
@@ -76,6 +79,20 @@ public:
      * @param batch - new batch size to be used by all the following inference calls for this request.
      */
     virtual void SetBatch(int batch) = 0;
+
+    /**
+     * @brief Queries the memory states of this request, the ones of the other requests are independent of them
+     * @return The memory states of the request
+     */
+    virtual std::vector<IMemoryStateInternal::Ptr> QueryState() = 0;
+
+    /**
+     * @brief Infers several independent sets of the inputs in one call, the blobs set to the request are restored
+     * @param inputs - the input blobs of each inference, the missing inputs use the blobs of the request
+     * @param outputs - the output blobs of each inference, the missing outputs are allocated
+     * @param count - the number of the inferences
+     */
+    virtual void InferBatch(const BlobMap* inputs, BlobMap* outputs, size_t count) = 0;
 };
 
 }  // namespace InferenceEngine
@@ -22,6 +22,7 @@ public:
     virtual void Reset() = 0;
     virtual void SetState(Blob::Ptr newState) = 0;
     virtual Blob::CPtr GetLastState() const = 0;
+    virtual void BindState(Blob::Ptr state) = 0;
 };
 
 }  // namespace InferenceEngine
\ No newline at end of file
@@ -28,4 +28,23 @@ bool with_cpu_x86_sse42() {
 #endif
 }
 
+// NB: there is no way to check for the following instructions without MKL-DNN, so their
+// specialized code is not used in that case
+bool with_cpu_x86_avx2() {
+#ifdef ENABLE_MKL_DNN
+    return cpu.has(Xbyak::util::Cpu::tAVX2);
+#else
+    return false;
+#endif
+}
+
+bool with_cpu_x86_avx512_core() {
+#ifdef ENABLE_MKL_DNN
+    return cpu.has(Xbyak::util::Cpu::tAVX512F) && cpu.has(Xbyak::util::Cpu::tAVX512BW) &&
+           cpu.has(Xbyak::util::Cpu::tAVX512DQ);
+#else
+    return false;
+#endif
+}
+
 }  // namespace InferenceEngine
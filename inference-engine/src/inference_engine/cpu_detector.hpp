@@ -13,4 +13,14 @@ namespace InferenceEngine {
  */
 INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_sse42();
 
+/**
+ * @brief Check if CPU is x86 with AVX2
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx2();
+
+/**
+ * @brief Check if CPU is x86 with AVX-512 foundation, byte and word, and doubleword and quadword instructions
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core();
+
 }  // namespace InferenceEngine
@@ -0,0 +1,207 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "blob_transform_avx2.hpp"
+
+#include <immintrin.h>  // AVX2
+
+namespace InferenceEngine {
+namespace avx {
+
+//------------------------------------------------------------------------
+//
+// The SSE 4.2 (de)interleaving applied to both 128-bit lanes at once, so
+// every lane holds the consecutive pixels: 16 (U8) or 4 (FP32) per lane
+//
+//------------------------------------------------------------------------
+
+static inline __m256i mm256_loadu2(const void* lo, const void* hi) {
+    return _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lo))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(hi)), 1);
+}
+
+static inline void mm256_storeu2(void* lo, void* hi, __m256i v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lo), _mm256_castsi256_si128(v));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(hi), _mm256_extracti128_si256(v, 1));
+}
+
+static inline void mm256_load_deinterleave(const uint8_t* ptr, __m256i& a, __m256i& b, __m256i& c) {
+    const __m256i m0 = _mm256_setr_epi8(0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0,
+                                        0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0);
+    const __m256i m1 = _mm256_setr_epi8(0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0,
+                                        0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0);
+    __m256i s0 = mm256_loadu2(ptr, ptr + 48);
+    __m256i s1 = mm256_loadu2(ptr + 16, ptr + 64);
+    __m256i s2 = mm256_loadu2(ptr + 32, ptr + 80);
+    __m256i a0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s0, s1, m0), s2, m1);
+    __m256i b0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s1, s2, m0), s0, m1);
+    __m256i c0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s2, s0, m0), s1, m1);
+    const __m256i sh_b = _mm256_setr_epi8(0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13,
+                                          0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13);
+    const __m256i sh_g = _mm256_setr_epi8(1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14,
+                                          1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14);
+    const __m256i sh_r = _mm256_setr_epi8(2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15,
+                                          2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15);
+    a = _mm256_shuffle_epi8(a0, sh_b);
+    b = _mm256_shuffle_epi8(b0, sh_g);
+    c = _mm256_shuffle_epi8(c0, sh_r);
+}
+
+static inline void mm256_store_interleave(uint8_t* ptr, __m256i a, __m256i b, __m256i c) {
+    const __m256i sh_a = _mm256_setr_epi8(0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5,
+                                          0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5);
+    const __m256i sh_b = _mm256_setr_epi8(5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10,
+                                          5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10);
+    const __m256i sh_c = _mm256_setr_epi8(10, 5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15,
+                                          10, 5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15);
+    __m256i a0 = _mm256_shuffle_epi8(a, sh_a);
+    __m256i b0 = _mm256_shuffle_epi8(b, sh_b);
+    __m256i c0 = _mm256_shuffle_epi8(c, sh_c);
+
+    const __m256i m0 = _mm256_setr_epi8(0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0,
+                                        0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0);
+    const __m256i m1 = _mm256_setr_epi8(0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0,
+                                        0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0);
+    __m256i v0 = _mm256_blendv_epi8(_mm256_blendv_epi8(a0, b0, m1), c0, m0);
+    __m256i v1 = _mm256_blendv_epi8(_mm256_blendv_epi8(b0, c0, m1), a0, m0);
+    __m256i v2 = _mm256_blendv_epi8(_mm256_blendv_epi8(c0, a0, m1), b0, m0);
+
+    mm256_storeu2(ptr, ptr + 48, v0);
+    mm256_storeu2(ptr + 16, ptr + 64, v1);
+    mm256_storeu2(ptr + 32, ptr + 80, v2);
+}
+
+static inline void mm256_load_deinterleave(const float* ptr, __m256& a, __m256& b, __m256& c) {
+    __m256 t0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(ptr + 0)), _mm_loadu_ps(ptr + 12), 1);
+    __m256 t1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(ptr + 4)), _mm_loadu_ps(ptr + 16), 1);
+    __m256 t2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(ptr + 8)), _mm_loadu_ps(ptr + 20), 1);
+
+    __m256 at12 = _mm256_shuffle_ps(t1, t2, _MM_SHUFFLE(0, 1, 0, 2));
+    a = _mm256_shuffle_ps(t0, at12, _MM_SHUFFLE(2, 0, 3, 0));
+
+    __m256 bt01 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 0, 0, 1));
+    __m256 bt12 = _mm256_shuffle_ps(t1, t2, _MM_SHUFFLE(0, 2, 0, 3));
+    b = _mm256_shuffle_ps(bt01, bt12, _MM_SHUFFLE(2, 0, 2, 0));
+
+    __m256 ct01 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 1, 0, 2));
+    c = _mm256_shuffle_ps(ct01, t2, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+static inline void mm256_store_interleave(float* ptr, __m256 a, __m256 b, __m256 c) {
+    __m256 u0 = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 0, 0));
+    __m256 u1 = _mm256_shuffle_ps(c, a, _MM_SHUFFLE(1, 1, 0, 0));
+    __m256 v0 = _mm256_shuffle_ps(u0, u1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 u2 = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 1, 1));
+    __m256 u3 = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 2, 2, 2));
+    __m256 v1 = _mm256_shuffle_ps(u2, u3, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 u4 = _mm256_shuffle_ps(c, a, _MM_SHUFFLE(3, 3, 2, 2));
+    __m256 u5 = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(3, 3, 3, 3));
+    __m256 v2 = _mm256_shuffle_ps(u4, u5, _MM_SHUFFLE(2, 0, 2, 0));
+
+    _mm_storeu_ps(ptr + 0, _mm256_castps256_ps128(v0));
+    _mm_storeu_ps(ptr + 4, _mm256_castps256_ps128(v1));
+    _mm_storeu_ps(ptr + 8, _mm256_castps256_ps128(v2));
+    _mm_storeu_ps(ptr + 12, _mm256_extractf128_ps(v0, 1));
+    _mm_storeu_ps(ptr + 16, _mm256_extractf128_ps(v1, 1));
+    _mm_storeu_ps(ptr + 20, _mm256_extractf128_ps(v2, 1));
+}
+
+static inline void mm256_store_u8_as_f32(float* ptr, __m128i v) {
+    _mm256_storeu_ps(ptr, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v)));
+    _mm256_storeu_ps(ptr + 8, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(v, 8))));
+}
+
+static inline void mm256_store_u8_as_f32(float* ptr, __m256i v) {
+    mm256_store_u8_as_f32(ptr, _mm256_castsi256_si128(v));
+    mm256_store_u8_as_f32(ptr + 16, _mm256_extracti128_si256(v, 1));
+}
+
+//------------------------------------------------------------------------
+
+void blob_copy_row_split_u8c3(const uint8_t* src, uint8_t* dst0, uint8_t* dst1, uint8_t* dst2, int W) {
+    int w = 0;
+    for (; w <= W - 32; w += 32) {
+        __m256i r0, r1, r2;
+        mm256_load_deinterleave(&src[3 * w], r0, r1, r2);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst0 + w), r0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst1 + w), r1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst2 + w), r2);
+    }
+
+    for (; w < W; w++) {
+        dst0[w] = src[3 * w + 0];
+        dst1[w] = src[3 * w + 1];
+        dst2[w] = src[3 * w + 2];
+    }
+}
+
+void blob_copy_row_split_f32c3(const float* src, float* dst0, float* dst1, float* dst2, int W) {
+    int w = 0;
+    for (; w <= W - 8; w += 8) {
+        __m256 r0, r1, r2;
+        mm256_load_deinterleave(&src[3 * w], r0, r1, r2);
+        _mm256_storeu_ps(&dst0[w], r0);
+        _mm256_storeu_ps(&dst1[w], r1);
+        _mm256_storeu_ps(&dst2[w], r2);
+    }
+
+    for (; w < W; w++) {
+        dst0[w] = src[3 * w + 0];
+        dst1[w] = src[3 * w + 1];
+        dst2[w] = src[3 * w + 2];
+    }
+}
+
+void blob_copy_row_merge_u8c3(const uint8_t* src0, const uint8_t* src1, const uint8_t* src2, uint8_t* dst, int W) {
+    int w = 0;
+    for (; w <= W - 32; w += 32) {
+        __m256i r0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src0 + w));
+        __m256i r1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src1 + w));
+        __m256i r2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src2 + w));
+        mm256_store_interleave(&dst[3 * w], r0, r1, r2);
+    }
+
+    for (; w < W; w++) {
+        dst[3 * w + 0] = src0[w];
+        dst[3 * w + 1] = src1[w];
+        dst[3 * w + 2] = src2[w];
+    }
+}
+
+void blob_copy_row_merge_f32c3(const float* src0, const float* src1, const float* src2, float* dst, int W) {
+    int w = 0;
+    for (; w <= W - 8; w += 8) {
+        __m256 r0 = _mm256_loadu_ps(&src0[w]);
+        __m256 r1 = _mm256_loadu_ps(&src1[w]);
+        __m256 r2 = _mm256_loadu_ps(&src2[w]);
+        mm256_store_interleave(&dst[3 * w], r0, r1, r2);
+    }
+
+    for (; w < W; w++) {
+        dst[3 * w + 0] = src0[w];
+        dst[3 * w + 1] = src1[w];
+        dst[3 * w + 2] = src2[w];
+    }
+}
+
+void blob_copy_row_split_u8c3_to_f32(const uint8_t* src, float* dst0, float* dst1, float* dst2, int W) {
+    int w = 0;
+    for (; w <= W - 32; w += 32) {
+        __m256i r0, r1, r2;
+        mm256_load_deinterleave(&src[3 * w], r0, r1, r2);
+        mm256_store_u8_as_f32(&dst0[w], r0);
+        mm256_store_u8_as_f32(&dst1[w], r1);
+        mm256_store_u8_as_f32(&dst2[w], r2);
+    }
+
+    for (; w < W; w++) {
+        dst0[w] = src[3 * w + 0];
+        dst1[w] = src[3 * w + 1];
+        dst2[w] = src[3 * w + 2];
+    }
+}
+
+}  // namespace avx
+}  // namespace InferenceEngine
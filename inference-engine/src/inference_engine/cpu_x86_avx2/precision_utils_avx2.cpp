@@ -0,0 +1,147 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_utils_avx2.hpp"
+
+#include <immintrin.h>  // AVX2, F16C
+
+namespace InferenceEngine {
+namespace avx {
+
+static inline __m256 mm256_scale(__m256 v, __m256 scale, __m256 bias) {
+    // not fused, as the scalar conversion does not fuse them either
+    return _mm256_add_ps(_mm256_mul_ps(v, scale), bias);
+}
+
+// packs the 16 bit values of the lanes keeping their order
+static inline __m128i mm256_pack_u16(__m256i v) {
+    return _mm_packus_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+}
+
+static inline __m256i mm256_blend_epi32(__m256i a, __m256i b, __m256i mask) {
+    return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b),
+                                                 _mm256_castsi256_ps(mask)));
+}
+
+static inline __m256i mm256_blend_epi32(__m256i a, __m256i b, __m256 mask) {
+    return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), mask));
+}
+
+size_t convert_row_f16_to_f32(float* dst, const int16_t* src, size_t n, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 v = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, mm256_scale(v, vscale, vbias));
+    }
+    return i;
+}
+
+// the rounding, the saturation and the flush of the denormals of PrecisionUtils::f32tof16
+size_t convert_row_f32_to_f16(int16_t* dst, const float* src, size_t n, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+    const __m256 min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 halfMin16 = _mm256_mul_ps(min16, _mm256_set1_ps(0.5f));
+    const __m256 max16 = _mm256_castsi256_ps(_mm256_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+    const __m256 halfUlp = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 11) << 23));
+    const __m256i absMask = _mm256_set1_epi32(0x7FFFFFFF);
+    const __m256i expMask = _mm256_set1_epi32(0x7F800000);
+    const __m256i signMask = _mm256_set1_epi32(0x8000);
+    const __m256i quietNan = _mm256_set1_epi32(0x0200);
+    const __m256i lowMask = _mm256_set1_epi32(0xFFFF);
+    const __m256i max16f16 = _mm256_set1_epi32(((15 + 15) << 10) | 0x3FF);
+    const __m256i min16f16 = _mm256_set1_epi32(1 << 10);
+    const __m256i expBias = _mm256_set1_epi32((127 - 15) << 23);
+    const __m256i zero = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i u = _mm256_castps_si256(mm256_scale(_mm256_loadu_ps(src + i), vscale, vbias));
+        __m256i s = _mm256_and_si256(_mm256_srli_epi32(u, 16), signMask);
+        __m256i a = _mm256_and_si256(u, absMask);
+        __m256i e = _mm256_and_si256(a, expMask);
+
+        __m256i isSpecial = _mm256_cmpeq_epi32(e, expMask);
+        __m256i isNan = _mm256_cmpgt_epi32(a, expMask);
+        // the exponent bits of F32 shifted over 16 bits are dropped, as by the scalar conversion
+        __m256i special = _mm256_and_si256(_mm256_srli_epi32(a, 23 - 10), lowMask);
+        special = _mm256_or_si256(special, _mm256_and_si256(isNan, quietNan));
+
+        __m256 v = _mm256_add_ps(_mm256_castsi256_ps(a), _mm256_mul_ps(_mm256_castsi256_ps(e), halfUlp));
+        __m256i r = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(v), expBias), 23 - 10);
+        r = mm256_blend_epi32(r, max16f16, _mm256_cmp_ps(v, max16, _CMP_GE_OQ));
+        r = mm256_blend_epi32(r, min16f16, _mm256_cmp_ps(v, min16, _CMP_LT_OQ));
+        r = mm256_blend_epi32(r, zero, _mm256_cmp_ps(v, halfMin16, _CMP_LT_OQ));
+        r = mm256_blend_epi32(r, special, isSpecial);
+        r = _mm256_or_si256(r, s);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), mm256_pack_u16(r));
+    }
+    return i;
+}
+
+size_t convert_row_bf16_to_f32(float* dst, const int16_t* src, size_t n, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i u = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        __m256 v = _mm256_castsi256_ps(_mm256_slli_epi32(u, 16));
+        _mm256_storeu_ps(dst + i, mm256_scale(v, vscale, vbias));
+    }
+    return i;
+}
+
+// rounds to the nearest even as PrecisionUtils::f32tobf16, NaN stays NaN
+size_t convert_row_f32_to_bf16(int16_t* dst, const float* src, size_t n, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+    const __m256i absMask = _mm256_set1_epi32(0x7FFFFFFF);
+    const __m256i expMask = _mm256_set1_epi32(0x7F800000);
+    const __m256i quietNan = _mm256_set1_epi32(0x0040);
+    const __m256i roundBias = _mm256_set1_epi32(0x7FFF);
+    const __m256i one = _mm256_set1_epi32(1);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i u = _mm256_castps_si256(mm256_scale(_mm256_loadu_ps(src + i), vscale, vbias));
+        __m256i isNan = _mm256_cmpgt_epi32(_mm256_and_si256(u, absMask), expMask);
+        __m256i odd = _mm256_and_si256(_mm256_srli_epi32(u, 16), one);
+        __m256i r = _mm256_srli_epi32(_mm256_add_epi32(u, _mm256_add_epi32(roundBias, odd)), 16);
+        r = mm256_blend_epi32(r, _mm256_or_si256(_mm256_srli_epi32(u, 16), quietNan), isNan);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), mm256_pack_u16(r));
+    }
+    return i;
+}
+
+size_t convert_row_u8_to_f32(float* dst, const uint8_t* src, size_t n, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i u = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, mm256_scale(_mm256_cvtepi32_ps(u), vscale, vbias));
+    }
+    return i;
+}
+
+// rounds to the nearest even and saturates as PrecisionUtils::f32tou8Arrays, NaN is converted to 0
+size_t convert_row_f32_to_u8(uint8_t* dst, const float* src, size_t n, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 max8 = _mm256_set1_ps(255.f);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 v = mm256_scale(_mm256_loadu_ps(src + i), vscale, vbias);
+        v = _mm256_min_ps(_mm256_max_ps(v, zero), max8);
+        __m128i r = mm256_pack_u16(_mm256_cvtps_epi32(v));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(r, r));
+    }
+    return i;
+}
+
+}  // namespace avx
+}  // namespace InferenceEngine
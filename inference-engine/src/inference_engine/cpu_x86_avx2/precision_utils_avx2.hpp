@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+namespace avx {
+
+//------------------------------------------------------------------------
+//
+// Precision conversion rows manually vectored for AVX2 and F16C. Every
+// row converts the leading elements by the whole vectors and returns their
+// number, the caller converts the rest. The results are the same as the
+// ones of the scalar PrecisionUtils conversions
+//
+//------------------------------------------------------------------------
+
+size_t convert_row_f16_to_f32(float* dst, const int16_t* src, size_t n, float scale, float bias);
+
+size_t convert_row_f32_to_f16(int16_t* dst, const float* src, size_t n, float scale, float bias);
+
+size_t convert_row_bf16_to_f32(float* dst, const int16_t* src, size_t n, float scale, float bias);
+
+size_t convert_row_f32_to_bf16(int16_t* dst, const float* src, size_t n, float scale, float bias);
+
+size_t convert_row_u8_to_f32(float* dst, const uint8_t* src, size_t n, float scale, float bias);
+
+size_t convert_row_f32_to_u8(uint8_t* dst, const float* src, size_t n, float scale, float bias);
+
+}  // namespace avx
+}  // namespace InferenceEngine
@@ -0,0 +1,212 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "blob_transform_avx512.hpp"
+
+#include <immintrin.h>  // AVX-512
+
+namespace InferenceEngine {
+namespace avx512 {
+
+//------------------------------------------------------------------------
+//
+// The SSE 4.2 (de)interleaving applied to all four 128-bit lanes at once,
+// so every lane holds the consecutive pixels: 16 (U8) or 4 (FP32) per lane
+//
+//------------------------------------------------------------------------
+
+static inline __m512i mm512_loadu4(const uint8_t* ptr, int step) {
+    __m512i v = _mm512_castsi128_si512(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+    v = _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + step)), 1);
+    v = _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 2 * step)), 2);
+    return _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 3 * step)), 3);
+}
+
+static inline void mm512_storeu4(uint8_t* ptr, int step, __m512i v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm512_castsi512_si128(v));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + step), _mm512_extracti32x4_epi32(v, 1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + 2 * step), _mm512_extracti32x4_epi32(v, 2));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + 3 * step), _mm512_extracti32x4_epi32(v, 3));
+}
+
+static inline __m512 mm512_loadu4(const float* ptr, int step) {
+    __m512 v = _mm512_castps128_ps512(_mm_loadu_ps(ptr));
+    v = _mm512_insertf32x4(v, _mm_loadu_ps(ptr + step), 1);
+    v = _mm512_insertf32x4(v, _mm_loadu_ps(ptr + 2 * step), 2);
+    return _mm512_insertf32x4(v, _mm_loadu_ps(ptr + 3 * step), 3);
+}
+
+static inline void mm512_storeu4(float* ptr, int step, __m512 v) {
+    _mm_storeu_ps(ptr, _mm512_castps512_ps128(v));
+    _mm_storeu_ps(ptr + step, _mm512_extractf32x4_ps(v, 1));
+    _mm_storeu_ps(ptr + 2 * step, _mm512_extractf32x4_ps(v, 2));
+    _mm_storeu_ps(ptr + 3 * step, _mm512_extractf32x4_ps(v, 3));
+}
+
+static inline __m512i mm512_repeat_lane(const __m128i lane) {
+    return _mm512_broadcast_i32x4(lane);
+}
+
+// every 3rd byte of a lane starting from the 2nd (m0) or the 1st (m1) one
+static const __mmask64 m0 = 0x4924492449244924ULL;
+static const __mmask64 m1 = 0x2492249224922492ULL;
+
+static inline void mm512_load_deinterleave(const uint8_t* ptr, __m512i& a, __m512i& b, __m512i& c) {
+    __m512i s0 = mm512_loadu4(ptr, 48);
+    __m512i s1 = mm512_loadu4(ptr + 16, 48);
+    __m512i s2 = mm512_loadu4(ptr + 32, 48);
+    __m512i a0 = _mm512_mask_blend_epi8(m1, _mm512_mask_blend_epi8(m0, s0, s1), s2);
+    __m512i b0 = _mm512_mask_blend_epi8(m1, _mm512_mask_blend_epi8(m0, s1, s2), s0);
+    __m512i c0 = _mm512_mask_blend_epi8(m1, _mm512_mask_blend_epi8(m0, s2, s0), s1);
+    const __m512i sh_b = mm512_repeat_lane(_mm_setr_epi8(0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13));
+    const __m512i sh_g = mm512_repeat_lane(_mm_setr_epi8(1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14));
+    const __m512i sh_r = mm512_repeat_lane(_mm_setr_epi8(2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15));
+    a = _mm512_shuffle_epi8(a0, sh_b);
+    b = _mm512_shuffle_epi8(b0, sh_g);
+    c = _mm512_shuffle_epi8(c0, sh_r);
+}
+
+static inline void mm512_store_interleave(uint8_t* ptr, __m512i a, __m512i b, __m512i c) {
+    const __m512i sh_a = mm512_repeat_lane(_mm_setr_epi8(0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5));
+    const __m512i sh_b = mm512_repeat_lane(_mm_setr_epi8(5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10));
+    const __m512i sh_c = mm512_repeat_lane(_mm_setr_epi8(10, 5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15));
+    __m512i a0 = _mm512_shuffle_epi8(a, sh_a);
+    __m512i b0 = _mm512_shuffle_epi8(b, sh_b);
+    __m512i c0 = _mm512_shuffle_epi8(c, sh_c);
+
+    __m512i v0 = _mm512_mask_blend_epi8(m0, _mm512_mask_blend_epi8(m1, a0, b0), c0);
+    __m512i v1 = _mm512_mask_blend_epi8(m0, _mm512_mask_blend_epi8(m1, b0, c0), a0);
+    __m512i v2 = _mm512_mask_blend_epi8(m0, _mm512_mask_blend_epi8(m1, c0, a0), b0);
+
+    mm512_storeu4(ptr, 48, v0);
+    mm512_storeu4(ptr + 16, 48, v1);
+    mm512_storeu4(ptr + 32, 48, v2);
+}
+
+static inline void mm512_load_deinterleave(const float* ptr, __m512& a, __m512& b, __m512& c) {
+    __m512 t0 = mm512_loadu4(ptr + 0, 12);
+    __m512 t1 = mm512_loadu4(ptr + 4, 12);
+    __m512 t2 = mm512_loadu4(ptr + 8, 12);
+
+    __m512 at12 = _mm512_shuffle_ps(t1, t2, _MM_SHUFFLE(0, 1, 0, 2));
+    a = _mm512_shuffle_ps(t0, at12, _MM_SHUFFLE(2, 0, 3, 0));
+
+    __m512 bt01 = _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 0, 0, 1));
+    __m512 bt12 = _mm512_shuffle_ps(t1, t2, _MM_SHUFFLE(0, 2, 0, 3));
+    b = _mm512_shuffle_ps(bt01, bt12, _MM_SHUFFLE(2, 0, 2, 0));
+
+    __m512 ct01 = _mm512_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 1, 0, 2));
+    c = _mm512_shuffle_ps(ct01, t2, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+static inline void mm512_store_interleave(float* ptr, __m512 a, __m512 b, __m512 c) {
+    __m512 u0 = _mm512_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 0, 0));
+    __m512 u1 = _mm512_shuffle_ps(c, a, _MM_SHUFFLE(1, 1, 0, 0));
+    __m512 v0 = _mm512_shuffle_ps(u0, u1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m512 u2 = _mm512_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 1, 1));
+    __m512 u3 = _mm512_shuffle_ps(a, b, _MM_SHUFFLE(2, 2, 2, 2));
+    __m512 v1 = _mm512_shuffle_ps(u2, u3, _MM_SHUFFLE(2, 0, 2, 0));
+    __m512 u4 = _mm512_shuffle_ps(c, a, _MM_SHUFFLE(3, 3, 2, 2));
+    __m512 u5 = _mm512_shuffle_ps(b, c, _MM_SHUFFLE(3, 3, 3, 3));
+    __m512 v2 = _mm512_shuffle_ps(u4, u5, _MM_SHUFFLE(2, 0, 2, 0));
+
+    mm512_storeu4(ptr + 0, 12, v0);
+    mm512_storeu4(ptr + 4, 12, v1);
+    mm512_storeu4(ptr + 8, 12, v2);
+}
+
+static inline void mm512_store_u8_as_f32(float* ptr, __m512i v) {
+    _mm512_storeu_ps(ptr, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_castsi512_si128(v))));
+    _mm512_storeu_ps(ptr + 16, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, 1))));
+    _mm512_storeu_ps(ptr + 32, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, 2))));
+    _mm512_storeu_ps(ptr + 48, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, 3))));
+}
+
+//------------------------------------------------------------------------
+
+void blob_copy_row_split_u8c3(const uint8_t* src, uint8_t* dst0, uint8_t* dst1, uint8_t* dst2, int W) {
+    int w = 0;
+    for (; w <= W - 64; w += 64) {
+        __m512i r0, r1, r2;
+        mm512_load_deinterleave(&src[3 * w], r0, r1, r2);
+        _mm512_storeu_si512(dst0 + w, r0);
+        _mm512_storeu_si512(dst1 + w, r1);
+        _mm512_storeu_si512(dst2 + w, r2);
+    }
+
+    for (; w < W; w++) {
+        dst0[w] = src[3 * w + 0];
+        dst1[w] = src[3 * w + 1];
+        dst2[w] = src[3 * w + 2];
+    }
+}
+
+void blob_copy_row_split_f32c3(const float* src, float* dst0, float* dst1, float* dst2, int W) {
+    int w = 0;
+    for (; w <= W - 16; w += 16) {
+        __m512 r0, r1, r2;
+        mm512_load_deinterleave(&src[3 * w], r0, r1, r2);
+        _mm512_storeu_ps(&dst0[w], r0);
+        _mm512_storeu_ps(&dst1[w], r1);
+        _mm512_storeu_ps(&dst2[w], r2);
+    }
+
+    for (; w < W; w++) {
+        dst0[w] = src[3 * w + 0];
+        dst1[w] = src[3 * w + 1];
+        dst2[w] = src[3 * w + 2];
+    }
+}
+
+void blob_copy_row_merge_u8c3(const uint8_t* src0, const uint8_t* src1, const uint8_t* src2, uint8_t* dst, int W) {
+    int w = 0;
+    for (; w <= W - 64; w += 64) {
+        __m512i r0 = _mm512_loadu_si512(src0 + w);
+        __m512i r1 = _mm512_loadu_si512(src1 + w);
+        __m512i r2 = _mm512_loadu_si512(src2 + w);
+        mm512_store_interleave(&dst[3 * w], r0, r1, r2);
+    }
+
+    for (; w < W; w++) {
+        dst[3 * w + 0] = src0[w];
+        dst[3 * w + 1] = src1[w];
+        dst[3 * w + 2] = src2[w];
+    }
+}
+
+void blob_copy_row_merge_f32c3(const float* src0, const float* src1, const float* src2, float* dst, int W) {
+    int w = 0;
+    for (; w <= W - 16; w += 16) {
+        __m512 r0 = _mm512_loadu_ps(&src0[w]);
+        __m512 r1 = _mm512_loadu_ps(&src1[w]);
+        __m512 r2 = _mm512_loadu_ps(&src2[w]);
+        mm512_store_interleave(&dst[3 * w], r0, r1, r2);
+    }
+
+    for (; w < W; w++) {
+        dst[3 * w + 0] = src0[w];
+        dst[3 * w + 1] = src1[w];
+        dst[3 * w + 2] = src2[w];
+    }
+}
+
+void blob_copy_row_split_u8c3_to_f32(const uint8_t* src, float* dst0, float* dst1, float* dst2, int W) {
+    int w = 0;
+    for (; w <= W - 64; w += 64) {
+        __m512i r0, r1, r2;
+        mm512_load_deinterleave(&src[3 * w], r0, r1, r2);
+        mm512_store_u8_as_f32(&dst0[w], r0);
+        mm512_store_u8_as_f32(&dst1[w], r1);
+        mm512_store_u8_as_f32(&dst2[w], r2);
+    }
+
+    for (; w < W; w++) {
+        dst0[w] = src[3 * w + 0];
+        dst1[w] = src[3 * w + 1];
+        dst2[w] = src[3 * w + 2];
+    }
+}
+
+}  // namespace avx512
+}  // namespace InferenceEngine
@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+namespace avx512 {
+
+//------------------------------------------------------------------------
+//
+// Blob-copy row primitives manually vectored for AVX-512 (the caller splits
+// the rows between threads)
+//
+//------------------------------------------------------------------------
+
+void blob_copy_row_split_u8c3(const uint8_t* src, uint8_t* dst0, uint8_t* dst1, uint8_t* dst2, int W);
+
+void blob_copy_row_split_f32c3(const float* src, float* dst0, float* dst1, float* dst2, int W);
+
+void blob_copy_row_merge_u8c3(const uint8_t* src0, const uint8_t* src1, const uint8_t* src2, uint8_t* dst, int W);
+
+void blob_copy_row_merge_f32c3(const float* src0, const float* src1, const float* src2, float* dst, int W);
+
+// U8 interleaved to FP32 planar, the conversion goes along with the transposition
+void blob_copy_row_split_u8c3_to_f32(const uint8_t* src, float* dst0, float* dst1, float* dst2, int W);
+
+}  // namespace avx512
+}  // namespace InferenceEngine
@@ -0,0 +1,130 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_utils_avx512.hpp"
+
+#include <immintrin.h>  // AVX-512
+
+namespace InferenceEngine {
+namespace avx512 {
+
+static inline __m512 mm512_scale(__m512 v, __m512 scale, __m512 bias) {
+    // not fused, as the scalar conversion does not fuse them either
+    return _mm512_add_ps(_mm512_mul_ps(v, scale), bias);
+}
+
+size_t convert_row_f16_to_f32(float* dst, const int16_t* src, size_t n, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 v = _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        _mm512_storeu_ps(dst + i, mm512_scale(v, vscale, vbias));
+    }
+    return i;
+}
+
+// the rounding, the saturation and the flush of the denormals of PrecisionUtils::f32tof16
+size_t convert_row_f32_to_f16(int16_t* dst, const float* src, size_t n, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+    const __m512 min16 = _mm512_castsi512_ps(_mm512_set1_epi32((127 - 14) << 23));
+    const __m512 halfMin16 = _mm512_mul_ps(min16, _mm512_set1_ps(0.5f));
+    const __m512 max16 = _mm512_castsi512_ps(_mm512_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+    const __m512 halfUlp = _mm512_castsi512_ps(_mm512_set1_epi32((127 - 11) << 23));
+    const __m512i absMask = _mm512_set1_epi32(0x7FFFFFFF);
+    const __m512i expMask = _mm512_set1_epi32(0x7F800000);
+    const __m512i signMask = _mm512_set1_epi32(0x8000);
+    const __m512i quietNan = _mm512_set1_epi32(0x0200);
+    const __m512i max16f16 = _mm512_set1_epi32(((15 + 15) << 10) | 0x3FF);
+    const __m512i min16f16 = _mm512_set1_epi32(1 << 10);
+    const __m512i expBias = _mm512_set1_epi32((127 - 15) << 23);
+    const __m512i zero = _mm512_setzero_si512();
+
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i u = _mm512_castps_si512(mm512_scale(_mm512_loadu_ps(src + i), vscale, vbias));
+        __m512i s = _mm512_and_si512(_mm512_srli_epi32(u, 16), signMask);
+        __m512i a = _mm512_and_si512(u, absMask);
+        __m512i e = _mm512_and_si512(a, expMask);
+
+        __mmask16 isSpecial = _mm512_cmpeq_epi32_mask(e, expMask);
+        __mmask16 isNan = _mm512_cmpgt_epi32_mask(a, expMask);
+        __m512i special = _mm512_mask_or_epi32(_mm512_srli_epi32(a, 23 - 10), isNan,
+                                               _mm512_srli_epi32(a, 23 - 10), quietNan);
+
+        __m512 v = _mm512_add_ps(_mm512_castsi512_ps(a), _mm512_mul_ps(_mm512_castsi512_ps(e), halfUlp));
+        __m512i r = _mm512_srli_epi32(_mm512_sub_epi32(_mm512_castps_si512(v), expBias), 23 - 10);
+        r = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(v, max16, _CMP_GE_OQ), r, max16f16);
+        r = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(v, min16, _CMP_LT_OQ), r, min16f16);
+        r = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(v, halfMin16, _CMP_LT_OQ), r, zero);
+        r = _mm512_mask_blend_epi32(isSpecial, r, special);
+        r = _mm512_or_si512(r, s);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm512_cvtepi32_epi16(r));
+    }
+    return i;
+}
+
+size_t convert_row_bf16_to_f32(float* dst, const int16_t* src, size_t n, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i u = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        __m512 v = _mm512_castsi512_ps(_mm512_slli_epi32(u, 16));
+        _mm512_storeu_ps(dst + i, mm512_scale(v, vscale, vbias));
+    }
+    return i;
+}
+
+// rounds to the nearest even as PrecisionUtils::f32tobf16, NaN stays NaN
+size_t convert_row_f32_to_bf16(int16_t* dst, const float* src, size_t n, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+    const __m512i absMask = _mm512_set1_epi32(0x7FFFFFFF);
+    const __m512i expMask = _mm512_set1_epi32(0x7F800000);
+    const __m512i quietNan = _mm512_set1_epi32(0x0040);
+    const __m512i roundBias = _mm512_set1_epi32(0x7FFF);
+    const __m512i one = _mm512_set1_epi32(1);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i u = _mm512_castps_si512(mm512_scale(_mm512_loadu_ps(src + i), vscale, vbias));
+        __mmask16 isNan = _mm512_cmpgt_epi32_mask(_mm512_and_si512(u, absMask), expMask);
+        __m512i odd = _mm512_and_si512(_mm512_srli_epi32(u, 16), one);
+        __m512i r = _mm512_srli_epi32(_mm512_add_epi32(u, _mm512_add_epi32(roundBias, odd)), 16);
+        r = _mm512_mask_blend_epi32(isNan, r, _mm512_or_si512(_mm512_srli_epi32(u, 16), quietNan));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm512_cvtepi32_epi16(r));
+    }
+    return i;
+}
+
+size_t convert_row_u8_to_f32(float* dst, const uint8_t* src, size_t n, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i u = _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm512_storeu_ps(dst + i, mm512_scale(_mm512_cvtepi32_ps(u), vscale, vbias));
+    }
+    return i;
+}
+
+// rounds to the nearest even and saturates as PrecisionUtils::f32tou8Arrays, NaN is converted to 0
+size_t convert_row_f32_to_u8(uint8_t* dst, const float* src, size_t n, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 max8 = _mm512_set1_ps(255.f);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 v = mm512_scale(_mm512_loadu_ps(src + i), vscale, vbias);
+        v = _mm512_min_ps(_mm512_max_ps(v, zero), max8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm512_cvtepi32_epi8(_mm512_cvtps_epi32(v)));
+    }
+    return i;
+}
+
+}  // namespace avx512
+}  // namespace InferenceEngine
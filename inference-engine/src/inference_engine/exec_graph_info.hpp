@@ -39,4 +39,34 @@ static const char OUTPUT_LAYOUTS[] = "outputLayouts";
  * @brief A general key for CNNLayer::params map. Used to get an execution order of primitive.
  */
 static const char EXECUTION_ORDER[] = "execOrder";
+/**
+ * @brief A general key for CNNLayer::params map. Used to get a string of layer types separated by a comma,
+ *        which are executed as post-ops of the current primitive (e.g. fused into its kernel).
+ */
+static const char FUSED_OPS[] = "fusedOps";
+/**
+ * @brief A general key for CNNLayer::params map. Used to get the format the weights of the executable primitive
+ *        are stored in, if it is not the dense one of the layer precision (e.g. compressed or sparse weights).
+ */
+static const char WEIGHTS_FORMAT[] = "weightsFormat";
+/**
+ * @brief A general key for CNNLayer::params map. Used to get the theoretical number of operations of an execution
+ *        of the primitive computed from its shapes, a multiply-add counts as 2 operations.
+ */
+static const char THEORETICAL_FLOPS[] = "theoreticalFlops";
+/**
+ * @brief A general key for CNNLayer::params map. Used to get the bytes of the inputs, outputs and weights
+ *        an execution of the primitive reads and writes.
+ */
+static const char MEMORY_TRAFFIC[] = "memoryTrafficBytes";
+/**
+ * @brief A general key for CNNLayer::params map. Used to get the operations per second of the primitive in GFLOPS,
+ *        derived from THEORETICAL_FLOPS and the measured execution time.
+ */
+static const char ACHIEVED_GFLOPS[] = "achievedGflops";
+/**
+ * @brief A general key for CNNLayer::params map. Used to get the memory bandwidth of the primitive in GB/s,
+ *        derived from MEMORY_TRAFFIC and the measured execution time.
+ */
+static const char ACHIEVED_BANDWIDTH[] = "achievedGBps";
 }  // namespace ExecGraphInfoSerialization
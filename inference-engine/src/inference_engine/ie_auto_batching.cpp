@@ -0,0 +1,317 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_metric_helpers.hpp"
+#include "ie_auto_batching.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "blob_factory.hpp"
+#include "cpp_interfaces/base/ie_infer_async_request_base.hpp"
+#include "cpp_interfaces/exception2status.hpp"
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+std::size_t batchOffset(const Blob::Ptr& blob, const Blob::Ptr& batchedBlob, std::size_t position,
+                        const std::string& name) {
+    const auto& desc = blob->getTensorDesc();
+    const auto& batchedDesc = batchedBlob->getTensorDesc();
+    if (desc.getPrecision() != batchedDesc.getPrecision() || desc.getLayout() != batchedDesc.getLayout()) {
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Blob '" << name
+                           << "' has the precision or layout other than the one of the batched network";
+    }
+    const auto offset = position * blob->byteSize();
+    if (offset + blob->byteSize() > batchedBlob->byteSize()) {
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Blob '" << name << "' does not fit the batch";
+    }
+    return offset;
+}
+
+/**
+ * @brief The only pipeline stage of the request: the request is run by the batched request of the network,
+ * so its executor queues the request and the stage task just reports the status of the batched request
+ */
+class AutoBatchAsyncInferRequest : public AsyncInferRequestThreadSafeDefault {
+public:
+    AutoBatchAsyncInferRequest(const AutoBatchInferRequest::Ptr& request, AutoBatchExecutableNetwork& network,
+                               const ITaskExecutor::Ptr& callbackExecutor)
+        : AsyncInferRequestThreadSafeDefault(request, nullptr, callbackExecutor), _autoBatchRequest(request) {
+        struct BatchExecutor : ITaskExecutor {
+            BatchExecutor(AutoBatchExecutableNetwork& network, AutoBatchInferRequest* request)
+                : _network(network), _request(request) {}
+            void run(Task task) override {
+                _network.Enqueue(_request, std::move(task));
+            }
+            AutoBatchExecutableNetwork& _network;
+            AutoBatchInferRequest* _request;
+        };
+
+        _pipeline = {{std::make_shared<BatchExecutor>(network, request.get()), [this] {
+                          if (StatusCode::OK != _autoBatchRequest->_status) {
+                              THROW_IE_EXCEPTION << InferenceEngine::details::as_status << _autoBatchRequest->_status;
+                          }
+                      }}};
+    }
+
+    ~AutoBatchAsyncInferRequest() override {
+        StopAndWait();
+    }
+
+private:
+    AutoBatchInferRequest::Ptr _autoBatchRequest;
+};
+
+}  // namespace
+
+AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap& networkInputs,
+                                             const OutputsDataMap& networkOutputs,
+                                             AutoBatchExecutableNetwork& network)
+    : InferRequestInternal(networkInputs, networkOutputs), _network(network) {
+    for (auto&& input : _networkInputs) {
+        auto blob = make_blob_with_precision(input.second->getTensorDesc());
+        blob->allocate();
+        _inputs[input.first] = blob;
+    }
+    for (auto&& output : _networkOutputs) {
+        auto blob = make_blob_with_precision(output.second->getTensorDesc());
+        blob->allocate();
+        _outputs[output.first] = blob;
+    }
+}
+
+void AutoBatchInferRequest::InferImpl() {
+    std::promise<void> done;
+    _network.Enqueue(this, [&done] {
+        done.set_value();
+    });
+    done.get_future().wait();
+    if (StatusCode::OK != _status) {
+        THROW_IE_EXCEPTION << InferenceEngine::details::as_status << _status;
+    }
+}
+
+void AutoBatchInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo>& perfMap) const {
+    perfMap = _perfMap;
+}
+
+void AutoBatchInferRequest::CopyInputsTo(InferRequest& batchedRequest, std::size_t position) {
+    execDataPreprocessing(_inputs);
+    for (auto&& input : _inputs) {
+        auto batchedBlob = batchedRequest.GetBlob(input.first);
+        const auto offset = batchOffset(input.second, batchedBlob, position, input.first);
+        auto src = input.second->cbuffer();
+        auto dst = batchedBlob->buffer();
+        std::memcpy(dst.as<uint8_t*>() + offset, src.as<const uint8_t*>(), input.second->byteSize());
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFrom(InferRequest& batchedRequest, std::size_t position) {
+    for (auto&& output : _outputs) {
+        auto batchedBlob = batchedRequest.GetBlob(output.first);
+        const auto offset = batchOffset(output.second, batchedBlob, position, output.first);
+        auto src = batchedBlob->cbuffer();
+        auto dst = output.second->buffer();
+        std::memcpy(dst.as<uint8_t*>(), src.as<const uint8_t*>() + offset, output.second->byteSize());
+    }
+    try {
+        _perfMap = batchedRequest.GetPerformanceCounts();
+    } catch (const InferenceEngineException&) {
+        _perfMap.clear();
+    }
+}
+
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(const ExecutableNetwork& batchedNetwork,
+                                                       const InputsDataMap& networkInputs,
+                                                       const OutputsDataMap& networkOutputs, std::size_t batchSize,
+                                                       std::chrono::milliseconds timeout, bool dynamicBatch)
+    : _batchedNetwork(batchedNetwork), _batchSize(batchSize), _timeout(timeout), _dynamicBatch(dynamicBatch) {
+    _networkInputs = networkInputs;
+    _networkOutputs = networkOutputs;
+
+    unsigned int numRequests = 1;
+    try {
+        numRequests = std::max(1u, _batchedNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))
+                                         .as<unsigned int>());
+    } catch (const InferenceEngineException&) {}
+
+    for (unsigned int i = 0; i < numRequests; i++) {
+        std::unique_ptr<BatchedRequest> batchedRequest(new BatchedRequest);
+        batchedRequest->_request = _batchedNetwork.CreateInferRequestPtr();
+        auto request = batchedRequest.get();
+        batchedRequest->_request->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+            [this, request](InferRequest, StatusCode status) {
+                Complete(*request, status);
+            });
+        _freeRequests.push_back(request);
+        _batchedRequests.emplace_back(std::move(batchedRequest));
+    }
+
+    _collector = std::thread([this] {
+        Collect();
+    });
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cv.notify_all();
+    if (_collector.joinable()) {
+        _collector.join();
+    }
+    // the completion callbacks of the started batched requests use the network, so they are drained
+    // before the members are destroyed
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] {
+            return _completing == 0 && _freeRequests.size() == _batchedRequests.size();
+        });
+    }
+    for (auto&& batchedRequest : _batchedRequests) {
+        try {
+            batchedRequest->_request->Wait(IInferRequest::WaitMode::RESULT_READY);
+        } catch (...) {}
+    }
+}
+
+InferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                                            OutputsDataMap networkOutputs) {
+    return std::make_shared<AutoBatchInferRequest>(networkInputs, networkOutputs, *this);
+}
+
+void AutoBatchExecutableNetwork::CreateInferRequest(IInferRequest::Ptr& asyncRequest) {
+    auto syncRequestImpl = std::static_pointer_cast<AutoBatchInferRequest>(
+        CreateInferRequestImpl(_networkInputs, _networkOutputs));
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncTreadSafeImpl = std::make_shared<AutoBatchAsyncInferRequest>(syncRequestImpl, *this, _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase<AutoBatchAsyncInferRequest>(asyncTreadSafeImpl),
+                       [](IInferRequest* p) {
+                           p->Release();
+                       });
+    asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+}
+
+void AutoBatchExecutableNetwork::GetConfig(const std::string& name, Parameter& result, ResponseDesc*) const {
+    result = _batchedNetwork.GetConfig(name);
+}
+
+void AutoBatchExecutableNetwork::GetMetric(const std::string& name, Parameter& result, ResponseDesc*) const {
+    if (METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
+        // every batched request needs a full batch of the user requests
+        result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS,
+                               static_cast<unsigned int>(_batchedRequests.size() * _batchSize));
+    } else {
+        result = _batchedNetwork.GetMetric(name);
+    }
+}
+
+void AutoBatchExecutableNetwork::Export(std::ostream&) {
+    THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Networks with automatic batching cannot be exported";
+}
+
+void AutoBatchExecutableNetwork::Enqueue(AutoBatchInferRequest* request, Task task) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending.push_back({request, std::move(task), std::chrono::steady_clock::now()});
+    }
+    _cv.notify_all();
+}
+
+void AutoBatchExecutableNetwork::Collect() {
+    while (true) {
+        BatchedRequest* batchedRequest = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [this] {
+                return _stop || !_pending.empty();
+            });
+            if (_stop) {
+                return;
+            }
+            // the oldest request waits for the batch to fill up until its timeout expires
+            const auto deadline = _pending.front()._enqueued + _timeout;
+            _cv.wait_until(lock, deadline, [this] {
+                return _stop || _pending.size() >= _batchSize;
+            });
+            _cv.wait(lock, [this] {
+                return _stop || !_freeRequests.empty();
+            });
+            if (_stop) {
+                return;
+            }
+
+            batchedRequest = _freeRequests.back();
+            _freeRequests.pop_back();
+            const auto size = std::min(_pending.size(), _batchSize);
+            batchedRequest->_batch.assign(std::make_move_iterator(_pending.begin()),
+                                          std::make_move_iterator(_pending.begin() + size));
+            _pending.erase(_pending.begin(), _pending.begin() + size);
+        }
+        Execute(*batchedRequest);
+    }
+}
+
+void AutoBatchExecutableNetwork::Execute(BatchedRequest& batchedRequest) {
+    try {
+        for (std::size_t i = 0; i < batchedRequest._batch.size(); i++) {
+            batchedRequest._batch[i]._request->CopyInputsTo(*batchedRequest._request, i);
+        }
+        if (_dynamicBatch) {
+            batchedRequest._request->SetBatch(static_cast<int>(batchedRequest._batch.size()));
+        }
+        batchedRequest._request->StartAsync();
+    } catch (const InferenceEngineException& ex) {
+        Complete(batchedRequest, ex.hasStatus() ? ex.getStatus() : StatusCode::GENERAL_ERROR);
+    } catch (...) {
+        Complete(batchedRequest, StatusCode::GENERAL_ERROR);
+    }
+}
+
+void AutoBatchExecutableNetwork::Complete(BatchedRequest& batchedRequest, StatusCode status) {
+    auto batch = std::move(batchedRequest._batch);
+    batchedRequest._batch.clear();
+    for (std::size_t i = 0; i < batch.size(); i++) {
+        auto requestStatus = status;
+        if (StatusCode::OK == requestStatus) {
+            try {
+                batch[i]._request->CopyOutputsFrom(*batchedRequest._request, i);
+            } catch (...) {
+                requestStatus = StatusCode::GENERAL_ERROR;
+            }
+        }
+        batch[i]._request->_status = requestStatus;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _freeRequests.push_back(&batchedRequest);
+        _completing++;
+    }
+    _cv.notify_all();
+
+    for (auto&& pending : batch) {
+        pending._task();
+    }
+
+    // the network can be destroyed once the counter is released, so it is notified under the lock
+    std::lock_guard<std::mutex> lock(_mutex);
+    _completing--;
+    _cv.notify_all();
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Executable network which executes its inference requests in batches, used by Core::LoadNetwork
+ * @file ie_auto_batching.hpp
+ */
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cpp/ie_cnn_network.h"
+#include "cpp/ie_executable_network.hpp"
+#include "cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+class AutoBatchExecutableNetwork;
+
+/**
+ * @brief A request of the original batch, its inputs are copied into a batched request together with the inputs
+ * of other requests and the outputs are copied back once the batched request is done
+ */
+class AutoBatchInferRequest : public InferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<AutoBatchInferRequest>;
+
+    AutoBatchInferRequest(const InputsDataMap& networkInputs, const OutputsDataMap& networkOutputs,
+                          AutoBatchExecutableNetwork& network);
+
+    void InferImpl() override;
+
+    void GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo>& perfMap) const override;
+
+    /**
+     * @brief Pre-processes the inputs and copies them to the batch position of the batched request
+     */
+    void CopyInputsTo(InferRequest& batchedRequest, std::size_t position);
+
+    /**
+     * @brief Copies the outputs from the batch position of the batched request
+     */
+    void CopyOutputsFrom(InferRequest& batchedRequest, std::size_t position);
+
+    StatusCode _status = StatusCode::OK;
+
+private:
+    AutoBatchExecutableNetwork& _network;
+    std::map<std::string, InferenceEngineProfileInfo> _perfMap;
+};
+
+/**
+ * @brief Wraps a network loaded with the batch of N, so that requests of the original batch started within
+ * a time window are executed as one request of the batched network
+ */
+class AutoBatchExecutableNetwork : public ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+
+    /**
+     * @param batchedNetwork - the network loaded with the batch of batchSize
+     * @param networkInputs - inputs of the original network, their batch must be 1
+     * @param networkOutputs - outputs of the original network
+     * @param timeout - the time a request waits for others to fill the batch up
+     * @param dynamicBatch - if partially filled batches can be limited with SetBatch()
+     */
+    AutoBatchExecutableNetwork(const ExecutableNetwork& batchedNetwork, const InputsDataMap& networkInputs,
+                               const OutputsDataMap& networkOutputs, std::size_t batchSize,
+                               std::chrono::milliseconds timeout, bool dynamicBatch);
+    ~AutoBatchExecutableNetwork() override;
+
+    InferRequestInternal::Ptr CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                     OutputsDataMap networkOutputs) override;
+
+    void CreateInferRequest(IInferRequest::Ptr& asyncRequest) override;
+
+    void GetConfig(const std::string& name, Parameter& result, ResponseDesc* resp) const override;
+
+    void GetMetric(const std::string& name, Parameter& result, ResponseDesc* resp) const override;
+
+    void Export(std::ostream& networkModel) override;
+
+    /**
+     * @brief Queues the request to be executed with the next batch, the task is run once its outputs are ready
+     */
+    void Enqueue(AutoBatchInferRequest* request, Task task);
+
+private:
+    struct Pending {
+        AutoBatchInferRequest* _request;
+        Task _task;
+        std::chrono::steady_clock::time_point _enqueued;
+    };
+
+    struct BatchedRequest {
+        InferRequest::Ptr _request;
+        std::vector<Pending> _batch;
+    };
+
+    void Collect();
+    void Execute(BatchedRequest& batchedRequest);
+    void Complete(BatchedRequest& batchedRequest, StatusCode status);
+
+    ExecutableNetwork _batchedNetwork;
+    std::size_t _batchSize;
+    std::chrono::milliseconds _timeout;
+    bool _dynamicBatch;
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque<Pending> _pending;
+    // as many batched requests as the batched network needs to be fully loaded
+    std::vector<std::unique_ptr<BatchedRequest>> _batchedRequests;
+    std::vector<BatchedRequest*> _freeRequests;
+    // the batched requests which completion callbacks still run the tasks of their batches
+    std::size_t _completing = 0;
+    bool _stop = false;
+    std::thread _collector;
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,277 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_binary_network.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "file_utils.h"
+#include "ie_blob_proxy.hpp"
+#include "ie_format_parser.h"
+#include "ie_profiling.hpp"
+#include "mmap_allocator.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+constexpr uint32_t BinaryNetworkHeader::currentVersion;
+constexpr size_t BinaryNetworkHeader::sectionAlignment;
+constexpr size_t BinaryNetworkHeader::blobAlignment;
+
+namespace {
+
+class TopologyReader {
+public:
+    TopologyReader(const uint8_t* data, size_t size): _cur(data), _end(data + size) {}
+
+    template <typename T>
+    T read() {
+        require(sizeof(T));
+        T value;
+        std::memcpy(&value, _cur, sizeof(T));
+        _cur += sizeof(T);
+        return value;
+    }
+
+    // the count of the items which take at least itemSize bytes each of the rest of the section
+    uint32_t readCount(size_t itemSize) {
+        auto count = read<uint32_t>();
+        require(count * static_cast<uint64_t>(itemSize));
+        return count;
+    }
+
+    std::string readString() {
+        auto length = readCount(1);
+        std::string str(reinterpret_cast<const char*>(_cur), length);
+        _cur += length;
+        return str;
+    }
+
+    uint32_t readIndex(size_t count) {
+        auto index = read<uint32_t>();
+        if (index >= count) THROW_IE_EXCEPTION << "The binary network refers to the missing data " << index;
+        return index;
+    }
+
+    TensorDesc readDesc() {
+        auto precision = static_cast<Precision::ePrecision>(read<int32_t>());
+        auto layout = static_cast<Layout>(read<int32_t>());
+        SizeVector dims(readCount(sizeof(uint64_t)));
+        for (auto& dim : dims) dim = static_cast<size_t>(read<uint64_t>());
+        return TensorDesc(precision, dims, layout);
+    }
+
+private:
+    void require(uint64_t size) const {
+        if (static_cast<uint64_t>(_end - _cur) < size)
+            THROW_IE_EXCEPTION << "The topology section of the binary network is truncated";
+    }
+
+    const uint8_t* _cur;
+    const uint8_t* _end;
+};
+
+TBlob<uint8_t>::Ptr readFile(const std::string& path, size_t size) {
+    TensorDesc desc(Precision::U8, {size}, Layout::C);
+    TBlob<uint8_t>::Ptr file;
+    if (MmapAllocator::isSupported()) {
+        std::shared_ptr<IAllocator> mmapAllocator = std::make_shared<MmapAllocator>(path);
+        file = std::make_shared<TBlob<uint8_t>>(desc, mmapAllocator);
+        file->allocate();
+        if (file->cbuffer() == nullptr) file.reset();
+    }
+    if (!file) {
+        file = std::make_shared<TBlob<uint8_t>>(desc);
+        file->allocate();
+        FileUtils::readAllFile(path, file->buffer(), size);
+    }
+    return file;
+}
+
+template <typename T>
+Blob::Ptr viewBlob(const TBlob<uint8_t>::Ptr& file, const TensorDesc& desc, size_t offset, uint64_t blobSize) {
+    // the dimensions are read from the file, so their product is checked for the overflow as well
+    uint64_t bytes = sizeof(T);
+    for (auto dim : desc.getDims()) {
+        if (dim != 0 && bytes > blobSize / dim)
+            THROW_IE_EXCEPTION << "The blob of the binary network is larger than its " << blobSize << " bytes";
+        bytes *= dim;
+    }
+    if (bytes > blobSize)
+        THROW_IE_EXCEPTION << "The blob of the binary network is larger than its " << blobSize << " bytes";
+    return std::make_shared<TBlobProxy<T>>(desc.getPrecision(), desc.getLayout(), file, offset, desc.getDims());
+}
+
+// the blobs are typed as the ones FormatParser::GetBlobFromSegment creates from the IR weights
+Blob::Ptr viewBlob(const TBlob<uint8_t>::Ptr& file, const TensorDesc& desc, size_t offset, uint64_t blobSize) {
+    const auto precision = desc.getPrecision();
+    switch (precision) {
+    case Precision::FP32:
+        return viewBlob<float>(file, desc, offset, blobSize);
+    case Precision::I64:
+        return viewBlob<int64_t>(file, desc, offset, blobSize);
+    case Precision::I32:
+        return viewBlob<int32_t>(file, desc, offset, blobSize);
+    case Precision::I16:
+    case Precision::Q78:
+    case Precision::FP16:
+        return viewBlob<short>(file, desc, offset, blobSize);
+    case Precision::U8:
+    case Precision::BOOL:
+    case Precision::BIN:
+        return viewBlob<uint8_t>(file, desc, offset, blobSize);
+    case Precision::I8:
+        return viewBlob<int8_t>(file, desc, offset, blobSize);
+    default:
+        THROW_IE_EXCEPTION << "precision " << precision << " is not supported...";
+    }
+}
+
+}  // namespace
+
+bool InferenceEngine::details::IsBinaryNetwork(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    char magic[sizeof(binaryNetworkMagic)] = {};
+    if (!file.read(magic, sizeof(magic))) return false;
+    return std::memcmp(magic, binaryNetworkMagic, sizeof(magic)) == 0;
+}
+
+CNNNetworkImplPtr InferenceEngine::details::ReadBinaryNetwork(const std::string& path) {
+    IE_PROFILING_AUTO_SCOPE(ReadBinaryNetwork)
+    int64_t fileSize = FileUtils::fileSize(path);
+    if (fileSize < static_cast<int64_t>(sizeof(BinaryNetworkHeader)))
+        THROW_IE_EXCEPTION << "The file " << path << " is not the binary network";
+
+    const auto size = static_cast<size_t>(fileSize);
+    auto file = readFile(path, size);
+    const auto data = file->cbuffer().as<const uint8_t*>();
+
+    BinaryNetworkHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, binaryNetworkMagic, sizeof(header.magic)) != 0)
+        THROW_IE_EXCEPTION << "The file " << path << " is not the binary network";
+    if (header.version != BinaryNetworkHeader::currentVersion)
+        THROW_IE_EXCEPTION << "The binary network " << path << " has the unsupported version " << header.version;
+    if (header.topologyOffset > size || header.topologySize > size - header.topologyOffset ||
+        header.weightsOffset > size || header.weightsSize > size - header.weightsOffset)
+        THROW_IE_EXCEPTION << "The sections of the binary network " << path << " exceed the file";
+
+    TopologyReader topology(data + header.topologyOffset, static_cast<size_t>(header.topologySize));
+    FormatParser parser(header.irVersion);
+    CNNNetworkImplPtr network = std::make_shared<CNNNetworkImpl>();
+    network->setName(topology.readString());
+    network->setPrecision(static_cast<Precision::ePrecision>(topology.read<int32_t>()));
+
+    // every count is checked against the rest of the section before anything is allocated for it
+    std::vector<DataPtr> datas(topology.readCount(4 * sizeof(uint32_t)));
+    for (auto& data : datas) {
+        auto name = topology.readString();
+        data = std::make_shared<Data>(name, topology.readDesc());
+        network->addData(name.c_str(), data);
+    }
+
+    auto readBlob = [&]() {
+        auto desc = topology.readDesc();
+        auto offset = topology.read<uint64_t>();
+        auto blobSize = topology.read<uint64_t>();
+        if (offset > header.weightsSize || blobSize > header.weightsSize - offset)
+            THROW_IE_EXCEPTION << "The blob of the binary network " << path << " exceeds the weights section";
+        return viewBlob(file, desc, static_cast<size_t>(header.weightsOffset + offset), blobSize);
+    };
+
+    auto layersNum = topology.readCount(3 * sizeof(uint32_t));
+    for (uint32_t l = 0; l < layersNum; l++) {
+        LayerParseParameters prms;
+        prms.underIRVersion = header.irVersion;
+        prms.prms.name = topology.readString();
+        prms.prms.type = topology.readString();
+        prms.prms.precision = static_cast<Precision::ePrecision>(topology.read<int32_t>());
+
+        CNNLayer::Ptr layer = parser.CreateLayer(prms);
+        if (!layer) THROW_IE_EXCEPTION << "Don't know how to create Layer type: " << prms.prms.type;
+
+        auto paramsNum = topology.readCount(2 * sizeof(uint32_t));
+        for (uint32_t p = 0; p < paramsNum; p++) {
+            auto key = topology.readString();
+            layer->params[key] = topology.readString();
+        }
+
+        layer->insData.resize(topology.readCount(sizeof(uint32_t)));
+        for (auto& input : layer->insData) {
+            auto& data = datas[topology.readIndex(datas.size())];
+            input = data;
+            data->getInputTo()[layer->name] = layer;
+        }
+        layer->outData.resize(topology.readCount(sizeof(uint32_t)));
+        for (auto& output : layer->outData) {
+            output = datas[topology.readIndex(datas.size())];
+            if (output->getCreatorLayer().lock())
+                THROW_IE_EXCEPTION << "two layers set to the same output [" << output->getName() << "]";
+            output->getCreatorLayer() = layer;
+        }
+
+        auto blobsNum = topology.readCount(sizeof(uint32_t));
+        for (uint32_t b = 0; b < blobsNum; b++) {
+            auto name = topology.readString();
+            layer->blobs[name] = readBlob();
+        }
+        if (auto weightable = dynamic_cast<WeightableLayer*>(layer.get())) {
+            if (layer->blobs.count("weights")) weightable->_weights = layer->blobs["weights"];
+            if (layer->blobs.count("biases")) weightable->_biases = layer->blobs["biases"];
+        }
+        network->addLayer(layer);
+    }
+
+    auto inputsNum = topology.readCount(sizeof(uint32_t));
+    for (uint32_t i = 0; i < inputsNum; i++) {
+        InputInfo::Ptr info(new InputInfo());
+        info->setInputData(datas[topology.readIndex(datas.size())]);
+
+        PreProcessInfo& pp = info->getPreProcess();
+        auto variant = static_cast<MeanVariant>(topology.read<int32_t>());
+        pp.setResizeAlgorithm(static_cast<ResizeAlgorithm>(topology.read<int32_t>()));
+        pp.setColorFormat(static_cast<ColorFormat>(topology.read<uint32_t>()));
+        pp.init(topology.readCount(2 * sizeof(float) + sizeof(uint8_t)));
+        for (size_t ch = 0; ch < pp.getNumberOfChannels(); ch++) {
+            pp[ch]->stdScale = topology.read<float>();
+            pp[ch]->meanValue = topology.read<float>();
+            if (topology.read<uint8_t>()) pp[ch]->meanData = readBlob();
+        }
+        pp.setVariant(variant);
+        network->setInputInfo(info);
+    }
+
+    auto outputsNum = topology.readCount(sizeof(uint32_t));
+    for (uint32_t o = 0; o < outputsNum; o++) {
+        network->addOutput(datas[topology.readIndex(datas.size())]->getName());
+    }
+
+    NetworkStatsMap statsMap;
+    auto statsNum = topology.readCount(3 * sizeof(uint32_t));
+    for (uint32_t s = 0; s < statsNum; s++) {
+        auto name = topology.readString();
+        auto stats = std::make_shared<NetworkNodeStats>();
+        stats->_minOutputs.resize(topology.readCount(sizeof(float)));
+        for (auto& value : stats->_minOutputs) value = topology.read<float>();
+        stats->_maxOutputs.resize(topology.readCount(sizeof(float)));
+        for (auto& value : stats->_maxOutputs) value = topology.read<float>();
+        statsMap[name] = stats;
+    }
+    if (!statsMap.empty()) {
+        ICNNNetworkStats* networkStats = nullptr;
+        if (network->getStats(&networkStats, nullptr) == OK && networkStats != nullptr)
+            networkStats->setNodesStats(statsMap);
+    }
+
+    // the typed fields of the layers are filled from their parameters, as for the layers of the IR
+    for (const auto& kvp : network->allLayers()) {
+        kvp.second->validateLayer();
+    }
+    network->validate(static_cast<int>(header.irVersion));
+    return network;
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief The binary network format, the single file alternative of the IR which is mapped instead of parsed
+ * @file ie_binary_network.hpp
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "cnn_network_impl.hpp"
+#include "ie_api.h"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief The header at the start of the binary network file.
+ *
+ * The topology section follows the header: the sizes, the enumerations and the dimensions are stored as the
+ * fixed size integers in the byte order of the host, the strings are prefixed by their 32 bit lengths, so the
+ * network is restored without the text parsing. The weights section starts at the page aligned offset and every
+ * blob of it starts at the 64 bytes boundary, so the blobs of the layers view the mapping of the file.
+ */
+struct BinaryNetworkHeader {
+    static constexpr uint32_t currentVersion = 1;
+    static constexpr size_t sectionAlignment = 4096;
+    static constexpr size_t blobAlignment = 64;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t irVersion;  // the version of the IR the layer parameters follow
+    uint64_t topologyOffset;
+    uint64_t topologySize;
+    uint64_t weightsOffset;
+    uint64_t weightsSize;
+};
+
+/**
+ * @brief The magic number the binary network file starts with
+ */
+constexpr char binaryNetworkMagic[8] = {'I', 'E', 'N', 'E', 'T', 'B', 'I', 'N'};
+
+/**
+ * @brief The extension of the path CNNNetwork::serialize writes the binary network to
+ */
+constexpr const char binaryNetworkExtension[] = ".ienb";
+
+/**
+ * @brief Checks whether the file starts with the magic number of the binary network
+ * @param path The path to the file
+ * @return false if the file cannot be read or it is not the binary network
+ */
+INFERENCE_ENGINE_API_CPP(bool) IsBinaryNetwork(const std::string& path);
+
+/**
+ * @brief Reads the network written by NetworkSerializer::serializeBinary. The file is mapped when the platform
+ * supports it, the blobs of the layers and the mean images keep the mapping alive.
+ * @param path The path to the file
+ * @return The network, validated as the one read from the IR
+ */
+INFERENCE_ENGINE_API_CPP(CNNNetworkImplPtr) ReadBinaryNetwork(const std::string& path);
+
+}  // namespace details
+}  // namespace InferenceEngine
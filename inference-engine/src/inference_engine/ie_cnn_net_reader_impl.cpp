@@ -19,6 +19,7 @@
 #include "ie_format_parser.h"
 #include "ie_ir_reader.hpp"
 #include "ie_profiling.hpp"
+#include "mmap_allocator.hpp"
 #include "parsers.h"
 #include "xml_parse_utils.h"
 
@@ -39,9 +40,7 @@ StatusCode CNNNetReaderImpl::SetWeights(const TBlob<uint8_t>::Ptr& weights, Resp
 #if defined(ENABLE_IR_READER) && defined(ENABLE_NGRAPH)
             // It's time to perform actual reading of V10 network and instantiate CNNNetworkNGraphImpl
             IRReader v10Reader(extensions);
-            std::stringstream model;
-            xmlDoc->save(model);
-            network = std::make_shared<CNNNetworkNGraphImpl>(v10Reader.read(model.str(), weights));
+            network = std::make_shared<CNNNetworkNGraphImpl>(v10Reader.readXml(*xmlDoc, weights));
 #else
             return DescriptionBuffer(desc) << "Please, recompile Inference Engine with the ENABLE_IR_READER=ON AND "
                                               "ENABLE_NGRAPH=ON Cmake option";
@@ -69,9 +68,12 @@ StatusCode CNNNetReaderImpl::ReadNetwork(const void* model, size_t size, Respons
     }
 
     xmlDoc = std::make_shared<pugi::xml_document>();
-    pugi::xml_parse_result res = xmlDoc->load_buffer(model, size);
-    if (res.status != pugi::status_ok) {
-        return DescriptionBuffer(resp) << res.description() << "at offset " << res.offset;
+    {
+        IE_PROFILING_AUTO_SCOPE(CNNNetReaderImpl::parseXml)
+        pugi::xml_parse_result res = xmlDoc->load_buffer(model, size);
+        if (res.status != pugi::status_ok) {
+            return DescriptionBuffer(resp) << res.description() << "at offset " << res.offset;
+        }
     }
     StatusCode ret = ReadNetwork();
     if (ret != OK) {
@@ -96,9 +98,23 @@ StatusCode CNNNetReaderImpl::ReadWeights(const char* filepath, ResponseDesc* res
     auto ulFileSize = static_cast<size_t>(fileSize);
 
     try {
-        TBlob<uint8_t>::Ptr weightsPtr(new TBlob<uint8_t>(TensorDesc(Precision::U8, {ulFileSize}, Layout::C)));
-        weightsPtr->allocate();
-        FileUtils::readAllFile(filepath, weightsPtr->buffer(), ulFileSize);
+        TensorDesc weightsDesc(Precision::U8, {ulFileSize}, Layout::C);
+        TBlob<uint8_t>::Ptr weightsPtr;
+
+        // Map the weights file instead of reading it: layers reference the mapping directly,
+        // and pages are shared with the page cache and other processes loading the same model
+        if (MmapAllocator::isSupported()) {
+            std::shared_ptr<IAllocator> mmapAllocator = std::make_shared<MmapAllocator>(filepath);
+            weightsPtr = std::make_shared<TBlob<uint8_t>>(weightsDesc, mmapAllocator);
+            weightsPtr->allocate();
+            if (weightsPtr->cbuffer() == nullptr) weightsPtr.reset();
+        }
+
+        if (!weightsPtr) {
+            weightsPtr = std::make_shared<TBlob<uint8_t>>(weightsDesc);
+            weightsPtr->allocate();
+            FileUtils::readAllFile(filepath, weightsPtr->buffer(), ulFileSize);
+        }
         return SetWeights(weightsPtr, resp);
     } catch (const InferenceEngineException& ex) {
         return DescriptionBuffer(resp) << ex.what();
@@ -0,0 +1,196 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_compiled_network_cache.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "details/ie_cnn_network_tools.h"
+#include "details/ie_exception.hpp"
+#include "file_utils.h"
+#include "ie_layers.h"
+#include "net_pass.h"
+#ifdef ENABLE_NGRAPH
+#include "cnn_network_ngraph_impl.hpp"
+#endif
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+/**
+ * @brief Stream buffer which does not store anything, but computes FNV-1a hash of all written bytes
+ */
+class HashStreamBuf : public std::streambuf {
+public:
+    uint64_t getHash() const {
+        return _hash;
+    }
+
+protected:
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            char ch = traits_type::to_char_type(c);
+            update(&ch, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        update(s, static_cast<size_t>(n));
+        return n;
+    }
+
+private:
+    void update(const char* data, size_t size) {
+        for (size_t i = 0; i < size; i++) {
+            _hash ^= static_cast<uint8_t>(data[i]);
+            _hash *= 1099511628211ULL;
+        }
+    }
+
+    uint64_t _hash = 14695981039346656037ULL;
+};
+
+void hashDesc(std::ostream& stream, const TensorDesc& desc) {
+    stream << desc.getPrecision() << desc.getLayout();
+    for (auto dim : desc.getDims()) stream << ',' << dim;
+    stream << ';';
+}
+
+void hashLayers(std::ostream& stream, const std::vector<CNNLayerPtr>& layers) {
+    for (const auto& layer : layers) {
+        stream << layer->name << ';' << layer->type << ';' << layer->precision << ';';
+        for (const auto& param : layer->params) stream << param.first << '=' << param.second << ';';
+        for (const auto& in : layer->insData) {
+            auto data = in.lock();
+            if (data) stream << data->getName() << ';';
+        }
+        for (const auto& out : layer->outData) {
+            stream << out->getName() << ';';
+            hashDesc(stream, out->getTensorDesc());
+        }
+        // the blobs are hashed in place instead of being serialized into a copy
+        for (const auto& blob : layer->blobs) {
+            stream << blob.first << ';';
+            if (!blob.second) continue;
+            hashDesc(stream, blob.second->getTensorDesc());
+            if (auto data = blob.second->cbuffer().as<const char*>()) stream.write(data, blob.second->byteSize());
+        }
+
+        if (auto ti = dynamic_cast<const TensorIterator*>(layer.get())) {
+            for (const auto& rules : {&ti->input_port_map, &ti->output_port_map, &ti->back_edges}) {
+                for (const auto& rule : *rules) {
+                    stream << rule.from << ',' << rule.to << ',' << rule.axis << ',' << rule.stride << ','
+                           << rule.start << ',' << rule.end << ',' << rule.part_size << ';';
+                }
+            }
+            hashLayers(stream, NetPass::TIBodySortTopologically(ti->body));
+        }
+    }
+}
+
+void hashNetwork(std::ostream& stream, const ICNNNetwork& network) {
+    hashLayers(stream, CNNNetSortTopologically(network));
+
+    // Settings which are applied by application after reading and might not be reflected in IR
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    for (auto&& input : inputs) {
+        const auto& desc = input.second->getTensorDesc();
+        const auto& preProcess = input.second->getPreProcess();
+        stream << input.first << desc.getPrecision() << desc.getLayout();
+        for (auto dim : desc.getDims()) stream << ',' << dim;
+        stream << preProcess.getResizeAlgorithm() << preProcess.getColorFormat() << preProcess.getMeanVariant();
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+            stream << preProcess[c]->meanValue << preProcess[c]->stdScale;
+        }
+    }
+
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    for (auto&& output : outputs) {
+        stream << output.first << output.second->getPrecision() << output.second->getLayout();
+    }
+}
+
+}  // namespace
+
+CompiledNetworkCache::CompiledNetworkCache(const std::string& cacheDir): _cacheDir(cacheDir) {}
+
+std::string CompiledNetworkCache::computeHash(const ICNNNetwork& network, const std::string& deviceName,
+                                              const std::map<std::string, std::string>& config,
+                                              const Version& pluginVersion) {
+    HashStreamBuf hashBuf;
+    std::ostream stream(&hashBuf);
+
+#ifdef ENABLE_NGRAPH
+    if (auto networkNGraph = dynamic_cast<const CNNNetworkNGraphImpl*>(&network)) {
+        // nGraph based network has to be converted first, since serializer works with CNNLayers
+        auto cloned = networkNGraph->cloneNGraphImpl();
+        cloned->convertToCNNNetworkImplInPlace();
+        hashNetwork(stream, *cloned->getCNNNetwork());
+    } else {
+        hashNetwork(stream, network);
+    }
+#else
+    hashNetwork(stream, network);
+#endif
+
+    stream << deviceName;
+    for (auto&& item : config) {
+        stream << item.first << '=' << item.second << ';';
+    }
+    stream << pluginVersion.apiVersion.major << '.' << pluginVersion.apiVersion.minor;
+    if (pluginVersion.buildNumber) stream << pluginVersion.buildNumber;
+    if (pluginVersion.description) stream << pluginVersion.description;
+    stream.flush();
+
+    std::stringstream hex;
+    hex << std::hex << std::setw(16) << std::setfill('0') << hashBuf.getHash();
+    return hex.str();
+}
+
+std::string CompiledNetworkCache::getBlobPath(const std::string& hash) const {
+    return FileUtils::makePath(_cacheDir, hash + ".blob");
+}
+
+bool CompiledNetworkCache::contains(const std::string& hash) const {
+    return FileUtils::fileExist(getBlobPath(hash));
+}
+
+std::string CompiledNetworkCache::getTempBlobPath(const std::string& hash) const {
+    // several processes might compile the same network at once, so each of them writes its own file
+    std::stringstream suffix;
+    suffix << std::hash<std::thread::id>()(std::this_thread::get_id()) << '_'
+           << std::chrono::steady_clock::now().time_since_epoch().count();
+    return getBlobPath(hash) + "." + suffix.str() + ".tmp";
+}
+
+void CompiledNetworkCache::commit(const std::string& tempPath, const std::string& hash) const {
+    if (std::rename(tempPath.c_str(), getBlobPath(hash).c_str()) != 0) {
+        // the entry is already published by a concurrent process
+        std::remove(tempPath.c_str());
+    }
+}
+
+void CompiledNetworkCache::remove(const std::string& hash) const {
+    std::remove(getBlobPath(hash).c_str());
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
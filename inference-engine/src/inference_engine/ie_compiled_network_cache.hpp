@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Helpers for the persistent compiled networks cache used by Core::LoadNetwork and plugins
+ * @file ie_compiled_network_cache.hpp
+ */
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "ie_icnn_network.hpp"
+#include "ie_version.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Keeps networks exported by plugins in a cache directory.
+ *
+ * Every entry is a single file named after a hash of everything that influences compilation: the network
+ * topology, weights, inputs and outputs settings, the device name, the device config and the plugin version.
+ */
+class INFERENCE_ENGINE_API_CLASS(CompiledNetworkCache) {
+public:
+    explicit CompiledNetworkCache(const std::string& cacheDir);
+
+    /**
+     * @brief Computes a key of a cache entry
+     * @param network A network to be loaded
+     * @param deviceName A device name the network is loaded to
+     * @param config A config the plugin compiles the network with: the one set for the device with Core::SetConfig
+     * overridden by the one passed to LoadNetwork
+     * @param pluginVersion A version of the plugin which compiles the network
+     * @return A hex string which can be used as a file name
+     */
+    static std::string computeHash(const ICNNNetwork& network, const std::string& deviceName,
+                                   const std::map<std::string, std::string>& config, const Version& pluginVersion);
+
+    /**
+     * @brief Returns a path to the cache entry for a given key
+     */
+    std::string getBlobPath(const std::string& hash) const;
+
+    /**
+     * @brief Checks whether an entry for a given key exists
+     */
+    bool contains(const std::string& hash) const;
+
+    /**
+     * @brief Returns a path to a temporary file to export a network into before it is committed with commit()
+     */
+    std::string getTempBlobPath(const std::string& hash) const;
+
+    /**
+     * @brief Atomically publishes a temporary file created with getTempBlobPath()
+     */
+    void commit(const std::string& tempPath, const std::string& hash) const;
+
+    /**
+     * @brief Removes a corrupted or outdated entry
+     */
+    void remove(const std::string& hash) const;
+
+private:
+    std::string _cacheDir;
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
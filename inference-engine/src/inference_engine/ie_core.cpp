@@ -5,23 +5,30 @@
 #include "ie_core.hpp"
 
 #include <unordered_set>
+#include <chrono>
+#include <cstdio>
 #include <fstream>
 #include <functional>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include <ngraph/opsets/opset.hpp>
+#include "cpp_interfaces/base/ie_executable_network_base.hpp"
 #include "cpp_interfaces/base/ie_plugin_base.hpp"
 #include "details/caseless.hpp"
 #include "details/ie_exception_conversion.hpp"
 #include "details/ie_so_pointer.hpp"
 #include "file_utils.h"
+#include "ie_auto_batching.hpp"
+#include "ie_binary_network.hpp"
 #include "ie_cnn_net_reader_impl.h"
+#include "ie_compiled_network_cache.hpp"
 #include "ie_icore.hpp"
 #include "ie_ir_reader.hpp"
 #include "ie_plugin.hpp"
@@ -29,6 +36,7 @@
 #include "ie_profiling.hpp"
 #include "ie_util_internal.hpp"
 #include "multi-device/multi_device_config.hpp"
+#include "system_allocator.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -122,6 +130,8 @@ class Core::Impl : public ICore {
     IE_SUPPRESS_DEPRECATED_START
     mutable std::map<std::string, InferencePlugin, details::CaselessLess<std::string>> plugins;
     IE_SUPPRESS_DEPRECATED_END
+    // guards the created plugins, so networks can be loaded to different devices from several threads
+    mutable std::recursive_mutex pluginsMutex;
 
     struct PluginDescriptor {
         FileUtils::FilePath libraryLocation;
@@ -134,6 +144,11 @@ class Core::Impl : public ICore {
     std::unordered_set<std::string> opsetNames;
     std::vector<IExtensionPtr> extensions;
 
+    std::string cacheDir;
+    // devices which failed to export a network, so there is no point to hash networks for them
+    std::unordered_set<std::string> devicesWithoutCache;
+    std::mutex cacheMutex;
+
 public:
     Impl();
     ~Impl() override;
@@ -233,6 +248,7 @@ public:
     InferencePlugin GetCPPPluginByName(const std::string& deviceName) const {
         IE_SUPPRESS_DEPRECATED_START
 
+        std::lock_guard<std::recursive_mutex> lock(pluginsMutex);
         auto it = pluginRegistry.find(deviceName);
         if (it == pluginRegistry.end()) {
             THROW_IE_EXCEPTION << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
@@ -292,6 +308,7 @@ public:
      * @param deviceName - a name of device
      */
     void UnregisterPluginByName(const std::string& deviceName) {
+        std::lock_guard<std::recursive_mutex> lock(pluginsMutex);
         auto it = plugins.find(deviceName);
         if (it == plugins.end()) {
             THROW_IE_EXCEPTION << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
@@ -383,6 +400,83 @@ public:
     const std::vector<IExtensionPtr>& getExtensions() {
         return extensions;
     }
+
+    void SetCacheDir(const std::string& dir) {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        cacheDir = dir;
+        devicesWithoutCache.clear();
+    }
+
+    IE_SUPPRESS_DEPRECATED_START
+
+    /**
+     * @brief Loads a network using the compiled networks cache if it is enabled
+     * @param network - a network to load
+     * @param deviceName - a name of device without device ID and HETERO / MULTI prefixes
+     * @param config - a config which is passed to the plugin
+     * @return An executable network
+     */
+    ExecutableNetwork LoadNetwork(const CNNNetwork& network, const std::string& deviceName,
+                                  const std::map<std::string, std::string>& config) {
+        auto plugin = GetCPPPluginByName(deviceName);
+
+        std::string cachePath;
+        bool useCache = false;
+        // the config set with SetConfig lives in the plugin, so the key takes it from the registry
+        std::map<std::string, std::string> deviceConfig;
+        {
+            std::lock_guard<std::recursive_mutex> lock(pluginsMutex);
+            auto it = pluginRegistry.find(deviceName);
+            if (it != pluginRegistry.end()) deviceConfig = it->second.defaultConfig;
+        }
+        for (auto&& item : config) {
+            deviceConfig[item.first] = item.second;
+        }
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            cachePath = cacheDir;
+            // HETERO and MULTI networks are built from the networks of other devices and cannot be imported here
+            useCache = !cachePath.empty() && deviceName != "HETERO" && deviceName != "MULTI" &&
+                       devicesWithoutCache.find(deviceName) == devicesWithoutCache.end();
+        }
+        if (!useCache) {
+            return plugin.LoadNetwork(network, config);
+        }
+
+        details::CompiledNetworkCache cache(cachePath);
+        std::string hash;
+        {
+            IE_PROFILING_AUTO_SCOPE(Core::LoadNetwork::computeHash)
+            hash = details::CompiledNetworkCache::computeHash(network, deviceName, deviceConfig, *plugin.GetVersion());
+        }
+
+        if (cache.contains(hash)) {
+            IE_PROFILING_AUTO_SCOPE(Core::LoadNetwork::importFromCache)
+            try {
+                return plugin.ImportNetwork(cache.getBlobPath(hash), config);
+            } catch (const details::InferenceEngineException&) {
+                // the entry is broken or produced by an incompatible plugin build, recompile it
+                cache.remove(hash);
+            }
+        }
+
+        auto executableNetwork = plugin.LoadNetwork(network, config);
+
+        IE_PROFILING_AUTO_SCOPE(Core::LoadNetwork::exportToCache)
+        auto tempPath = cache.getTempBlobPath(hash);
+        try {
+            executableNetwork.Export(tempPath);
+            cache.commit(tempPath, hash);
+        } catch (const details::InferenceEngineException&) {
+            std::remove(tempPath.c_str());
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            devicesWithoutCache.insert(deviceName);
+        }
+
+        return executableNetwork;
+    }
+
+    IE_SUPPRESS_DEPRECATED_END
 };
 
 Core::Impl::Impl() {
@@ -470,6 +564,10 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
 
 CNNNetwork Core::ReadNetwork(const std::string& modelPath, const std::string& binPath) const {
     IE_PROFILING_AUTO_SCOPE(Core::ReadNetwork)
+    // the binary network keeps the weights in the same file, so binPath is not used
+    if (details::IsBinaryNetwork(modelPath)) {
+        return CNNNetwork(std::shared_ptr<ICNNNetwork>(details::ReadBinaryNetwork(modelPath)));
+    }
     IE_SUPPRESS_DEPRECATED_START
     auto cnnReader = std::shared_ptr<ICNNNetReader>(CreateCNNNetReader());
     ResponseDesc desc;
@@ -532,9 +630,80 @@ ExecutableNetwork Core::LoadNetwork(CNNNetwork network, const std::string& devic
                                     const std::map<std::string, std::string>& config) {
     IE_PROFILING_AUTO_SCOPE(Core::LoadNetwork)
     auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-    IE_SUPPRESS_DEPRECATED_START
-    return _impl->GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
-    IE_SUPPRESS_DEPRECATED_END
+
+    // the automatic batching is done by Core, so its keys are not passed to plugins
+    auto parseValue = [&](const std::string& key, std::size_t defaultValue) {
+        auto it = parsed._config.find(key);
+        if (it == parsed._config.end()) {
+            return defaultValue;
+        }
+        std::size_t value = 0;
+        try {
+            value = std::stoul(it->second);
+        } catch (const std::exception&) {
+            THROW_IE_EXCEPTION << "Wrong value " << it->second << " for property key " << key;
+        }
+        parsed._config.erase(it);
+        return value;
+    };
+    const auto autoBatchSize = parseValue(CONFIG_KEY(AUTO_BATCH_SIZE), 1);
+    const auto autoBatchTimeout = parseValue(CONFIG_KEY(AUTO_BATCH_TIMEOUT), 1);
+    if (autoBatchSize <= 1) {
+        return _impl->LoadNetwork(network, parsed._deviceName, parsed._config);
+    }
+
+    // the requests are copied to and from the batched blobs by the offsets of their positions in the batch,
+    // so the batch should be the outer dimension of every input and every output
+    auto isBatchOuter = [](const TensorDesc& desc) {
+        const auto& order = desc.getBlockingDesc().getOrder();
+        return !desc.getDims().empty() && !order.empty() && order[0] == 0;
+    };
+
+    CNNNetwork originalNetwork(cloneNet(static_cast<const ICNNNetwork&>(network)));
+    ICNNNetwork::InputShapes batchedShapes;
+    for (auto&& input : originalNetwork.getInputsInfo()) {
+        const auto& desc = input.second->getTensorDesc();
+        if (!isBatchOuter(desc) || desc.getDims()[0] != 1) {
+            THROW_IE_EXCEPTION << "Automatic batching requires the outer batch of 1 for all network inputs, input '"
+                               << input.first << "' does not have it";
+        }
+        auto dims = desc.getDims();
+        dims[0] = autoBatchSize;
+        batchedShapes[input.first] = dims;
+    }
+
+    // the shapes are inferred, so an output which gathers the batch into another dimension
+    // (as the one of DetectionOutput) is detected
+    CNNNetwork batchedNetwork(cloneNet(static_cast<const ICNNNetwork&>(network)));
+    batchedNetwork.reshape(batchedShapes);
+    const auto batchedOutputs = batchedNetwork.getOutputsInfo();
+    for (auto&& output : originalNetwork.getOutputsInfo()) {
+        const auto& desc = output.second->getTensorDesc();
+        auto dims = desc.getDims();
+        bool batchable = isBatchOuter(desc) && dims[0] == 1;
+        if (batchable) {
+            dims[0] = autoBatchSize;
+            const auto itBatched = batchedOutputs.find(output.first);
+            batchable = itBatched != batchedOutputs.end() && itBatched->second->getTensorDesc().getDims() == dims;
+        }
+        if (!batchable) {
+            THROW_IE_EXCEPTION << "Automatic batching requires the outer batch for all network outputs, output '"
+                               << output.first << "' does not have it";
+        }
+    }
+
+    auto itDynBatch = parsed._config.find(CONFIG_KEY(DYN_BATCH_ENABLED));
+    const bool dynamicBatch = itDynBatch != parsed._config.end() && itDynBatch->second == CONFIG_VALUE(YES);
+
+    auto autoBatchNetwork = std::make_shared<details::AutoBatchExecutableNetwork>(
+        _impl->LoadNetwork(batchedNetwork, parsed._deviceName, parsed._config),
+        originalNetwork.getInputsInfo(), originalNetwork.getOutputsInfo(),
+        autoBatchSize, std::chrono::milliseconds(autoBatchTimeout), dynamicBatch);
+    IExecutableNetwork::Ptr executableNetwork(new ExecutableNetworkBase<ExecutableNetworkInternal>(autoBatchNetwork),
+                                              [](details::IRelease* p) {
+                                                  p->Release();
+                                              });
+    return ExecutableNetwork{executableNetwork};
 }
 
 void Core::AddExtension(const IExtensionPtr& extension) {
@@ -707,10 +876,48 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
         }
     }
 
+    // Core-level settings which are not passed to plugins
+    auto config_ = config;
+    {
+        auto it = config_.find(CONFIG_KEY(CACHE_DIR));
+        if (it != config_.end()) {
+            if (!deviceName.empty()) {
+                THROW_IE_EXCEPTION << "CACHE_DIR can be set only for the Core itself (without a device name)";
+            }
+            _impl->SetCacheDir(it->second);
+            config_.erase(it);
+        }
+        it = config_.find(CONFIG_KEY(BLOB_ALLOCATOR_POOL_SIZE));
+        if (it != config_.end()) {
+            if (!deviceName.empty()) {
+                THROW_IE_EXCEPTION << "BLOB_ALLOCATOR_POOL_SIZE can be set only for the Core itself (without a device name)";
+            }
+            size_t poolSize = 0;
+            try {
+                poolSize = std::stoull(it->second);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value " << it->second << " of BLOB_ALLOCATOR_POOL_SIZE, expected a number of bytes";
+            }
+            details::SetSystemAllocatorPoolSize(poolSize);
+            config_.erase(it);
+        }
+        it = config_.find(CONFIG_KEY(BLOB_ALLOCATOR_HUGE_PAGES));
+        if (it != config_.end()) {
+            if (!deviceName.empty()) {
+                THROW_IE_EXCEPTION << "BLOB_ALLOCATOR_HUGE_PAGES can be set only for the Core itself (without a device name)";
+            }
+            if (it->second != CONFIG_VALUE(YES) && it->second != CONFIG_VALUE(NO)) {
+                THROW_IE_EXCEPTION << "Wrong value " << it->second << " of BLOB_ALLOCATOR_HUGE_PAGES, expected YES or NO";
+            }
+            details::SetSystemAllocatorHugePages(it->second == CONFIG_VALUE(YES));
+            config_.erase(it);
+        }
+    }
+
     if (deviceName.empty()) {
-        _impl->SetConfigForPlugins(config, std::string());
+        _impl->SetConfigForPlugins(config_, std::string());
     } else {
-        auto parsed = parseDeviceNameIntoConfig(deviceName, config);
+        auto parsed = parseDeviceNameIntoConfig(deviceName, config_);
         _impl->SetConfigForPlugins(parsed._config, parsed._deviceName);
     }
 }
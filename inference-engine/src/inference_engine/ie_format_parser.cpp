@@ -126,6 +126,13 @@ InferenceEngine::CNNLayer::Ptr FormatParser::CreateLayer(pugi::xml_node& node,
     return genericCreator.CreateLayer(node, layerParsePrms);
 }
 
+InferenceEngine::CNNLayer::Ptr FormatParser::CreateLayer(LayerParseParameters& layerParsePrms) const {
+    if (equal(layerParsePrms.prms.type, "TensorIterator"))
+        THROW_IE_EXCEPTION << "Layer " << layerParsePrms.prms.name << " of type TensorIterator needs its body";
+    pugi::xml_node node;
+    return CreateLayer(node, layerParsePrms);
+}
+
 void FormatParser::SetLayerInput(CNNNetworkImpl& network, const std::string& dataId, CNNLayerPtr& targetLayer,
                                  int inputPort) {
     DataPtr& dataPtr = _portsToData[dataId];
@@ -197,6 +204,7 @@ FormatParser::FormatParser(size_t version): _version(version) {
                 std::make_shared<LayerCreator<SparseSegmentReduceLayer>>("SparseSegmentSqrtN"),
                 std::make_shared<LayerCreator<SparseSegmentReduceLayer>>("SparseSegmentSum"),
                 std::make_shared<LayerCreator<ExperimentalSparseWeightedReduceLayer>>("ExperimentalSparseWeightedSum"),
+                std::make_shared<LayerCreator<ExperimentalSparseWeightedReduceLayer>>("ExperimentalSparseWeightedMean"),
                 std::make_shared<LayerCreator<SparseToDenseLayer>>("SparseToDense"),
                 std::make_shared<LayerCreator<BucketizeLayer>>("Bucketize"),
                 std::make_shared<LayerCreator<ReverseSequenceLayer>>("ReverseSequence"),
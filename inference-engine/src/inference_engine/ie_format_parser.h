@@ -81,6 +81,11 @@ public:
 
     CNNNetworkImplPtr Parse(pugi::xml_node& root) override;
 
+    /**
+     * @brief Creates the layer of the type given by the parameters, as for the layer of the IR without the data node
+     */
+    CNNLayer::Ptr CreateLayer(LayerParseParameters& prms) const;
+
     Blob::Ptr GetBlobFromSegment(const TBlob<uint8_t>::Ptr& weights, const WeightSegment& weight_segment) const;
     void SetWeights(const TBlob<uint8_t>::Ptr& weights) override;
     void ParseDims(SizeVector& dims, const pugi::xml_node& node) const;
@@ -10,7 +10,9 @@
 #include <algorithm>
 #include <deque>
 #include <map>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <ngraph/axis_vector.hpp>
 #include <ngraph/coordinate_diff.hpp>
 #include <ngraph/descriptor/input.hpp>
@@ -135,6 +137,8 @@
 #include "details/ie_cnn_network_tools.h"
 #include "ie_format_parser.h"
 #include "ie_ngraph_utils.hpp"
+#include "ie_parallel.hpp"
+#include "ie_profiling.hpp"
 #include "ngraph_ops/generic_ie.hpp"
 #include "ngraph_ops/tensor_iterator.hpp"
 #include "precision_utils.h"
@@ -176,6 +180,33 @@ V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) {
     }
 }
 
+namespace {
+
+// Exceptions must not leave the body of a parallel region (it terminates the OpenMP runtime),
+// so the first one is stored and rethrown once all workers are done
+class ParallelExceptionHolder {
+public:
+    template <typename F>
+    void run(const F& func) noexcept {
+        try {
+            func();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!exception) exception = std::current_exception();
+        }
+    }
+
+    void rethrow() const {
+        if (exception) std::rethrow_exception(exception);
+    }
+
+private:
+    std::mutex mutex;
+    std::exception_ptr exception;
+};
+
+}  // namespace
+
 std::shared_ptr<ngraph::Function> V10Parser::parse(const pugi::xml_node& root, const Blob::CPtr& weights) {
     using node_params = struct {
         pugi::xml_node xml;
@@ -184,17 +215,35 @@ std::shared_ptr<ngraph::Function> V10Parser::parse(const pugi::xml_node& root, c
     std::map<size_t, node_params> params;
 
     std::vector<size_t> outputs;
-    std::unordered_set<std::string> opName;
 
     // Read all layers and store their parameters in params map
-    FOREACH_CHILD(node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
-        if (opName.find(node_param.name) != opName.end())
-            THROW_IE_EXCEPTION << "Invalid IR! " << node_param.name << " name is not unique!";
-        opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
-        if (node_param.type == "Result") {
-            outputs.push_back(node_param.layerId);
+    {
+        IE_PROFILING_AUTO_SCOPE(V10Parser::parseLayers)
+        std::vector<pugi::xml_node> layerNodes;
+        FOREACH_CHILD(node, root.child("layers"), "layer") {
+            layerNodes.push_back(node);
+        }
+
+        // Reading of the DOM is thread safe, so layer attributes and ports are parsed in parallel
+        std::vector<GenericLayerParams> layerParams(layerNodes.size());
+        ParallelExceptionHolder holder;
+        parallel_for(layerNodes.size(), [&](size_t i) {
+            holder.run([&] {
+                layerParams[i] = parseGenericParams(layerNodes[i]);
+            });
+        });
+        holder.rethrow();
+
+        std::unordered_set<std::string> opName;
+        for (size_t i = 0; i < layerNodes.size(); i++) {
+            auto& node_param = layerParams[i];
+            if (opName.find(node_param.name) != opName.end())
+                THROW_IE_EXCEPTION << "Invalid IR! " << node_param.name << " name is not unique!";
+            opName.insert(node_param.name);
+            if (node_param.type == "Result") {
+                outputs.push_back(node_param.layerId);
+            }
+            params[node_param.layerId] = {layerNodes[i], std::move(node_param)};
         }
     }
 
@@ -224,54 +273,88 @@ std::shared_ptr<ngraph::Function> V10Parser::parse(const pugi::xml_node& root, c
     };
     std::for_each(outputs.begin(), outputs.end(), dfs);
 
+    // Constants do not depend on other nodes and creation of ngraph::op::Constant copies the payload
+    // from the weights blob, which dominates for large models. They are created in parallel in advance.
+    // Other nodes attach themselves to outputs of their producers, which is not thread safe in nGraph.
+    {
+        IE_PROFILING_AUTO_SCOPE(V10Parser::createConstants)
+        std::vector<size_t> constIds;
+        for (auto& layer_id : order) {
+            const auto& p = params[layer_id].params;
+            if (p.version == "opset1" && p.type == "Const" && edges[layer_id].empty())
+                constIds.push_back(layer_id);
+        }
+
+        std::vector<std::shared_ptr<ngraph::Node>> constNodes(constIds.size());
+        ParallelExceptionHolder holder;
+        parallel_for(constIds.size(), [&](size_t i) {
+            holder.run([&] {
+                const auto& p = params.at(constIds[i]);
+                constNodes[i] = createNode({}, p.xml, weights, p.params);
+            });
+        });
+        holder.rethrow();
+
+        for (size_t i = 0; i < constIds.size(); i++) {
+            id_to_node[constIds[i]] = constNodes[i];
+        }
+    }
+
     ngraph::ParameterVector parameter_nodes;
     ngraph::ResultVector result_nodes;
     std::vector<std::shared_ptr<ngraph::Node>> allNodes;
 
     //  Following topological order create nGraph operations
-    for (auto& layer_id : order) {
-        auto& p = params[layer_id];
-        ngraph::OutputVector inputs(edges[layer_id].size());
-        for (auto& e : edges[layer_id]) {
-            auto input_node = id_to_node[e.fromLayerId];
-            if (!input_node) {
-                THROW_IE_EXCEPTION << "Attempt to access node " << e.fromLayerId << " that not in graph.";
+    {
+        IE_PROFILING_AUTO_SCOPE(V10Parser::createNodes)
+        for (auto& layer_id : order) {
+            auto& p = params[layer_id];
+            auto node = id_to_node[layer_id];
+            if (!node) {
+                ngraph::OutputVector inputs(edges[layer_id].size());
+                for (auto& e : edges[layer_id]) {
+                    auto input_node = id_to_node[e.fromLayerId];
+                    if (!input_node) {
+                        THROW_IE_EXCEPTION << "Attempt to access node " << e.fromLayerId << " that not in graph.";
+                    }
+                    auto& p_output = params[e.fromLayerId].params;
+                    if (p.params.getRealInputPortId(e.toPortId) >= inputs.size())
+                        THROW_IE_EXCEPTION << p.params.type << " layer " << p.params.name << " with id: " << p.params.layerId
+                            << " is inconsistent!";
+                    inputs[p.params.getRealInputPortId(e.toPortId)] =
+                        input_node->output(p_output.getRealOutputPortId(e.fromPortId));
+                }
+
+                node = createNode(inputs, p.xml, weights, p.params);
+                id_to_node[layer_id] = node;
             }
-            auto& p_output = params[e.fromLayerId].params;
-            if (p.params.getRealInputPortId(e.toPortId) >= inputs.size())
-                THROW_IE_EXCEPTION << p.params.type << " layer " << p.params.name << " with id: " << p.params.layerId
-                    << " is inconsistent!";
-            inputs[p.params.getRealInputPortId(e.toPortId)] =
-                input_node->output(p_output.getRealOutputPortId(e.fromPortId));
-        }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
-        id_to_node[layer_id] = node;
-
-        // Check that output shape after nGraph node validation the same as in IR
-        // because IR always right!
-        // Temporary disabled!
-        //        for (size_t i = 0; i < p.params.outputPorts.size(); ++i) {
-        //            if (p.params.outputPorts[i].dims != node->output(i).get_shape()) {
-        //                THROW_IE_EXCEPTION << "Shape after nGraph infer " <<
-        //                details::dumpVec(node->output(i).get_shape())
-        //                                   << " differ from IR shapes: " <<
-        //                                   details::dumpVec(p.params.outputPorts[i].dims);
-        //            }
-        //        }
-
-        if (auto parameter_node = std::dynamic_pointer_cast<ngraph::op::Parameter>(node)) {
-            parameter_nodes.emplace_back(parameter_node);
-        }
+            // Check that output shape after nGraph node validation the same as in IR
+            // because IR always right!
+            // Temporary disabled!
+            //        for (size_t i = 0; i < p.params.outputPorts.size(); ++i) {
+            //            if (p.params.outputPorts[i].dims != node->output(i).get_shape()) {
+            //                THROW_IE_EXCEPTION << "Shape after nGraph infer " <<
+            //                details::dumpVec(node->output(i).get_shape())
+            //                                   << " differ from IR shapes: " <<
+            //                                   details::dumpVec(p.params.outputPorts[i].dims);
+            //            }
+            //        }
+
+            if (auto parameter_node = std::dynamic_pointer_cast<ngraph::op::Parameter>(node)) {
+                parameter_nodes.emplace_back(parameter_node);
+            }
 
-        if (auto result_node = std::dynamic_pointer_cast<ngraph::op::Result>(node)) {
-            result_nodes.emplace_back(result_node);
+            if (auto result_node = std::dynamic_pointer_cast<ngraph::op::Result>(node)) {
+                result_nodes.emplace_back(result_node);
+            }
+            allNodes.emplace_back(node);
         }
-        allNodes.emplace_back(node);
     }
 
     ::ngraph::op::GenericIE::DisableReshape noReshape(allNodes);
 
+    IE_PROFILING_AUTO_SCOPE(V10Parser::createFunction)
     return std::make_shared<ngraph::Function>(result_nodes, parameter_nodes, GetStrAttr(root, "name", ""));
 }
 
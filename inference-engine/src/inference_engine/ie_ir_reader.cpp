@@ -14,6 +14,7 @@
 #include "description_buffer.hpp"
 #include "ie_ir_parser.hpp"
 #include "ie_ngraph_utils.hpp"
+#include "ie_profiling.hpp"
 
 using namespace InferenceEngine;
 
@@ -58,9 +59,12 @@ std::shared_ptr<ngraph::Function> IRReader::read(const std::string& modelPath, c
 
 std::shared_ptr<ngraph::Function> IRReader::read(const std::string& model, const Blob::CPtr& weights) {
     pugi::xml_document xmlDoc;
-    pugi::xml_parse_result res = xmlDoc.load_buffer(model.data(), model.length());
-    if (res.status != pugi::status_ok) {
-        THROW_IE_EXCEPTION << res.description() << "at offset " << res.offset;
+    {
+        IE_PROFILING_AUTO_SCOPE(IRReader::parseXml)
+        pugi::xml_parse_result res = xmlDoc.load_buffer(model.data(), model.length());
+        if (res.status != pugi::status_ok) {
+            THROW_IE_EXCEPTION << res.description() << "at offset " << res.offset;
+        }
     }
     return readXml(xmlDoc, weights);
 }
@@ -2119,6 +2119,19 @@ void CTCGreedyDecoderValidator::checkShapes(const CNNLayer* layer, const std::ve
 
 CTCGreedyDecoderValidator::CTCGreedyDecoderValidator(const std::string& _type): LayerValidator(_type) {}
 
+void CTCBeamSearchDecoderValidator::checkParams(const CNNLayer* layer) {
+    unsigned int beam_width = layer->GetParamAsUInt("beam_width", 10);
+    if (beam_width == 0) {
+        THROW_IE_EXCEPTION << "CTCBeamSearchDecoder layer parameter beam_width can't be equal to zero";
+    }
+}
+
+void CTCBeamSearchDecoderValidator::checkShapes(const CNNLayer* layer, const std::vector<SizeVector>& inShapes) const {
+    checkNumOfInput(inShapes, {1, 2});
+}
+
+CTCBeamSearchDecoderValidator::CTCBeamSearchDecoderValidator(const std::string& _type): LayerValidator(_type) {}
+
 void DetectionOutputValidator::parseParams(CNNLayer* layer) {
     unsigned int num_classes = layer->GetParamAsUInt("num_classes");
     if (num_classes == 0) {
@@ -3016,6 +3029,7 @@ LayerValidators::LayerValidators() {
     REG_LAYER_VALIDATOR_FOR_TYPE(ArgMaxValidator, ArgMax);
     REG_LAYER_VALIDATOR_FOR_TYPE(BatchNormalizationValidator, BatchNormalization);
     REG_LAYER_VALIDATOR_FOR_TYPE(CTCGreedyDecoderValidator, CTCGreedyDecoder);
+    REG_LAYER_VALIDATOR_FOR_TYPE(CTCBeamSearchDecoderValidator, CTCBeamSearchDecoder);
     REG_LAYER_VALIDATOR_FOR_TYPE(ClampValidator, Clamp);
     REG_LAYER_VALIDATOR_FOR_TYPE(ConcatValidator, Concat);
     REG_LAYER_VALIDATOR_FOR_TYPE(ConstValidator, Const);
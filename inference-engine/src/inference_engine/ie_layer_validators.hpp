@@ -609,6 +609,15 @@ public:
     void checkShapes(const CNNLayer* layer, const std::vector<SizeVector>& inShapes) const override;
 };
 
+class CTCBeamSearchDecoderValidator : public LayerValidator {
+public:
+    explicit CTCBeamSearchDecoderValidator(const std::string& _type);
+
+    void checkParams(const CNNLayer* layer) override;
+
+    void checkShapes(const CNNLayer* layer, const std::vector<SizeVector>& inShapes) const override;
+};
+
 class DetectionOutputValidator : public LayerValidator {
 public:
     explicit DetectionOutputValidator(const std::string& _type);
@@ -6,6 +6,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 
 using namespace InferenceEngine;
 
@@ -86,6 +87,16 @@ Port::Port(const Port& port) {
     data = port.data;
 }
 
+Port::Port(Port&& port) noexcept: parameters(std::move(port.parameters)), data(std::move(port.data)) {}
+
+Port& Port::operator=(const Port& port) = default;
+
+Port& Port::operator=(Port&& port) noexcept {
+    parameters = std::move(port.parameters);
+    data = std::move(port.data);
+    return *this;
+}
+
 bool Port::operator==(const Port& rhs) const {
     return parameters == rhs.parameters && data == rhs.data;
 }
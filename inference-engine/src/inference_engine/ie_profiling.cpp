@@ -0,0 +1,198 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_profiling.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+
+namespace {
+
+struct TraceEvent {
+    uint32_t nameId;
+    uint64_t begin;
+    uint64_t end;
+};
+
+/**
+ * @brief The latest events of a thread. Only the owner thread writes to the buffer, so the records are lock-free;
+ * the buffer is owned by the tracer to outlive the thread until the dump
+ */
+struct ThreadTraceBuffer {
+    explicit ThreadTraceBuffer(size_t capacity, size_t threadIndex): events(capacity), threadIndex(threadIndex) {}
+
+    std::vector<TraceEvent> events;
+    size_t count = 0;
+    const size_t threadIndex;
+};
+
+std::string escapeJson(const std::string& str) {
+    std::string escaped;
+    for (auto c : str) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            escaped += ' ';
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+class TraceWriter {
+public:
+    TraceWriter(): start(std::chrono::steady_clock::now()) {
+        const char* file = std::getenv("IE_TRACE_FILE");
+        if (file == nullptr || file[0] == '\0')
+            return;
+        path = file;
+
+        const char* size = std::getenv("IE_TRACE_BUFFER_SIZE");
+        if (size != nullptr) {
+            const long long parsed = std::atoll(size);
+            if (parsed > 0)
+                bufferSize = static_cast<size_t>(parsed);
+        }
+        enabled = true;
+    }
+
+    ~TraceWriter() {
+        if (!enabled)
+            return;
+        enabled = false;
+        dump();
+    }
+
+    uint32_t registerName(const std::string& name) {
+        if (!enabled)
+            return 0;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = nameIds.find(name);
+        if (it != nameIds.end())
+            return it->second;
+        names.push_back(name);
+        const auto id = static_cast<uint32_t>(names.size());
+        nameIds[name] = id;
+        return id;
+    }
+
+    uint64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void record(uint32_t nameId, uint64_t begin, uint64_t end) {
+        if (!enabled)
+            return;
+        static thread_local ThreadTraceBuffer* buffer = nullptr;
+        if (buffer == nullptr) {
+            std::lock_guard<std::mutex> lock(mutex);
+            buffers.emplace_back(new ThreadTraceBuffer(bufferSize, buffers.size()));
+            buffer = buffers.back().get();
+        }
+        buffer->events[buffer->count % buffer->events.size()] = {nameId, begin, end};
+        buffer->count++;
+    }
+
+private:
+    void dump() {
+        std::ofstream file(path);
+        if (!file.is_open()) {
+            std::cerr << "Cannot open the trace file " << path << std::endl;
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        file << "{\"traceEvents\":[";
+        bool first = true;
+        for (auto& buffer : buffers) {
+            const size_t capacity = buffer->events.size();
+            const size_t recorded = std::min(buffer->count, capacity);
+            for (size_t i = buffer->count - recorded; i < buffer->count; i++) {
+                const auto& event = buffer->events[i % capacity];
+                file << (first ? "\n" : ",\n") << std::fixed << std::setprecision(3)
+                     << "{\"name\":\"" << escapeJson(names[event.nameId - 1]) << "\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+                     << buffer->threadIndex << ",\"ts\":" << event.begin / 1000.0
+                     << ",\"dur\":" << (event.end - event.begin) / 1000.0 << "}";
+                first = false;
+            }
+        }
+        file << "\n]}\n";
+    }
+
+    std::atomic<bool> enabled {false};
+    std::string path;
+    size_t bufferSize = 65536;
+    const std::chrono::steady_clock::time_point start;
+
+    std::mutex mutex;
+    std::vector<std::string> names;
+    std::unordered_map<std::string, uint32_t> nameIds;
+    std::vector<std::unique_ptr<ThreadTraceBuffer>> buffers;
+};
+
+TraceWriter& traceWriter() {
+    static TraceWriter writer;
+    return writer;
+}
+
+thread_local LoadProfile* currentLoadProfile = nullptr;
+
+}  // namespace
+
+uint32_t Tracer::registerName(const std::string& name) {
+    return traceWriter().registerName(name);
+}
+
+uint64_t Tracer::now() {
+    return traceWriter().now();
+}
+
+void Tracer::record(uint32_t nameId, uint64_t begin, uint64_t end) {
+    traceWriter().record(nameId, begin, end);
+}
+
+LoadProfile::Bind::Bind(LoadProfile* profile): previous(currentLoadProfile) {
+    currentLoadProfile = profile;
+}
+
+LoadProfile::Bind::~Bind() {
+    currentLoadProfile = previous;
+}
+
+LoadProfile* LoadProfile::current() {
+    return currentLoadProfile;
+}
+
+void LoadProfile::add(const std::string& phase, float milliseconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = std::find_if(phases.begin(), phases.end(), [&](const Phase& p) { return p.name == phase; });
+    if (found == phases.end()) {
+        phases.push_back({phase, {}});
+        found = phases.end() - 1;
+    }
+    found->threadDurations[std::this_thread::get_id()] += milliseconds;
+}
+
+std::vector<std::pair<std::string, float>> LoadProfile::get() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::pair<std::string, float>> result;
+    for (auto&& phase : phases) {
+        float longest = 0.0f;
+        for (auto&& duration : phase.threadDurations)
+            longest = std::max(longest, duration.second);
+        result.emplace_back(phase.name, longest);
+    }
+    return result;
+}
+
+}  // namespace InferenceEngine
@@ -11,14 +11,20 @@
 #include <cfloat>
 #include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <deque>
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+
+#include "ie_api.h"
 
 #ifdef ENABLE_PROFILING_ITT
 #include <ittnotify.h>
@@ -130,6 +136,140 @@ inline static void annotateEnd(IttTaskHandles& h, IttBlock&) {
 #define IE_ITT_SCOPE(task_name)
 #endif
 
+/**
+ * @brief Built-in tracer of the profiling scopes which works without ITT and VTune.
+ *
+ * The tracer is enabled per process by the IE_TRACE_FILE environment variable set to a path of the trace file.
+ * The scopes are recorded to per-thread ring buffers of IE_TRACE_BUFFER_SIZE (65536 by default) latest events
+ * and dumped as Chrome trace JSON at the process exit. A disabled tracer costs a check of an integer per scope.
+ */
+class INFERENCE_ENGINE_API_CLASS(Tracer) {
+public:
+    /**
+     * @brief Registers a name of scopes
+     * @param name A name of the scope
+     * @return An identifier of the name to record the scopes with, 0 if the tracer is disabled
+     */
+    static uint32_t registerName(const std::string& name);
+
+    /**
+     * @brief Returns a timestamp of the tracer clock
+     * @return Nanoseconds since the start of the tracer
+     */
+    static uint64_t now();
+
+    /**
+     * @brief Records a scope to the ring buffer of the calling thread
+     * @param nameId An identifier returned by registerName
+     * @param begin A timestamp of the scope begin
+     * @param end A timestamp of the scope end
+     */
+    static void record(uint32_t nameId, uint64_t begin, uint64_t end);
+};
+
+struct TraceName {
+    const uint32_t id;
+
+    explicit TraceName(const char* name): id {Tracer::registerName(name)} {}
+};
+
+struct TraceBlock {
+    uint64_t begin;
+};
+
+inline static void annotateBegin(TraceName& n, TraceBlock& b) {
+    if (n.id != 0) b.begin = Tracer::now();
+}
+
+inline static void annotateEnd(TraceName& n, TraceBlock& b) {
+    if (n.id != 0) Tracer::record(n.id, b.begin, Tracer::now());
+}
+
+#define IE_TRACE_SCOPE(task_name)                                                                             \
+    IE_ANNOTATE_MAKE_SCOPE(InferenceEngineTrace, ::InferenceEngine::TraceName, ::InferenceEngine::TraceBlock, \
+                           (task_name), ())
+
+/**
+ * @brief Durations of the phases of a network loading, reported by the LOAD_NETWORK_PROFILE metric of executable networks.
+ *
+ * A profile is bound to the threads which load the network, then every profiling scope run by these threads adds its
+ * duration to the phase of the scope name. The phases nest as the scopes do. A phase run by several threads, e.g. the
+ * graph compilation of every stream, reports the longest of the per-thread durations.
+ */
+class INFERENCE_ENGINE_API_CLASS(LoadProfile) {
+public:
+    using Ptr = std::shared_ptr<LoadProfile>;
+
+    /**
+     * @brief Binds a profile to the calling thread for the lifetime of the object, the previous binding is restored
+     */
+    class INFERENCE_ENGINE_API_CLASS(Bind) {
+    public:
+        explicit Bind(LoadProfile* profile);
+        ~Bind();
+
+    private:
+        LoadProfile* previous;
+    };
+
+    /**
+     * @brief Returns the profile bound to the calling thread
+     * @return A pointer to the profile, nullptr if no profile is bound
+     */
+    static LoadProfile* current();
+
+    /**
+     * @brief Adds a duration to the phase of the calling thread
+     * @param phase A name of the phase
+     * @param milliseconds A duration
+     */
+    void add(const std::string& phase, float milliseconds);
+
+    /**
+     * @brief Returns the phases in the order they are started first
+     * @return Pairs of a phase name and its duration in milliseconds
+     */
+    std::vector<std::pair<std::string, float>> get() const;
+
+private:
+    struct Phase {
+        std::string name;
+        std::unordered_map<std::thread::id, float> threadDurations;
+    };
+
+    mutable std::mutex mutex;
+    std::vector<Phase> phases;
+};
+
+struct LoadPhaseName {
+    const char* name;
+
+    explicit LoadPhaseName(const char* name): name {name} {}
+};
+
+struct LoadPhaseBlock {
+    LoadProfile* profile;
+    std::chrono::steady_clock::time_point begin;
+};
+
+inline static void annotateBegin(LoadPhaseName& n, LoadPhaseBlock& b) {
+    b.profile = LoadProfile::current();
+    if (b.profile != nullptr) {
+        // keeps the phases in the order they are started, the nested ones are completed first
+        b.profile->add(n.name, 0.0f);
+        b.begin = std::chrono::steady_clock::now();
+    }
+}
+
+inline static void annotateEnd(LoadPhaseName& n, LoadPhaseBlock& b) {
+    if (b.profile != nullptr)
+        b.profile->add(n.name, std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - b.begin).count());
+}
+
+#define IE_LOAD_PHASE_SCOPE(task_name)                                                 \
+    IE_ANNOTATE_MAKE_SCOPE(InferenceEngineLoadPhase, ::InferenceEngine::LoadPhaseName, \
+                           ::InferenceEngine::LoadPhaseBlock, (task_name), ())
+
 class TimeResultsMap {
 protected:
     std::unordered_map<std::string, std::deque<double>> m_map;
@@ -194,12 +334,15 @@ inline static void annotateEnd(TimeResultsMap& m, TimeSampler& t) {
 #define IE_STR(x) IE_STR_(x)
 #define IE_STR_(x) #x
 
-#define IE_PROFILING_AUTO_SCOPE(NAME) \
-    IE_ITT_SCOPE(IE_STR(NAME));       \
+#define IE_PROFILING_AUTO_SCOPE(NAME)  \
+    IE_ITT_SCOPE(IE_STR(NAME));        \
+    IE_TRACE_SCOPE(IE_STR(NAME));      \
+    IE_LOAD_PHASE_SCOPE(IE_STR(NAME)); \
     IE_TIMER_SCOPE(IE_STR(NAME))
 
 struct ProfilingTask {
     std::string name;
+    uint32_t traceId = 0;
 
 #ifdef ENABLE_PROFILING_ITT
     __itt_domain* domain;
@@ -210,7 +353,7 @@ struct ProfilingTask {
     ProfilingTask(const ProfilingTask&) = default;
 
     inline explicit ProfilingTask(const std::string& task_name)
-        : name(task_name)
+        : name(task_name), traceId(Tracer::registerName(task_name))
 #ifdef ENABLE_PROFILING_ITT
           ,
           domain(__itt_domain_create("InferenceEngine")),
@@ -250,8 +393,28 @@ inline static void annotateEnd(IttStatic&, IttProfilingTask& t) {
 #define IE_ITT_TASK_SCOPE(profiling_task)
 #endif
 
+struct TraceStatic {};
+
+struct TraceProfilingTask {
+    ProfilingTask& t;
+    uint64_t begin;
+};
+
+inline static void annotateBegin(TraceStatic&, TraceProfilingTask& t) {
+    if (t.t.traceId != 0) t.begin = Tracer::now();
+}
+
+inline static void annotateEnd(TraceStatic&, TraceProfilingTask& t) {
+    if (t.t.traceId != 0) Tracer::record(t.t.traceId, t.begin, Tracer::now());
+}
+
+#define IE_TRACE_TASK_SCOPE(profilingTask)                                                  \
+    IE_ANNOTATE_MAKE_SCOPE(InferenceEngineTraceScopeTask, ::InferenceEngine::TraceStatic, \
+                           ::InferenceEngine::TraceProfilingTask, (), (profilingTask))
+
 #define IE_PROFILING_AUTO_SCOPE_TASK(PROFILING_TASK) \
     IE_ITT_TASK_SCOPE(PROFILING_TASK);               \
+    IE_TRACE_TASK_SCOPE(PROFILING_TASK);             \
     IE_TIMER_SCOPE(PROFILING_TASK.name)
 
 inline static void annotateSetThreadName(const char* name) {
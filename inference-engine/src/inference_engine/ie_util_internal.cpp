@@ -16,6 +16,7 @@
 #include <utility>
 #include <vector>
 
+#include "blob_factory.hpp"
 #include "cpp/ie_plugin_cpp.hpp"
 #include "details/caseless.hpp"
 #include "details/ie_cnn_network_tools.h"
@@ -23,6 +24,7 @@
 #include "file_utils.h"
 #include "graph_tools.hpp"
 #include "ie_icnn_network_stats.hpp"
+#include "ie_memcpy.h"
 #include "net_pass.h"
 #include "precision_utils.h"
 
@@ -147,6 +149,37 @@ CNNLayerPtr clonelayer(const CNNLayer& source) {
     return nullptr;  // Silence "control may reach end of non-void function" warning
 }
 
+Blob::Ptr getWritableBlob(CNNLayer& layer, const std::string& name) {
+    auto it = layer.blobs.find(name);
+    if (it == layer.blobs.end()) THROW_IE_EXCEPTION << "Layer " << layer.name << " does not have the blob " << name;
+    const Blob::Ptr shared = it->second;
+    if (!shared) THROW_IE_EXCEPTION << "Blob " << name << " of the layer " << layer.name << " is empty";
+
+    auto weightable = dynamic_cast<WeightableLayer*>(&layer);
+    // the references held by the layer itself and the local one do not make the blob shared
+    long ownReferences = 1;
+    for (const auto& blob : layer.blobs) {
+        if (blob.second == shared) ownReferences++;
+    }
+    if (weightable != nullptr) {
+        if (weightable->_weights == shared) ownReferences++;
+        if (weightable->_biases == shared) ownReferences++;
+    }
+    if (shared.use_count() <= ownReferences) return shared;
+
+    Blob::Ptr copy = make_blob_with_precision(shared->getTensorDesc());
+    copy->allocate();
+    ie_memcpy(copy->buffer(), copy->byteSize(), shared->cbuffer(), shared->byteSize());
+    for (auto& blob : layer.blobs) {
+        if (blob.second == shared) blob.second = copy;
+    }
+    if (weightable != nullptr) {
+        if (weightable->_weights == shared) weightable->_weights = copy;
+        if (weightable->_biases == shared) weightable->_biases = copy;
+    }
+    return copy;
+}
+
 details::CNNNetworkImplPtr cloneNet(const ICNNNetwork& network) {
     std::vector<CNNLayerPtr> layers;
     details::CNNNetworkIterator i(const_cast<ICNNNetwork*>(&network));
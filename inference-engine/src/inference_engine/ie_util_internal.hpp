@@ -84,11 +84,23 @@ cloneNet(const std::vector<InferenceEngine::CNNLayerPtr>& layers, const ICNNNetw
 /**
  * Clones the whole network. All layers and data objects will be cloned
  *
- * Blobs inside layers are reused
+ * Blobs inside layers are reused, the transformations write them through getWritableBlob
  * */
 INFERENCE_ENGINE_API_CPP(InferenceEngine::details::CNNNetworkImplPtr)
 cloneNet(const InferenceEngine::ICNNNetwork& network);
 
+/**
+ * @brief Gets the blob of the layer to write it in place. The blobs are shared by the layers cloned with clonelayer
+ * and cloneNet, so the blob referenced out of the layer is copied first and the copy replaces it in the blobs of the
+ * layer, and in the weights and biases of the weightable layer.
+ *
+ * @param layer - layer owning the blob
+ * @param name - name of the blob in the blobs of the layer
+ *
+ * @return The blob no other layer refers to
+ */
+INFERENCE_ENGINE_API_CPP(Blob::Ptr) getWritableBlob(CNNLayer& layer, const std::string& name);
+
 using ordered_properties = std::vector<std::pair<std::string, std::string>>;
 using printer_callback =
     std::function<void(const InferenceEngine::CNNLayerPtr, ordered_properties&, ordered_properties&)>;
@@ -89,6 +89,7 @@ void ConcatTransformation::transform(TransformationContext& context, CNNLayer& c
     }
 
     if (concat.GetParamAsUInt("axis", 1) != 1) {
+        context.skipLayer(concat, "concatenation by other than channels axis is not supported");
         return;
     }
 
@@ -125,6 +126,7 @@ void ConcatTransformation::transform(TransformationContext& context, CNNLayer& c
             concat.name,
             sideOutputLayers,
             childrenNameSideOutputLayers)) {
+            context.skipLayer(concat, "input " + std::to_string(index) + " is not quantized by FakeQuantize");
             return;
         }
     }
@@ -140,14 +142,22 @@ void ConcatTransformation::transform(TransformationContext& context, CNNLayer& c
         if (quantizationLevels == 0lu) {
             quantizationLevels = quantizationDetails.levels;
         } else if (quantizationLevels != quantizationDetails.levels) {
-            THROW_IE_EXCEPTION << "different quantization levels " << quantizationLevels << " are not supported";
+            context.skipLayer(concat, "different quantization levels " + std::to_string(quantizationLevels) + " and " +
+                std::to_string(quantizationDetails.levels) + " of " + quantizeLayers[i]->name);
+            return;
         }
 
         quantizationLayersDetails.push_back(quantizationDetails);
     }
 
+    if (quantizationLayersDetails.size() != quantizeLayers.size()) {
+        context.skipLayer(concat, "not all inputs are quantized with a supported number of levels");
+        return;
+    }
+
     const DataPrecision dataPrecision = getDataPrecision(*quantizeLayers[0], QuantizationDetails::getDetails(*quantizeLayers[0]), false, false);
     if (dataPrecision.precision == Precision::UNSPECIFIED) {
+        context.skipLayer(concat, "precision of " + quantizeLayers[0]->name + " is not supported");
         return;
     }
 
@@ -161,7 +171,14 @@ void ConcatTransformation::transform(TransformationContext& context, CNNLayer& c
     std::vector<std::vector<float>> dequantizationShiftsLayers;
     dequantizationShiftsLayers.resize(parentsCount);
 
-    if ((quantizationLayersDetails[0].inputHighValues.size() == 1)) {
+    const bool perTensor = std::all_of(
+        quantizationLayersDetails.begin(),
+        quantizationLayersDetails.end(),
+        [](const QuantizationDetails& quantizationDetails) {
+            return (quantizationDetails.outputLowValues.size() == 1) && (quantizationDetails.outputHighValues.size() == 1);
+        });
+
+    if (perTensor) {
         float outputLowValue = quantizationLayersDetails[0].outputLowValues[0];
         float outputHighValue = quantizationLayersDetails[0].outputHighValues[0];
         for (size_t index = 0lu; index < parentsCount; index++) {
@@ -174,10 +191,13 @@ void ConcatTransformation::transform(TransformationContext& context, CNNLayer& c
         }
 
         const float maxOutputInterval = outputHighValue - outputLowValue;
-        if (quantizedTensorAlignmentOnActivations == QuantizedTensorAlignment::UpdateLevel) {
+        QuantizedTensorAlignment quantizedTensorAlignment = quantizedTensorAlignmentOnActivations;
+        if (quantizedTensorAlignment == QuantizedTensorAlignment::UpdateLevel) {
             const size_t minLevels = getMinQuantizationLevels(dataPrecision, maxOutputInterval, quantizationLayersDetails, outputLowValue);
             if (minLevels < this->minQuantizationLevels) {
-                return;
+                // the branch intervals are too different to share the output levels: requantize every branch
+                // to the common interval instead, the updated FakeQuantize is fused into the producer output scales
+                quantizedTensorAlignment = QuantizedTensorAlignment::UpdateIntervals;
             }
         }
 
@@ -190,7 +210,7 @@ void ConcatTransformation::transform(TransformationContext& context, CNNLayer& c
             const QuantizationDetails quantizationDetails = quantizationLayersDetails[index];
 
             // TODO: copy/paste, refactor: extract to MultiBranchTransformation::updateQuantizationRange
-            switch (quantizedTensorAlignmentOnActivations) {
+            switch (quantizedTensorAlignment) {
             case QuantizedTensorAlignment::None: {
                 const float quantizationScale = (dataPrecision.max - dataPrecision.min) / maxOutputInterval;
 
@@ -206,14 +226,17 @@ void ConcatTransformation::transform(TransformationContext& context, CNNLayer& c
                 break;
             }
             case QuantizedTensorAlignment::UpdateIntervals: {
-                const float inputLowValue = quantizationDetails.outputLowValues[0] != 0.0
-                                                ? (quantizationDetails.inputLowValues[0] *
-                                                   (outputLowValue / quantizationDetails.outputLowValues[0]))
-                                                : outputLowValue;
-                const float inputHighValue = quantizationDetails.outputHighValues[0] != 0.0
-                                                 ? (quantizationDetails.inputHighValues[0] *
-                                                    (outputHighValue / quantizationDetails.outputHighValues[0]))
-                                                 : outputHighValue;
+                // input values which the original linear mapping of the layer maps to the common output interval
+                const float inputInterval = quantizationDetails.inputHighValues[0] - quantizationDetails.inputLowValues[0];
+                const float outputInterval = quantizationDetails.outputHighValues[0] - quantizationDetails.outputLowValues[0];
+                if (outputInterval == 0.f) {
+                    THROW_IE_EXCEPTION << "output interval of layer " << fakeQuantizeLayer.name << " is empty";
+                }
+
+                const float inputLowValue = quantizationDetails.inputLowValues[0] +
+                    (outputLowValue - quantizationDetails.outputLowValues[0]) * inputInterval / outputInterval;
+                const float inputHighValue = quantizationDetails.inputLowValues[0] +
+                    (outputHighValue - quantizationDetails.outputLowValues[0]) * inputInterval / outputInterval;
 
                 CNNNetworkHelper::updateBlobs(fakeQuantizeLayer, 1, inputLowValue);
                 CNNNetworkHelper::updateBlobs(fakeQuantizeLayer, 2, inputHighValue);
@@ -242,7 +265,7 @@ void ConcatTransformation::transform(TransformationContext& context, CNNLayer& c
                 break;
             }
             default: {
-                THROW_IE_EXCEPTION << "unexpected value " << quantizedTensorAlignmentOnActivations;
+                THROW_IE_EXCEPTION << "unexpected value " << quantizedTensorAlignment;
             }
             }
 
@@ -263,6 +286,7 @@ void ConcatTransformation::transform(TransformationContext& context, CNNLayer& c
             dequantizationShifts[channel] = outputLowValue;
         }
     } else {
+        context.skipLayer(concat, "per-channel quantization intervals are not supported");
         return;
     }
 
@@ -159,6 +159,7 @@ void ConcatMultiChannelsTransformation::transform(TransformationContext& context
     }
 
     if (concat.GetParamAsUInt("axis", 1) != 1) {
+        context.skipLayer(concat, "concatenation by other than channels axis is not supported");
         return;
     }
 
@@ -190,6 +191,7 @@ void ConcatMultiChannelsTransformation::transform(TransformationContext& context
             concat.name,
             sideOutputLayers,
             childrenNameSideOutputLayers)) {
+            context.skipLayer(concat, "input " + std::to_string(index) + " is not quantized by FakeQuantize");
             return;
         }
     }
@@ -208,9 +210,22 @@ void ConcatMultiChannelsTransformation::transform(TransformationContext& context
     std::vector<std::pair<CNNLayerPtr, std::vector<CNNLayerPtr>>> fakeQuantizeForConcatLayers;
     const DataPrecision dataPrecision = getDataPrecision(*quantizeLayers[0], QuantizationDetails::getDetails(*quantizeLayers[0]), false, false);
     if (dataPrecision.precision == Precision::UNSPECIFIED) {
+        context.skipLayer(concat, "precision of " + quantizeLayers[0]->name + " is not supported");
         return;
     }
 
+    // the layers are updated concat by concat below, so all parents are checked before
+    for (const CNNLayerPtr concatLayer : concatLayers) {
+        const std::vector<CNNLayerPtr> parents =
+            CNNNetworkHelper::getParentsRecursivelyExceptTypes(*concatLayer, {"Pooling"});
+        for (const CNNLayerPtr parent : parents) {
+            if ((parent->type != "FakeQuantize") && (parent->type != "Concat")) {
+                context.skipLayer(concat, "parent " + parent->name + " of type " + parent->type + " is not supported");
+                return;
+            }
+        }
+    }
+
     std::vector<float> finalDequantizationScales;
     std::vector<float> finalDequantizationShifts;
     const auto parentsCount = quantizeLayers.size();
@@ -223,12 +238,6 @@ void ConcatMultiChannelsTransformation::transform(TransformationContext& context
 
         const std::vector<CNNLayerPtr> parents =
             CNNNetworkHelper::getParentsRecursivelyExceptTypes(*concatLayer, {"Pooling"});
-        for (const CNNLayerPtr parent : parents) {
-            if ((parent->type != "FakeQuantize") && (parent->type != "Concat")) {
-                // TODO: handle
-                THROW_IE_EXCEPTION << "layer type '" << parent->type << "' not supported";
-            }
-        }
 
         for (const CNNLayerPtr fakeQuantizeLayer : parents) {
             if (fakeQuantizeLayer->type != "FakeQuantize") {
@@ -25,6 +25,37 @@
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+
+// channels are in the last dimension for both 2D and 3D (MatMul-like) inputs and outputs
+size_t getChannelsCount(const Data& data) {
+    const Layout layout = data.getLayout();
+    if ((layout != Layout::NC) && (layout != Layout::CHW)) {
+        THROW_IE_EXCEPTION << "Unexpected layout " << layout;
+    }
+    return data.getDims().back();
+}
+
+// FullyConnected and GEMM with transposed second input keep weights as [output channels, input channels],
+// GEMM without transposition keeps them as [input channels, output channels]
+size_t getWeightsOffset(const CNNLayer& layer, const size_t outputChannel, const size_t inputChannel,
+                        const size_t outputChannelsCount, const size_t inputChannelsCount) {
+    const GemmLayer* gemm = dynamic_cast<const GemmLayer*>(&layer);
+    return ((gemm == nullptr) || gemm->transpose_b) ?
+        outputChannel * inputChannelsCount + inputChannel :
+        inputChannel * outputChannelsCount + outputChannel;
+}
+
+bool isUniform(const std::vector<float>& values) {
+    return std::all_of(values.begin(), values.end(), [&](const float value) { return value == values[0]; });
+}
+
+bool isZero(const std::vector<float>& values) {
+    return std::all_of(values.begin(), values.end(), [](const float value) { return value == 0.f; });
+}
+
+}  // namespace
+
 void FullyConnectedTransformation::transform(TransformationContext& context, CNNLayer& fullyConnected) const {
     if (!WeightableLayerTransformation::canBeTransformed(context, fullyConnected)) {
         return;
@@ -45,6 +76,12 @@ void FullyConnectedTransformation::transform(TransformationContext& context, CNN
         return;
     }
 
+    const GemmLayer* gemm = dynamic_cast<const GemmLayer*>(&fullyConnected);
+    if ((gemm != nullptr) && (gemm->transpose_a || (fullyConnected.insData.size() < 2) ||
+                              (fullyConnected.insData[1].lock()->getDims().size() != 2))) {
+        return;
+    }
+
     const CNNLayerPtr parentOnWeights = CNNNetworkHelper::getParent(fullyConnected, 1);
     const QuantizationDetails originalQuantizationDetails = parentOnWeights != nullptr ?
         QuantizationDetails::getDetails(*parentOnWeights) :
@@ -77,10 +114,20 @@ void FullyConnectedTransformation::transform(TransformationContext& context, CNN
         }
     }
 
+    // ScaleShift works along the second dimension, which is not the channels one for 3D tensors, so only
+    // per-tensor dequantization can be moved through the layer
+    const bool is3D = fullyConnected.insData[0].lock()->getDims().size() == 3ul;
+    if (is3D && (!isUniform(originalDataDequantizationScales) || !isZero(originalDataDequantizationShifts) ||
+                 !isUniform(originalWeightsDequantizationScales) || !isZero(originalWeightsDequantizationShifts))) {
+        return;
+    }
+
     std::vector<float> dequantizationScales;
     std::vector<float> dequantizationShifts;
     std::vector<float> biasesShifts;
-    if (supportAsymmetricQuantization) {
+    // zero points on activations are folded into the output dequantization shifts below, the integer data
+    // is subtracted explicitly only together with the zero points on weights
+    if (supportAsymmetricQuantization && !isZero(originalWeightsDequantizationShifts)) {
         std::vector<float> dataShifts(originalDataDequantizationShifts.size());
         for (size_t i = 0; i < dataShifts.size(); ++i) {
             dataShifts[i] = -originalDataDequantizationShifts[i] / originalDataDequantizationScales[i];
@@ -102,6 +149,10 @@ void FullyConnectedTransformation::transform(TransformationContext& context, CNN
             dequantizationScales,
             dequantizationShifts);
 
+        if (is3D && !isUniform(dequantizationShifts)) {
+            return;
+        }
+
         biasesShifts.resize(dequantizationShifts.size());
 
         Precision weightsOriginalPrecision;
@@ -143,6 +194,10 @@ void FullyConnectedTransformation::transform(TransformationContext& context, CNN
             dequantizationScales,
             dequantizationShifts,
             biasesShifts);
+
+        if (is3D && !isUniform(dequantizationShifts)) {
+            return;
+        }
     }
 
     if (this->updateBiases) {
@@ -189,6 +244,11 @@ void FullyConnectedTransformation::transform(TransformationContext& context, CNN
 
     const std::vector<CNNLayerPtr> children = CNNNetworkHelper::getChildren(fullyConnected);
     const size_t outputChannelsCount = CNNNetworkHelper::getOutputChannelsCount(fullyConnected);
+    if (is3D) {
+        // dequantization is uniform here, the values are broadcasted along the ScaleShift channels
+        dequantizationScales.assign(outputChannelsCount, dequantizationScales[0]);
+        dequantizationShifts.assign(outputChannelsCount, dequantizationShifts[0]);
+    }
     if (children.size() == 0) {
         const std::string originalName = fullyConnected.name;
         CNNNetworkHelper::renameLayer(
@@ -232,17 +292,10 @@ void FullyConnectedTransformation::calculateDequantizationForSymmetric(
     if (inputData == nullptr) {
         THROW_IE_EXCEPTION << "input data is absent for layer " << fullyConnected.name;
     }
-    const Layout inputLayout = inputData->getLayout();
-    if (inputLayout != Layout::NC) {
-        THROW_IE_EXCEPTION << "Unexpected input layout " << inputLayout;
-    }
-    const size_t inputChannelsCount = fullyConnected.insData[0].lock()->getDims()[1];
-
-    const Layout outputLayout = fullyConnected.outData[0]->getLayout();
-    if (outputLayout != Layout::NC) {
-        THROW_IE_EXCEPTION << "Unexpected output layout " << outputLayout;
-    }
-    const size_t outputChannelsCount = fullyConnected.outData[0]->getDims()[1];
+    const size_t inputChannelsCount = getChannelsCount(*inputData);
+    const size_t outputChannelsCount = getChannelsCount(*fullyConnected.outData[0]);
+    // data dequantization of 3D inputs is per-tensor
+    const bool is3D = inputData->getDims().size() == 3ul;
     dequantizationScales.resize(outputChannelsCount);
     dequantizationShifts.resize(outputChannelsCount);
     biasesShifts.resize(outputChannelsCount);
@@ -277,8 +330,9 @@ void FullyConnectedTransformation::calculateDequantizationForSymmetric(
             (originalWeightsDequantizationScales.size() == 1 ? originalWeightsDequantizationScales[0] : originalWeightsDequantizationScales[channel]);
 
         for (size_t inputChannel = 0; inputChannel < inputChannelsCount; ++inputChannel) {
-            const float w = weightsBuffer.get()[channel * inputChannelsCount + inputChannel];
-            sum += w * prevDequantizationShiftBuffer.get()[inputChannel] * weightsDequantizationScale;
+            const float w = weightsBuffer.get()[
+                getWeightsOffset(fullyConnected, channel, inputChannel, outputChannelsCount, inputChannelsCount)];
+            sum += w * prevDequantizationShiftBuffer.get()[is3D ? 0 : inputChannel] * weightsDequantizationScale;
         }
 
         dequantizationShifts[channel] = biasesBuffer == nullptr ?
@@ -298,17 +352,10 @@ void FullyConnectedTransformation::calculateDequantizationForAsymmetric(
     if (inputData == nullptr) {
         THROW_IE_EXCEPTION << "input data is absent for layer " << fullyConnected.name;
     }
-    const Layout inputLayout = inputData->getLayout();
-    if (inputLayout != Layout::NC) {
-        THROW_IE_EXCEPTION << "Unexpected input layout " << inputLayout;
-    }
-    const size_t inputChannelsCount = fullyConnected.insData[0].lock()->getDims()[1];
-
-    const Layout outputLayout = fullyConnected.outData[0]->getLayout();
-    if (outputLayout != Layout::NC) {
-        THROW_IE_EXCEPTION << "Unexpected output layout " << outputLayout;
-    }
-    const size_t outputChannelsCount = fullyConnected.outData[0]->getDims()[1];
+    const size_t inputChannelsCount = getChannelsCount(*inputData);
+    const size_t outputChannelsCount = getChannelsCount(*fullyConnected.outData[0]);
+    // data dequantization of 3D inputs is per-tensor
+    const bool is3D = inputData->getDims().size() == 3ul;
     dequantizationScales.resize(outputChannelsCount);
     dequantizationShifts.resize(outputChannelsCount);
 
@@ -346,15 +393,16 @@ void FullyConnectedTransformation::calculateDequantizationForAsymmetric(
                                                                    : originalWeightsDequantizationScales[channel]);
 
         for (size_t w = 0; w < inputChannelsCount; ++w) {
-            const float kernel = weightsBuffer.get()[channel * inputChannelsCount + w];
-            sum1 += kernel * prevDequantizationShiftBuffer.get()[channel] * weightsDequantizationScale;
-            sum2 += kernel * dataZeroPoints[w] * weightsDequantizationScale;
+            const float kernel = weightsBuffer.get()[
+                getWeightsOffset(fullyConnected, channel, w, outputChannelsCount, inputChannelsCount)];
+            sum1 += kernel * prevDequantizationShiftBuffer.get()[is3D ? 0 : channel] * weightsDequantizationScale;
+            sum2 += kernel * dataZeroPoints[is3D ? 0 : w] * weightsDequantizationScale;
         }
 
         dequantizationShifts[channel] = biasesBuffer == nullptr
                                             ? sum1
                                             : (sum1 + biasesBuffer.get()[channel] -
-                                               prevDequantizationScaleBuffer.get()[channel] *
+                                               prevDequantizationScaleBuffer.get()[is3D ? 0 : channel] *
                                                    biasesBuffer.get()[channel] * weightsDequantizationScale);
     }
 }
@@ -587,7 +587,9 @@ std::shared_ptr<float> CNNNetworkHelper::convertFloatData(const float* srcData,
 }
 
 void CNNNetworkHelper::fillBlobByFP32(const CNNLayerPtr& layer, const std::string& blobName, const float* srcData) {
-    Blob::Ptr blob = getBlob(layer, blobName);
+    getBlob(layer, blobName);
+    // the blob may be shared with the network the layer was cloned from
+    Blob::Ptr blob = getWritableBlob(*layer, blobName.empty() ? layer->blobs.begin()->first : blobName);
     return fillBlobByFP32(blob, srcData);
 }
 
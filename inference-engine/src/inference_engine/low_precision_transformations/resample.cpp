@@ -0,0 +1,54 @@
+﻿// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision_transformations/resample.hpp"
+#include "low_precision_transformations/network_helper.hpp"
+
+#include <algorithm>
+#include <details/caseless.hpp>
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+void ResampleTransformation::transform(TransformationContext& context, CNNLayer& layer) const {
+    if (!canBeTransformed(context, layer)) {
+        return;
+    }
+
+    if (layer.insData.size() != 1) {
+        THROW_IE_EXCEPTION << "layer inputs '" << layer.insData.size() << "' is not correct";
+    }
+
+    if (!CaselessEq<std::string>()(layer.type, "Resample") && !CaselessEq<std::string>()(layer.type, "Interp")) {
+        THROW_IE_EXCEPTION << "layer '" << layer.name << "' is not correct";
+    }
+
+    if (!isPrecisionPreserved(layer)) {
+        return;
+    }
+
+    const CNNLayerPtr scaleShift = CNNNetworkHelper::getParent(layer, 0);
+    if ((scaleShift == nullptr) || (scaleShift->type != "ScaleShift")) {
+        return;
+    }
+
+    const Precision precision = getPrecisionBeforeParentDequantizationScaleShift(layer);
+    if (std::find(precisionsOnActivations.begin(), precisionsOnActivations.end(), precision) == precisionsOnActivations.end()) {
+        return;
+    }
+
+    TransparentBaseTransformation::transform(context, layer);
+}
+
+bool ResampleTransformation::isPrecisionPreserved(const CNNLayer& layer) const noexcept {
+    if (CaselessEq<std::string>()(layer.type, "Interp")) {
+        // padded values are not the dequantized zeros
+        return (layer.GetParamAsInt("pad_beg", 0) == 0) && (layer.GetParamAsInt("pad_end", 0) == 0);
+    }
+
+    const std::string type = layer.GetParamAsString("type", "");
+    return (type == "caffe.ResampleParameter.NEAREST") || (type == "caffe.ResampleParameter.LINEAR");
+}
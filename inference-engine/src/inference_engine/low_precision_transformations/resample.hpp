@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <ie_layers.h>
+#include "low_precision_transformations/transformation_context.hpp"
+#include "low_precision_transformations/layer_transformation.hpp"
+#include "low_precision_transformations/transparent_base_transformation.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Moves dequantization through nearest and linear Resample and Interp layers: the output values are
+ * convex combinations of the input ones, so the layers stay in the low precision
+ */
+class INFERENCE_ENGINE_API_CLASS(ResampleTransformation) : public TransparentBaseTransformation {
+public:
+    ResampleTransformation(const Params& params) : TransparentBaseTransformation(params) {}
+    ~ResampleTransformation() override {}
+    void transform(TransformationContext& context, CNNLayer& layer) const override;
+    bool isPrecisionPreserved(const CNNLayer& layer) const noexcept override;
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
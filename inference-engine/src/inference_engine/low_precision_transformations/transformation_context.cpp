@@ -26,3 +26,7 @@ void TransformationContext::removeLayer(const CNNLayer& layer) {
         }
     }
 }
+
+void TransformationContext::skipLayer(const CNNLayer& layer, const std::string& reason) {
+    skippedLayers[layer.name] = reason;
+}
@@ -25,6 +25,10 @@ public:
     ICNNNetwork& network;
     std::unordered_set<std::string> quantizedFakeQuantizeNames;
     std::unordered_set<std::string> dequantizationLayersNames;
+    // layers the low precision propagation stopped at, with the reason
+    std::unordered_map<std::string, std::string> skippedLayers;
+
+    void skipLayer(const CNNLayer& layer, const std::string& reason);
 
     const std::vector<CNNLayerPtr>& getLayers() {
         return layers;
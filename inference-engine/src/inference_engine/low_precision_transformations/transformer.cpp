@@ -250,6 +250,8 @@ void LowPrecisionTransformer::rename(ICNNNetwork& network) const {
 }
 
 void LowPrecisionTransformer::transform(ICNNNetwork& network) {
+    skippedLayers.clear();
+
     auto it = details::CNNNetworkIterator(&network);
     auto end = details::CNNNetworkIterator();
     bool fqFound = false;
@@ -354,6 +356,17 @@ void LowPrecisionTransformer::transform(ICNNNetwork& network) {
             it->second->transform(context, *layer);
         }
     }
+
+    skippedLayers.insert(context.skippedLayers.begin(), context.skippedLayers.end());
+#ifdef DISPLAY_PECISION
+    for (const auto& skippedLayer : skippedLayers) {
+        std::cout << "Low precision propagation stopped at " << skippedLayer.first << ": " << skippedLayer.second << std::endl;
+    }
+#endif
+}
+
+const std::map<std::string, std::string>& LowPrecisionTransformer::getSkippedLayers() const noexcept {
+    return skippedLayers;
 }
 
 std::vector<Precision> LowPrecisionTransformer::getPrecisionsOnActivations(const std::string& layerType) const noexcept {
@@ -92,6 +92,12 @@ public:
     void transform(ICNNNetwork& network);
     void rename(ICNNNetwork& network) const;
 
+    /**
+     * @brief Returns the layers of the last transformed network where the low precision propagation
+     * stopped, mapped to the reason
+     */
+    const std::map<std::string, std::string>& getSkippedLayers() const noexcept;
+
     // IParamsManager interface implementation
     std::vector<Precision> getPrecisionsOnActivations(const std::string& layerName) const noexcept override;
 
@@ -102,6 +108,7 @@ public:
 private:
     static void renameLayersByType(const std::vector<CNNLayerPtr>& layers, const std::string& type);
     LowPrecisionTransformations transformations;
+    std::map<std::string, std::string> skippedLayers;
 };
 
 }  // namespace details
@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_allocator.hpp"
+
+#include <string>
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+# include "details/os/os_filesystem.hpp"
+#elif defined(__unix__) || defined(__APPLE__)
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+# define IE_HAS_MMAP
+#endif
+
+namespace InferenceEngine {
+namespace details {
+
+MmapAllocator::MmapAllocator(const std::string& path): _path(path) {}
+
+MmapAllocator::~MmapAllocator() {
+    free(_addr);
+}
+
+bool MmapAllocator::isSupported() noexcept {
+#if defined(_WIN32) || defined(IE_HAS_MMAP)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void* MmapAllocator::alloc(size_t size) noexcept {
+    if (_addr != nullptr || size == 0)
+        return nullptr;
+
+#if defined(_WIN32)
+# if defined(ENABLE_UNICODE_PATH_SUPPORT)
+    std::wstring fileName = multiByteCharToWString(_path.c_str());
+    HANDLE file = CreateFileW(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+# else
+    HANDLE file = CreateFileA(_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+# endif
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || static_cast<unsigned long long>(fileSize.QuadPart) < size) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    void* addr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+    if (addr == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    _file = file;
+    _mapping = mapping;
+    _addr = addr;
+    _size = size;
+    return _addr;
+#elif defined(IE_HAS_MMAP)
+    int fd = open(_path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return nullptr;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < size) {
+        close(fd);
+        return nullptr;
+    }
+
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+    if (addr == MAP_FAILED)
+        return nullptr;
+
+    _addr = addr;
+    _size = size;
+    return _addr;
+#else
+    return nullptr;
+#endif
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr || handle != _addr)
+        return false;
+
+#if defined(_WIN32)
+    UnmapViewOfFile(_addr);
+    CloseHandle(_mapping);
+    CloseHandle(_file);
+    _mapping = nullptr;
+    _file = nullptr;
+#elif defined(IE_HAS_MMAP)
+    munmap(_addr, _size);
+#endif
+    _addr = nullptr;
+    _size = 0;
+    return true;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
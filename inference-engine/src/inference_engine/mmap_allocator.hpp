@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Allocator which backs a blob with a read-only file mapping
+ * @file mmap_allocator.hpp
+ */
+#pragma once
+
+#include <string>
+
+#include "ie_allocator.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Maps a file into memory instead of allocating heap storage.
+ *
+ * The mapping is read-only: pages are shared with the page cache and between processes which map the same
+ * file, and writing into them faults, so consumers which change the data copy it first. alloc() maps the first
+ * `size` bytes of the file and returns nullptr if the file cannot be mapped, so callers can fall back to a
+ * regular read.
+ * Only one live mapping per allocator instance is supported.
+ */
+class MmapAllocator : public IAllocator {
+public:
+    explicit MmapAllocator(const std::string& path);
+    ~MmapAllocator() override;
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void* a) noexcept override {}
+
+    void* alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+    /**
+     * @brief Checks whether memory mapping of files is supported on the current platform
+     */
+    static bool isSupported() noexcept;
+
+private:
+    std::string _path;
+    void* _addr = nullptr;
+    size_t _size = 0;
+#ifdef _WIN32
+    void* _file = nullptr;
+    void* _mapping = nullptr;
+#endif
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
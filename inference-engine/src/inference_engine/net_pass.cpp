@@ -5,6 +5,7 @@
 #include "net_pass.h"
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -14,6 +15,7 @@
 #include <utility>
 
 #include "blob_factory.hpp"
+#include "cnn_network_impl.hpp"
 #include "details/ie_cnn_network_tools.h"
 #include "graph_tools.hpp"
 #include "ie_layers_internal.hpp"
@@ -341,14 +343,31 @@ bool convertToRNNSeq(CNNLayerPtr cur, const N& net) {
 
     auto all_body_layers = TIBodySortTopologically(ti->body);
 
+    // IR v10 bodies have Squeeze/Unsqueeze with constant axes instead of Reshape
+    std::vector<CNNLayerPtr> body_layers;
+    for (auto& layer : all_body_layers)
+        if (layer->type != "Const") body_layers.push_back(layer);
+
+    auto is_reshape = [](const CNNLayerPtr& layer) {
+        return one_of(layer->type, "Reshape", "Squeeze", "Unsqueeze");
+    };
+
     // Check if body is:  squeeze -> lstm_cell -> unsqueeze
-    if (all_body_layers.size() != 3 || all_body_layers[0]->type != "Reshape" ||
-        !one_of(all_body_layers[1]->type, "GRUCell", "RNNCell", "LSTMCell") || all_body_layers[2]->type != "Reshape")
+    if (body_layers.size() != 3 || !is_reshape(body_layers[0]) ||
+        !one_of(body_layers[1]->type, "GRUCell", "RNNCell", "LSTMCell") || !is_reshape(body_layers[2]))
         return false;
 
-    auto rsp1 = std::dynamic_pointer_cast<ReshapeLayer>(all_body_layers[0]);
-    auto cell = std::dynamic_pointer_cast<RNNCellBase>(all_body_layers[1]);
-    auto rsp2 = std::dynamic_pointer_cast<ReshapeLayer>(all_body_layers[2]);
+    auto rsp1 = body_layers[0];
+    auto cell = std::dynamic_pointer_cast<RNNCellBase>(body_layers[1]);
+    auto rsp2 = body_layers[2];
+
+    // constants may only define target shapes of the squeezes
+    for (auto& layer : all_body_layers) {
+        if (layer->type != "Const") continue;
+        for (auto& out : layer->outData)
+            for (auto& consumer : out->getInputTo())
+                if (consumer.second != rsp1 && consumer.second != rsp2) return false;
+    }
 
     IE_ASSERT(rsp1);
     IE_ASSERT(cell);
@@ -404,6 +423,17 @@ bool convertToRNNSeq(CNNLayerPtr cur, const N& net) {
     // supported only firs and second dim for LSTM-Sequence
     if (!one_of(in_iter_rule.axis, 0, 1)) return false;
 
+    // squeezes should only remove and restore the iteration axis
+    auto is_squeeze_of = [](const DataPtr& full, const DataPtr& part, int axis) {
+        auto dims = full->getDims();
+        if (dims.size() <= static_cast<size_t>(axis) || dims[axis] != 1) return false;
+        dims.erase(dims.begin() + axis);
+        return dims == part->getDims();
+    };
+    if (!is_squeeze_of(rsp1->insData[0].lock(), rsp1->outData[0], in_iter_rule.axis) ||
+        !is_squeeze_of(rsp2->outData[0], rsp2->insData[0].lock(), out_iter_rule.axis))
+        return false;
+
     bool no_init_state = i2map.size() == 1;
     bool no_last_state = o2map.size() == 1;
 
@@ -577,6 +607,171 @@ bool unrollTI(CNNLayerPtr cur, ICNNNetwork& net) {
     return true;
 }
 
+/**
+ * Repeat the body of TI k times. TI keeps the ports and every iteration covers k slices
+ * of the iterated tensors, so the number of iterations is k times less.
+ *
+ * @return false if the body cannot be repeated, TI is not changed in such case
+ */
+static bool partialUnrollTI(TensorIterator& ti, int k) {
+    std::set<int> sliced_inputs;
+    for (const auto& rule : ti.input_port_map)
+        if (rule.axis != -1) sliced_inputs.insert(rule.to);
+
+    std::map<int, int> back_edge_from;
+    for (const auto& rule : ti.back_edges) {
+        // the slice of the next iteration cannot come from the body
+        if (sliced_inputs.count(rule.to)) return false;
+        back_edge_from[rule.to] = rule.from;
+    }
+
+    const auto& body = ti.body;
+    int num_inputs = static_cast<int>(body.inputs.size());
+    if (num_inputs != 0 && body.inputs.back()->getPrecision() == Precision::UNSPECIFIED &&
+        body.inputs.back()->getDims().empty())
+        num_inputs--;  // const holder is merged separately
+
+    std::vector<TensorIterator::Body> body_list(k);
+    for (int j = 0; j < k; j++) body_list[j] = CopyTIBody(body, ":" + std::to_string(j));
+
+    TensorIterator::Body res;
+
+    /** Not iterated inputs go to all copies, back edges connect the neighbour copies */
+    for (int i = 0; i < num_inputs; i++) {
+        res.inputs.push_back(body_list[0].inputs[i]);
+        if (sliced_inputs.count(i)) continue;
+
+        auto back_edge = back_edge_from.find(i);
+        for (int j = 1; j < k; j++) {
+            if (back_edge != back_edge_from.end())
+                CombineData(body_list[j - 1].outputs[back_edge->second], body_list[j].inputs[i]);
+            else
+                CombineData(body_list[0].inputs[i], body_list[j].inputs[i]);
+        }
+    }
+
+    /** Iterated inputs are split between the copies */
+    for (auto& rule : ti.input_port_map) {
+        if (rule.axis == -1) continue;
+
+        const auto& part_desc = body_list[0].inputs[rule.to]->getTensorDesc();
+        auto dims = part_desc.getDims();
+        dims[rule.axis] *= k;
+        DataPtr chunk(new Data(body.inputs[rule.to]->getName(),
+                               TensorDesc {part_desc.getPrecision(), dims, part_desc.getLayout()}));
+
+        std::string name = ti.name + ":in_split_" + std::to_string(rule.to);
+        auto split = std::make_shared<SplitLayer>(LayerParams {name, "Split", ti.precision});
+        split->_axis = rule.axis;
+        split->outData.resize(k);
+        split->insData.emplace_back(chunk);
+        chunk->getInputTo()[split->name] = split;
+
+        for (int j = 0; j < k; j++) {
+            auto body_idx = rule.stride > 0 ? j : k - 1 - j;
+            auto& part = body_list[body_idx].inputs[rule.to];
+            part->getCreatorLayer() = split;
+            split->outData[j] = part;
+        }
+        res.inputs[rule.to] = chunk;
+        rule.stride *= k;
+    }
+
+    DataPtr holder;
+    for (auto& copy : body_list) {
+        if (copy.inputs.size() == static_cast<size_t>(num_inputs)) continue;
+        if (holder)
+            CombineData(holder, copy.inputs.back());
+        else
+            holder = copy.inputs.back();
+    }
+    if (holder) res.inputs.push_back(holder);
+
+    /** Iterated outputs are concatenated from the copies, other ones are taken from the last copy */
+    res.outputs = body_list[k - 1].outputs;
+
+    std::set<int> sliced_outputs;
+    for (auto& rule : ti.output_port_map) {
+        if (rule.axis == -1) continue;
+        rule.stride *= k;
+        if (!sliced_outputs.insert(rule.to).second) continue;
+
+        const auto& part_desc = body_list[0].outputs[rule.to]->getTensorDesc();
+        auto dims = part_desc.getDims();
+        dims[rule.axis] *= k;
+        DataPtr chunk(new Data(body.outputs[rule.to]->getName(),
+                               TensorDesc {part_desc.getPrecision(), dims, part_desc.getLayout()}));
+
+        std::string name = ti.name + ":out_concat_" + std::to_string(rule.to);
+        auto concat = std::make_shared<ConcatLayer>(LayerParams {name, "Concat", ti.precision});
+        concat->_axis = rule.axis;
+        concat->insData.resize(k);
+        concat->outData.emplace_back(chunk);
+        chunk->getCreatorLayer() = concat;
+
+        for (int j = 0; j < k; j++) {
+            auto body_idx = rule.stride > 0 ? j : k - 1 - j;
+            auto& part = body_list[body_idx].outputs[rule.to];
+            part->getInputTo()[concat->name] = concat;
+            concat->insData[j] = part;
+        }
+        res.outputs[rule.to] = chunk;
+    }
+
+    // the concatenated outputs may also be read on the last iteration
+    std::map<int, int> last_outputs;
+    auto last_output = [&](int port) {
+        if (!sliced_outputs.count(port)) return port;
+        auto found = last_outputs.find(port);
+        if (found == last_outputs.end()) {
+            res.outputs.push_back(body_list[k - 1].outputs[port]);
+            found = last_outputs.emplace(port, static_cast<int>(res.outputs.size()) - 1).first;
+        }
+        return found->second;
+    };
+    for (auto& rule : ti.output_port_map)
+        if (rule.axis == -1) rule.to = last_output(rule.to);
+    for (auto& rule : ti.back_edges) rule.from = last_output(rule.from);
+
+    ti.body = res;
+    return true;
+}
+
+static size_t countBodyLayers(const TensorIterator::Body& body) {
+    size_t count = 0;
+    for (const auto& layer : TIBodySortTopologically(body))
+        if (layer->type != "Const") count++;
+    return count;
+}
+
+static bool unrollTIAdaptive(CNNLayerPtr cur, ICNNNetwork& net, size_t maxUnrolledLayers) {
+    if (cur->type != "TensorIterator") return true;
+
+    auto ti = std::dynamic_pointer_cast<TensorIterator>(cur);
+    IE_ASSERT(ti) << "Cannot cast object with type TensorIterator to TensorIterator object";
+
+    int num = getNumIteration(*ti);  // -1 means inconsistent TI
+    if (num == -1) return false;
+
+    const size_t body_size = std::max<size_t>(countBodyLayers(ti->body), 1);
+
+    // the complete unrolling splits the whole iterated tensors
+    bool full_ranged = true;
+    for (const auto& rule : ti->input_port_map)
+        if (rule.axis != -1) full_ranged &= is_full_ranged(rule, ti->insData[rule.from].lock());
+    for (const auto& rule : ti->output_port_map)
+        if (rule.axis != -1) full_ranged &= is_full_ranged(rule, ti->outData[rule.from]);
+
+    if (full_ranged && num * body_size <= maxUnrolledLayers) return unrollTI(cur, net);
+
+    int k = static_cast<int>(std::min<size_t>(num, maxUnrolledLayers / body_size));
+    while (k > 1 && num % k != 0) k--;
+
+    // TI stays as is if the body cannot be repeated
+    if (k > 1) partialUnrollTI(*ti, k);
+    return true;
+}
+
 /************************************************************/
 /****  Builder helpers   ************************************/
 /************************************************************/
@@ -1251,6 +1446,14 @@ bool UnrollTI(ICNNNetwork& net) {
     return res;
 }
 
+bool UnrollTI(ICNNNetwork& net, size_t maxUnrolledLayers) {
+    auto res = ApplyForAll(net, [maxUnrolledLayers](CNNLayerPtr cur, ICNNNetwork& net) {
+        return unrollTIAdaptive(cur, net, maxUnrolledLayers);
+    });
+    restore_net_consistency(net);
+    return res;
+}
+
 template <typename NET>
 bool UnrollRNN_if_impl(NET& net, const std::function<bool(const RNNCellBase&)> pred) {
     // Filter layers by RNN specific type
@@ -1438,5 +1641,58 @@ void ConvertPrecision(ICNNNetwork& net, Precision from, Precision to) {
     }
 }
 
+void PruneOutputs(ICNNNetwork& net, const std::set<std::string>& outputs) {
+    auto impl = dynamic_cast<details::CNNNetworkImpl*>(&net);
+    if (impl == nullptr) THROW_IE_EXCEPTION << "The outputs can be pruned only in CNNNetworkImpl";
+
+    OutputsDataMap networkOutputs;
+    net.getOutputsInfo(networkOutputs);
+    for (const auto& name : outputs) {
+        if (networkOutputs.find(name) == networkOutputs.end())
+            THROW_IE_EXCEPTION << "The network " << impl->getName() << " has no output " << name;
+    }
+
+    auto all_layers = TopolSort(net);
+    std::vector<CNNLayerPtr> to_visit;
+    for (const auto& output : networkOutputs) {
+        if (outputs.find(output.first) != outputs.end()) to_visit.push_back(output.second->getCreatorLayer().lock());
+    }
+    InputsDataMap networkInputs;
+    net.getInputsInfo(networkInputs);
+    for (const auto& input : networkInputs) to_visit.push_back(input.second->getInputData()->getCreatorLayer().lock());
+    for (const auto& layer : all_layers) {
+        if (layer->outData.empty()) to_visit.push_back(layer);
+    }
+
+    std::unordered_set<CNNLayer*> alive;
+    while (!to_visit.empty()) {
+        auto layer = to_visit.back();
+        to_visit.pop_back();
+        if (!layer || !alive.insert(layer.get()).second) continue;
+        for (const auto& in : layer->insData) {
+            auto data = in.lock();
+            if (data) to_visit.push_back(data->getCreatorLayer().lock());
+        }
+    }
+
+    for (const auto& output : networkOutputs) {
+        if (outputs.find(output.first) != outputs.end()) continue;
+        impl->removeOutput(output.first);
+        // the data of an output stays in the network while its creator is kept
+        auto creator = output.second->getCreatorLayer().lock();
+        if (creator && alive.find(creator.get()) != alive.end()) impl->addData(output.first.c_str(), output.second);
+    }
+
+    for (const auto& layer : all_layers) {
+        if (alive.find(layer.get()) != alive.end()) continue;
+        for (const auto& in : layer->insData) {
+            auto data = in.lock();
+            if (data) data->getInputTo().erase(layer->name);
+        }
+        for (const auto& out : layer->outData) impl->removeData(out->getName());
+        impl->removeLayer(layer->name);
+    }
+}
+
 }  // namespace NetPass
 }  // namespace InferenceEngine
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -69,6 +70,21 @@ TensorIterator::Body CopyTIBody(const TensorIterator::Body& body, std::string su
  */
 INFERENCE_ENGINE_API_CPP(bool) UnrollTI(ICNNNetwork& net);
 
+/**
+ * Unroll Tensor Iterators by the factor picked from their trip count and body size
+ *
+ * A Tensor Iterator which gives no more than maxUnrolledLayers layers being unrolled completely
+ * is replaced by its unrolled body as UnrollTI does. Other ones stay loops with the body repeated
+ * k times, k is the largest divisor of the trip count keeping the repeated body within
+ * maxUnrolledLayers, so every iteration covers k slices of the iterated tensors. The iterators
+ * which body can't be repeated even twice stay as is. The Const layers are not counted.
+ *
+ * @param net network to modify
+ * @param maxUnrolledLayers the largest number of layers to produce from the body of one iterator
+ * @return true if all Tensor iterators was processed successfully
+ */
+INFERENCE_ENGINE_API_CPP(bool) UnrollTI(ICNNNetwork& net, size_t maxUnrolledLayers);
+
 /**
  * Unroll all RNN specific layers by predicate
  *
@@ -97,5 +113,17 @@ INFERENCE_ENGINE_API_CPP(bool) UnrollRNN_if(TensorIterator::Body& net, std::func
  */
 INFERENCE_ENGINE_API_CPP(void) ConvertPrecision(ICNNNetwork& net, Precision from, Precision to);
 
+/**
+ * Output pruning pass
+ *
+ * Removes the outputs which are not in the given set and the layers which compute only them. The layers
+ * computing the kept outputs, the layers without outputs (as the memory writers) and the input layers stay.
+ * The outputs of the kept layers which lose all their consumers stay unconnected.
+ *
+ * @param net is network to prune, it should be CNNNetworkImpl
+ * @param outputs names of the outputs to keep, every name should be an output of the network
+ */
+INFERENCE_ENGINE_API_CPP(void) PruneOutputs(ICNNNetwork& net, const std::set<std::string>& outputs);
+
 }  // namespace NetPass
 }  // namespace InferenceEngine
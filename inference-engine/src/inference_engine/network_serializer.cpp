@@ -4,7 +4,9 @@
 
 #include "network_serializer.h"
 
+#include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <map>
 #include <queue>
 #include <deque>
@@ -15,6 +17,7 @@
 #include "details/caseless.hpp"
 #include "details/ie_cnn_network_tools.h"
 #include "exec_graph_info.hpp"
+#include "ie_binary_network.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine;
@@ -116,6 +119,45 @@ void updateStatisticsInfo(const InferenceEngine::ICNNNetwork& network, pugi::xml
     }
 }
 
+class TopologyWriter {
+public:
+    template <typename T>
+    void write(const T& value) {
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void writeString(const std::string& str) {
+        write(static_cast<uint32_t>(str.size()));
+        buffer.append(str);
+    }
+
+    void writePrecision(const Precision& precision) {
+        write(static_cast<int32_t>(static_cast<Precision::ePrecision>(precision)));
+    }
+
+    void writeDesc(const TensorDesc& desc) {
+        writePrecision(desc.getPrecision());
+        write(static_cast<int32_t>(desc.getLayout()));
+        write(static_cast<uint32_t>(desc.getDims().size()));
+        for (auto dim : desc.getDims()) write(static_cast<uint64_t>(dim));
+    }
+
+    std::string buffer;
+};
+
+uint64_t alignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+void writePadding(std::ostream& stream, uint64_t size) {
+    static const char zeros[BinaryNetworkHeader::sectionAlignment] = {};
+    while (size > 0) {
+        auto chunk = std::min<uint64_t>(size, sizeof(zeros));
+        stream.write(zeros, chunk);
+        size -= chunk;
+    }
+}
+
 }  //  namespace
 
 std::vector<CNNLayerPtr> NetworkSerializer::CNNNetSortTopologically(const ICNNNetwork& network) {
@@ -384,6 +426,15 @@ void NetworkSerializer::serialize(const std::string& xmlPath, const std::string&
         }
     }
 
+    const std::string extension = binaryNetworkExtension;
+    if (xmlPath.size() >= extension.size() &&
+        CaselessEq<std::string>()(xmlPath.substr(xmlPath.size() - extension.size()), extension)) {
+        if (execGraphInfoSerialization)
+            THROW_IE_EXCEPTION << "Executable graph info cannot be serialized to the binary network";
+        serializeBinary(xmlPath, network);
+        return;
+    }
+
     bool dumpWeights = !execGraphInfoSerialization & !binPath.empty();
 
     pugi::xml_document doc;
@@ -407,6 +458,145 @@ void NetworkSerializer::serialize(const std::string& xmlPath, const std::string&
     }
 }
 
+void NetworkSerializer::serializeBinary(const std::string& path, const InferenceEngine::ICNNNetwork& network) {
+    const std::vector<CNNLayerPtr> ordered = NetworkSerializer::CNNNetSortTopologically(network);
+
+    std::map<const Data*, uint32_t> dataIndex;
+    std::vector<DataPtr> datas;
+    auto indexOf = [&](const DataPtr& data) {
+        auto it = dataIndex.find(data.get());
+        if (it != dataIndex.end()) return it->second;
+        datas.push_back(data);
+        return dataIndex[data.get()] = static_cast<uint32_t>(datas.size() - 1);
+    };
+    for (const auto& node : ordered) {
+        if (CaselessEq<std::string>()(node->type, "TensorIterator"))
+            THROW_IE_EXCEPTION << "Layer " << node->name << " of type TensorIterator cannot be serialized "
+                               << "to the binary network";
+        for (const auto& input : node->insData) {
+            auto data = input.lock();
+            if (!data) THROW_IE_EXCEPTION << "insData for " << node->name << " is not valid.";
+            indexOf(data);
+        }
+        for (const auto& output : node->outData) indexOf(output);
+    }
+
+    TopologyWriter topology;
+    std::vector<Blob::Ptr> blobs;
+    uint64_t weightsSize = 0;
+    auto writeBlob = [&](const Blob::Ptr& blob) {
+        weightsSize = alignUp(weightsSize, BinaryNetworkHeader::blobAlignment);
+        topology.writeDesc(blob->getTensorDesc());
+        topology.write(weightsSize);
+        topology.write(static_cast<uint64_t>(blob->byteSize()));
+        blobs.push_back(blob);
+        weightsSize += blob->byteSize();
+    };
+
+    topology.writeString(network.getName());
+    topology.writePrecision(network.getPrecision());
+
+    topology.write(static_cast<uint32_t>(datas.size()));
+    for (const auto& data : datas) {
+        topology.writeString(data->getName());
+        topology.writeDesc(data->getTensorDesc());
+    }
+
+    topology.write(static_cast<uint32_t>(ordered.size()));
+    for (const auto& node : ordered) {
+        NetworkSerializer::updateStdLayerParams(node);
+        topology.writeString(node->name);
+        topology.writeString(node->type);
+        topology.writePrecision(node->precision);
+
+        topology.write(static_cast<uint32_t>(node->params.size()));
+        for (const auto& param : node->params) {
+            topology.writeString(param.first);
+            topology.writeString(param.second);
+        }
+
+        topology.write(static_cast<uint32_t>(node->insData.size()));
+        for (const auto& input : node->insData) topology.write(indexOf(input.lock()));
+        topology.write(static_cast<uint32_t>(node->outData.size()));
+        for (const auto& output : node->outData) topology.write(indexOf(output));
+
+        topology.write(static_cast<uint32_t>(node->blobs.size()));
+        for (const auto& blob : node->blobs) {
+            topology.writeString(blob.first);
+            writeBlob(blob.second);
+        }
+    }
+
+    InputsDataMap inputsInfo;
+    network.getInputsInfo(inputsInfo);
+    topology.write(static_cast<uint32_t>(inputsInfo.size()));
+    for (const auto& input : inputsInfo) {
+        auto it = dataIndex.find(input.second->getInputData().get());
+        if (it == dataIndex.end())
+            THROW_IE_EXCEPTION << "Input " << input.first << " is not connected to the network";
+        topology.write(it->second);
+
+        const PreProcessInfo& pp = input.second->getPreProcess();
+        topology.write(static_cast<int32_t>(pp.getMeanVariant()));
+        topology.write(static_cast<int32_t>(pp.getResizeAlgorithm()));
+        topology.write(static_cast<uint32_t>(pp.getColorFormat()));
+        topology.write(static_cast<uint32_t>(pp.getNumberOfChannels()));
+        for (size_t ch = 0; ch < pp.getNumberOfChannels(); ch++) {
+            const PreProcessChannel::Ptr& channel = pp[ch];
+            topology.write(channel->stdScale);
+            topology.write(channel->meanValue);
+            topology.write(static_cast<uint8_t>(channel->meanData != nullptr));
+            if (channel->meanData) writeBlob(channel->meanData);
+        }
+    }
+
+    OutputsDataMap outputsInfo;
+    network.getOutputsInfo(outputsInfo);
+    topology.write(static_cast<uint32_t>(outputsInfo.size()));
+    for (const auto& output : outputsInfo) topology.write(indexOf(output.second));
+
+    NetworkStatsMap statsMap;
+    ICNNNetworkStats* netNodesStats = nullptr;
+    if (network.getStats(&netNodesStats, nullptr) == StatusCode::OK && netNodesStats != nullptr)
+        statsMap = netNodesStats->getNodesStats();
+    topology.write(static_cast<uint32_t>(statsMap.size()));
+    for (const auto& stats : statsMap) {
+        topology.writeString(stats.first);
+        topology.write(static_cast<uint32_t>(stats.second->_minOutputs.size()));
+        for (auto value : stats.second->_minOutputs) topology.write(value);
+        topology.write(static_cast<uint32_t>(stats.second->_maxOutputs.size()));
+        for (auto value : stats.second->_maxOutputs) topology.write(value);
+    }
+
+    BinaryNetworkHeader header = {};
+    std::copy(std::begin(binaryNetworkMagic), std::end(binaryNetworkMagic), header.magic);
+    header.version = BinaryNetworkHeader::currentVersion;
+    header.irVersion = 6;
+    header.topologyOffset = sizeof(header);
+    header.topologySize = topology.buffer.size();
+    header.weightsOffset = alignUp(header.topologyOffset + header.topologySize, BinaryNetworkHeader::sectionAlignment);
+    header.weightsSize = weightsSize;
+
+    std::ofstream ofs(path, std::ofstream::out | std::ofstream::binary);
+    if (!ofs) {
+        THROW_IE_EXCEPTION << "File '" << path << "' is not opened as out file stream";
+    }
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    ofs.write(topology.buffer.data(), topology.buffer.size());
+    writePadding(ofs, header.weightsOffset - header.topologyOffset - header.topologySize);
+    uint64_t offset = 0;
+    for (const auto& blob : blobs) {
+        auto aligned = alignUp(offset, BinaryNetworkHeader::blobAlignment);
+        writePadding(ofs, aligned - offset);
+        ofs.write(blob->cbuffer().as<const char*>(), blob->byteSize());
+        offset = aligned + blob->byteSize();
+    }
+    ofs.close();
+    if (!ofs.good()) {
+        THROW_IE_EXCEPTION << "Error during writing the binary network '" << path << "'";
+    }
+}
+
 void NetworkSerializer::updateStdLayerParams(const CNNLayer::Ptr& layer) {
     auto layerPtr = layer.get();
     auto& params = layer->params;
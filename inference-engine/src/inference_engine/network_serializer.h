@@ -43,6 +43,14 @@ public:
     static INFERENCE_ENGINE_API_CPP(void)
         serializeBlobs(std::ostream& stream, const InferenceEngine::ICNNNetwork& network);
 
+    /**
+     * @brief Write the network to the single file of the binary network format, which ReadBinaryNetwork maps
+     * @param path      Path to the file
+     * @param network   Loaded network
+     */
+    static INFERENCE_ENGINE_API_CPP(void)
+        serializeBinary(const std::string& path, const InferenceEngine::ICNNNetwork& network);
+
     static INFERENCE_ENGINE_API_CPP(void) updateStdLayerParams(const InferenceEngine::CNNLayer::Ptr& layer);
 
 private:
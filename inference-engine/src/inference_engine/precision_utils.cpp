@@ -7,27 +7,131 @@
 #include <ie_blob.h>
 #include <stdint.h>
 
+#include <algorithm>
+#include <cmath>
 #include <details/ie_exception.hpp>
 
+#include "cpu_detector.hpp"
+#include "ie_parallel.hpp"
 #include "inference_engine.hpp"
+#ifdef HAVE_AVX2
+#include "precision_utils_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "precision_utils_avx512.hpp"
+#endif
 
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
-void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
-    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
+namespace {
+
+// the arrays of the weights are split between the threads by the chunks, the rows of the blobs are not worth it
+constexpr size_t parallelChunk = 32 * 1024;
 
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+template <typename Convert>
+void convertInChunks(size_t nelem, const Convert& convert) {
+    if (nelem < 2 * parallelChunk) {
+        convert(0, nelem);
+        return;
     }
+    parallel_for((nelem + parallelChunk - 1) / parallelChunk, [&](size_t chunk) {
+        size_t begin = chunk * parallelChunk;
+        convert(begin, (std::min)(parallelChunk, nelem - begin));
+    });
+}
+
+using ConvertRow = size_t (*)(void* dst, const void* src, size_t n, float scale, float bias);
+
+// the vectored rows convert the leading elements, the rest is left to the element conversion
+template <typename DST, typename SRC, size_t (*VECTORED)(DST*, const SRC*, size_t, float, float)>
+size_t vectored_row(void* dst, const void* src, size_t n, float scale, float bias) {
+    return VECTORED(static_cast<DST*>(dst), static_cast<const SRC*>(src), n, scale, bias);
+}
+
+size_t scalar_row(void*, const void*, size_t, float, float) {
+    return 0;
+}
+
+#ifdef HAVE_AVX512
+#define SELECT_AVX512(name, DST, SRC) \
+    if (with_cpu_x86_avx512_core()) return vectored_row<DST, SRC, avx512::name>;
+#else
+#define SELECT_AVX512(name, DST, SRC)
+#endif
+#ifdef HAVE_AVX2
+#define SELECT_AVX2(name, DST, SRC) \
+    if (with_cpu_x86_avx2()) return vectored_row<DST, SRC, avx::name>;
+#else
+#define SELECT_AVX2(name, DST, SRC)
+#endif
+#define SELECT_ROW(name, DST, SRC)     \
+    []() -> ConvertRow {               \
+        SELECT_AVX512(name, DST, SRC)  \
+        SELECT_AVX2(name, DST, SRC)    \
+        return scalar_row;             \
+    }()
+
+template <typename DST, typename SRC, typename Convert>
+void convertArrays(DST* dst, const SRC* src, size_t nelem, float scale, float bias, ConvertRow vectoredRow,
+                   const Convert& convert) {
+    convertInChunks(nelem, [&](size_t begin, size_t count) {
+        size_t i = begin + vectoredRow(dst + begin, src + begin, count, scale, bias);
+        for (; i < begin + count; i++) dst[i] = convert(src[i]);
+    });
+}
+
+}  // namespace
+
+void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    static const ConvertRow row = SELECT_ROW(convert_row_f16_to_f32, float, int16_t);
+    convertArrays(dst, src, nelem, scale, bias, row, [&](short x) {
+        return PrecisionUtils::f16tof32(x) * scale + bias;
+    });
 }
 
 void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
-    }
+    static const ConvertRow row = SELECT_ROW(convert_row_f32_to_f16, int16_t, float);
+    convertArrays(dst, src, nelem, scale, bias, row, [&](float x) {
+        return PrecisionUtils::f32tof16(x * scale + bias);
+    });
+}
+
+void bf16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    static const ConvertRow row = SELECT_ROW(convert_row_bf16_to_f32, float, int16_t);
+    convertArrays(dst, src, nelem, scale, bias, row, [&](short x) {
+        return PrecisionUtils::bf16tof32(x) * scale + bias;
+    });
+}
+
+void f32tobf16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    static const ConvertRow row = SELECT_ROW(convert_row_f32_to_bf16, int16_t, float);
+    convertArrays(dst, src, nelem, scale, bias, row, [&](float x) {
+        return PrecisionUtils::f32tobf16(x * scale + bias);
+    });
+}
+
+void u8tof32Arrays(float* dst, const uint8_t* src, size_t nelem, float scale, float bias) {
+    static const ConvertRow row = SELECT_ROW(convert_row_u8_to_f32, float, uint8_t);
+    convertArrays(dst, src, nelem, scale, bias, row, [&](uint8_t x) {
+        return static_cast<float>(x) * scale + bias;
+    });
+}
+
+void f32tou8Arrays(uint8_t* dst, const float* src, size_t nelem, float scale, float bias) {
+    static const ConvertRow row = SELECT_ROW(convert_row_f32_to_u8, uint8_t, float);
+    convertArrays(dst, src, nelem, scale, bias, row, [&](float x) {
+        float v = x * scale + bias;
+        v = v > 0.f ? v : 0.f;
+        v = v < 255.f ? v : 255.f;
+        return static_cast<uint8_t>(std::nearbyint(v));
+    });
 }
 
+#undef SELECT_ROW
+#undef SELECT_AVX2
+#undef SELECT_AVX512
+
 // Function to convert F32 into F16
 // F32: exp_bias:127 SEEEEEEE EMMMMMMM MMMMMMMM MMMMMMMM.
 // F16: exp_bias:15  SEEEEEMM MMMMMMMM
@@ -168,5 +272,25 @@ ie_fp16 f32tof16(float x) {
     return v.u | s;
 }
 
+// The conversion of F32 into BF16 keeps the upper half of F32 rounded to the nearest even
+short f32tobf16(float x) {
+    union {
+        float f;
+        uint32_t u;
+    } v;
+    v.f = x;
+
+    // keep NAN quiet, the rounding could turn it into INF
+    if ((v.u & 0x7FFFFFFF) > EXP_MASK_F32) {
+        return static_cast<short>((v.u >> 16) | 0x0040);
+    }
+    v.u += 0x7FFF + ((v.u >> 16) & 1);
+    return static_cast<short>(v.u >> 16);
+}
+
+float bf16tof32(short x) {
+    return asfloat(static_cast<uint32_t>(static_cast<uint16_t>(x)) << 16);
+}
+
 }  // namespace PrecisionUtils
 }  // namespace InferenceEngine
@@ -7,6 +7,7 @@
 #include <ie_api.h>
 
 #include <cstddef>
+#include <cstdint>
 
 namespace InferenceEngine {
 
@@ -18,12 +19,35 @@ INFERENCE_ENGINE_API_CPP(ie_fp16) f32tof16(float x);
 
 INFERENCE_ENGINE_API_CPP(float) f16tof32(ie_fp16 x);
 
+INFERENCE_ENGINE_API_CPP(short) f32tobf16(float x);
+
+INFERENCE_ENGINE_API_CPP(float) bf16tof32(short x);
+
+/*
+ * The arrays are converted by the AVX-512 or the AVX2 code when the CPU has it, the large arrays are split between
+ * the threads. The results are the same as the ones of the element conversions, dst = convert(src * scale + bias)
+ */
+
 INFERENCE_ENGINE_API_CPP(void)
 f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale = 1.f, float bias = 0.f);
 
 INFERENCE_ENGINE_API_CPP(void)
 f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale = 1.f, float bias = 0.f);
 
+INFERENCE_ENGINE_API_CPP(void)
+bf16tof32Arrays(float* dst, const short* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
+// rounds to the nearest even, NaN stays NaN
+INFERENCE_ENGINE_API_CPP(void)
+f32tobf16Arrays(short* dst, const float* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
+INFERENCE_ENGINE_API_CPP(void)
+u8tof32Arrays(float* dst, const uint8_t* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
+// rounds to the nearest even and saturates to [0, 255], NaN is converted to 0
+INFERENCE_ENGINE_API_CPP(void)
+f32tou8Arrays(uint8_t* dst, const float* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
 }  // namespace PrecisionUtils
 
 }  // namespace InferenceEngine
@@ -170,6 +170,7 @@ REG_SHAPE_INFER_FOR_TYPE(EltWiseShapeProp, Mul);
 REG_SHAPE_INFER_FOR_TYPE(EltWiseShapeProp, Add);
 REG_SHAPE_INFER_FOR_TYPE(EltWiseShapeProp, Div);
 REG_SHAPE_INFER_FOR_TYPE(CTCGreedyDecoderShapeProp, CTCGreedyDecoder);
+REG_SHAPE_INFER_FOR_TYPE(CTCGreedyDecoderShapeProp, CTCBeamSearchDecoder);
 REG_SHAPE_INFER_FOR_TYPE(ProposalShapeProp, Proposal);
 REG_SHAPE_INFER_FOR_TYPE(ReorgYoloShapeProp, ReorgYolo);
 REG_SHAPE_INFER_FOR_TYPE(RegionYoloShapeProp, RegionYolo);
@@ -193,6 +194,7 @@ REG_SHAPE_INFER_FOR_TYPE(SparseSegmentReduceShapeProp, SparseSegmentMean);
 REG_SHAPE_INFER_FOR_TYPE(SparseSegmentReduceShapeProp, SparseSegmentSqrtN);
 REG_SHAPE_INFER_FOR_TYPE(SparseSegmentReduceShapeProp, SparseSegmentSum);
 REG_SHAPE_INFER_FOR_TYPE(ExperimentalSparseWeightedReduceShapeProp, ExperimentalSparseWeightedSum);
+REG_SHAPE_INFER_FOR_TYPE(ExperimentalSparseWeightedReduceShapeProp, ExperimentalSparseWeightedMean);
 REG_SHAPE_INFER_FOR_TYPE(SparseToDenseShapeProp, SparseToDense);
 REG_SHAPE_INFER_FOR_TYPE(BucketizeShapeProp, Bucketize);
 REG_SHAPE_INFER_FOR_TYPE(ReverseSequenceShapeProp, ReverseSequence);
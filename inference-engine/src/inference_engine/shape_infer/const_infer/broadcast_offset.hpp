@@ -14,6 +14,8 @@
 #include <string>
 #include <vector>
 
+#include "ie_parallel.hpp"
+
 namespace InferenceEngine {
 namespace ShapeInfer {
 class BroadcastOffset {
@@ -68,5 +70,33 @@ public:
         return pos;
     }
 };
+
+/**
+ * @brief Computes the binary eltwise operation of the inputs broadcasted to the output dims, in parallel.
+ * The inputs of the output dims are accessed linearly, without the offset computation per element.
+ */
+template <typename inDatatype1, typename inDatatype2, typename outDatatype, class Operation>
+void broadcastEltwise(const inDatatype1* in1, const SizeVector& inDims1, const inDatatype2* in2,
+                      const SizeVector& inDims2, outDatatype* out, const SizeVector& outDims, Operation op) {
+    size_t outSize = 1;
+    for (auto dim : outDims) outSize *= dim;
+
+    if (inDims1 == outDims && inDims2 == outDims) {
+        parallel_for(outSize, [&](size_t i) {
+            out[i] = op(in1[i], in2[i]);
+        });
+        return;
+    }
+
+    BroadcastOffset outOff(outDims, outDims);
+    BroadcastOffset inOff1(inDims1, outDims);
+    BroadcastOffset inOff2(inDims2, outDims);
+
+    parallel_for(outSize, [&](size_t i) {
+        SizeVector offsetDims = outOff.offset_dims(i);
+        out[i] = op(in1[inOff1.offset(offsetDims)], in2[inOff2.offset(offsetDims)]);
+    });
+}
+
 }  // namespace ShapeInfer
 }  // namespace InferenceEngine
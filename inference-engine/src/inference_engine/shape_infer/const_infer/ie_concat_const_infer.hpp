@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "ie_const_infer_impl.hpp"
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace ShapeInfer {
@@ -40,21 +41,27 @@ public:
         size_t outerSize = 1;
         for (int i = 0; i < layer._axis; i++) outerSize *= outShape[i];
 
-        size_t outIdx = 0;
-        for (size_t osIdx = 0; osIdx < outerSize; osIdx++) {
-            for (auto& inBlob : inData) {
-                if (inBlob->getTensorDesc().getPrecision() != outBlob->getTensorDesc().getPrecision())
-                    THROW_IE_EXCEPTION << "Unsupported concat layer with different precisions! Out precision: " +
-                                              std::string(outBlob->getTensorDesc().getPrecision().name());
-                const auto* inBuffer = inBlob->cbuffer().as<int8_t*>();
-                size_t innerSize = inBlob->size() / outerSize;
-
-                for (size_t j = 0; j < innerSize; j++, outIdx++) {
-                    memcpy(outBuffer + outIdx * outBlob->element_size(),
-                           inBuffer + (osIdx * innerSize + j) * inBlob->element_size(), inBlob->element_size());
-                }
-            }
+        // every input is copied to the output as outerSize contiguous blocks
+        std::vector<size_t> blockOffsets;
+        size_t outBlockSize = 0;
+        for (auto& inBlob : inData) {
+            if (inBlob->getTensorDesc().getPrecision() != outBlob->getTensorDesc().getPrecision())
+                THROW_IE_EXCEPTION << "Unsupported concat layer with different precisions! Out precision: " +
+                                          std::string(outBlob->getTensorDesc().getPrecision().name());
+            blockOffsets.push_back(outBlockSize);
+            outBlockSize += inBlob->size() / outerSize;
         }
+
+        const size_t elementSize = outBlob->element_size();
+        parallel_for(outerSize, [&](size_t osIdx) {
+            for (size_t i = 0; i < inData.size(); i++) {
+                const auto* inBuffer = inData[i]->cbuffer().as<const int8_t*>();
+                size_t innerSize = inData[i]->size() / outerSize;
+
+                memcpy(outBuffer + (osIdx * outBlockSize + blockOffsets[i]) * elementSize,
+                       inBuffer + osIdx * innerSize * elementSize, innerSize * elementSize);
+            }
+        });
     }
 };
 
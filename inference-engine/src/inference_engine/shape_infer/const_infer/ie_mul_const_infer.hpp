@@ -79,16 +79,11 @@ public:
         auto* outBuffer = outBlob->buffer().as<outDatatype*>();
         if (!outBuffer) THROW_IE_EXCEPTION << "empty output data";
 
-        BroadcastOffset outOff(outBlob->getTensorDesc().getDims(), outBlob->getTensorDesc().getDims());
-        BroadcastOffset inOff1(inData[0]->getTensorDesc().getDims(), outBlob->getTensorDesc().getDims());
-        BroadcastOffset inOff2(inData[1]->getTensorDesc().getDims(), outBlob->getTensorDesc().getDims());
-
-        for (size_t i = 0; i < outBlob->size(); i++) {
-            SizeVector offsetDims = outOff.offset_dims(i);
-            outBuffer[outOff.offset(offsetDims)] =
-                ConversionOutData()(ConversionInData1()(firstBlobBuffer[inOff1.offset(offsetDims)]) *
-                                    ConversionInData2()(secondBlobBuffer[inOff2.offset(offsetDims)]));
-        }
+        broadcastEltwise(firstBlobBuffer, inData[0]->getTensorDesc().getDims(), secondBlobBuffer,
+                         inData[1]->getTensorDesc().getDims(), outBuffer, outBlob->getTensorDesc().getDims(),
+                         [](inDatatype1 value1, inDatatype2 value2) {
+                             return ConversionOutData()(ConversionInData1()(value1) * ConversionInData2()(value2));
+                         });
     }
 
     void inferImpl(const std::vector<Blob::CPtr>& inData, const std::map<std::string, std::string>& params,
@@ -53,15 +53,46 @@ public:
         for (auto ord : order) {
             orderedDims.push_back(dims[ord]);
         }
-        TensorDesc dstDesc(InferenceEngine::Precision::FP32, dims, {orderedDims, order});
-
         size_t dataSize = inData[0]->size();
-        const auto* src_data = inData[0]->cbuffer().as<const uint8_t*>();
+        const auto* src_data = inData[0]->cbuffer().as<const uint8_t*>() +
+                               srcDesc.getBlockingDesc().getOffsetPadding() * inData[0]->element_size();
         auto* dst_data = outData[0]->buffer().as<uint8_t*>();
+        const size_t elementSize = inData[0]->element_size();
+        const size_t rank = orderedDims.size();
+
+        if (rank == 0) {
+            memcpy(dst_data, src_data, dataSize * elementSize);
+            return;
+        }
 
-        parallel_for(dataSize, [&](size_t i) {
-            memcpy(dst_data + dstDesc.offset(i) * outData[0]->element_size(),
-                   src_data + srcDesc.offset(i) * inData[0]->element_size(), inData[0]->element_size());
+        // strides of the source, taken in the order of the destination dims
+        SizeVector srcStrides(rank, 1);
+        for (size_t d = rank - 1; d > 0; d--) srcStrides[d - 1] = srcStrides[d] * dims[d];
+        SizeVector permutedStrides(rank);
+        for (size_t d = 0; d < rank; d++) permutedStrides[d] = srcStrides[order[d]];
+
+        // the destination is written by rows of its innermost dim, which are contiguous rows of the source
+        // if the innermost dim is not permuted
+        const size_t rowSize = orderedDims[rank - 1];
+        const size_t rowStride = permutedStrides[rank - 1];
+        const size_t rowsCount = rowSize == 0 ? 0 : dataSize / rowSize;
+
+        parallel_for(rowsCount, [&](size_t row) {
+            size_t srcOffset = 0;
+            size_t rest = row;
+            for (size_t d = rank - 1; d > 0; d--) {
+                srcOffset += (rest % orderedDims[d - 1]) * permutedStrides[d - 1];
+                rest /= orderedDims[d - 1];
+            }
+
+            auto* dst = dst_data + row * rowSize * elementSize;
+            if (rowStride == 1) {
+                memcpy(dst, src_data + srcOffset * elementSize, rowSize * elementSize);
+            } else {
+                for (size_t i = 0; i < rowSize; i++) {
+                    memcpy(dst + i * elementSize, src_data + (srcOffset + i * rowStride) * elementSize, elementSize);
+                }
+            }
         });
     }
 };
@@ -8,6 +8,7 @@
 
 #include <details/ie_exception.hpp>
 #include <ie_layer_validators.hpp>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <set>
@@ -109,16 +110,56 @@ void ReshapeLauncher::applyChanges(CNNLayer* layer) {
 void ReshapeLauncher::constInfer(const std::set<ReshapeLauncher::Ptr>& launchers) {
     if ((_iController->isDataAvailable() && _layer->type != "Quantize" && _layer->type != "FakeQuantize") ||
         _layer->type == "Const" || _layer->type == "Shape") {
-        auto outBlobs = _oController->createBlobs();
-        _oController->setBlobs(outBlobs);
-        if (!_inferImpl)
-            THROW_IE_EXCEPTION << "Failed to find reference implementation for `" + _layer->name + "` Layer with `" +
-                                      _layer->type + "` Type on constant propagation";
-        _inferImpl->infer(_iController->getBlobs(false), _layer->params, _layer->blobs, outBlobs);
+        auto inBlobs = _iController->getBlobs(false);
+        auto outShapes = _oController->getShapes(false);
+        if (!isConstInferCached(inBlobs, outShapes)) {
+            auto outBlobs = _oController->createBlobs();
+            if (!_inferImpl)
+                THROW_IE_EXCEPTION << "Failed to find reference implementation for `" + _layer->name +
+                                          "` Layer with `" + _layer->type + "` Type on constant propagation";
+            _inferImpl->infer(inBlobs, _layer->params, _layer->blobs, outBlobs);
+            cacheConstInfer(inBlobs, outShapes, outBlobs);
+        }
+        _oController->setBlobs(_constInferOutputs);
         _oController->propagateBlobs(launchers);
     }
 }
 
+bool ReshapeLauncher::isConstInferCached(const std::vector<Blob::CPtr>& inBlobs,
+                                         const std::vector<SizeVector>& outShapes) const {
+    if (_constInferOutputs.empty() || outShapes != _constInferShapes || inBlobs.size() != _constInferInputs.size() ||
+        _layer->params != _constInferParams || _layer->blobs != _constInferLayerBlobs)
+        return false;
+
+    for (size_t i = 0; i < inBlobs.size(); i++) {
+        const auto& cached = _constInferInputs[i];
+        const auto& current = inBlobs[i];
+        if (cached == current) continue;
+        if (!cached || !current || !(cached->getTensorDesc() == current->getTensorDesc())) return false;
+
+        // The blobs without data keep only the descriptors of the inputs of the Shape layer
+        auto cachedData = cached->cbuffer().as<const uint8_t*>();
+        auto currentData = current->cbuffer().as<const uint8_t*>();
+        if (cachedData == nullptr || currentData == nullptr) {
+            if (cachedData != currentData) return false;
+            continue;
+        }
+        if (cached->byteSize() != current->byteSize() ||
+            std::memcmp(cachedData, currentData, current->byteSize()) != 0)
+            return false;
+    }
+    return true;
+}
+
+void ReshapeLauncher::cacheConstInfer(const std::vector<Blob::CPtr>& inBlobs, const std::vector<SizeVector>& outShapes,
+                                      const std::vector<Blob::Ptr>& outBlobs) {
+    _constInferInputs = inBlobs;
+    _constInferShapes = outShapes;
+    _constInferParams = _layer->params;
+    _constInferLayerBlobs = _layer->blobs;
+    _constInferOutputs = outBlobs;
+}
+
 void ReshapeLauncher::reset() {
     _iController->reset();
     _oController->reset();
@@ -241,17 +282,19 @@ void OutputOnlyReshapeLauncher::reset() {
 
 void OutputOnlyReshapeLauncher::constInfer(const std::set<ReshapeLauncher::Ptr>& launchers) {
     if (_layer->type == "Const") {
-        auto outBlobs = _oController->createBlobs();
-        _oController->setBlobs(outBlobs);
-        if (!_inferImpl)
-            THROW_IE_EXCEPTION << "Failed to find reference implementation for `" + _layer->name + "` Layer with `" +
-                                      _layer->type + "` Type on constant propagation";
-        _inferImpl->infer({}, _layer->params, _layer->blobs, outBlobs);
         auto shapes = _oController->getShapes(true);
-        for (int i = 0; i < outBlobs.size(); i++) {
-            outBlobs[i]->getTensorDesc().reshape(shapes[i], TensorDesc::getLayoutByDims(shapes[i]));
+        if (!isConstInferCached({}, shapes)) {
+            auto outBlobs = _oController->createBlobs();
+            if (!_inferImpl)
+                THROW_IE_EXCEPTION << "Failed to find reference implementation for `" + _layer->name +
+                                          "` Layer with `" + _layer->type + "` Type on constant propagation";
+            _inferImpl->infer({}, _layer->params, _layer->blobs, outBlobs);
+            for (int i = 0; i < outBlobs.size(); i++) {
+                outBlobs[i]->getTensorDesc().reshape(shapes[i], TensorDesc::getLayoutByDims(shapes[i]));
+            }
+            cacheConstInfer({}, shapes, outBlobs);
         }
-        _oController->setBlobs(outBlobs);
+        _oController->setBlobs(_constInferOutputs);
         _oController->propagateBlobs(launchers);
     }
 }
@@ -113,12 +113,28 @@ protected:
     IShapeInferImpl::Ptr _reshapeImpl;
     IConstInferImpl::Ptr _inferImpl;
 
+    // Inputs and outputs of the previous const inference, reused while the inputs and the output shapes are unchanged
+    std::vector<Blob::CPtr> _constInferInputs;
+    std::vector<SizeVector> _constInferShapes;
+    std::map<std::string, std::string> _constInferParams;
+    std::map<std::string, Blob::Ptr> _constInferLayerBlobs;
+    std::vector<Blob::Ptr> _constInferOutputs;
+
 protected:
     /**
      * @brief Check that all shape infer operations were done with specified layer.
      * @param layer - pointer to the layer to compare with
      */
     void checkLayer(CNNLayer* layer);
+
+    /**
+     * @brief Checks whether the outputs of the previous const inference are valid for the given inputs and shapes.
+     * The input blobs match if they are the same objects or have the same descriptors and data.
+     */
+    bool isConstInferCached(const std::vector<Blob::CPtr>& inBlobs, const std::vector<SizeVector>& outShapes) const;
+
+    void cacheConstInfer(const std::vector<Blob::CPtr>& inBlobs, const std::vector<SizeVector>& outShapes,
+                         const std::vector<Blob::Ptr>& outBlobs);
 };
 
 class FakeInitializer : public DefaultInitializer {
@@ -7,8 +7,10 @@
 #include <debug.h>
 #include <ie_layers.h>
 
+#include <algorithm>
 #include <blob_factory.hpp>
 #include <builders/ie_split_layer.hpp>
+#include <exception>
 #include <functional>
 #include <graph_tools.hpp>
 #include <map>
@@ -21,6 +23,7 @@
 #include "details/caseless.hpp"
 #include "details/ie_cnn_network_tools.h"
 #include "ie_cnn_layer_builder.h"
+#include "ie_parallel.hpp"
 #include "ie_reshaper.hpp"
 #include "shape_infer/built-in/ie_built_in_holder.hpp"
 
@@ -46,6 +49,32 @@ inline static std::vector<CNNLayerPtr> SortTopologicallyStartsFrom(const std::ve
     return all_layers;
 }
 
+inline static std::vector<std::vector<std::vector<CNNLayerPtr>>> SplitToWaves(
+    const std::vector<CNNLayerPtr>& sortedLayers) {
+    std::map<const CNNLayer*, size_t> layerWaves;
+    std::vector<caseless_map<std::string, std::vector<CNNLayerPtr>>> typedWaves;
+    for (const auto& layer : sortedLayers) {
+        size_t wave = 0;
+        for (const auto& insData : layer->insData) {
+            auto data = insData.lock();
+            auto creator = data ? data->getCreatorLayer().lock() : nullptr;
+            auto foundCreator = creator ? layerWaves.find(creator.get()) : layerWaves.end();
+            if (foundCreator != layerWaves.end()) wave = std::max(wave, foundCreator->second + 1);
+        }
+        layerWaves[layer.get()] = wave;
+        if (typedWaves.size() <= wave) typedWaves.resize(wave + 1);
+        typedWaves[wave][layer->type].push_back(layer);
+    }
+
+    std::vector<std::vector<std::vector<CNNLayerPtr>>> waves(typedWaves.size());
+    for (size_t i = 0; i < typedWaves.size(); i++) {
+        for (auto& group : typedWaves[i]) {
+            waves[i].push_back(std::move(group.second));
+        }
+    }
+    return waves;
+}
+
 Reshaper::Reshaper(std::vector<DataPtr> insDatas, const LauncherCreator::Ptr& launcherCreator): network(nullptr) {
     auto builtIn = std::make_shared<BuiltInShapeInferHolder>();
     _allTypes = getTypeNamesFromExtension(builtIn);
@@ -65,6 +94,7 @@ Reshaper::Reshaper(std::vector<DataPtr> insDatas, const LauncherCreator::Ptr& la
         auto createdLauncher = launcherCreator->createNotInputLauncher(currentLayer.get(), _extensions);
         _launchers.insert(createdLauncher);
     }
+    _reshapeWaves = SplitToWaves(_allSortedLayers);
 }
 
 Reshaper::Reshaper(ICNNNetwork& network, const LauncherCreator::Ptr& launcherCreator): network(nullptr) {
@@ -93,6 +123,7 @@ Reshaper::Reshaper(ICNNNetwork& network, const LauncherCreator::Ptr& launcherCre
         }
         _launchers.insert(createdLauncher);
     }
+    _reshapeWaves = SplitToWaves(_allSortedLayers);
 }
 
 void Reshaper::AddExtension(const IShapeInferExtensionPtr& extension) {
@@ -143,10 +174,14 @@ void Reshaper::AddExtension(const IShapeInferExtensionPtr& extension) {
             _launchers.insert(launcher);
         }
     }
+    _launchersByName.clear();
     _extensions.push_back(extension);
 }
 
 ReshapeLauncher::Ptr Reshaper::getLauncherByLayerName(const std::string& layerName) const {
+    auto foundByName = _launchersByName.find(layerName);
+    if (foundByName != _launchersByName.end()) return foundByName->second;
+
     auto foundLauncher =
         std::find_if(_launchers.begin(), _launchers.end(), [&layerName](const ReshapeLauncher::Ptr& launcher) {
             return launcher->getLayerName() == layerName;
@@ -156,6 +191,38 @@ ReshapeLauncher::Ptr Reshaper::getLauncherByLayerName(const std::string& layerNa
     return *foundLauncher;
 }
 
+void Reshaper::mapLaunchersByName() {
+    _launchersByName.clear();
+    for (const auto& launcher : _launchers) {
+        _launchersByName[launcher->getLayerName()] = launcher;
+    }
+}
+
+void Reshaper::reshapeWaves(bool withConstInfer) {
+    for (const auto& wave : _reshapeWaves) {
+        std::vector<std::exception_ptr> errors(wave.size());
+        auto reshapeGroup = [&](size_t group) {
+            try {
+                for (const auto& layer : wave[group]) {
+                    auto foundLauncher = getLauncherByLayerName(layer->name);
+                    foundLauncher->reshape(_launchers);
+                    if (withConstInfer) foundLauncher->constInfer(_launchers);
+                }
+            } catch (...) {
+                errors[group] = std::current_exception();
+            }
+        };
+        if (wave.size() == 1) {
+            reshapeGroup(0);
+        } else {
+            parallel_for(wave.size(), reshapeGroup);
+        }
+        for (const auto& error : errors) {
+            if (error) std::rethrow_exception(error);
+        }
+    }
+}
+
 StatusCode Reshaper::run(const std::map<std::string, SizeVector>& inputShapes, ResponseDesc* resp) {
     if (network) {
         return networkShapeInfer(inputShapes, resp);
@@ -165,6 +232,7 @@ StatusCode Reshaper::run(const std::map<std::string, SizeVector>& inputShapes, R
     static std::mutex reshapeMutex;
     {
         std::lock_guard<std::mutex> lock(reshapeMutex);
+        mapLaunchersByName();
         // Reset all shapes from previous run
         for (const auto& launcher : _launchers) {
             launcher->reset();
@@ -186,11 +254,7 @@ StatusCode Reshaper::run(const std::map<std::string, SizeVector>& inputShapes, R
         }
 
         // do reshape
-        for (auto& layer : _allSortedLayers) {
-            auto foundLauncher = getLauncherByLayerName(layer->name);
-            foundLauncher->reshape(_launchers);
-            foundLauncher->constInfer(_launchers);
-        }
+        reshapeWaves(true);
 
         // apply changes
         for (auto& layer : _allSortedLayers) {
@@ -202,6 +266,7 @@ StatusCode Reshaper::run(const std::map<std::string, SizeVector>& inputShapes, R
 }
 
 StatusCode Reshaper::runNoApply(const std::map<std::string, SizeVector>& inputShapes, ResponseDesc* resp) {
+    mapLaunchersByName();
     // Reset all shapes from previous run
     for (const auto& launcher : _launchers) {
         launcher->reset();
@@ -224,10 +289,7 @@ StatusCode Reshaper::runNoApply(const std::map<std::string, SizeVector>& inputSh
     }
 
     // do reshape
-    for (auto& layer : _allSortedLayers) {
-        auto foundLauncher = getLauncherByLayerName(layer->name);
-        foundLauncher->reshape(_launchers);
-    }
+    reshapeWaves(false);
     return OK;
 }
 
@@ -107,6 +107,10 @@ public:
 private:
     ReshapeLauncher::Ptr getLauncherByLayerName(const std::string& layerName) const;
 
+    void mapLaunchersByName();
+
+    void reshapeWaves(bool withConstInfer);
+
     StatusCode networkShapeInfer(const std::map<std::string, SizeVector>& inputShapes, ResponseDesc* resp);
 
     InferenceEngine::details::caseless_set<std::string> getTypeNamesFromExtension(
@@ -115,6 +119,10 @@ private:
     std::vector<IShapeInferExtensionPtr> _extensions;
     std::set<ReshapeLauncher::Ptr> _launchers;
     std::vector<CNNLayerPtr> _allSortedLayers {};
+    // The layers of one wave take inputs from the previous waves only, the layers of one type stay in one group
+    // since the implementations keep the state of the layer they process
+    std::vector<std::vector<std::vector<CNNLayerPtr>>> _reshapeWaves {};
+    std::map<std::string, ReshapeLauncher::Ptr> _launchersByName {};
     std::set<CNNLayerPtr> _inputLayers {};
     InferenceEngine::details::caseless_set<std::string> _allTypes;
 
@@ -4,6 +4,202 @@
 
 #include "system_allocator.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+# include <malloc.h>
+#elif defined(__unix__) || defined(__APPLE__)
+# include <sys/mman.h>
+# include <unistd.h>
+# define IE_HAS_MMAP
+#endif
+
+constexpr size_t SystemMemoryAllocator::alignment;
+constexpr size_t SystemMemoryAllocator::largeBlockSize;
+
+namespace {
+
+constexpr size_t pageSize = 4096;
+
+// the header of the block lies right before the memory given out, so free() needs only the handle
+struct BlockHeader {
+    void* base;
+    size_t mappedSize;  // 0 for the blocks of the heap
+    size_t capacity;
+};
+static_assert(sizeof(BlockHeader) <= SystemMemoryAllocator::alignment, "The header of the block does not fit its place");
+
+BlockHeader* headerOf(void* handle) {
+    return reinterpret_cast<BlockHeader*>(static_cast<uint8_t*>(handle) - SystemMemoryAllocator::alignment);
+}
+
+size_t roundUp(size_t size, size_t step) {
+    return (size + step - 1) / step * step;
+}
+
+// the sizes are rounded up to the classes at most 25% apart, so the pooled blocks serve the close sizes
+size_t sizeClass(size_t size) {
+    if (size <= pageSize)
+        return roundUp((std::max)(size, static_cast<size_t>(1)), SystemMemoryAllocator::alignment);
+    size_t power = pageSize;
+    while (power <= size / 2)
+        power *= 2;
+    return roundUp(size, power / 4);
+}
+
+void* alignedMalloc(size_t align, size_t size) {
+#ifdef _WIN32
+    return _aligned_malloc(size, align);
+#else
+    void* ptr = nullptr;
+    return posix_memalign(&ptr, align, size) == 0 ? ptr : nullptr;
+#endif
+}
+
+void alignedFree(void* ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void* allocateBlock(size_t capacity, bool hugePages) {
+    // the large blocks start at the page boundary, the first page keeps the header
+    const bool large = capacity >= SystemMemoryAllocator::largeBlockSize;
+    const size_t offset = large ? pageSize : SystemMemoryAllocator::alignment;
+    void* base = nullptr;
+    size_t mappedSize = 0;
+#ifdef IE_HAS_MMAP
+    if (large) {
+        mappedSize = roundUp(offset + capacity, hugePages ? SystemMemoryAllocator::largeBlockSize : pageSize);
+        base = MAP_FAILED;
+# ifdef MAP_HUGETLB
+        // the explicit huge pages are used when the system reserves them, the transparent ones otherwise
+        if (hugePages)
+            base = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+# endif
+        if (base == MAP_FAILED) {
+            base = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (base == MAP_FAILED)
+                return nullptr;
+# ifdef MADV_HUGEPAGE
+            if (hugePages)
+                madvise(base, mappedSize, MADV_HUGEPAGE);
+# endif
+        }
+    }
+#endif
+    if (base == nullptr) {
+        base = alignedMalloc(large ? pageSize : SystemMemoryAllocator::alignment, offset + capacity);
+        if (base == nullptr)
+            return nullptr;
+    }
+
+    void* handle = static_cast<uint8_t*>(base) + offset;
+    *headerOf(handle) = {base, mappedSize, capacity};
+    return handle;
+}
+
+void releaseBlock(void* handle) {
+    const BlockHeader header = *headerOf(handle);
+#ifdef IE_HAS_MMAP
+    if (header.mappedSize != 0) {
+        munmap(header.base, header.mappedSize);
+        return;
+    }
+#endif
+    alignedFree(header.base);
+}
+
+// the pool is shared by all the allocators of the process and never destroyed, as the blobs may outlive the statics
+struct BlockPool {
+    std::mutex mutex;
+    std::unordered_map<size_t, std::vector<void*>> freeBlocks;
+    size_t pooledBytes = 0;
+    size_t poolSize = 0;
+    bool hugePages = false;
+
+    static BlockPool& get() {
+        static BlockPool* pool = new BlockPool();
+        return *pool;
+    }
+
+    void* acquire(size_t size) {
+        const size_t capacity = sizeClass(size);
+        if (capacity < size)
+            return nullptr;
+        bool huge;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = freeBlocks.find(capacity);
+            if (it != freeBlocks.end() && !it->second.empty()) {
+                void* handle = it->second.back();
+                it->second.pop_back();
+                pooledBytes -= capacity;
+                return handle;
+            }
+            huge = hugePages;
+        }
+        return allocateBlock(capacity, huge);
+    }
+
+    void recycle(void* handle) {
+        const size_t capacity = headerOf(handle)->capacity;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (pooledBytes + capacity <= poolSize) {
+                freeBlocks[capacity].push_back(handle);
+                pooledBytes += capacity;
+                return;
+            }
+        }
+        releaseBlock(handle);
+    }
+
+    void setPoolSize(size_t size) {
+        std::vector<void*> released;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            poolSize = size;
+            for (auto& blocks : freeBlocks) {
+                while (pooledBytes > poolSize && !blocks.second.empty()) {
+                    released.push_back(blocks.second.back());
+                    blocks.second.pop_back();
+                    pooledBytes -= blocks.first;
+                }
+            }
+        }
+        for (auto handle : released)
+            releaseBlock(handle);
+    }
+};
+
+}  // namespace
+
+void* SystemMemoryAllocator::alloc(size_t size) noexcept {
+    try {
+        return BlockPool::get().acquire(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+bool SystemMemoryAllocator::free(void* handle) noexcept {
+    if (handle == nullptr)
+        return true;
+    try {
+        BlockPool::get().recycle(handle);
+    } catch (...) {
+    }
+    return true;
+}
+
 namespace InferenceEngine {
 
 IAllocator* CreateDefaultAllocator() noexcept {
@@ -14,4 +210,24 @@ IAllocator* CreateDefaultAllocator() noexcept {
     }
 }
 
+namespace details {
+
+void SetSystemAllocatorPoolSize(size_t poolSize) {
+    BlockPool::get().setPoolSize(poolSize);
+}
+
+void SetSystemAllocatorHugePages(bool hugePages) {
+    auto& pool = BlockPool::get();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.hugePages = hugePages;
+}
+
+size_t GetSystemAllocatorPooledBytes() {
+    auto& pool = BlockPool::get();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    return pool.pooledBytes;
+}
+
+}  // namespace details
+
 }  // namespace InferenceEngine
@@ -4,12 +4,23 @@
 
 #pragma once
 
+#include <cstddef>
 #include <iostream>
 
 #include "ie_allocator.hpp"
-
+#include "ie_api.h"
+
+/**
+ * @brief The default allocator of the blobs. The memory is 64 bytes aligned, the blocks of at least
+ * SystemMemoryAllocator::largeBlockSize bytes are page aligned. The freed blocks are kept in the process wide
+ * pool of PluginConfigParams::KEY_BLOB_ALLOCATOR_POOL_SIZE bytes, which serves the next allocations of the same
+ * size class, and the large blocks are backed by the huge pages with PluginConfigParams::KEY_BLOB_ALLOCATOR_HUGE_PAGES.
+ */
 class SystemMemoryAllocator : public InferenceEngine::IAllocator {
 public:
+    static constexpr size_t alignment = 64;
+    static constexpr size_t largeBlockSize = 2 * 1024 * 1024;
+
     void Release() noexcept override {
         delete this;
     }
@@ -20,20 +31,31 @@ public:
 
     void unlock(void* a) noexcept override {}
 
-    void* alloc(size_t size) noexcept override {
-        try {
-            auto handle = reinterpret_cast<void*>(new char[size]);
-            return handle;
-        } catch (...) {
-            return nullptr;
-        }
-    }
+    void* alloc(size_t size) noexcept override;
 
-    bool free(void* handle) noexcept override {
-        try {
-            delete[] reinterpret_cast<char*>(handle);
-        } catch (...) {
-        }
-        return true;
-    }
-};
\ No newline at end of file
+    bool free(void* handle) noexcept override;
+};
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Sets the number of bytes the pool of the default blob allocator may keep, the pooled blocks over it
+ * are released
+ * @param poolSize The size of the pool, 0 disables the pool
+ */
+INFERENCE_ENGINE_API_CPP(void) SetSystemAllocatorPoolSize(size_t poolSize);
+
+/**
+ * @brief Sets whether the large blocks allocated afterwards by the default blob allocator are backed by the huge pages
+ * @param hugePages The explicit huge pages are used when the system reserves them, the transparent ones otherwise
+ */
+INFERENCE_ENGINE_API_CPP(void) SetSystemAllocatorHugePages(bool hugePages);
+
+/**
+ * @brief Gets the number of bytes held by the pool of the default blob allocator
+ */
+INFERENCE_ENGINE_API_CPP(size_t) GetSystemAllocatorPooledBytes();
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -10,8 +10,10 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_common.h"
 
 #include <cpp_interfaces/exception2status.hpp>
@@ -61,9 +63,11 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS
                                    << ". Expected only YES/NO";
         } else if (key == PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) {
+            // the streams of CPU_THROUGHPUT_AUTO stay until the tuned ones are estimated by the network
+            tuneStreams = val == CPUConfigParams::CPU_THROUGHPUT_TUNED;
             if (val == PluginConfigParams::CPU_THROUGHPUT_NUMA) {
                 throughputStreams = MKLDNNPlugin::cpu::getAvailableNUMANodes().size();
-            } else if (val == PluginConfigParams::CPU_THROUGHPUT_AUTO) {
+            } else if (val == PluginConfigParams::CPU_THROUGHPUT_AUTO || tuneStreams) {
                 const int sockets = MKLDNNPlugin::cpu::getAvailableNUMANodes().size();
                 // bare minimum of streams (that evenly divides available number of core)
                 const int num_cores = sockets == 1 ? parallel_get_max_threads() : cpu::getNumberOfCPUCores();
@@ -82,7 +86,8 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 } catch (const std::exception&) {
                     THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS
                                        << ". Expected only positive numbers (#streams) or "
-                                       << "PluginConfigParams::CPU_THROUGHPUT_NUMA/CPU_THROUGHPUT_AUTO";
+                                       << "PluginConfigParams::CPU_THROUGHPUT_NUMA/CPU_THROUGHPUT_AUTO or "
+                                       << "CPUConfigParams::CPU_THROUGHPUT_TUNED";
                 }
                 if (val_i > 0)
                     throughputStreams = val_i;
@@ -107,6 +112,118 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES) {
+            if (val == PluginConfigParams::YES) dynamicShapes = true;
+            else if (val == PluginConfigParams::NO) dynamicShapes = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_ENFORCE_BF16) {
+            if (val == PluginConfigParams::YES) enforceBF16 = true;
+            else if (val == PluginConfigParams::NO) enforceBF16 = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_ENFORCE_BF16
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_LAYOUT_ASSIGNMENT) {
+            if (val == PluginConfigParams::YES) layoutAssignment = true;
+            else if (val == PluginConfigParams::NO) layoutAssignment = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_LAYOUT_ASSIGNMENT
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_SUBPIXEL_DECONVOLUTION) {
+            if (val == PluginConfigParams::YES) subPixelDeconvolution = true;
+            else if (val == PluginConfigParams::NO) subPixelDeconvolution = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SUBPIXEL_DECONVOLUTION
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_WEIGHTS_COMPRESSION) {
+            if (val == PluginConfigParams::NO) weightsCompression = WeightsCompression::No;
+            else if (val == CPUConfigParams::FP16) weightsCompression = WeightsCompression::FP16;
+            else if (val == CPUConfigParams::I8) weightsCompression = WeightsCompression::I8;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_WEIGHTS_COMPRESSION
+                                   << ". Expected only NO/FP16/I8";
+        } else if (key == CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD) {
+            float val_f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                                   << ". Expected only values in the range [0, 1]";
+            }
+            if (val_f < 0.f || val_f > 1.f)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                                   << ". Expected only values in the range [0, 1]";
+            sparseWeightsThreshold = val_f;
+        } else if (key == CPUConfigParams::KEY_CPU_REQUESTED_OUTPUTS) {
+            requestedOutputs.clear();
+            std::stringstream names(val);
+            std::string name;
+            while (std::getline(names, name, ','))
+                if (!name.empty()) requestedOutputs.insert(name);
+        } else if (key == CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY
+                                   << ". Expected only non-negative numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY
+                                   << ". Expected only non-negative numbers";
+            primitiveCacheCapacity = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_PREPROCESSING_THREADS) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PREPROCESSING_THREADS
+                                   << ". Expected only non-negative numbers (#threads)";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PREPROCESSING_THREADS
+                                   << ". Expected only non-negative numbers (#threads)";
+            preprocessingThreads = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_WAIT_SPIN_TIME) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_WAIT_SPIN_TIME
+                                   << ". Expected only non-negative numbers (microseconds)";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_WAIT_SPIN_TIME
+                                   << ". Expected only non-negative numbers (microseconds)";
+            waitSpinTime = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_PERF_COUNT_SAMPLING_PERIOD) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PERF_COUNT_SAMPLING_PERIOD
+                                   << ". Expected only non-negative numbers (#inferences)";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PERF_COUNT_SAMPLING_PERIOD
+                                   << ". Expected only non-negative numbers (#inferences)";
+            perfCountSamplingPeriod = val_i;
+        } else if (key == PluginConfigParams::KEY_MEMORY_BUDGET) {
+            try {
+                if (val.empty() || val[0] == '-')
+                    throw std::invalid_argument(val);
+                memoryBudget = std::stoull(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_MEMORY_BUDGET
+                                   << ". Expected only non-negative numbers (bytes)";
+            }
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
@@ -126,8 +243,10 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
         }
         _config.clear();
     }
-    if (exclusiveAsyncRequests)  // Exclusive request feature disables the streams
+    if (exclusiveAsyncRequests) {  // Exclusive request feature disables the streams
         throughputStreams = 1;
+        tuneStreams = false;
+    }
 
     updateProperties();
 }
@@ -149,10 +268,46 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
+        if (parallelBranches == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::NO });
+        if (dynamicShapes == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::NO });
+        if (enforceBF16 == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_ENFORCE_BF16, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_ENFORCE_BF16, PluginConfigParams::NO });
+        if (layoutAssignment == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_LAYOUT_ASSIGNMENT, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_LAYOUT_ASSIGNMENT, PluginConfigParams::NO });
+        if (subPixelDeconvolution == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_SUBPIXEL_DECONVOLUTION, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_SUBPIXEL_DECONVOLUTION, PluginConfigParams::NO });
+        if (weightsCompression == WeightsCompression::FP16)
+            _config.insert({ CPUConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, CPUConfigParams::FP16 });
+        else if (weightsCompression == WeightsCompression::I8)
+            _config.insert({ CPUConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, CPUConfigParams::I8 });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, std::to_string(sparseWeightsThreshold) });
+        std::string outputs;
+        for (const auto& name : requestedOutputs)
+            outputs += (outputs.empty() ? "" : ",") + name;
+        _config.insert({ CPUConfigParams::KEY_CPU_REQUESTED_OUTPUTS, outputs });
 
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(throughputStreams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(threadsNum) });
+        _config.insert({ CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY, std::to_string(primitiveCacheCapacity) });
+        _config.insert({ CPUConfigParams::KEY_CPU_PREPROCESSING_THREADS, std::to_string(preprocessingThreads) });
+        _config.insert({ CPUConfigParams::KEY_CPU_WAIT_SPIN_TIME, std::to_string(waitSpinTime) });
+        _config.insert({ CPUConfigParams::KEY_CPU_PERF_COUNT_SAMPLING_PERIOD, std::to_string(perfCountSamplingPeriod) });
+        _config.insert({ PluginConfigParams::KEY_MEMORY_BUDGET, std::to_string(memoryBudget) });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
     }
 }
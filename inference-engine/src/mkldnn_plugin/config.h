@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <map>
+#include <set>
 
 namespace MKLDNNPlugin {
 
@@ -23,13 +25,29 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool parallelBranches = false;
+    bool dynamicShapes = false;
+    bool enforceBF16 = false;
+    bool layoutAssignment = false;
+    bool subPixelDeconvolution = false;
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
     int throughputStreams = 1;
+    // the streams and the threads are chosen from the network when it is loaded, see estimate_streams
+    bool tuneStreams = false;
     int threadsNum = 0;
+    int primitiveCacheCapacity = 1024;
+    int preprocessingThreads = 0;
+    int waitSpinTime = 0;
+    int perfCountSamplingPeriod = 0;
+    uint64_t memoryBudget = 0;
     LPTransformsMode lpTransformsMode = LPTransformsMode::On;
+    enum class WeightsCompression {No, FP16, I8} weightsCompression = WeightsCompression::No;
+    float sparseWeightsThreshold = 0.8f;
+    // the outputs kept when the network is loaded, empty means all of them
+    std::set<std::string> requestedOutputs;
 
     void readProperties(const std::map<std::string, std::string> &config);
     void updateProperties();
@@ -2,15 +2,23 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstdint>
 #include <fstream>
 #include <set>
 #include <string>
 #include <vector>
 #include <iostream>
 #include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
 #include "lin_system_conf.h"
 #include "ie_parallel.hpp"
 
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+# include <cpuid.h>
+# define IE_HAS_CPUID
+#endif
+
 
 namespace MKLDNNPlugin {
 namespace cpu {
@@ -189,6 +197,121 @@ void Collection::updateCpuInformation(const Processor &processor,
 }
 #endif
 
+bool bindMemoryToNUMANode(void* data, size_t size, int numa_node) {
+    static const bool is_numa_system = getAvailableNUMANodes().size() > 1;
+    if (!is_numa_system || numa_node < 0 || numa_node >= 8 * static_cast<int>(sizeof(unsigned long)))
+        return false;
+
+    // only pages which are entirely inside the region, neighbour allocations must not be moved
+    const uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const uintptr_t begin = (reinterpret_cast<uintptr_t>(data) + page_size - 1) / page_size * page_size;
+    const uintptr_t end = (reinterpret_cast<uintptr_t>(data) + size) / page_size * page_size;
+    if (end <= begin)
+        return false;
+
+    // values from <numaif.h>, which is a part of libnuma and not always available
+    const int mpol_preferred = 1;
+    const unsigned mpol_mf_move = 1 << 1;
+    unsigned long node_mask = 1UL << numa_node;
+    return 0 == syscall(SYS_mbind, reinterpret_cast<void*>(begin), end - begin, mpol_preferred,
+                        &node_mask, 8 * sizeof(node_mask), mpol_mf_move);
+}
+
+namespace {
+
+// the list of the processors in the format of sysfs, as "0-7,16-23"
+std::vector<int> readCpuList(const char *fileName) {
+    std::vector<int> cpus;
+    std::ifstream file(fileName);
+    std::string range;
+    while (std::getline(file, range, ',')) {
+        int first = 0, last = 0;
+        const int fields = sscanf(range.c_str(), "%d-%d", &first, &last);
+        if (fields < 1)
+            continue;
+        for (int cpu = first; cpu <= (fields == 2 ? last : first); cpu++)
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+#ifdef IE_HAS_CPUID
+// the cores of the types the leaf 0x1A of CPUID reports for the processor the thread runs on
+const unsigned performanceCoreType = 0x40;
+const unsigned efficiencyCoreType = 0x20;
+
+bool isHybridCpu() {
+    unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+        return false;
+    return (edx & (1u << 15)) != 0;
+}
+
+// the kernels older than 5.13 don't describe the cores of the hybrid CPUs, so the type is asked on each processor
+void probeCoreTypes(std::vector<int>& performance, std::vector<int>& efficiency) {
+    cpu_set_t processMask;
+    CPU_ZERO(&processMask);
+    if (sched_getaffinity(0, sizeof(processMask), &processMask))
+        return;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (!CPU_ISSET(cpu, &processMask))
+            continue;
+        cpu_set_t cpuMask;
+        CPU_ZERO(&cpuMask);
+        CPU_SET(cpu, &cpuMask);
+        if (sched_setaffinity(0, sizeof(cpuMask), &cpuMask))
+            continue;
+        unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+        __cpuid_count(0x1A, 0, eax, ebx, ecx, edx);
+        if ((eax >> 24) == performanceCoreType)
+            performance.push_back(cpu);
+        else if ((eax >> 24) == efficiencyCoreType)
+            efficiency.push_back(cpu);
+    }
+    sched_setaffinity(0, sizeof(processMask), &processMask);
+}
+#endif
+
+struct HybridCores {
+    std::vector<int> performance;
+    std::vector<int> efficiency;
+
+    HybridCores() {
+        performance = readCpuList("/sys/devices/cpu_core/cpus");
+        efficiency = readCpuList("/sys/devices/cpu_atom/cpus");
+#ifdef IE_HAS_CPUID
+        if ((performance.empty() || efficiency.empty()) && isHybridCpu()) {
+            performance.clear();
+            efficiency.clear();
+            probeCoreTypes(performance, efficiency);
+        }
+#endif
+    }
+};
+
+}  // namespace
+
+bool getHybridCoreProcessors(std::vector<int>& performance, std::vector<int>& efficiency) {
+    static const HybridCores cores;
+    if (cores.performance.empty() || cores.efficiency.empty())
+        return false;
+
+    cpu_set_t processMask;
+    CPU_ZERO(&processMask);
+    sched_getaffinity(0, sizeof(processMask), &processMask);
+    auto available = [&](const std::vector<int>& cpus) {
+        std::vector<int> result;
+        for (int cpu : cpus) {
+            if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &processMask))
+                result.push_back(cpu);
+        }
+        return result;
+    };
+    performance = available(cores.performance);
+    efficiency = available(cores.efficiency);
+    return !performance.empty() && !efficiency.empty();
+}
+
 int getNumberOfCPUCores() {
     static CpuInfo cpuInfo;
     static Collection collection(&cpuInfo);
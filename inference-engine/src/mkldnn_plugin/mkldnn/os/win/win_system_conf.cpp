@@ -37,5 +37,11 @@ int getNumberOfCPUCores() {
 std::vector<int> getAvailableNUMANodes() { return std::vector<int>(1, 0); }
 #endif
 
+// memory placement is defined by the first touch, since pages can't be moved after allocation
+bool bindMemoryToNUMANode(void* data, size_t size, int numa_node) { return false; }
+
+// the threads are not pinned on the Windows, so the cores are not told apart
+bool getHybridCoreProcessors(std::vector<int>& performance, std::vector<int>& efficiency) { return false; }
+
 }  // namespace cpu
 }  // namespace MKLDNNPlugin
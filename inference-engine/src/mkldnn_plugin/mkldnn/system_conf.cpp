@@ -41,6 +41,8 @@ bool checkOpenMpEnvVars(bool includeOMPNumThreads) {
     // for Linux and Windows the getNumberOfCPUCores (that accounts only for physical cores) implementation is OS-specific
     // (see cpp files in corresponding folders), for __APPLE__ it is default :
     int getNumberOfCPUCores() { return parallel_get_max_threads();}
+    bool bindMemoryToNUMANode(void* data, size_t size, int numa_node) { return false; }
+    bool getHybridCoreProcessors(std::vector<int>& performance, std::vector<int>& efficiency) { return false; }
 #endif
 
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
@@ -8,6 +8,7 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <vector>
 namespace MKLDNNPlugin {
 namespace cpu {
@@ -18,6 +19,12 @@ std::vector<int> getAvailableNUMANodes();
 // numbers of CPU physical cores on Linux/Windows (which is considered to be more performance friendly for servers)
 // (on other OSes it simply relies on the original parallel API of choice, which usually uses the logical cores )
 int getNumberOfCPUCores();
+// moves pages of the memory region to the NUMA node and makes it preferable for pages touched later
+// (on Linux only, does nothing on other OSes and on single-node systems, returns true if the memory was bound)
+bool bindMemoryToNUMANode(void* data, size_t size, int numa_node);
+// logical processors of the performance and the efficiency cores of the hybrid CPUs, available to the process
+// (on Linux only, returns false on other OSes and on the CPUs with the cores of a single type)
+bool getHybridCoreProcessors(std::vector<int>& performance, std::vector<int>& efficiency);
 
 }  // namespace cpu
 }  // namespace MKLDNNPlugin
\ No newline at end of file
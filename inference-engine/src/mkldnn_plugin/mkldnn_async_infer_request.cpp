@@ -7,13 +7,22 @@
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
-                                                               const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor)
-        : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {}
+                                                               const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                                                               const InferenceEngine::ITaskExecutor::Ptr &preprocessExecutor)
+        : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor,
+                                                              preprocessExecutor) {}
 
 void MKLDNNPlugin::MKLDNNAsyncInferRequest::Infer_ThreadUnsafe() {
     InferUsingAsync();
 }
 
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::InferBatch_ThreadUnsafe(const InferenceEngine::BlobMap* inputs,
+                                                                    InferenceEngine::BlobMap* outputs, size_t count) {
+    _requestExecutor->runAndWait({[&] {
+        _syncRequest->InferBatch(inputs, outputs, count);
+    }});
+}
+
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
     StopAndWait();
 }
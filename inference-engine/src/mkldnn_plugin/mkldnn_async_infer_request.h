@@ -15,10 +15,15 @@ class MKLDNNAsyncInferRequest : virtual public InferenceEngine::AsyncInferReques
 public:
     MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
-                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                            const InferenceEngine::ITaskExecutor::Ptr &preprocessExecutor = nullptr);
 
     void Infer_ThreadUnsafe() override;
 
+    /* The whole batch is inferred by one task of the request executor, so the streams enter their graph once */
+    void InferBatch_ThreadUnsafe(const InferenceEngine::BlobMap* inputs, InferenceEngine::BlobMap* outputs,
+                                 size_t count) override;
+
     ~MKLDNNAsyncInferRequest() override;
 };
 
@@ -10,17 +10,27 @@
 #include "mkldnn_async_infer_request.h"
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
+#include "mkldnn_subpixel_deconv.h"
+#include "mkldnn_input_normalization.h"
 #include <ie_util_internal.hpp>
 #include <graph_tools.hpp>
 #include <cnn_network_int8_normalizer.hpp>
 #include <cpp_interfaces/ie_executor_manager.hpp>
+#include <cpu/cpu_config.hpp>
+#include <network_serializer.h>
+#include <pugixml.hpp>
 #include "low_precision_transformations/convolution.hpp"
 #include "low_precision_transformations/eltwise_cpu.hpp"
 #include "low_precision_transformations/fully_connected.hpp"
+#include "low_precision_transformations/resample.hpp"
 #include "low_precision_transformations/scaleshift_to_convolution.hpp"
 #include "low_precision_transformations/transformer.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <set>
 #include <unordered_set>
 
 using namespace MKLDNNPlugin;
@@ -39,28 +49,41 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 }
 
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
-                                     const Config &cfg,
-                                     const MKLDNNExtensionManager::Ptr& extMgr) : extensionManager(extMgr) {
+                                     const Config &config,
+                                     const MKLDNNExtensionManager::Ptr& extMgr,
+                                     bool imported) : extensionManager(extMgr) {
+    Config cfg = config;
     ICNNNetworkStats* pstats = nullptr;
     StatusCode s = network.getStats(&pstats, nullptr);
     // we are cloning network if we have statistics and we can transform network.
     auto clonedNetwork = cloneNet(network);
-
-    if (Precision::FP16 == network.getPrecision()) {
-        clonedNetwork->setPrecision(Precision::FP32);
+    if (!cfg.requestedOutputs.empty()) {
+        IE_PROFILING_AUTO_SCOPE(MKLDNNExecNetwork::PruneOutputs)
+        NetPass::PruneOutputs(*clonedNetwork, cfg.requestedOutputs);
+        requestedOutputs = cfg.requestedOutputs;
     }
 
-    // CPU Plugin doesn't natively support some precision like int64/fp16/bool
-    // so will convert all layer/tensors fp16->fp32 , bool->u8.
-    // Default int64->int32 conversion is already applied in IE common module.
-    NetPass::ConvertPrecision(*clonedNetwork, Precision::FP16, Precision::FP32);
-    NetPass::ConvertPrecision(*clonedNetwork, Precision::BOOL, Precision::U8);
+    {
+        IE_PROFILING_AUTO_SCOPE(MKLDNNExecNetwork::ConvertPrecision)
+        if (Precision::FP16 == network.getPrecision()) {
+            clonedNetwork->setPrecision(Precision::FP32);
+        }
+
+        // CPU Plugin doesn't natively support some precision like int64/fp16/bool
+        // so will convert all layer/tensors fp16->fp32 , bool->u8.
+        // Default int64->int32 conversion is already applied in IE common module.
+        NetPass::ConvertPrecision(*clonedNetwork, Precision::FP16, Precision::FP32);
+        NetPass::ConvertPrecision(*clonedNetwork, Precision::BOOL, Precision::U8);
+    }
 
-    if (s == StatusCode::OK && pstats && !pstats->isEmpty()) {
+    // an imported network is exported after the transformations, its statistics are already applied
+    if (!imported && s == StatusCode::OK && pstats && !pstats->isEmpty()) {
+        IE_PROFILING_AUTO_SCOPE(MKLDNNExecNetwork::NormalizeInt8)
         CNNNetworkInt8Normalizer cnnorm;
         cnnorm.NormalizeNetwork(*clonedNetwork, *pstats);
     } else {
-        if (cfg.lpTransformsMode == Config::LPTransformsMode::On) {
+        if (!imported && cfg.lpTransformsMode == Config::LPTransformsMode::On) {
+            IE_PROFILING_AUTO_SCOPE(MKLDNNExecNetwork::LowPrecisionTransformations)
             auto params = LayerTransformation::Params(true,  // updatePrecisions
                                                       true,  // quantizeOutputs
                                                       true,  // weightsToConst
@@ -72,6 +95,8 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
             LowPrecisionTransformer transformer(LowPrecisionTransformer::getAllTransformations(params).
                 addBranchSpecific<EltwiseCpuTransformation>(LayerTransformation::Params(params), "Eltwise").
                 add<ConvolutionTransformation>(LayerTransformation::Params(params).setPrecisionsOnActivations({ Precision::U8 }), "Convolution").
+                add<ResampleTransformation>(LayerTransformation::Params(params).setPrecisionsOnActivations({ Precision::U8 }), "Resample").
+                add<ResampleTransformation>(LayerTransformation::Params(params).setPrecisionsOnActivations({ Precision::U8 }), "Interp").
                 addCleanup<ScaleShiftToConvolutionTransformation>(
                     LayerTransformation::Params(params).setPrecisionsOnActivations({ Precision::U8 }),
                     "ScaleShift"));
@@ -80,38 +105,123 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     }
 
     MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*clonedNetwork));
+    {
+        IE_PROFILING_AUTO_SCOPE(MKLDNNExecNetwork::FoldInputNormalization)
+        FoldInputNormalization(*clonedNetwork);
+    }
+    // the pixel shuffle fixes the batch of the rewritten deconvolutions
+    if (cfg.subPixelDeconvolution && !cfg.enableDynamicBatch && !cfg.dynamicShapes) {
+        IE_PROFILING_AUTO_SCOPE(MKLDNNExecNetwork::ConvertSubPixelDeconvolutions)
+        ConvertSubPixelDeconvolutions(*clonedNetwork);
+    }
+    transformedNetwork = clonedNetwork;
 
     if (cfg.batchLimit > 1) {
         // check topology for applicability
-        if (!CanProcessDynBatch(*clonedNetwork)) {
-            THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
+        std::string reason;
+        if (!CanProcessDynBatch(*clonedNetwork, reason)) {
+            THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch! "
+                               << reason;
         }
     }
+    if (cfg.tuneStreams) {
+        IE_PROFILING_AUTO_SCOPE(MKLDNNExecNetwork::TuneStreams)
+        const int sockets = MKLDNNPlugin::cpu::getAvailableNUMANodes().size();
+        const int env_cores = parallel_get_env_threads();
+        const int cores = cfg.threadsNum ? cfg.threadsNum : (env_cores ? env_cores :
+                          (sockets == 1 ? parallel_get_max_threads() : getNumberOfCPUCores()));
+        auto estimate = estimate_streams(*clonedNetwork, cores);
+        cfg.throughputStreams = estimate.streams;
+        cfg.threadsNum = estimate.streams * estimate.threads_per_stream;
+        cfg.tuneStreams = false;
+        cfg._config.clear();
+        cfg.updateProperties();
+    }
+    if (cfg.dynamicShapes && (cfg.throughputStreams > 1 || cfg.enableDynamicBatch)) {
+        THROW_IE_EXCEPTION << CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES << " cannot be used together with "
+                           << PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS << " or "
+                           << PluginConfigParams::KEY_DYN_BATCH_ENABLED;
+    }
     // general #threads logic
     const int env_threads = parallel_get_env_threads();
     const auto& numa_nodes = MKLDNNPlugin::cpu::getAvailableNUMANodes();
     const auto numa_nodes_num = numa_nodes.size();
+
+    // the streams are reduced to the ones fitting the memory budget. The footprint is measured on a probe graph, which
+    // is kept until the streams are loaded, so the streams of its NUMA node share its weights instead of reordering them
+    MKLDNNGraph::Ptr probeGraph;
+    if (cfg.memoryBudget > 0) {
+        IE_PROFILING_AUTO_SCOPE(MKLDNNExecNetwork::FitMemoryBudget)
+        probeGraph = std::make_shared<MKLDNNGraph>();
+        probeGraph->setConfig(cfg);
+        probeGraph->CreateArenaWithObserverAndLoadGraph(parallel_get_max_threads(), numa_nodes[0], 0,
+                Config::InferenceThreadsBinding::NONE, clonedNetwork, extensionManager);
+
+        uint64_t constBytes = 0, scratchBytes = 0;
+        std::unordered_set<const MKLDNNMemory*> counted;
+        probeGraph->GetMemoryFootprint(constBytes, scratchBytes, counted);
+        // the weights are reordered once per NUMA node the streams are pinned to
+        auto footprint = [&](int streams) {
+            const int perSocket = static_cast<int>(std::ceil(static_cast<float>(streams) / numa_nodes_num));
+            const int sockets = (streams + perSocket - 1) / perSocket;
+            return constBytes * sockets + scratchBytes * streams;
+        };
+        int streams = cfg.throughputStreams;
+        while (streams > 0 && footprint(streams) > cfg.memoryBudget)
+            streams--;
+        if (streams == 0) {
+            THROW_IE_EXCEPTION << "The network needs " << footprint(1) << " bytes, which exceeds "
+                               << PluginConfigParams::KEY_MEMORY_BUDGET << " of " << cfg.memoryBudget << " bytes";
+        }
+        if (streams != cfg.throughputStreams) {
+            cfg.throughputStreams = streams;
+            cfg._config.clear();
+            cfg.updateProperties();
+        }
+    }
+
     // use logical cores only for single-socket targets in throughput mode
     const int hw_cores = cfg.throughputStreams > 1 && numa_nodes_num == 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
 
     const int threads = cfg.threadsNum ? cfg.threadsNum : (env_threads ? env_threads : hw_cores);
     const int threads_per_stream = std::max(1, threads/cfg.throughputStreams);
 
+    // the streams of the hybrid CPUs are pinned to the cores of one type, sized for the speed of the type
+    std::vector<stream_placement> placements;
+    if (cfg.useThreadBinding == Config::InferenceThreadsBinding::CORES)
+        placements = place_hybrid_streams(cfg.throughputStreams, threads_per_stream * cfg.throughputStreams);
+
+    // the networks pinning their threads to cores get different cores while there are vacant ones
+#if !(defined(__APPLE__) || defined(_WIN32))
+    int ncpus = 0;
+    cpu_set_t *process_mask = nullptr;
+    if (cfg.useThreadBinding == Config::InferenceThreadsBinding::CORES && placements.empty() &&
+        get_process_mask(ncpus, process_mask)) {
+        const int process_cpus = CPU_COUNT_S(CPU_ALLOC_SIZE(ncpus), process_mask);
+        CPU_FREE(process_mask);
+        reservedCores = threads_per_stream * cfg.throughputStreams;
+        firstCore = ExecutorManager::getInstance()->reserveCores(reservedCores, process_cpus);
+    }
+#endif
+
     // graph(s) initialization in taskExecutor threads (streams), in parallel (in case of streams)
     std::vector<Task> tasks;
+    LoadProfile* loadProfile = LoadProfile::current();
     const int workers_per_socket = std::max(1,
             static_cast<int>(std::ceil(static_cast<float>(cfg.throughputStreams)/numa_nodes_num)));
     for (int n = 0; n < cfg.throughputStreams; n++) {
         MKLDNNGraph::Ptr _graph = std::make_shared<MKLDNNGraph>();
         graphs.push_back(_graph);
+        const stream_placement placement = placements.empty() ? stream_placement{{}, n, threads_per_stream} : placements[n];
         tasks.push_back([=, &cfg, &clonedNetwork]() {
+        LoadProfile::Bind bindLoadProfile(loadProfile);
         _graph->setConfig(cfg);
          const int node = n / workers_per_socket;
          if (cfg.useThreadBinding)
             pin_current_thread_to_socket(numa_nodes[node]);
-        _graph->CreateArenaWithObserverAndLoadGraph(threads_per_stream, numa_nodes[node], n,
+        _graph->CreateArenaWithObserverAndLoadGraph(placement.threads, numa_nodes[node], placement.index,
                 cfg.useThreadBinding,
-                clonedNetwork, extensionManager);
+                clonedNetwork, extensionManager, firstCore, placement.processors);
         if (cfg.throughputStreams > 1)  // for streams, each worker thread has it's own graph
             MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph = _graph;
         });
@@ -129,6 +239,28 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         _taskExecutor->runAndWait(tasks);
     }
 
+    if (cfg.preprocessingThreads > 0) {
+        // the pre-processing workers have no initialization, they do not use the graphs
+        std::vector<Task> preprocessTasks(cfg.preprocessingThreads, [] {});
+        preprocessExecutor = std::make_shared<MultiWorkerTaskExecutor>(preprocessTasks, "CPUPreprocessing");
+    }
+
+    waitSpinTime = cfg.waitSpinTime;
+
+    if (cfg.dynamicShapes) {
+        dynamicNetwork = clonedNetwork;
+        dynamicConfig = cfg;
+        dynamicThreadsPerStream = threads_per_stream;
+        dynamicNumaNode = numa_nodes[0];
+
+        InputsDataMap inputs;
+        clonedNetwork->getInputsInfo(inputs);
+        ICNNNetwork::InputShapes shapes;
+        for (auto &input : inputs)
+            shapes[input.first] = input.second->getTensorDesc().getDims();
+        shapedGraphs[shapes] = {graphs[0], 0};
+    }
+
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
@@ -149,6 +281,58 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     }
 }
 
+MKLDNNGraph::Ptr MKLDNNExecNetwork::GetGraphForShapes(const ICNNNetwork::InputShapes &shapes) {
+    if (!dynamicNetwork)
+        THROW_IE_EXCEPTION << "Input dims differ from the network ones, but " << CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES
+                           << " is not enabled";
+
+    std::lock_guard<std::mutex> lock(shapedGraphsMutex);
+    auto found = shapedGraphs.find(shapes);
+    if (found != shapedGraphs.end()) {
+        found->second.lastUse = ++shapedGraphsUseCounter;
+        return found->second.graph;
+    }
+
+    // shape inference and compilation run only for dims which were not met yet, weights are shared across graphs
+    auto network = cloneNet(*dynamicNetwork);
+    ResponseDesc resp;
+    if (network->reshape(shapes, &resp) != StatusCode::OK)
+        THROW_IE_EXCEPTION << "Cannot reshape network for new input dims: " << resp.msg;
+
+    auto graph = std::make_shared<MKLDNNGraph>();
+    graph->setConfig(dynamicConfig);
+    graph->CreateArenaWithObserverAndLoadGraph(dynamicThreadsPerStream, dynamicNumaNode, 0,
+                                               dynamicConfig.useThreadBinding, network, extensionManager, firstCore);
+
+    const size_t maxShapedGraphs = 16;
+    if (shapedGraphs.size() >= maxShapedGraphs) {
+        // requests which still use the dropped graph keep it alive
+        auto lru = std::min_element(shapedGraphs.begin(), shapedGraphs.end(),
+                                    [](const std::pair<const ICNNNetwork::InputShapes, ShapedGraph> &lhs,
+                                       const std::pair<const ICNNNetwork::InputShapes, ShapedGraph> &rhs) {
+                                        return lhs.second.lastUse < rhs.second.lastUse;
+                                    });
+        shapedGraphs.erase(lru);
+    }
+    shapedGraphs[shapes] = {graph, ++shapedGraphsUseCounter};
+    return graph;
+}
+
+MKLDNNExecNetwork::~MKLDNNExecNetwork() {
+    graphs.clear();
+    extensionManager.reset();
+    if (reservedCores)
+        ExecutorManager::getInstance()->releaseCores(firstCore, reservedCores);
+}
+
+void MKLDNNExecNetwork::setNetworkOutputs(const InferenceEngine::OutputsDataMap networkOutputs) {
+    _networkOutputs.clear();
+    for (const auto& output : networkOutputs) {
+        if (requestedOutputs.empty() || requestedOutputs.find(output.first) != requestedOutputs.end())
+            _networkOutputs.insert(output);
+    }
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     for (auto g : graphs)
         g->setProperty(properties);
@@ -157,7 +341,9 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) {
     auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
-    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor);
+    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor,
+                                                                      preprocessExecutor);
+    asyncRequestImpl->SetWaitSpinTime(std::chrono::microseconds(waitSpinTime));
     asyncRequest.reset(new InferRequestBase<MKLDNNAsyncInferRequest>(asyncRequestImpl),
                        [](IInferRequest *p) { p->Release(); });
 
@@ -186,6 +372,7 @@ void MKLDNNExecNetwork::GetConfig(const std::string &name, Parameter &result, Re
 }
 
 void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, ResponseDesc *resp) const {
+    auto streamsExecutor = std::dynamic_pointer_cast<MultiWorkerTaskExecutor>(_taskExecutor);
     if (name == METRIC_KEY(NETWORK_NAME)) {
         result = IE_SET_METRIC(NETWORK_NAME, graphs[0]->dump()->getName());
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
@@ -194,6 +381,20 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(MEMORY_FOOTPRINT));
+        metrics.push_back(CPU_METRIC(MEMORY_PER_NUMA_NODE));
+        metrics.push_back(CPU_METRIC(ZERO_COPY_PORTS));
+        metrics.push_back(CPU_METRIC(SAMPLED_PERF_COUNTERS));
+        metrics.push_back(CPU_METRIC(ELIMINATED_REORDERS));
+        metrics.push_back(CPU_METRIC(REFERENCE_REORDERS));
+        if (_loadProfile)
+            metrics.push_back(METRIC_KEY(LOAD_NETWORK_PROFILE));
+        if (streamsExecutor) {
+            metrics.push_back(CPU_METRIC(STREAMS_QUEUE_DEPTH));
+            metrics.push_back(CPU_METRIC(STREAMS_AVERAGE_WAIT_TIME));
+            metrics.push_back(CPU_METRIC(STREAMS_MAX_WAIT_TIME));
+            metrics.push_back(CPU_METRIC(STREAMS_AVERAGE_WAIT_TIME_PER_PRIORITY));
+        }
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -206,33 +407,131 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         auto option = engConfig._config.find(CONFIG_KEY(CPU_THROUGHPUT_STREAMS));
         IE_ASSERT(option != engConfig._config.end());
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(std::stoi(option->second)));
+    } else if (name == METRIC_KEY(MEMORY_FOOTPRINT)) {
+        uint64_t constBytes = 0, scratchBytes = 0, scratchPerStream = 0;
+        std::unordered_set<const MKLDNNMemory*> counted;
+        for (auto &graph : graphs) {
+            uint64_t graphScratch = 0;
+            graph->GetMemoryFootprint(constBytes, graphScratch, counted);
+            scratchBytes += graphScratch;
+            scratchPerStream = std::max(scratchPerStream, graphScratch);
+        }
+        // all the memory is allocated while the graphs are loaded, so it is used at once
+        result = IE_SET_METRIC(MEMORY_FOOTPRINT, std::map<std::string, uint64_t>({
+            {"CONST", constBytes}, {"SCRATCH", scratchBytes}, {"SCRATCH_PER_STREAM", scratchPerStream},
+            {"PEAK", constBytes + scratchBytes}}));
+    } else if (name == CPU_METRIC(MEMORY_PER_NUMA_NODE)) {
+        std::map<int, uint64_t> memory;
+        std::unordered_set<const MKLDNNMemory*> counted;
+        for (auto &graph : graphs)
+            graph->GetMemoryPerNUMANode(memory, counted);
+        result = IE_SET_METRIC(CPU_MEMORY_PER_NUMA_NODE, memory);
+    } else if (name == CPU_METRIC(ZERO_COPY_PORTS)) {
+        std::set<std::string> ports;
+        for (auto &graph : graphs)
+            graph->GetZeroCopyPorts(ports);
+        result = IE_SET_METRIC(CPU_ZERO_COPY_PORTS, std::vector<std::string>(ports.begin(), ports.end()));
+    } else if (name == CPU_METRIC(SAMPLED_PERF_COUNTERS)) {
+        std::map<std::string, std::vector<uint64_t>> histograms;
+        for (auto &graph : graphs)
+            graph->GetSampledPerfData(histograms);
+        result = IE_SET_METRIC(CPU_SAMPLED_PERF_COUNTERS, histograms);
+    } else if (name == CPU_METRIC(ELIMINATED_REORDERS)) {
+        // the graphs of the streams are built from the same network, so their layouts are the same and the count
+        // of the first one is reported rather than the sum over the streams
+        result = IE_SET_METRIC(CPU_ELIMINATED_REORDERS, static_cast<unsigned int>(graphs[0]->GetEliminatedReorders()));
+    } else if (name == CPU_METRIC(REFERENCE_REORDERS)) {
+        std::set<std::string> reorders;
+        for (auto &graph : graphs)
+            graph->GetReferenceReorders(reorders);
+        result = IE_SET_METRIC(CPU_REFERENCE_REORDERS, std::vector<std::string>(reorders.begin(), reorders.end()));
+    } else if (_loadProfile && name == METRIC_KEY(LOAD_NETWORK_PROFILE)) {
+        result = IE_SET_METRIC(LOAD_NETWORK_PROFILE, _loadProfile->get());
+    } else if (streamsExecutor && name == CPU_METRIC(STREAMS_QUEUE_DEPTH)) {
+        result = IE_SET_METRIC(CPU_STREAMS_QUEUE_DEPTH, static_cast<unsigned int>(streamsExecutor->getQueueDepth()));
+    } else if (streamsExecutor && name == CPU_METRIC(STREAMS_AVERAGE_WAIT_TIME)) {
+        result = IE_SET_METRIC(CPU_STREAMS_AVERAGE_WAIT_TIME, streamsExecutor->getAverageWaitTime());
+    } else if (streamsExecutor && name == CPU_METRIC(STREAMS_MAX_WAIT_TIME)) {
+        result = IE_SET_METRIC(CPU_STREAMS_MAX_WAIT_TIME, streamsExecutor->getMaxWaitTime());
+    } else if (streamsExecutor && name == CPU_METRIC(STREAMS_AVERAGE_WAIT_TIME_PER_PRIORITY)) {
+        std::map<std::string, float> waitTimes;
+        for (auto&& waitTime : streamsExecutor->getAverageWaitTimePerPriority())
+            waitTimes[std::to_string(waitTime.first)] = waitTime.second;
+        result = IE_SET_METRIC(CPU_STREAMS_AVERAGE_WAIT_TIME_PER_PRIORITY, waitTimes);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
 }
 
-bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const {
+bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network, std::string &reason) const {
     InputsDataMap inputs;
     network.getInputsInfo(inputs);
 
     CNNLayerSet inputLayers;
     std::unordered_set<CNNLayer *> allLayers;
 
-    if (inputs.empty())
+    if (inputs.empty()) {
+        reason = "The network has no inputs";
         return false;
+    }
 
     auto & secondLayers = inputs.begin()->second->getInputData()->getInputTo();
-    if (secondLayers.empty())
+    if (secondLayers.empty()) {
+        reason = "The input " + inputs.begin()->first + " is not used by the layers";
         return false;
+    }
+
+    // the layers of the extensions take the reduced batch when one of their configurations supports it,
+    // the function returns false for the layers the extensions don't implement
+    auto extensionSupport = [&](const CNNLayerPtr& layer, bool& supported) {
+        std::unique_ptr<ILayerImplFactory> factory(extensionManager ? extensionManager->CreateExtensionFactory(layer) : nullptr);
+        if (!factory)
+            return false;
+        supported = false;
+        std::vector<ILayerImpl::Ptr> impls;
+        ResponseDesc resp;
+        if (factory->getImplementations(impls, &resp) != OK)
+            return true;
+        for (const auto& impl : impls) {
+            std::vector<LayerConfig> configs;
+            if (impl && impl->getSupportedConfigurations(configs, &resp) == OK) {
+                for (const auto& config : configs)
+                    supported = supported || config.dynBatchSupport;
+            }
+        }
+        return true;
+    };
 
     bool check_result = true;
     details::UnorderedDFS(allLayers, secondLayers.begin()->second, [&](CNNLayerPtr layer) {
+        if (!check_result)
+            return;
         auto type = TypeFromName(layer->type);
+        bool supported = false;
+        if (extensionSupport(layer, supported)) {
+            if (!supported) {
+                reason = "The extension layer " + layer->name + " of type " + layer->type +
+                         " has no configurations supporting the dynamic batch";
+                check_result = false;
+            }
+            return;
+        }
+
         // This is WA for Tile layer
         auto tileLayer = dynamic_cast<TileLayer *>(layer.get());
         if (tileLayer && tileLayer->axis)
             return;
 
+        // the permutations keeping the batch in place permute every batch item on its own
+        if (type == Permute) {
+            auto order = layer->GetParamAsInts("order", {});
+            if (!order.empty() && order[0] != 0) {
+                reason = "The layer " + layer->name + " of type " + layer->type + " moves the batch dimension";
+                check_result = false;
+            }
+            return;
+        }
+
         if (type != Input &&
             type != Output &&
             type != Convolution &&
@@ -250,7 +549,9 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::ICNNNetwork &n
             type != Eltwise &&
             type != Crop &&
             type != BatchNormalization &&
+            type != Quantize &&
             type != Copy) {
+            reason = "The layer " + layer->name + " of type " + layer->type + " does not support the dynamic batch";
             check_result = false;
         }
     }, false);
@@ -261,3 +562,59 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::ICNNNetwork &n
 std::vector<IMemoryStateInternal::Ptr> MKLDNNExecNetwork::QueryState() {
     return memoryStates;
 }
+
+void MKLDNNExecNetwork::Export(const std::string &modelFileName) {
+    std::ofstream modelFile(modelFileName, std::ios::out | std::ios::binary);
+    if (!modelFile.is_open())
+        THROW_IE_EXCEPTION << "Cannot open file " << modelFileName << " to export the network";
+    Export(modelFile);
+}
+
+void MKLDNNExecNetwork::ExportImpl(std::ostream &networkModel) {
+    // the header keeps what the IR does not: the config and the user precisions and layouts of the inputs and outputs
+    pugi::xml_document header;
+    auto cpuNode = header.append_child("cpu");
+
+    auto inputsNode = cpuNode.append_child("inputs");
+    for (auto &&input : _networkInputs) {
+        auto inputNode = inputsNode.append_child("input");
+        inputNode.append_attribute("name").set_value(input.first.c_str());
+        inputNode.append_attribute("precision").set_value(input.second->getPrecision().name());
+        inputNode.append_attribute("layout").set_value(static_cast<int>(input.second->getLayout()));
+    }
+
+    OutputsDataMap transformedOutputs;
+    transformedNetwork->getOutputsInfo(transformedOutputs);
+    auto outputsNode = cpuNode.append_child("outputs");
+    for (auto &&output : _networkOutputs) {
+        auto found = transformedOutputs.find(output.first);
+        IE_ASSERT(found != transformedOutputs.end());
+        auto creator = found->second->getCreatorLayer().lock();
+        IE_ASSERT(creator != nullptr);
+        auto index = std::distance(creator->outData.begin(),
+                                   std::find(creator->outData.begin(), creator->outData.end(), found->second));
+
+        auto outputNode = outputsNode.append_child("output");
+        outputNode.append_attribute("name").set_value(output.first.c_str());
+        outputNode.append_attribute("creatorName").set_value(creator->name.c_str());
+        outputNode.append_attribute("index").set_value(std::to_string(index).c_str());
+        outputNode.append_attribute("precision").set_value(output.second->getPrecision().name());
+        outputNode.append_attribute("layout").set_value(static_cast<int>(output.second->getLayout()));
+    }
+
+    auto configsNode = cpuNode.append_child("configs");
+    for (auto &&config : graphs[0]->getProperty()._config) {
+        auto configNode = configsNode.append_child("config");
+        configNode.append_attribute("key").set_value(config.first.c_str());
+        configNode.append_attribute("value").set_value(config.second.c_str());
+    }
+    header.save(networkModel, nullptr, pugi::format_raw);
+    networkModel << std::endl;
+
+    pugi::xml_document doc;
+    auto dataSize = static_cast<std::uint64_t>(NetworkSerializer::fillXmlDoc(*transformedNetwork, doc));
+    doc.save(networkModel, nullptr, pugi::format_raw);
+    networkModel << std::endl;
+    networkModel.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    NetworkSerializer::serializeBlobs(networkModel, *transformedNetwork);
+}
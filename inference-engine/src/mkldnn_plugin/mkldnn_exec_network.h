@@ -12,6 +12,8 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <mutex>
+#include <set>
 #include <string>
 
 namespace MKLDNNPlugin {
@@ -26,13 +28,19 @@ public:
 
     void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
 
+    /**
+     * @param imported The network is read from an exported one, so it is already transformed to the CPU
+     * precisions and quantization and only the graph compilation is run
+     */
     MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr& extMgr);
+                      const MKLDNNExtensionManager::Ptr& extMgr, bool imported = false);
 
-    virtual ~MKLDNNExecNetwork() {
-        graphs.clear();
-        extensionManager.reset();
-    }
+    virtual ~MKLDNNExecNetwork();
+
+    /**
+     * @brief Keeps only the outputs of CPUConfigParams::KEY_CPU_REQUESTED_OUTPUTS, the others are pruned from the graphs
+     */
+    void setNetworkOutputs(const InferenceEngine::OutputsDataMap networkOutputs) override;
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -44,12 +52,50 @@ public:
 
     std::vector<IMemoryStateInternal::Ptr> QueryState() override;
 
+    using InferenceEngine::ExecutableNetworkInternal::Export;
+
+    void Export(const std::string &modelFileName) override;
+
+    void ExportImpl(std::ostream &networkModel) override;
+
+    /**
+     * @brief Returns a graph compiled for the given input dims, available only if dynamic shapes are enabled
+     * @param shapes Dims of all network inputs
+     * @return A graph which is either taken from the cache or reshaped and compiled for the dims
+     */
+    MKLDNNGraph::Ptr GetGraphForShapes(const InferenceEngine::ICNNNetwork::InputShapes &shapes);
+
 protected:
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<MKLDNNGraph::Ptr> graphs;
     std::vector<IMemoryStateInternal::Ptr> memoryStates;
-
-    bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
+    // runs the input pre-processing stage of the requests, if separate pre-processing threads are requested
+    InferenceEngine::ITaskExecutor::Ptr preprocessExecutor;
+    // microseconds the requests poll their completion in Wait() before blocking
+    int waitSpinTime = 0;
+    // the cores the stream threads are pinned to, reserved process-wide to not share them with other networks
+    int firstCore = 0;
+    int reservedCores = 0;
+    // the outputs kept in the graphs, empty if all the outputs are kept
+    std::set<std::string> requestedOutputs;
+    // the network after the precision conversions and the low precision transformations, it is exported
+    std::shared_ptr<InferenceEngine::ICNNNetwork> transformedNetwork;
+
+    // state required to compile the network for new input dims in the dynamic shapes mode
+    struct ShapedGraph {
+        MKLDNNGraph::Ptr graph;
+        uint64_t lastUse;
+    };
+    std::shared_ptr<InferenceEngine::ICNNNetwork> dynamicNetwork;
+    Config dynamicConfig;
+    int dynamicThreadsPerStream = 0;
+    int dynamicNumaNode = 0;
+    std::map<InferenceEngine::ICNNNetwork::InputShapes, ShapedGraph> shapedGraphs;
+    uint64_t shapedGraphsUseCounter = 0;
+    std::mutex shapedGraphsMutex;
+
+    // reason tells the first layer which does not process the reduced batch, if any
+    bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network, std::string &reason) const;
 };
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
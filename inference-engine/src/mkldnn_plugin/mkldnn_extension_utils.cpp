@@ -17,6 +17,8 @@ uint8_t MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type dataType)
         return 4;
     case mkldnn::memory::data_type::s16:
         return 2;
+    case mkldnn::memory::data_type::bf16:
+        return 2;
     case mkldnn::memory::data_type::s8:
         return 1;
     case mkldnn::memory::data_type::u8:
@@ -35,6 +37,8 @@ memory::data_type MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::P
     switch (prec) {
         case InferenceEngine::Precision::FP32:
             return memory::f32;
+        case InferenceEngine::Precision::BF16:
+            return memory::bf16;
         case InferenceEngine::Precision::I32:
             return memory::s32;
         case InferenceEngine::Precision::I16:
@@ -57,6 +61,8 @@ InferenceEngine::Precision MKLDNNExtensionUtils::DataTypeToIEPrecision(memory::d
     switch (dataType) {
         case memory::f32:
             return InferenceEngine::Precision(InferenceEngine::Precision::FP32);
+        case memory::bf16:
+            return InferenceEngine::Precision::BF16;
         case memory::s32:
             return InferenceEngine::Precision::I32;
         case memory::s16:
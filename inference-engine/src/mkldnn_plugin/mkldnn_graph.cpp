@@ -11,16 +11,20 @@
 #include <fstream>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
+#include <exception>
 #include <utility>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
 #include "mkldnn_graph_optimizer.h"
+#include "mkldnn_layout_assignment.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_memory_solver.hpp"
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
+#include <nodes/mkldnn_fullyconnected_node.h>
 
 #include <debug.h>
 #include <graph_tools.hpp>
@@ -36,6 +40,7 @@
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include <cpu_isa_traits.hpp>
 
 #define XBYAK_NO_OP_NAMES
 #define XBYAK_UNDEF_JNL
@@ -70,9 +75,26 @@ using namespace MKLDNNPlugin::cpu;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+
+// The largest number of layers an unrolled TensorIterator gives, the bigger ones are unrolled partially
+constexpr size_t maxUnrolledTILayers = 128;
+
+void unrollTensorIterators(ICNNNetwork &net) {
+    NetPass::UnrollTI(net, maxUnrolledTILayers);
+}
+
+void unrollTensorIterators(TensorIterator::Body &) {
+    // the nested iterators stay loops
+}
+
+}  // namespace
+
 template<typename NET>
 void MKLDNNGraph::ApplyUnrollPasses(NET &net) {
+    IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::ApplyUnrollPasses)
     NetPass::CombineRNNSeq(net);
+    unrollTensorIterators(net);
     bool ti_proc_ok = NetPass::UnrollRNN_if(net, [] (const RNNCellBase &rnn) -> bool {
         if (rnn.clip != 0.0f)
             return true;
@@ -212,6 +234,7 @@ void MKLDNNGraph::Replicate(const TensorIterator::Body &subgraph, const MKLDNNEx
 }
 
 void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr) {
+    IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::Replicate)
     InputsDataMap inputs;
     network.getInputsInfo(inputs);
     if (inputs.empty()) {
@@ -334,26 +357,46 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
 }
 
 void MKLDNNGraph::InitGraph() {
-    SortTopologically();
     MKLDNNGraphOptimizer optimizer;
-    optimizer.ApplyCommonGraphOptimizations(*this);
-    SortTopologically();
+    {
+        IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::ApplyCommonGraphOptimizations)
+        SortTopologically();
+        optimizer.ApplyCommonGraphOptimizations(*this);
+        SortTopologically();
+    }
 
-    InitNodes();
+    {
+        IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::SelectPrimitiveDescriptors)
+        InitNodes();
 
-    for (auto &node : graphNodes) {
-        node->initOptimalPrimitiveDescriptor();
+        for (auto &node : graphNodes) {
+            node->initOptimalPrimitiveDescriptor();
+        }
     }
-    InitEdges();
 
-    optimizer.ApplyImplSpecificGraphOptimizations(*this);
+    {
+        IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::InitEdges)
+        InitEdges();
+    }
 
-    SortTopologically();
+    {
+        IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::ApplyImplSpecificGraphOptimizations)
+        optimizer.ApplyImplSpecificGraphOptimizations(*this);
 
-    Allocate();
+        SortTopologically();
+
+        InitExecutionWaves();
+    }
+
+    {
+        IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::Allocate)
+        Allocate();
+    }
 
     CreatePrimitives();
 
+    AllocateScratchpad();
+
     // Do it before cleanup. Because it will lose original layers information
     for (auto &graphNode : graphNodes) {
         auto nodeType = graphNode->getType();
@@ -398,6 +441,13 @@ void MKLDNNGraph::InitGraph() {
     }
 #endif
 
+    for (auto &input : inputNodes) {
+        if (!input.second->isConstant())
+            zeroCopyPorts[input.first] = false;
+    }
+    for (auto &output : outputNodes)
+        zeroCopyPorts[output->getName().substr(4)] = false;
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
     for (auto &graphNode : graphNodes) {
         if (!graphNode->isConstant())
@@ -406,8 +456,59 @@ void MKLDNNGraph::InitGraph() {
     }
 }
 
+void MKLDNNGraph::InitExecutionWaves() {
+    executionWaves.clear();
+    if (!config.parallelBranches)
+        return;
+
+    for (auto &node : graphNodes) {
+        // MemoryOutput stores data for MemoryInput of the next inference, so there is a hidden
+        // dependency between them which is not represented by edges
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            return;
+    }
+
+    // Nodes are sorted topologically, so a wave of all parents is already known. Constant nodes are
+    // executed once during loading, so they don't delay their children.
+    std::unordered_map<MKLDNNNode*, int> waveOf;
+    for (auto &node : graphNodes) {
+        if (node->isConstant())
+            continue;
+
+        int wave = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            auto parentWave = waveOf.find(parent.get());
+            if (parentWave != waveOf.end())
+                wave = std::max(wave, parentWave->second + 1);
+        }
+        waveOf[node.get()] = wave;
+
+        if (executionWaves.size() <= wave)
+            executionWaves.resize(wave + 1);
+        executionWaves[wave].push_back(node);
+    }
+
+    // there is nothing to execute concurrently, so keep the regular execution which has better memory reuse
+    bool hasBranches = std::any_of(executionWaves.begin(), executionWaves.end(),
+                                   [](const std::vector<MKLDNNNodePtr> &wave) { return wave.size() > 1; });
+    if (!hasBranches)
+        executionWaves.clear();
+}
+
 void MKLDNNGraph::InitNodes() {
+    // the BF16 kernels are emulated without the AVX-512 BF16 instructions, which is slower than FP32
+    const bool bf16Enabled = config.enforceBF16 && mkldnn::impl::cpu::mayiuse(mkldnn::impl::cpu::avx512_core_bf16);
+
     for (auto &node : graphNodes) {
+        node->enableBF16(bf16Enabled);
+        if (node->getType() == FullyConnected) {
+            auto *fcNode = dynamic_cast<MKLDNNFullyConnectedNode *>(node.get());
+            if (fcNode) {
+                fcNode->setWeightsCompression(config.weightsCompression);
+                fcNode->setSparseWeightsThreshold(config.sparseWeightsThreshold);
+            }
+        }
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
         if (node->getType() == Input && _meanImages.find(node->getName()) != _meanImages.end()) {
             auto *inputNode = dynamic_cast<MKLDNNInputNode *>(node.get());
@@ -423,6 +524,12 @@ void MKLDNNGraph::InitNodes() {
     for (auto &node : graphNodes) {
         node->selectOptimalPrimitiveDescriptor();
     }
+
+    eliminatedReorders = 0;
+    if (config.layoutAssignment) {
+        IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::LayoutAssignment)
+        eliminatedReorders = MKLDNNLayoutAssignment(graphNodes).Run();
+    }
 }
 
 void MKLDNNGraph::InitEdges() {
@@ -565,6 +672,45 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
     //======= End of WA ============
 
+    // Live time of data is measured in execution steps. For the parallel execution a step is a wave:
+    // all nodes of a wave may run at once, so data produced or consumed within the same wave never share memory.
+    std::unordered_map<MKLDNNNode*, int> waveOf;
+    for (int i = 0; i < executionWaves.size(); i++)
+        for (auto &node : executionWaves[i])
+            waveOf[node.get()] = i;
+
+    auto getExecStep = [&](const MKLDNNNodePtr &node) {
+        if (executionWaves.empty())
+            return node->execIndex;
+        // constant nodes are executed before the first wave
+        auto wave = waveOf.find(node.get());
+        return wave != waveOf.end() ? wave->second : 0;
+    };
+
+    // The lookup tables of the embeddings are only read by the lookups, so they are served right from the weights
+    // of the network, which are shared by all the streams, instead of a copy in the workspace of every stream.
+    auto getSharedConstData = [](const std::vector<MKLDNNEdgePtr> &claster) -> const void* {
+        const void* data = nullptr;
+        for (auto &edge : claster) {
+            auto parentLayer = edge->getParent()->getCnnLayer();
+            auto childLayer = edge->getChild()->getCnnLayer();
+            if (edge->getParent()->getType() != Input || !parentLayer || parentLayer->blobs.size() != 1 || !childLayer)
+                return nullptr;
+            bool isLookupTable = (childLayer->type == "Gather" && edge->getOutputNum() == 0) ||
+                    ((childLayer->type == "ExperimentalSparseWeightedSum" ||
+                      childLayer->type == "ExperimentalSparseWeightedMean") && edge->getOutputNum() == 3);
+            auto blob = parentLayer->blobs.begin()->second;
+            if (!isLookupTable || !blob || blob->getTensorDesc() != edge->getDesc())
+                return nullptr;
+            data = blob->cbuffer().as<const void*>();
+        }
+        return data;
+    };
+
+    std::vector<const void*> sharedConstData(edge_clasters.size());
+    for (int i = 0; i < edge_clasters.size(); i++)
+        sharedConstData[i] = getSharedConstData(edge_clasters[i]);
+
     const int64_t alignment = 32;  // 32 bytes
 
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
@@ -572,8 +718,8 @@ void MKLDNNGraph::AllocateWithReuse() {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clasters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = getExecStep(edge->getParent());
+            int e_finish = getExecStep(edge->getChild());
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -621,20 +767,33 @@ void MKLDNNGraph::AllocateWithReuse() {
             }
         }
 
-        box.size = div_up(box.size, alignment);
+        box.size = sharedConstData[i] ? 0 : div_up(box.size, alignment);
     }
 
     MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    size_t total_size = static_cast<size_t>(memSolver.solve(MemorySolver::Strategy::Auto)) * alignment;
+
+#if !defined(NDEBUG) && defined(PRINT_GRAPH_INFO)
+    std::cout << "workspace: " << total_size << " bytes, lower bound: " << memSolver.maxDepth() * alignment
+              << " bytes, fragmentation: " << memSolver.fragmentation() << std::endl;
+#endif
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
+    // place intermediate tensors near to threads of the stream before they are touched
+    bindMemoryToNUMANode(workspace_ptr, total_size, socket);
 
     for (int i = 0; i < edge_clasters.size(); i++) {
         int count = 0;
         for (auto &edge : edge_clasters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
+                if (sharedConstData[i]) {
+                    edge->allocate(sharedConstData[i]);
+                    count++;
+                    continue;
+                }
+
                 int64_t offset = memSolver.getOffset(i);
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
@@ -670,15 +829,72 @@ void MKLDNNGraph::Allocate() {
 }
 
 void MKLDNNGraph::CreatePrimitives() { IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::CreatePrimitives)
-    bool weights_caching = config.throughputStreams != 1;
+    // Some nodes read the data of their constant parents (weights, shapes) while creating the primitives and the
+    // constant inputs copy their blobs, so a node is created after all its parents. Nodes of one level are independent
+    // and are created concurrently: most of the loading time is spent on JIT code generation and weight reorders.
+    std::vector<std::vector<MKLDNNNodePtr>> levels;
+    std::unordered_map<MKLDNNNode*, size_t> levelOf;
     for (auto& node : graphNodes) {
-        // disable caching if graph was created only once
-        node->enableWeightCaching(weights_caching);
+        size_t level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parentLevel = levelOf.find(node->getParentEdgeAt(i)->getParent().get());
+            if (parentLevel != levelOf.end())
+                level = std::max(level, parentLevel->second + 1);
+        }
+        levelOf[node.get()] = level;
+
+        if (levels.size() <= level)
+            levels.resize(level + 1);
+        levels[level].push_back(node);
+    }
+
+    auto createPrimitive = [](const MKLDNNNodePtr& node) {
+        // weights are shared with other streams and other networks loaded to the plugin
+        node->enableWeightCaching(true);
         node->createPrimitive();
+    };
+
+    for (auto& level : levels) {
+        if (level.size() == 1) {
+            createPrimitive(level[0]);
+            continue;
+        }
+
+        // exceptions must not leave a parallel region, so the first one is rethrown after the level
+        std::exception_ptr exception;
+        std::mutex exceptionMutex;
+        auto createInLevel = [&](size_t i) {
+            try {
+                createPrimitive(level[i]);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!exception) exception = std::current_exception();
+            }
+        };
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+        // the parallel weight reorders of a node must not pick up another node of the level
+        parallel_for(level.size(), [&](size_t i) {
+            tbb::this_task_arena::isolate([&]() { createInLevel(i); });
+        });
+#else
+        parallel_for(level.size(), createInLevel);
+#endif
+        if (exception)
+            std::rethrow_exception(exception);
     }
 }
 
-void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+void MKLDNNGraph::AllocateScratchpad() {
+    // the threads of the stream run one node at a time, so the nodes share the largest region
+    scratchpad = std::make_shared<MKLDNNScratchpad>();
+    for (auto& node : graphNodes)
+        scratchpad->reserve(node->getScratchpadSize());
+    scratchpad->allocate();
+    for (auto& node : graphNodes)
+        node->setScratchpad(scratchpad);
+}
+
+void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool subtractMean) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
     auto input = inputNodes.find(name);
@@ -688,6 +904,10 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
 
+        auto zeroCopy = zeroCopyPorts.find(name);
+        if (zeroCopy != zeroCopyPorts.end())
+            zeroCopy->second = ext_data_ptr == inter_data_ptr;
+
         if (ext_data_ptr != inter_data_ptr) {
             auto l = in->getTensorDesc().getLayout();
             if (l == CHW && input->second->getChildEdgeAt(0)->getDims().ndims() == 4)
@@ -699,7 +919,7 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         }
 
         // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
+        if (subtractMean && _meanImages.find(name) != _meanImages.end()) {
             if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
                 _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
@@ -742,6 +962,10 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         void *ext_blob_ptr = ext_blob->buffer();
         void *intr_blob_ptr = intr_blob.GetData();
 
+        auto zeroCopy = zeroCopyPorts.find(name);
+        if (zeroCopy != zeroCopyPorts.end())
+            zeroCopy->second = ext_blob_ptr == intr_blob_ptr;
+
         // That is the same memory. No need to copy
         if (ext_blob_ptr == intr_blob_ptr) continue;
 
@@ -761,24 +985,69 @@ void MKLDNNGraph::Infer(int batch) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    // without PERF_COUNT the nodes are timed in 1 of perfCountSamplingPeriod inferences only
+    bool timed = config.collectPerfCounters;
+    if (!timed && config.perfCountSamplingPeriod > 0) {
+        timed = inferencesToSample == 0;
+        inferencesToSample = timed ? config.perfCountSamplingPeriod - 1 : inferencesToSample - 1;
+    }
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+    if (executionWaves.empty()) {
+        for (int i = 0; i < graphNodes.size(); i++) {
+            ExecuteNode(graphNodes[i], stream, batch, timed);
+        }
+    } else {
+        for (auto &wave : executionWaves) {
+            if (wave.size() == 1) {
+                ExecuteNode(wave[0], stream, batch, timed);
+                continue;
+            }
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+            // exceptions must not leave a parallel region, so the first one is rethrown after the wave
+            std::exception_ptr exception;
+            std::mutex exceptionMutex;
+            auto executeInWave = [&](size_t i) {
+                try {
+                    // stream is not thread safe, so each node submits its primitives into own one
+                    mkldnn::stream nodeStream = mkldnn::stream(stream::kind::eager);
+                    ExecuteNode(wave[i], nodeStream, batch, timed);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(exceptionMutex);
+                    if (!exception) exception = std::current_exception();
+                }
+            };
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+            // a thread waiting inside a node must not pick up another node of the wave,
+            // since both would use the same per-thread primitive scratchpad
+            parallel_for(wave.size(), [&](size_t i) {
+                tbb::this_task_arena::isolate([&]() { executeInWave(i); });
+            });
+#else
+            parallel_for(wave.size(), executeInWave);
+#endif
+            if (exception)
+                std::rethrow_exception(exception);
+        }
+    }
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+    if (infer_count != -1) infer_count++;
+}
 
-        if (!graphNodes[i]->isConstant()) {
-            IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
-            graphNodes[i]->execute(stream);
-        }
+void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, int batch, bool timed) {
+    PERF(node, timed);
 
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+    if (batch > 0)
+        node->setDynamicBatchLim(batch);
+
+    ENABLE_DUMP(do_before(DUMP_DIR, node));
+
+    if (!node->isConstant()) {
+        IE_PROFILING_AUTO_SCOPE_TASK(node->profilingTask)
+        node->execute(stream);
     }
 
-    if (infer_count != -1) infer_count++;
+    ENABLE_DUMP(do_after(DUMP_DIR, node));
 }
 
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
@@ -897,6 +1166,65 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     if (!config.dumpToDot.empty()) dumpToDotFile(config.dumpToDot + "_perf.dot");
 }
 
+void MKLDNNGraph::GetSampledPerfData(std::map<std::string, std::vector<uint64_t>> &histograms) const {
+    for (auto& node : graphNodes) {
+        const auto& histogram = node->PerfCounter().histogram();
+        if (!histogram.empty())
+            histogram.accumulate(histograms[node->getName()]);
+    }
+}
+
+void MKLDNNGraph::GetMemoryPerNUMANode(std::map<int, uint64_t> &memory,
+                                       std::unordered_set<const MKLDNNMemory*> &counted) const {
+    uint64_t constBytes = 0, scratchBytes = 0;
+    GetMemoryFootprint(constBytes, scratchBytes, counted);
+    memory[socket] += constBytes + scratchBytes;
+}
+
+void MKLDNNGraph::GetMemoryFootprint(uint64_t &constBytes, uint64_t &scratchBytes,
+                                     std::unordered_set<const MKLDNNMemory*> &counted) const {
+    if (memWorkspace)
+        scratchBytes += memWorkspace->GetSize();
+    if (scratchpad)
+        scratchBytes += scratchpad->getTotalSize();
+
+    std::function<void(const MKLDNNNodePtr&)> addInternalBlobs = [&](const MKLDNNNodePtr &node) {
+        for (auto &blobMemory : node->internalBlobMemory) {
+            if (blobMemory && counted.insert(blobMemory.get()).second)
+                constBytes += blobMemory->GetSize();
+        }
+        for (auto &fused : node->getFusedWith())
+            addInternalBlobs(fused);
+    };
+
+    for (auto &node : graphNodes)
+        addInternalBlobs(node);
+}
+
+void MKLDNNGraph::GetZeroCopyPorts(std::set<std::string> &ports) const {
+    for (auto &port : zeroCopyPorts) {
+        if (port.second)
+            ports.insert(port.first);
+    }
+}
+
+void MKLDNNGraph::GetReferenceReorders(std::set<std::string> &reorders) const {
+#if defined (COMPILED_CPU_MKLDNN_REORDER_NODE)
+    for (auto &node : graphNodes) {
+        auto *reorder = dynamic_cast<MKLDNNReorderNode *>(node.get());
+        if (reorder == nullptr || !reorder->isReference())
+            continue;
+        auto &srcMemory = node->getParentEdgeAt(0)->getMemory();
+        auto &dstMemory = node->getChildEdgeAt(0)->getMemory();
+        reorders.insert(node->getName() + ": " +
+                        MKLDNNExtensionUtils::DataTypeToIEPrecision(srcMemory.GetDataType()).name() + " " +
+                        MKLDNNMemory::formatToString(srcMemory.GetFormat()) + " -> " +
+                        MKLDNNExtensionUtils::DataTypeToIEPrecision(dstMemory.GetDataType()).name() + " " +
+                        MKLDNNMemory::formatToString(dstMemory.GetFormat()));
+    }
+#endif
+}
+
 void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
 }
@@ -928,16 +1256,7 @@ void MKLDNNGraph::getOutputBlobs(InferenceEngine::BlobMap &resp) {
 }
 
 void MKLDNNGraph::DropNode(const MKLDNNNodePtr &node) {
-    auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
-        auto& edges = graph.GetEdges();
-        for (auto it = edges.begin(); it != edges.end(); it++) {
-            if ((*it) == edge) {
-                edges.erase(it);
-                return;
-            }
-        }
-    };
-
+    // the dropped edges stay in graphEdges until RemoveDroppedEdges, so dropping a node doesn't scan all the edges
     auto childs = node->childEdges;
     auto parents = node->parentEdges;
 
@@ -947,27 +1266,19 @@ void MKLDNNGraph::DropNode(const MKLDNNNodePtr &node) {
         auto parent = p_edge->getParent();
         if (!parent) continue;
 
+        // the port of the parent is taken before the edge is dropped, it connects all the children
+        const int inNum = p_edge->getInputNum();
         for (size_t j = 0; j < childs.size(); j++) {
-            if (!childs[j].lock())
+            auto c_edge = childs[j].lock();
+            if (!c_edge)
                 continue;
-            auto child = childs[j].lock()->getChild();
+            auto child = c_edge->getChild();
             if (!child)
                 continue;
 
-            MKLDNNEdgePtr &remEdge = p_edge;
-            int inNum = 0;
-            if (remEdge) {
-                inNum = remEdge->getInputNum();
-                remEdge->drop();
-                removeEdge(*this, remEdge);
-            }
-            remEdge = childs[j].lock();
-            int outNum = 0;
-            if (remEdge) {
-                outNum = remEdge->getOutputNum();
-                remEdge->drop();
-                removeEdge(*this, remEdge);
-            }
+            p_edge->drop();
+            const int outNum = c_edge->getOutputNum();
+            c_edge->drop();
             MKLDNNEdgePtr newEdge(new MKLDNNEdge(parent, child, inNum, outNum));
             graphEdges.push_back(newEdge);
             parent->addEdge(newEdge);
@@ -1051,30 +1362,16 @@ void MKLDNNGraph::DropDWConvNode(const MKLDNNNodePtr &node) {
 
 void MKLDNNGraph::RemoveDroppedNodes() {
     auto& nodes = this->GetNodes();
-
-    auto it = nodes.begin();
-
-    while (it != nodes.end()) {
-        if ((*it)->isDropped()) {
-            it = nodes.erase(it);
-        } else {
-            it++;
-        }
-    }
+    nodes.erase(std::remove_if(nodes.begin(), nodes.end(), [](const MKLDNNNodePtr& node) {
+        return node->isDropped();
+    }), nodes.end());
 }
 
 void MKLDNNGraph::RemoveDroppedEdges() {
     auto& edges = this->GetEdges();
-
-    auto it = edges.begin();
-
-    while (it != edges.end()) {
-        if ((*it)->isDropped()) {
-            it = edges.erase(it);
-        } else {
-            it++;
-        }
-    }
+    edges.erase(std::remove_if(edges.begin(), edges.end(), [](const MKLDNNEdgePtr& edge) {
+        return edge->isDropped();
+    }), edges.end());
 }
 
 void MKLDNNGraph::dumpToDotFile(std::string file) const {
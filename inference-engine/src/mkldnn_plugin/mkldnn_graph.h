@@ -11,11 +11,15 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "mkldnn_streams.h"
+#include "mkldnn_scratchpad.h"
 
+#include <atomic>
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 #include <memory>
+#include <unordered_set>
 
 namespace MKLDNNPlugin {
 
@@ -55,7 +59,8 @@ public:
         return _meanImages.find(name) != _meanImages.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    // subtractMean is false for the inputs already normalized by the pre-processing
+    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool subtractMean = true);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
     void Infer(int batch = -1);
@@ -78,14 +83,56 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief Adds the execution times histograms of the nodes to the ones of the other streams
+     * @param histograms Node names mapped to the counts of the PerfHistogram buckets
+     */
+    void GetSampledPerfData(std::map<std::string, std::vector<uint64_t>> &histograms) const;
+
+    /**
+     * @brief Adds memory allocated for the graph to the statistic
+     * @param memory Bytes per NUMA node
+     * @param counted Internal blobs which are already counted, since they are shared between graphs
+     */
+    void GetMemoryPerNUMANode(std::map<int, uint64_t> &memory, std::unordered_set<const MKLDNNMemory*> &counted) const;
+
+    /**
+     * @brief Adds memory allocated for the graph to the footprint of the network
+     * @param constBytes Internal blobs of the nodes (weights), which are not counted yet
+     * @param scratchBytes Intermediate tensors of the graph
+     * @param counted Internal blobs which are already counted, since they are shared between graphs
+     */
+    void GetMemoryFootprint(uint64_t &constBytes, uint64_t &scratchBytes,
+                            std::unordered_set<const MKLDNNMemory*> &counted) const;
+
+    /**
+     * @brief Adds names of inputs and outputs which used user memory without copying during the last inference
+     */
+    void GetZeroCopyPorts(std::set<std::string> &ports) const;
+
+    /**
+     * @brief Gets the number of reorders the layout assignment of Config::layoutAssignment eliminated
+     */
+    size_t GetEliminatedReorders() const {
+        return eliminatedReorders;
+    }
+
+    /**
+     * @brief Adds names of the reorders which run on the reference code of MKLDNN with their formats and precisions
+     */
+    void GetReferenceReorders(std::set<std::string> &reorders) const;
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
     void DropDWConvNode(const MKLDNNNodePtr& node);
 
+    // first_core offsets the cores the stream threads are pinned to, see ExecutorManager::reserveCores,
+    // the processors restrict them to the cores of one type of the hybrid CPUs, see stream_placement
     void CreateArenaWithObserverAndLoadGraph(int threads_per_stream, int numa_node, int stream_id,
                                              Config::InferenceThreadsBinding  pinning,
-            std::shared_ptr<ICNNNetwork> clonedNetwork, const MKLDNNExtensionManager::Ptr& extensionManager) {
+            std::shared_ptr<ICNNNetwork> clonedNetwork, const MKLDNNExtensionManager::Ptr& extensionManager,
+            int first_core = 0, const std::vector<int>& processors = {}) {
         auto load = [clonedNetwork, extensionManager, numa_node, this](){
             CreateGraph(static_cast<const ICNNNetwork&>(*clonedNetwork), extensionManager, numa_node);
         };
@@ -99,7 +146,7 @@ public:
             ptrArena = std::unique_ptr<tbb::task_arena>(new tbb::task_arena(threads_per_stream));
             if (Config::InferenceThreadsBinding::CORES == pinning) {
                  // custom observer (that pins threads to cores)
-                 CreateObserver(stream_id, threads_per_stream);
+                 CreateObserver(stream_id, threads_per_stream, first_core, 1, processors);
             }
         }
         ptrArena->execute([&load](){
@@ -111,7 +158,7 @@ public:
         #endif
         // check that no (affinity-related) OMP envs are set, so user doesn't do a custom pinning
         if (!check_env_variables() && (Config::InferenceThreadsBinding::NONE != pinning))
-            CreateObserver(stream_id, threads_per_stream);
+            CreateObserver(stream_id, threads_per_stream, first_core, 1, processors);
         load();
         #endif
     }
@@ -126,24 +173,32 @@ public:
     void SortTopologically();
 
 protected:
-    void CreateObserver(int _stream_id, int _threads_per_stream, int _pinning_step = 1) {
+    void CreateObserver(int _stream_id, int _threads_per_stream, int _first_core = 0, int _pinning_step = 1,
+                        const std::vector<int>& _processors = {}) {
         // Notice that custom pinning/observer work (via sched_setaffinity) ONLY on Linux,
         // in all other cases the below code is actually just a stub
         #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         ptrObserver
                 = std::unique_ptr<tbb::task_scheduler_observer>(
-                new pinning_observer(*ptrArena, _stream_id, _threads_per_stream, _pinning_step));
+                new pinning_observer(*ptrArena, _stream_id, _threads_per_stream, _first_core, _pinning_step,
+                                     _processors));
         #else
         cpu_set_t *process_mask = nullptr;
         int ncpus = 0;
         get_process_mask(ncpus, process_mask);
+        cpu_set_t *stream_mask = restrict_process_mask(ncpus, process_mask, _processors);
+        if (stream_mask) {
+            CPU_FREE(process_mask);
+            process_mask = stream_mask;
+        }
             #if IE_THREAD == IE_THREAD_OMP
             #pragma omp parallel for
                     for (int thread_index = 0; thread_index < _threads_per_stream; thread_index++) {
-                        pin_thread_to_vacant_core(_stream_id * _threads_per_stream + thread_index, 1, ncpus, process_mask);
+                        pin_thread_to_vacant_core(_first_core + _stream_id * _threads_per_stream + thread_index, 1,
+                                                  ncpus, process_mask);
                     }
             #elif IE_THREAD == IE_THREAD_SEQ
-            pin_thread_to_vacant_core(_stream_id * _threads_per_stream, 1, ncpus, process_mask);
+            pin_thread_to_vacant_core(_first_core + _stream_id * _threads_per_stream, 1, ncpus, process_mask);
             #endif
         CPU_FREE(process_mask);
         #endif
@@ -158,7 +213,10 @@ protected:
         outputNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
+        executionWaves.clear();
+        zeroCopyPorts.clear();
         _meanImages.clear();
+        scratchpad.reset();
     }
     Status status;
     Config config;
@@ -167,15 +225,31 @@ protected:
     // values mean increment it within each Infer() call
     int infer_count = -1;
 
+    // inferences left before the next one with the timed nodes, see Config::perfCountSamplingPeriod
+    int inferencesToSample = 0;
+
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    // temporary memory of the nodes, see MKLDNNNode::getScratchpadSize
+    MKLDNNScratchpad::Ptr scratchpad;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
+    // Groups of nodes which do not depend on each other and can be executed concurrently.
+    // Filled only if parallel execution of branches is enabled and applicable for the graph.
+    std::vector<std::vector<MKLDNNNodePtr>> executionWaves;
+
+    // Inputs and outputs mapped to whether the last inference worked directly on user memory.
+    // Keys are filled on graph initialization, values are updated by PushInputData/PullOutputData.
+    std::map<std::string, std::atomic<bool>> zeroCopyPorts;
+
+    // the reorders MKLDNNLayoutAssignment saved compared to the descriptors the nodes selected one by one
+    size_t eliminatedReorders = 0;
+
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
@@ -193,12 +267,16 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void AllocateScratchpad();
+    void InitExecutionWaves();
+    void ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, int batch, bool timed);
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
+    friend class MKLDNNTensorIteratorNode;
     friend std::shared_ptr<InferenceEngine::ICNNNetwork> dump_graph_as_ie_net(const MKLDNNGraph &graph);
 
 private:
@@ -115,6 +115,10 @@ void copy_node_metadata(const MKLDNNNodePtr &node, CNNLayer::Ptr &layer) {
     // Implementation type name
     layer->params[ExecGraphInfoSerialization::IMPL_TYPE] = node->getPrimitiveDescriptorType();
 
+    auto weightsFormat = node->getWeightsFormat();
+    if (!weightsFormat.empty())
+        layer->params[ExecGraphInfoSerialization::WEIGHTS_FORMAT] = weightsFormat;
+
     std::string outputPrecisionsStr;
     if (!node->getChildEdges().empty()) {
         outputPrecisionsStr = node->getChildEdgeAt(0)->getDesc().getPrecision().name();
@@ -164,12 +168,25 @@ void copy_node_metadata(const MKLDNNNodePtr &node, CNNLayer::Ptr &layer) {
     layer->params[ExecGraphInfoSerialization::OUTPUT_LAYOUTS] = outputLayoutsStr;
 
     // Performance
-    if (node->PerfCounter().avg() != 0) {
-        layer->params[ExecGraphInfoSerialization::PERF_COUNTER] = std::to_string(node->PerfCounter().avg());
+    const uint64_t execTime = node->PerfCounter().avg();
+    if (execTime != 0) {
+        layer->params[ExecGraphInfoSerialization::PERF_COUNTER] = std::to_string(execTime);
     } else {
         layer->params[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
 
+    // Roofline: the work of the node and the rates achieved in the measured time
+    const uint64_t flops = node->getFlops();
+    const uint64_t bytes = node->getMemoryTraffic();
+    if (flops != 0)
+        layer->params[ExecGraphInfoSerialization::THEORETICAL_FLOPS] = std::to_string(flops);
+    layer->params[ExecGraphInfoSerialization::MEMORY_TRAFFIC] = std::to_string(bytes);
+    if (execTime != 0) {
+        if (flops != 0)
+            layer->params[ExecGraphInfoSerialization::ACHIEVED_GFLOPS] = std::to_string(flops / 1000.0 / execTime);
+        layer->params[ExecGraphInfoSerialization::ACHIEVED_BANDWIDTH] = std::to_string(bytes / 1000.0 / execTime);
+    }
+
     layer->params[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 }
 
@@ -16,6 +16,8 @@
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
+#include "nodes/mkldnn_mha_node.h"
+#include "nodes/mkldnn_gemm_node.h"
 
 #include <blob_factory.hpp>
 #include <ie_layers_internal.hpp>
@@ -25,6 +27,7 @@
 #include <list>
 #include <memory>
 #include <set>
+#include <limits>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -36,9 +39,17 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     MergeConversions(graph);
     graph.RemoveDroppedNodes();
 
-    FuseBroadcastAndEltwise(graph);
+    FuseBroadcastAndConsumers(graph);
     graph.RemoveDroppedNodes();
 
+    FusePadAndConsumer(graph);
+    graph.RemoveDroppedNodes();
+
+#if defined(COMPILED_CPU_MKLDNN_MHA_NODE)
+    FuseMultiHeadAttention(graph);
+    graph.RemoveDroppedNodes();
+#endif
+
     MergeGroupConvolution(graph);
     graph.RemoveDroppedNodes();
 
@@ -48,6 +59,9 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
 #if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
     FuseConvolutionAndDepthwise(graph);
     graph.RemoveDroppedNodes();
+
+    FuseGemmAndDepthwise(graph);
+    graph.RemoveDroppedNodes();
 #endif
 
 #if defined(COMPILED_CPU_MKLDNN_ACTIVATION_NODE)
@@ -57,6 +71,12 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     graph.RemoveDroppedNodes();
 #endif
 
+    FuseSoftMaxAndTopK(graph);
+    graph.RemoveDroppedNodes();
+
+    FuseFullyConnectedAndSoftMax(graph);
+    graph.RemoveDroppedNodes();
+
 #if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
     FuseConvolutionAndDepthwise(graph);
     graph.RemoveDroppedNodes();
@@ -239,8 +259,10 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
                 auto zeroPointsBlob = dynamic_cast<TBlob<uint8_t>*>(arg0->getCnnLayer()->blobs["custom"].get());
                 auto zeroPointsData = zeroPointsBlob->buffer().as<uint8_t*>();
 
-                for (int j = 0; j < parent0->getParentEdgesAtPort(1)[0]->getDims()[1]; j++) {
-                    convNode->inputZeroPoints.push_back(zeroPointsData[j]);
+                // per-tensor zero point is broadcasted through the channels the attribute is set for
+                const bool perTensor = parent0->getParentEdgesAtPort(1)[0]->getDims()[1] == 1;
+                for (int j = 0; j < IC; j++) {
+                    convNode->inputZeroPoints.push_back(zeroPointsData[perTensor ? 0 : j]);
                 }
             } else {
                 return false;
@@ -290,8 +312,9 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
                 auto zeroPointsBlob = dynamic_cast<TBlob<int8_t>*>(arg0->getCnnLayer()->blobs["custom"].get());
                 auto zeroPointsData = zeroPointsBlob->buffer().as<int8_t*>();
 
-                for (int j = 0; j < parent0->getParentEdgesAtPort(1)[0]->getDims()[0]; j++) {
-                    convNode->weightsZeroPoints.push_back(static_cast<float>(zeroPointsData[j]));
+                const bool perTensor = parent0->getParentEdgesAtPort(1)[0]->getDims()[0] == 1;
+                for (int j = 0; j < OC; j++) {
+                    convNode->weightsZeroPoints.push_back(static_cast<float>(zeroPointsData[perTensor ? 0 : j]));
                 }
             } else {
                 return false;
@@ -445,30 +468,46 @@ void MKLDNNGraphOptimizer::MergeGroupConvolution(MKLDNNGraph &graph) {
     }
 }
 
-void MKLDNNGraphOptimizer::FuseBatchNormWithScale(MKLDNNGraph &graph) {
-    auto &graphNodes = graph.GetNodes();
+void MKLDNNGraphOptimizer::FuseChains(MKLDNNGraph &graph, const ChainFusion &fusion) {
+    std::vector<MKLDNNNodePtr> heads;
+    for (auto &node : graph.GetNodes()) {
+        if (fusion.head(node))
+            heads.push_back(node);
+    }
 
-    for (int i = 0; i < graphNodes.size(); i++) {
-        const auto& bn = graphNodes[i];
-        if (bn->getType() == BatchNormalization) {
-            const auto& outputNodes = graph.GetOutputNodes();
-            const std::string node_name = bn->getName();
-            // Check that the node is not output node
-            if (std::find_if(outputNodes.begin(), outputNodes.end(),
-                            [&node_name](const MKLDNNNodePtr& x) {
-                                return x->getName() == node_name;}) == outputNodes.end()) {
-                if (bn->getChildEdges().size() == 1) {
-                    auto child = bn->getChildEdgeAt(0)->getChild();
-                    if (child->type == Depthwise && child->getCnnLayer()->type == "ScaleShift") {
-                        bn->fuseWith(child);
-                        graph.DropNode(child);
-                    }
-                }
-            }
+    for (auto &head : heads) {
+        // a head may have been fused as a child of another head
+        if (head->isDropped())
+            continue;
+
+        for (size_t length = 0; length < fusion.maxLength && head->getChildEdges().size() == 1; length++) {
+            auto child = head->getChildEdgeAt(0)->getChild();
+            if (!fusion.child(head, child))
+                break;
+
+            head->fuseWith(child);
+            graph.DropNode(child);
         }
     }
 }
 
+void MKLDNNGraphOptimizer::FuseBatchNormWithScale(MKLDNNGraph &graph) {
+    const auto& outputNodes = graph.GetOutputNodes();
+
+    FuseChains(graph, {
+        [&](const MKLDNNNodePtr& node) {
+            const std::string node_name = node->getName();
+            // Check that the node is not output node
+            return node->getType() == BatchNormalization &&
+                   std::find_if(outputNodes.begin(), outputNodes.end(), [&node_name](const MKLDNNNodePtr& x) {
+                       return x->getName() == node_name;}) == outputNodes.end();
+        },
+        [](const MKLDNNNodePtr& bn, const MKLDNNNodePtr& child) {
+            return child->type == Depthwise && child->getCnnLayer()->type == "ScaleShift";
+        },
+        1});
+}
+
 #if defined(COMPILED_CPU_MKLDNN_ACTIVATION_NODE)
 void MKLDNNGraphOptimizer::FuseConvolutionAndActivation(MKLDNNGraph &graph) {
     auto isOneOf = [&](mkldnn::algorithm alg, std::vector<mkldnn::algorithm> algs) {
@@ -541,9 +580,7 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndActivation(MKLDNNGraph &graph) {
 }
 
 void MKLDNNGraphOptimizer::FuseFullyConnectedAndActivation(MKLDNNGraph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isFusingSupported = [&](MKLDNNNodePtr fc, MKLDNNNodePtr activation) {
+    auto isFusingSupported = [](const MKLDNNNodePtr& fc, const MKLDNNNodePtr& activation) {
         if (!activation->getCnnLayer())
             return false;
 
@@ -554,39 +591,70 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndActivation(MKLDNNGraph &graph) {
             (activationNode->getAlgorithm() == eltwise_relu);
     };
 
-    for (int i = 0; i < graphNodes.size(); i++) {
-        if (graphNodes[i]->getType() == FullyConnected) {
-            auto fc = graphNodes[i];
+    FuseChains(graph, {
+        [](const MKLDNNNodePtr& node) {
+            return node->getType() == FullyConnected;
+        },
+        isFusingSupported,
+        1});
+}
+#endif
 
-            auto fuse = [&] (MKLDNNNodePtr relu) {
-                fc->fuseWith(relu);
-            };
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndSoftMax(MKLDNNGraph &graph) {
+    FuseChains(graph, {
+        [](const MKLDNNNodePtr& node) {
+            return node->getType() == FullyConnected && node->getCnnLayer()->precision == Precision::FP32 &&
+                   node->getChildEdges().size() == 1 && node->getChildEdgeAt(0)->getDims().ndims() == 2;
+        },
+        [](const MKLDNNNodePtr& fc, const MKLDNNNodePtr& child) {
+            auto* softmaxLayer = dynamic_cast<SoftMaxLayer*>(child->getCnnLayer().get());
+            return child->getType() == SoftMax && softmaxLayer != nullptr && softmaxLayer->axis == 1;
+        },
+        1});
+}
 
-            if (fc->getChildEdges().size() == 1) {
-                auto ch1 = fc->getChildEdgeAt(0)->getChild();
+void MKLDNNGraphOptimizer::FuseSoftMaxAndTopK(MKLDNNGraph &graph) {
+    // Softmax keeps the order of the values along its axis, so TopK along the same axis selects the same elements
+    // from its input and normalizes only the selected values, the probabilities are not written
+    std::vector<MKLDNNNodePtr> softmaxes;
+    for (auto& node : graph.GetNodes()) {
+        if (node->getType() != SoftMax || node->getParentEdges().size() != 1 || node->getChildEdges().size() != 1)
+            continue;
+        auto* softmaxLayer = dynamic_cast<SoftMaxLayer*>(node->getCnnLayer().get());
+        if (softmaxLayer == nullptr || softmaxLayer->precision != Precision::FP32)
+            continue;
 
-                if (isFusingSupported(fc, ch1)) {
-                    fuse(ch1);
-                    graph.DropNode(ch1);
-                }
-            }
-        }
+        auto childEdge = node->getChildEdgeAt(0);
+        auto topk = childEdge->getChild();
+        if (topk->getType() != Generic || !topk->getCnnLayer() || topk->getCnnLayer()->type != "TopK" ||
+            childEdge->getOutputNum() != 0)
+            continue;
+
+        int ndims = static_cast<int>(childEdge->getDims().ndims());
+        int topkAxis = topk->getCnnLayer()->GetParamAsInt("axis", -1);
+        if (topkAxis < 0)
+            topkAxis += ndims;
+        if (topkAxis != softmaxLayer->axis)
+            continue;
+
+        topk->getCnnLayer()->params["fused_softmax"] = "true";
+        softmaxes.push_back(node);
     }
+
+    for (auto& softmax : softmaxes)
+        graph.DropNode(softmax);
 }
-#endif
 
 #if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
 void MKLDNNGraphOptimizer::FuseConvolutionAndDepthwise(MKLDNNGraph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSutableParentNode = [](MKLDNNNodePtr node) {
+    auto isSutableParentNode = [](const MKLDNNNodePtr& node) {
         bool isSutableConv = (node->getType() == Convolution) &&
                              node->getCnnLayer()->precision == Precision::FP32;
         bool isSutableBinConv = node->getType() == BinaryConvolution;
-        return (isSutableConv || isSutableBinConv) && node->getChildEdges().size() == 1;
+        return isSutableConv || isSutableBinConv;
     };
 
-    auto isSutableChildNode = [](MKLDNNNodePtr node) {
+    auto isSutableChildNode = [](const MKLDNNNodePtr& conv, const MKLDNNNodePtr& node) {
         if (node->getType() != Depthwise)
             return false;
 
@@ -600,26 +668,22 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDepthwise(MKLDNNGraph &graph) {
                 (depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_prelu));
     };
 
-    for (int i = 0; i < graphNodes.size(); i++) {
-        auto conv = graphNodes[i];
-        if (!isSutableParentNode(conv)) continue;
-
-        auto depthwise0 = conv->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(depthwise0)) continue;
-
-        conv->fuseWith(depthwise0);
+    FuseChains(graph, {isSutableParentNode, isSutableChildNode, 2});
+}
 
-        if (depthwise0->getChildEdges().size() == 1) {
-            auto depthwise1 = depthwise0->getChildEdgeAt(0)->getChild();
+void MKLDNNGraphOptimizer::FuseGemmAndDepthwise(MKLDNNGraph &graph) {
+    // dequantization ScaleShift after int8 gemm is applied to int32 accumulators in the gemm itself
+    auto isSutableParentNode = [](const MKLDNNNodePtr& node) {
+        auto* gemmNode = dynamic_cast<MKLDNNGemmNode*>(node.get());
+        return gemmNode && gemmNode->canBeExecutedInInt8();
+    };
 
-            if (isSutableChildNode(depthwise1)) {
-                conv->fuseWith(depthwise1);
-                graph.DropNode(depthwise1);
-            }
-        }
+    auto isSutableChildNode = [](const MKLDNNNodePtr& gemm, const MKLDNNNodePtr& node) {
+        return node->getType() == Depthwise && node->getCnnLayer()->type == "ScaleShift" &&
+               node->getParentEdges().size() == 1 && node->getCnnLayer()->outData[0]->getPrecision() == Precision::FP32;
+    };
 
-        graph.DropNode(depthwise0);
-    }
+    FuseChains(graph, {isSutableParentNode, isSutableChildNode, std::numeric_limits<size_t>::max()});
 }
 #endif
 
@@ -730,11 +794,20 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
 
         auto inDims = childNode->inDims[0];
         auto outDims = childNode->outDims[0];
-        int elemSize = MKLDNNExtensionUtils::sizeOfDataType(MKLDNNExtensionUtils::IEPrecisionToDataType(layer->precision));
-
-        int L3_cache_size = mkldnn_get_cache_size(3, false);
-        int dw_conv_input_size = inDims[0] * inDims[1] * inDims[2] * inDims[3] * elemSize;
-        int dw_conv_output_size = outDims[0] * outDims[1]* outDims[2] * outDims[3] * elemSize;
+        size_t elemSize = MKLDNNExtensionUtils::sizeOfDataType(MKLDNNExtensionUtils::IEPrecisionToDataType(layer->precision));
+
+        size_t L2_cache_size = mkldnn_get_cache_size(2, true);
+        size_t L3_cache_size = mkldnn_get_cache_size(3, false);
+        size_t dw_conv_input_size = inDims[0] * inDims[1] * inDims[2] * inDims[3] * elemSize;
+        size_t dw_conv_output_size = outDims[0] * outDims[1]* outDims[2] * outDims[3] * elemSize;
+
+        // The fused kernel computes the expanded tensor by the rows, every thread keeps the rows of all the channels
+        // the depthwise kernel reads. Fusing pays off when they stay in the L2 cache while the whole expanded tensor
+        // would not stay in the caches of the threads between the two convolutions.
+        size_t dw_conv_rows_size = layer->_kernel[Y_AXIS] * inDims[3] * ((inDims[1] + 7) / 8 * 8) * elemSize;
+        if (dw_conv_rows_size > L2_cache_size / 2)
+            return false;
+        size_t caches_size = (std::min)(L3_cache_size / 2, L2_cache_size * parallel_get_max_threads());
 
         auto* parentConvolutionNode = dynamic_cast<MKLDNNConvolutionNode*>(parentNode.get());
         if (parentConvolutionNode == nullptr)
@@ -743,7 +816,7 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
         bool isInt8 = parentConvolutionNode->canBeExecutedInInt8();
         bool isAVX512NotSupported = !mkldnn::impl::cpu::mayiuse(impl::cpu::cpu_isa_t::avx512_common);
 
-        return isInt8 ? isAVX512NotSupported : (dw_conv_input_size + dw_conv_output_size > L3_cache_size / 2);
+        return isInt8 ? isAVX512NotSupported : (dw_conv_input_size + dw_conv_output_size > caches_size);
     };
 
     for (int i = 0; i < graphNodes.size(); i++) {
@@ -1363,14 +1436,32 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
 
     auto& graphNodes = graph.GetNodes();
 
-    auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutableEltwise = node->getType() == Eltwise;
+    auto isSutableBinaryOperation = [](MKLDNNNodePtr node) {
+        if (node->getType() != Eltwise || node->getParentEdges().size() != 2)
+            return false;
 
-        if (isSutableEltwise) {
-            auto *eltwiseLayer = dynamic_cast<EltwiseLayer *>(node->getCnnLayer().get());
-            if (eltwiseLayer == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get Eltwise layer " << node->getName();
+        auto *eltwiseLayer = dynamic_cast<EltwiseLayer *>(node->getCnnLayer().get());
+        if (eltwiseLayer == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get Eltwise layer " << node->getName();
+
+        for (auto coeff : eltwiseLayer->coeff) {
+            if (coeff != 1.0f)
+                return false;
+        }
+
+        return eltwiseLayer->_operation == EltwiseLayer::Sum || eltwiseLayer->_operation == EltwiseLayer::Prod ||
+               eltwiseLayer->_operation == EltwiseLayer::Sub || eltwiseLayer->_operation == EltwiseLayer::Max ||
+               eltwiseLayer->_operation == EltwiseLayer::Min || eltwiseLayer->_operation == EltwiseLayer::Div ||
+               eltwiseLayer->_operation == EltwiseLayer::Squared_diff;
+    };
 
+    auto isSutableParentNode = [&](MKLDNNNodePtr node) {
+        if (!mkldnn::impl::cpu::mayiuse(impl::cpu::cpu_isa_t::sse42))
+            return false;
+
+        bool isSutableEltwise = isSutableBinaryOperation(node) && node->getChildEdges().size() > 0;
+
+        if (isSutableEltwise) {
             ptrdiff_t maxChannels = 1;
             for (size_t i = 0; i < node->getParentEdges().size(); i++) {
                 if (node->getParentEdgeAt(0)->getDims().ndims() != node->getParentEdgeAt(i)->getDims().ndims())
@@ -1388,9 +1479,7 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
             if (maxChannels < simdWidth)
                 return false;
 
-            return node->getChildEdges().size() == 1 &&
-                   (eltwiseLayer->_operation == EltwiseLayer::Sum || eltwiseLayer->_operation == EltwiseLayer::Prod) &&
-                   !node->isFusedWith(Quantize);
+            return !node->isFusedWith(Quantize);
         } else {
             return false;
         }
@@ -1405,50 +1494,204 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
             if (quantizeNode == nullptr)
                 THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
             return !quantizeNode->isBinarization();
-        } else if (node->getType() == Activation) {
-            // Applicability was narrowed down in order not to affect FP32 topologies
-            if (node->getChildEdges().size() != 1)
-                return false;
-            if (node->getChildEdgeAt(0)->getChild()->getType() != Quantize)
-                return false;
+        }
+
+        // operations computed in floating point by the fused kernel
+        if (node->getCnnLayer()->outData[0]->getPrecision() != Precision::FP32)
+            return false;
 
+        if (node->getType() == Activation) {
             auto *activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
             if (activationNode == nullptr)
                 THROW_IE_EXCEPTION << "Cannot get activation layer " << node->getName();
-            return isOneOf(activationNode->getAlgorithm(), {eltwise_relu, eltwise_elu, eltwise_logistic, eltwise_bounded_relu, eltwise_clamp});
+            return isOneOf(activationNode->getAlgorithm(), {eltwise_relu, eltwise_elu, eltwise_tanh, eltwise_logistic,
+                                                            eltwise_square, eltwise_abs, eltwise_sqrt, eltwise_linear,
+                                                            eltwise_bounded_relu, eltwise_soft_relu, eltwise_clamp,
+                                                            eltwise_exp});
+        } else if (node->getType() == Power) {
+            auto *powerLayer = dynamic_cast<PowerLayer *>(node->getCnnLayer().get());
+            if (powerLayer == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get power layer " << node->getName();
+            return powerLayer->power == 1.0f || powerLayer->power == 2.0f || powerLayer->power == 0.5f;
         }
 
-        return false;
+        return isSutableBinaryOperation(node);
     };
 
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSutableParentNode(parentNode)) {
-            parent++;
-            continue;
+    auto dependsOn = [](const MKLDNNNodePtr &node, const std::vector<MKLDNNNodePtr> &nodes) {
+        std::set<MKLDNNNode *> visited;
+        std::vector<MKLDNNNode *> stack = {node.get()};
+        while (!stack.empty()) {
+            auto *current = stack.back();
+            stack.pop_back();
+            if (!visited.insert(current).second)
+                continue;
+            for (const auto &n : nodes) {
+                if (n.get() == current)
+                    return true;
+            }
+            for (size_t i = 0; i < current->getParentEdges().size(); i++)
+                stack.push_back(current->getParentEdgeAt(i)->getParent().get());
         }
+        return false;
+    };
 
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(childNode)) {
-            parent++;
+    struct ChainLink {
+        MKLDNNNodePtr node;
+        MKLDNNEltwiseNode::FusedOperand operand;
+        // port of the fused binary eltwise connected to an additional input of the chain
+        int inputPort;
+    };
+
+    for (auto &parentNode : graphNodes) {
+        if (!isSutableParentNode(parentNode))
             continue;
-        }
 
-        parentNode->fuseWith(childNode);
+        auto eltwiseNode = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(parentNode);
+        if (eltwiseNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get Eltwise node " << parentNode->getName();
+
+        // Greedily collects a chain of operations starting from the eltwise. Every operation takes the result
+        // of the previous one, binary operations may also take an additional input or a result of an earlier
+        // operation of the chain, which is kept in a register of the fused kernel.
+        auto outDims = parentNode->getChildEdgeAt(0)->getDims();
+        std::vector<MKLDNNNodePtr> chainNodes = {parentNode};
+        std::vector<ChainLink> chain;
+        std::set<MKLDNNNode *> savedNodes;
+        int additionalInputs = 0;
+
+        auto chainIdx = [&](const MKLDNNNodePtr &node) {
+            for (size_t i = 0; i < chainNodes.size(); i++) {
+                if (chainNodes[i] == node)
+                    return static_cast<int>(i);
+            }
+            return -1;
+        };
 
-        if (childNode->getType() == Quantize) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == Eltwise)
+        while (chainNodes.back()->getType() != Quantize) {
+            auto tail = chainNodes.back();
+
+            // operations using results of the chain are preferred to ones with additional inputs
+            ChainLink next = {nullptr, {-1, -1, false}, -1};
+            for (size_t i = 0; i < tail->getChildEdges().size(); i++) {
+                auto child = tail->getChildEdgeAt(i)->getChild();
+                if (chainIdx(child) >= 0 || !isSutableChildNode(child) || child->getChildEdges().empty())
+                    continue;
+                if (child->getChildEdgeAt(0)->getDims() != outDims)
                     continue;
 
-                removeEdge(graph, p_edge);
+                if (child->getType() != Eltwise) {
+                    if (child->getParentEdgeAt(0)->getParent() != tail ||
+                            (child->getType() != Quantize && child->getParentEdges().size() != 1))
+                        continue;
+                    next = {child, {-1, -1, false}, -1};
+                    break;
+                }
+
+                // the first port taking the result of the previous operation is the chain one
+                auto edge0 = child->getParentEdgeAt(0);
+                auto edge1 = child->getParentEdgeAt(1);
+                bool chainIsFirst = edge0->getParent() == tail;
+                auto otherEdge = chainIsFirst ? edge1 : edge0;
+                auto otherNode = otherEdge->getParent();
+
+                int otherIdx = chainIdx(otherNode);
+                if (otherIdx >= 0) {
+                    if (otherNode != tail && !savedNodes.count(otherNode.get()) &&
+                            savedNodes.size() >= MAX_ELTWISE_FUSED_STAGES)
+                        continue;
+                    next = {child, {-1, otherIdx - 1, !chainIsFirst}, -1};
+                    break;
+                }
+
+                if (next.node || additionalInputs >= MAX_ELTWISE_FUSED_INPUTS)
+                    continue;
+
+                auto inDims = otherEdge->getDims();
+                bool isBroadcastable = inDims.ndims() == outDims.ndims();
+                for (int j = 0; isBroadcastable && j < inDims.ndims(); j++)
+                    isBroadcastable = inDims[j] == outDims[j] || inDims[j] == 1;
+                if (!isBroadcastable || dependsOn(otherNode, chainNodes))
+                    continue;
+
+                next = {child, {0, -1, !chainIsFirst}, otherEdge->getOutputNum()};
             }
+
+            if (!next.node)
+                break;
+
+            if (next.inputPort >= 0) {
+                additionalInputs++;
+            } else if (next.node->getType() == Eltwise) {
+                auto operandNode = chainNodes[next.operand.fusedIdx + 1];
+                if (operandNode != chainNodes.back())
+                    savedNodes.insert(operandNode.get());
+            }
+
+            chainNodes.push_back(next.node);
+            chain.push_back(next);
         }
 
-        graph.DropNode(childNode);
+        // results of all the operations but the last one must be consumed inside the chain only
+        size_t chainLength = chain.size();
+        for (; chainLength > 0; chainLength--) {
+            bool isClosed = true;
+            for (size_t i = 0; isClosed && i < chainLength; i++) {
+                for (size_t j = 0; isClosed && j < chainNodes[i]->getChildEdges().size(); j++) {
+                    int idx = chainIdx(chainNodes[i]->getChildEdgeAt(j)->getChild());
+                    isClosed = idx > 0 && idx <= static_cast<int>(chainLength);
+                }
+            }
+            if (isClosed)
+                break;
+        }
+
+        for (size_t i = 0; i < chainLength; i++) {
+            auto childNode = chain[i].node;
+
+            if (childNode->getType() == Quantize) {
+                auto parentEdges = childNode->parentEdges;
+                for (auto &parentEdge : parentEdges) {
+                    auto p_edge = parentEdge.lock();
+                    if (p_edge->getParent() == parentNode)
+                        continue;
+
+                    removeEdge(graph, p_edge);
+                }
+
+                parentNode->fuseWith(childNode);
+            } else if (childNode->getType() == Eltwise) {
+                auto operand = chain[i].operand;
+                bool isChainEdgeKept = false;
+
+                auto parentEdges = childNode->parentEdges;
+                for (auto &parentEdge : parentEdges) {
+                    auto p_edge = parentEdge.lock();
+                    if (p_edge->getOutputNum() == chain[i].inputPort) {
+                        operand.inputIdx = static_cast<int>(parentNode->getParentEdges().size());
+
+                        MKLDNNEdgePtr newEdge(new MKLDNNEdge(p_edge->getParent(), parentNode, p_edge->getInputNum(),
+                                                             operand.inputIdx));
+                        graph.GetEdges().push_back(newEdge);
+                        parentNode->addEdge(newEdge);
+                        parentNode->inDims.push_back(p_edge->getDims());
+                    } else if (!isChainEdgeKept) {
+                        // operands produced by the chain are connected to the eltwise node after preceding fusings
+                        isChainEdgeKept = true;
+                        continue;
+                    }
+
+                    p_edge->drop();
+                    removeEdge(graph, p_edge);
+                }
+
+                eltwiseNode->fuseEltwiseWith(childNode, operand);
+            } else {
+                parentNode->fuseWith(childNode);
+            }
+
+            graph.DropNode(childNode);
+        }
     }
 }
 
@@ -1672,20 +1915,175 @@ bool MKLDNNGraphOptimizer::IsOneOf(Type type, std::vector<Type> types) {
     return false;
 }
 
-void MKLDNNGraphOptimizer::FuseBroadcastAndEltwise(MKLDNNGraph &graph) {
+void MKLDNNGraphOptimizer::FusePadAndConsumer(MKLDNNGraph &graph) {
+    auto isZeroSpatialPad = [](const MKLDNNNodePtr& node) {
+        if (node->getType() != Generic || node->getTypeStr() != "Pad" || node->getParentEdges().size() != 1 ||
+                node->getChildEdges().size() != 1 || node->getChildEdgeAt(0)->getOutputNum() != 0)
+            return false;
+        auto* layer = node->getCnnLayer().get();
+        if (layer->GetParamAsString("pad_mode") != "constant" || layer->GetParamAsFloat("pad_value", 0.f) != 0.f)
+            return false;
+        const auto begin = layer->GetParamAsUInts("pads_begin");
+        const auto end = layer->GetParamAsUInts("pads_end");
+        const size_t ndims = node->getParentEdgeAt(0)->getDims().ndims();
+        return (ndims == 4 || ndims == 5) && begin.size() == ndims && end.size() == ndims &&
+               begin[0] == 0 && begin[1] == 0 && end[0] == 0 && end[1] == 0;
+    };
+
+    auto joinPads = [](const PropertyVector<unsigned int>& pads) {
+        // the params list the axes from the outermost one, the property vectors from X
+        std::string str;
+        for (size_t i = pads.size(); i-- > 0;)
+            str += std::to_string(pads[i]) + (i ? "," : "");
+        return str;
+    };
+
+    for (auto &node : graph.GetNodes()) {
+        if (!isZeroSpatialPad(node))
+            continue;
+
+        auto padLayer = node->getCnnLayer();
+        const auto padBegin = padLayer->GetParamAsUInts("pads_begin");
+        const auto padEnd = padLayer->GetParamAsUInts("pads_end");
+        const MKLDNNDims inDims = node->getParentEdgeAt(0)->getDims();
+        const MKLDNNDims outDims = node->getChildEdgeAt(0)->getDims();
+        const size_t spatial = inDims.ndims() - 2;
+
+        auto consumer = node->getChildEdgeAt(0)->getChild();
+        CNNLayer* layer = consumer->getCnnLayer().get();
+        PropertyVector<unsigned int>* padding = nullptr;
+        PropertyVector<unsigned int>* padsEnd = nullptr;
+        std::vector<size_t> kernel(spatial), stride(spatial, 1);
+        bool fusable = false;
+        if (consumer->getType() == Convolution) {
+            auto* convLayer = dynamic_cast<ConvolutionLayer*>(layer);
+            if (convLayer && convLayer->_kernel.size() == spatial) {
+                for (size_t i = 0; i < spatial; i++)
+                    kernel[i] = (convLayer->_kernel[i] - 1) * convLayer->_dilation[i] + 1;
+                padding = &convLayer->_padding;
+                padsEnd = &convLayer->_pads_end;
+                fusable = true;
+            }
+        } else if (consumer->getType() == Pooling) {
+            // the padding of the max pooling is skipped instead of read as the zeros, and the average one only
+            // counts the zeros of the Pad node in the divisor if its own pads are counted too
+            auto* poolLayer = dynamic_cast<PoolingLayer*>(layer);
+            if (poolLayer && poolLayer->_type == PoolingLayer::AVG && poolLayer->_kernel.size() == spatial) {
+                auto pads = getPaddings(*poolLayer);
+                bool counted = !poolLayer->_exclude_pad;
+                for (size_t i = 0; i < spatial; i++) {
+                    kernel[i] = poolLayer->_kernel[i];
+                    stride[i] = poolLayer->_stride[i];
+                    counted = counted || (pads.begin[i] == 0 && pads.end[i] == 0);
+                }
+                padding = &poolLayer->_padding;
+                padsEnd = &poolLayer->_pads_end;
+                fusable = counted;
+            }
+        }
+        if (!fusable)
+            continue;
+
+        auto pads = getPaddingsImpl(*layer);
+        if (pads.begin.size() != spatial || pads.end.size() != spatial)
+            continue;
+        bool withBegin = false, withEnd = false;
+        for (size_t i = 0; i < spatial && fusable; i++) {
+            const size_t dim = inDims.ndims() - 1 - i;
+            const size_t begin = pads.begin[i] + padBegin[dim];
+            const size_t end = pads.end[i] + padEnd[dim];
+            withBegin = withBegin || begin != 0;
+            withEnd = withEnd || end != 0;
+            // the windows keep at least one point of the input, so the JIT kernels keep the padded tensors
+            fusable = begin < kernel[i] && end < kernel[i];
+            // the pooling divides by the whole window, so it must not cross the end of the padded input
+            if (consumer->getType() == Pooling) {
+                const size_t dst = consumer->getChildEdgeAt(0)->getDims()[dim];
+                fusable = fusable && (dst - 1) * stride[i] + kernel[i] <= outDims[dim] + pads.begin[i] + pads.end[i];
+            }
+        }
+        // the pooling counts the padding in the divisor only if it has the begin pads
+        if (consumer->getType() == Pooling && withEnd && !withBegin)
+            fusable = false;
+        if (!fusable)
+            continue;
+
+        for (size_t i = 0; i < spatial; i++) {
+            const size_t dim = inDims.ndims() - 1 - i;
+            padding->insert(i, pads.begin[i] + padBegin[dim]);
+            padsEnd->insert(i, pads.end[i] + padEnd[dim]);
+        }
+        // the pads are explicit now, the auto_pad would recompute them from the unpadded input
+        layer->params.erase("auto_pad");
+        layer->params["pads_begin"] = joinPads(*padding);
+        layer->params["pads_end"] = joinPads(*padsEnd);
+        if (consumer->getType() == Pooling) {
+            dynamic_cast<PoolingLayer*>(layer)->_exclude_pad = false;
+            layer->params["exclude-pad"] = "false";
+        }
+
+        consumer->inDims[0] = inDims;
+        graph.DropNode(node);
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseBroadcastAndConsumers(MKLDNNGraph &graph) {
     std::vector<MKLDNNNodePtr>& graphNodes = graph.GetNodes();
 
+    // a Tile of the axis of size 1 gives the same tensor as the broadcast
+    auto isBroadcast = [](const MKLDNNNodePtr& node) {
+        if (node->getType() == Generic)
+            return node->getTypeStr() == "Broadcast";
+        if (node->getType() != Tile || node->getParentEdges().size() != 1)
+            return false;
+        auto* tileLayer = dynamic_cast<TileLayer*>(node->getCnnLayer().get());
+        const auto& inDims = node->getParentEdgeAt(0)->getDims();
+        return tileLayer != nullptr && tileLayer->axis >= 0 && tileLayer->axis < inDims.ndims() &&
+               inDims[tileLayer->axis] == 1;
+    };
+
+    // the eltwise reads the axes of size 1 of its inputs in the broadcasting mode, the gemm reads the batch
+    // axes of size 1 with the zero offsets
+    auto readsBroadcasted = [](const MKLDNNEdgePtr& edge, const MKLDNNDims& srcDims) {
+        auto child = edge->getChild();
+        const auto& dstDims = edge->getDims();
+        if (child->getType() == Eltwise) {
+            if (srcDims.ndims() > dstDims.ndims() || dstDims.ndims() > 5)
+                return false;
+            for (int i = 1; i <= srcDims.ndims(); i++) {
+                if (srcDims[srcDims.ndims() - i] != 1 && srcDims[srcDims.ndims() - i] != dstDims[dstDims.ndims() - i])
+                    return false;
+            }
+            return true;
+        }
+        if (child->getType() == Gemm) {
+            if (srcDims.ndims() != dstDims.ndims())
+                return false;
+            for (int i = 0; i < dstDims.ndims(); i++) {
+                if (srcDims[i] != dstDims[i] && (srcDims[i] != 1 || i >= dstDims.ndims() - 2))
+                    return false;
+            }
+            return true;
+        }
+        return false;
+    };
+
     for (auto &graphNode : graphNodes) {
-        if (graphNode->getType() != Generic
-                || graphNode->getTypeStr() != "Broadcast"
-                || graphNode->getChildEdges().size() != 1lu
-                || graphNode->getChildEdgeAt(0)->getChild()->getType() != Eltwise)
+        if (!isBroadcast(graphNode) || graphNode->getChildEdges().empty())
             continue;
 
         MKLDNNNodePtr& broadcastNode = graphNode;
-        MKLDNNNodePtr eltwiseNode = broadcastNode->getChildEdgeAt(0)->getChild();
-        eltwiseNode->inDims[broadcastNode->getChildEdgeAt(0)->getOutputNum()]
-                = broadcastNode->getParentEdgeAt(0)->getDims();
+        const auto srcDims = broadcastNode->getParentEdgeAt(0)->getDims();
+        bool isFusable = true;
+        for (size_t i = 0; i < broadcastNode->getChildEdges().size(); i++)
+            isFusable = isFusable && readsBroadcasted(broadcastNode->getChildEdgeAt(i), srcDims);
+        if (!isFusable)
+            continue;
+
+        for (size_t i = 0; i < broadcastNode->getChildEdges().size(); i++) {
+            auto childEdge = broadcastNode->getChildEdgeAt(i);
+            childEdge->getChild()->inDims[childEdge->getOutputNum()] = srcDims;
+        }
 
         auto& edges = graph.GetEdges();
         for (size_t i = 1lu; i < broadcastNode->getParentEdges().size(); i++) {
@@ -1701,3 +2099,158 @@ void MKLDNNGraphOptimizer::FuseBroadcastAndEltwise(MKLDNNGraph &graph) {
         graph.DropNode(broadcastNode);
     }
 }
+
+#if defined(COMPILED_CPU_MKLDNN_MHA_NODE)
+void MKLDNNGraphOptimizer::FuseMultiHeadAttention(MKLDNNGraph &graph) {
+    auto isPermute = [](const MKLDNNNodePtr& node, const std::vector<int>& order) {
+        return node->getType() == Permute && node->getParentEdges().size() == 1 && node->getChildEdges().size() == 1 &&
+               node->getParentEdgeAt(0)->getDims().ndims() == 4 && node->getCnnLayer()->GetParamAsInts("order") == order;
+    };
+
+    auto getSingleChild = [](const MKLDNNNodePtr& node) -> MKLDNNNodePtr {
+        return node->getChildEdges().size() == 1 ? node->getChildEdgeAt(0)->getChild() : nullptr;
+    };
+
+    auto isSutableMask = [](const MKLDNNDims& maskDims, const MKLDNNDims& scoresDims) {
+        if (maskDims.ndims() != 4 || maskDims[3] != scoresDims[3])
+            return false;
+        for (int i = 0; i < 3; i++) {
+            if (maskDims[i] != 1 && maskDims[i] != scoresDims[i])
+                return false;
+        }
+        return true;
+    };
+
+    const std::vector<int> headsFirst = {0, 2, 1, 3};
+    const std::vector<int> headsFirstTransposed = {0, 2, 3, 1};
+
+    std::vector<MKLDNNNodePtr> newNodes;
+    for (auto& node : graph.GetNodes()) {
+        // Q * K^T
+        if (node->getType() != Gemm || node->getParentEdges().size() != 2)
+            continue;
+        auto* qkLayer = dynamic_cast<GemmLayer*>(node->getCnnLayer().get());
+        if (qkLayer == nullptr || qkLayer->transpose_a)
+            continue;
+
+        auto queryPermute = node->getParentEdgeAt(0)->getParent();
+        auto keyPermute = node->getParentEdgeAt(1)->getParent();
+        if (!isPermute(queryPermute, headsFirst) ||
+            !isPermute(keyPermute, qkLayer->transpose_b ? headsFirst : headsFirstTransposed))
+            continue;
+
+        std::vector<MKLDNNNodePtr> pattern = {queryPermute, keyPermute, node};
+        float scale = qkLayer->alpha;
+        auto scoresDims = node->getChildEdges().empty() ? MKLDNNDims() : node->getChildEdgeAt(0)->getDims();
+        auto cur = getSingleChild(node);
+
+        // optional scale
+        if (cur && cur->getType() == Power) {
+            auto* powerLayer = dynamic_cast<PowerLayer*>(cur->getCnnLayer().get());
+            if (powerLayer == nullptr || powerLayer->power != 1.0f || powerLayer->offset != 0.0f)
+                continue;
+            scale *= powerLayer->scale;
+            pattern.push_back(cur);
+            cur = getSingleChild(cur);
+        }
+
+        // optional attention mask
+        MKLDNNEdgePtr maskEdge;
+        if (cur && cur->getType() == Eltwise) {
+            auto* eltwiseLayer = dynamic_cast<EltwiseLayer*>(cur->getCnnLayer().get());
+            if (eltwiseLayer == nullptr || eltwiseLayer->_operation != EltwiseLayer::Sum ||
+                cur->getParentEdges().size() != 2 ||
+                std::any_of(eltwiseLayer->coeff.begin(), eltwiseLayer->coeff.end(), [](float c) { return c != 1.0f; }))
+                continue;
+            int scoresPort = cur->getParentEdgeAt(0)->getParent() == pattern.back() ? 0 : 1;
+            maskEdge = cur->getParentEdgeAt(1 - scoresPort);
+            if (maskEdge->getParent() == pattern.back() || !isSutableMask(maskEdge->getDims(), scoresDims))
+                continue;
+            pattern.push_back(cur);
+            cur = getSingleChild(cur);
+        }
+
+        if (!cur || cur->getType() != SoftMax)
+            continue;
+        auto* softmaxLayer = dynamic_cast<SoftMaxLayer*>(cur->getCnnLayer().get());
+        if (softmaxLayer == nullptr || softmaxLayer->axis != 3)
+            continue;
+        pattern.push_back(cur);
+        cur = getSingleChild(cur);
+
+        // softmax(...) * V
+        if (!cur || cur->getType() != Gemm || cur->getParentEdges().size() != 2 ||
+            cur->getParentEdgeAt(0)->getParent() != pattern.back())
+            continue;
+        auto* svLayer = dynamic_cast<GemmLayer*>(cur->getCnnLayer().get());
+        if (svLayer == nullptr || svLayer->transpose_a || svLayer->transpose_b || svLayer->alpha != 1.0f)
+            continue;
+        auto valuePermute = cur->getParentEdgeAt(1)->getParent();
+        if (!isPermute(valuePermute, headsFirst))
+            continue;
+        pattern.push_back(valuePermute);
+        pattern.push_back(cur);
+
+        // optional permute back to [batch, sequence, heads, head size]
+        auto outputPermute = getSingleChild(cur);
+        bool permuteOutput = outputPermute && isPermute(outputPermute, headsFirst);
+        if (permuteOutput)
+            pattern.push_back(outputPermute);
+        auto lastNode = pattern.back();
+
+        std::vector<MKLDNNEdgePtr> inputEdges = {queryPermute->getParentEdgeAt(0), keyPermute->getParentEdgeAt(0),
+                                                 valuePermute->getParentEdgeAt(0)};
+        std::vector<DataWeakPtr> insData = {queryPermute->getCnnLayer()->insData[0],
+                                            keyPermute->getCnnLayer()->insData[0],
+                                            valuePermute->getCnnLayer()->insData[0]};
+        if (maskEdge) {
+            inputEdges.push_back(maskEdge);
+            insData.push_back(maskEdge->getChild()->getCnnLayer()->insData[maskEdge->getOutputNum()]);
+        }
+
+        CNNLayerPtr layer(new CNNLayer({lastNode->getName(), "MultiHeadAttention", lastNode->getCnnLayer()->precision}));
+        layer->insData = insData;
+        layer->outData = lastNode->getCnnLayer()->outData;
+        MKLDNNNodePtr attentionNode(new MKLDNNMultiHeadAttentionNode(layer, graph.getEngine(), graph.socket));
+        auto* attentionPtr = dynamic_cast<MKLDNNMultiHeadAttentionNode*>(attentionNode.get());
+        if (attentionPtr == nullptr)
+            THROW_IE_EXCEPTION << "Cannot create multi head attention node " << lastNode->getName();
+        attentionPtr->setAttributes(scale, permuteOutput);
+        // eltwise inputs might already be shrunk by broadcast fusing, so the dims are taken from the edges
+        attentionNode->inDims.clear();
+        for (auto& edge : inputEdges)
+            attentionNode->inDims.push_back(edge->getDims());
+        attentionNode->outDims = lastNode->outDims;
+
+        auto& edges = graph.GetEdges();
+        auto connect = [&](const MKLDNNNodePtr& parent, const MKLDNNNodePtr& child, int parentPort, int childPort) {
+            MKLDNNEdgePtr edge(new MKLDNNEdge(parent, child, parentPort, childPort));
+            parent->addEdge(edge);
+            edges.push_back(edge);
+        };
+        for (size_t i = 0; i < inputEdges.size(); i++)
+            connect(inputEdges[i]->getParent(), attentionNode, inputEdges[i]->getInputNum(), static_cast<int>(i));
+        for (size_t i = 0; i < lastNode->getChildEdges().size(); i++) {
+            auto childEdge = lastNode->getChildEdgeAt(i);
+            connect(attentionNode, childEdge->getChild(), 0, childEdge->getOutputNum());
+        }
+
+        for (auto& patternNode : pattern) {
+            std::vector<MKLDNNEdgeWeakPtr> nodeEdges = patternNode->parentEdges;
+            nodeEdges.insert(nodeEdges.end(), patternNode->childEdges.begin(), patternNode->childEdges.end());
+            for (auto& weakEdge : nodeEdges) {
+                auto edge = weakEdge.lock();
+                if (!edge)
+                    continue;
+                edge->drop();
+                edges.erase(std::remove(edges.begin(), edges.end(), edge), edges.end());
+            }
+        }
+
+        newNodes.push_back(attentionNode);
+    }
+    for (auto& node : newNodes) {
+        graph.GetNodes().push_back(node);
+    }
+}
+#endif
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include <functional>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -18,6 +19,22 @@ public:
     void ApplyImplSpecificGraphOptimizations(MKLDNNGraph& graph);
 
 private:
+    /**
+     * @brief The chain of nodes fused into its head: the node matching `head` absorbs its only child while the child
+     * matches `child`, at most `maxLength` of the children are fused
+     */
+    struct ChainFusion {
+        std::function<bool(const MKLDNNNodePtr& node)> head;
+        std::function<bool(const MKLDNNNodePtr& head, const MKLDNNNodePtr& child)> child;
+        size_t maxLength;
+    };
+
+    /**
+     * @brief Applies the chain fusion in a single pass: the heads are collected once and every node is matched
+     * at most once as a head and once as a child, instead of the rescans of the graph
+     */
+    void FuseChains(MKLDNNGraph& graph, const ChainFusion& fusion);
+
     void SLTMTransform(MKLDNNGraph& graph);
     void MergeConversions(MKLDNNGraph& graph);
     void MergeGroupConvolution(MKLDNNGraph& graph);
@@ -25,8 +42,11 @@ private:
     void FuseConvolutionAndActivation(MKLDNNGraph &graph);
     void FuseFullyConnectedAndActivation(MKLDNNGraph &graph);
 #endif
+    void FuseFullyConnectedAndSoftMax(MKLDNNGraph &graph);
+    void FuseSoftMaxAndTopK(MKLDNNGraph &graph);
 #if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
     void FuseConvolutionAndDepthwise(MKLDNNGraph &graph);
+    void FuseGemmAndDepthwise(MKLDNNGraph &graph);
 #endif
     void FuseConvolutionAndSimpleOperation(MKLDNNGraph &graph);
     void FuseConvolutionAndDWConvolution(MKLDNNGraph &graph);
@@ -48,8 +68,18 @@ private:
     void DropConvertReorder(MKLDNNGraph& graph);
 #endif
     void FuseConvolutionAndZeroPoints(MKLDNNGraph &graph);
-    void FuseBroadcastAndEltwise(MKLDNNGraph &graph);
+    /**
+     * @brief Drops the Broadcast and the Tile of the axes of size 1 feeding only the eltwise and gemm nodes, which read
+     * the source tensor along the broadcasted axes directly instead of the materialized copy
+     */
+    void FuseBroadcastAndConsumers(MKLDNNGraph &graph);
+    /**
+     * @brief Folds the zero constant Pad of the spatial axes into the explicit pads of the consumer convolution or
+     * average pooling, the asymmetric pads included
+     */
+    void FusePadAndConsumer(MKLDNNGraph &graph);
     void FuseEltwiseAndSimple(MKLDNNGraph &graph);
+    void FuseMultiHeadAttention(MKLDNNGraph &graph);
 
 
     bool IsOneOf(Type type, std::vector<Type> types);
@@ -5,13 +5,18 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_streams.h"
+#include "mkldnn_exec_network.h"
+#include "mkldnn_memory_state.h"
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <map>
 #include <blob_factory.hpp>
+#include <ie_memcpy.h>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
+#include "utils/precision_convert.h"
 
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                                      InferenceEngine::OutputsDataMap networkOutputs)
@@ -32,113 +37,158 @@ template <typename T> void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std
     graph->PushInputData(inputName, inputBlob);
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
-    IE_PROFILING_AUTO_SCOPE(MKLDNN_INFER)
+InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::getConversionBlob(const std::string& inputName,
+                                                                              const InferenceEngine::TensorDesc& desc) {
+    auto& blob = conversionBlobs[inputName];
+    if (!blob || blob->getTensorDesc().getDims() != desc.getDims() ||
+            blob->getTensorDesc().getLayout() != desc.getLayout()) {
+        blob = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, desc.getDims(), desc.getLayout()});
+        blob->allocate();
+    }
+    return blob;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::pushConvertedInput(const std::string& inputName,
+                                                          InferenceEngine::Blob::Ptr& inputBlob) {
+    InferenceEngine::Blob::Ptr converted = getConversionBlob(inputName, inputBlob->getTensorDesc());
+    convertToFloat(inputBlob, converted->buffer().as<float*>());
+    pushInput<float>(inputName, converted);
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::canNormalizeInPreprocessing(const std::string& inputName,
+                                                                   const InferenceEngine::Blob::Ptr& inputBlob) const {
+    if (_inputsPreprocessed || _preProcData.find(inputName) == _preProcData.end() || !graph->hasMeanImageFor(inputName))
+        return false;
+
+    const auto& desc = inputBlob->getTensorDesc();
+    if (desc.getPrecision() != InferenceEngine::Precision::U8 && desc.getPrecision() != InferenceEngine::Precision::FP32)
+        return false;
+
+    // the graph ignores the scale and subtracts a mean image in the memory order of the input
+    const auto& info = _networkInputs.at(inputName)->getPreProcess();
+    for (size_t c = 0; c < info.getNumberOfChannels(); c++) {
+        if (info[c]->stdScale != 1.f)
+            return false;
+    }
+    return info.getMeanVariant() == InferenceEngine::MEAN_VALUE ||
+           (info.getMeanVariant() == InferenceEngine::MEAN_IMAGE && desc.getLayout() == InferenceEngine::NCHW);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkGraph() const {
     if (!graph || !graph->IsReady()) {
         THROW_IE_EXCEPTION << "Network not loaded.";
     }
-    auto infer = [this] {
-        // execute input pre-processing.
-        execDataPreprocessing(_inputs);
-
-        changeDefaultPtr();
-        // need to retain converted blobs until infer finish
-        std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
-        for (auto input : _inputs) {
-            if (!_networkInputs[input.first]) {
-                THROW_IE_EXCEPTION <<
-                                   "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
-                                   << input.first;
-            }
+}
 
-            InferenceEngine::Blob::Ptr iconv;
-            InferenceEngine::TBlob<float> *in_f = nullptr;
-            switch (input.second->getTensorDesc().getPrecision()) {
-                case InferenceEngine::Precision::FP32:
-                    pushInput<float>(input.first, input.second);
-                    break;
-                case InferenceEngine::Precision::I32:
-                    pushInput<int32_t>(input.first, input.second);
-                    break;
-                case InferenceEngine::Precision::I8:
-                    pushInput<int8_t>(input.first, input.second);
-                    break;
-                case InferenceEngine::Precision::U16:
-                    // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                      input.second->getTensorDesc().getDims(),
-                                                                      input.second->getTensorDesc().getLayout()});
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    if (in_f == nullptr)
-                        THROW_IE_EXCEPTION << "Cannot get TBlob";
-                    IE_SUPPRESS_DEPRECATED_START
-                    InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                    IE_SUPPRESS_DEPRECATED_END
-                    pushInput<float>(input.first, iconv);
-                    break;
-                case InferenceEngine::Precision::I16:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                          input.second->getTensorDesc().getDims(),
-                                                                          input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        IE_SUPPRESS_DEPRECATED_START
-                        InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
-                        IE_SUPPRESS_DEPRECATED_END
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I16 directly
-                        pushInput<int16_t>(input.first, input.second);
-                    }
-                    break;
-                case InferenceEngine::Precision::U8:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                          input.second->getTensorDesc().getDims(),
-                                                                          input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        IE_SUPPRESS_DEPRECATED_START
-                        InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                        IE_SUPPRESS_DEPRECATED_END
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I8 directly
-                        pushInput<uint8_t>(input.first, input.second);
-                    }
-                    break;
-                default:
-                    THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
-            }
-        }
-        graph->Infer(m_curBatch);
-        graph->PullOutputData(_outputs);
-    };
+void MKLDNNPlugin::MKLDNNInferRequest::executeInArena(const std::function<void()>& task) {
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
     auto_scope_observing observer(graph->ptrObserver);
     // a TBB arena is made "this" for Infer call via executing lambda for the arena
-    graph->ptrArena->execute([&] { infer(); });
+    graph->ptrArena->execute([&] { task(); });
 #else
-    infer();
+    task();
 #endif
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::inferGraph() {
+    if (!bindingsPrepared || bindingsPreprocessed != _inputsPreprocessed)
+        prepareBindings();
+
+    // execute input pre-processing
+    for (auto& input : preparedInputs) {
+        if (input.normalized)
+            _preProcData[input.name]->execute(input.normalized, _networkInputs[input.name]->getPreProcess(), false,
+                                              m_curBatch, true);
+    }
+    if (!preparedPlainInputs.empty())
+        execDataPreprocessing(preparedPlainInputs);
+
+    changeDefaultPtr();
+    for (auto& input : preparedInputs) {
+        if (input.normalized) {
+            graph->PushInputData(input.name, input.normalized, false);
+            continue;
+        }
+
+        switch (input.blob->getTensorDesc().getPrecision()) {
+            case InferenceEngine::Precision::FP32:
+                pushInput<float>(input.name, input.blob);
+                break;
+            case InferenceEngine::Precision::I32:
+                pushInput<int32_t>(input.name, input.blob);
+                break;
+            case InferenceEngine::Precision::I8:
+                pushInput<int8_t>(input.name, input.blob);
+                break;
+            case InferenceEngine::Precision::U16:
+                // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
+                pushConvertedInput(input.name, input.blob);
+                break;
+            case InferenceEngine::Precision::I16:
+                if (graph->hasMeanImageFor(input.name)) {
+                    // If a mean image exists, we convert the blob and send FP32
+                    pushConvertedInput(input.name, input.blob);
+                } else {
+                    // Instead we can send I16 directly
+                    pushInput<int16_t>(input.name, input.blob);
+                }
+                break;
+            case InferenceEngine::Precision::U8:
+                if (graph->hasMeanImageFor(input.name)) {
+                    // If a mean image exists, we convert the blob and send FP32
+                    pushConvertedInput(input.name, input.blob);
+                } else {
+                    // Instead we can send I8 directly
+                    pushInput<uint8_t>(input.name, input.blob);
+                }
+                break;
+            default:
+                THROW_IE_EXCEPTION << "Unsupported input precision " << input.blob->getTensorDesc().getPrecision();
+        }
+    }
+    try {
+        bindStates();
+        graph->Infer(m_curBatch);
+    } catch (...) {
+        restoreStates();
+        throw;
+    }
+    restoreStates();
+    graph->PullOutputData(_outputs);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_INFER)
+    checkGraph();
+    // the graph is chosen again only after an input is set
+    if (graph->getProperty().dynamicShapes && !bindingsPrepared)
+        updateGraphForInputShapes();
+
+    executeInArena([this] {
+        inferGraph();
+    });
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::InferBatch(const InferenceEngine::BlobMap* inputs,
+                                                  InferenceEngine::BlobMap* outputs, size_t count) {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_INFER_BATCH)
+    checkGraph();
+    executeInArena([&] {
+        inferBatchItems(inputs, outputs, count, [this] {
+            checkBlobs();
+            if (graph->getProperty().dynamicShapes && !bindingsPrepared)
+                updateGraphForInputShapes();
+            inferGraph();
+        });
+    });
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     if (!graph || !graph->IsReady())
         THROW_IE_EXCEPTION << "Graph is not ready!";
     graph->GetPerfData(perfMap);
+    getPreprocessingPerformanceCounts(perfMap);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine::Blob::Ptr &data) {
@@ -159,12 +209,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         if (_inputs.find(name) != _inputs.end()) {
             data = _inputs[name];
-            checkBlob(data, name, true);
+            checkBlob(data, name, true, getReferenceDims(data));
             return;
         }
 
         InferenceEngine::TensorDesc desc = blobs[name]->getTensorDesc();
-        InferenceEngine::Precision originPrecision = blobs[name]->getTensorDesc().getPrecision();
         if (_networkInputs.find(name) != _networkInputs.end()) {
             InferenceEngine::Layout l = _networkInputs[name]->getLayout();
             InferenceEngine::Precision p = _networkInputs[name]->getPrecision();
@@ -173,14 +222,14 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
             desc = InferenceEngine::TensorDesc(p, dims, l);
         }
 
+        invalidateBindings();
         _inputs[name] = make_blob_with_precision(desc);
         _inputs[name]->allocate();
-        if (desc.getPrecision() == originPrecision &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+        if (isZeroCopyCompatible(name, _inputs[name])) {
             externalPtr[name] = _inputs[name]->buffer();
         }
         data = _inputs[name];
-        checkBlob(data, name, true);
+        checkBlob(data, name, true, getReferenceDims(data));
         return;
     }
     blobs.clear();
@@ -189,18 +238,18 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     if (blobs.find(name) != blobs.end()) {
         if (_outputs.find(name) != _outputs.end()) {
             data = _outputs[name];
-            checkBlob(data, name, false);
+            checkBlob(data, name, false, getReferenceDims(data));
             return;
         }
 
+        invalidateBindings();
         _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc());
         _outputs[name]->allocate();
-        if (blobs[name]->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (isZeroCopyCompatible(name, _outputs[name])) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
-        checkBlob(data, name, false);
+        checkBlob(data, name, false, getReferenceDims(data));
         return;
     }
     THROW_IE_EXCEPTION << "Cannot find blob with name: " << name;
@@ -208,6 +257,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
 void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const InferenceEngine::Blob::Ptr &data) {
     IE_PROFILING_AUTO_SCOPE(SetBlob)
+    invalidateBindings();
     if (name == nullptr) {
         THROW_IE_EXCEPTION << NOT_FOUND_str + "Failed to set blob with empty name";
     }
@@ -244,20 +294,26 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
         } else {
-            size_t inputSize = foundInput->getTensorDesc().getLayout() != SCALAR
-                ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
-                : 1;
-            if (dataSize != inputSize) {
-                THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
-                                   << dataSize << "!=" << inputSize << ").";
-            }
+            if (graph->getProperty().dynamicShapes) {
+                // the graph is chosen by the input dims on inference
+                if (foundInput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Rank mismatch.";
+                }
+            } else {
+                size_t inputSize = foundInput->getTensorDesc().getLayout() != SCALAR
+                    ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
+                    : 1;
+                if (dataSize != inputSize) {
+                    THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
+                                       << dataSize << "!=" << inputSize << ").";
+                }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Dimensions mismatch.";
+                if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Dimensions mismatch.";
+                }
             }
 
-            if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+            if (isZeroCopyCompatible(name, data)) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
                 externalPtr.erase(name);
@@ -269,22 +325,28 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
                                << "cannot set compound blob: supported only for input pre-processing";
         }
-        size_t outputSize = foundOutput->getTensorDesc().getLayout() != SCALAR
-            ? InferenceEngine::details::product(foundOutput->getDims())
-            : 1;
-        if (dataSize != outputSize) {
-            THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
-                               << dataSize << "!=" << outputSize << ").";
-        }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
+        if (graph->getProperty().dynamicShapes) {
+            // output dims depend on input ones, they are checked on inference
+            if (foundOutput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Rank mismatch.";
+            }
+        } else {
+            size_t outputSize = foundOutput->getTensorDesc().getLayout() != SCALAR
+                ? InferenceEngine::details::product(foundOutput->getDims())
+                : 1;
+            if (dataSize != outputSize) {
+                THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
+                                   << dataSize << "!=" << outputSize << ").";
+            }
+            if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
+            }
         }
         if (foundOutput->getPrecision() != data->getTensorDesc().getPrecision()) {
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
                                << "Failed to set Blob with precision not corresponding to user output precision";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (isZeroCopyCompatible(name, data)) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -293,45 +355,149 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
     }
 }
 
+bool MKLDNNPlugin::MKLDNNInferRequest::isZeroCopyCompatible(const std::string& name,
+                                                            const InferenceEngine::Blob::Ptr& blob) const {
+    // with dynamic batch only a part of the blob is processed
+    if (graph->getProperty().batchLimit)
+        return false;
+
+    MKLDNNEdgePtr edge;
+    auto input = graph->inputNodes.find(name);
+    if (input != graph->inputNodes.end()) {
+        // mean image is subtracted in place, so the user data must not be touched
+        if (graph->hasMeanImageFor(name))
+            return false;
+        edge = input->second->getChildEdgeAt(0);
+    } else {
+        for (auto& out : graph->outputNodes) {
+            if (out->getName() == "out_" + name) {
+                edge = out->getParentEdgeAt(0);
+                break;
+            }
+        }
+    }
+    if (!edge)
+        return false;
+
+    const auto& desc = blob->getTensorDesc();
+    switch (desc.getPrecision()) {
+        case InferenceEngine::Precision::FP32:
+        case InferenceEngine::Precision::I32:
+        case InferenceEngine::Precision::I16:
+        case InferenceEngine::Precision::I8:
+        case InferenceEngine::Precision::U8:
+            break;
+        default:
+            return false;
+    }
+    // primitives consume the edge memory as is, so the blob must have exactly the same precision and layout
+    if (MKLDNNMemoryDesc(desc) != MKLDNNMemoryDesc(edge->getMemory().GetDescriptor()))
+        return false;
+
+    auto ptr = reinterpret_cast<uintptr_t>(blob->buffer().as<void*>());
+    return ptr % desc.getPrecision().size() == 0;
+}
+
 static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
     edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
-    for (auto& it : externalPtr) {
-        auto input = graph->inputNodes.find(it.first);
-        if (input != graph->inputNodes.end()) {
-            if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
-                continue;
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
-                    canBeInPlace = false;
+static inline void changeChildEdgesPtr(const MKLDNNPlugin::MKLDNNNodePtr &node, void *newPtr) {
+    for (size_t i = 0; i < node->getChildEdges().size(); i++)
+        changeEdgePtr(node->getChildEdgeAt(i), newPtr);
+}
+
+/* Checks whether the memory of the input node may be replaced by pointer, i.e. no child views it in place */
+static bool canChangeChildEdgesPtr(const MKLDNNPlugin::MKLDNNNodePtr &input) {
+    // Input cannot be in-place with other primitives
+    for (size_t i = 0; i < input->getChildEdges().size(); i++) {
+        auto& child = input->getChildEdgeAt(i)->getChild();
+        if (child->isConstant())
+            return false;
 #if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
-                auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
-                if (canBeInPlace && concat && concat->isOptimized())
-                    canBeInPlace = false;
+        auto* concat = dynamic_cast<MKLDNNPlugin::MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return false;
 #endif
-                // Cannot be in-place before split because split is using different ptrs without offsets
+        // Cannot be in-place before split because split is using different ptrs without offsets
 #if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
-                auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
-                if (canBeInPlace && split)
-                    canBeInPlace = false;
+        if (dynamic_cast<MKLDNNPlugin::MKLDNNSplitNode *>(child.get()))
+            return false;
 #endif
 
-                if (child->isInplace())
-                    canBeInPlace = false;
-                for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
-                    if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
-                            input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
-                        canBeInPlace = false;
-                }
+        if (child->isInplace())
+            return false;
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
+                    input->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
+                return false;
+        }
+    }
+    return true;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
+    // the edges are resolved by prepareBindings(), another request of the graph may have changed their memory since
+    for (auto& prepared : preparedPtrs) {
+        if (prepared.edges.empty() || prepared.edges[0]->getMemory().GetPrimitive().get_data_handle() == prepared.ptr)
+            continue;
+        for (auto& edge : prepared.edges)
+            changeEdgePtr(edge, prepared.ptr);
+    }
+}
+
+/* Checks whether the memory of the output edge may be replaced by pointer, i.e. no parent writes it in place */
+static bool canChangeParentEdgePtr(const MKLDNNPlugin::MKLDNNNodePtr &output) {
+    void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = output->getParentEdgeAt(0)->getParent();
+    MKLDNNPlugin::MKLDNNNodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace())
+            return false;
+
+        for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+            if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
+                parent = parent->getParentEdgeAt(i)->getParent();
+                break;
             }
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::prepareBindings() {
+    preparedInputs.clear();
+    preparedPlainInputs.clear();
+    for (auto& input : _inputs) {
+        if (!_networkInputs[input.first]) {
+            THROW_IE_EXCEPTION <<
+                               "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
+                               << input.first;
+        }
+
+        // inputs having a mean are converted to FP32 and normalized by the pre-processing itself,
+        // so they are not passed over once again
+        PreparedInput prepared = {input.first, input.second, nullptr};
+        if (canNormalizeInPreprocessing(input.first, input.second)) {
+            prepared.normalized = getConversionBlob(input.first, input.second->getTensorDesc());
+        } else if (_preProcData.find(input.first) != _preProcData.end()) {
+            preparedPlainInputs[input.first] = input.second;
+        }
+        preparedInputs.push_back(std::move(prepared));
+    }
+
+    preparedPtrs.clear();
+    for (auto& it : externalPtr) {
+        PreparedPtr prepared = {{}, it.second};
+        auto input = graph->inputNodes.find(it.first);
+        if (input != graph->inputNodes.end()) {
+            if (canChangeChildEdgesPtr(input->second)) {
+                for (size_t i = 0; i < input->second->getChildEdges().size(); i++)
+                    prepared.edges.push_back(input->second->getChildEdgeAt(i));
             }
+            preparedPtrs.push_back(std::move(prepared));
             continue;
         }
 
@@ -343,43 +509,97 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             }
         }
         if (output) {
-            if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
-                continue;
-            bool canBeInPlace = true;
-            void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = output->getParentEdgeAt(0)->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
-                    if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
-                        parent = parent->getParentEdgeAt(i)->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
-                changeEdgePtr(output->getParentEdgeAt(0), it.second);
+            if (canChangeParentEdgePtr(output))
+                prepared.edges.push_back(output->getParentEdgeAt(0));
+            preparedPtrs.push_back(std::move(prepared));
             continue;
         }
         THROW_IE_EXCEPTION << "Cannot find input/output blob: " << it.first;
     }
+
+    bindingsPrepared = true;
+    bindingsPreprocessed = _inputsPreprocessed;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::invalidateBindings() {
+    blobsChecked = false;
+    bindingsPrepared = false;
+}
+
+std::vector<InferenceEngine::IMemoryStateInternal::Ptr> MKLDNNPlugin::MKLDNNInferRequest::QueryState() {
+    if (!graph || !graph->IsReady())
+        THROW_IE_EXCEPTION << "Graph is not ready!";
+    if (!memoryStates.empty())
+        return memoryStates;
+
+    for (auto& node : graph->GetNodes()) {
+        if (node->getType() != MemoryInput)
+            continue;
+        auto memory = std::make_shared<MKLDNNMemory>(graph->getEngine());
+        memory->Create(node->getChildEdgeAt(0)->getMemory().GetDescriptor());
+        memory->FillZero();
+        stateMemories[node->getName()] = memory;
+
+        // Remove suffix with pair ID. Internal information.
+        auto state_name = node->getName();
+        auto suffix_idx = state_name.find("/id=");
+        if (suffix_idx != std::string::npos)
+            state_name = state_name.substr(0, suffix_idx);
+        memoryStates.emplace_back(new MKLDNNMemoryState(state_name, memory, true));
+    }
+    return memoryStates;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::bindStates() {
+    if (stateMemories.empty())
+        return;
+
+    boundStates.clear();
+    for (auto& node : graph->GetNodes()) {
+        if (node->getType() != MemoryInput)
+            continue;
+        auto found = stateMemories.find(node->getName());
+        auto& storage = node->getChildEdgeAt(0)->getMemory();
+        if (found == stateMemories.end() || found->second->GetSize() != storage.GetSize())
+            THROW_IE_EXCEPTION << "The memory states of the request do not fit the graph: " << node->getName();
+
+        // MemoryOutput writes the next state to the same edges the MemoryInput is read from, so both go to the request
+        BoundState state = {node, found->second, storage.GetData(), {}};
+        if (canChangeChildEdgesPtr(node)) {
+            changeChildEdgesPtr(node, state.memory->GetData());
+        } else {
+            // the edges are viewed in place, so the network state is kept aside while the graph works on a copy
+            auto* data = static_cast<uint8_t*>(state.networkData);
+            state.saved.assign(data, data + storage.GetSize());
+            ie_memcpy(data, storage.GetSize(), state.memory->GetData(), storage.GetSize());
+        }
+        boundStates.push_back(std::move(state));
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::restoreStates() {
+    for (auto& state : boundStates) {
+        if (state.saved.empty()) {
+            changeChildEdgesPtr(state.node, state.networkData);
+        } else {
+            size_t size = state.saved.size();
+            ie_memcpy(state.memory->GetData(), size, state.networkData, size);
+            ie_memcpy(state.networkData, size, state.saved.data(), size);
+        }
+    }
+    boundStates.clear();
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::SetGraph(const MKLDNNPlugin::MKLDNNGraph::Ptr &graph) {
     this->graph = graph;
+    invalidateBindings();
 
     InferenceEngine::BlobMap blobs;
     this->graph->getInputBlobs(blobs);
     for (const auto& it : blobs) {
         InferenceEngine::Blob::Ptr blob;
         GetBlob(it.first.c_str(), blob);
+        graphShapes[it.first] = blob->getTensorDesc().getDims();
     }
     blobs.clear();
     this->graph->getOutputBlobs(blobs);
@@ -387,6 +607,81 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetGraph(const MKLDNNPlugin::MKLDNNGraph:
         InferenceEngine::Blob::Ptr blob;
         GetBlob(it.first.c_str(), blob);
     }
+
+    // preallocate buffers for inputs which are converted to FP32 on every inference
+    for (const auto& it : _networkInputs) {
+        auto precision = it.second->getPrecision();
+        if (precision == InferenceEngine::Precision::U16 ||
+                ((precision == InferenceEngine::Precision::I16 || precision == InferenceEngine::Precision::U8) &&
+                 this->graph->hasMeanImageFor(it.first))) {
+            getConversionBlob(it.first, it.second->getTensorDesc());
+        }
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    if (!graph || !graph->getProperty().dynamicShapes) {
+        if (blobsChecked)
+            return;
+        InferRequestInternal::checkBlobs();
+        blobsChecked = true;
+        return;
+    }
+
+    // dims are not known before the graph is chosen, so only allocation is checked here
+    for (auto const& input : _inputs)
+        checkBlob(input.second, input.first, true, getReferenceDims(input.second));
+    for (auto const& output : _outputs)
+        checkBlob(output.second, output.first, false, getReferenceDims(output.second));
+}
+
+InferenceEngine::SizeVector MKLDNNPlugin::MKLDNNInferRequest::getReferenceDims(const InferenceEngine::Blob::Ptr& blob) const {
+    // empty dims mean that the blob is compared with the network input or output
+    if (!graph->getProperty().dynamicShapes || !blob)
+        return {};
+    return blob->getTensorDesc().getDims();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::updateGraphForInputShapes() {
+    InferenceEngine::ICNNNetwork::InputShapes shapes;
+    for (const auto& input : _inputs)
+        shapes[input.first] = input.second->getTensorDesc().getDims();
+    if (shapes == graphShapes)
+        return;
+
+    auto execNetwork = std::dynamic_pointer_cast<MKLDNNExecNetwork>(_exeNetwork);
+    if (!execNetwork)
+        THROW_IE_EXCEPTION << "Cannot get mkldnn executable network.";
+    graph = execNetwork->GetGraphForShapes(shapes);
+    graphShapes = shapes;
+    invalidateBindings();
+
+    // outputs which do not fit the new dims are reallocated, keeping precision and layout
+    InferenceEngine::BlobMap blobs;
+    graph->getOutputBlobs(blobs);
+    for (const auto& it : blobs) {
+        auto& output = _outputs[it.first];
+        const auto& dims = it.second->getTensorDesc().getDims();
+        if (output && output->getTensorDesc().getDims() == dims)
+            continue;
+        InferenceEngine::TensorDesc desc = it.second->getTensorDesc();
+        if (output)
+            desc = InferenceEngine::TensorDesc(output->getTensorDesc().getPrecision(), dims,
+                                               output->getTensorDesc().getLayout());
+        output = make_blob_with_precision(desc);
+        output->allocate();
+    }
+
+    // edges of the new graph are bound to user memory again
+    externalPtr.clear();
+    for (const auto& input : _inputs) {
+        if (isZeroCopyCompatible(input.first, input.second))
+            externalPtr[input.first] = input.second->buffer();
+    }
+    for (const auto& output : _outputs) {
+        if (isZeroCopyCompatible(output.first, output.second))
+            externalPtr[output.first] = output.second->buffer();
+    }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
@@ -5,9 +5,11 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include <functional>
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -20,6 +22,9 @@ public:
 
     void InferImpl() override;
 
+    /* Enters the threads of the graph once and infers the inputs one after another */
+    void InferBatch(const InferenceEngine::BlobMap* inputs, InferenceEngine::BlobMap* outputs, size_t count) override;
+
     void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 
     /**
@@ -40,11 +45,81 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    /* The blobs are checked once after they are set, the application sets again the blobs it reallocates or reshapes */
+    void checkBlobs() override;
+
+    /**
+     * @brief Gives the request memory states of its own, zero at first. The graph reads and writes them in place of
+     * the states of MKLDNNExecNetwork::QueryState, which keep being used by the requests not calling this method
+     */
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
+
 private:
+    void checkGraph() const;
+    /* Infers the blobs set to the request, in the threads of the graph */
+    void inferGraph();
+    void executeInArena(const std::function<void()>& task);
+
+    /* In the dynamic shapes mode switches to the graph compiled for dims of the current inputs */
+    void updateGraphForInputShapes();
+    InferenceEngine::SizeVector getReferenceDims(const InferenceEngine::Blob::Ptr& blob) const;
+
     template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
+    void pushConvertedInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
+    /* Returns FP32 blob the input is converted to, it is reused across inferences while the shape is the same */
+    InferenceEngine::Blob::Ptr getConversionBlob(const std::string& inputName, const InferenceEngine::TensorDesc& desc);
 
+    /* Checks whether the input can be converted to FP32 and have the mean subtracted by the pre-processing */
+    bool canNormalizeInPreprocessing(const std::string& inputName, const InferenceEngine::Blob::Ptr& inputBlob) const;
+
+    /* Checks whether the blob can be used as memory of the input or output edge without copying */
+    bool isZeroCopyCompatible(const std::string& name, const InferenceEngine::Blob::Ptr& blob) const;
     void changeDefaultPtr();
+
+    /* Resolves the inputs and the zero copy edges of the blobs once, until a blob is set or the graph is changed */
+    void prepareBindings();
+    void invalidateBindings();
+
+    /* For the time of the inference replaces the storage of the MemoryInput nodes by the memory states of the request */
+    void bindStates();
+    void restoreStates();
     MKLDNNGraph::Ptr graph;
     std::map<std::string, void*> externalPtr;
+    std::map<std::string, InferenceEngine::Blob::Ptr> conversionBlobs;
+    // input dims the current graph is compiled for
+    InferenceEngine::ICNNNetwork::InputShapes graphShapes;
+
+    // memory of the states of the request by the names of the MemoryInput nodes, empty until QueryState() is called
+    std::map<std::string, MKLDNNMemoryPtr> stateMemories;
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> memoryStates;
+
+    struct BoundState {
+        MKLDNNNodePtr node;
+        MKLDNNMemoryPtr memory;
+        // storage of the network state the graph gets back after the inference
+        void* networkData;
+        // the network state kept aside while the storage is overwritten, if the edges cannot take another pointer
+        std::vector<uint8_t> saved;
+    };
+    std::vector<BoundState> boundStates;
+
+    struct PreparedInput {
+        std::string name;
+        InferenceEngine::Blob::Ptr blob;
+        // FP32 blob the input is converted and normalized to by the pre-processing, if it has a mean
+        InferenceEngine::Blob::Ptr normalized;
+    };
+    struct PreparedPtr {
+        // the edges taking the memory of the blob, empty if the graph is to copy it
+        std::vector<MKLDNNEdgePtr> edges;
+        void* ptr;
+    };
+    std::vector<PreparedInput> preparedInputs;
+    // the inputs which are not normalized, but are pre-processed
+    InferenceEngine::BlobMap preparedPlainInputs;
+    std::vector<PreparedPtr> preparedPtrs;
+    bool bindingsPrepared = false;
+    bool bindingsPreprocessed = false;  // the value of _inputsPreprocessed the bindings are prepared for
+    bool blobsChecked = false;
 };
 }  // namespace MKLDNNPlugin
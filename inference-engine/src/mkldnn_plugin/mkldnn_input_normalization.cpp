@@ -0,0 +1,196 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_input_normalization.h"
+
+#include <ie_layers.h>
+#include <ie_layers_internal.hpp>
+#include <details/caseless.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace {
+
+CNNLayerPtr getOnlyConsumer(const DataPtr& data) {
+    return data->getInputTo().size() == 1 ? data->getInputTo().begin()->second : nullptr;
+}
+
+bool isFP32(const Blob::Ptr& blob) {
+    return !blob || blob->getTensorDesc().getPrecision() == Precision::FP32;
+}
+
+bool isFoldable(const ConvolutionLayer& conv, bool withShifts) {
+    if (conv.type != "Convolution" || conv.insData.size() != 1 || conv.outData.size() != 1 ||
+        conv.precision != Precision::FP32 || !conv._weights || !isFP32(conv._weights) || !isFP32(conv._biases))
+        return false;
+    if (!withShifts)
+        return true;
+
+    // the same padding grows with the input when the network is reshaped
+    const std::string autoPad = conv.GetParamAsString("auto_pad", "");
+    if (details::CaselessEq<std::string>()(autoPad, "same_upper") || details::CaselessEq<std::string>()(autoPad, "same_lower")) {
+        for (size_t i = 0; i < conv._kernel.size(); i++) {
+            if (conv._kernel[i] != 1)
+                return false;
+        }
+    }
+    auto pads = getPaddings(conv);
+    for (size_t i = 0; i < pads.begin.size(); i++) {
+        if (pads.begin[i] != 0)
+            return false;
+    }
+    for (size_t i = 0; i < pads.end.size(); i++) {
+        if (pads.end[i] != 0)
+            return false;
+    }
+    return true;
+}
+
+// Replaces the weights and the biases of the convolution of x with the ones of the convolution of scales * x + shifts,
+// the shifts may be empty
+bool foldIntoConvolution(ConvolutionLayer& conv, const std::vector<float>& scales, const std::vector<float>& shifts) {
+    const size_t IC = scales.size();
+    const size_t OC = conv._out_depth;
+    const size_t G = conv._group;
+    if (G == 0 || OC == 0 || IC % G != 0 || OC % G != 0)
+        return false;
+    const size_t ICg = IC / G, OCg = OC / G;
+    if (conv._weights->size() % (OC * ICg) != 0 || (conv._biases && conv._biases->size() != OC))
+        return false;
+    const size_t K = conv._weights->size() / (OC * ICg);
+
+    auto weights = make_shared_blob<float>(conv._weights->getTensorDesc());
+    weights->allocate();
+    const float* src = conv._weights->cbuffer().as<const float*>();
+    float* dst = weights->buffer().as<float*>();
+
+    Blob::Ptr biases;
+    float* dstBiases = nullptr;
+    if (!shifts.empty()) {
+        biases = make_shared_blob<float>(conv._biases ? conv._biases->getTensorDesc() :
+                                         TensorDesc(Precision::FP32, {OC}, Layout::C));
+        biases->allocate();
+        dstBiases = biases->buffer().as<float*>();
+    }
+
+    for (size_t oc = 0; oc < OC; oc++) {
+        const size_t g = oc / OCg;
+        float shift = 0.f;
+        for (size_t icg = 0; icg < ICg; icg++) {
+            const size_t ic = g * ICg + icg;
+            const size_t offset = (oc * ICg + icg) * K;
+            for (size_t k = 0; k < K; k++) {
+                dst[offset + k] = src[offset + k] * scales[ic];
+                if (dstBiases)
+                    shift += src[offset + k] * shifts[ic];
+            }
+        }
+        if (dstBiases)
+            dstBiases[oc] = (conv._biases ? conv._biases->cbuffer().as<const float*>()[oc] : 0.f) + shift;
+    }
+
+    conv._weights = weights;
+    conv.blobs["weights"] = weights;
+    if (biases) {
+        conv._biases = biases;
+        conv.blobs["biases"] = biases;
+    }
+    return true;
+}
+
+bool foldScaleShift(details::CNNNetworkImpl& network, const DataPtr& input, size_t channels) {
+    auto scaleShift = std::dynamic_pointer_cast<ScaleShiftLayer>(getOnlyConsumer(input));
+    if (!scaleShift || scaleShift->type != "ScaleShift" || scaleShift->insData.size() != 1 ||
+        scaleShift->outData.size() != 1 || scaleShift->precision != Precision::FP32 ||
+        !isFP32(scaleShift->_weights) || !isFP32(scaleShift->_biases))
+        return false;
+    auto output = scaleShift->outData[0];
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    if (outputs.find(output->getName()) != outputs.end() || output->getPrecision() != Precision::FP32)
+        return false;
+
+    auto getValues = [&](const Blob::Ptr& blob, float defaultValue, std::vector<float>& values) {
+        if (!blob) {
+            values.assign(channels, defaultValue);
+            return true;
+        }
+        if (blob->size() != channels && blob->size() != 1)
+            return false;
+        const float* data = blob->cbuffer().as<const float*>();
+        for (size_t c = 0; c < channels; c++)
+            values.push_back(data[blob->size() == 1 ? 0 : c]);
+        return true;
+    };
+    std::vector<float> scales, shifts;
+    if (!getValues(scaleShift->_weights, 1.f, scales) || !getValues(scaleShift->_biases, 0.f, shifts))
+        return false;
+    bool withShifts = false;
+    for (auto shift : shifts)
+        withShifts = withShifts || shift != 0.f;
+    if (!withShifts)
+        shifts.clear();
+
+    auto conv = std::dynamic_pointer_cast<ConvolutionLayer>(getOnlyConsumer(output));
+    if (!conv || !isFoldable(*conv, withShifts) || !foldIntoConvolution(*conv, scales, shifts))
+        return false;
+
+    input->getInputTo().erase(scaleShift->name);
+    input->getInputTo()[conv->name] = conv;
+    conv->insData[0] = input;
+    network.removeData(output->getName());
+    network.removeLayer(scaleShift->name);
+    return true;
+}
+
+bool foldMeanValues(const InputInfo::Ptr& info, size_t channels) {
+    PreProcessInfo& preProcess = info->getPreProcess();
+    if (preProcess.getMeanVariant() != MEAN_VALUE || preProcess.getNumberOfChannels() != channels)
+        return false;
+
+    // the graph subtracts the mean values only, the scales of the channels are not applied
+    std::vector<float> scales(channels, 1.f), shifts(channels);
+    bool withShifts = false;
+    for (size_t c = 0; c < channels; c++) {
+        shifts[c] = -preProcess[c]->meanValue;
+        withShifts = withShifts || shifts[c] != 0.f;
+    }
+
+    auto conv = std::dynamic_pointer_cast<ConvolutionLayer>(getOnlyConsumer(info->getInputData()));
+    if (!conv || !isFoldable(*conv, withShifts) || !foldIntoConvolution(*conv, scales, shifts))
+        return false;
+
+    // the resize of the pre-processing stays
+    preProcess.init(0);
+    preProcess.setVariant(NONE);
+    return true;
+}
+
+}  // namespace
+
+size_t MKLDNNPlugin::FoldInputNormalization(details::CNNNetworkImpl& network) {
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+
+    size_t folded = 0;
+    for (const auto& input : inputs) {
+        auto data = input.second->getInputData();
+        if (!data || data->getTensorDesc().getDims().size() != 4 || outputs.find(data->getName()) != outputs.end())
+            continue;
+        const size_t channels = data->getTensorDesc().getDims()[1];
+
+        // the mean values are subtracted before the ScaleShift, so the ScaleShift is folded first
+        if (foldScaleShift(network, data, channels))
+            folded++;
+        if (foldMeanValues(input.second, channels))
+            folded++;
+    }
+    return folded;
+}
@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief The header provides a declaration of the folding of the input normalization into the first convolutions
+ * @file
+ */
+#pragma once
+
+#include <cnn_network_impl.hpp>
+
+#include <cstddef>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Folds the per-channel normalization of the network inputs into the weights and the biases of the convolutions
+ * consuming them, so the graph doesn't run a separate pass over the inputs.
+ *
+ * The convolution of s * x + b with the weights W equals the convolution of x with the weights W * s and the biases
+ * increased by the sum of W * b over the input channels and the taps. A ScaleShift which is the only consumer of an
+ * input and feeds only a convolution is removed this way, then the mean values of the pre-processing of the input
+ * are folded the same way with s = 1 and b = -mean and removed from the input info.
+ *
+ * The padding of the convolution reads the zeros of the normalized input, which are not the zeros of the original
+ * one, so the shifts and the means are folded only into the convolutions without padding. The scales alone keep
+ * the zeros and are folded into any convolution. Only the FP32 convolutions with the weights in the blobs are changed,
+ * the mean images are kept.
+ * @param network The network to rewrite
+ * @return The number of the folded normalizations
+ */
+size_t FoldInputNormalization(InferenceEngine::details::CNNNetworkImpl& network);
+
+}  // namespace MKLDNNPlugin
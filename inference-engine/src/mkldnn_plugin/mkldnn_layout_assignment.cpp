@@ -0,0 +1,277 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_layout_assignment.h"
+#include "mkldnn_extension_utils.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// the implementation one step lower in the priority list of the node costs as much as two reorders of its output
+constexpr uint64_t kernelPenaltyPerRank = 2;
+constexpr size_t maxImprovementPasses = 4;
+
+uint64_t edgeElements(const MKLDNNEdgePtr& edge) {
+    return static_cast<uint64_t>((std::max)(edge->getDims().size(), static_cast<ptrdiff_t>(1)));
+}
+
+bool keepsSelection(Type type) {
+    // the nodes decide their layouts from the ones of the neighbours, or are the boundaries of the graph
+    switch (type) {
+        case Input:
+        case Output:
+        case Reorder:
+        case Split:
+        case Concatenation:
+        case MemoryInput:
+        case MemoryOutput:
+        case TensorIterator:
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+MKLDNNLayoutAssignment::MKLDNNLayoutAssignment(const std::vector<MKLDNNNodePtr>& nodes): nodes(nodes) {
+    for (const auto& node : nodes)
+        initCandidates(node);
+}
+
+void MKLDNNLayoutAssignment::initCandidates(const MKLDNNNodePtr& node) {
+    const int selected = node->selectedPrimitiveDescriptorIndex;
+    const auto& descs = node->getSupportedPrimitiveDescriptors();
+    if (selected < 0 || selected >= static_cast<int>(descs.size()))
+        return;
+
+    Candidates& cands = candidates[node.get()];
+    auto add = [&](int index, uint64_t kernel) {
+        if (index == selected)
+            cands.current = cands.indices.size();
+        cands.indices.push_back(index);
+        cands.configs.push_back(descs[index].getConfig());
+        cands.kernel.push_back(kernel);
+    };
+
+    const auto& priority = node->getPrimitivesPriority();
+    auto rankOf = [&](int index) {
+        auto it = std::find(priority.begin(), priority.end(), descs[index].getImplementationType());
+        return static_cast<size_t>(it - priority.begin());
+    };
+    const size_t selectedRank = rankOf(selected);
+    if (keepsSelection(node->getType()) || selectedRank == priority.size()) {
+        add(selected, 0);
+        return;
+    }
+
+    uint64_t elements = 1;
+    for (size_t i = 0; i < node->getChildEdges().size(); i++)
+        elements = (std::max)(elements, edgeElements(node->getChildEdgeAt(i)));
+
+    size_t bestRank = selectedRank;
+    for (int i = 0; i < static_cast<int>(descs.size()); i++) {
+        if (descs[i].getConfig().inConfs.size() <= node->getParentEdges().size())
+            bestRank = (std::min)(bestRank, rankOf(i));
+    }
+    for (int i = 0; i < static_cast<int>(descs.size()); i++) {
+        const size_t rank = rankOf(i);
+        if (i != selected && (rank == priority.size() || descs[i].getConfig().inConfs.size() > node->getParentEdges().size()))
+            continue;
+        add(i, (rank - bestRank) * kernelPenaltyPerRank * elements);
+    }
+}
+
+bool MKLDNNLayoutAssignment::isAssignable(const MKLDNNNodePtr& node) const {
+    auto it = candidates.find(node.get());
+    return it != candidates.end() && it->second.indices.size() > 1;
+}
+
+const InferenceEngine::TensorDesc* MKLDNNLayoutAssignment::outputDesc(const MKLDNNEdgePtr& edge, size_t candidate) const {
+    auto it = candidates.find(edge->getParent().get());
+    if (it == candidates.end())
+        return nullptr;
+    const auto& outConfs = it->second.configs[candidate].outConfs;
+    if (outConfs.empty())
+        return nullptr;
+    // the same fallback to the first output as the one of the greedy selection
+    int port = edge->getInputNum();
+    if (port < 0 || port >= static_cast<int>(outConfs.size()))
+        port = 0;
+    return &outConfs[port].desc;
+}
+
+const InferenceEngine::TensorDesc* MKLDNNLayoutAssignment::inputDesc(const MKLDNNEdgePtr& edge, size_t candidate) const {
+    auto it = candidates.find(edge->getChild().get());
+    if (it == candidates.end())
+        return nullptr;
+    const auto& inConfs = it->second.configs[candidate].inConfs;
+    int port = edge->getOutputNum();
+    if (port < 0 || port >= static_cast<int>(inConfs.size()))
+        return nullptr;
+    return &inConfs[port].desc;
+}
+
+bool MKLDNNLayoutAssignment::needReorder(const MKLDNNEdgePtr& edge, size_t parentCandidate, size_t childCandidate) const {
+    const InferenceEngine::TensorDesc* parentDesc = outputDesc(edge, parentCandidate);
+    const InferenceEngine::TensorDesc* childDesc = inputDesc(edge, childCandidate);
+    return parentDesc != nullptr && childDesc != nullptr &&
+           !MKLDNNExtensionUtils::initTensorsAreEqual(*parentDesc, *childDesc);
+}
+
+uint64_t MKLDNNLayoutAssignment::edgeCost(const MKLDNNEdgePtr& edge, size_t parentCandidate, size_t childCandidate) const {
+    // the constant tensors are reordered once, before the first inference
+    if (edge->getParent()->isConstant() || !needReorder(edge, parentCandidate, childCandidate))
+        return 0;
+    return edgeElements(edge);
+}
+
+uint64_t MKLDNNLayoutAssignment::nodeCost(const MKLDNNNodePtr& node, size_t candidate,
+                                          const MKLDNNEdge* skippedIn, const MKLDNNEdge* skippedOut) const {
+    uint64_t cost = candidates.at(node.get()).kernel[candidate];
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        auto edge = node->getParentEdgeAt(i);
+        auto parent = candidates.find(edge->getParent().get());
+        if (edge.get() != skippedIn && parent != candidates.end())
+            cost += edgeCost(edge, parent->second.current, candidate);
+    }
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        auto edge = node->getChildEdgeAt(i);
+        auto child = candidates.find(edge->getChild().get());
+        if (edge.get() != skippedOut && child != candidates.end())
+            cost += edgeCost(edge, candidate, child->second.current);
+    }
+    return cost;
+}
+
+size_t MKLDNNLayoutAssignment::countReorders() const {
+    size_t reorders = 0;
+    for (const auto& node : nodes) {
+        auto parent = candidates.find(node.get());
+        if (parent == candidates.end())
+            continue;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto edge = node->getChildEdgeAt(i);
+            auto child = candidates.find(edge->getChild().get());
+            if (child != candidates.end() && needReorder(edge, parent->second.current, child->second.current))
+                reorders++;
+        }
+    }
+    return reorders;
+}
+
+MKLDNNEdgePtr MKLDNNLayoutAssignment::chainLink(const MKLDNNNodePtr& node) const {
+    if (node->getChildEdges().size() != 1)
+        return nullptr;
+    auto edge = node->getChildEdgeAt(0);
+    auto child = edge->getChild();
+    if (!isAssignable(child) || child->getParentEdges().size() != 1)
+        return nullptr;
+    return edge;
+}
+
+void MKLDNNLayoutAssignment::assignChain(const std::vector<MKLDNNNodePtr>& chain, const std::vector<MKLDNNEdgePtr>& links) {
+    // best[i][c] is the lowest cost of the nodes up to i with the candidate c selected for the node i
+    std::vector<std::vector<uint64_t>> best(chain.size());
+    std::vector<std::vector<size_t>> from(chain.size());
+    uint64_t currentCost = 0;
+    for (size_t i = 0; i < chain.size(); i++) {
+        const MKLDNNEdge* in = i > 0 ? links[i - 1].get() : nullptr;
+        const MKLDNNEdge* out = i < links.size() ? links[i].get() : nullptr;
+        const Candidates& cands = candidates.at(chain[i].get());
+        best[i].resize(cands.indices.size());
+        from[i].resize(cands.indices.size(), 0);
+        for (size_t c = 0; c < cands.indices.size(); c++) {
+            uint64_t cost = nodeCost(chain[i], c, in, out);
+            if (i > 0) {
+                uint64_t bestIn = std::numeric_limits<uint64_t>::max();
+                for (size_t p = 0; p < best[i - 1].size(); p++) {
+                    uint64_t costIn = best[i - 1][p] + edgeCost(links[i - 1], p, c);
+                    if (costIn < bestIn) {
+                        bestIn = costIn;
+                        from[i][c] = p;
+                    }
+                }
+                cost += bestIn;
+            }
+            best[i][c] = cost;
+        }
+        currentCost += nodeCost(chain[i], cands.current, in, out);
+        if (i > 0)
+            currentCost += edgeCost(links[i - 1], candidates.at(chain[i - 1].get()).current, cands.current);
+    }
+
+    auto last = std::min_element(best.back().begin(), best.back().end());
+    if (*last >= currentCost)
+        return;
+    size_t c = static_cast<size_t>(last - best.back().begin());
+    for (size_t i = chain.size(); i-- > 0;) {
+        candidates.at(chain[i].get()).current = c;
+        c = from[i][c];
+    }
+}
+
+bool MKLDNNLayoutAssignment::improveNode(const MKLDNNNodePtr& node) {
+    Candidates& cands = candidates.at(node.get());
+    size_t selected = cands.current;
+    uint64_t selectedCost = nodeCost(node, selected);
+    for (size_t c = 0; c < cands.indices.size(); c++) {
+        uint64_t cost = nodeCost(node, c);
+        if (cost < selectedCost) {
+            selectedCost = cost;
+            selected = c;
+        }
+    }
+    if (selected == cands.current)
+        return false;
+    cands.current = selected;
+    return true;
+}
+
+size_t MKLDNNLayoutAssignment::Run() {
+    const size_t reordersBefore = countReorders();
+
+    for (const auto& node : nodes) {
+        if (!isAssignable(node))
+            continue;
+        // the chains start at the nodes which are not the continuation of the other ones
+        if (node->getParentEdges().size() == 1) {
+            auto parent = node->getParentEdgeAt(0)->getParent();
+            if (isAssignable(parent) && chainLink(parent))
+                continue;
+        }
+        std::vector<MKLDNNNodePtr> chain = {node};
+        std::vector<MKLDNNEdgePtr> links;
+        for (auto link = chainLink(node); link; link = chainLink(chain.back())) {
+            links.push_back(link);
+            chain.push_back(link->getChild());
+        }
+        assignChain(chain, links);
+    }
+
+    for (size_t pass = 0; pass < maxImprovementPasses; pass++) {
+        bool changed = false;
+        for (const auto& node : nodes) {
+            if (isAssignable(node))
+                changed = improveNode(node) || changed;
+        }
+        if (!changed)
+            break;
+    }
+
+    for (const auto& node : nodes) {
+        if (isAssignable(node)) {
+            const Candidates& cands = candidates.at(node.get());
+            node->selectPrimitiveDescriptorByIndex(cands.indices[cands.current]);
+        }
+    }
+
+    const size_t reordersAfter = countReorders();
+    return reordersBefore > reordersAfter ? reordersBefore - reordersAfter : 0;
+}
@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief The header provides a declaration of MKLDNNLayoutAssignment, the graph-wide selection of the
+ * primitive descriptors of the nodes
+ * @file
+ */
+#pragma once
+
+#include "mkldnn_node.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Reselects the primitive descriptors the nodes picked one by one, so the formats of the neighbours agree
+ * where it costs less than the reorders between them.
+ *
+ * The cost of a descriptor is the penalty of its implementation type, which grows with its place in the priority
+ * list of the node compared to the best one available, plus the reorders of the edges whose formats disagree. Both
+ * are measured in the elements of the tensors, the edges from the constant nodes are free as they are reordered
+ * once. The chains of nodes linked by single edges are assigned exactly by dynamic programming, the rest of the graph
+ * is improved by the passes choosing the cheapest descriptor of each node for the current descriptors of its
+ * neighbours. A node changes its descriptor only if the cost goes down, so the result is never worse than the
+ * greedy selection.
+ */
+class MKLDNNLayoutAssignment {
+public:
+    /**
+     * @param nodes The nodes of the graph in the topological order, with their descriptors selected
+     */
+    explicit MKLDNNLayoutAssignment(const std::vector<MKLDNNNodePtr>& nodes);
+
+    /**
+     * @brief Runs the assignment and selects the new descriptors of the nodes
+     * @return The number of the reorders the new descriptors eliminate
+     */
+    size_t Run();
+
+private:
+    struct Candidates {
+        std::vector<int> indices;                           // the descriptors of the node which may be selected
+        std::vector<InferenceEngine::LayerConfig> configs;  // their configurations
+        std::vector<uint64_t> kernel;                       // the penalty of the implementation type of each of them
+        size_t current = 0;                                 // the place of the selected descriptor in indices
+    };
+
+    void initCandidates(const MKLDNNNodePtr& node);
+    const InferenceEngine::TensorDesc* outputDesc(const MKLDNNEdgePtr& edge, size_t candidate) const;
+    const InferenceEngine::TensorDesc* inputDesc(const MKLDNNEdgePtr& edge, size_t candidate) const;
+    bool needReorder(const MKLDNNEdgePtr& edge, size_t parentCandidate, size_t childCandidate) const;
+    uint64_t edgeCost(const MKLDNNEdgePtr& edge, size_t parentCandidate, size_t childCandidate) const;
+    uint64_t nodeCost(const MKLDNNNodePtr& node, size_t candidate,
+                      const MKLDNNEdge* skippedIn = nullptr, const MKLDNNEdge* skippedOut = nullptr) const;
+    size_t countReorders() const;
+    bool isAssignable(const MKLDNNNodePtr& node) const;
+    MKLDNNEdgePtr chainLink(const MKLDNNNodePtr& node) const;
+    void assignChain(const std::vector<MKLDNNNodePtr>& chain, const std::vector<MKLDNNEdgePtr>& links);
+    bool improveNode(const MKLDNNNodePtr& node);
+
+    const std::vector<MKLDNNNodePtr>& nodes;
+    std::unordered_map<const MKLDNNNode*, Candidates> candidates;
+};
+
+}  // namespace MKLDNNPlugin
@@ -128,7 +128,8 @@ void MKLDNNMemory::SetData(const MKLDNNMemory& memory, bool ftz) const {
     mkldnn::reorder reorderPrim(memory.GetPrimitive(), GetPrimitive());
     mkldnn::stream(stream::kind::eager).submit({reorderPrim});
 
-    if (ftz && memory.GetDataType() == mkldnn::memory::f32 && GetFormat() != mkldnn::memory::wino_fmt) {
+    if (ftz && memory.GetDataType() == mkldnn::memory::f32 && GetDataType() == mkldnn::memory::f32 &&
+            GetFormat() != mkldnn::memory::wino_fmt) {
         // Internal blobs haven't strides yet.
         auto *memData = static_cast<float *>(GetData());
         memData += prim->get_primitive_desc().desc().data.layout_desc.blocking.offset_padding;
@@ -525,6 +526,9 @@ MKLDNNMemoryDesc::operator InferenceEngine::TensorDesc() const {
         case mkldnn_f32:
             precision = Precision::FP32;
             break;
+        case mkldnn_bf16:
+            precision = Precision::BF16;
+            break;
         case mkldnn_u8:
             precision = Precision::U8;
             break;
@@ -966,6 +970,9 @@ MKLDNNMemoryDesc::MKLDNNMemoryDesc(const TensorDesc& tDesc):
         case Precision::FP32:
             data_type = mkldnn::memory::data_type::f32;
             break;
+        case Precision::BF16:
+            data_type = mkldnn::memory::data_type::bf16;
+            break;
         case Precision::U8:
             data_type = mkldnn::memory::data_type::u8;
             break;
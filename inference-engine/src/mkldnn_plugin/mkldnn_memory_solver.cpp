@@ -7,6 +7,8 @@
 #include <details/ie_exception.hpp>
 
 #include <algorithm>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <map>
 
@@ -40,57 +42,117 @@ MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
     _time_duration = ts_f - rm_ts_f;
 }
 
-inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Box &box_old) {
-    if (box_new.id+box_new.size > box_old.id &&
-        box_old.id+box_old.size > box_new.id) {
-        // Move the new one up. There is an intersection
-        box_new.id = box_old.id + box_old.size;
-        return true;
-    } else {
-        return false;
+MemorySolver::MemorySolver(const std::vector<Box>& boxes, const std::vector<std::vector<int>>& dependencies)
+        : _boxes(boxes) {
+    const int num_ts = static_cast<int>(dependencies.size());
+    for (const Box &box : _boxes) {
+        if (box.start < 0 || box.start >= num_ts || box.finish < -1 || box.finish >= num_ts)
+            THROW_IE_EXCEPTION << "Box with id " << box.id << " refers to a timestamp which is out of dependencies";
+    }
+
+    // Transitive closure. Timestamps are topologically ordered, so all successors are processed first.
+    _precedes.assign(num_ts, std::vector<bool>(num_ts, false));
+    for (int ts = num_ts - 1; ts >= 0; ts--) {
+        for (int next : dependencies[ts]) {
+            if (next <= ts || next >= num_ts)
+                THROW_IE_EXCEPTION << "Dependencies are not topologically ordered: " << ts << " -> " << next;
+            _precedes[ts][next] = true;
+            for (int i = next + 1; i < num_ts; i++)
+                if (_precedes[next][i]) _precedes[ts][i] = true;
+        }
     }
+    _time_duration = num_ts;
+}
+
+bool MemorySolver::isLive(const Box &box, int time) const {
+    if (_precedes.empty())
+        return box.start <= time && time <= box.finish;
+
+    return (box.start == time || _precedes[box.start][time]) &&
+           (box.finish == -1 || box.finish == time || _precedes[time][box.finish]);
 }
 
-int64_t MemorySolver::solve() {
-    maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
-    std::vector<std::vector<const Box*>> time_slots(_time_duration);
-    for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
+bool MemorySolver::intersects(const Box &l, const Box &r) const {
+    if (_precedes.empty())
+        return l.start <= r.finish && r.start <= l.finish;
 
+    // -1 means "till to end", so such box never precedes others
+    bool l_before_r = l.finish != -1 && _precedes[l.finish][r.start];
+    bool r_before_l = r.finish != -1 && _precedes[r.finish][l.start];
+    return !l_before_r && !r_before_l;
+}
+
+int64_t MemorySolver::place(Strategy strategy, std::map<int64_t, int64_t>& offsets) const {
     // Sort be box size. First is biggest
-    // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
+    std::vector<Box> boxes(_boxes);
+    std::sort(boxes.begin(), boxes.end(), [](const Box& l, const Box& r)
         { return l.size > r.size; });
 
     int64_t _min_required = 0;
 
-    for (Box& box : _boxes) {
-        // start from bottom and will lift it up if intersect with other present
-        int64_t id = box.id;
-        box.id = 0;  // id will be used as a temp offset storage
-        bool popped_up;
-        do {
-            popped_up = false;
-            for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
-                for (auto *box_in_slot : time_slots[i_slot]) {
-                    // intersect with already stored boxes for all covered time slots
-                    // and move up the new one if needed
-                    popped_up |= popupTogetherWith(box, *box_in_slot);
+    std::vector<std::pair<const Box*, int64_t>> placed;
+    placed.reserve(boxes.size());
+    std::vector<std::pair<int64_t, int64_t>> busy;  // [begin, end) of memory used by intersected boxes
+
+    for (const Box& box : boxes) {
+        busy.clear();
+        for (const auto &item : placed) {
+            if (intersects(box, *item.first))
+                busy.emplace_back(item.second, item.second + item.first->size);
+        }
+        std::sort(busy.begin(), busy.end());
+
+        int64_t offset = 0;
+        if (strategy == Strategy::FirstFit) {
+            // lowest position where the box doesn't intersect with others
+            for (const auto &range : busy) {
+                if (range.first >= offset + box.size) break;
+                offset = std::max(offset, range.second);
+            }
+        } else {
+            // the smallest hole where the box fits, or the top of all intersected boxes
+            int64_t top = 0;
+            int64_t best_hole = std::numeric_limits<int64_t>::max();
+            int64_t best_offset = -1;
+            for (const auto &range : busy) {
+                int64_t hole = range.first - top;
+                if (hole >= box.size && hole < best_hole) {
+                    best_hole = hole;
+                    best_offset = top;
                 }
+                top = std::max(top, range.second);
             }
-        } while (popped_up);
+            offset = best_offset != -1 ? best_offset : top;
+        }
 
-        // add current box to covered time slot
-        for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
-            time_slots[i_slot].push_back(&box);
+        placed.emplace_back(&box, offset);
+        offsets[box.id] = offset;
 
         // store the max top bound for each box
-        _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;
+        _min_required = std::max(_min_required, offset + box.size);
     }
 
     return _min_required;
 }
 
+int64_t MemorySolver::solve(Strategy strategy) {
+    _offsets.clear();
+    if (strategy == Strategy::Auto) {
+        std::map<int64_t, int64_t> best_fit_offsets;
+        int64_t first_fit = place(Strategy::FirstFit, _offsets);
+        int64_t best_fit = place(Strategy::BestFit, best_fit_offsets);
+        if (best_fit < first_fit) {
+            _offsets.swap(best_fit_offsets);
+            _solution = best_fit;
+        } else {
+            _solution = first_fit;
+        }
+    } else {
+        _solution = place(strategy, _offsets);
+    }
+    return _solution;
+}
+
 int64_t MemorySolver::maxDepth() {
     if (_depth == -1) calcDepth();
     return _depth;
@@ -101,6 +163,12 @@ int64_t MemorySolver::maxTopDepth() {
     return _top_depth;
 }
 
+double MemorySolver::fragmentation() {
+    if (_solution == -1) THROW_IE_EXCEPTION << "Memory solver should be solved before fragmentation is requested";
+    if (_solution == 0) return 0.;
+    return 1. - static_cast<double>(maxDepth()) / static_cast<double>(_solution);
+}
+
 int64_t MemorySolver::getOffset(int id) const {
     auto res = _offsets.find(id);
     if (res == _offsets.end()) THROW_IE_EXCEPTION << "There are no box for provided ID";
@@ -110,6 +178,24 @@ int64_t MemorySolver::getOffset(int id) const {
 //======== Private =============//
 
 void MemorySolver::calcDepth() {
+    if (!_precedes.empty()) {
+        // boxes which are alive at the same timestamp intersect with each other
+        _depth = 0;
+        _top_depth = 0;
+        for (int time = 0; time < _time_duration; time++) {
+            int64_t depth = 0, top_depth = 0;
+            for (const Box& box : _boxes) {
+                if (isLive(box, time)) {
+                    depth += box.size;
+                    top_depth++;
+                }
+            }
+            _top_depth = std::max(_top_depth, top_depth);
+            _depth = std::max(_depth, depth);
+        }
+        return;
+    }
+
     int64_t top_depth = 0;
     int64_t depth = 0;
     std::map<int64_t, std::vector<const Box*>> release_at;
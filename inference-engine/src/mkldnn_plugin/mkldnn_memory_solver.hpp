@@ -10,6 +10,7 @@
 
 #include "ie_api.h"
 
+#include <cstdint>
 #include <vector>
 #include <map>
 
@@ -40,6 +41,11 @@ namespace MKLDNNPlugin {
  *
  *  NOTE!
  *  Exec order is predefined.
+ *
+ *  By default the exec order is linear: a timestamp i is finished before i+1 starts. For parallel
+ *  schedules the order can be specified as a partial one, with dependencies between timestamps.
+ *  Then two boxes may share memory only if the last use of one of them is guaranteed to
+ *  precede the first use of other one.
  */
 
 class MemorySolver {
@@ -63,13 +69,33 @@ public:
         int64_t id;
     };
 
+    /** @brief Strategy of box placement */
+    enum class Strategy {
+        /** Boxes sorted by size are placed to the lowest offset where they fit */
+        FirstFit,
+        /** Boxes sorted by size are placed to the smallest hole where they fit */
+        BestFit,
+        /** Both strategies are tried and the one with a smaller result is chosen */
+        Auto,
+    };
+
+    /** @brief Creates a solver for a linear execution order */
     explicit MemorySolver(const std::vector<Box>& boxes);
 
+    /**
+     * @brief Creates a solver for a partial execution order
+     * @param boxes Boxes to place. Box::start and Box::finish are indexes of timestamps in the dependencies.
+     * @param dependencies Each element i holds timestamps which can be started only after timestamp i is finished.
+     *        Timestamps must be enumerated in a topological order, so each dependency index is greater than i.
+     */
+    MemorySolver(const std::vector<Box>& boxes, const std::vector<std::vector<int>>& dependencies);
+
     /**
      * @brief Solve memory location with maximal reuse.
+     * @param strategy Strategy of box placement
      * @return Size of common memory blob required for storing all
      */
-    int64_t solve();
+    int64_t solve(Strategy strategy = Strategy::FirstFit);
 
     /** Provides calculated offset for specified box id */
     int64_t getOffset(int id) const;
@@ -79,13 +105,28 @@ public:
     /** Additional info. Max num of boxes required for any time stamp. */
     int64_t maxTopDepth();
 
+    /**
+     * Additional info. Part of the solution which is lost because of fragmentation, in range [0, 1).
+     * Computed against maxDepth(), which is the lower bound of the solution. Valid after solve().
+     */
+    double fragmentation();
+
 private:
     std::vector<Box> _boxes;
     std::map<int64_t, int64_t> _offsets;
     int64_t _top_depth = -1;
     int64_t _depth = -1;
+    int64_t _solution = -1;
     int _time_duration = -1;
 
+    /** Transitive closure of dependencies (_precedes[i][j] == true if i is finished before j starts).
+     *  Empty for a linear order. */
+    std::vector<std::vector<bool>> _precedes;
+
+    bool isLive(const Box& box, int time) const;
+    bool intersects(const Box& l, const Box& r) const;
+    int64_t place(Strategy strategy, std::map<int64_t, int64_t>& offsets) const;
+
     void calcDepth();
 };
 
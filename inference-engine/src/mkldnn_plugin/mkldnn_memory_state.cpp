@@ -4,6 +4,10 @@
 
 #include "mkldnn_memory_state.h"
 #include "mkldnn_extension_utils.h"
+#include "blob_factory.hpp"
+#include "cpp_interfaces/exception2status.hpp"
+
+#include <cstdint>
 
 using namespace InferenceEngine;
 
@@ -28,8 +32,31 @@ void  MKLDNNMemoryState::SetState(Blob::Ptr newState) {
 }
 
 InferenceEngine::Blob::CPtr MKLDNNMemoryState::GetLastState() const {
-    THROW_IE_EXCEPTION << "GetLastState method is not implemented for MemoryState";
-    return nullptr;
+    // the blob views the storage, so it is valid until the next inference changes the state
+    InferenceEngine::TensorDesc desc = MKLDNNMemoryDesc(storage->GetDescriptor());
+    return make_blob_with_precision(desc, storage->GetData());
+}
+
+void MKLDNNMemoryState::BindState(Blob::Ptr state) {
+    if (!bindable)
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "The memory state " << name
+                           << " is shared by the requests, only the states of a request can be bound";
+    if (!state) {
+        storage->GetPrimitivePtr()->set_data_handle(ownData);
+        boundState.reset();
+        return;
+    }
+
+    const auto& desc = state->getTensorDesc();
+    // the primitives consume the state as is, so the blob must have exactly the same precision and layout
+    if (MKLDNNMemoryDesc(desc) != MKLDNNMemoryDesc(storage->GetDescriptor()) || state->byteSize() < storage->GetSize())
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "The blob does not match the memory state " << name;
+    void* data = state->buffer();
+    if (data == nullptr || reinterpret_cast<uintptr_t>(data) % desc.getPrecision().size() != 0)
+        THROW_IE_EXCEPTION << "The blob of the memory state " << name << " is not allocated or misaligned";
+
+    storage->GetPrimitivePtr()->set_data_handle(data);
+    boundState = state;
 }
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
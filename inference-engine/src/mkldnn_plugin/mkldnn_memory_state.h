@@ -13,17 +13,23 @@ namespace MKLDNNPlugin {
 
 class MKLDNNMemoryState : public InferenceEngine::IMemoryStateInternal {
 public:
-    MKLDNNMemoryState(std::string name, MKLDNNMemoryPtr storage) :
-            name(name), storage(storage) {}
+    /* Only the states owned by an infer request are bindable, the graph reads them by pointer on every inference */
+    MKLDNNMemoryState(std::string name, MKLDNNMemoryPtr storage, bool bindable = false) :
+            name(name), storage(storage), bindable(bindable), ownData(storage->GetData()) {}
 
     std::string GetName() const override;
     void Reset() override;
     void SetState(InferenceEngine::Blob::Ptr newState) override;
     InferenceEngine::Blob::CPtr GetLastState() const override;
+    void BindState(InferenceEngine::Blob::Ptr state) override;
 
 private:
     std::string name;
     MKLDNNMemoryPtr storage;
+    bool bindable;
+    // the memory the storage was allocated with and the blob it is bound to
+    void* ownData;
+    InferenceEngine::Blob::Ptr boundState;
 };
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
@@ -8,8 +8,10 @@
 #include "details/caseless.hpp"
 #include <vector>
 #include <string>
+#include <algorithm>
 #include <limits>
 #include <cstdint>
+#include <set>
 #include <unordered_map>
 
 #include <nodes/mkldnn_batchnorm_node.h>
@@ -44,6 +46,7 @@
 #include <mkldnn_types.h>
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_plugin.h"
+#include "mkldnn/system_conf.h"
 #include "ie_memcpy.h"
 
 using namespace mkldnn;
@@ -109,6 +112,7 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "Memory", MemoryOutput },  // for construction from layer ctor
         { "Convert", Convert },
         { "MVN", MVN},
+        { "MultiHeadAttention", MultiHeadAttention},
 };
 
 Type TypeFromName(const std::string type) {
@@ -466,6 +470,24 @@ const std::vector<MKLDNNEdgePtr> MKLDNNNode::getChildEdgesAtPort(size_t idx) con
 }
 
 
+uint64_t MKLDNNNode::getMemoryTraffic() const {
+    uint64_t bytes = 0;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto edge = getParentEdgeAt(i);
+        bytes += edge->getDims().size() * edge->getDesc().getPrecision().size();
+    }
+    // the edges of the same output port share the memory written once
+    std::set<int> outputPorts;
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        auto edge = getChildEdgeAt(i);
+        if (outputPorts.insert(edge->getInputNum()).second)
+            bytes += edge->getDims().size() * edge->getDesc().getPrecision().size();
+    }
+    for (auto& blob : internalBlobs)
+        bytes += blob->byteSize();
+    return bytes;
+}
+
 std::vector<memory::format> MKLDNNNode::getAvailableFormatsForDims(const MKLDNNDims &dims) const {
     if (dims.ndims() == 0)
         return {memory::format::x};
@@ -531,6 +553,25 @@ void MKLDNNNode::initSupportedPrimitiveDescriptors() {
             itpd++;
         }
     }
+
+    preferBF16PrimitiveDescriptors();
+}
+
+void MKLDNNNode::preferBF16PrimitiveDescriptors() {
+    if (!bf16_enabled)
+        return;
+
+    auto isBF16 = [](const PrimitiveDescInfo& pd) {
+        const auto config = pd.getConfig();
+        return !config.inConfs.empty() && config.inConfs[0].desc.getPrecision() == InferenceEngine::Precision::BF16;
+    };
+    if (std::none_of(supportedPrimitiveDescriptors.begin(), supportedPrimitiveDescriptors.end(), isBF16))
+        return;
+
+    supportedPrimitiveDescriptors.erase(std::remove_if(supportedPrimitiveDescriptors.begin(),
+                                                       supportedPrimitiveDescriptors.end(),
+                                                       [&](const PrimitiveDescInfo& pd) { return !isBF16(pd); }),
+                                        supportedPrimitiveDescriptors.end());
 }
 
 void MKLDNNNode::initDescriptor(const InferenceEngine::LayerConfig &config) {
@@ -691,6 +732,7 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
     for (auto &it : internalBlobDesc)
         intDescs.push_back(it(itpd, 0));
 
+    IE_PROFILING_AUTO_SCOPE(MKLDNNNode::ReorderWeights)
     internalBlobMemory.clear();
     for (size_t i = 0; i < internalBlobs.size(); i++) {
         const auto &internalBlob = internalBlobs[i];
@@ -710,6 +752,8 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
             MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
             _ptr->Create(intDescs[i]);
+            // the copy is shared by streams pinned to the same NUMA node, so it should be placed there
+            cpu::bindMemoryToNUMANode(_ptr->GetData(), _ptr->GetSize(), socket);
             _ptr->SetData(memory);
 
             return _ptr;
@@ -717,14 +761,8 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
         MKLDNNMemoryPtr ptr;
         if (weight_caching) {
-            const uint64_t data_hash = Engine::GetWeightsSharing(socket)->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
-
-            const std::string string_hash = name + "_" + std::to_string(i)
-                                            + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
-
-            ptr = Engine::GetWeightsSharing(socket)->findOrCreate(string_hash, create);
+            ptr = Engine::GetWeightsSharing(socket)->findOrCreate(
+                    MKLDNNWeightsSharing::GetKey(internalBlob, intDescs[i]), create);
         } else {
             ptr = create();
         }
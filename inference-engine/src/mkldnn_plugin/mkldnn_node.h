@@ -20,6 +20,8 @@
 #include "mkldnn/iml_type_mapper.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
+#include "mkldnn_primitive_cache.h"
+#include "mkldnn_scratchpad.h"
 #include "mkldnn.hpp"
 
 namespace MKLDNNPlugin {
@@ -69,7 +71,8 @@ enum Type {
     DeformableConvolution,
     TensorIterator,
     Convert,
-    MVN
+    MVN,
+    MultiHeadAttention
 };
 
 Type TypeFromName(const std::string type);
@@ -148,6 +151,8 @@ static std::string NameFromType(Type type) {
             return "TensorIterator";
         case Convert:
             return "Convert";
+        case MultiHeadAttention:
+            return "MultiHeadAttention";
         default:
             return "Unknown";
     }
@@ -386,6 +391,15 @@ public:
         THROW_IE_EXCEPTION << "Primitive descriptor was not found for node " << getName() << ".";
     }
 
+    /**
+     * @brief Sets prim to a primitive P created for prim_desc and its inputs and outputs, or to the same primitive
+     * left in the process-wide cache by a destroyed node
+     */
+    template <class P, class PD, typename... Args>
+    void createCachedPrimitive(const PD& prim_desc, const Args&... args) {
+        prim = MKLDNNPrimitiveCache::getInstance()->getOrCreate<P>(engine, prim_desc, args...);
+    }
+
     static void invertVectorCopyUtoI(const InferenceEngine::PropertyVector<unsigned int>& src, std::vector<ptrdiff_t>& dst) {
         dst.clear();
         for (int i = 1; i <= src.size(); i++) {
@@ -403,6 +417,38 @@ public:
         return typeStr;
     }
 
+    /**
+     * @brief Returns the format of the weights if the node keeps them other than the dense blob of its primitive,
+     * the empty string otherwise
+     */
+    virtual std::string getWeightsFormat() const {
+        return {};
+    }
+
+    /**
+     * @brief Returns the theoretical number of operations of an execution of the node computed from its shapes,
+     * a multiply-add counts as 2 operations. Returns 0 for the nodes which only move data
+     */
+    virtual uint64_t getFlops() const {
+        return 0;
+    }
+
+    /**
+     * @brief Returns the bytes of the inputs, the outputs and the weights an execution of the node reads and writes
+     */
+    uint64_t getMemoryTraffic() const;
+
+    /**
+     * @brief Returns the bytes of the temporary memory a thread executing the node needs, see MKLDNNScratchpad
+     */
+    virtual size_t getScratchpadSize() const {
+        return 0;
+    }
+
+    virtual void setScratchpad(const MKLDNNScratchpad::Ptr& graphScratchpad) {
+        scratchpad = graphScratchpad;
+    }
+
     virtual size_t descInputNumbers(MKLDNNDescriptor desc) {
         return desc.inputNumbers();
     }
@@ -470,10 +516,13 @@ protected:
     std::vector<MKLDNNDescriptor> descs;
 
     InferenceEngine::Blob::Ptr ext_scales;
+    // the temporary memory of the graph, the region of the calling thread is at least getScratchpadSize() bytes
+    MKLDNNScratchpad::Ptr scratchpad;
 
     friend class MKLDNNEdge;
     friend class MKLDNNGraph;
     friend class MKLDNNGraphOptimizer;
+    friend class MKLDNNLayoutAssignment;
 
     bool isUninitTensorDesc(const InferenceEngine::TensorDesc& desc) const;
     bool isInitConfig(const InferenceEngine::LayerConfig& config) const;
@@ -493,6 +542,17 @@ protected:
     //       Remove this flag when graph clone functionality will be added.
     void enableWeightCaching(bool val) { weight_caching = val; }
 
+    // Allows the node to be executed in BF16 if it has kernels for it. The nodes which are sensitive
+    // to the precision (softmax, normalization, detection output) ignore it and stay in FP32.
+    void enableBF16(bool val) { bf16_enabled = val; }
+    bool isBF16Enabled() const { return bf16_enabled; }
+
+    /**
+     * @brief Drops the FP32 primitive descriptors if there are BF16 ones, so the BF16 kernels are selected
+     * regardless of the precision of the neighbours. The reorders to FP32 are inserted by the graph.
+     */
+    void preferBF16PrimitiveDescriptors();
+
     InferenceEngine::Blob::Ptr createInternalBlob(InferenceEngine::SizeVector dims, bool weights, bool is_grouped = false);
 
     InferenceEngine::Layout getWeightsLayoutByDims(InferenceEngine::SizeVector dims, bool isGrouped);
@@ -510,6 +570,7 @@ private:
     int execIndex = -1;
     int socket;
     bool weight_caching = false;
+    bool bf16_enabled = false;
 
     std::string typeToStr(Type type);
 
@@ -6,9 +6,17 @@
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_layers_dispatcher.hpp"
+#include "mkldnn_primitive_cache.h"
+#include <cpu_isa_traits.hpp>
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include <cpp_interfaces/base/ie_executable_network_base.hpp>
+#include <cpp/ie_cnn_net_reader.h>
+#include <xml_parse_utils.h>
+#include <pugixml.hpp>
 #include <memory>
+#include <fstream>
 #include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
 #include <vector>
 #include <tuple>
 
@@ -71,9 +79,85 @@ Engine::LoadExeNetworkImpl(const ICore * /*core*/, InferenceEngine::ICNNNetwork
     return std::make_shared<MKLDNNExecNetwork>(network, conf, extensionManager);
 }
 
+IExecutableNetwork::Ptr Engine::ImportNetwork(const std::string &modelFileName,
+                                              const std::map<std::string, std::string> &config) {
+    std::ifstream modelFile(modelFileName, std::ios::in | std::ios::binary);
+    if (!modelFile.is_open())
+        THROW_IE_EXCEPTION << details::as_status << NETWORK_NOT_READ << "Cannot open file " << modelFileName;
+    return ImportNetwork(modelFile, config);
+}
+
+InferenceEngine::ExecutableNetwork
+Engine::ImportNetworkImpl(std::istream &networkModel, const std::map<std::string, std::string> &config) {
+    using namespace XMLParseUtils;
+    std::string headerString;
+    std::getline(networkModel, headerString);
+    pugi::xml_document header;
+    if (!header.load_buffer(headerString.data(), headerString.size()))
+        THROW_IE_EXCEPTION << details::as_status << NETWORK_NOT_READ << "The model is not exported by the CPU plugin";
+    auto cpuNode = header.child("cpu");
+
+    // the config of the exported network, the keys passed to the import take precedence
+    Config conf = engConfig;
+    std::map<std::string, std::string> importedConfig;
+    auto configsNode = cpuNode.child("configs");
+    for (auto configNode = configsNode.child("config"); !configNode.empty(); configNode = configNode.next_sibling("config"))
+        importedConfig[GetStrAttr(configNode, "key")] = GetStrAttr(configNode, "value");
+    conf.readProperties(importedConfig);
+    conf.readProperties(config);
+
+    IE_SUPPRESS_DEPRECATED_START
+    CNNNetReader reader;
+    std::string xmlString;
+    std::getline(networkModel, xmlString);
+    reader.ReadNetwork(xmlString.data(), xmlString.size());
+    std::uint64_t dataSize = 0;
+    networkModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    if (0 != dataSize) {
+        auto dataBlob = make_shared_blob<std::uint8_t>(TensorDesc(Precision::U8, {static_cast<std::size_t>(dataSize)}, Layout::C));
+        dataBlob->allocate();
+        networkModel.read(dataBlob->buffer(), dataSize);
+        reader.SetWeights(std::move(dataBlob));
+    }
+    CNNNetwork network = reader.getNetwork();
+    IE_SUPPRESS_DEPRECATED_END
+
+    auto inputs = network.getInputsInfo();
+    auto inputsNode = cpuNode.child("inputs");
+    for (auto inputNode = inputsNode.child("input"); !inputNode.empty(); inputNode = inputNode.next_sibling("input")) {
+        auto &input = inputs.at(GetStrAttr(inputNode, "name"));
+        input->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+        input->setLayout(static_cast<Layout>(GetIntAttr(inputNode, "layout")));
+    }
+
+    auto outputsNode = cpuNode.child("outputs");
+    for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output"))
+        network.addOutput(GetStrAttr(outputNode, "creatorName"), GetUInt64Attr(outputNode, "index"));
+    auto outputs = network.getOutputsInfo();
+    for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+        auto &output = outputs.at(GetStrAttr(outputNode, "name"));
+        output->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+        output->setLayout(static_cast<Layout>(GetIntAttr(outputNode, "layout")));
+    }
+
+    if (conf.enableDynamicBatch) {
+        conf.batchLimit = static_cast<int>(network.getBatchSize());
+    }
+
+    // the precision conversions and the low precision transformations were applied before the export
+    auto impl = std::make_shared<MKLDNNExecNetwork>(static_cast<const ICNNNetwork&>(network), conf, extensionManager, true);
+    impl->setNetworkInputs(inputs);
+    impl->setNetworkOutputs(outputs);
+    impl->SetPointerToPluginInternal(shared_from_this());
+
+    return ExecutableNetwork{IExecutableNetwork::Ptr(new ExecutableNetworkBase<ExecutableNetworkInternal>(impl),
+                                                     [](details::IRelease *p) {p->Release();})};
+}
+
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
+    MKLDNNPrimitiveCache::getInstance()->setCapacity(static_cast<size_t>(engConfig.primitiveCacheCapacity));
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
@@ -111,6 +195,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(CPU_METRIC(PRIMITIVE_CACHE_HITS));
+        metrics.push_back(CPU_METRIC(PRIMITIVE_CACHE_MISSES));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -140,6 +226,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         if (hasAVX512())
             capabilities.push_back(METRIC_VALUE(WINOGRAD));
         capabilities.push_back(METRIC_VALUE(FP32));
+        if (mkldnn::impl::cpu::mayiuse(mkldnn::impl::cpu::avx512_core_bf16))
+            capabilities.push_back(METRIC_VALUE(BF16));
         capabilities.push_back(METRIC_VALUE(INT8));
         capabilities.push_back(METRIC_VALUE(BIN));
         IE_SET_METRIC_RETURN(OPTIMIZATION_CAPABILITIES, capabilities);
@@ -154,6 +242,10 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == CPU_METRIC(PRIMITIVE_CACHE_HITS)) {
+        IE_SET_METRIC_RETURN(CPU_PRIMITIVE_CACHE_HITS, MKLDNNPrimitiveCache::getInstance()->getHits());
+    } else if (name == CPU_METRIC(PRIMITIVE_CACHE_MISSES)) {
+        IE_SET_METRIC_RETURN(CPU_PRIMITIVE_CACHE_MISSES, MKLDNNPrimitiveCache::getInstance()->getMisses());
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
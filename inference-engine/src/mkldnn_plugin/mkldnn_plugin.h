@@ -23,41 +23,102 @@ public:
             uint64_t c = i;
             for (int j = 0; j < 8; j++)
                 c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
+            table[0][i] = c;
         }
+        // tables for processing of 8 bytes at once ("slicing-by-8")
+        for (int i = 0; i < kTableSize; i++)
+            for (int k = 1; k < kSlices; k++)
+                table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xff];
     }
     // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
     uint64_t hash(const unsigned char* data, size_t size) const {
         uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+        size_t idx = 0;
+        for (; idx + kSlices <= size; idx += kSlices) {
+            uint64_t word = 0;
+            for (int k = 0; k < kSlices; k++)
+                word |= static_cast<uint64_t>(data[idx + k]) << (8 * k);
+            crc ^= word;
+            crc = table[7][crc & 0xff] ^ table[6][(crc >> 8) & 0xff] ^
+                  table[5][(crc >> 16) & 0xff] ^ table[4][(crc >> 24) & 0xff] ^
+                  table[3][(crc >> 32) & 0xff] ^ table[2][(crc >> 40) & 0xff] ^
+                  table[1][(crc >> 48) & 0xff] ^ table[0][crc >> 56];
+        }
+        for (; idx < size; idx++)
+            crc = table[0][(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
 
         return ~crc;
     }
 
 protected:
     static const int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static const int kSlices = 8;
+    uint64_t table[kSlices][kTableSize];
 };
 
+/**
+ * Cache of read-only internal blobs (reordered weights, biases etc.) shared between all graphs
+ * of the plugin: streams of one executable network and different executable networks.
+ * An entry is alive while at least one node holds it.
+ */
 class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
     MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
                              std::function<MKLDNNMemoryPtr(void)> create) {
-        std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(name_hash);
+        {
+            std::unique_lock<std::mutex> lock(guard);
+            auto found = sharedWeights.find(name_hash);
+            MKLDNNMemoryPtr ptr;
+            if (found != sharedWeights.end() && (ptr = found->second.lock()))
+                return ptr;
+        }
+
+        // the reorder runs without the lock, so the nodes created concurrently don't wait for each other;
+        // if another node has created the same entry meanwhile, its copy is taken and this one is dropped
+        MKLDNNMemoryPtr created = create();
 
-        MKLDNNMemoryPtr ptr;
-        if (found == sharedWeights.end() || !(ptr = found->second.lock())) {
-            ptr = create();
-            sharedWeights[name_hash] = ptr;
+        std::unique_lock<std::mutex> lock(guard);
+        auto& entry = sharedWeights[name_hash];
+        MKLDNNMemoryPtr ptr = entry.lock();
+        if (!ptr) {
+            ptr = created;
+            entry = ptr;
         }
         return ptr;
     }
+
+    /**
+     * Builds a key of an entry. Nodes of different graphs get the same entry if their
+     * source data are equal, are laid out the same way and they need the same target memory layout.
+     * The same bytes read with different source layouts give different target data.
+     */
+    static std::string GetKey(const InferenceEngine::Blob::Ptr& source, const MKLDNNMemoryDesc& target) {
+        const uint64_t data_hash = GetHashFunc().hash(source->cbuffer().as<const unsigned char*>(), source->byteSize());
+
+        std::string key = std::to_string(data_hash) + "_" + std::to_string(source->byteSize());
+        AppendDesc(key, source->getTensorDesc());
+        key += "_" + std::to_string(target.getFormat());
+        AppendDesc(key, target);
+        return key;
+    }
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
+    static void AppendDesc(std::string& key, const InferenceEngine::TensorDesc& desc) {
+        key += std::string("_") + desc.getPrecision().name();
+        for (auto dim : desc.getDims()) key += "_" + std::to_string(dim);
+        const auto& blocking = desc.getBlockingDesc();
+        key += "_b";
+        for (auto dim : blocking.getBlockDims()) key += "_" + std::to_string(dim);
+        key += "_o";
+        for (auto axis : blocking.getOrder()) key += "_" + std::to_string(axis);
+        key += "_s";
+        for (auto stride : blocking.getStrides()) key += "_" + std::to_string(stride);
+        key += "_" + std::to_string(blocking.getOffsetPadding());
+    }
+
     std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
     std::mutex guard;
     static const SimpleDataHash simpleCRC;
@@ -74,6 +135,14 @@ public:
     LoadExeNetworkImpl(const ICore * core, InferenceEngine::ICNNNetwork &network,
                        const std::map<std::string, std::string> &config) override;
 
+    using InferenceEngine::InferencePluginInternal::ImportNetwork;
+
+    InferenceEngine::IExecutableNetwork::Ptr ImportNetwork(const std::string &modelFileName,
+                                                           const std::map<std::string, std::string> &config) override;
+
+    InferenceEngine::ExecutableNetwork ImportNetworkImpl(std::istream &networkModel,
+                                                         const std::map<std::string, std::string> &config) override;
+
     void AddExtension(InferenceEngine::IExtensionPtr extension) override;
     /**
      * @deprecated
@@ -0,0 +1,228 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_primitive_cache.h"
+
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../thirdparty/mkl-dnn/src/common/c_types_map.hpp"
+#include "../../thirdparty/mkl-dnn/src/common/primitive.hpp"
+#include "../../thirdparty/mkl-dnn/src/common/primitive_attr.hpp"
+#include "../../thirdparty/mkl-dnn/src/common/primitive_desc.hpp"
+#include "../../thirdparty/mkl-dnn/src/common/memory_pd.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace mkldnn::impl;
+
+namespace {
+
+/**
+ * @brief Gives access to inputs and outputs of a primitive to point an existing primitive to new memory
+ */
+struct RebindablePrimitive : public mkldnn_primitive {
+    static void rebind(mkldnn_primitive* prim, const std::vector<mkldnn::primitive::at>& io) {
+        auto rebindable = static_cast<RebindablePrimitive*>(prim);
+        size_t i = 0;
+        for (size_t in = 0; in < rebindable->inputs_.size(); in++, i++)
+            rebindable->inputs_[in] = io[i].data;
+        for (size_t out = 0; out < rebindable->outputs_.size(); out++, i++)
+            rebindable->outputs_[out] = io[i].data.primitive;
+    }
+};
+
+template <typename T>
+void append(std::string& key, const T& value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void appendArray(std::string& key, int count, int mask, const T* values) {
+    append(key, count);
+    append(key, mask);
+    key.append(reinterpret_cast<const char*>(values), sizeof(T) * count);
+}
+
+size_t getOpDescSize(primitive_kind_t kind) {
+    switch (kind) {
+        case primitive_kind::convolution: return sizeof(convolution_desc_t);
+        case primitive_kind::deconvolution: return sizeof(deconvolution_desc_t);
+        case primitive_kind::pooling: return sizeof(pooling_desc_t);
+        case primitive_kind::eltwise: return sizeof(eltwise_desc_t);
+        case primitive_kind::softmax: return sizeof(softmax_desc_t);
+        case primitive_kind::lrn: return sizeof(lrn_desc_t);
+        case primitive_kind::batch_normalization: return sizeof(batch_normalization_desc_t);
+        case primitive_kind::inner_product: return sizeof(inner_product_desc_t);
+        case primitive_kind::depthwise: return sizeof(depthwise_desc_t);
+        case primitive_kind::binary_convolution: return sizeof(binary_convolution_desc_t);
+        // concat, sum, reorder, rnn and others create nested primitives bound to the original memory
+        default: return 0;
+    }
+}
+
+void appendPostOps(std::string& key, const post_ops_t& postOps) {
+    append(key, postOps.len_);
+    for (int i = 0; i < postOps.len_; i++) {
+        const auto& entry = postOps.entry_[i];
+        append(key, entry.kind);
+        switch (entry.kind) {
+            case primitive_kind::sum:
+                append(key, entry.sum.scale);
+                append(key, entry.sum.data_type);
+                break;
+            case primitive_kind::eltwise:
+                append(key, entry.eltwise.alg);
+                append(key, entry.eltwise.scale);
+                append(key, entry.eltwise.alpha);
+                append(key, entry.eltwise.beta);
+                break;
+            // JIT kernels embed addresses of post ops data, so they are a part of the key
+            case primitive_kind::depthwise:
+                append(key, entry.depthwise.alg);
+                append(key, entry.depthwise.weights_data);
+                append(key, entry.depthwise.biases_data);
+                break;
+            case primitive_kind::convolution:
+                append(key, entry.dw_conv.in_h);
+                append(key, entry.dw_conv.in_w);
+                append(key, entry.dw_conv.ker_h);
+                append(key, entry.dw_conv.ker_w);
+                append(key, entry.dw_conv.str_h);
+                append(key, entry.dw_conv.str_w);
+                append(key, entry.dw_conv.in_dt);
+                append(key, entry.dw_conv.weights_data);
+                append(key, entry.dw_conv.biases_data);
+                break;
+            case primitive_kind::binarization:
+                append(key, entry.binarization.alg);
+                append(key, entry.binarization.thresholds_data);
+                append(key, entry.binarization.output_mask_data);
+                break;
+            case primitive_kind::quantization:
+                append(key, entry.quantization.alg);
+                append(key, entry.quantization.crop_low_data);
+                append(key, entry.quantization.crop_high_data);
+                append(key, entry.quantization.input_scale_data);
+                append(key, entry.quantization.input_shift_data);
+                append(key, entry.quantization.output_scale_data);
+                append(key, entry.quantization.output_shift_data);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+}  // namespace
+
+MKLDNNPrimitiveCache::Ptr MKLDNNPrimitiveCache::getInstance() {
+    // primitives returned to the cache from the destructors of static objects must find it alive
+    static Ptr instance(new MKLDNNPrimitiveCache());
+    return instance;
+}
+
+std::string MKLDNNPrimitiveCache::getKey(const_mkldnn_primitive_desc_t pd, size_t ioCount) {
+    size_t opDescSize = getOpDescSize(pd->kind());
+    if (opDescSize == 0 || ioCount != static_cast<size_t>(pd->n_inputs() + pd->n_outputs()))
+        return {};
+
+    std::string key(pd->name());
+    key.push_back('\0');
+    append(key, pd->kind());
+    key.append(reinterpret_cast<const char*>(pd->op_desc()), opDescSize);
+
+    append(key, pd->n_inputs());
+    for (int i = 0; i < pd->n_inputs(); i++)
+        append(key, *pd->input_pd(i)->desc());
+    append(key, pd->n_outputs());
+    for (int i = 0; i < pd->n_outputs(); i++)
+        append(key, *pd->output_pd(i)->desc());
+
+    const auto* attr = pd->attr();
+    append(key, attr->round_mode_);
+    appendArray(key, attr->output_scales_.count_, attr->output_scales_.mask_, attr->output_scales_.scales_);
+    appendArray(key, attr->input_zero_points_.count_, attr->input_zero_points_.mask_,
+                attr->input_zero_points_.zero_points_);
+    appendArray(key, attr->weights_zero_points_.count_, attr->weights_zero_points_.mask_,
+                attr->weights_zero_points_.zero_points_);
+    appendArray(key, attr->output_compensations_.count_, attr->output_compensations_.mask_,
+                attr->output_compensations_.shifts_);
+    appendPostOps(key, attr->post_ops_);
+
+    return key;
+}
+
+std::unique_ptr<mkldnn::primitive> MKLDNNPrimitiveCache::acquire(const std::string& key,
+                                                                 const std::vector<mkldnn::primitive::at>& io) {
+    std::unique_ptr<mkldnn::primitive> prim;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = index.find(key);
+        if (found == index.end()) {
+            misses++;
+            return prim;
+        }
+        prim = std::move(found->second->prim);
+        entries.erase(found->second);
+        index.erase(found);
+        hits++;
+    }
+
+    RebindablePrimitive::rebind(prim->get(), io);
+    return prim;
+}
+
+std::shared_ptr<mkldnn::primitive> MKLDNNPrimitiveCache::wrap(const std::string& key, const mkldnn::engine& eng,
+                                                              std::unique_ptr<mkldnn::primitive> prim) {
+    if (key.empty())
+        return std::shared_ptr<mkldnn::primitive>(prim.release());
+
+    // the deleter keeps the engine of the primitive and the cache itself alive
+    Ptr self = getInstance();
+    return std::shared_ptr<mkldnn::primitive>(prim.release(), [self, key, eng](mkldnn::primitive* released) {
+        self->release(key, eng, std::unique_ptr<mkldnn::primitive>(released));
+    });
+}
+
+void MKLDNNPrimitiveCache::release(const std::string& key, const mkldnn::engine& eng,
+                                   std::unique_ptr<mkldnn::primitive> prim) {
+    // dynamic batch patches descriptors of created primitives, such primitives cannot be reused
+    const_mkldnn_primitive_desc_t pd = prim->get_primitive_desc();
+    if (getKey(pd, static_cast<size_t>(pd->n_inputs() + pd->n_outputs())) != key)
+        return;
+
+    std::lock_guard<std::mutex> lock(guard);
+    if (capacity == 0)
+        return;
+    while (entries.size() >= capacity)
+        evictLast();
+    entries.push_front({key, eng, std::move(prim)});
+    index.emplace(key, entries.begin());
+}
+
+void MKLDNNPrimitiveCache::evictLast() {
+    auto last = std::prev(entries.end());
+    auto range = index.equal_range(last->key);
+    for (auto it = range.first; it != range.second; it++) {
+        if (it->second == last) {
+            index.erase(it);
+            break;
+        }
+    }
+    entries.erase(last);
+}
+
+size_t MKLDNNPrimitiveCache::getCapacity() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return capacity;
+}
+
+void MKLDNNPrimitiveCache::setCapacity(size_t newCapacity) {
+    std::lock_guard<std::mutex> lock(guard);
+    capacity = newCapacity;
+    while (entries.size() > capacity)
+        evictLast();
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn.hpp>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Process-wide cache of created mkldnn primitives.
+ *
+ * Creation of a primitive generates its JIT code, which takes most of the LoadNetwork time for big models.
+ * A primitive is completely defined by its primitive descriptor: the operation, memory descriptors, attributes
+ * with post ops and the chosen implementation. So when a graph is destroyed its primitives are kept here, and
+ * a node which needs the same primitive later (after a reshape or on LoadNetwork of a similar network) gets
+ * one of them rebound to its own memory instead of creating a new one.
+ *
+ * A primitive is used by one node at a time: the cache keeps only released primitives, at most `capacity`
+ * of them, and drops the least recently released ones first.
+ */
+class MKLDNNPrimitiveCache {
+public:
+    using Ptr = std::shared_ptr<MKLDNNPrimitiveCache>;
+
+    static Ptr getInstance();
+
+    /**
+     * @brief Returns a primitive P for `pd` bound to `args` (inputs first, then outputs, as for the P
+     * constructor). The primitive is taken from the cache if possible and is returned back there once
+     * the last reference to it is released.
+     */
+    template <typename P, typename PD, typename... Args>
+    std::shared_ptr<mkldnn::primitive> getOrCreate(const mkldnn::engine& eng, const PD& pd, const Args&... args) {
+        std::vector<mkldnn::primitive::at> io = {mkldnn::primitive::at(args)...};
+        std::string key = getKey(pd.get(), io.size());
+        std::unique_ptr<mkldnn::primitive> prim;
+        if (!key.empty())
+            prim = acquire(key, io);
+        if (!prim)
+            prim.reset(new P(pd, args...));
+        return wrap(key, eng, std::move(prim));
+    }
+
+    uint64_t getHits() const {
+        return hits;
+    }
+
+    uint64_t getMisses() const {
+        return misses;
+    }
+
+    size_t getCapacity() const;
+    void setCapacity(size_t newCapacity);
+
+private:
+    struct Entry {
+        std::string key;
+        mkldnn::engine eng;
+        std::unique_ptr<mkldnn::primitive> prim;
+    };
+
+    MKLDNNPrimitiveCache() = default;
+
+    /**
+     * @brief Serializes everything which defines a primitive created from `pd` into a key.
+     * Returns an empty string for primitives which cannot be rebound to other memory.
+     */
+    static std::string getKey(const_mkldnn_primitive_desc_t pd, size_t ioCount);
+    std::unique_ptr<mkldnn::primitive> acquire(const std::string& key, const std::vector<mkldnn::primitive::at>& io);
+    std::shared_ptr<mkldnn::primitive> wrap(const std::string& key, const mkldnn::engine& eng,
+                                            std::unique_ptr<mkldnn::primitive> prim);
+    void release(const std::string& key, const mkldnn::engine& eng, std::unique_ptr<mkldnn::primitive> prim);
+    void evictLast();
+
+    mutable std::mutex guard;
+    size_t capacity = 1024;
+    // the most recently released entries are at the front
+    std::list<Entry> entries;
+    std::unordered_multimap<std::string, std::list<Entry>::iterator> index;
+
+    std::atomic<uint64_t> hits {0};
+    std::atomic<uint64_t> misses {0};
+};
+
+}  // namespace MKLDNNPlugin
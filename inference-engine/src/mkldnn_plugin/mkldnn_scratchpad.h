@@ -0,0 +1,88 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_parallel.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Temporary memory of the nodes of a graph, a region for every thread of the stream.
+ *
+ * The graph reserves the largest region its nodes declare when it is loaded, so the nodes take the region of the
+ * thread they run on instead of allocating their temporary buffers on every inference. A thread runs one node at a
+ * time (the nodes of an execution wave are isolated from each other), so a node may use the region either in the
+ * thread calling execute() or in the bodies of its parallel loops which do not nest other loops, but not in both.
+ */
+class MKLDNNScratchpad {
+public:
+    typedef std::shared_ptr<MKLDNNScratchpad> Ptr;
+
+    /**
+     * @brief Makes the region of every thread at least the given size, takes effect on the next allocate()
+     */
+    void reserve(size_t bytes) {
+        size = std::max(size, (bytes + alignment - 1) / alignment * alignment);
+    }
+
+    /**
+     * @brief Allocates the regions for the threads the calling one may run parallel loops with
+     */
+    void allocate() {
+        threads = std::max(parallel_get_max_threads(), 1);
+        memory.reset(size ? new uint8_t[size * threads + alignment] : nullptr);
+        const auto address = reinterpret_cast<uintptr_t>(memory.get());
+        data = memory ? memory.get() + (alignment - address % alignment) % alignment : nullptr;
+    }
+
+    size_t getSize() const {
+        return size;
+    }
+
+    size_t getTotalSize() const {
+        return memory ? size * threads : 0;
+    }
+
+    /**
+     * @brief Returns the region of the calling thread, aligned to the cache line
+     */
+    template <typename T = uint8_t>
+    T* get() const {
+        return reinterpret_cast<T*>(data + threadIndex() * size);
+    }
+
+private:
+    int threadIndex() const {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+        const int index = tbb::this_task_arena::current_thread_index();
+#elif IE_THREAD == IE_THREAD_OMP
+        // the nodes of a wave run nested regions of one thread, so the innermost region of a team identifies the thread
+        int index = 0;
+        for (int level = omp_get_level(); level > 0; level--) {
+            if (omp_get_team_size(level) > 1) {
+                index = omp_get_ancestor_thread_num(level);
+                break;
+            }
+        }
+#else
+        const int index = 0;
+#endif
+        return index >= 0 && index < threads ? index : 0;
+    }
+
+    static constexpr size_t alignment = 64;
+
+    size_t size = 0;
+    int threads = 0;
+    std::unique_ptr<uint8_t[]> memory;
+    uint8_t* data = nullptr;
+};
+
+}  // namespace MKLDNNPlugin
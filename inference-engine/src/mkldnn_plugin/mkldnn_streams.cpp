@@ -11,11 +11,16 @@
 #include <memory>
 #include <utility>
 #include <future>
+#include <algorithm>
+#include <cmath>
 
 #include "mkldnn_graph.h"
 #include "ie_parallel.hpp"
 #include "mkldnn_streams.h"
 #include "ie_compound_blob.h"
+#include "utils/precision_convert.h"
+#include <details/ie_cnn_network_iterator.hpp>
+#include <ie_algorithm.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -116,6 +121,22 @@ bool pin_current_thread_to_socket(int socket) {
     CPU_FREE(target_mask);
     return res;
 }
+cpu_set_t* restrict_process_mask(int ncpus, const cpu_set_t* proc_mask, const std::vector<int>& processors) {
+    if (proc_mask == nullptr || processors.empty())
+        return nullptr;
+    const size_t size = CPU_ALLOC_SIZE(ncpus);
+    cpu_set_t *target_mask = CPU_ALLOC(ncpus);
+    CPU_ZERO_S(size, target_mask);
+    for (int cpu : processors) {
+        if (cpu < ncpus && CPU_ISSET_S(cpu, size, proc_mask))
+            CPU_SET_S(cpu, size, target_mask);
+    }
+    if (CPU_COUNT_S(size, target_mask) == 0) {
+        CPU_FREE(target_mask);
+        return nullptr;
+    }
+    return target_mask;
+}
 #else   // no threads pinning/binding on Win/MacOS
 bool get_process_mask(int& ncpus, cpu_set_t*& mask) {
     ncpus = 0;
@@ -131,8 +152,89 @@ bool pin_current_thread_by_mask(int ncores, const cpu_set_t* proc_mask) {
 bool pin_current_thread_to_socket(int socket) {
     return false;
 }
+cpu_set_t* restrict_process_mask(int ncpus, const cpu_set_t* proc_mask, const std::vector<int>& processors) {
+    return nullptr;
+}
 #endif  // !(defined(__APPLE__) || defined(_WIN32))
 
+std::vector<stream_placement> place_hybrid_streams(int streams, int threads) {
+    std::vector<int> performance, efficiency;
+    if (streams < 1 || !cpu::getHybridCoreProcessors(performance, efficiency))
+        return {};
+    const int p_cpus = static_cast<int>(performance.size());
+    const int e_cpus = static_cast<int>(efficiency.size());
+    if (streams == 1)
+        return {{performance, 0, std::max(1, std::min(threads, p_cpus))}};
+
+    // the threads are divided between the types first, then among the streams of each type
+    const int p_streams = std::min(streams - 1, std::max(1, (streams * p_cpus + (p_cpus + e_cpus) / 2) / (p_cpus + e_cpus)));
+    const int e_streams = streams - p_streams;
+    const int p_threads = std::min(p_cpus, std::max(p_streams, threads * p_cpus / (p_cpus + e_cpus)));
+    const int e_threads = std::min(e_cpus, std::max(e_streams, threads - p_threads));
+
+    std::vector<stream_placement> placements;
+    for (int s = 0; s < p_streams; s++)
+        placements.push_back({performance, s, std::max(1, p_threads / p_streams)});
+    for (int s = 0; s < e_streams; s++)
+        placements.push_back({efficiency, s, std::max(1, e_threads / e_streams)});
+    return placements;
+}
+
+streams_estimate estimate_streams(const ICNNNetwork& network, int cores) {
+    // the networks doing fewer operations per byte of the weights and activations are limited by the memory bandwidth
+    const double compute_bound_intensity = 8.0;
+    const double l2_per_core = mkldnn_get_cache_size(2, 1);
+    const double llc = mkldnn_get_cache_size(3, 0);
+    cores = std::max(1, cores);
+
+    auto data_bytes = [](const DataPtr& data) {
+        const auto& desc = data->getTensorDesc();
+        size_t elem_size = desc.getPrecision().size();
+        return static_cast<double>(details::product(desc.getDims().begin(), desc.getDims().end()) * (elem_size ? elem_size : sizeof(float)));
+    };
+
+    // the working sets are weighted by the operations of the layers, so the heaviest layers decide
+    double flops = 0.0, bytes = 0.0, activations_set = 0.0, working_set = 0.0;
+    details::CNNNetworkIterator i(const_cast<ICNNNetwork *>(&network));
+    for (; i != details::CNNNetworkIterator(); i++) {
+        CNNLayerPtr layer = *i;
+        double activations = 0.0;
+        for (const auto& in : layer->insData)
+            if (auto data = in.lock()) activations += data_bytes(data);
+        for (const auto& out : layer->outData)
+            activations += data_bytes(out);
+
+        auto weightable = dynamic_cast<WeightableLayer *>(layer.get());
+        if (!weightable || !weightable->_weights || layer->outData.empty()) {
+            bytes += activations;
+            continue;
+        }
+        // every weight is applied once per the output element of its channel
+        const auto& out_dims = layer->outData[0]->getTensorDesc().getDims();
+        const double out_channels = out_dims.size() > 1 ? out_dims[1] : 1;
+        const double layer_flops = 2.0 * weightable->_weights->size() * details::product(out_dims.begin(), out_dims.end()) / out_channels;
+        const double weights = weightable->_weights->byteSize();
+        flops += layer_flops;
+        bytes += weights + activations;
+        activations_set += layer_flops * activations;
+        working_set += layer_flops * (weights + activations);
+    }
+    if (flops == 0.0)
+        return {cores, 1};
+    activations_set /= flops;
+    working_set /= flops;
+
+    int streams;
+    if (flops / bytes >= compute_bound_intensity) {
+        int threads_per_stream = static_cast<int>(std::ceil(activations_set / l2_per_core));
+        streams = cores / std::min(std::max(threads_per_stream, 1), cores);
+    } else {
+        streams = static_cast<int>(llc / working_set);
+    }
+    streams = std::min(std::max(streams, 1), cores);
+    return {streams, cores / streams};
+}
+
 MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<Task>& init_tasks, std::string name) :
         _isStopped(false), _name(name) {
     std::vector<std::packaged_task<void()>> initTasks;
@@ -151,10 +253,8 @@ MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<Task>& init_t
                 {  // waiting for the new task or for stop signal
                     std::unique_lock<std::mutex> lock(_queueMutex);
                     _queueCondVar.wait(lock, [&]() { return !_taskQueue.empty() || _isStopped; });
-                    if (!_taskQueue.empty()) {
-                        currentTask = std::move(_taskQueue.front());
-                        _taskQueue.pop();
-                    }
+                    if (!_taskQueue.empty())
+                        currentTask = _taskQueue.pop();
                 }
                 if (currentTask)
                     currentTask();
@@ -188,13 +288,45 @@ MultiWorkerTaskExecutor::~MultiWorkerTaskExecutor() {
 }
 
 void MultiWorkerTaskExecutor::run(Task task) {
+    runWithPriority(std::move(task), 0);
+}
+
+void MultiWorkerTaskExecutor::runWithPriority(Task task, int priority) {
     {
         std::lock_guard<std::mutex> lock(_queueMutex);
-        _taskQueue.push(std::move(task));
+        _taskQueue.push(std::move(task), priority);
     }
     _queueCondVar.notify_one();
 }
 
+size_t MultiWorkerTaskExecutor::getQueueDepth() {
+    std::lock_guard<std::mutex> lock(_queueMutex);
+    return _taskQueue.size();
+}
+
+float MultiWorkerTaskExecutor::getAverageWaitTime() {
+    std::lock_guard<std::mutex> lock(_queueMutex);
+    const auto& stats = _taskQueue.waitStats();
+    if (stats._startedTasks == 0)
+        return 0.f;
+    return std::chrono::duration<float, std::milli>(stats._totalWaitTime).count() / stats._startedTasks;
+}
+
+float MultiWorkerTaskExecutor::getMaxWaitTime() {
+    std::lock_guard<std::mutex> lock(_queueMutex);
+    return std::chrono::duration<float, std::milli>(_taskQueue.waitStats()._maxWaitTime).count();
+}
+
+std::map<int, float> MultiWorkerTaskExecutor::getAverageWaitTimePerPriority() {
+    std::lock_guard<std::mutex> lock(_queueMutex);
+    std::map<int, float> waitTimes;
+    for (const auto& stats : _taskQueue.priorityWaitStats()) {
+        waitTimes[stats.first] = std::chrono::duration<float, std::milli>(stats.second._totalWaitTime).count() /
+                                 stats.second._startedTasks;
+    }
+    return waitTimes;
+}
+
 MKLDNNPlugin::MKLDNNGraphlessInferRequest::MKLDNNGraphlessInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                                                        InferenceEngine::OutputsDataMap networkOutputs)
         : InferRequestInternal(networkInputs, networkOutputs), m_curBatch(-1) {
@@ -208,118 +340,111 @@ MKLDNNPlugin::MKLDNNGraphlessInferRequest::MKLDNNGraphlessInferRequest(Inference
         InferenceEngine::Blob::Ptr blob;
         GetBlob(it.first.c_str(), blob);
     }
+    // U16 inputs are always converted, other inputs are converted only if the graph has a mean image for them
+    for (const auto& it : networkInputs) {
+        if (it.second->getPrecision() == InferenceEngine::Precision::U16) {
+            const auto& desc = it.second->getTensorDesc();
+            m_conversionBlobs[it.first] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                                                                                   desc.getDims(), desc.getLayout()});
+            m_conversionBlobs[it.first]->allocate();
+        }
+    }
 }
 
 
-void MKLDNNPlugin::MKLDNNGraphlessInferRequest::InferImpl() {
-    IE_PROFILING_AUTO_SCOPE(MKLDNN_INFER)
-
-    auto infer = [this] {
-        IE_ASSERT(MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph != nullptr);
-        MKLDNNGraph::Ptr graph = MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph;
-        if (!graph->IsReady())
-            THROW_IE_EXCEPTION << "Network not loaded.";
-        if (m_curBatch > 0 && !graph->getProperty().enableDynamicBatch)
-            THROW_IE_EXCEPTION << "Dynamic batch is not enabled.";
-
-        if (m_curBatch > graph->getProperty().batchLimit)
-            THROW_IE_EXCEPTION << "Invalid dynamic batch size " << m_curBatch <<
-                               " for this request.";
-
-        // execute input pre-processing.
-        execDataPreprocessing(_inputs);
-
-        // need to retain converted blobs until infer finish
-        std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
-        for (auto input : _inputs) {
-            if (!_networkInputs[input.first]) {
-                THROW_IE_EXCEPTION <<
-                                   "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
-                                   << input.first;
-            }
-            InferenceEngine::Blob::Ptr iconv;
-            InferenceEngine::TBlob<float> *in_f = nullptr;
-            switch (input.second->getTensorDesc().getPrecision()) {
-                case InferenceEngine::Precision::FP32:
-                case InferenceEngine::Precision::I32:
-                case InferenceEngine::Precision::I8:
-                    graph->PushInputData(input.first, input.second);
-                    break;
-                case InferenceEngine::Precision::U16:
-                    // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                      input.second->getTensorDesc().getDims(),
-                                                                      input.second->getTensorDesc().getLayout()});
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    if (in_f == nullptr)
-                        THROW_IE_EXCEPTION << "Cannot get TBlob";
-                    IE_SUPPRESS_DEPRECATED_START
-                    InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                    IE_SUPPRESS_DEPRECATED_END
-                    graph->PushInputData(input.first, iconv);
-                    break;
-                case InferenceEngine::Precision::I16:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                          input.second->getTensorDesc().getDims(),
-                                                                          input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        IE_SUPPRESS_DEPRECATED_START
-                        InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
-                        IE_SUPPRESS_DEPRECATED_END
-                        graph->PushInputData(input.first, iconv);
-                    } else {
-                        // Instead we can send I16 directly
-                        graph->PushInputData(input.first, input.second);
-                    }
-                    break;
-                case InferenceEngine::Precision::U8:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                          input.second->getTensorDesc().getDims(),
-                                                                          input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        IE_SUPPRESS_DEPRECATED_START
-                        InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                        IE_SUPPRESS_DEPRECATED_END
-                        graph->PushInputData(input.first, iconv);
-                    } else {
-                        // Instead we can send I8 directly
-                        graph->PushInputData(input.first, input.second);
-                    }
-                    break;
-                default:
-                    THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
-            }
-        }
-        graph->Infer(m_curBatch);
-        graph->PullOutputData(_outputs);
-        if (graph->getProperty().collectPerfCounters) {
-            m_perfMap.clear();
-            graph->GetPerfData(m_perfMap);
-        }
-    };
+void MKLDNNPlugin::MKLDNNGraphlessInferRequest::executeInArena(const std::function<void()>& task) {
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
     auto_scope_observing observer(MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph->ptrObserver);
     // a TBB arena is made "this" for Infer call via executing lambda for the arena
-    MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph->ptrArena->execute([&] { infer(); });
+    MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph->ptrArena->execute([&] { task(); });
 #else
-    infer();
+    task();
 #endif
 }
 
+void MKLDNNPlugin::MKLDNNGraphlessInferRequest::inferGraph() {
+    IE_ASSERT(MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph != nullptr);
+    MKLDNNGraph::Ptr graph = MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph;
+    if (!graph->IsReady())
+        THROW_IE_EXCEPTION << "Network not loaded.";
+    if (m_curBatch > 0 && !graph->getProperty().enableDynamicBatch)
+        THROW_IE_EXCEPTION << "Dynamic batch is not enabled.";
+
+    if (m_curBatch > graph->getProperty().batchLimit)
+        THROW_IE_EXCEPTION << "Invalid dynamic batch size " << m_curBatch <<
+                           " for this request.";
+
+    // execute input pre-processing.
+    execDataPreprocessing(_inputs);
+
+    // U16 is unsupported by mkldnn, as well as I16/U8 with a mean image, so such blobs are sent as FP32
+    auto pushConvertedInput = [&](const std::string& name, const InferenceEngine::Blob::Ptr& blob) {
+        const auto& desc = blob->getTensorDesc();
+        auto& converted = m_conversionBlobs[name];
+        if (!converted || converted->getTensorDesc().getDims() != desc.getDims() ||
+                converted->getTensorDesc().getLayout() != desc.getLayout()) {
+            converted = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                                                                  desc.getDims(), desc.getLayout()});
+            converted->allocate();
+        }
+        convertToFloat(blob, converted->buffer().as<float*>());
+        graph->PushInputData(name, converted);
+    };
+    for (auto input : _inputs) {
+        if (!_networkInputs[input.first]) {
+            THROW_IE_EXCEPTION <<
+                               "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
+                               << input.first;
+        }
+        switch (input.second->getTensorDesc().getPrecision()) {
+            case InferenceEngine::Precision::FP32:
+            case InferenceEngine::Precision::I32:
+            case InferenceEngine::Precision::I8:
+                graph->PushInputData(input.first, input.second);
+                break;
+            case InferenceEngine::Precision::U16:
+                pushConvertedInput(input.first, input.second);
+                break;
+            case InferenceEngine::Precision::I16:
+            case InferenceEngine::Precision::U8:
+                if (graph->hasMeanImageFor(input.first)) {
+                    pushConvertedInput(input.first, input.second);
+                } else {
+                    // Instead we can send I16/U8 directly
+                    graph->PushInputData(input.first, input.second);
+                }
+                break;
+            default:
+                THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
+        }
+    }
+    graph->Infer(m_curBatch);
+    graph->PullOutputData(_outputs);
+    if (graph->getProperty().collectPerfCounters) {
+        m_perfMap.clear();
+        graph->GetPerfData(m_perfMap);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNGraphlessInferRequest::InferImpl() {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_INFER)
+    executeInArena([this] {
+        inferGraph();
+    });
+}
+
+void MKLDNNPlugin::MKLDNNGraphlessInferRequest::InferBatch(const InferenceEngine::BlobMap* inputs,
+                                                           InferenceEngine::BlobMap* outputs, size_t count) {
+    IE_PROFILING_AUTO_SCOPE(MKLDNN_INFER_BATCH)
+    IE_ASSERT(MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph != nullptr);
+    executeInArena([&] {
+        inferBatchItems(inputs, outputs, count, [this] {
+            checkBlobs();
+            inferGraph();
+        });
+    });
+}
+
 void MKLDNNPlugin::MKLDNNGraphlessInferRequest::GetPerformanceCounts(
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     perfMap = m_perfMap;
@@ -10,8 +10,11 @@
 #include <map>
 #include <queue>
 #include <memory>
+#include <chrono>
 #include <climits>
+#include <functional>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+#include <cpp_interfaces/ie_priority_task_queue.hpp>
 #include <cpp_interfaces/ie_task_executor.hpp>
 #include "ie_parallel.hpp"
 #include "mkldnn/system_conf.h"
@@ -61,28 +64,56 @@ bool pin_current_thread_by_mask(int ncores, const cpu_set_t* proc_mask);
 bool pin_thread_to_vacant_core(int thr_idx, int hyperthreads, int ncores, const cpu_set_t* proc_mask);
 /* Pin current thread to the socket (the func generates the mask and calls pin_current_thread_by_mask). */
 bool pin_current_thread_to_socket(int socket);
+/* Get the mask of the processors of the list which are in the process mask (nullptr if the list is empty). */
+cpu_set_t* restrict_process_mask(int ncpus, const cpu_set_t* proc_mask, const std::vector<int>& processors);
+
+/* The cores a stream is pinned to: the threads take the processors of the list (of the process if it is empty),
+ * starting with the ones of the stream with the given index among the streams of the list */
+struct stream_placement {
+    std::vector<int> processors;
+    int index;
+    int threads;
+};
+/* Place the streams on the hybrid CPUs (empty on the other ones). The single (latency) stream runs on the
+ * performance cores only, the throughput streams are divided between the types of the cores in proportion to
+ * their numbers of processors, so the slow efficiency cores never hold back the threads of a faster stream. */
+std::vector<stream_placement> place_hybrid_streams(int streams, int threads);
+
+/* The streams and the threads per stream chosen for the network by estimate_streams */
+struct streams_estimate {
+    int streams;
+    int threads_per_stream;
+};
+/* Estimate the streams of CPUConfigParams::CPU_THROUGHPUT_TUNED from the layers with weights of the network.
+ * The compute bound networks get the streams with as many threads as their activations need to fit the L2 caches
+ * of the threads, the memory bound ones get as many streams as their working sets fit the last level cache. */
+streams_estimate estimate_streams(const InferenceEngine::ICNNNetwork& network, int cores);
 
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
 /* Simple observer that handles pinning threads to the cores, it serves as a callback for threads entering the arena. */
 class pinning_observer: public tbb::task_scheduler_observer {
     cpu_set_t *mask;
+    cpu_set_t *pin_mask;  // the processors of the stream, see stream_placement
     int ncpus;
-    int stream_id, threads_per_stream;
+    int stream_id, threads_per_stream, first_core;
     const int pinning_step;
 
 public:
-    pinning_observer(tbb::task_arena& _arena, int _stream_id, int _threads_per_stream, int _pinning_step = 1) :
+    pinning_observer(tbb::task_arena& _arena, int _stream_id, int _threads_per_stream, int _first_core = 0,
+                     int _pinning_step = 1, const std::vector<int>& processors = {}) :
             tbb::task_scheduler_observer(_arena),
-            stream_id(_stream_id), threads_per_stream(_threads_per_stream), pinning_step(_pinning_step) {
+            stream_id(_stream_id), threads_per_stream(_threads_per_stream), first_core(_first_core),
+            pinning_step(_pinning_step) {
         get_process_mask(ncpus, mask);
+        pin_mask = restrict_process_mask(ncpus, mask, processors);
     }
 
     void on_scheduler_entry(bool) override {
         if (!mask) return;
         int thread_idx = tbb::task_arena::current_thread_index();
-        int thr_idx = stream_id * threads_per_stream + thread_idx;
+        int thr_idx = first_core + stream_id * threads_per_stream + thread_idx;
         // pin thread to the vacant slot
-        pin_thread_to_vacant_core(thr_idx, pinning_step, ncpus, mask);
+        pin_thread_to_vacant_core(thr_idx, pinning_step, ncpus, pin_mask ? pin_mask : mask);
     }
 
     void on_scheduler_exit(bool) override {
@@ -94,6 +125,8 @@ public:
     virtual ~pinning_observer() {
         if (mask)
             CPU_FREE(mask);
+        if (pin_mask)
+            CPU_FREE(pin_mask);
     }
 };
 
@@ -124,15 +157,26 @@ public:
 
     void run(Task task) override;
 
+    void runWithPriority(Task task, int priority) override;
+
     static thread_local MultiWorkerTaskContext ptrContext;
 
     void stop();
 
+    /* Number of tasks (Infer Requests) waiting for a vacant stream at the moment */
+    size_t getQueueDepth();
+    /* Average and maximum time (in milliseconds) the started tasks spent in the queue */
+    float getAverageWaitTime();
+    float getMaxWaitTime();
+    /* Average time (in milliseconds) the started tasks of every priority spent in the queue */
+    std::map<int, float> getAverageWaitTimePerPriority();
+
 private:
     std::vector<std::thread> _threads;
     std::mutex _queueMutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    // the queue keeps the wait time statistics, guarded by _queueMutex
+    PriorityTaskQueue _taskQueue;
     std::atomic<bool> _isStopped;
     std::string _name;
 };
@@ -146,6 +190,9 @@ public:
 
     void InferImpl() override;
 
+    /* Enters the threads of the graph of the stream once and infers the inputs one after another */
+    void InferBatch(const InferenceEngine::BlobMap* inputs, InferenceEngine::BlobMap* outputs, size_t count) override;
+
     void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 
     /**
@@ -166,8 +213,14 @@ public:
     void SetBatch(int batch = -1) override;
 
 private:
+    /* Infers the blobs set to the request by the graph of the stream, in the threads of the graph */
+    void inferGraph();
+    void executeInArena(const std::function<void()>& task);
+
     int m_curBatch;
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> m_perfMap;
+    // FP32 blobs the inputs are converted to, reused across inferences
+    std::map<std::string, InferenceEngine::Blob::Ptr> m_conversionBlobs;
 };
 
 
@@ -0,0 +1,265 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_subpixel_deconv.h"
+
+#include <ie_layers.h>
+#include <ie_layers_internal.hpp>
+#include <blob_factory.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace {
+
+/**
+ * The phases of the output of a deconvolution along one axis. The phase r of the output points q * stride + r reads
+ * the inputs q + t for t in [tMin, tMax], which the convolution reads by its taps j = t - tMin.
+ */
+struct AxisPhases {
+    size_t stride = 1;
+    size_t kernel = 1;
+    size_t padBegin = 0;
+    int tMin = 0;
+    int tMax = 0;
+
+    size_t convKernel = 1;
+    size_t convPadBegin = 0;
+    size_t convPadEnd = 0;
+    size_t convOutput = 0;
+
+    bool init(size_t input, size_t output) {
+        tMin = INT32_MAX;
+        tMax = INT32_MIN;
+        for (size_t r = 0; r < stride; r++) {
+            const size_t R = (r + padBegin) % stride;
+            const int d = static_cast<int>((r + padBegin) / stride);
+            if (R >= kernel)
+                continue;
+            const int taps = static_cast<int>((kernel - R + stride - 1) / stride);
+            tMin = (std::min)(tMin, d - taps + 1);
+            tMax = (std::max)(tMax, d);
+        }
+        // the phases reading only the later inputs would need the negative padding
+        if (tMin > 0)
+            return false;
+
+        convKernel = static_cast<size_t>(tMax - tMin + 1);
+        convPadBegin = static_cast<size_t>(-tMin);
+        const int phaseOutput = static_cast<int>((output + stride - 1) / stride);
+        const int padEnd = phaseOutput - 1 - static_cast<int>(input + convPadBegin) + static_cast<int>(convKernel);
+        convPadEnd = static_cast<size_t>((std::max)(padEnd, 0));
+        if (input + convPadBegin + convPadEnd < convKernel)
+            return false;
+        convOutput = input + convPadBegin + convPadEnd - convKernel + 1;
+        return true;
+    }
+
+    // the tap of the deconvolution kernel the tap j of the convolution applies in the phase r, -1 for none
+    int tap(size_t r, size_t j) const {
+        const size_t R = (r + padBegin) % stride;
+        const int d = static_cast<int>((r + padBegin) / stride);
+        const int m = d - (static_cast<int>(j) + tMin);
+        if (m < 0)
+            return -1;
+        const size_t k = R + static_cast<size_t>(m) * stride;
+        return k < kernel ? static_cast<int>(k) : -1;
+    }
+};
+
+DataPtr makeData(const std::string& name, const SizeVector& dims, const CNNLayerPtr& creator) {
+    DataPtr data(new Data(name, TensorDesc(Precision::FP32, dims, TensorDesc::getLayoutByDims(dims))));
+    data->getCreatorLayer() = creator;
+    creator->outData.push_back(data);
+    return data;
+}
+
+void connect(const DataPtr& data, const CNNLayerPtr& layer) {
+    layer->insData.push_back(data);
+    data->getInputTo()[layer->name] = layer;
+}
+
+std::string joinInts(const std::vector<int>& values) {
+    std::string str;
+    for (auto value : values)
+        str += (str.empty() ? "" : ",") + std::to_string(value);
+    return str;
+}
+
+CNNLayerPtr makeReshape(const std::string& name, const SizeVector& dims) {
+    auto reshape = std::make_shared<ReshapeLayer>(LayerParams {name, "Reshape", Precision::FP32});
+    reshape->shape = std::vector<int>(dims.begin(), dims.end());
+    reshape->params["dim"] = joinInts(reshape->shape);
+    return reshape;
+}
+
+bool isApplicable(const DeconvolutionLayer& deconv) {
+    if (deconv.insData.size() != 1 || deconv.outData.size() != 1 || deconv.precision != Precision::FP32)
+        return false;
+    auto input = deconv.insData[0].lock();
+    if (!input || input->getPrecision() != Precision::FP32 || input->getTensorDesc().getDims().size() != 4)
+        return false;
+    if (deconv._group != 1 || deconv._kernel.size() != 2 || deconv._stride.size() != 2 || deconv._dilation.size() != 2)
+        return false;
+    if (deconv._dilation[X_AXIS] != 1 || deconv._dilation[Y_AXIS] != 1)
+        return false;
+    if (deconv._stride[X_AXIS] == 1 && deconv._stride[Y_AXIS] == 1)
+        return false;
+    return deconv._weights && deconv._weights->getTensorDesc().getPrecision() == Precision::FP32 &&
+           (!deconv._biases || deconv._biases->getTensorDesc().getPrecision() == Precision::FP32);
+}
+
+}  // namespace
+
+size_t MKLDNNPlugin::ConvertSubPixelDeconvolutions(details::CNNNetworkImpl& network) {
+    std::vector<std::shared_ptr<DeconvolutionLayer>> deconvs;
+    for (const auto& kvp : network.allLayers()) {
+        auto deconv = std::dynamic_pointer_cast<DeconvolutionLayer>(kvp.second);
+        if (deconv && kvp.second->type == "Deconvolution" && isApplicable(*deconv))
+            deconvs.push_back(deconv);
+    }
+
+    size_t converted = 0;
+    for (const auto& deconv : deconvs) {
+        auto input = deconv->insData[0].lock();
+        auto output = deconv->outData[0];
+        const SizeVector inDims = input->getTensorDesc().getDims();
+        const SizeVector outDims = output->getTensorDesc().getDims();
+        const size_t N = inDims[0], IC = inDims[1], OC = outDims[1];
+        if (outDims.size() != 4 || deconv->_weights->size() != IC * OC * deconv->_kernel[X_AXIS] * deconv->_kernel[Y_AXIS] ||
+            (deconv->_biases && deconv->_biases->size() != OC))
+            continue;
+
+        auto pads = getPaddings(*deconv);
+        AxisPhases h, w;
+        h.stride = deconv->_stride[Y_AXIS];
+        h.kernel = deconv->_kernel[Y_AXIS];
+        h.padBegin = pads.begin[Y_AXIS];
+        w.stride = deconv->_stride[X_AXIS];
+        w.kernel = deconv->_kernel[X_AXIS];
+        w.padBegin = pads.begin[X_AXIS];
+        if (!h.init(inDims[2], outDims[2]) || !w.init(inDims[3], outDims[3]))
+            continue;
+        // the zero taps of the phases make the convolution larger than the deconvolution
+        if (4 * h.convKernel * w.convKernel * h.stride * w.stride > 9 * h.kernel * w.kernel)
+            continue;
+
+        const size_t phases = h.stride * w.stride;
+        const size_t convOC = OC * phases;
+        const size_t kernelSize = h.convKernel * w.convKernel;
+
+        // the weights of the deconvolution are IC x OC x KH x KW, the ones of the convolution are OC' x IC x KH' x KW'
+        auto weights = make_shared_blob<float>(TensorDesc(Precision::FP32, {convOC * IC * kernelSize}, Layout::C));
+        weights->allocate();
+        const float* src = deconv->_weights->cbuffer().as<const float*>();
+        float* dst = weights->buffer().as<float*>();
+        for (size_t oc = 0; oc < OC; oc++) {
+            for (size_t rh = 0; rh < h.stride; rh++) {
+                for (size_t rw = 0; rw < w.stride; rw++) {
+                    const size_t convOc = (oc * h.stride + rh) * w.stride + rw;
+                    for (size_t ic = 0; ic < IC; ic++) {
+                        float* kernel = dst + (convOc * IC + ic) * kernelSize;
+                        for (size_t jh = 0; jh < h.convKernel; jh++) {
+                            for (size_t jw = 0; jw < w.convKernel; jw++) {
+                                const int kh = h.tap(rh, jh), kw = w.tap(rw, jw);
+                                kernel[jh * w.convKernel + jw] = kh < 0 || kw < 0 ? 0.f :
+                                        src[((ic * OC + oc) * h.kernel + kh) * w.kernel + kw];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        Blob::Ptr biases;
+        if (deconv->_biases) {
+            biases = make_shared_blob<float>(TensorDesc(Precision::FP32, {convOC}, Layout::C));
+            biases->allocate();
+            const float* srcBiases = deconv->_biases->cbuffer().as<const float*>();
+            float* dstBiases = biases->buffer().as<float*>();
+            for (size_t oc = 0; oc < convOC; oc++)
+                dstBiases[oc] = srcBiases[oc / phases];
+        }
+
+        const std::string name = deconv->name;
+        auto conv = std::make_shared<ConvolutionLayer>(LayerParams {name, "Convolution", Precision::FP32});
+        conv->_kernel.insert(X_AXIS, w.convKernel);
+        conv->_kernel.insert(Y_AXIS, h.convKernel);
+        conv->_stride.insert(X_AXIS, 1);
+        conv->_stride.insert(Y_AXIS, 1);
+        conv->_padding.insert(X_AXIS, w.convPadBegin);
+        conv->_padding.insert(Y_AXIS, h.convPadBegin);
+        conv->_pads_end.insert(X_AXIS, w.convPadEnd);
+        conv->_pads_end.insert(Y_AXIS, h.convPadEnd);
+        conv->_dilation.insert(X_AXIS, 1);
+        conv->_dilation.insert(Y_AXIS, 1);
+        conv->_out_depth = static_cast<unsigned int>(convOC);
+        conv->_group = 1;
+        conv->params["kernel"] = std::to_string(h.convKernel) + "," + std::to_string(w.convKernel);
+        conv->params["strides"] = "1,1";
+        conv->params["pads_begin"] = std::to_string(h.convPadBegin) + "," + std::to_string(w.convPadBegin);
+        conv->params["pads_end"] = std::to_string(h.convPadEnd) + "," + std::to_string(w.convPadEnd);
+        conv->params["dilations"] = "1,1";
+        conv->params["output"] = std::to_string(convOC);
+        conv->params["group"] = "1";
+        conv->_weights = weights;
+        conv->blobs["weights"] = weights;
+        if (biases) {
+            conv->_biases = biases;
+            conv->blobs["biases"] = biases;
+        }
+
+        auto split = makeReshape(name + "/SubPixelSplit", {N, OC, h.stride, w.stride, h.convOutput, w.convOutput});
+        auto permute = std::make_shared<CNNLayer>(LayerParams {name + "/SubPixelPermute", "Permute", Precision::FP32});
+        permute->params["order"] = "0,1,4,2,5,3";
+        const SizeVector shuffledDims = {N, OC, h.convOutput * h.stride, w.convOutput * w.stride};
+        auto merge = makeReshape(name + "/SubPixelMerge", shuffledDims);
+        CNNLayerPtr crop;
+        if (shuffledDims != outDims) {
+            auto cropLayer = std::make_shared<CropLayer>(LayerParams {name + "/SubPixelCrop", "Crop", Precision::FP32});
+            cropLayer->axis = {2, 3};
+            cropLayer->offset = {0, 0};
+            cropLayer->dim = {static_cast<int>(outDims[2]), static_cast<int>(outDims[3])};
+            cropLayer->params["axis"] = joinInts(cropLayer->axis);
+            cropLayer->params["offset"] = joinInts(cropLayer->offset);
+            cropLayer->params["dim"] = joinInts(cropLayer->dim);
+            crop = cropLayer;
+        }
+
+        input->getInputTo().erase(name);
+        network.removeLayer(name);
+        connect(input, conv);
+        auto phasesData = makeData(name + "/SubPixelPhases", {N, convOC, h.convOutput, w.convOutput}, conv);
+        connect(phasesData, split);
+        auto splitData = makeData(split->name, {N, OC, h.stride, w.stride, h.convOutput, w.convOutput}, split);
+        connect(splitData, permute);
+        auto permuteData = makeData(permute->name, {N, OC, h.convOutput, h.stride, w.convOutput, w.stride}, permute);
+        connect(permuteData, merge);
+        std::vector<CNNLayerPtr> layers = {conv, split, permute, merge};
+        std::vector<DataPtr> datas = {phasesData, splitData, permuteData};
+        CNNLayerPtr last = merge;
+        if (crop) {
+            auto mergeData = makeData(merge->name, shuffledDims, merge);
+            connect(mergeData, crop);
+            layers.push_back(crop);
+            datas.push_back(mergeData);
+            last = crop;
+        }
+        // the output of the deconvolution stays, so its consumers and the outputs of the network are unchanged
+        output->getCreatorLayer() = last;
+        last->outData.push_back(output);
+
+        for (const auto& layer : layers)
+            network.addLayer(layer);
+        for (const auto& data : datas)
+            network.addData(data->getName().c_str(), data);
+        converted++;
+    }
+    return converted;
+}
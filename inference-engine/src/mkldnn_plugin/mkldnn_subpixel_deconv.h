@@ -0,0 +1,34 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief The header provides a declaration of the rewrite of the strided deconvolutions into the sub-pixel convolutions
+ * @file
+ */
+#pragma once
+
+#include <cnn_network_impl.hpp>
+
+#include <cstddef>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Rewrites the strided 2D deconvolutions into the equivalent stride 1 convolutions followed by the pixel shuffle.
+ *
+ * The output point o of a deconvolution with the stride s and the begin padding p gathers the inputs i and the taps k
+ * of o + p = i * s + k, so the outputs of the same phase o % s use the same taps of the kernel. The convolution computes
+ * every phase as the channels of the output c * s_h * s_w + r_h * s_w + r_w, then the Reshape, the Permute and the
+ * Reshape interleave the phases into the rows and the columns and the Crop removes the points past the output of the
+ * deconvolution. The convolution keeps the name of the deconvolution, the added layers are named after it.
+ *
+ * Only the FP32 deconvolutions with one group, no dilation and the weights in the blobs are rewritten, and only the
+ * ones the convolution computes with no more than 9/4 of their multiplications, as the taps missing in some phases
+ * are the zeros of its kernel.
+ * @param network The network to rewrite
+ * @return The number of the rewritten deconvolutions
+ */
+size_t ConvertSubPixelDeconvolutions(InferenceEngine::details::CNNNetworkImpl& network);
+
+}  // namespace MKLDNNPlugin
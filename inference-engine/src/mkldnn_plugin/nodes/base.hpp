@@ -6,9 +6,11 @@
 
 #include <ie_iextension.h>
 #include "list.hpp"
+#include "mkldnn_scratchpad.h"
 
 #include <string>
 #include <vector>
+#include <algorithm>
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
 #endif
@@ -54,9 +56,28 @@ public:
         return OK;
     }
 
+    /**
+     * @brief Returns the bytes of the temporary memory a thread executing the layer needs
+     */
+    size_t getScratchpadSize() const {
+        return scratchpadSize;
+    }
+
+    void setScratchpad(const MKLDNNPlugin::MKLDNNScratchpad::Ptr& graphScratchpad) {
+        scratchpad = graphScratchpad;
+    }
+
 protected:
     enum class ConfLayout { ANY, PLN, BLK8, BLK16 };
 
+    /**
+     * @brief Returns the scratchpad region of the calling thread, at least scratchpadSize bytes
+     */
+    template <typename T>
+    T* getScratchpad() const {
+        return scratchpad->get<T>();
+    }
+
     class DataConfigurator {
     public:
         explicit DataConfigurator(ConfLayout l):
@@ -145,8 +166,33 @@ protected:
         config.dynBatchSupport = dynBatchSupport;
         confs.push_back(config);
     }
+    /**
+     * @brief Returns the channel blocked layout a layer indifferent to the order of the channels in memory may accept
+     * from its neighbours besides the planar one, to avoid the reorders around it
+     * @param data The input of the layer
+     * @return nChw16c (nChw8c without AVX-512) layout, or ConfLayout::PLN if the data is not 4D or 5D FP32 or its
+     * channels do not fill the last block up. The padding of the block is kept zeroed by the neighbours only
+     */
+    static ConfLayout getChannelBlockedLayout(const DataPtr& data) {
+#if defined(HAVE_AVX512F)
+        const size_t blk_size = 16;
+        const auto blk_layout = ConfLayout::BLK16;
+#else
+        const size_t blk_size = 8;
+        const auto blk_layout = ConfLayout::BLK8;
+#endif
+        const TensorDesc& desc = data->getTensorDesc();
+        if (desc.getPrecision() != Precision::FP32 || (desc.getDims().size() != 4 && desc.getDims().size() != 5) ||
+            desc.getDims()[1] % blk_size != 0)
+            return ConfLayout::PLN;
+        return blk_layout;
+    }
+
     std::string errorMsg;
     std::vector<LayerConfig> confs;
+    // set by the constructors of the layers which take their temporary buffers from getScratchpad()
+    size_t scratchpadSize = 0;
+    MKLDNNPlugin::MKLDNNScratchpad::Ptr scratchpad;
 
 #if defined(HAVE_AVX512F)
     static inline __m512 _mm_uni_loadu_ps(const float* psrc) {
@@ -350,7 +396,7 @@ protected:
     }
 
     static inline __m256 _mm_uni_cmpgt_i32(__m256i vec0, __m256i vec1) {
-        return _mm256_cvtepi32_ps(_mm256_cmpgt_epi32(vec0, vec1));
+        return _mm256_castsi256_ps(_mm256_cmpgt_epi32(vec0, vec1));
     }
 
     static inline __m256i _mm_uni_blendv_epi8(__m256i vec0, __m256i vec1, __m256i vmask) {
@@ -462,7 +508,7 @@ protected:
     }
 
     static inline __m128 _mm_uni_cmpgt_i32(__m128i vec0, __m128i vec1) {
-        return _mm_cvtepi32_ps(_mm_cmpgt_epi32(vec0, vec1));
+        return _mm_castsi128_ps(_mm_cmpgt_epi32(vec0, vec1));
     }
 
     static inline __m128i _mm_uni_blendv_epi8(__m128i vec0, __m128i vec1, __m128i vmask) {
@@ -480,6 +526,93 @@ protected:
         return _mm_movemask_ps(vec);
     }
 #endif
+
+    /**
+     * @brief The boxes kept by the greedy non maximum suppression, stored as structure of arrays to check a candidate
+     * against a block of them at once. The offset is added to the widths and heights, it is 1 for the integer pixel
+     * coordinates of Caffe and 0 for the others, the boxes which do not intersect overlap by zero
+     */
+    struct KeptBoxes {
+        explicit KeptBoxes(float offset = 0.f): offset(offset) {}
+
+        size_t size() const { return x0.size(); }
+
+        void clear() {
+            x0.clear(); y0.clear(); x1.clear(); y1.clear(); area.clear();
+        }
+
+        void push(float box_x0, float box_y0, float box_x1, float box_y1) {
+            x0.push_back(box_x0);
+            y0.push_back(box_y0);
+            x1.push_back(box_x1);
+            y1.push_back(box_y1);
+            area.push_back(boxArea(box_x0, box_y0, box_x1, box_y1));
+        }
+
+        /**
+         * @brief Checks whether the IoU of the box with any of the kept boxes exceeds the threshold, the SIMD version
+         * repeats the operations of the scalar one, so it gives the same results
+         */
+        bool overlaps(float box_x0, float box_y0, float box_x1, float box_y1, float threshold) const {
+            const float box_area = boxArea(box_x0, box_y0, box_x1, box_y1);
+            size_t j = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#if defined(HAVE_AVX512F)
+            const size_t block_size = 16;
+#elif defined(HAVE_AVX2)
+            const size_t block_size = 8;
+#else
+            const size_t block_size = 4;
+#endif
+            const auto vzero = _mm_uni_setzero_ps();
+            const auto voffset = _mm_uni_set1_ps(offset);
+            const auto vthreshold = _mm_uni_set1_ps(threshold);
+            const auto vx0 = _mm_uni_set1_ps(box_x0);
+            const auto vy0 = _mm_uni_set1_ps(box_y0);
+            const auto vx1 = _mm_uni_set1_ps(box_x1);
+            const auto vy1 = _mm_uni_set1_ps(box_y1);
+            const auto varea = _mm_uni_set1_ps(box_area);
+            for (; j + block_size <= size(); j += block_size) {
+                // arguments are swapped against std::min/std::max to get the same result for NaN values
+                auto vwidth = _mm_uni_sub_ps(_mm_uni_min_ps(_mm_uni_loadu_ps(&x1[j]), vx1),
+                                             _mm_uni_max_ps(_mm_uni_loadu_ps(&x0[j]), vx0));
+                auto vheight = _mm_uni_sub_ps(_mm_uni_min_ps(_mm_uni_loadu_ps(&y1[j]), vy1),
+                                              _mm_uni_max_ps(_mm_uni_loadu_ps(&y0[j]), vy0));
+                auto vdisjoint = _mm_uni_cmpgt_ps(vzero, _mm_uni_min_ps(vheight, vwidth));
+                auto vintersection = _mm_uni_mul_ps(_mm_uni_add_ps(vwidth, voffset), _mm_uni_add_ps(vheight, voffset));
+                auto vunion = _mm_uni_sub_ps(_mm_uni_add_ps(varea, _mm_uni_loadu_ps(&area[j])), vintersection);
+                auto viou = _mm_uni_blendv_ps(_mm_uni_div_ps(vintersection, vunion), vzero, vdisjoint);
+#if defined(HAVE_AVX512F)
+                if (_mm_uni_cmpgt_ps(viou, vthreshold))
+                    return true;
+#else
+                if (_mm_uni_movemask_ps(_mm_uni_cmpgt_ps(viou, vthreshold)))
+                    return true;
+#endif
+            }
+#endif
+            for (; j < size(); j++) {
+                const float width = (std::min)(box_x1, x1[j]) - (std::max)(box_x0, x0[j]);
+                const float height = (std::min)(box_y1, y1[j]) - (std::max)(box_y0, y0[j]);
+                float iou = 0.f;
+                if (!((std::min)(width, height) < 0.f)) {
+                    const float intersection = (width + offset) * (height + offset);
+                    iou = intersection / (box_area + area[j] - intersection);
+                }
+                if (iou > threshold)
+                    return true;
+            }
+            return false;
+        }
+
+        float offset;
+        std::vector<float> x0, y0, x1, y1, area;
+
+    private:
+        float boxArea(float box_x0, float box_y0, float box_x1, float box_y1) const {
+            return (std::max)(0.f, box_x1 - box_x0 + offset) * (std::max)(0.f, box_y1 - box_y0 + offset);
+        }
+    };
 };
 
 template <class IMPL>
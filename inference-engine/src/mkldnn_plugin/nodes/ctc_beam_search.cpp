@@ -0,0 +1,176 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "list.hpp"
+#include "base.hpp"
+
+#include <cmath>
+#include <cfloat>
+#include <limits>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <unordered_map>
+#include "ie_parallel.hpp"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * @brief The prefix beam search of the CTC outputs. The inputs and the output are the ones of CTCGreedyDecoder:
+ * the probabilities [T, N, C] with the blank class C-1, the optional sequence indicators [T, N] and the most
+ * probable labels [N, T, 1, 1] padded with -1
+ */
+class CTCBeamSearchDecoderImpl: public ExtLayerBase {
+public:
+    explicit CTCBeamSearchDecoderImpl(const CNNLayer* layer) {
+        try {
+            if (layer->insData.empty() || layer->insData.size() > 2 || layer->outData.size() != 1)
+                THROW_IE_EXCEPTION << "Incorrect number of input/output edges!";
+
+            beam_width = layer->GetParamAsUInt("beam_width", 10);
+            if (beam_width == 0)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect beam_width parameter!";
+
+            std::vector<DataConfigurator> inps;
+            inps.resize(layer->insData.size(), DataConfigurator(ConfLayout::PLN));
+            addConfig(layer, inps, {DataConfigurator(ConfLayout::PLN)});
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            errorMsg = ex.what();
+        }
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
+                       ResponseDesc *resp) noexcept override {
+        const float* probabilities = inputs[0]->buffer();
+        const float* sequence_indicators = inputs.size() > 1 ? inputs[1]->buffer().as<const float*>() : nullptr;
+        float* output_sequences = outputs[0]->buffer();
+
+        size_t T_ = inputs[0]->getTensorDesc().getDims()[0];
+        size_t N_ = inputs[0]->getTensorDesc().getDims()[1];
+        size_t C_ = inputs[0]->getTensorDesc().getDims()[2];
+
+        parallel_for(N_, [&](size_t n) {
+            size_t length = 1;
+            while (length < T_ && (!sequence_indicators || sequence_indicators[length*N_ + n] != 0))
+                length++;
+            decode(probabilities + n*C_, N_*C_, length, C_, output_sequences + n*T_, T_);
+        });
+        return OK;
+    }
+
+private:
+    // the prefixes of the beams are the paths of a tree, so a beam is extended without copying its labels
+    struct prefix_node {
+        int parent;
+        int label;
+    };
+
+    struct beam {
+        int node;
+        float p_blank;  // log probability of the prefix ending with the blank
+        float p_label;  // log probability of the prefix ending with its last label
+    };
+
+    static inline float log_sum_exp(float a, float b) {
+        if (a < b)
+            std::swap(a, b);
+        if (b == -std::numeric_limits<float>::infinity())
+            return a;
+        return a + std::log1p(std::exp(b - a));
+    }
+
+    static inline float log_prob(float prob) {
+        return std::log((std::max)(prob, FLT_MIN));
+    }
+
+    void decode(const float* probs, size_t stride, size_t length, size_t C, float* output, size_t T) const {
+        const int blank = static_cast<int>(C) - 1;
+        const float neg_inf = -std::numeric_limits<float>::infinity();
+        // only the most probable labels of a step extend the beams, the others do not get into the beams anyway
+        const size_t num_candidates = (std::min)(beam_width, C - 1);
+
+        std::vector<prefix_node> nodes = {{-1, -1}};
+        std::unordered_map<uint64_t, int> children;
+        std::vector<beam> beams = {{0, 0.f, neg_inf}};
+        std::vector<beam> next_beams;
+        std::unordered_map<int, size_t> next_index;
+        std::vector<int> candidates(C - 1);
+
+        auto child_of = [&](int node, int label) {
+            uint64_t key = (static_cast<uint64_t>(node) << 32) | static_cast<uint32_t>(label);
+            auto it = children.find(key);
+            if (it != children.end())
+                return it->second;
+            nodes.push_back({node, label});
+            int child = static_cast<int>(nodes.size()) - 1;
+            children[key] = child;
+            return child;
+        };
+
+        auto next_beam = [&](int node) -> beam& {
+            auto it = next_index.find(node);
+            if (it != next_index.end())
+                return next_beams[it->second];
+            next_index[node] = next_beams.size();
+            next_beams.push_back({node, neg_inf, neg_inf});
+            return next_beams.back();
+        };
+
+        auto total = [&](const beam& b) {
+            return log_sum_exp(b.p_blank, b.p_label);
+        };
+
+        for (size_t t = 0; t < length; t++, probs += stride) {
+            for (int c = 0; c < blank; c++)
+                candidates[c] = c;
+            std::partial_sort(candidates.begin(), candidates.begin() + num_candidates, candidates.end(),
+                              [&](int a, int b) { return probs[a] > probs[b]; });
+
+            next_beams.clear();
+            next_index.clear();
+            const float p_blank = log_prob(probs[blank]);
+            for (size_t i = 0; i < beams.size(); i++) {
+                const beam b = beams[i];
+                const int last = nodes[b.node].label;
+                const float p_total = total(b);
+
+                beam& same = next_beam(b.node);
+                same.p_blank = log_sum_exp(same.p_blank, p_total + p_blank);
+                if (last >= 0)
+                    same.p_label = log_sum_exp(same.p_label, b.p_label + log_prob(probs[last]));
+
+                for (size_t k = 0; k < num_candidates; k++) {
+                    const int c = candidates[k];
+                    // the repeated label makes a new one only after the blank
+                    const float p_prefix = c == last ? b.p_blank : p_total;
+                    beam& extended = next_beam(child_of(b.node, c));
+                    extended.p_label = log_sum_exp(extended.p_label, p_prefix + log_prob(probs[c]));
+                }
+            }
+
+            const size_t width = (std::min)(beam_width, next_beams.size());
+            std::partial_sort(next_beams.begin(), next_beams.begin() + width, next_beams.end(),
+                              [&](const beam& a, const beam& b) { return total(a) > total(b); });
+            beams.assign(next_beams.begin(), next_beams.begin() + width);
+        }
+
+        std::vector<int> labels;
+        for (int node = beams[0].node; node > 0; node = nodes[node].parent)
+            labels.push_back(nodes[node].label);
+
+        std::fill(output, output + T, -1.f);
+        for (size_t i = 0; i < labels.size(); i++)
+            output[i] = static_cast<float>(labels[labels.size() - 1 - i]);
+    }
+
+    size_t beam_width = 10;
+};
+
+REG_FACTORY_FOR(ImplFactory<CTCBeamSearchDecoderImpl>, CTCBeamSearchDecoder);
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
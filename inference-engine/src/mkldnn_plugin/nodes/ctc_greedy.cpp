@@ -8,6 +8,11 @@
 #include <cmath>
 #include <vector>
 #include <string>
+#include <algorithm>
+#include "ie_parallel.hpp"
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -38,52 +43,74 @@ public:
             return GENERAL_ERROR;
         }
         const float* probabilities = inputs[0]->buffer();
-        const float* sequence_indicators = inputs[1]->buffer();
+        const float* sequence_indicators = inputs.size() > 1 ? inputs[1]->buffer().as<const float*>() : nullptr;
         float* output_sequences = outputs[0]->buffer();
 
         size_t T_ = inputs[0]->getTensorDesc().getDims()[0];
         size_t N_ = inputs[0]->getTensorDesc().getDims()[1];
         size_t C_ = inputs[0]->getTensorDesc().getDims()[2];
 
-        // Fill output_sequences with -1
-        for (size_t ii = 0; ii < T_*N_; ii++) {
-            output_sequences[ii] = -1;
-        }
+        // the sequences of the batch are decoded independently
+        parallel_for(N_, [&](size_t n) {
+            float* output = output_sequences + n*T_;
+            std::fill(output, output + T_, -1.f);
 
-        for (size_t n = 0; n < N_; ++n) {
             int prev_class_idx = -1;
-            size_t output_index = n*T_;
-
-            for (int t = 0; /* check at end */; ++t) {
-                // get maximum probability and its index
-                int max_class_idx = 0;
-
-                const float* probs = probabilities + t*C_*N_ + n*C_;
-                float max_prob = probs[0];
-                ++probs;
-
-                for (size_t c = 1; c < C_; ++c, ++probs) {
-                    if (*probs > max_prob) {
-                        max_class_idx = static_cast<int>(c);
-                        max_prob = *probs;
-                    }
-                }
+            size_t output_index = 0;
+            for (size_t t = 0; t < T_; ++t) {
+                if (t > 0 && sequence_indicators && sequence_indicators[t*N_ + n] == 0)
+                    break;
 
+                int max_class_idx = argmax(probabilities + t*C_*N_ + n*C_, C_);
                 if (max_class_idx < static_cast<int>(C_) - 1 &&
                         max_class_idx != prev_class_idx) {
-                    output_sequences[output_index] = static_cast<float>(max_class_idx);
+                    output[output_index] = static_cast<float>(max_class_idx);
                     output_index++;
                 }
 
                 prev_class_idx = max_class_idx;
-
-                if (t + 1 == static_cast<int>(T_) || sequence_indicators[(t + 1)*N_ + n] == 0) {
-                    break;
-                }
             }
-        }
+        });
         return OK;
     }
+
+private:
+    /**
+     * @brief The index of the first maximum of the probabilities, the maximum is found by the vector lanes and
+     * its index by the scan up to it, so the most probable class is chosen as the scalar loop chooses it
+     */
+    int argmax(const float* probs, size_t C) const {
+        float max_prob = probs[0];
+        size_t c = 1;
+#if defined(HAVE_AVX512F)
+        const size_t block_size = 16;
+#elif defined(HAVE_AVX2)
+        const size_t block_size = 8;
+#elif defined(HAVE_SSE)
+        const size_t block_size = 4;
+#endif
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        if (C >= block_size) {
+            auto vmax = _mm_uni_loadu_ps(probs);
+            for (c = block_size; c + block_size <= C; c += block_size)
+                vmax = _mm_uni_max_ps(_mm_uni_loadu_ps(probs + c), vmax);
+
+            float lanes[block_size];
+            _mm_uni_storeu_ps(lanes, vmax);
+            for (size_t i = 0; i < block_size; i++)
+                max_prob = (std::max)(max_prob, lanes[i]);
+        }
+#endif
+        for (; c < C; ++c)
+            max_prob = (std::max)(max_prob, probs[c]);
+
+        for (c = 0; c < C; ++c) {
+            if (probs[c] == max_prob)
+                return static_cast<int>(c);
+        }
+        // the probabilities are all NaNs
+        return 0;
+    }
 };
 
 REG_FACTORY_FOR(ImplFactory<CTCGreedyDecoderImpl>, CTCGreedyDecoder);
@@ -12,6 +12,9 @@
 #include <utility>
 #include <algorithm>
 #include "ie_parallel.hpp"
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -20,9 +23,10 @@ namespace Cpu {
 template <typename T>
 static bool SortScorePairDescend(const std::pair<float, T>& pair1,
                                  const std::pair<float, T>& pair2) {
-    return pair1.first > pair2.first;
+    return pair1.first > pair2.first || (pair1.first == pair2.first && pair1.second < pair2.second);
 }
 
+template <mkldnn::impl::cpu::cpu_isa_t T>
 class DetectionOutputImpl: public ExtLayerBase {
 public:
     explicit DetectionOutputImpl(const CNNLayer* layer) {
@@ -163,13 +167,11 @@ public:
             }
         }
 
-        for (int n = 0; n < N; ++n) {
-            for (int c = 0; c < _num_classes; ++c) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                }
+        parallel_for2d(N, _num_classes, [&](int n, int c) {
+            for (int p = 0; p < _num_priors; ++p) {
+                reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
             }
-        }
+        });
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
@@ -208,7 +210,7 @@ public:
                 const float *pboxes = decoded_bboxes_data + n*4*_num_priors;
                 const float *psizes = bbox_sizes_data + n*_num_priors;
 
-                nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
+                nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, num_priors_actual[n]);
             }
 
             for (int c = 0; c < _num_classes; ++c) {
@@ -216,7 +218,8 @@ public:
             }
 
             if (_keep_top_k > -1 && detections_total > _keep_top_k) {
-                std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+                auto &conf_index_class_map = _conf_index_class_map;
+                conf_index_class_map.clear();
 
                 for (int c = 0; c < _num_classes; ++c) {
                     int detections = detections_data[n*_num_classes + c];
@@ -229,9 +232,12 @@ public:
                     }
                 }
 
+                // only the best _keep_top_k detections have to be ordered
+                std::nth_element(conf_index_class_map.begin(), conf_index_class_map.begin() + _keep_top_k,
+                                 conf_index_class_map.end(), SortScorePairDescend<std::pair<int, int>>);
+                conf_index_class_map.resize(_keep_top_k);
                 std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
                           SortScorePairDescend<std::pair<int, int>>);
-                conf_index_class_map.resize(_keep_top_k);
 
                 // Store the new indices.
                 memset(detections_data + n*_num_classes, 0, _num_classes * sizeof(int));
@@ -344,6 +350,45 @@ private:
         CENTER_SIZE = 2,
     };
 
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#if defined(HAVE_AVX512F)
+    static const int block_size = 16;
+    typedef __m512 vec_type;
+#elif defined(HAVE_AVX2)
+    static const int block_size = 8;
+    typedef __m256 vec_type;
+#else
+    static const int block_size = 4;
+    typedef __m128 vec_type;
+#endif
+
+    // priors, locations and decoded boxes are stored by box, so a block of boxes is transposed via a buffer
+    static inline vec_type gather(const float *src, int stride) {
+        float buf[block_size];
+        for (int i = 0; i < block_size; i++)
+            buf[i] = src[i*stride];
+        return _mm_uni_loadu_ps(buf);
+    }
+
+    static inline void scatter(float *dst, int stride, vec_type vec) {
+        float buf[block_size];
+        _mm_uni_storeu_ps(buf, vec);
+        for (int i = 0; i < block_size; i++)
+            dst[i*stride] = buf[i];
+    }
+
+    static inline vec_type exp_ps(vec_type vec) {
+        float buf[block_size];
+        _mm_uni_storeu_ps(buf, vec);
+        for (int i = 0; i < block_size; i++)
+            buf[i] = std::exp(buf[i]);
+        return _mm_uni_loadu_ps(buf);
+    }
+
+    void decodeBBoxesBlock(const float *prior_data, const float *loc_data, const float *variance_data,
+                           float *decoded_bboxes, float *decoded_bbox_sizes, int p);
+#endif
+
     void decodeBBoxes(const float *prior_data, const float *loc_data, const float *variance_data,
                       float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n);
 
@@ -360,6 +405,7 @@ private:
     InferenceEngine::Blob::Ptr _reordered_conf;
     InferenceEngine::Blob::Ptr _bbox_sizes;
     InferenceEngine::Blob::Ptr _num_priors_actual;
+    std::vector<std::pair<float, std::pair<int, int>>> _conf_index_class_map;
 };
 
 struct ConfidenceComparator {
@@ -374,6 +420,14 @@ struct ConfidenceComparator {
     const float* _conf_data;
 };
 
+// Moves the best `top` of `count` candidates to the beginning and orders them without sorting the rest
+static inline void SelectTopScores(int *candidates, int count, int top, const float *conf_data) {
+    ConfidenceComparator comparator(conf_data);
+    if (top < count)
+        std::nth_element(candidates, candidates + top, candidates + count, comparator);
+    std::sort(candidates, candidates + top, comparator);
+}
+
 static inline float JaccardOverlap(const float *decoded_bbox,
                                    const float *bbox_sizes,
                                    const int idx1,
@@ -411,7 +465,79 @@ static inline float JaccardOverlap(const float *decoded_bbox,
     return intersect_size / (bbox1_size + bbox2_size - intersect_size);
 }
 
-void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+template <mkldnn::impl::cpu::cpu_isa_t T>
+void DetectionOutputImpl<T>::decodeBBoxesBlock(const float *prior_data,
+                                               const float *loc_data,
+                                               const float *variance_data,
+                                               float *decoded_bboxes,
+                                               float *decoded_bbox_sizes,
+                                               int p) {
+    // the same operations in the same order as the scalar code below, so results are equal
+    vec_type prior[4], loc[4], variance[4], decoded[4];
+    for (int i = 0; i < 4; i++) {
+        prior[i] = gather(prior_data + p*_prior_size + i + _offset, _prior_size);
+        loc[i] = gather(loc_data + 4*p*_num_loc_classes + i, 4*_num_loc_classes);
+        if (!_variance_encoded_in_target)
+            variance[i] = gather(variance_data + p*4 + i, 4);
+        decoded[i] = _mm_uni_setzero_ps();
+    }
+
+    if (!_normalized) {
+        vec_type width = _mm_uni_set1_ps(static_cast<float>(_image_width));
+        vec_type height = _mm_uni_set1_ps(static_cast<float>(_image_height));
+        prior[0] = _mm_uni_div_ps(prior[0], width);
+        prior[1] = _mm_uni_div_ps(prior[1], height);
+        prior[2] = _mm_uni_div_ps(prior[2], width);
+        prior[3] = _mm_uni_div_ps(prior[3], height);
+    }
+
+    if (_code_type == CodeType::CORNER) {
+        for (int i = 0; i < 4; i++) {
+            decoded[i] = _variance_encoded_in_target ? _mm_uni_add_ps(prior[i], loc[i])
+                                                     : _mm_uni_add_ps(prior[i], _mm_uni_mul_ps(variance[i], loc[i]));
+        }
+    } else if (_code_type == CodeType::CENTER_SIZE) {
+        vec_type two = _mm_uni_set1_ps(2.0f);
+        vec_type prior_width = _mm_uni_sub_ps(prior[2], prior[0]);
+        vec_type prior_height = _mm_uni_sub_ps(prior[3], prior[1]);
+        vec_type prior_center_x = _mm_uni_div_ps(_mm_uni_add_ps(prior[0], prior[2]), two);
+        vec_type prior_center_y = _mm_uni_div_ps(_mm_uni_add_ps(prior[1], prior[3]), two);
+
+        if (!_variance_encoded_in_target) {
+            for (int i = 0; i < 4; i++)
+                loc[i] = _mm_uni_mul_ps(variance[i], loc[i]);
+        }
+
+        vec_type decode_bbox_center_x = _mm_uni_add_ps(_mm_uni_mul_ps(loc[0], prior_width), prior_center_x);
+        vec_type decode_bbox_center_y = _mm_uni_add_ps(_mm_uni_mul_ps(loc[1], prior_height), prior_center_y);
+        vec_type decode_bbox_width = _mm_uni_mul_ps(exp_ps(loc[2]), prior_width);
+        vec_type decode_bbox_height = _mm_uni_mul_ps(exp_ps(loc[3]), prior_height);
+
+        decoded[0] = _mm_uni_sub_ps(decode_bbox_center_x, _mm_uni_div_ps(decode_bbox_width, two));
+        decoded[1] = _mm_uni_sub_ps(decode_bbox_center_y, _mm_uni_div_ps(decode_bbox_height, two));
+        decoded[2] = _mm_uni_add_ps(decode_bbox_center_x, _mm_uni_div_ps(decode_bbox_width, two));
+        decoded[3] = _mm_uni_add_ps(decode_bbox_center_y, _mm_uni_div_ps(decode_bbox_height, two));
+    }
+
+    if (_clip_before_nms) {
+        // argument order gives the same results as std::max(0.0f, std::min(1.0f, x)) for NaN
+        vec_type zero = _mm_uni_setzero_ps();
+        vec_type one = _mm_uni_set1_ps(1.0f);
+        for (int i = 0; i < 4; i++)
+            decoded[i] = _mm_uni_max_ps(_mm_uni_min_ps(decoded[i], one), zero);
+    }
+
+    for (int i = 0; i < 4; i++)
+        scatter(decoded_bboxes + p*4 + i, 4, decoded[i]);
+
+    _mm_uni_storeu_ps(decoded_bbox_sizes + p, _mm_uni_mul_ps(_mm_uni_sub_ps(decoded[2], decoded[0]),
+                                                             _mm_uni_sub_ps(decoded[3], decoded[1])));
+}
+#endif
+
+template <mkldnn::impl::cpu::cpu_isa_t T>
+void DetectionOutputImpl<T>::decodeBBoxes(const float *prior_data,
                                    const float *loc_data,
                                    const float *variance_data,
                                    float *decoded_bboxes,
@@ -430,7 +556,16 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
         }
     }
 
-    parallel_for(num_priors_actual[n], [&](int p) {
+    int start = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    parallel_for(num_priors_actual[n] / block_size, [&](int b) {
+        decodeBBoxesBlock(prior_data, loc_data, variance_data, decoded_bboxes, decoded_bbox_sizes, b*block_size);
+    });
+    start = num_priors_actual[n] / block_size * block_size;
+#endif
+
+    parallel_for(num_priors_actual[n] - start, [&](int i) {
+        const int p = start + i;
         float new_xmin = 0.0f;
         float new_ymin = 0.0f;
         float new_xmax = 0.0f;
@@ -511,7 +646,8 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
     });
 }
 
-void DetectionOutputImpl::nms_cf(const float* conf_data,
+template <mkldnn::impl::cpu::cpu_isa_t T>
+void DetectionOutputImpl<T>::nms_cf(const float* conf_data,
                           const float* bboxes,
                           const float* sizes,
                           int* buffer,
@@ -521,16 +657,14 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
     int count = 0;
     for (int i = 0; i < num_priors_actual; ++i) {
         if (conf_data[i] > _confidence_threshold) {
-            indices[count] = i;
+            buffer[count] = i;
             count++;
         }
     }
 
     int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
 
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    SelectTopScores(buffer, count, num_output_scores, conf_data);
 
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
@@ -551,7 +685,8 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
     }
 }
 
-void DetectionOutputImpl::nms_mx(const float* conf_data,
+template <mkldnn::impl::cpu::cpu_isa_t T>
+void DetectionOutputImpl<T>::nms_mx(const float* conf_data,
                           const float* bboxes,
                           const float* sizes,
                           int* buffer,
@@ -571,15 +706,13 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
         }
 
         if (id > 0 && conf >= _confidence_threshold) {
-            indices[count++] = id*_num_priors + i;
+            buffer[count++] = id*_num_priors + i;
         }
     }
 
     int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
 
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    SelectTopScores(buffer, count, num_output_scores, conf_data);
 
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
@@ -604,7 +737,15 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
     }
 }
 
-REG_FACTORY_FOR(ImplFactory<DetectionOutputImpl>, DetectionOutput);
+#ifdef HAVE_AVX512F
+REG_FACTORY_FOR_TYPE(avx512_common, ImplFactory<DetectionOutputImpl<mkldnn::impl::cpu::cpu_isa_t::avx512_common>>, DetectionOutput);
+#elif defined HAVE_AVX2
+REG_FACTORY_FOR_TYPE(avx2, ImplFactory<DetectionOutputImpl<mkldnn::impl::cpu::cpu_isa_t::avx2>>, DetectionOutput);
+#elif defined HAVE_SSE
+REG_FACTORY_FOR_TYPE(sse42, ImplFactory<DetectionOutputImpl<mkldnn::impl::cpu::cpu_isa_t::sse42>>, DetectionOutput);
+#else
+REG_FACTORY_FOR_TYPE(isa_any, ImplFactory<DetectionOutputImpl<mkldnn::impl::cpu::cpu_isa_t::isa_any>>, DetectionOutput);
+#endif
 
 }  // namespace Cpu
 }  // namespace Extensions
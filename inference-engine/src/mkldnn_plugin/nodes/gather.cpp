@@ -66,6 +66,13 @@ public:
             const SizeVector& out_dims = layer->outData[0]->getTensorDesc().getDims();
             dataConfigOut.desc = TensorDesc(dataPrecision, out_dims,
                     layer->outData[0]->getTensorDesc().getLayoutByDims(out_dims));
+
+            // a gather of as many indices as the axis has reorders the rows of the axis, e.g. the decoder states
+            // by the parent beams of a beam search, so it may be done in the memory of the dictionary
+            if (out_dims == dictionary_dims) {
+                config.inConfs[GATHER_DICTIONARY].inPlace = 0;
+                dataConfigOut.inPlace = 0;
+            }
             config.outConfs.push_back(dataConfigOut);
             config.dynBatchSupport = false;
             confs.push_back(config);
@@ -119,26 +126,98 @@ private:
         uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
         size_t len = dataLength * dictionary->getTensorDesc().getPrecision().size();
 
-        parallel_for(src_indexSize, [&](size_t i) {
-            unsigned int idx = Conversion()(src_index[i]);
-
-            //  Index clipping
-            if (idx < indexRange) {
-                //  Copying data to destination from Dictionary
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    simple_copy(&dst_data[len * (i + j * src_indexSize)],
-                                output->byteSize() - (len * (i + j * src_indexSize)),
-                                &src_dataDict[len * (idx + j * indexRange)],
-                                len);
-                }
-            } else {
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    memset(&dst_data[len * (i + j * src_indexSize)], 0, len);
+        if (src_dataDict == dst_data) {
+            reorder_in_place<index_t, Conversion>(src_index, dst_data, len);
+            return;
+        }
+
+        // every thread copies a contiguous range of the indices, so the rows of the following indices are
+        // prefetched while the current one is copied: the lookups into the big tables are bound by DRAM latency
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(src_indexSize, nthr, ithr, start, end);
+            for (size_t j = 0; j < numDictionaries; j++) {
+                const uint8_t *src_dict = src_dataDict + len * j * indexRange;
+                uint8_t *dst = dst_data + len * j * src_indexSize;
+                for (size_t i = start; i < end; i++) {
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                    if (i + prefetch_distance < end) {
+                        unsigned int next_idx = Conversion()(src_index[i + prefetch_distance]);
+                        if (next_idx < indexRange)
+                            prefetch_row(src_dict + len * next_idx, len);
+                    }
+#endif
+                    unsigned int idx = Conversion()(src_index[i]);
+
+                    //  Index clipping
+                    if (idx < indexRange) {
+                        //  Copying data to destination from Dictionary
+                        simple_copy(dst + len * i, output->byteSize() - (dst + len * i - dst_data), src_dict + len * idx, len);
+                    } else {
+                        memset(dst + len * i, 0, len);
+                    }
                 }
             }
         });
     }
 
+    // Rewrites only the rows whose index is not their own position. The rows which are read by other rows and are
+    // rewritten themselves are saved first, the other sources are still intact when they are read. A beam search
+    // keeps most of the beams, so only a few rows of the states are touched.
+    template <typename index_t, class Conversion>
+    void reorder_in_place(const index_t *src_index, uint8_t *data, size_t len) {
+        std::vector<unsigned int> indices(indexRange);
+        std::vector<int> saved_slot(indexRange, -1);
+        std::vector<size_t> changed_rows, saved_rows;
+        for (size_t i = 0; i < indexRange; i++) {
+            indices[i] = Conversion()(src_index[i]);
+            if (indices[i] != i)
+                changed_rows.push_back(i);
+        }
+        for (auto i : changed_rows) {
+            unsigned int idx = indices[i];
+            if (idx < indexRange && indices[idx] != idx && saved_slot[idx] < 0) {
+                saved_slot[idx] = static_cast<int>(saved_rows.size());
+                saved_rows.push_back(idx);
+            }
+        }
+        if (changed_rows.empty())
+            return;
+
+        std::vector<uint8_t> saved(saved_rows.size() * len);
+        for (size_t j = 0; j < numDictionaries; j++) {
+            uint8_t *dict = data + len * j * indexRange;
+            parallel_for(saved_rows.size(), [&](size_t k) {
+                simple_copy(saved.data() + len * k, len, dict + len * saved_rows[k], len);
+            });
+            parallel_for(changed_rows.size(), [&](size_t k) {
+                size_t i = changed_rows[k];
+                unsigned int idx = indices[i];
+                //  Index clipping
+                if (idx >= indexRange) {
+                    memset(dict + len * i, 0, len);
+                } else if (saved_slot[idx] >= 0) {
+                    simple_copy(dict + len * i, len, saved.data() + len * saved_slot[idx], len);
+                } else {
+                    simple_copy(dict + len * i, len, dict + len * idx, len);
+                }
+            });
+        }
+    }
+
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    static inline void prefetch_row(const uint8_t *row, size_t len) {
+        // the hardware prefetcher follows the long rows after their first lines
+        const size_t prefetch_len = len < max_prefetch_bytes ? len : max_prefetch_bytes;
+        for (size_t offset = 0; offset < prefetch_len; offset += cache_line_size)
+            _mm_prefetch(reinterpret_cast<const char *>(row + offset), _MM_HINT_T0);
+    }
+
+    static const size_t prefetch_distance = 8;
+    static const size_t cache_line_size = 64;
+    static const size_t max_prefetch_bytes = 1024;
+#endif
+
     int axis = 0;
     size_t numDictionaries = 1;
     size_t indexRange = 0;
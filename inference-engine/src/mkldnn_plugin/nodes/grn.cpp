@@ -24,6 +24,11 @@ public:
             bias = layer->GetParamAsFloat("bias");
 
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}});
+            if (layer->insData[0].lock()->getTensorDesc().getDims().size() == 4) {
+                const auto blk_layout = getChannelBlockedLayout(layer->insData[0].lock());
+                if (blk_layout != ConfLayout::PLN)
+                    addConfig(layer, {{blk_layout, false, 0}}, {{blk_layout, false, 0}});
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -41,14 +46,21 @@ public:
         int H = static_cast<int>((dims.size() > 2) ? dims[2] : 1);
         int W = static_cast<int>((dims.size() > 3) ? dims[3] : 1);
 
+        // the channels are either planar or in blocks of nChw8c/nChw16c
+        const auto& blockDims = inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims();
+        const int blk = blockDims.size() > dims.size() ? static_cast<int>(blockDims.back()) : 1;
+        auto index = [&](int b, int c, int h, int w) {
+            return ((b*(C/blk) + c/blk)*H*W + h*W + w)*blk + c%blk;
+        };
+
         parallel_for3d(N, H, W, [&](int b, int h, int w) {
             double variance = 0;
             for (int c = 0; c < C; c++) {
-                variance += std::pow(src_data[b*C*H*W + c*H*W + h*W + w], 2);
+                variance += std::pow(src_data[index(b, c, h, w)], 2);
             }
             variance = std::pow(variance + bias, 0.5f);
             for (int c = 0; c < C; c++) {
-                dst_data[b*C*H*W + c*H*W + h*W + w] = src_data[b*C*H*W + c*H*W + h*W + w] / static_cast<float>(variance);
+                dst_data[index(b, c, h, w)] = src_data[index(b, c, h, w)] / static_cast<float>(variance);
             }
         });
         return OK;
@@ -4,6 +4,7 @@
 
 #include "list.hpp"
 #include "base.hpp"
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <limits>
@@ -21,15 +22,16 @@ namespace Cpu {
 #define GET_OFF(field) offsetof(jit_args_interp, field)
 
 struct jit_args_interp {
-    const float *src00;
-    const float *src01;
-    const float *src10;
-    const float *src11;
+    const float *src_h0;
+    const float *src_h1;
     float *dst;
-    float *h_lambda0;
-    float *h_lambda1;
-    float *w_lambda0;
-    float *w_lambda1;
+    const int *w_idx0;
+    const int *w_idx1;
+    const float *w_lambda0;
+    const float *w_lambda1;
+    const float *h_lambda0;
+    const float *h_lambda1;
+    size_t work_amount;
 };
 
 struct jit_uni_interp_kernel {
@@ -41,6 +43,7 @@ struct jit_uni_interp_kernel {
     virtual ~jit_uni_interp_kernel() {}
 };
 
+// Interpolates a whole output row, the byte offsets of the source pixels and the weights are taken from the w tables
 template <cpu_isa_t isa>
 struct jit_uni_interp_kernel_f32 : public jit_uni_interp_kernel, public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_interp_kernel_f32)
@@ -48,53 +51,47 @@ struct jit_uni_interp_kernel_f32 : public jit_uni_interp_kernel, public jit_gene
     jit_uni_interp_kernel_f32() : jit_uni_interp_kernel(), jit_generator() {
         this->preamble();
 
-        mov(reg_src00, ptr[reg_params + GET_OFF(src00)]);
-        mov(reg_src01, ptr[reg_params + GET_OFF(src01)]);
-        mov(reg_src10, ptr[reg_params + GET_OFF(src10)]);
-        mov(reg_src11, ptr[reg_params + GET_OFF(src11)]);
+        mov(reg_src_h0, ptr[reg_params + GET_OFF(src_h0)]);
+        mov(reg_src_h1, ptr[reg_params + GET_OFF(src_h1)]);
         mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
-        mov(reg_h_lambda0, ptr[reg_params + GET_OFF(h_lambda0)]);
-        mov(reg_h_lambda1, ptr[reg_params + GET_OFF(h_lambda1)]);
+        mov(reg_w_idx0, ptr[reg_params + GET_OFF(w_idx0)]);
+        mov(reg_w_idx1, ptr[reg_params + GET_OFF(w_idx1)]);
         mov(reg_w_lambda0, ptr[reg_params + GET_OFF(w_lambda0)]);
         mov(reg_w_lambda1, ptr[reg_params + GET_OFF(w_lambda1)]);
-
-        uni_vmovups(vmm_src00, ptr[reg_src00]);
-        uni_vmovups(vmm_src01, ptr[reg_src01]);
-        uni_vmovups(vmm_src10, ptr[reg_src10]);
-        uni_vmovups(vmm_src11, ptr[reg_src11]);
-        uni_vbroadcastss(vmm_h_lambda0, ptr[reg_h_lambda0]);
-        uni_vbroadcastss(vmm_h_lambda1, ptr[reg_h_lambda1]);
-        uni_vbroadcastss(vmm_w_lambda0, ptr[reg_w_lambda0]);
-        uni_vbroadcastss(vmm_w_lambda1, ptr[reg_w_lambda1]);
-
-        uni_vmulps(vmm_src01, vmm_src01, vmm_w_lambda0);
-        uni_vmulps(vmm_src11, vmm_src11, vmm_w_lambda0);
-        uni_vfmadd231ps(vmm_src01, vmm_w_lambda1, vmm_src00);
-        uni_vfmadd231ps(vmm_src11, vmm_w_lambda1, vmm_src10);
-        uni_vmulps(vmm_src01, vmm_src01, vmm_h_lambda1);
-        uni_vfmadd231ps(vmm_src01, vmm_h_lambda0, vmm_src11);
-        uni_vmovups(ptr[reg_dst], vmm_src01);
-        if (isa == sse42) {
-            int stride = 4*sizeof(float);  //  block is also 8 when sse42
-            add(reg_src00, stride);
-            add(reg_src01, stride);
-            add(reg_src10, stride);
-            add(reg_src11, stride);
-            add(reg_dst, stride);
-
-            uni_vmovups(vmm_src00, ptr[reg_src00]);
-            uni_vmovups(vmm_src01, ptr[reg_src01]);
-            uni_vmovups(vmm_src10, ptr[reg_src10]);
-            uni_vmovups(vmm_src11, ptr[reg_src11]);
-
-            uni_vmulps(vmm_src01, vmm_src01, vmm_w_lambda0);
-            uni_vmulps(vmm_src11, vmm_src11, vmm_w_lambda0);
-            uni_vfmadd231ps(vmm_src01, vmm_w_lambda1, vmm_src00);
-            uni_vfmadd231ps(vmm_src11, vmm_w_lambda1, vmm_src10);
-            uni_vmulps(vmm_src01, vmm_src01, vmm_h_lambda1);
-            uni_vfmadd231ps(vmm_src01, vmm_h_lambda0, vmm_src11);
-            uni_vmovups(ptr[reg_dst], vmm_src01);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        mov(reg_tmp, ptr[reg_params + GET_OFF(h_lambda0)]);
+        uni_vbroadcastss(vmm_h_lambda0, ptr[reg_tmp]);
+        mov(reg_tmp, ptr[reg_params + GET_OFF(h_lambda1)]);
+        uni_vbroadcastss(vmm_h_lambda1, ptr[reg_tmp]);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label); {
+            cmp(reg_work_amount, 0);
+            jle(exit_label, T_NEAR);
+
+            movsxd(reg_idx0, dword[reg_w_idx0]);
+            movsxd(reg_idx1, dword[reg_w_idx1]);
+            uni_vbroadcastss(vmm_w_lambda0, ptr[reg_w_lambda0]);
+            uni_vbroadcastss(vmm_w_lambda1, ptr[reg_w_lambda1]);
+
+            interpolate(0);
+            //  block is also 8 when sse42
+            if (isa == sse42)
+                interpolate(4 * sizeof(float));
+
+            add(reg_dst, (isa == sse42 ? 8 : vlen / sizeof(float)) * sizeof(float));
+            add(reg_w_idx0, sizeof(int));
+            add(reg_w_idx1, sizeof(int));
+            add(reg_w_lambda0, sizeof(float));
+            add(reg_w_lambda1, sizeof(float));
+
+            sub(reg_work_amount, 1);
+            jmp(main_loop_label, T_NEAR);
         }
+        L(exit_label);
 
         this->postamble();
         ker_ = (decltype(ker_))this->getCode();
@@ -104,15 +101,17 @@ private:
     using Vmm = typename conditional3<isa == sse42, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
     size_t vlen = cpu_isa_traits<isa>::vlen;
 
-    Xbyak::Reg64 reg_src00 = r8;
-    Xbyak::Reg64 reg_src01 = r9;
-    Xbyak::Reg64 reg_src10 = r10;
-    Xbyak::Reg64 reg_src11 = r11;
+    Xbyak::Reg64 reg_src_h0 = r8;
+    Xbyak::Reg64 reg_src_h1 = r9;
+    Xbyak::Reg64 reg_w_idx0 = r10;
+    Xbyak::Reg64 reg_w_idx1 = r11;
     Xbyak::Reg64 reg_dst   = rbp;
-    Xbyak::Reg64 reg_h_lambda0 = r12;
-    Xbyak::Reg64 reg_h_lambda1 = r13;
-    Xbyak::Reg64 reg_w_lambda0 = r14;
-    Xbyak::Reg64 reg_w_lambda1 = r15;
+    Xbyak::Reg64 reg_w_lambda0 = r12;
+    Xbyak::Reg64 reg_w_lambda1 = r13;
+    Xbyak::Reg64 reg_work_amount = r14;
+    Xbyak::Reg64 reg_idx0 = r15;
+    Xbyak::Reg64 reg_idx1 = rbx;
+    Xbyak::Reg64 reg_tmp = rax;
     Xbyak::Reg64 reg_params = abi_param1;
 
     Vmm vmm_src00 = Vmm(0);
@@ -123,7 +122,22 @@ private:
     Vmm vmm_h_lambda1 = Vmm(5);
     Vmm vmm_w_lambda0 = Vmm(6);
     Vmm vmm_w_lambda1 = Vmm(7);
-    Vmm vmm_dst   = Vmm(8);
+
+    void interpolate(int offset) {
+        uni_vmovups(vmm_src00, ptr[reg_src_h0 + reg_idx0 + offset]);
+        uni_vmovups(vmm_src01, ptr[reg_src_h0 + reg_idx1 + offset]);
+        uni_vmovups(vmm_src10, ptr[reg_src_h1 + reg_idx0 + offset]);
+        uni_vmovups(vmm_src11, ptr[reg_src_h1 + reg_idx1 + offset]);
+
+        uni_vmulps(vmm_src01, vmm_src01, vmm_w_lambda0);
+        uni_vmulps(vmm_src11, vmm_src11, vmm_w_lambda0);
+        // sse42 emulation of fma overwrites the second operand, so the lambdas are kept for the rest of the row
+        uni_vfmadd231ps(vmm_src01, vmm_src00, vmm_w_lambda1);
+        uni_vfmadd231ps(vmm_src11, vmm_src10, vmm_w_lambda1);
+        uni_vmulps(vmm_src01, vmm_src01, vmm_h_lambda1);
+        uni_vfmadd231ps(vmm_src01, vmm_src11, vmm_h_lambda0);
+        uni_vmovups(ptr[reg_dst + offset], vmm_src01);
+    }
 };
 
 class InterpImpl: public ExtLayerBase {
@@ -140,8 +154,10 @@ public:
             if (src_precision != Precision::FP32 && src_precision != Precision::U8)
                 THROW_IE_EXCEPTION << layer->name << " Incorrect input data tensor precision. Only U8 or FP32 are supported!";
 
-            if (layer->outData[0]->getTensorDesc().getPrecision() != Precision::FP32)
-                THROW_IE_EXCEPTION << layer->name << " Incorrect output data tensor precision. Only FP32 is supported!";
+            // U8 to U8 interpolation is precision preserving: the output values are convex combinations of the input ones
+            auto dst_precision = layer->outData[0]->getTensorDesc().getPrecision();
+            if (dst_precision != Precision::FP32 && !(dst_precision == Precision::U8 && src_precision == Precision::U8))
+                THROW_IE_EXCEPTION << layer->name << " Incorrect output data tensor precision. Only FP32 or U8 for U8 input are supported!";
 
             // We don't read other parameters since they are needed only for dst reshape in caffe
             pad_beg = layer->GetParamAsInt("pad_beg");
@@ -167,7 +183,7 @@ public:
                     dimOffsets[i] = 0;
                     order[i] = i;
                 }
-                dataConfigOut.desc = TensorDesc(Precision::FP32, out_dims, { blocks, order, offset, dimOffsets, strides });
+                dataConfigOut.desc = TensorDesc(dst_precision, out_dims, { blocks, order, offset, dimOffsets, strides });
                 config.outConfs.push_back(dataConfigOut);
                 config.dynBatchSupport = false;
                 confs.push_back(config);
@@ -203,22 +219,25 @@ public:
         size_t IH_pad = IH + pad_beg + pad_end;
         size_t IW_pad = IW + pad_beg + pad_end;
 
-        auto *dst_data = outputs[0]->buffer().as<float *>();
-
         switch (inputs[0]->getTensorDesc().getPrecision()) {
         case Precision::FP32:
         {
             size_t IC = inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims()[1] *
                         inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims()[4];
             interpolate(IN, IC, inputs[0]->buffer().as<const float *>(),
-                -pad_beg, -pad_beg, IH_pad, IW_pad, IH, IW, dst_data, 0, 0, OH, OW, OH, OW);
+                -pad_beg, -pad_beg, IH_pad, IW_pad, IH, IW, outputs[0]->buffer().as<float *>(), 0, 0, OH, OW, OH, OW);
         }
         break;
         case Precision::U8:
         {
             size_t IC = inputs[0]->getTensorDesc().getDims()[1];
-            interpolate_8u(inputs[0]->getTensorDesc().getLayout(), IN, IC, inputs[0]->buffer().as<const uint8_t *>(),
-                -pad_beg, -pad_beg, IH_pad, IW_pad, IH, IW, dst_data, 0, 0, OH, OW, OH, OW);
+            if (outputs[0]->getTensorDesc().getPrecision() == Precision::U8) {
+                interpolate_8u(inputs[0]->getTensorDesc().getLayout(), IN, IC, inputs[0]->buffer().as<const uint8_t *>(),
+                    -pad_beg, -pad_beg, IH_pad, IW_pad, IH, IW, outputs[0]->buffer().as<uint8_t *>(), 0, 0, OH, OW, OH, OW);
+            } else {
+                interpolate_8u(inputs[0]->getTensorDesc().getLayout(), IN, IC, inputs[0]->buffer().as<const uint8_t *>(),
+                    -pad_beg, -pad_beg, IH_pad, IW_pad, IH, IW, outputs[0]->buffer().as<float *>(), 0, 0, OH, OW, OH, OW);
+            }
         }
         break;
         default:
@@ -233,22 +252,47 @@ public:
     }
 
 private:
+    // Source positions and weights of the output coordinates along an axis
+    struct axis_table {
+        std::vector<int> idx0;
+        std::vector<int> idx1;
+        std::vector<float> lambda0;
+        std::vector<float> lambda1;
+    };
+
     int pad_beg;
     int pad_end;
     bool align_corners;
     std::shared_ptr<jit_uni_interp_kernel> interp_kernel;
 
-    void interpolate(const size_t N, const size_t C,
-                     const float *src, const int x1, const int y1,
-                     const int IH_pad, const int IW_pad, const size_t IH, const size_t IW,
-                     float *dst, const int x2, const int y2,
-                     const int OH_pad, const int OW_pad, const size_t OH, const size_t OW) {
-        if (IH_pad == OH_pad && IW_pad == OW_pad) {
-            for (size_t i = 0; i < N * C * OH * OW; i++) {
-                dst[i] = src[i];
-            }
-            return;
+    // The tables depend only on the shapes, so they are computed on the first inference and by the reshapes
+    axis_table h_table;
+    axis_table w_table;
+    std::vector<int> tables_key;
+
+    static void fill_axis_table(axis_table &table, float r, int I_pad, int O_pad, int shift, int stride) {
+        table.idx0.resize(O_pad);
+        table.idx1.resize(O_pad);
+        table.lambda0.resize(O_pad);
+        table.lambda1.resize(O_pad);
+        for (int o = 0; o < O_pad; o++) {
+            float f = r * o;
+            // i0 is the lower input position, i1 is the higher one
+            int i0 = static_cast<int>(f);
+            int i1 = (i0 < I_pad - 1) ? i0 + 1 : i0;
+
+            table.idx0[o] = (shift + i0) * stride;
+            table.idx1[o] = (shift + i1) * stride;
+            table.lambda0[o] = f - i0;  // for the higher input position weight
+            table.lambda1[o] = 1.0f - table.lambda0[o];  // for the lower input position weight
         }
+    }
+
+    void prepare_tables(const int x1, const int y1, const int IH_pad, const int IW_pad,
+                        const int OH_pad, const int OW_pad, const int h_stride, const int w_stride) {
+        std::vector<int> key = {x1, y1, IH_pad, IW_pad, OH_pad, OW_pad, h_stride, w_stride};
+        if (key == tables_key)
+            return;
 
         float rh;
         float rw;
@@ -260,6 +304,23 @@ private:
             rw = static_cast<float>(IW_pad) / (OW_pad);
         }
 
+        fill_axis_table(h_table, rh, IH_pad, OH_pad, y1, h_stride);
+        fill_axis_table(w_table, rw, IW_pad, OW_pad, x1, w_stride);
+        tables_key = key;
+    }
+
+    void interpolate(const size_t N, const size_t C,
+                     const float *src, const int x1, const int y1,
+                     const int IH_pad, const int IW_pad, const size_t IH, const size_t IW,
+                     float *dst, const int x2, const int y2,
+                     const int OH_pad, const int OW_pad, const size_t OH, const size_t OW) {
+        if (IH_pad == OH_pad && IW_pad == OW_pad) {
+            for (size_t i = 0; i < N * C * OH * OW; i++) {
+                dst[i] = src[i];
+            }
+            return;
+        }
+
         int block_size = 1;
         if (mayiuse(avx512_common)) {
             block_size = 16;
@@ -272,98 +333,67 @@ private:
 
         size_t CH = (C + block_size - 1) / block_size;
 
+        // The h offsets are in elements of the channel block, the w ones are in bytes for the kernel
+        prepare_tables(x1, y1, IH_pad, IW_pad, OH_pad, OW_pad, IW * block_size, block_size * sizeof(float));
+
         parallel_for3d(N, CH, OH_pad, [&](size_t n, size_t cb, size_t h) {
                     const float *psrc_n_cb = src + n * CB * IH * IW + cb * block_size * IW * IH;  //  n+cb src address
 
-                    // h is output h
-                    float fh = rh * h;
-                    // ih0 is higher input h position
-                    int ih0 = static_cast<int>(fh);
-                    // ih1 is lower input h position
-                    int ih1 = (ih0 < IH_pad - 1) ? ih0 + 1 : ih0;
-
-                    float h_lambda0 = fh - ih0;  // for lower input h weight
-                    float h_lambda1 = 1.0f - h_lambda0;  // for higher input h weight
-
-                    const float *psrc_h0 = psrc_n_cb + (y1 + ih0) * IW * block_size + x1 * block_size;
-                    const float *psrc_h1 = psrc_n_cb + (y1 + ih1) * IW * block_size + x1 * block_size;
-                    float *pdst_h = dst + n * CB * OH * OW + cb * block_size * OW * OH + (y2 + h) * OW * block_size + x2 * block_size;
-
                     auto arg = jit_args_interp();
-                    arg.h_lambda0 = static_cast<float*>(&h_lambda0);
-                    arg.h_lambda1 = static_cast<float*>(&h_lambda1);
-                    for (int w = 0; w < OW_pad; ++w) {
-                        float fw = rw * w;
-                        int iw0 = static_cast<int>(fw);
-                        int iw1 = (iw0 < IW_pad - 1) ? iw0 + 1 : iw0;
-
-                        float w_lambda0 = fw - iw0;  // for right input w weight
-                        float w_lambda1 = 1.0f - w_lambda0;  // for left input w weight
-
-                        const float *psrc00 = psrc_h0 + iw0 * block_size;
-                        const float *psrc01 = psrc_h0 + iw1 * block_size;
-                        const float *psrc10 = psrc_h1 + iw0 * block_size;
-                        const float *psrc11 = psrc_h1 + iw1 * block_size;
-
-                        float *pdst = pdst_h + w * block_size;
-
-                        arg.src00 = psrc00;
-                        arg.src01 = psrc01;
-                        arg.src10 = psrc10;
-                        arg.src11 = psrc11;
-                        arg.dst = pdst;
-                        arg.w_lambda0 = static_cast<float*>(&w_lambda0);
-                        arg.w_lambda1 = static_cast<float*>(&w_lambda1);
-                        (*interp_kernel)(&arg);
-                    }
+                    arg.src_h0 = psrc_n_cb + h_table.idx0[h];
+                    arg.src_h1 = psrc_n_cb + h_table.idx1[h];
+                    arg.dst = dst + n * CB * OH * OW + cb * block_size * OW * OH + (y2 + h) * OW * block_size + x2 * block_size;
+                    arg.w_idx0 = &w_table.idx0[0];
+                    arg.w_idx1 = &w_table.idx1[0];
+                    arg.w_lambda0 = &w_table.lambda0[0];
+                    arg.w_lambda1 = &w_table.lambda1[0];
+                    arg.h_lambda0 = &h_table.lambda0[h];
+                    arg.h_lambda1 = &h_table.lambda1[h];
+                    arg.work_amount = static_cast<size_t>(OW_pad);
+                    (*interp_kernel)(&arg);
         });
     }
 
+    static inline void store_8u(float *dst, float value) {
+        *dst = value;
+    }
+
+    static inline void store_8u(uint8_t *dst, float value) {
+        *dst = static_cast<uint8_t>((std::min)((std::max)(value + 0.5f, 0.0f), 255.0f));
+    }
+
+    template <typename dst_t>
     void interpolate_8u(Layout layout, const size_t N, const size_t C,
         const uint8_t *src, const int x1, const int y1,
         const int IH_pad, const int IW_pad, const size_t IH, const size_t IW,
-        float *dst, const int x2, const int y2,
+        dst_t *dst, const int x2, const int y2,
         const int OH_pad, const int OW_pad, const size_t OH, const size_t OW) {
         if (IH_pad == OH_pad && IW_pad == OW_pad) {
             for (size_t i = 0; i < N * C * OH * OW; i++) {
-                dst[i] = static_cast<float>(src[i]);
+                dst[i] = static_cast<dst_t>(src[i]);
             }
             return;
         }
 
-        float rh;
-        float rw;
-        if (align_corners) {
-            rh = (OH_pad > 1) ? static_cast<float>(IH_pad - 1) / (OH_pad - 1) : 0.0f;
-            rw = (OW_pad > 1) ? static_cast<float>(IW_pad - 1) / (OW_pad - 1) : 0.0f;
-        } else {
-            rh = static_cast<float>(IH_pad) / (OH_pad);
-            rw = static_cast<float>(IW_pad) / (OW_pad);
-        }
+        prepare_tables(x1, y1, IH_pad, IW_pad, OH_pad, OW_pad, IW, 1);
 
         parallel_for3d(N, C, OH_pad, [&](size_t n, size_t cb, size_t h) {
-            const uint8_t *psrc = src + n * C * IH * IW;
-
-            float fh = rh * h;
-            int ih0 = static_cast<int>(fh);
-            int ih1 = (ih0 < IH_pad - 1) ? ih0 + 1 : ih0;
+            const uint8_t *psrc_h0 = src + n * C * IH * IW + cb * IW * IH + h_table.idx0[h];
+            const uint8_t *psrc_h1 = src + n * C * IH * IW + cb * IW * IH + h_table.idx1[h];
+            dst_t *pdst = dst + n * C * OH * OW + cb * OW * OH + (y2 + h) * OW + x2;
 
-            float h_lambda0 = fh - ih0;
-            float h_lambda1 = 1.0f - h_lambda0;
+            float h_lambda0 = h_table.lambda0[h];
+            float h_lambda1 = h_table.lambda1[h];
 
             for (int w = 0; w < OW_pad; ++w) {
-                float fw = rw * w;
-                int iw0 = static_cast<int>(fw);
-                int iw1 = (iw0 < IW_pad - 1) ? iw0 + 1 : iw0;
-
-                float w_lambda0 = fw - iw0;
-                float w_lambda1 = 1.0f - w_lambda0;
-
-                dst[n * C * OH * OW + cb * OW * OH + (y2 + h) * OW + (x2 + w)] =
-                    h_lambda1 * (w_lambda1 * static_cast<float>(psrc[cb * IW * IH + (y1 + ih0) * IW + (x1 + iw0)]) +
-                    w_lambda0 * static_cast<float>(psrc[cb * IW * IH + (y1 + ih0) * IW + (x1 + iw1)])) +
-                    h_lambda0 * (w_lambda1 * static_cast<float>(psrc[cb * IW * IH + (y1 + ih1) * IW + (x1 + iw0)]) +
-                    w_lambda0 * static_cast<float>(psrc[cb * IW * IH + (y1 + ih1) * IW + (x1 + iw1)]));
+                int iw0 = w_table.idx0[w];
+                int iw1 = w_table.idx1[w];
+                float w_lambda0 = w_table.lambda0[w];
+                float w_lambda1 = w_table.lambda1[w];
+
+                store_8u(&pdst[w],
+                    h_lambda1 * (w_lambda1 * static_cast<float>(psrc_h0[iw0]) + w_lambda0 * static_cast<float>(psrc_h0[iw1])) +
+                    h_lambda0 * (w_lambda1 * static_cast<float>(psrc_h1[iw0]) + w_lambda0 * static_cast<float>(psrc_h1[iw1])));
             }
         });
     }
@@ -90,6 +90,10 @@ public:
                 THROW_IE_EXCEPTION << layer->name << " Incorrect Math layer type!";
 
             addConfig(layer, { { ConfLayout::PLN, false, 0 } }, { { ConfLayout::PLN, false, 0 } });
+            // the function is applied to every element, so the blocked layout of the neighbours is kept as is
+            const auto blk_layout = getChannelBlockedLayout(layer->insData[0].lock());
+            if (blk_layout != ConfLayout::PLN)
+                addConfig(layer, { { blk_layout, false, 0 } }, { { blk_layout, false, 0 } });
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -119,8 +119,8 @@ void MKLDNNActivationNode::createPrimitive() {
 
     auto prim_desc = createPrimitiveDescriptor<eltwise_forward::primitive_desc, eltwise_forward::desc>();
 
-    prim.reset(new eltwise_forward(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
-                                getChildEdgeAt(0)->getMemory().GetPrimitive()));
+    createCachedPrimitive<eltwise_forward>(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                                        getChildEdgeAt(0)->getMemory().GetPrimitive());
 }
 
 bool MKLDNNActivationNode::created() const {
@@ -170,20 +170,20 @@ void MKLDNNBatchNormalizationNode::createPrimitive() {
     if (fusedWithScale()) {
         auto prim_desc = createPrimitiveDescriptor<batch_normalization_forward::primitive_desc,
                 batch_normalization_forward::desc>();
-        prim.reset(new batch_normalization_forward(prim_desc,
-                                                   getParentEdgeAt(0)->getMemory().GetPrimitive(),
-                                                   (const primitive::at) internalBlobMemory[1]->GetPrimitive(),
-                                                   (const primitive::at) internalBlobMemory[0]->GetPrimitive(),
-                                                   (const primitive::at) internalBlobMemory[2]->GetPrimitive(),
-                                                   getChildEdgeAt(0)->getMemory().GetPrimitive()));
+        createCachedPrimitive<batch_normalization_forward>(prim_desc,
+                                                           getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                                                           (const primitive::at) internalBlobMemory[1]->GetPrimitive(),
+                                                           (const primitive::at) internalBlobMemory[0]->GetPrimitive(),
+                                                           (const primitive::at) internalBlobMemory[2]->GetPrimitive(),
+                                                           getChildEdgeAt(0)->getMemory().GetPrimitive());
     }  else {
         auto prim_desc = createPrimitiveDescriptor<batch_normalization_forward::primitive_desc,
                 batch_normalization_forward::desc>();
-        prim.reset(new batch_normalization_forward(prim_desc,
-                                                   getParentEdgeAt(0)->getMemory().GetPrimitive(),
-                                                   (const primitive::at) internalBlobMemory[1]->GetPrimitive(),
-                                                   (const primitive::at) internalBlobMemory[0]->GetPrimitive(),
-                                                   getChildEdgeAt(0)->getMemory().GetPrimitive()));
+        createCachedPrimitive<batch_normalization_forward>(prim_desc,
+                                                           getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                                                           (const primitive::at) internalBlobMemory[1]->GetPrimitive(),
+                                                           (const primitive::at) internalBlobMemory[0]->GetPrimitive(),
+                                                           getChildEdgeAt(0)->getMemory().GetPrimitive());
     }
 }
 
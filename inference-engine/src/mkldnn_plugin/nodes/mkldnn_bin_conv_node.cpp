@@ -405,10 +405,10 @@ void MKLDNNBinaryConvolutionNode::createPrimitive() {
     auto prim_desc = createPrimitiveDescriptor<binary_convolution_forward::primitive_desc,
             binary_convolution_forward::desc>(attr);
 
-    prim.reset(new binary_convolution_forward(prim_desc,
-                                       getParentEdgeAt(0)->getMemory().GetPrimitive(),
-                                       internalBlobMemory[0]->GetPrimitive(),
-                                       getChildEdgeAt(0)->getMemory().GetPrimitive()));
+    createCachedPrimitive<binary_convolution_forward>(prim_desc,
+                                               getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                                               internalBlobMemory[0]->GetPrimitive(),
+                                               getChildEdgeAt(0)->getMemory().GetPrimitive());
 }
 
 bool MKLDNNBinaryConvolutionNode::created() const {
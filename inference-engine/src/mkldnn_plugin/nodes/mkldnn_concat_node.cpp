@@ -621,7 +621,9 @@ void MKLDNNConcatNode::execute(mkldnn::stream strm) {
             channels_size += num_channels;
         }
 
-        const size_t iter_count = getParentEdgeAt(0)->getMemory().GetSize() / channels[0];
+        // the channels are the innermost dimension, so the batch items are the outermost blocks of the iterations
+        const MKLDNNMemory& src0_mem = getParentEdgeAt(0)->getMemory();
+        const size_t iter_count = src0_mem.GetSize() / channels[0] / src0_mem.GetDims()[0] * batchToProcess();
 
         parallel_for(iter_count, [&](int i) {
             const size_t dst_off = i * channels_size;
@@ -280,52 +280,60 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
                 getParentEdgeAt(0)->getDims().ndims() == 5 ? memory::ndhwc : memory::nhwc);
         createDescriptor({in_candidate}, {out_candidate});
     } else {
-        // If the weights aren't quantized, the only precision we support is FP32
-        inputDataType = memory::f32;
-        outputDataType = memory::f32;
+        // If the weights aren't quantized, the convolution is executed in FP32, or in BF16 where it's enabled.
+        // The FP32 descriptors are the fallback for the post-ops and the shapes the BF16 kernels don't support.
+        std::vector<memory::data_type> dataTypes;
+        if (isBF16Enabled() && !withSum && !withDWConv)
+            dataTypes.push_back(memory::bf16);
+        dataTypes.push_back(memory::f32);
         eltwisePrecision = Precision::FP32;
 
         Layout layout = convLayer->input()->getLayout();
 
-        if (layout == NCHW || layout == NHWC) {
-            MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), inputDataType,
-                    layout == NCHW ? memory::nchw : memory::nhwc);
-            MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType,
-                    layout == NCHW ? memory::nchw : memory::nhwc);
-            createDescriptor({in_candidate}, {out_candidate});
+        for (auto dataType : dataTypes) {
+            inputDataType = dataType;
+            outputDataType = dataType;
 
-            if (IC == 3 || IC == 1) {
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nChw16c);
+            if (layout == NCHW || layout == NHWC) {
+                MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), inputDataType,
+                        layout == NCHW ? memory::nchw : memory::nhwc);
+                MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType,
+                        layout == NCHW ? memory::nchw : memory::nhwc);
                 createDescriptor({in_candidate}, {out_candidate});
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nChw8c);
-                createDescriptor({in_candidate}, {out_candidate});
-            } else {
-                in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nChw16c);
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nChw16c);
-                createDescriptor({in_candidate}, {out_candidate});
-                in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nChw8c);
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nChw8c);
-                createDescriptor({in_candidate}, {out_candidate});
-            }
-        } else if (layout == NCDHW || layout == NDHWC) {
-            MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), inputDataType,
-                    layout == NCDHW ? memory::ncdhw : memory::ndhwc);
-            MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType,
-                    layout == NCDHW ? memory::ncdhw : memory::ndhwc);
-            createDescriptor({in_candidate}, {out_candidate});
-
-            if (IC == 3 || IC == 1) {
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nCdhw16c);
-                createDescriptor({in_candidate}, {out_candidate});
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nCdhw8c);
-                createDescriptor({in_candidate}, {out_candidate});
-            } else {
-                in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nCdhw16c);
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nCdhw16c);
-                createDescriptor({in_candidate}, {out_candidate});
-                in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nCdhw8c);
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nCdhw8c);
+
+                if (IC == 3 || IC == 1) {
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nChw16c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nChw8c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                } else {
+                    in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nChw16c);
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nChw16c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                    in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nChw8c);
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nChw8c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                }
+            } else if (layout == NCDHW || layout == NDHWC) {
+                MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), inputDataType,
+                        layout == NCDHW ? memory::ncdhw : memory::ndhwc);
+                MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType,
+                        layout == NCDHW ? memory::ncdhw : memory::ndhwc);
                 createDescriptor({in_candidate}, {out_candidate});
+
+                if (IC == 3 || IC == 1) {
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nCdhw16c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nCdhw8c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                } else {
+                    in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nCdhw16c);
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nCdhw16c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                    in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nCdhw8c);
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nCdhw8c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                }
             }
         }
     }
@@ -623,6 +631,8 @@ void MKLDNNConvolutionNode::initSupportedPrimitiveDescriptors() {
             itpd++;
         }
     }
+
+    preferBF16PrimitiveDescriptors();
 }
 
 
@@ -639,16 +649,16 @@ void MKLDNNConvolutionNode::createPrimitive() {
             convolution_forward::desc>(attr);
 
     if (withBiases) {
-        prim.reset(new convolution_forward(prim_desc,
-                                           getParentEdgeAt(0)->getMemory().GetPrimitive(),
-                                           getWeights(),
-                                           getBias(),
-                                           getChildEdgeAt(0)->getMemory().GetPrimitive()));
+        createCachedPrimitive<convolution_forward>(prim_desc,
+                                                   getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                                                   getWeights(),
+                                                   getBias(),
+                                                   getChildEdgeAt(0)->getMemory().GetPrimitive());
     } else {
-        prim.reset(new convolution_forward(prim_desc,
-                                           getParentEdgeAt(0)->getMemory().GetPrimitive(),
-                                           getWeights(),
-                                           getChildEdgeAt(0)->getMemory().GetPrimitive()));
+        createCachedPrimitive<convolution_forward>(prim_desc,
+                                                   getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                                                   getWeights(),
+                                                   getChildEdgeAt(0)->getMemory().GetPrimitive());
     }
 }
 
@@ -656,6 +666,16 @@ bool MKLDNNConvolutionNode::created() const {
     return getType() == Convolution;
 }
 
+uint64_t MKLDNNConvolutionNode::getFlops() const {
+    // every output is a dot product over the input channels of its group and the kernel
+    const auto& dstDims = getChildEdgeAt(0)->getDims();
+    const size_t spatialDims = dstDims.ndims() - 2;
+    uint64_t macsPerOutput = 1;
+    for (size_t i = weightDims.size() - spatialDims - 1; i < weightDims.size(); i++)
+        macsPerOutput *= weightDims[i];
+    return 2 * macsPerOutput * static_cast<uint64_t>(dstDims.size());
+}
+
 void MKLDNNConvolutionNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                              const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
     TensorDesc inDesc = inputDesc[0], outDesc = outputDesc[0];
@@ -666,6 +686,9 @@ void MKLDNNConvolutionNode::createDescriptor(const std::vector<InferenceEngine::
     if (inDesc.getPrecision() == Precision::U8 || inDesc.getPrecision() == Precision::I8) {
         wdt = memory::s8;
         bdt = baseInputsNumber == 3 ? precisionToDataType(getCnnLayer()->insData[2].lock()->getPrecision()) : memory::s32;
+    } else if (inDesc.getPrecision() == Precision::BF16) {
+        // the weights are converted to BF16 once the primitive is created, the BF16 kernels take FP32 biases
+        bdt = memory::f32;
     }
 
     if (baseInputsNumber == 1) {
@@ -729,6 +752,41 @@ void MKLDNNConvolutionNode::createDescriptor(const std::vector<InferenceEngine::
     }
 }
 
+bool MKLDNNConvolutionNode::isWinogradPreferable() {
+    // F(4x4, 3x3) of the AVX-512 kernels saves 4x multiplications, which outweighs the transforms of the tiles only
+    // when the feature maps give many tiles, the direct kernels are faster on the small ones and on the large batches
+    const ptrdiff_t minChannels = 64;
+    const ptrdiff_t minSpatial = 112 * 112;
+    const ptrdiff_t maxBatch = 4;
+
+    if (baseInputsNumber != 1 || isGrouped || isMerged || withDWConv || !mkldnn::impl::cpu::mayiuse(mkldnn::impl::cpu::avx512_common))
+        return false;
+    if (getCnnLayer()->insData[0].lock()->getPrecision() != Precision::FP32 || !inputZeroPoints.empty())
+        return false;
+    Blob::Ptr weights = getCnnLayer()->blobs.find("weights")->second;
+    if (weights->getTensorDesc().getPrecision() != Precision::FP32)
+        return false;
+
+    if (weightDims.size() != 4 || weightDims[2] != 3 || weightDims[3] != 3)
+        return false;
+    for (auto s : stride)
+        if (s != 1) return false;
+    for (auto d : dilation)
+        if (d != 0) return false;
+
+    const auto& dstDims = getChildEdgeAt(0)->getDims();
+    const ptrdiff_t OC = weightDims[0], IC = weightDims[1];
+    return OC >= minChannels && IC >= minChannels && OC % 16 == 0 && IC % 16 == 0 &&
+           dstDims[0] <= maxBatch && dstDims[2] * dstDims[3] >= minSpatial;
+}
+
+const std::vector<impl_desc_type>& MKLDNNConvolutionNode::getPrimitivesPriority() {
+    if (isWinogradPreferable() &&
+        std::find(implPriorities.begin(), implPriorities.end(), impl_desc_type::jit_avx512_winograd) == implPriorities.end())
+        implPriorities.push_back(impl_desc_type::jit_avx512_winograd);
+    return MKLDNNNode::getPrimitivesPriority();
+}
+
 void MKLDNNConvolutionNode::addZeroPoints(mkldnn::primitive_attr& attr) const {
     if (!inputZeroPoints.empty())
         attr.set_input_zero_points(1 << 1 /*through C dim*/, inputZeroPoints);
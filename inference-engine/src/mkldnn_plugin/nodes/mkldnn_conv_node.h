@@ -24,6 +24,7 @@ public:
     void createPrimitive() override;
     void initSupportedPrimitiveDescriptors() override;
     bool created() const override;
+    uint64_t getFlops() const override;
     bool canBeInPlace() const override {
         return false;
     }
@@ -50,10 +51,13 @@ public:
 
 protected:
     void addScaleToPrimitiveAttr(mkldnn::primitive_attr attr) const;
+    // the Winograd implementation goes before the direct ones when it is preferable, after the ones of PrimitivesPriority
+    const std::vector<impl_desc_type>& getPrimitivesPriority() override;
 
 private:
     mkldnn::memory::data_type precisionToDataType(InferenceEngine::Precision prec);
     void addZeroPoints(mkldnn::primitive_attr& attr) const;
+    bool isWinogradPreferable();
 
     bool withBiases;
     bool withActivation;
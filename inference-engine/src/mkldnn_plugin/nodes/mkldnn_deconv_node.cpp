@@ -166,6 +166,12 @@ bool MKLDNNDeconvolutionNode::created() const {
     return getType() == Deconvolution;
 }
 
+uint64_t MKLDNNDeconvolutionNode::getFlops() const {
+    // every input is scattered to the output channels of its group over the kernel
+    const auto& srcDims = getParentEdgeAt(0)->getDims();
+    return 2 * static_cast<uint64_t>(srcDims.size()) * static_cast<uint64_t>(weightsDims.size() / srcDims[1]);
+}
+
 void MKLDNNDeconvolutionNode::createPrimitive() {
     if (prim)
         return;
@@ -173,10 +179,10 @@ void MKLDNNDeconvolutionNode::createPrimitive() {
     auto prim_desc = createPrimitiveDescriptor<convolution_backward_data::primitive_desc,
             convolution_backward_data::desc, convolution_forward::primitive_desc>();
 
-    prim.reset(new convolution_backward_data(prim_desc,
-            getParentEdgeAt(0)->getMemory().GetPrimitive(),
-            internalBlobMemory[0]->GetPrimitive(),
-            getChildEdgeAt(0)->getMemory().GetPrimitive()));
+    createCachedPrimitive<convolution_backward_data>(prim_desc,
+                    getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                    internalBlobMemory[0]->GetPrimitive(),
+                    getChildEdgeAt(0)->getMemory().GetPrimitive());
 }
 
 void MKLDNNDeconvolutionNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
@@ -23,6 +23,7 @@ public:
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    uint64_t getFlops() const override;
     bool canBeInPlace() const override {
         return false;
     }
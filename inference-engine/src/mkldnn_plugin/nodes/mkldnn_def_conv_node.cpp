@@ -15,6 +15,7 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <ie_layers_internal.hpp>
+#include "cpu_isa_traits.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -114,6 +115,18 @@ void MKLDNNDeformableConvolutionNode::getSupportedDescriptors() {
     MKLDNNMemoryDesc offset_candidate(getParentEdgeAt(1)->getDims(), memory::f32, memory::nchw);
     MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), memory::f32, memory::nhwc);
     createDescriptor({in_candidate, offset_candidate}, {out_candidate});
+
+    // the JIT kernel gathers the blocked activations by the whole blocks, so no reorders are needed in the blocked graphs
+    if (mkldnn::impl::cpu::mayiuse(mkldnn::impl::cpu::avx2) && !isGrouped && !isMerged) {
+        const bool isAvx512 = mkldnn::impl::cpu::mayiuse(mkldnn::impl::cpu::avx512_common);
+        const int blockSize = isAvx512 ? 16 : 8;
+        const auto blockedFormat = isAvx512 ? memory::nChw16c : memory::nChw8c;
+        if ((groupIC / deformable_group) % blockSize == 0) {
+            MKLDNNMemoryDesc blocked_in_candidate(getParentEdgeAt(0)->getDims(), memory::f32, blockedFormat);
+            MKLDNNMemoryDesc blocked_out_candidate(getChildEdgeAt(0)->getDims(), memory::f32, blockedFormat);
+            createDescriptor({blocked_in_candidate, offset_candidate}, {blocked_out_candidate});
+        }
+    }
 }
 
 void MKLDNNDeformableConvolutionNode::initSupportedPrimitiveDescriptors() {
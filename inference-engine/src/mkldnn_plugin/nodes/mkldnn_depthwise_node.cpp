@@ -106,14 +106,14 @@ void MKLDNNDepthwiseNode::createPrimitive() {
     }
 
     if (isWithBiases()) {
-        prim.reset(new depthwise_forward(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
-                                         internalBlobMemory[0]->GetPrimitive(),
-                                         internalBlobMemory[1]->GetPrimitive(),
-                                         getChildEdgeAt(0)->getMemory().GetPrimitive()));
+        createCachedPrimitive<depthwise_forward>(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                                                 internalBlobMemory[0]->GetPrimitive(),
+                                                 internalBlobMemory[1]->GetPrimitive(),
+                                                 getChildEdgeAt(0)->getMemory().GetPrimitive());
     } else {
-        prim.reset(new depthwise_forward(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
-                                         internalBlobMemory[0]->GetPrimitive(),
-                                         getChildEdgeAt(0)->getMemory().GetPrimitive()));
+        createCachedPrimitive<depthwise_forward>(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                                                 internalBlobMemory[0]->GetPrimitive(),
+                                                 getChildEdgeAt(0)->getMemory().GetPrimitive());
     }
 }
 
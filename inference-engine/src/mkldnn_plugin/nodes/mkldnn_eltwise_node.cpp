@@ -36,11 +36,13 @@ struct jit_uni_eltwise_fq_generic : public jit_uni_eltwise_fq_kernel, public jit
         for (int i = 0; i < p.len_; i++) {
             auto &post_op = p.entry_[i];
             if (post_op.is_eltwise()) {
-                eltwise_injectors.push_back(new jit_uni_eltwise_injector_f32<isa>(
+                eltwise_injectors.push_back(std::make_shared<jit_uni_eltwise_injector_f32<isa>>(
                         this,
                         post_op.eltwise.alg,
                         post_op.eltwise.alpha,
                         post_op.eltwise.beta));
+            } else {
+                eltwise_injectors.push_back(nullptr);
             }
         }
 
@@ -70,6 +72,18 @@ struct jit_uni_eltwise_fq_generic : public jit_uni_eltwise_fq_kernel, public jit
         Xbyak::Label tail_loop_label;
         Xbyak::Label tail_loop_end_label;
 
+        for (size_t i = 0; i < jep.fused_ops.size(); i++) {
+            const auto &fused_op = jep.fused_ops[i];
+            if (fused_op.post_op_idx < 0 && fused_op.src_idx < 0 && fused_op.src_stage != static_cast<int>(i))
+                saved_stages.push_back(fused_op.src_stage);
+        }
+        std::sort(saved_stages.begin(), saved_stages.end());
+        saved_stages.erase(std::unique(saved_stages.begin(), saved_stages.end()), saved_stages.end());
+        if (saved_stages.size() > MAX_ELTWISE_FUSED_STAGES)
+            THROW_IE_EXCEPTION << "Eltwise node supports not more than " << MAX_ELTWISE_FUSED_STAGES << " reused results of fused operations";
+        if (jep.post_srcs_num > MAX_ELTWISE_FUSED_INPUTS)
+            THROW_IE_EXCEPTION << "Eltwise node supports not more than " << MAX_ELTWISE_FUSED_INPUTS << " inputs of fused operations";
+
         if (isa == avx512_common)
             vpxord(vmm_zero, vmm_zero, vmm_zero);
 
@@ -78,6 +92,8 @@ struct jit_uni_eltwise_fq_generic : public jit_uni_eltwise_fq_kernel, public jit
         if (jep.src1_step == 0)
             uni_vbroadcastss(vmm_src1, ptr[reg_src1]);
 
+        xor_(reg_post_offset, reg_post_offset);
+
         L(main_loop_label);
         {
             cmp(reg_work_amount, simd_w);
@@ -88,63 +104,9 @@ struct jit_uni_eltwise_fq_generic : public jit_uni_eltwise_fq_kernel, public jit
             if (jep.src1_step != 0)
                 load_vector(vmm_src1, ptr[reg_src1], jep.src1_dt);
 
-            switch (jep.eltwise_op) {
-                case EltwiseLayer::eOperation::Sum:
-                    if (isa == cpu::sse42) {
-                        uni_vmovups(vmm_dst, vmm_src0);
-                        uni_vaddps(vmm_dst, vmm_dst, vmm_src1);
-                    } else {
-                        uni_vaddps(vmm_dst, vmm_src0, vmm_src1);
-                    }
-                    break;
-                case EltwiseLayer::eOperation::Prod:
-                    if (isa == cpu::sse42) {
-                        uni_vmovups(vmm_dst, vmm_src0);
-                        uni_vmulps(vmm_dst, vmm_dst, vmm_src1);
-                    } else {
-                        uni_vmulps(vmm_dst, vmm_src0, vmm_src1);
-                    }
-                    break;
-                default: THROW_IE_EXCEPTION << "Unsupported operation type for Eltwise node";
-            }
-
-            int eltwise_inj_idx = 0;
-            for (int i = 0; i < p.len_; i++) {
-                auto &post_op = p.entry_[i];
-                if (post_op.is_eltwise()) {
-                    eltwise_injectors[eltwise_inj_idx]->compute_vector_range(vmm_dst.getIdx(), vmm_dst.getIdx() + 1);
-                    eltwise_inj_idx++;
-                } else if (post_op.is_quantization()) {
-                    bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
-                    bool do_rounding = do_dequantization || jep_.dst_dt == data_type::f32 || i != p.len_ - 1;
-
-                    uni_vmovups(vmm_d_weights, ptr[reg_crop_low]);
-                    uni_vmovups(vmm_d_bias, ptr[reg_crop_high]);
-                    uni_vmaxps(vmm_dst, vmm_dst, vmm_d_weights);
-                    uni_vminps(vmm_dst, vmm_dst, vmm_d_bias);
-
-                    uni_vmovups(vmm_d_weights, ptr[reg_input_scale]);
-                    uni_vmovups(vmm_d_bias, ptr[reg_input_shift]);
-                    uni_vfmadd213ps(vmm_dst, vmm_d_weights, vmm_d_bias);
-                    if (do_rounding)
-                        uni_vroundps(vmm_dst, vmm_dst, 0);
-
-                    if (do_dequantization) {
-                        uni_vmovups(vmm_d_weights, ptr[reg_output_scale]);
-                        uni_vmovups(vmm_d_bias, ptr[reg_output_shift]);
-                        uni_vfmadd213ps(vmm_dst, vmm_d_weights, vmm_d_bias);
-                    }
+            apply_eltwise_op(jep.eltwise_op, vmm_dst, vmm_src0, vmm_src1);
 
-                    add(reg_crop_low, sizeof(float) * simd_w);
-                    add(reg_crop_high, sizeof(float) * simd_w);
-                    add(reg_input_scale, sizeof(float) * simd_w);
-                    add(reg_input_shift, sizeof(float) * simd_w);
-                    if (do_dequantization) {
-                        add(reg_output_scale, sizeof(float) * simd_w);
-                        add(reg_output_shift, sizeof(float) * simd_w);
-                    }
-                }
-            }
+            apply_fused_ops(false);
 
             store_vector(ptr[reg_dst], vmm_dst, jep.dst_dt);
 
@@ -153,6 +115,7 @@ struct jit_uni_eltwise_fq_generic : public jit_uni_eltwise_fq_kernel, public jit
             if (jep.src1_step != 0)
                 add(reg_src1, jep.src1_step * jep.src1_data_size * simd_w);
             add(reg_dst, jep.dst_step * jep.dst_data_size * simd_w);
+            add(reg_post_offset, simd_w);
             sub(reg_work_amount, simd_w);
 
             jmp(main_loop_label, T_NEAR);
@@ -170,49 +133,9 @@ struct jit_uni_eltwise_fq_generic : public jit_uni_eltwise_fq_kernel, public jit
             if (jep.src1_step != 0)
                 load_scalar(xmm_src1, ptr[reg_src1], jep.src1_dt);
 
-            switch (jep.eltwise_op) {
-                case EltwiseLayer::eOperation::Sum: uni_vaddps(vmm_dst, vmm_src0, vmm_src1); break;
-                case EltwiseLayer::eOperation::Prod: uni_vmulps(vmm_dst, vmm_src0, vmm_src1); break;
-                default: THROW_IE_EXCEPTION << "Unsupported operation type for Eltwise node";
-            }
+            apply_eltwise_op(jep.eltwise_op, vmm_dst, vmm_src0, vmm_src1);
 
-            int eltwise_inj_idx = 0;
-            for (int i = 0; i < p.len_; i++) {
-                auto &post_op = p.entry_[i];
-                if (post_op.is_eltwise()) {
-                    eltwise_injectors[eltwise_inj_idx]->compute_vector_range(vmm_dst.getIdx(), vmm_dst.getIdx() + 1);
-                    eltwise_inj_idx++;
-                } else if (post_op.is_quantization()) {
-                    bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
-                    bool do_rounding = do_dequantization || jep_.dst_dt == data_type::f32;
-
-                    movss(xmm_d_weights, ptr[reg_crop_low]);
-                    movss(xmm_d_bias, ptr[reg_crop_high]);
-                    uni_vmaxps(vmm_dst, vmm_dst, vmm_d_weights);
-                    uni_vminps(vmm_dst, vmm_dst, vmm_d_bias);
-
-                    movss(xmm_d_weights, ptr[reg_input_scale]);
-                    movss(xmm_d_bias, ptr[reg_input_shift]);
-                    uni_vfmadd213ps(vmm_dst, vmm_d_weights, vmm_d_bias);
-                    if (do_rounding)
-                        uni_vroundps(vmm_dst, vmm_dst, 0);
-
-                    if (do_dequantization) {
-                        movss(xmm_d_weights, ptr[reg_output_scale]);
-                        movss(xmm_d_bias, ptr[reg_output_shift]);
-                        uni_vfmadd213ps(vmm_dst, vmm_d_weights, vmm_d_bias);
-                    }
-
-                    add(reg_crop_low, sizeof(float) * 1);
-                    add(reg_crop_high, sizeof(float) * 1);
-                    add(reg_input_scale, sizeof(float) * 1);
-                    add(reg_input_shift, sizeof(float) * 1);
-                    if (do_dequantization) {
-                        add(reg_output_scale, sizeof(float) * 1);
-                        add(reg_output_shift, sizeof(float) * 1);
-                    }
-                }
-            }
+            apply_fused_ops(true);
 
             store_scalar(ptr[reg_dst], xmm_dst, jep.dst_dt);
 
@@ -221,6 +144,7 @@ struct jit_uni_eltwise_fq_generic : public jit_uni_eltwise_fq_kernel, public jit
             if (jep.src1_step != 0)
                 add(reg_src1, jep.src1_step * jep.src1_data_size);
             add(reg_dst, jep.dst_step * jep.dst_data_size);
+            add(reg_post_offset, 1);
             sub(reg_work_amount, 1);
 
             jmp(tail_loop_label, T_NEAR);
@@ -230,8 +154,10 @@ struct jit_uni_eltwise_fq_generic : public jit_uni_eltwise_fq_kernel, public jit
 
         this->postamble();
 
-        for (auto& inj : eltwise_injectors)
-            inj->prepare_table();
+        for (auto& inj : eltwise_injectors) {
+            if (inj)
+                inj->prepare_table();
+        }
 
         ker_ = (decltype(ker_)) this->getCode();
     }
@@ -258,6 +184,10 @@ private:
     Reg64 reg_output_scale = rbx;
     Reg64 reg_output_shift = rdx;
 
+    // additional inputs are addressed by the number of elements processed so far
+    Reg64 reg_post_src = rbp;
+    Reg64 reg_post_offset = rsi;
+
     Vmm vmm_src0 = Vmm(0);
     Vmm vmm_src1 = Vmm(1);
     Vmm vmm_dst = Vmm(2);
@@ -272,7 +202,124 @@ private:
 
     Vmm vmm_zero = Vmm(5);
 
-    std::vector<mkldnn::impl::cpu::jit_uni_eltwise_injector_f32<isa>*> eltwise_injectors;
+    // results of the chain reused by subsequent operations are kept in registers starting from this one
+    const int saved_stages_first_idx = 6;
+    std::vector<int> saved_stages;
+
+    std::vector<std::shared_ptr<mkldnn::impl::cpu::jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
+
+    inline void apply_eltwise_op(EltwiseLayer::eOperation op, Vmm vmm_res, Vmm vmm_arg0, Vmm vmm_arg1) {
+        // SSE instructions accumulate the result into the first argument
+        if (isa == cpu::sse42 && vmm_res.getIdx() != vmm_arg0.getIdx()) {
+            assert(vmm_res.getIdx() != vmm_arg1.getIdx());
+            uni_vmovups(vmm_res, vmm_arg0);
+            vmm_arg0 = vmm_res;
+        }
+
+        switch (op) {
+            case EltwiseLayer::eOperation::Sum: uni_vaddps(vmm_res, vmm_arg0, vmm_arg1); break;
+            case EltwiseLayer::eOperation::Prod: uni_vmulps(vmm_res, vmm_arg0, vmm_arg1); break;
+            case EltwiseLayer::eOperation::Sub: uni_vsubps(vmm_res, vmm_arg0, vmm_arg1); break;
+            case EltwiseLayer::eOperation::Max: uni_vmaxps(vmm_res, vmm_arg0, vmm_arg1); break;
+            case EltwiseLayer::eOperation::Min: uni_vminps(vmm_res, vmm_arg0, vmm_arg1); break;
+            case EltwiseLayer::eOperation::Div: uni_vdivps(vmm_res, vmm_arg0, vmm_arg1); break;
+            case EltwiseLayer::eOperation::Squared_diff:
+                uni_vsubps(vmm_res, vmm_arg0, vmm_arg1);
+                uni_vmulps(vmm_res, vmm_res, vmm_res);
+                break;
+            default: THROW_IE_EXCEPTION << "Unsupported operation type for Eltwise node";
+        }
+    }
+
+    inline void save_stage(int stage) {
+        auto it = std::find(saved_stages.begin(), saved_stages.end(), stage);
+        if (it != saved_stages.end())
+            uni_vmovups(Vmm(saved_stages_first_idx + static_cast<int>(it - saved_stages.begin())), vmm_dst);
+    }
+
+    inline void apply_fused_binary(const jit_eltwise_fq_fused_op &fused_op, int stage, bool is_tail) {
+        Vmm vmm_operand = vmm_d_weights;
+        if (fused_op.src_idx >= 0) {
+            mov(reg_post_src, ptr[reg_params + GET_OFF(post_src) + fused_op.src_idx * sizeof(void*)]);
+            if (jep_.post_src_step[fused_op.src_idx] == 0)
+                uni_vbroadcastss(vmm_operand, ptr[reg_post_src]);
+            else if (is_tail)
+                movss(xmm_d_weights, ptr[reg_post_src + reg_post_offset * sizeof(float)]);
+            else
+                uni_vmovups(vmm_operand, ptr[reg_post_src + reg_post_offset * sizeof(float)]);
+        } else if (fused_op.src_stage == stage) {
+            vmm_operand = vmm_dst;
+        } else {
+            auto it = std::find(saved_stages.begin(), saved_stages.end(), fused_op.src_stage);
+            vmm_operand = Vmm(saved_stages_first_idx + static_cast<int>(it - saved_stages.begin()));
+        }
+
+        if (fused_op.src_first) {
+            apply_eltwise_op(fused_op.eltwise_op, vmm_d_bias, vmm_operand, vmm_dst);
+            uni_vmovups(vmm_dst, vmm_d_bias);
+        } else {
+            apply_eltwise_op(fused_op.eltwise_op, vmm_dst, vmm_dst, vmm_operand);
+        }
+    }
+
+    inline void apply_quantization(const post_ops_t::entry_t &post_op, bool is_last, bool is_tail) {
+        bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
+        bool do_rounding = do_dequantization || jep_.dst_dt == data_type::f32 || !is_last;
+        int step = is_tail ? 1 : simd_w;
+
+        auto load = [&](Vmm vmm, Xmm xmm, const Reg64 &reg) {
+            if (is_tail)
+                movss(xmm, ptr[reg]);
+            else
+                uni_vmovups(vmm, ptr[reg]);
+        };
+
+        load(vmm_d_weights, xmm_d_weights, reg_crop_low);
+        load(vmm_d_bias, xmm_d_bias, reg_crop_high);
+        uni_vmaxps(vmm_dst, vmm_dst, vmm_d_weights);
+        uni_vminps(vmm_dst, vmm_dst, vmm_d_bias);
+
+        load(vmm_d_weights, xmm_d_weights, reg_input_scale);
+        load(vmm_d_bias, xmm_d_bias, reg_input_shift);
+        uni_vfmadd213ps(vmm_dst, vmm_d_weights, vmm_d_bias);
+        if (do_rounding)
+            uni_vroundps(vmm_dst, vmm_dst, 0);
+
+        if (do_dequantization) {
+            load(vmm_d_weights, xmm_d_weights, reg_output_scale);
+            load(vmm_d_bias, xmm_d_bias, reg_output_shift);
+            uni_vfmadd213ps(vmm_dst, vmm_d_weights, vmm_d_bias);
+        }
+
+        add(reg_crop_low, sizeof(float) * step);
+        add(reg_crop_high, sizeof(float) * step);
+        add(reg_input_scale, sizeof(float) * step);
+        add(reg_input_shift, sizeof(float) * step);
+        if (do_dequantization) {
+            add(reg_output_scale, sizeof(float) * step);
+            add(reg_output_shift, sizeof(float) * step);
+        }
+    }
+
+    inline void apply_fused_ops(bool is_tail) {
+        const auto &p = attr_.post_ops_;
+
+        save_stage(0);
+        for (size_t i = 0; i < jep_.fused_ops.size(); i++) {
+            const auto &fused_op = jep_.fused_ops[i];
+            if (fused_op.post_op_idx < 0) {
+                apply_fused_binary(fused_op, static_cast<int>(i), is_tail);
+            } else {
+                auto &post_op = p.entry_[fused_op.post_op_idx];
+                if (post_op.is_eltwise()) {
+                    eltwise_injectors[fused_op.post_op_idx]->compute_vector_range(vmm_dst.getIdx(), vmm_dst.getIdx() + 1);
+                } else if (post_op.is_quantization()) {
+                    apply_quantization(post_op, fused_op.post_op_idx == p.len_ - 1, is_tail);
+                }
+            }
+            save_stage(static_cast<int>(i) + 1);
+        }
+    }
 
     inline void load_vector(Vmm vmm_src, const Xbyak::Address &op, memory::data_type src_dt) {
         switch (src_dt) {
@@ -451,14 +498,16 @@ void MKLDNNEltwiseNode::getSupportedDescriptors() {
         THROW_IE_EXCEPTION << "Cannot convert eltwise layer.";
     op = eltwiseLayer->_operation;
 
-    if (getParentEdges().size() < 2)
+    // additional inputs of fused operations follow inputs of the layer
+    size_t inputsNum = getCnnLayer()->insData.size();
+    if (getParentEdges().size() < 2 || inputsNum < 2)
         THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
     if (getChildEdges().empty())
         THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
     if (op == EltwiseLayer::Squared_diff)
-        if (getParentEdges().size() != 2)
+        if (inputsNum != 2)
             THROW_IE_EXCEPTION  << "Incorrect number of input edges for layer " << getName() << " for operation squared_diff.\n"
-                << "Expected: 2\n" << "Actual: " << getParentEdges().size();
+                << "Expected: 2\n" << "Actual: " << inputsNum;
 
     auto outDims = getChildEdgeAt(0)->getDims();
     for (size_t i = 0; i < getParentEdges().size(); i++) {
@@ -480,14 +529,14 @@ void MKLDNNEltwiseNode::getSupportedDescriptors() {
     if (op != EltwiseLayer::Sum && with_coeffs)
         THROW_IE_EXCEPTION << "Only sum operation supports operands coefficients";
 
-    if (with_coeffs && eltwiseLayer->coeff.size() != getParentEdges().size())
+    if (with_coeffs && eltwiseLayer->coeff.size() != inputsNum)
         THROW_IE_EXCEPTION << "Number of provided coefficients is not equal to number of operands";
 
     if (with_coeffs && eltwiseLayer->precision != Precision::FP32)
         THROW_IE_EXCEPTION << "Sum with coefficients supports only FP32 precision";
 
     sum_scales.clear();
-    for (int i = 0; i < getParentEdges().size(); i++)
+    for (int i = 0; i < inputsNum; i++)
         sum_scales.push_back(with_coeffs ? eltwiseLayer->coeff[i] : 1.0f);
 }
 
@@ -559,22 +608,10 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
         }
     } else {
         auto ndims = getCnnLayer()->outData[0]->getDims().size();
-        auto format = ndims == 2 ? memory::format::nc :
-                      ndims == 4 ? memory::format::nhwc :
-                      memory::format::ndhwc;
+        size_t inputsNum = getCnnLayer()->insData.size();
 
-        InferenceEngine::LayerConfig config;
-        impl_desc_type impl_type = impl_desc_type::ref;
-        config.dynBatchSupport = true;
-        for (size_t i = 0; i < getParentEdges().size(); i++) {
-            InferenceEngine::DataConfig dataConfig;
-            dataConfig.inPlace = -1;
-            dataConfig.constant = false;
-            auto inputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(
-                    getCnnLayer()->insData[i].lock()->getPrecision());
-            dataConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), inputDT, format);
-            config.inConfs.push_back(dataConfig);
-        }
+        // fused quantization and broadcasting need channels to be the innermost dimension
+        any_layout = !broadcast && !isFusedWith(Quantize);
 
         auto outputDT = memory::f32;
         auto lastFusedLayer = fusedWith[fusedWith.size() - 1].get()->getCnnLayer();
@@ -582,16 +619,51 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
             outputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(lastFusedLayer->outData[0]->getPrecision());
         }
 
-        InferenceEngine::DataConfig dataConfig;
-        dataConfig.inPlace = -1;
-        dataConfig.constant = false;
-        dataConfig.desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDT, format);
-        config.outConfs.push_back(dataConfig);
+        auto initFusedDesc = [&] (memory::format format) -> PrimitiveDescInfo {
+            InferenceEngine::LayerConfig config;
+            config.dynBatchSupport = true;
+            for (size_t i = 0; i < getParentEdges().size(); i++) {
+                InferenceEngine::DataConfig dataConfig;
+                dataConfig.inPlace = -1;
+                dataConfig.constant = false;
+                auto inputDT = i < inputsNum ? MKLDNNExtensionUtils::IEPrecisionToDataType(
+                        getCnnLayer()->insData[i].lock()->getPrecision()) : memory::f32;
+                dataConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), inputDT, format);
+                config.inConfs.push_back(dataConfig);
+            }
 
-        supportedPrimitiveDescriptors.push_back({config, impl_type, format});
+            InferenceEngine::DataConfig dataConfig;
+            dataConfig.inPlace = -1;
+            dataConfig.constant = false;
+            dataConfig.desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDT, format);
+            config.outConfs.push_back(dataConfig);
+
+            return {config, impl_desc_type::ref, format};
+        };
+
+        if (any_layout) {
+            auto formats = getAvailableFormatsForDims(getChildEdgeAt(0)->getDims());
+            if (ndims == 4)
+                formats.push_back(memory::format::nhwc);
+            else if (ndims == 5)
+                formats.push_back(memory::format::ndhwc);
+            for (const auto& format : formats)
+                supportedPrimitiveDescriptors.push_back(initFusedDesc(format));
+        } else {
+            auto format = ndims == 2 ? memory::format::nc :
+                          ndims == 4 ? memory::format::nhwc :
+                          memory::format::ndhwc;
+            supportedPrimitiveDescriptors.push_back(initFusedDesc(format));
+        }
+
+        // all the descriptors differ only in layout, which the kernel doesn't depend on
+        const auto &config = supportedPrimitiveDescriptors[0].getConfig();
+        auto getStep = [&](size_t i) {
+            return any_layout || config.inConfs[i].desc.getDims()[1] != 1 ? 1 : 0;
+        };
 
-        jep.src0_step = config.inConfs[0].desc.getDims()[1] == 1 ? 0 : 1;
-        jep.src1_step = config.inConfs[1].desc.getDims()[1] == 1 ? 0 : 1;
+        jep.src0_step = getStep(0);
+        jep.src1_step = getStep(1);
         jep.dst_step = 1;
         jep.src0_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(config.inConfs[0].desc.getPrecision());
         jep.src1_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(config.inConfs[1].desc.getPrecision());
@@ -601,6 +673,12 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
         jep.dst_data_size = MKLDNNExtensionUtils::sizeOfDataType(jep.dst_dt);
         jep.eltwise_op = op;
 
+        jep.post_srcs_num = static_cast<int>(getParentEdges().size() - inputsNum);
+        if (jep.post_srcs_num > MAX_ELTWISE_FUSED_INPUTS)
+            THROW_IE_EXCEPTION << "Eltwise node " << getName() << " has too many inputs of fused operations";
+        for (int i = 0; i < jep.post_srcs_num; i++)
+            jep.post_src_step[i] = getStep(inputsNum + i);
+
         if (mayiuse(cpu::avx512_common)) {
             eltiwse_fq_kernel.reset(new jit_uni_eltwise_fq_generic<cpu::avx512_common>(jep, *attr.get()));
         } else if (mayiuse(cpu::avx2)) {
@@ -661,8 +739,9 @@ void MKLDNNEltwiseNode::initOptimalPrimitiveDescriptor() {
         return;
     }
 
+    // additional inputs of fused operations are always f32
     auto& selectedConfig = getSelectedPrimitiveDescriptor()->getConfig();
-    for (size_t i = 1; i < selectedConfig.inConfs.size(); i++) {
+    for (size_t i = 1; i < getCnnLayer()->insData.size(); i++) {
         if (selectedConfig.inConfs[0].desc.getPrecision() != selectedConfig.inConfs[i].desc.getPrecision()) {
             selectedConfig.inConfs[i].desc.setPrecision(selectedConfig.inConfs[0].desc.getPrecision());
         }
@@ -673,10 +752,65 @@ void MKLDNNEltwiseNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeight
     int blob_idx = 0;
     mkldnn::post_ops ops;
 
+    // the kernel applies post ops and fused binary eltwises in the order of fusing
+    jep.fused_ops.clear();
+    auto appendPostOp = [&]() {
+        jep.fused_ops.push_back({ops.len() - 1, op, -1, 0, false});
+    };
+
+    // number of operations applied after every fused node
+    std::vector<int> fusedStages;
+    size_t binaryIdx = 0;
+    int inputsNum = static_cast<int>(getCnnLayer()->insData.size());
+
     for (auto &node : fusedWith) {
         auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
         if (activationNode) {
             ops.append_eltwise(1.0, activationNode->getAlgorithm(), activationNode->getAlpha(), activationNode->getBeta());
+            appendPostOp();
+            fusedStages.push_back(static_cast<int>(jep.fused_ops.size()));
+
+            continue;
+        }
+
+        if (node->getType() == Power) {
+            auto* powerLayer = dynamic_cast<PowerLayer *>(node->getCnnLayer().get());
+            if (powerLayer == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get power layer " << node->getName();
+
+            ops.append_eltwise(1.0, eltwise_linear, powerLayer->scale, powerLayer->offset);
+            appendPostOp();
+            if (powerLayer->power == 2.0f) {
+                ops.append_eltwise(1.0, eltwise_square, 0.0f, 0.0f);
+                appendPostOp();
+            } else if (powerLayer->power == 0.5f) {
+                ops.append_eltwise(1.0, eltwise_sqrt, 0.0f, 0.0f);
+                appendPostOp();
+            } else if (powerLayer->power != 1.0f) {
+                THROW_IE_EXCEPTION << "Eltwise node " << getName() << " doesn't support fused power " << powerLayer->power;
+            }
+            fusedStages.push_back(static_cast<int>(jep.fused_ops.size()));
+
+            continue;
+        }
+
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
+        if (eltwiseNode) {
+            auto* eltwiseLayer = dynamic_cast<EltwiseLayer *>(node->getCnnLayer().get());
+            if (eltwiseLayer == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get eltwise layer " << node->getName();
+            if (binaryIdx >= fusedOperands.size())
+                THROW_IE_EXCEPTION << "Operand of fused eltwise " << node->getName() << " is not set";
+
+            const auto& operand = fusedOperands[binaryIdx++];
+            jit_eltwise_fq_fused_op fusedOp;
+            fusedOp.post_op_idx = -1;
+            fusedOp.eltwise_op = eltwiseLayer->_operation;
+            fusedOp.src_idx = operand.inputIdx >= 0 ? operand.inputIdx - inputsNum : -1;
+            fusedOp.src_stage = operand.inputIdx >= 0 || operand.fusedIdx < 0 ? 0 : fusedStages[operand.fusedIdx];
+            fusedOp.src_first = operand.isFirst;
+            jep.fused_ops.push_back(fusedOp);
+            fusedStages.push_back(static_cast<int>(jep.fused_ops.size()));
 
             continue;
         }
@@ -724,6 +858,8 @@ void MKLDNNEltwiseNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeight
             } else {
                 ops.append_quantization(quantizeNode->getAlgorithm(), nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
             }
+            appendPostOp();
+            fusedStages.push_back(static_cast<int>(jep.fused_ops.size()));
 
             continue;
         }
@@ -2598,21 +2734,44 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::ref_eltwise(int in0,
 }
 
 void MKLDNNEltwiseNode::jit_eltwise_fq() {
+    auto getDataPtr = [](const MKLDNNMemory &memory) {
+        return reinterpret_cast<uint8_t*>(memory.GetData()) +
+            memory.GetDescriptor().data.layout_desc.blocking.offset_padding *
+            MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(memory.GetDescriptor().data.data_type));
+    };
+
     auto& srcMemory0 = getParentEdgeAt(0)->getMemory();
     auto& srcMemory1 = getParentEdgeAt(1)->getMemory();
     auto& dstMemory = getChildEdgeAt(0)->getMemory();
 
-    const uint8_t *src0_ptr = reinterpret_cast<const uint8_t*>(srcMemory0.GetData()) +
-        srcMemory0.GetDescriptor().data.layout_desc.blocking.offset_padding *
-        MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(srcMemory0.GetDescriptor().data.data_type));
-    const uint8_t *src1_ptr = reinterpret_cast<const uint8_t*>(srcMemory1.GetData()) +
-        srcMemory1.GetDescriptor().data.layout_desc.blocking.offset_padding *
-        MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(srcMemory1.GetDescriptor().data.data_type));
-    uint8_t *dst_ptr = reinterpret_cast<uint8_t*>(dstMemory.GetData()) +
-        dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding *
-        MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(dstMemory.GetDescriptor().data.data_type));
+    const uint8_t *src0_ptr = getDataPtr(srcMemory0);
+    const uint8_t *src1_ptr = getDataPtr(srcMemory1);
+    uint8_t *dst_ptr = getDataPtr(dstMemory);
 
-    if (!broadcast) {
+    const size_t inputsNum = getCnnLayer()->insData.size();
+    const size_t postSrcsNum = getParentEdges().size() - inputsNum;
+    std::vector<const uint8_t*> post_src_ptrs;
+    for (size_t i = inputsNum; i < getParentEdges().size(); i++)
+        post_src_ptrs.push_back(getDataPtr(getParentEdgeAt(i)->getMemory()));
+
+    if (any_layout) {
+        const size_t work_amount = dstMemory.GetSize() / jep.dst_data_size / dstMemory.GetDims()[0] * batchToProcess();
+        const size_t block_size = 4096;
+
+        parallel_for(div_up(work_amount, block_size), [&](size_t b) {
+            size_t off = b * block_size;
+
+            auto arg = jit_eltwise_fq_call_args();
+            arg.src0 = src0_ptr + off * jep.src0_data_size;
+            arg.src1 = src1_ptr + off * jep.src1_data_size;
+            arg.dst = dst_ptr + off * jep.dst_data_size;
+            for (size_t j = 0; j < postSrcsNum; j++)
+                arg.post_src[j] = post_src_ptrs[j] + off * sizeof(float);
+            arg.work_amount = std::min(block_size, work_amount - off);
+
+            (*eltiwse_fq_kernel)(&arg);
+        });
+    } else if (!broadcast) {
         auto& dims = getParentEdgeAt(0)->getDims();
 
         int N = batchToProcess();
@@ -2628,6 +2787,8 @@ void MKLDNNEltwiseNode::jit_eltwise_fq() {
             arg.src0 = src0_ptr + off * jep.src0_data_size;
             arg.src1 = src1_ptr + off * jep.src1_data_size;
             arg.dst = dst_ptr + off * jep.dst_data_size;
+            for (size_t j = 0; j < postSrcsNum; j++)
+                arg.post_src[j] = post_src_ptrs[j] + off * sizeof(float);
             arg.work_amount = static_cast<size_t>(C);
 
             (*eltiwse_fq_kernel)(&arg);
@@ -2645,6 +2806,13 @@ void MKLDNNEltwiseNode::jit_eltwise_fq() {
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
 
+        std::vector<int> offset_post(5 * postSrcsNum);
+        for (size_t j = 0; j < postSrcsNum; j++) {
+            int dims_post[5];
+            dims_calc(dims_post, getParentEdgeAt(inputsNum + j)->getDims(), true);
+            offset_in_calc(&offset_post[5 * j], dims_post, dims_out);
+        }
+
         parallel_for4d(dims_out[0], dims_out[1], dims_out[2], dims_out[3], [&](size_t i0, size_t i1, size_t i2, size_t i3) {
             size_t index_out = i0 * offset_out[0] + i1 * offset_out[1] + i2 * offset_out[2] + i3 * offset_out[3];
             size_t index_in0 = i0 * offset_in0[0] + i1 * offset_in0[1] + i2 * offset_in0[2] + i3 * offset_in0[3];
@@ -2654,6 +2822,11 @@ void MKLDNNEltwiseNode::jit_eltwise_fq() {
             arg.src0 = src0_ptr + index_in0 * jep.src0_data_size;
             arg.src1 = src1_ptr + index_in1 * jep.src1_data_size;
             arg.dst = dst_ptr + index_out * jep.dst_data_size;
+            for (size_t j = 0; j < postSrcsNum; j++) {
+                const int *offset_in = &offset_post[5 * j];
+                size_t index_in = i0 * offset_in[0] + i1 * offset_in[1] + i2 * offset_in[2] + i3 * offset_in[3];
+                arg.post_src[j] = post_src_ptrs[j] + index_in * sizeof(float);
+            }
             arg.work_amount = static_cast<size_t>(dims_out[4]);
 
             (*eltiwse_fq_kernel)(&arg);
@@ -2673,7 +2846,8 @@ void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
                 THROW_IE_EXCEPTION << "Floor_mod supports only I32 precision of output";
         }
 
-        if (getParentEdges().size() > 2) {
+        // additional inputs of fused operations are handled by the kernel
+        if (getParentEdges().size() > 2 && fusedWith.empty()) {
             Precision pi = getParentEdgeAt(0)->getDesc().getPrecision();
             Precision po = getChildEdgeAt(0)->getDesc().getPrecision();
             for (int i = 1; i < getParentEdges().size(); i++) {
@@ -2741,6 +2915,10 @@ bool MKLDNNEltwiseNode::created() const {
     return getType() == Eltwise;
 }
 
+uint64_t MKLDNNEltwiseNode::getFlops() const {
+    return (getParentEdges().size() - 1) * static_cast<uint64_t>(getChildEdgeAt(0)->getDims().size());
+}
+
 bool MKLDNNEltwiseNode::canBeInPlace() const {
     size_t inPlaceWithParent = getParentEdges().size();
     for (size_t i = 0; i < inPlaceWithParent; i++) {
@@ -13,6 +13,22 @@
 
 namespace MKLDNNPlugin {
 
+// Every additional input and every intermediate result reused by the fused chain occupies a register in the kernel
+constexpr int MAX_ELTWISE_FUSED_INPUTS = 4;
+constexpr int MAX_ELTWISE_FUSED_STAGES = 4;
+
+struct jit_eltwise_fq_fused_op {
+    // index of the post op in the primitive attributes, or -1 for a fused binary operation
+    int post_op_idx;
+    InferenceEngine::EltwiseLayer::eOperation eltwise_op;
+    // the second operand of a binary operation is an additional input with index src_idx if it is not negative,
+    // otherwise it is the value the chain had after src_stage operations (0 stands for the result of the node itself)
+    int src_idx;
+    int src_stage;
+    // the second operand is the first argument of the operation
+    bool src_first;
+};
+
 struct jit_eltwise_fq_params {
     int src0_step;
     int src1_step;
@@ -25,6 +41,11 @@ struct jit_eltwise_fq_params {
     int dst_data_size;
 
     InferenceEngine::EltwiseLayer::eOperation eltwise_op;
+
+    std::vector<jit_eltwise_fq_fused_op> fused_ops;
+    // additional inputs are always f32
+    int post_srcs_num;
+    int post_src_step[MAX_ELTWISE_FUSED_INPUTS];
 };
 
 struct jit_eltwise_fq_call_args {
@@ -32,6 +53,7 @@ struct jit_eltwise_fq_call_args {
     const void *src1;
     void *dst;
     size_t work_amount;
+    const void *post_src[MAX_ELTWISE_FUSED_INPUTS];
 };
 
 struct jit_uni_eltwise_fq_kernel {
@@ -59,6 +81,7 @@ public:
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    uint64_t getFlops() const override;
     bool canBeInPlace() const override;
 
     bool isSum();
@@ -66,6 +89,23 @@ public:
     bool isWithBroadcast();
     void initOptimalPrimitiveDescriptor() override;
 
+    /**
+     * @brief Second operand of a binary eltwise fused into the node
+     */
+    struct FusedOperand {
+        // index of the node input, or -1 if the operand is produced by the chain itself
+        int inputIdx;
+        // index of the fused node producing the operand, -1 stands for the node itself
+        int fusedIdx;
+        // the operand is the first argument of the fused operation
+        bool isFirst;
+    };
+
+    void fuseEltwiseWith(const MKLDNNNodePtr &fuse, const FusedOperand &operand) {
+        fusedOperands.push_back(operand);
+        fuseWith(fuse);
+    }
+
 private:
     InferenceEngine::EltwiseLayer::eOperation op;
     std::vector<float> sum_scales;
@@ -76,6 +116,11 @@ private:
 
     std::shared_ptr<jit_uni_eltwise_fq_kernel> eltiwse_fq_kernel;
     jit_eltwise_fq_params jep;
+    // operands of the fused binary eltwises in order of fusing
+    std::vector<FusedOperand> fusedOperands;
+    // the fused chain contains only elementwise operations of equally shaped tensors,
+    // so the kernel processes memory of any layout as a flat array
+    bool any_layout = false;
 
     void jit_eltwise_fq();
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights);
@@ -10,11 +10,54 @@
 #include <vector>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
+#include <mkldnn_plugin.h>
+#include <mkldnn/system_conf.h>
+#include <ie_parallel.hpp>
+#include <precision_utils.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+// The conversion has no branches, so the decompression loops are vectorized. The weights are saturated
+// and their denormals are flushed to zero when they are compressed, so there are no special values.
+inline float decompressWeight(uint16_t h) {
+    const uint32_t exponent = h & 0x7C00u;
+    const uint32_t bits = ((h & 0x8000u) << 16) | (exponent ? ((h & 0x7FFFu) << 13) + 0x38000000u : 0u);
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+inline float decompressWeight(int8_t q) {
+    return static_cast<float>(q);
+}
+
+uint16_t compressToFP16(float w) {
+    const float maxFP16 = 65504.f;
+    auto h = static_cast<uint16_t>(PrecisionUtils::f32tof16(std::max(-maxFP16, std::min(maxFP16, w))));
+    return (h & 0x7C00u) ? h : static_cast<uint16_t>(h & 0x8000u);
+}
+
+// the sparse weights are split into blocks of 1 output channel by 16 input channels
+constexpr size_t sparseBlockSize = 16;
+
+inline bool isZeroBlock(const float* row, size_t ic0, size_t IC) {
+    for (size_t ic = ic0; ic < std::min(IC, ic0 + sparseBlockSize); ic++) {
+        if (row[ic] != 0.f)
+            return false;
+    }
+    return true;
+}
+
+}  // namespace
+
 MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket)
         : MKLDNNNode(layer, eng, socket), withBiases(false), baseInputsNumber(0) {
     internalBlobDesc.emplace_back([&](primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
@@ -116,6 +159,9 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
         internalBlobs.push_back(createInternalBlob(biasesDims, false));
     }
 
+    withSparseWeights = inputDataType == memory::f32 && canUseSparseWeights();
+    withCompressedWeights = inputDataType == memory::f32 && !withSparseWeights && canCompressWeights();
+
     if (this->getCnnLayer()->blobs.find("weights") != this->getCnnLayer()->blobs.end()) {
         Blob::Ptr weights = this->getCnnLayer()->blobs.find("weights")->second;
         if (weights->getTensorDesc().getPrecision() == Precision::I8) {
@@ -141,6 +187,18 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
         }
     }
 
+    // The BF16 inner product supports ReLU as the only post-op, the FP32 descriptors are the fallback
+    // for the shapes it doesn't support
+    if (isBF16Enabled() && inputDataType == memory::f32 && !withCompressedWeights && !withSparseWeights &&
+            canBeExecutedInBF16()) {
+        for (auto format : getAvailableFormatsForDims(getParentEdgeAt(0)->getDims())) {
+            MKLDNNMemoryDesc in_candidate(inDims, memory::bf16, format);
+            MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), memory::bf16, memory::any);
+
+            createDescriptor({in_candidate}, {out_candidate});
+        }
+    }
+
     for (auto format : getAvailableFormatsForDims(getParentEdgeAt(0)->getDims())) {
         MKLDNNMemoryDesc in_candidate(inDims, inputDataType, format);
         MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType, memory::any);
@@ -149,33 +207,389 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+bool MKLDNNFullyConnectedNode::canUseOwnKernel() {
+    if (baseInputsNumber != 1 || wScale != nullptr ||
+            getParentEdgeAt(0)->getDims().ndims() != 2 || getChildEdgeAt(0)->getDims().ndims() != 2)
+        return false;
+
+    auto weights = getCnnLayer()->blobs.find("weights");
+    if (weights == getCnnLayer()->blobs.end() || weights->second->getTensorDesc().getPrecision() != Precision::FP32)
+        return false;
+
+    size_t activations = 0;
+    for (auto &node : fusedWith) {
+        // softmax is applied to the output rows by a separate primitive for all the kernels
+        if (node->getType() == SoftMax)
+            continue;
+#if defined(COMPILED_CPU_MKLDNN_ACTIVATION_NODE)
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode && activationNode->getAlgorithm() == algorithm::eltwise_relu) {
+            activations++;
+            continue;
+        }
+#endif
+        return false;
+    }
+    return activations <= 1;
+}
+
+bool MKLDNNFullyConnectedNode::canCompressWeights() {
+    return weightsCompression != Config::WeightsCompression::No && canUseOwnKernel();
+}
+
+bool MKLDNNFullyConnectedNode::canUseSparseWeights() {
+    if (sparseWeightsThreshold <= 0.f || !canUseOwnKernel())
+        return false;
+
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const float* weights = internalBlobs[0]->cbuffer().as<const float*>();
+
+    std::vector<size_t> zeroBlocks(OC, 0);
+    parallel_for(OC, [&](size_t oc) {
+        for (size_t ic0 = 0; ic0 < IC; ic0 += sparseBlockSize)
+            zeroBlocks[oc] += isZeroBlock(weights + oc * IC, ic0, IC) ? 1 : 0;
+    });
+
+    const size_t total = OC * div_up(IC, sparseBlockSize);
+    const size_t zero = std::accumulate(zeroBlocks.begin(), zeroBlocks.end(), static_cast<size_t>(0));
+    return total != 0 && static_cast<float>(zero) >= sparseWeightsThreshold * static_cast<float>(total);
+}
+
+bool MKLDNNFullyConnectedNode::getFusedReLU(float& slope) const {
+#if defined(COMPILED_CPU_MKLDNN_ACTIVATION_NODE)
+    for (auto &node : fusedWith) {
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode) {
+            slope = activationNode->getAlpha();
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+
+bool MKLDNNFullyConnectedNode::canBeExecutedInBF16() const {
+    for (auto &node : fusedWith) {
+#if defined(COMPILED_CPU_MKLDNN_ACTIVATION_NODE)
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode && activationNode->getAlgorithm() == algorithm::eltwise_relu && activationNode->getAlpha() == 0.0f)
+            continue;
+#endif
+        return false;
+    }
+    return fusedWith.size() <= 1;
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (prim || compressedWeights || sparseWeights)
         return;
 
+    if (withCompressedWeights || withSparseWeights) {
+        if (getParentEdgeAt(0)->getMemory().GetFormat() == memory::nc &&
+                getChildEdgeAt(0)->getMemory().GetFormat() == memory::nc) {
+            if (withSparseWeights)
+                createSparseWeights();
+            else
+                createCompressedWeights();
+            createFusedSoftMax();
+            return;
+        }
+        withCompressedWeights = false;
+        withSparseWeights = false;
+    }
+
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
     std::shared_ptr<inner_product_forward::primitive_desc> prim_desc;
     prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
             createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>(*attr));
 
     if (withBiases) {
-        prim.reset(new inner_product_forward(*prim_desc,
-                                             getParentEdgeAt(0)->getMemory().GetPrimitive(),
-                                             getWeights(),
-                                             getBias(),
-                                             getChildEdgeAt(0)->getMemory().GetPrimitive()));
+        createCachedPrimitive<inner_product_forward>(*prim_desc,
+                                                     getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                                                     getWeights(),
+                                                     getBias(),
+                                                     getChildEdgeAt(0)->getMemory().GetPrimitive());
     } else {
-        prim.reset(new inner_product_forward(*prim_desc,
-                                             getParentEdgeAt(0)->getMemory().GetPrimitive(),
-                                             getWeights(),
-                                             getChildEdgeAt(0)->getMemory().GetPrimitive()));
+        createCachedPrimitive<inner_product_forward>(*prim_desc,
+                                                     getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                                                     getWeights(),
+                                                     getChildEdgeAt(0)->getMemory().GetPrimitive());
     }
+    createFusedSoftMax();
+}
+
+void MKLDNNFullyConnectedNode::createFusedSoftMax() {
+    for (auto &node : fusedWith) {
+        if (node->getType() != SoftMax)
+            continue;
+
+        // the output rows are normalized in place right after they are computed, while they are still in cache
+        auto &dstMemory = getChildEdgeAt(0)->getMemory();
+        softmax_forward::primitive_desc softmaxPrimDesc(
+                softmax_forward::desc(prop_kind::forward_scoring, dstMemory.GetDescriptor(), 1), getEngine());
+        softmaxPrim.reset(new softmax_forward(softmaxPrimDesc, dstMemory.GetPrimitive(), dstMemory.GetPrimitive()));
+    }
+}
+
+void MKLDNNFullyConnectedNode::createCompressedWeights() {
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const auto& weightsBlob = internalBlobs[0];
+    const float* weights = weightsBlob->cbuffer().as<const float*>();
+    const bool toFP16 = weightsCompression == Config::WeightsCompression::FP16;
+
+    MKLDNNMemoryDesc weightsDesc(MKLDNNDims(weightsDims), toFP16 ? memory::s16 : memory::s8, memory::oi);
+    MKLDNNMemoryDesc scalesDesc(MKLDNNDims(biasesDims), memory::f32, memory::x);
+
+    // the scales are computed together with the weights, so they are created first and the weights are
+    // taken from the cache only if the scales are there as well
+    std::vector<float> scales;
+    auto createWeights = [&] () {
+        MKLDNNMemoryPtr ptr(new MKLDNNMemory(getEngine()));
+        ptr->Create(weightsDesc);
+        cpu::bindMemoryToNUMANode(ptr->GetData(), ptr->GetSize(), whichSocket());
+
+        if (toFP16) {
+            auto dst = reinterpret_cast<uint16_t*>(ptr->GetData());
+            parallel_for(OC, [&](size_t oc) {
+                for (size_t ic = 0; ic < IC; ic++)
+                    dst[oc * IC + ic] = compressToFP16(weights[oc * IC + ic]);
+            });
+        } else {
+            auto dst = reinterpret_cast<int8_t*>(ptr->GetData());
+            scales.resize(OC);
+            parallel_for(OC, [&](size_t oc) {
+                float maxAbs = 0.f;
+                for (size_t ic = 0; ic < IC; ic++)
+                    maxAbs = std::max(maxAbs, std::fabs(weights[oc * IC + ic]));
+                scales[oc] = maxAbs > 0.f ? maxAbs / 127.f : 1.f;
+                for (size_t ic = 0; ic < IC; ic++) {
+                    const float q = std::round(weights[oc * IC + ic] / scales[oc]);
+                    dst[oc * IC + ic] = static_cast<int8_t>(std::max(-127.f, std::min(127.f, q)));
+                }
+            });
+        }
+        return ptr;
+    };
+
+    auto weightsSharing = Engine::GetWeightsSharing(whichSocket());
+    compressedWeights = weightsSharing->findOrCreate(MKLDNNWeightsSharing::GetKey(weightsBlob, weightsDesc), createWeights);
+    if (toFP16)
+        return;
+
+    compressedWeightsScales = weightsSharing->findOrCreate(MKLDNNWeightsSharing::GetKey(weightsBlob, scalesDesc), [&] () {
+        if (scales.empty())
+            createWeights();
+        MKLDNNMemoryPtr ptr(new MKLDNNMemory(getEngine()));
+        ptr->Create(scalesDesc);
+        ptr->SetData(memory::f32, memory::x, scales.data(), scales.size() * sizeof(float), false);
+        return ptr;
+    });
+}
+
+void MKLDNNFullyConnectedNode::createSparseWeights() {
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const auto& weightsBlob = internalBlobs[0];
+    const float* weights = weightsBlob->cbuffer().as<const float*>();
+
+    std::vector<int32_t> rowOffsets(OC + 1, 0);
+    parallel_for(OC, [&](size_t oc) {
+        for (size_t ic0 = 0; ic0 < IC; ic0 += sparseBlockSize)
+            rowOffsets[oc + 1] += isZeroBlock(weights + oc * IC, ic0, IC) ? 0 : 1;
+    });
+    for (size_t oc = 0; oc < OC; oc++)
+        rowOffsets[oc + 1] += rowOffsets[oc];
+    const size_t blocks = rowOffsets[OC];
+
+    // the offsets, the indices and the weights are 32 bit words of the same buffer, so the weights are shared
+    // by the streams as a single memory
+    MKLDNNMemoryDesc sparseDesc(MKLDNNDims(SizeVector{OC + 1 + blocks * (1 + sparseBlockSize)}),
+                                memory::s32, memory::x);
+
+    auto createWeights = [&] () {
+        MKLDNNMemoryPtr ptr(new MKLDNNMemory(getEngine()));
+        ptr->Create(sparseDesc);
+        cpu::bindMemoryToNUMANode(ptr->GetData(), ptr->GetSize(), whichSocket());
+
+        auto offsets = reinterpret_cast<int32_t*>(ptr->GetData());
+        auto indices = offsets + OC + 1;
+        auto values = reinterpret_cast<float*>(indices + blocks);
+        std::copy(rowOffsets.begin(), rowOffsets.end(), offsets);
+
+        parallel_for(OC, [&](size_t oc) {
+            const float* row = weights + oc * IC;
+            size_t block = rowOffsets[oc];
+            for (size_t ic0 = 0; ic0 < IC; ic0 += sparseBlockSize) {
+                if (isZeroBlock(row, ic0, IC))
+                    continue;
+                indices[block] = static_cast<int32_t>(ic0);
+                float* w = values + block * sparseBlockSize;
+                for (size_t i = 0; i < sparseBlockSize; i++)
+                    w[i] = ic0 + i < IC ? row[ic0 + i] : 0.f;
+                block++;
+            }
+        });
+        return ptr;
+    };
+
+    auto weightsSharing = Engine::GetWeightsSharing(whichSocket());
+    sparseWeights = weightsSharing->findOrCreate(MKLDNNWeightsSharing::GetKey(weightsBlob, sparseDesc), createWeights);
+}
+
+template <typename T>
+void MKLDNNFullyConnectedNode::executeWithCompressedWeights() {
+    const size_t MB = batchToProcess();
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    // the rows of the weights are decompressed to a buffer which stays in the cache together with the source rows
+    constexpr size_t rowsBlock = 8;
+    constexpr size_t accNum = 8;
+
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const float* src = reinterpret_cast<const float*>(srcMemory.GetData()) +
+                       srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float* dst = reinterpret_cast<float*>(dstMemory.GetData()) +
+                 dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const T* weights = reinterpret_cast<const T*>(compressedWeights->GetData());
+    const float* scales = compressedWeightsScales ? reinterpret_cast<const float*>(compressedWeightsScales->GetData()) : nullptr;
+    const float* biases = withBiases ? internalBlobs[1]->cbuffer().as<const float*>() : nullptr;
+
+    float reluSlope = 0.f;
+    const bool withReLU = getFusedReLU(reluSlope);
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(div_up(OC, rowsBlock), nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<float> buffer(rowsBlock * IC);
+        for (size_t block = start; block < end; block++) {
+            const size_t oc0 = block * rowsBlock;
+            const size_t rows = std::min(rowsBlock, OC - oc0);
+
+            for (size_t r = 0; r < rows; r++) {
+                const T* w = weights + (oc0 + r) * IC;
+                float* b = &buffer[r * IC];
+                for (size_t ic = 0; ic < IC; ic++)
+                    b[ic] = decompressWeight(w[ic]);
+            }
+
+            for (size_t mb = 0; mb < MB; mb++) {
+                const float* s = src + mb * IC;
+                for (size_t r = 0; r < rows; r++) {
+                    const float* b = &buffer[r * IC];
+                    float acc[accNum] = {};
+                    size_t ic = 0;
+                    for (; ic + accNum <= IC; ic += accNum) {
+                        for (size_t i = 0; i < accNum; i++)
+                            acc[i] += s[ic + i] * b[ic + i];
+                    }
+                    for (; ic < IC; ic++)
+                        acc[0] += s[ic] * b[ic];
+
+                    const size_t oc = oc0 + r;
+                    float result = 0.f;
+                    for (size_t i = 0; i < accNum; i++)
+                        result += acc[i];
+                    if (scales)
+                        result *= scales[oc];
+                    if (biases)
+                        result += biases[oc];
+                    if (withReLU && result < 0.f)
+                        result *= reluSlope;
+                    dst[mb * OC + oc] = result;
+                }
+            }
+        }
+    });
+}
+
+void MKLDNNFullyConnectedNode::executeWithSparseWeights() {
+    const size_t MB = batchToProcess();
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const float* src = reinterpret_cast<const float*>(srcMemory.GetData()) +
+                       srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float* dst = reinterpret_cast<float*>(dstMemory.GetData()) +
+                 dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const int32_t* offsets = reinterpret_cast<const int32_t*>(sparseWeights->GetData());
+    const int32_t* indices = offsets + OC + 1;
+    const float* values = reinterpret_cast<const float*>(indices + offsets[OC]);
+    const float* biases = withBiases ? internalBlobs[1]->cbuffer().as<const float*>() : nullptr;
+
+    float reluSlope = 0.f;
+    const bool withReLU = getFusedReLU(reluSlope);
+
+    // the blocks of a row are read once for all the batch items, the source rows stay in the cache
+    parallel_for(OC, [&](size_t oc) {
+        for (size_t mb = 0; mb < MB; mb++) {
+            const float* s = src + mb * IC;
+            float acc[sparseBlockSize] = {};
+            for (int32_t block = offsets[oc]; block < offsets[oc + 1]; block++) {
+                const size_t ic0 = indices[block];
+                const float* w = values + block * sparseBlockSize;
+                if (ic0 + sparseBlockSize <= IC) {
+                    for (size_t i = 0; i < sparseBlockSize; i++)
+                        acc[i] += s[ic0 + i] * w[i];
+                } else {
+                    for (size_t i = 0; i < IC - ic0; i++)
+                        acc[i] += s[ic0 + i] * w[i];
+                }
+            }
+
+            float result = 0.f;
+            for (size_t i = 0; i < sparseBlockSize; i++)
+                result += acc[i];
+            if (biases)
+                result += biases[oc];
+            if (withReLU && result < 0.f)
+                result *= reluSlope;
+            dst[mb * OC + oc] = result;
+        }
+    });
+}
+
+void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (sparseWeights) {
+        executeWithSparseWeights();
+    } else if (!compressedWeights) {
+        MKLDNNNode::execute(strm);
+    } else if (weightsCompression == Config::WeightsCompression::FP16) {
+        executeWithCompressedWeights<uint16_t>();
+    } else {
+        executeWithCompressedWeights<int8_t>();
+    }
+
+    if (softmaxPrim)
+        strm.submit({*softmaxPrim});
+}
+
+std::string MKLDNNFullyConnectedNode::getWeightsFormat() const {
+    if (sparseWeights)
+        return "sparse_1x16";
+    if (compressedWeights)
+        return weightsCompression == Config::WeightsCompression::FP16 ? "fp16" : "i8";
+    return {};
 }
 
 bool MKLDNNFullyConnectedNode::created() const {
     return getType() == FullyConnected;
 }
 
+uint64_t MKLDNNFullyConnectedNode::getFlops() const {
+    uint64_t macsPerOutput = 1;
+    for (size_t i = 1; i < weightsDims.size(); i++)
+        macsPerOutput *= weightsDims[i];
+    return 2 * macsPerOutput * static_cast<uint64_t>(getChildEdgeAt(0)->getDims().size());
+}
+
 memory::format MKLDNNFullyConnectedNode::weightsFormatForSrcFormat(memory::format sourceFormat) {
     switch (sourceFormat) {
         case memory::format::x:
@@ -279,6 +693,8 @@ void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<InferenceEngin
     if (inDesc.getPrecision() == Precision::U8 || inDesc.getPrecision() == Precision::I8) {
         wdt = memory::s8;
         bdt = baseInputsNumber == 3 ? MKLDNNExtensionUtils::IEPrecisionToDataType(getCnnLayer()->insData[2].lock()->getPrecision()) : memory::f32;
+    } else if (inDesc.getPrecision() == Precision::BF16) {
+        bdt = memory::f32;
     }
 
     if (this->getCnnLayer()->blobs.find("weights") != this->getCnnLayer()->blobs.end()) {
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "config.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -19,6 +20,7 @@ public:
 
     void getSupportedDescriptors() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
@@ -37,6 +39,17 @@ public:
     const mkldnn::memory& getWeights() const;
     const mkldnn::memory& getBias() const;
 
+    void setWeightsCompression(Config::WeightsCompression compression) {
+        weightsCompression = compression;
+    }
+
+    void setSparseWeightsThreshold(float threshold) {
+        sparseWeightsThreshold = threshold;
+    }
+
+    std::string getWeightsFormat() const override;
+    uint64_t getFlops() const override;
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr() const override;
 
@@ -44,11 +57,37 @@ private:
     InferenceEngine::SizeVector weightsDims;
     InferenceEngine::SizeVector biasesDims;
     mkldnn::memory::format weightsFormatForSrcFormat(mkldnn::memory::format sourceFormat);
+    bool canBeExecutedInBF16() const;
+    bool canUseOwnKernel();
+    bool canCompressWeights();
+    bool canUseSparseWeights();
+    bool getFusedReLU(float& slope) const;
+    void createCompressedWeights();
+    void createSparseWeights();
+    void createFusedSoftMax();
+    template <typename T>
+    void executeWithCompressedWeights();
+    void executeWithSparseWeights();
 
     InferenceEngine::Blob::Ptr wScale, oScale;
 
     bool withBiases;
     int baseInputsNumber;
+
+    Config::WeightsCompression weightsCompression = Config::WeightsCompression::No;
+    bool withCompressedWeights = false;
+    // FP16 or I8 weights in the oi order and the scales of the I8 ones per output channel
+    MKLDNNMemoryPtr compressedWeights;
+    MKLDNNMemoryPtr compressedWeightsScales;
+
+    float sparseWeightsThreshold = 0.f;
+    bool withSparseWeights = false;
+    // the non-zero blocks of 1x16 weights in the CSR order: the offsets of the rows blocks, the first input
+    // channels of the blocks and the FP32 weights of the blocks
+    MKLDNNMemoryPtr sparseWeights;
+
+    // the fused softmax along the output channels, in place on the output memory
+    std::shared_ptr<mkldnn::primitive> softmaxPrim;
 };
 
 }  // namespace MKLDNNPlugin
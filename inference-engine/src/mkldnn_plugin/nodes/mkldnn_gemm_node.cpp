@@ -9,8 +9,11 @@
 #include <memory>
 #include <algorithm>
 #include <cmath>
+#include <type_traits>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel.hpp>
+#include <cpu_isa_traits.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -112,19 +115,43 @@ void MKLDNNGemmNode::getSupportedDescriptors() {
         bOffsets.push_back(0);
     for (unsigned long dim_idx = cOffsets.size(); dim_idx < 2; dim_idx++)
         cOffsets.push_back(0);
+
+    isInt8 = canBeExecutedInInt8();
+    if (isInt8) {
+        size_t channels = outDims[1];
+        dequantizationScales.assign(channels, alpha);
+        dequantizationShifts.assign(channels, 0.0f);
+        for (auto &node : fusedWith) {
+            auto* scaleShiftLayer = dynamic_cast<ScaleShiftLayer*>(node->getCnnLayer().get());
+            if (scaleShiftLayer == nullptr)
+                THROW_IE_EXCEPTION << "Unsupported fused layer " << node->getName() << " for layer " << getName();
+
+            const float* weights = scaleShiftLayer->_weights ? scaleShiftLayer->_weights->cbuffer().as<const float*>() : nullptr;
+            const float* biases = scaleShiftLayer->_biases ? scaleShiftLayer->_biases->cbuffer().as<const float*>() : nullptr;
+            for (size_t c = 0; c < channels; c++) {
+                size_t idx = scaleShiftLayer->_broadcast ? 0 : c;
+                float scale = weights ? weights[idx] : 1.0f;
+                float shift = biases ? biases[idx] : 0.0f;
+                dequantizationScales[c] *= scale;
+                dequantizationShifts[c] = dequantizationShifts[c] * scale + shift;
+            }
+        }
+    }
 }
 
 void MKLDNNGemmNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
 
     auto same = [&] (memory::format fmt) -> PrimitiveDescInfo {
         InferenceEngine::LayerConfig config;
         config.dynBatchSupport = true;
         for (size_t i = 0; i < getParentEdges().size(); i++) {
+            auto inputPrecision = isInt8 ? getCnnLayer()->insData[i].lock()->getPrecision() : Precision(Precision::FP32);
+            auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision);
+
             InferenceEngine::DataConfig dataConfig;
             dataConfig.inPlace = -1;
             dataConfig.constant = false;
@@ -158,10 +185,12 @@ void MKLDNNGemmNode::initOptimalPrimitiveDescriptor() {
         return;
     }
 
-    // Only FP32 is supported for now
+    // Only FP32 is supported for now, except of int8 inputs of the int8 gemm
     auto& selectedConfig = getSelectedPrimitiveDescriptor()->getConfig();
-    for (auto &inConf : selectedConfig.inConfs) {
-        inConf.desc.setPrecision(Precision::FP32);
+    if (!isInt8) {
+        for (auto &inConf : selectedConfig.inConfs) {
+            inConf.desc.setPrecision(Precision::FP32);
+        }
     }
 
     for (auto &outConf : selectedConfig.outConfs) {
@@ -188,6 +217,14 @@ void MKLDNNGemmNode::createPrimitive() {
 }
 
 void MKLDNNGemmNode::execute(mkldnn::stream strm) {
+    if (isInt8) {
+        if (getParentEdgeAt(0)->getDesc().getPrecision() == Precision::U8)
+            executeInt8<uint8_t>();
+        else
+            executeInt8<int8_t>();
+        return;
+    }
+
     auto inDims0 = getParentEdgeAt(0)->getDims();
     auto inDims1 = getParentEdgeAt(1)->getDims();
     auto outDims = getChildEdgeAt(0)->getDims();
@@ -256,10 +293,106 @@ void MKLDNNGemmNode::execute(mkldnn::stream strm) {
     }
 }
 
+template <typename src0_data_t>
+void MKLDNNGemmNode::executeInt8() {
+    auto inDims0 = getParentEdgeAt(0)->getDims();
+    auto outDims = getChildEdgeAt(0)->getDims();
+
+    auto& srcMemory0 = getParentEdgeAt(0)->getMemory();
+    auto& srcMemory1 = getParentEdgeAt(1)->getMemory();
+    const src0_data_t *src0_ptr = reinterpret_cast<const src0_data_t*>(srcMemory0.GetData()) +
+                                  srcMemory0.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const int8_t *src1_ptr = reinterpret_cast<const int8_t*>(srcMemory1.GetData()) +
+                             srcMemory1.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
+                     getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    int MB1 = outDims.ndims() == 4 ? batchToProcess() : 1;
+    int MB2 = outDims.ndims() == 3 ? batchToProcess() : outDims.ndims() > 3 ? outDims[outDims.ndims() - 3] : 1;
+    int M = outDims[yAxis];
+    int N = outDims[xAxis];
+    int K = transposeA ? inDims0[yAxis] : inDims0[xAxis];
+
+    const char transa = transposeA ? 'T' : 'N';
+    const char transb = transposeB ? 'T' : 'N';
+    const char offsetc = 'F';
+
+    int lda = transposeA ? M : K;
+    int ldb = transposeB ? K : N;
+    int ldc = N;
+
+    const float one = 1.0f;
+    const float zero = 0.0f;
+    const int8_t zeroPoint = 0;
+    const int32_t zeroOffset = 0;
+
+    size_t dstSize = static_cast<size_t>(MB1) * MB2 * M * N;
+    accumulators.resize(dstSize);
+    int32_t *acc_ptr = accumulators.data();
+
+    for (int b1 = 0; b1 < MB1; b1++) {
+        const src0_data_t *a_ptr = src0_ptr;
+        const int8_t *b_ptr = src1_ptr;
+        int32_t *c_ptr = acc_ptr;
+
+        for (int b2 = 0; b2 < MB2; b2++) {
+            // int8 gemm takes the weights as A operand, it uses vpdpbusd on VNNI capable CPUs
+            if (std::is_same<src0_data_t, uint8_t>::value) {
+                mkldnn_gemm_s8u8s32(&transb, &transa, &offsetc, &N, &M, &K, &one, b_ptr, &ldb, &zeroPoint,
+                                    reinterpret_cast<const uint8_t*>(a_ptr), &lda, &zeroPoint, &zero, c_ptr, &ldc, &zeroOffset);
+            } else {
+                mkldnn_gemm_s8s8s32(&transb, &transa, &offsetc, &N, &M, &K, &one, b_ptr, &ldb, &zeroPoint,
+                                    reinterpret_cast<const int8_t*>(a_ptr), &lda, &zeroPoint, &zero, c_ptr, &ldc, &zeroOffset);
+            }
+
+            a_ptr += aOffsets[0];
+            b_ptr += bOffsets[0];
+            c_ptr += M * N;
+        }
+
+        src0_ptr += aOffsets[1];
+        src1_ptr += bOffsets[1];
+        acc_ptr += MB2 * M * N;
+    }
+
+    size_t channels = outDims[1];
+    size_t innerSize = 1;
+    for (int i = 2; i < outDims.ndims(); i++)
+        innerSize *= outDims[i];
+    size_t outerSize = dstSize / (channels * innerSize);
+    const int32_t *acc = accumulators.data();
+    parallel_for2d(outerSize, channels, [&](size_t o, size_t c) {
+        size_t offset = (o * channels + c) * innerSize;
+        float scale = dequantizationScales[c];
+        float shift = dequantizationShifts[c];
+        for (size_t i = 0; i < innerSize; i++)
+            dst_ptr[offset + i] = static_cast<float>(acc[offset + i]) * scale + shift;
+    });
+}
+
+bool MKLDNNGemmNode::canBeExecutedInInt8() const {
+    // int8 gemm of mkl-dnn falls back to the reference implementation without AVX-512
+    if (!mkldnn::impl::cpu::mayiuse(mkldnn::impl::cpu::avx512_core))
+        return false;
+
+    const auto& insData = getCnnLayer()->insData;
+    if (insData.size() != 2)
+        return false;
+    auto src0Precision = insData[0].lock()->getPrecision();
+    auto src1Precision = insData[1].lock()->getPrecision();
+    return (src0Precision == Precision::U8 || src0Precision == Precision::I8) && src1Precision == Precision::I8;
+}
+
 bool MKLDNNGemmNode::created() const {
     return getType() == Gemm;
 }
 
+uint64_t MKLDNNGemmNode::getFlops() const {
+    const auto& aDims = getParentEdgeAt(0)->getDims();
+    const auto K = transposeA ? aDims[aDims.ndims() - 2] : aDims[aDims.ndims() - 1];
+    return 2 * static_cast<uint64_t>(K) * static_cast<uint64_t>(getChildEdgeAt(0)->getDims().size());
+}
+
 int MKLDNNGemmNode::getMaxBatch() {
     if (!outDims.empty())
         return outDims[0][0];
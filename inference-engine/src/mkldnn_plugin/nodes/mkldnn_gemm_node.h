@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -22,9 +23,18 @@ public:
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    uint64_t getFlops() const override;
     int getMaxBatch() override;
 
+    /**
+     * @brief Checks whether the node multiplies quantized u8/i8 data by i8 weights with an int8 gemm
+     */
+    bool canBeExecutedInInt8() const;
+
 private:
+    template <typename src0_data_t>
+    void executeInt8();
+
     float alpha = 1.0f;
     float beta = 1.0f;
     bool transposeA = false;
@@ -34,6 +44,12 @@ private:
     int yAxis = 0;
 
     bool isThreeInputs = false;
+    bool isInt8 = false;
+
+    // dequantization applied to int32 accumulators per output channel: alpha and fused scale shifts
+    std::vector<float> dequantizationScales;
+    std::vector<float> dequantizationShifts;
+    std::vector<int32_t> accumulators;
 
     std::vector<int> aOffsets;
     std::vector<int> bOffsets;
@@ -5,6 +5,7 @@
 #include <mkldnn_extension_mngr.h>
 #include <mkldnn_extension_utils.h>
 #include "mkldnn_generic_node.h"
+#include "base.hpp"
 #include <vector>
 #include <string>
 #include <blob_factory.hpp>
@@ -106,42 +107,40 @@ void MKLDNNGenericNode::cleanup() {
 }
 
 void MKLDNNGenericNode::execLayer() {
-    bool isDynBatch = dynBatchLim > 0;
+    // the reduced batch is given only to the configurations which support it, the others process the whole blobs
+    const auto *selected = getSelectedPrimitiveDescriptor();
+    bool isDynBatch = dynBatchLim > 0 && selected != nullptr && selected->getConfig().dynBatchSupport;
     std::vector<InferenceEngine::Blob::Ptr> inputs;
-    std::vector<InferenceEngine::Blob::CPtr> constInputs;
-    std::vector<InferenceEngine::TensorDesc> inputDescs;
     std::vector<InferenceEngine::SizeVector> outputShapes;
     for (size_t i = 0; i < getParentEdges().size(); i++) {
         auto inputBlob = getParentEdgeAt(i)->getBlob();
         inputs.push_back(inputBlob);
-        constInputs.push_back(inputBlob);
-        if (isDynBatch && dynBatchLim >= inputs[inputs.size() - 1]->getTensorDesc().getDims()[0]) {
+        const auto& dims = inputBlob->getTensorDesc().getDims();
+        if (dims.empty() || dynBatchLim >= dims[0])
             isDynBatch = false;
-        } else {
-            // TODO: Ask the right dims using getShape() from previous node
-            inputDescs.push_back(inputs[inputs.size() - 1]->getTensorDesc());
-            if (inputDescs[inputDescs.size() - 1].getDims().size() > 0)
-                inputDescs[inputDescs.size() - 1].getDims()[0] = static_cast<size_t>(batchToProcess());
-        }
     }
 
     if (isDynBatch) {
-        if (extShapeInference) {
-            auto sts = extShapeInference->inferShapes(constInputs, params, blobs, outputShapes, nullptr);
-            if (sts != InferenceEngine::StatusCode::OK)
-                isDynBatch = false;
+        // the shapes of the outputs are inferred for the inputs of the reduced batch
+        std::vector<InferenceEngine::Blob::Ptr> batchInputs;
+        std::vector<InferenceEngine::Blob::CPtr> constInputs;
+        for (size_t i = 0; i < inputs.size(); i++) {
+            auto td = inputs[i]->getTensorDesc();
+            auto dims = td.getDims();
+            dims[0] = static_cast<size_t>(batchToProcess());
+            td.setDims(dims);
+            batchInputs.push_back(make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData()));
+            constInputs.push_back(batchInputs.back());
+        }
+        if (extShapeInference &&
+            extShapeInference->inferShapes(constInputs, params, blobs, outputShapes, nullptr) == InferenceEngine::StatusCode::OK &&
+            outputShapes.size() >= outDims.size()) {
+            inputs = batchInputs;
         } else {
             isDynBatch = false;
         }
     }
 
-    if (isDynBatch) {
-        for (size_t i = 0; i < inputs.size(); i++) {
-            auto td = inputs[i]->getTensorDesc();
-            td.setDims(inputDescs[i].getDims());
-            inputs[i] = make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData());
-        }
-    }
     std::vector<InferenceEngine::Blob::Ptr> outputs;
     for (size_t i = 0; i < outDims.size(); i++) {
         if (isDynBatch) {
@@ -163,6 +162,22 @@ void MKLDNNGenericNode::execLayer() {
     }
 }
 
+size_t MKLDNNGenericNode::getScratchpadSize() const {
+    // the layers of the plugin declare their temporary memory, the ones of the user extensions allocate it
+    auto * extLayer = impls.empty() ? nullptr :
+                      dynamic_cast<const InferenceEngine::Extensions::Cpu::ExtLayerBase *>(impls[0].get());
+    return extLayer ? extLayer->getScratchpadSize() : 0;
+}
+
+void MKLDNNGenericNode::setScratchpad(const MKLDNNScratchpad::Ptr& graphScratchpad) {
+    MKLDNNNode::setScratchpad(graphScratchpad);
+    for (auto &impl : impls) {
+        auto * extLayer = dynamic_cast<InferenceEngine::Extensions::Cpu::ExtLayerBase *>(impl.get());
+        if (extLayer)
+            extLayer->setScratchpad(graphScratchpad);
+    }
+}
+
 void MKLDNNGenericNode::initDescriptor(const InferenceEngine::LayerConfig &config) {
     InferenceEngine::LayerConfig rightConfig = config;
     InferenceEngine::StatusCode rc;
@@ -182,16 +197,28 @@ void MKLDNNGenericNode::initDescriptor(const InferenceEngine::LayerConfig &confi
         }
     }
 
+    // the layer writes to the memory of an input it is in-place with, so the memory must not be a constant
+    // computed once at load, and must not be read by other nodes through a reshape view
+    auto isReadOnlyInput = [&](size_t port) {
+        auto parent = getParentEdgeAt(port)->getParent();
+        if (parent->isConstant() && !isConstant())
+            return true;
+        return parent->getType() == Reshape && parent->getParentEdges().size() == 1 &&
+               parent->getParentEdgeAt(0)->getParent()->getChildEdges().size() > 1;
+    };
+
     for (size_t j = 0; j < rightConfig.inConfs.size(); j++) {
         // TODO: we need to better recognize cases with possible inplace conficts
-        if (getParentEdgeAt(j)->getParent()->getType() != Split &&
-            getParentEdgeAt(j)->getParent()->getChildEdges().size() > 1) {
+        if ((getParentEdgeAt(j)->getParent()->getType() != Split &&
+             getParentEdgeAt(j)->getParent()->getChildEdges().size() > 1) ||
+            (rightConfig.inConfs[j].inPlace >= 0 && isReadOnlyInput(j))) {
             rightConfig.inConfs[j].inPlace = -1;
         }
     }
     for (auto &outConf : rightConfig.outConfs) {
         if (outConf.inPlace < getParentEdges().size() &&
-            getParentEdgeAt(static_cast<size_t>(outConf.inPlace))->getParent()->getChildEdges().size() > 1) {
+            (getParentEdgeAt(static_cast<size_t>(outConf.inPlace))->getParent()->getChildEdges().size() > 1 ||
+             isReadOnlyInput(static_cast<size_t>(outConf.inPlace)))) {
             outConf.inPlace = -1;
         }
     }
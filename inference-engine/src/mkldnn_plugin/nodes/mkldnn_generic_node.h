@@ -31,6 +31,9 @@ public:
 
     void initDescriptor(const InferenceEngine::LayerConfig& config) override;
 
+    size_t getScratchpadSize() const override;
+    void setScratchpad(const MKLDNNScratchpad::Ptr& graphScratchpad) override;
+
     void execLayer();
     void cleanup() override;
 
@@ -100,6 +100,9 @@ void MKLDNNInputNode::execute(mkldnn::stream strm) {
     if (!constBlob)
         return;
     auto dstBlob = getChildEdgeAt(0)->getBlob();
+    // the lookup tables are served right from the blob
+    if (dstBlob->cbuffer().as<const void *>() == constBlob->cbuffer().as<const void *>())
+        return;
     if (precision == InferenceEngine::Precision::U8 || precision == InferenceEngine::Precision::I8) {
         const uint8_t *srcData = constBlob->cbuffer().as<uint8_t *>();
         uint8_t *dstData = dstBlob->buffer();
@@ -52,8 +52,8 @@ void MKLDNNLrnNode::createPrimitive() {
 
     auto prim_desc = createPrimitiveDescriptor<lrn_forward::primitive_desc, lrn_forward::desc>();
 
-    prim.reset(new lrn_forward(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
-                               getChildEdgeAt(0)->getMemory().GetPrimitive()));
+    createCachedPrimitive<lrn_forward>(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                                       getChildEdgeAt(0)->getMemory().GetPrimitive());
 }
 
 bool MKLDNNLrnNode::created() const {
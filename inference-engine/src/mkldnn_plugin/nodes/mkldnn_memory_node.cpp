@@ -56,6 +56,10 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
     float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
             getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
+    // the state is already updated if the previous layer has written it in-place, e.g. a scatter of a few rows
+    if (dst_ptr == src_ptr)
+        return;
+
     // TODO: this can be eliminated by completely removing MKLDNN memory output NODE, to fuse it with output of prev layer
     memcpy(dst_ptr, src_ptr, srcMemory.GetSize());
 }
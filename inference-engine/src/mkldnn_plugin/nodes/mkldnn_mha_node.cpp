@@ -0,0 +1,181 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_mha_node.h"
+#include <ie_layers.h>
+#include <ie_parallel.hpp>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+MKLDNNMultiHeadAttentionNode::MKLDNNMultiHeadAttentionNode(const InferenceEngine::CNNLayerPtr& layer,
+                                                           const mkldnn::engine& eng, int socket) :
+        MKLDNNNode(layer, eng, socket) {}
+
+void MKLDNNMultiHeadAttentionNode::getSupportedDescriptors() {
+    if (getParentEdges().size() != 3 && getParentEdges().size() != 4)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+    auto queryDims = getParentEdgeAt(0)->getDims();
+    auto keyDims = getParentEdgeAt(1)->getDims();
+    auto valueDims = getParentEdgeAt(2)->getDims();
+    auto outDims = getChildEdgeAt(0)->getDims();
+
+    if (queryDims.ndims() != 4 || keyDims.ndims() != 4 || valueDims.ndims() != 4 || outDims.ndims() != 4)
+        THROW_IE_EXCEPTION << "Unsupported dims count for layer " << getName();
+
+    batch = queryDims[0];
+    querySize = queryDims[1];
+    heads = queryDims[2];
+    headSize = queryDims[3];
+    keySize = keyDims[1];
+
+    if (keyDims[0] != batch || keyDims[2] != heads || keyDims[3] != headSize || keyDims != valueDims)
+        THROW_IE_EXCEPTION << "Query, key and value dimensions are inconsistent for layer " << getName();
+
+    int outQueryAxis = permuteOutput ? 1 : 2;
+    int outHeadsAxis = permuteOutput ? 2 : 1;
+    if (outDims[0] != batch || outDims[outQueryAxis] != querySize || outDims[outHeadsAxis] != heads ||
+        outDims[3] != headSize)
+        THROW_IE_EXCEPTION << "Output dimensions are incorrect for layer " << getName();
+
+    withMask = getParentEdges().size() == 4;
+    maskStrides.clear();
+    if (withMask) {
+        auto maskDims = getParentEdgeAt(3)->getDims();
+        if (maskDims.ndims() != 4 || maskDims[3] != keySize ||
+            (maskDims[0] != 1 && maskDims[0] != batch) ||
+            (maskDims[1] != 1 && maskDims[1] != heads) ||
+            (maskDims[2] != 1 && maskDims[2] != querySize))
+            THROW_IE_EXCEPTION << "Mask dimensions are incorrect for layer " << getName();
+
+        size_t stride = maskDims[3];
+        maskStrides.resize(3);
+        for (int i = 2; i >= 0; i--) {
+            maskStrides[i] = maskDims[i] == 1 ? 0 : stride;
+            stride *= maskDims[i];
+        }
+    }
+}
+
+void MKLDNNMultiHeadAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(Precision::FP32);
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), dataType, memory::nchw);
+        config.inConfs.push_back(dataConfig);
+    }
+
+    InferenceEngine::DataConfig dataConfig;
+    dataConfig.inPlace = -1;
+    dataConfig.constant = false;
+    dataConfig.desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), dataType, memory::nchw);
+    config.outConfs.push_back(dataConfig);
+
+    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::gemm_any, memory::nchw});
+}
+
+void MKLDNNMultiHeadAttentionNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory isn't allocated.";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory isn't allocated.";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor isn't set.";
+}
+
+void MKLDNNMultiHeadAttentionNode::execute(mkldnn::stream strm) {
+    auto getData = [&](size_t port) {
+        auto& memory = getParentEdgeAt(port)->getMemory();
+        return reinterpret_cast<const float*>(memory.GetData()) +
+               memory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    };
+    const float *query = getData(0);
+    const float *key = getData(1);
+    const float *value = getData(2);
+    const float *mask = withMask ? getData(3) : nullptr;
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    float *dst = reinterpret_cast<float*>(dstMemory.GetData()) +
+                 dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    // rows of all heads are interleaved in the inputs, so every head is read with a leading dimension instead of
+    // being permuted to a separate buffer
+    const int ld = heads * headSize;
+    const int ldDst = permuteOutput ? heads * headSize : headSize;
+    const int blocks = (querySize + queryBlock - 1) / queryBlock;
+    const float one = 1.0f;
+    const float zero = 0.0f;
+
+    const int threadsNum = parallel_get_max_threads();
+    std::vector<float> scoresBuffer(static_cast<size_t>(threadsNum) * queryBlock * keySize);
+
+    parallel_nt(threadsNum, [&](const int ithr, const int nthr) {
+        float *scores = &scoresBuffer[static_cast<size_t>(ithr) * queryBlock * keySize];
+        for_3d(ithr, nthr, batch, heads, blocks, [&](int b, int h, int blk) {
+            int m0 = blk * queryBlock;
+            int mb = std::min(queryBlock, querySize - m0);
+
+            const float *q = query + (static_cast<size_t>(b * querySize + m0) * heads + h) * headSize;
+            const float *k = key + (static_cast<size_t>(b) * keySize * heads + h) * headSize;
+            const float *v = value + (static_cast<size_t>(b) * keySize * heads + h) * headSize;
+
+            // scores[mb, keySize] = scale * Q * K^T
+            mkldnn_sgemm("T", "N", &keySize, &mb, &headSize, &scale, k, &ld, q, &ld, &zero, scores, &keySize);
+
+            for (int m = 0; m < mb; m++) {
+                float *row = scores + m * keySize;
+                if (withMask) {
+                    const float *maskRow = mask + b * maskStrides[0] + h * maskStrides[1] + (m0 + m) * maskStrides[2];
+                    for (int j = 0; j < keySize; j++)
+                        row[j] += maskRow[j];
+                }
+
+                float max = -std::numeric_limits<float>::infinity();
+                for (int j = 0; j < keySize; j++)
+                    max = std::max(max, row[j]);
+                float sum = 0.0f;
+                for (int j = 0; j < keySize; j++) {
+                    row[j] = std::exp(row[j] - max);
+                    sum += row[j];
+                }
+                float invSum = 1.0f / sum;
+                for (int j = 0; j < keySize; j++)
+                    row[j] *= invSum;
+            }
+
+            float *d = permuteOutput ? dst + (static_cast<size_t>(b * querySize + m0) * heads + h) * headSize
+                                     : dst + (static_cast<size_t>(b * heads + h) * querySize + m0) * headSize;
+
+            // dst[mb, headSize] = scores * V
+            mkldnn_sgemm("N", "N", &headSize, &mb, &keySize, &one, v, &ld, scores, &keySize, &zero, d, &ldDst);
+        });
+    });
+}
+
+bool MKLDNNMultiHeadAttentionNode::created() const {
+    return getType() == MultiHeadAttention;
+}
+REG_MKLDNN_PRIM_FOR(MKLDNNMultiHeadAttentionNode, MultiHeadAttention);
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Scaled dot product attention softmax(scale * Q * K^T + mask) * V for all heads at once.
+ *
+ * The node is created by MKLDNNGraphOptimizer from the Permute/Gemm/SoftMax/Gemm pattern. Q, K and V are taken
+ * in [batch, sequence, heads, head size] layout as they are produced before the permutes, the optional mask has
+ * to be broadcastable to [batch, heads, sequence, sequence]. The output is either in [batch, heads, sequence, head size]
+ * layout or, when the output permute is fused too, in [batch, sequence, heads, head size] layout.
+ */
+class MKLDNNMultiHeadAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNMultiHeadAttentionNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket);
+    ~MKLDNNMultiHeadAttentionNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    void setAttributes(float scale, bool permuteOutput) {
+        this->scale = scale;
+        this->permuteOutput = permuteOutput;
+    }
+
+private:
+    // number of query rows whose scores are kept in a per thread buffer
+    static constexpr int queryBlock = 32;
+
+    float scale = 1.0f;
+    bool permuteOutput = false;
+    bool withMask = false;
+
+    int batch = 0;
+    int heads = 0;
+    int querySize = 0;
+    int keySize = 0;
+    int headSize = 0;
+
+    // mask strides for batch, head and query dimensions, keys are always dense
+    std::vector<size_t> maskStrides;
+};
+
+}  // namespace MKLDNNPlugin
+
@@ -65,7 +65,7 @@ struct jit_uni_permute_kernel_f32 : public jit_uni_permute_kernel, public jit_ge
         Xbyak::Label exit_label;
 
         if (n + 1 == jpp.ndims) {
-            if (jpp.src_strides[n] == jpp.dst_strides[n] == 1) {
+            if (jpp.src_strides[n] == 1 && jpp.dst_strides[n] == 1) {
                 uint32_t step = vlen / jpp.data_size;
 
                 L(main_loop_label);
@@ -150,6 +150,19 @@ void MKLDNNPermuteNode::getSupportedDescriptors() {
         order.push_back(static_cast<size_t>(ord));
 }
 
+bool MKLDNNPermuteNode::isMemoryReshape() const {
+    auto srcDims = getParentEdgeAt(0)->getDims().ToSizeVector();
+    int prevAxis = -1;
+    for (auto axis : order) {
+        if (srcDims[axis] == 1)
+            continue;
+        if (static_cast<int>(axis) < prevAxis)
+            return false;
+        prevAxis = static_cast<int>(axis);
+    }
+    return true;
+}
+
 void MKLDNNPermuteNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
@@ -166,10 +179,14 @@ void MKLDNNPermuteNode::initSupportedPrimitiveDescriptors() {
     config.inConfs[0].constant = false;
     config.outConfs[0].inPlace = -1;
     config.outConfs[0].constant = false;
+    // the planar data of a permute moving only the unit dimensions is a view on the input
+    const int planarInPlace = isMemoryReshape() ? 0 : -1;
     if (getParentEdgeAt(0)->getDims().ndims() == 4) {
         config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nchw);
         config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nchw);
+        config.outConfs[0].inPlace = planarInPlace;
         supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, memory::nchw});
+        config.outConfs[0].inPlace = -1;
 
         auto srcDims = getParentEdgeAt(0)->getDims();
         if (srcDims[1] % 8 == 0) {
@@ -190,7 +207,9 @@ void MKLDNNPermuteNode::initSupportedPrimitiveDescriptors() {
     } else if (getParentEdgeAt(0)->getDims().ndims() == 5) {
         config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::ncdhw);
         config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::ncdhw);
+        config.outConfs[0].inPlace = planarInPlace;
         supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, memory::ncdhw});
+        config.outConfs[0].inPlace = -1;
 
         auto srcDims = getParentEdgeAt(0)->getDims();
         if (srcDims[1] % 8 == 0) {
@@ -209,7 +228,10 @@ void MKLDNNPermuteNode::initSupportedPrimitiveDescriptors() {
             supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, memory::ndhwc});
         }
     } else {
-        config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::any);
+        config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType,
+                                                  planarInPlace == 0 ? MKLDNNMemory::GetPlainFormat(getParentEdgeAt(0)->getDims())
+                                                                     : memory::any);
+        config.outConfs[0].inPlace = planarInPlace;
         config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType,
                                                    MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims()));
         supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims())});
@@ -344,6 +366,53 @@ void MKLDNNPermuteNode::createPrimitive() {
     jpp.ndims = sorted_order.size();
     jpp.data_size = MKLDNNExtensionUtils::sizeOfDataType(data_type);
 
+    // The planar permutes which move the innermost dimension are transposes of the dimension contiguous in the source
+    // and the one contiguous in the destination: they are copied by the tiles of the two dimensions, so both the
+    // source and the destination lines of a tile stay in cache instead of the strided reads of the whole rows.
+    tiled_conf = permute_tiled_conf_t();
+    auto isPlanar = [](const TensorDesc &desc) {
+        const auto &blocking = desc.getBlockingDesc();
+        if (blocking.getBlockDims() != desc.getDims())
+            return false;
+        for (size_t i = 0; i < blocking.getOrder().size(); i++) {
+            if (blocking.getOrder()[i] != i)
+                return false;
+        }
+        return true;
+    };
+    if (isPlanar(srcDesc) && isPlanar(dstDesc)) {
+        SizeVector dims, strides;
+        for (size_t i = 0; i < order.size(); i++) {
+            if (dst_dims[i] == 1)
+                continue;
+            size_t stride = srcDesc.getBlockingDesc().getStrides()[order[i]];
+            if (!strides.empty() && strides.back() == stride * dst_dims[i]) {
+                dims.back() *= dst_dims[i];
+                strides.back() = stride;
+            } else {
+                dims.push_back(dst_dims[i]);
+                strides.push_back(stride);
+            }
+        }
+
+        SizeVector dense_dst_strides(dst_dims.size(), 1);
+        for (int i = static_cast<int>(dst_dims.size()) - 2; i >= 0; i--)
+            dense_dst_strides[i] = dense_dst_strides[i + 1] * dst_dims[i + 1];
+
+        auto src_inner = std::find(strides.begin(), strides.end(), 1);
+        if (dims.size() > 1 && strides.back() != 1 && src_inner != strides.end() && dense_dst_strides == dst_block_strides) {
+            tiled_conf.dims = dims;
+            tiled_conf.src_strides = strides;
+            tiled_conf.dst_strides.resize(dims.size(), 1);
+            for (int i = static_cast<int>(dims.size()) - 2; i >= 0; i--)
+                tiled_conf.dst_strides[i] = tiled_conf.dst_strides[i + 1] * dims[i + 1];
+            tiled_conf.src_inner_dim = std::distance(strides.begin(), src_inner);
+            tiled_conf.data_size = MKLDNNExtensionUtils::sizeOfDataType(data_type);
+            tiled_conf.enabled = tiled_conf.data_size == 1 || tiled_conf.data_size == 2 ||
+                                 tiled_conf.data_size == 4 || tiled_conf.data_size == 8;
+        }
+    }
+
     if (mayiuse(cpu::avx512_common)) {
         permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::avx512_common>(jpp));
     } else if (mayiuse(cpu::avx2)) {
@@ -866,10 +935,52 @@ std::multimap<InferenceEngine::SizeVector, MKLDNNPermuteNode::PermuteImpl> MKLDN
         })},
 };
 
+template <typename data_t>
+void MKLDNNPermuteNode::permuteTiled(const data_t *src_data, data_t *dst_data) const {
+    const auto &dims = tiled_conf.dims;
+    const auto &src_strides = tiled_conf.src_strides;
+    const auto &dst_strides = tiled_conf.dst_strides;
+    const size_t inner = dims.size() - 1;
+    const size_t src_inner = tiled_conf.src_inner_dim;
+    // a tile is a square of cache lines
+    const size_t tile = std::max<size_t>(8, 64 / sizeof(data_t));
+
+    size_t outer_size = 1;
+    for (size_t i = 0; i < inner; i++) {
+        if (i != src_inner)
+            outer_size *= dims[i];
+    }
+
+    parallel_for3d(outer_size, div_up(dims[src_inner], tile), div_up(dims[inner], tile), [&](size_t o, size_t t0, size_t t1) {
+        size_t src_off = 0;
+        size_t dst_off = 0;
+        for (size_t i = inner; i-- > 0;) {
+            if (i == src_inner)
+                continue;
+            src_off += (o % dims[i]) * src_strides[i];
+            dst_off += (o % dims[i]) * dst_strides[i];
+            o /= dims[i];
+        }
+
+        const size_t i0_end = std::min((t0 + 1) * tile, dims[src_inner]);
+        const size_t i1_end = std::min((t1 + 1) * tile, dims[inner]);
+        for (size_t i0 = t0 * tile; i0 < i0_end; i0++) {
+            const data_t *src = src_data + src_off + i0;
+            data_t *dst = dst_data + dst_off + i0 * dst_strides[src_inner];
+            for (size_t i1 = t1 * tile; i1 < i1_end; i1++)
+                dst[i1] = src[i1 * src_strides[inner]];
+        }
+    });
+}
+
 void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
     auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
 
+    // the output is a view on the input
+    if (srcMemPtr->GetData() == dstMemPtr->GetData())
+        return;
+
     if (prec == Precision::FP32) {
         for (const auto &impl : OptimizedCases) {
             if (impl.first == order && impl.second.isValidParams(batchToProcess(), srcMemPtr, dstMemPtr)) {
@@ -879,6 +990,28 @@ void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
         }
     }
 
+    if (tiled_conf.enabled && batchToProcess() == srcMemPtr->GetDims()[0]) {
+        auto src_data = reinterpret_cast<const uint8_t *>(srcMemPtr->GetData()) +
+                srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding * tiled_conf.data_size;
+        auto dst_data = reinterpret_cast<uint8_t *>(dstMemPtr->GetData()) +
+                dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding * tiled_conf.data_size;
+        switch (tiled_conf.data_size) {
+            case 1:
+                permuteTiled(src_data, dst_data);
+                break;
+            case 2:
+                permuteTiled(reinterpret_cast<const uint16_t *>(src_data), reinterpret_cast<uint16_t *>(dst_data));
+                break;
+            case 4:
+                permuteTiled(reinterpret_cast<const uint32_t *>(src_data), reinterpret_cast<uint32_t *>(dst_data));
+                break;
+            case 8:
+                permuteTiled(reinterpret_cast<const uint64_t *>(src_data), reinterpret_cast<uint64_t *>(dst_data));
+                break;
+        }
+        return;
+    }
+
     if (permute_kernel) {
         auto src_data = reinterpret_cast<const char *>(srcMemPtr->GetData());
         auto dst_data = reinterpret_cast<char *>(dstMemPtr->GetData());
@@ -25,6 +25,18 @@ struct jit_permute_conf_t {
     bool supported_dynamic_batch = false;
 };
 
+struct permute_tiled_conf_t {
+    // dimensions of the destination, the neighbours which stay together in the source are collapsed
+    InferenceEngine::SizeVector dims;
+    InferenceEngine::SizeVector src_strides;
+    InferenceEngine::SizeVector dst_strides;
+    // the dimension with the unit stride in the source
+    size_t src_inner_dim = 0;
+    int data_size = 0;
+
+    bool enabled = false;
+};
+
 struct jit_args_permute {
     const void* src;
     const void* dst;
@@ -56,6 +68,10 @@ public:
     }
 
 private:
+    bool isMemoryReshape() const;
+    template <typename data_t>
+    void permuteTiled(const data_t *src_data, data_t *dst_data) const;
+
     InferenceEngine::SizeVector order;
     InferenceEngine::Precision prec;
 
@@ -70,6 +86,7 @@ private:
 
     static std::multimap<InferenceEngine::SizeVector, PermuteImpl> OptimizedCases;
     std::shared_ptr<jit_uni_permute_kernel> permute_kernel;
+    permute_tiled_conf_t tiled_conf;
 };
 
 }  // namespace MKLDNNPlugin
@@ -112,14 +112,21 @@ void MKLDNNPoolingNode::createPrimitive() {
 
     auto prim_desc = createPrimitiveDescriptor<pooling_forward::primitive_desc, pooling_forward::desc>(attr);
 
-    prim.reset(new pooling_forward(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
-                                   getChildEdgeAt(0)->getMemory().GetPrimitive()));
+    createCachedPrimitive<pooling_forward>(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                                           getChildEdgeAt(0)->getMemory().GetPrimitive());
 }
 
 bool MKLDNNPoolingNode::created() const {
     return getType() == Pooling;
 }
 
+uint64_t MKLDNNPoolingNode::getFlops() const {
+    uint64_t kernelSize = 1;
+    for (auto k : kernel)
+        kernelSize *= k;
+    return kernelSize * static_cast<uint64_t>(getChildEdgeAt(0)->getDims().size());
+}
+
 void MKLDNNPoolingNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                          const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
     MKLDNNMemoryDesc in_candidate(inputDesc[0]);
@@ -24,6 +24,7 @@ public:
     void initDescriptor(const InferenceEngine::LayerConfig &config) override;
     void createPrimitive() override;
     bool created() const override;
+    uint64_t getFlops() const override;
     bool canBeInPlace() const override {
         return false;
     }
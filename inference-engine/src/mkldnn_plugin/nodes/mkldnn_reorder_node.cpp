@@ -9,9 +9,288 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
+#include "jit_generator.hpp"
+#include "jit_uni_reorder.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_args_reorder, field)
+
+// MKLDNN runs the reorders its JIT kernel doesn't cover (e.g. more than three loops which cannot be unrolled, as in
+// the blocked 5D layouts) on the reference code computing the offsets of every element. The kernel below takes the
+// same loops as MKLDNN, but nests any number of them and converts the precisions with the output scales on the fly.
+template <cpu::cpu_isa_t isa>
+struct jit_uni_reorder_kernel_f32 : public jit_uni_reorder_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reorder_kernel_f32)
+
+    explicit jit_uni_reorder_kernel_f32(jit_reorder_conf_t jrp) : jit_uni_reorder_kernel(jrp), jit_generator() {
+        src_data_size = MKLDNNExtensionUtils::sizeOfDataType(jrp.src_dt);
+        dst_data_size = MKLDNNExtensionUtils::sizeOfDataType(jrp.dst_dt);
+        is_copy = jrp.src_dt == jrp.dst_dt && !jrp.with_scales;
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        if (jrp.with_scales)
+            mov(reg_scales, ptr[reg_params + GET_OFF(scales)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        if (jrp.dst_dt == memory::u8)
+            uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+        // cvtps2dq returns INT_MIN for the values beyond the int32 range, so they are clamped to the largest float
+        // below 2^31 first, the same as MKLDNN saturates them
+        if (!is_copy && jrp.dst_dt != memory::f32) {
+            mov(reg_tmp_32, float2int(2147483520.f));
+            movq(xmm_max, reg_tmp_64);
+            uni_vbroadcastss(vmm_max, xmm_max);
+        }
+
+        loop(jrp.n);
+
+        this->postamble();
+
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    uint32_t vlen = cpu_isa_traits<isa>::vlen;
+    uint32_t simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    size_t src_data_size = 0;
+    size_t dst_data_size = 0;
+    // the same precisions without the scales are moved as is, so the integers keep all their bits
+    bool is_copy = false;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_scales = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_tmp_64 = r12;
+    Xbyak::Reg32 reg_tmp_32 = r12d;
+    Xbyak::Reg8 reg_tmp_8 = r12b;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_scale = Vmm(1);
+    Vmm vmm_zero = Vmm(2);
+    Vmm vmm_max = Vmm(3);
+    Xbyak::Xmm xmm_val = Xbyak::Xmm(0);
+    Xbyak::Xmm xmm_scale = Xbyak::Xmm(1);
+    Xbyak::Xmm xmm_max = Xbyak::Xmm(3);
+
+    void loop(size_t i) {
+        // the outermost loop of the kernel gets its iterations from the node, which splits them between the threads
+        if (i != jrp.n)
+            mov(reg_work_amount, jrp.dims[i]);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        const bool is_inner = i + 1 == jrp.dims.size();
+        const size_t scale_stride = jrp.with_scales ? jrp.scale_strides[i] : 0;
+
+        if (is_inner && jrp.src_strides[i] == 1 && jrp.dst_strides[i] == 1 && scale_stride <= 1) {
+            const uint32_t step = is_copy ? vlen / src_data_size : simd_w;
+
+            L(main_loop_label);
+            {
+                cmp(reg_work_amount, step);
+                jl(tail_loop_label, T_NEAR);
+
+                if (is_copy) {
+                    uni_vmovups(vmm_val, ptr[reg_src]);
+                    uni_vmovups(ptr[reg_dst], vmm_val);
+                } else {
+                    load_vector(vmm_val, ptr[reg_src], jrp.src_dt);
+                    if (jrp.with_scales) {
+                        if (scale_stride == 1)
+                            uni_vmovups(vmm_scale, ptr[reg_scales]);
+                        else
+                            uni_vbroadcastss(vmm_scale, ptr[reg_scales]);
+                        uni_vmulps(vmm_val, vmm_val, vmm_scale);
+                    }
+                    store_vector(ptr[reg_dst], vmm_val, jrp.dst_dt);
+                }
+
+                add(reg_src, step * src_data_size);
+                add(reg_dst, step * dst_data_size);
+                if (scale_stride)
+                    add(reg_scales, step * sizeof(float));
+                sub(reg_work_amount, step);
+
+                jmp(main_loop_label, T_NEAR);
+            }
+        }
+
+        L(tail_loop_label); {
+            cmp(reg_work_amount, 0);
+            je(exit_label, T_NEAR);
+
+            if (is_inner) {
+                if (is_copy) {
+                    copy_scalar(ptr[reg_dst], ptr[reg_src]);
+                } else {
+                    load_scalar(xmm_val, ptr[reg_src], jrp.src_dt);
+                    if (jrp.with_scales) {
+                        movss(xmm_scale, ptr[reg_scales]);
+                        mulss(xmm_val, xmm_scale);
+                    }
+                    store_scalar(ptr[reg_dst], xmm_val, jrp.dst_dt);
+                }
+            } else {
+                push(reg_src);
+                push(reg_dst);
+                push(reg_scales);
+                push(reg_work_amount);
+                loop(i + 1);
+                pop(reg_work_amount);
+                pop(reg_scales);
+                pop(reg_dst);
+                pop(reg_src);
+            }
+
+            add(reg_src, jrp.src_strides[i] * src_data_size);
+            add(reg_dst, jrp.dst_strides[i] * dst_data_size);
+            if (scale_stride)
+                add(reg_scales, scale_stride * sizeof(float));
+            sub(reg_work_amount, 1);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+    }
+
+    inline void copy_scalar(const Xbyak::Address &dst, const Xbyak::Address &src) {
+        if (src_data_size == 1) {
+            mov(reg_tmp_8, src);
+            mov(dst, reg_tmp_8);
+        } else {
+            mov(reg_tmp_32, src);
+            mov(dst, reg_tmp_32);
+        }
+    }
+
+    inline void load_vector(Vmm vmm_src, const Xbyak::Address &op, memory::data_type src_dt) {
+        switch (src_dt) {
+            case memory::f32:
+            case memory::s32:
+                uni_vmovups(vmm_src, op);
+                break;
+            case memory::s8:
+                uni_vpmovsxbd(vmm_src, op);
+                break;
+            case memory::u8:
+                uni_vpmovzxbd(vmm_src, op);
+                break;
+            default:
+                assert(!"unknown src_dt");
+        }
+
+        if (src_dt != memory::f32)
+            uni_vcvtdq2ps(vmm_src, vmm_src);
+    }
+
+    inline void store_vector(const Xbyak::Address &op, Vmm vmm_dst, memory::data_type dst_dt) {
+        Xbyak::Ymm ymm_dst = Xbyak::Ymm(vmm_dst.getIdx());
+        Xbyak::Xmm xmm_dst = Xbyak::Xmm(vmm_dst.getIdx());
+
+        if (dst_dt != memory::f32) {
+            uni_vminps(vmm_dst, vmm_dst, vmm_max);
+            uni_vcvtps2dq(vmm_dst, vmm_dst);
+        }
+
+        if (dst_dt == memory::f32 || dst_dt == memory::s32) {
+            uni_vmovups(op, vmm_dst);
+        } else if (dst_dt == memory::u8) {
+            if (isa == cpu::avx512_common) {
+                vpmaxsd(vmm_dst, vmm_dst, vmm_zero);
+                vpmovusdb(op, vmm_dst);
+            } else {
+                uni_vpackusdw(vmm_dst, vmm_dst, vmm_dst);
+                if (isa != cpu::sse42)
+                    vpermq(ymm_dst, ymm_dst, 0x08);
+                uni_vpackuswb(vmm_dst, vmm_dst, vmm_dst);
+                if (isa != cpu::sse42)
+                    vmovq(op, xmm_dst);
+                else
+                    movd(op, xmm_dst);
+            }
+        } else if (dst_dt == memory::s8) {
+            if (isa == cpu::avx512_common) {
+                vpmovsdb(op, vmm_dst);
+            } else {
+                uni_vpackssdw(vmm_dst, vmm_dst, vmm_dst);
+                if (isa != cpu::sse42)
+                    vpermq(ymm_dst, ymm_dst, 0x08);
+                uni_vpacksswb(vmm_dst, vmm_dst, vmm_dst);
+                if (isa != cpu::sse42)
+                    vmovq(op, xmm_dst);
+                else
+                    movd(op, xmm_dst);
+            }
+        }
+    }
+
+    inline void load_scalar(Xbyak::Xmm xmm_src, const Xbyak::Address &op, memory::data_type src_dt) {
+        switch (src_dt) {
+            case memory::f32:
+            case memory::s32:
+                movss(xmm_src, op);
+                break;
+            case memory::s8:
+                movsx(reg_tmp_32, op);
+                movq(xmm_src, reg_tmp_64);
+                break;
+            case memory::u8:
+                movzx(reg_tmp_32, op);
+                movq(xmm_src, reg_tmp_64);
+                break;
+            default:
+                assert(!"unknown src_dt");
+        }
+
+        if (src_dt != memory::f32)
+            uni_vcvtdq2ps(xmm_src, xmm_src);
+    }
+
+    inline void store_scalar(const Xbyak::Address &op, Xbyak::Xmm xmm_dst, memory::data_type dst_dt) {
+        if (dst_dt != memory::f32) {
+            minss(xmm_dst, xmm_max);
+            uni_vcvtps2dq(xmm_dst, xmm_dst);
+        }
+
+        switch (dst_dt) {
+            case memory::f32:
+            case memory::s32:
+                movss(op, xmm_dst);
+                break;
+            case memory::s8:
+                uni_vpackssdw(xmm_dst, xmm_dst, xmm_dst);
+                uni_vpacksswb(xmm_dst, xmm_dst, xmm_dst);
+                movq(reg_tmp_64, xmm_dst);
+                mov(op, reg_tmp_8);
+                break;
+            case memory::u8:
+                uni_vpackusdw(xmm_dst, xmm_dst, xmm_dst);
+                uni_vpackuswb(xmm_dst, xmm_dst, xmm_dst);
+                movq(reg_tmp_64, xmm_dst);
+                mov(op, reg_tmp_8);
+                break;
+            default:
+                assert(!"unknown dst_dt");
+        }
+    }
+};
 
 MKLDNNReorderNode::MKLDNNReorderNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket) :
         MKLDNNNode(layer, eng, socket) {
@@ -84,9 +363,8 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
 
     mkldnn::primitive_attr attr;
 
+    scales.clear();
     if (_scales) {
-        std::vector<float> scales;
-
         float* scaleData = static_cast<float*>(_scales->buffer());
 
         for (size_t i = 0; i < _scales->size(); i++) {
@@ -111,6 +389,13 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
         supportedPrimitiveDescriptors[0].setOutputLayouts(static_cast<memory::format>(dstDesc.data.format));
 
         prim.reset(new mkldnn::reorder(pd, src_blocked->GetPrimitive(), dst_blocked->GetPrimitive()));
+
+        reorder_kernel.reset();
+        if (isReference() && createReorderKernel(attr)) {
+            supportedPrimitiveDescriptors[0].setImplementationType(
+                    mayiuse(cpu::avx512_common) ? impl_desc_type::jit_avx512 :
+                    mayiuse(cpu::avx2) ? impl_desc_type::jit_avx2 : impl_desc_type::jit_sse42);
+        }
     };
 
     try {
@@ -138,6 +423,113 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
     }
 }
 
+bool MKLDNNReorderNode::createReorderKernel(const mkldnn::primitive_attr &attr) {
+    if (!mayiuse(cpu::sse42))
+        return false;
+
+    // the loops of MKLDNN check that the padded dimensions of the memories are the same and take the special
+    // weights layouts (e.g. OIhw4i16o4i) which the blocking descriptors do not describe
+    tr::prb_t prb;
+    if (tr::prb_init(prb, src_blocked->GetDescriptor().data, dst_blocked->GetDescriptor().data, attr.get()) != status::success)
+        return false;
+
+    using namespace mkldnn::impl::data_type;
+    if (!one_of(prb.itype, f32, s32, s8, u8) || !one_of(prb.otype, f32, s32, s8, u8) || prb.beta != 0.f)
+        return false;
+    // the scales are given for the real channels only
+    if (prb.scale_type == tr::scale_type_t::MANY &&
+        (src_blocked->GetDescriptor().data.layout_desc.blocking.padding_dims[1] != src_blocked->GetDims()[1] ||
+         scales.size() != static_cast<size_t>(src_blocked->GetDims()[1])))
+        return false;
+
+    tr::prb_normalize(prb);
+    tr::prb_simplify(prb);
+
+    jit_reorder_conf_t jrp;
+    for (int d = prb.ndims - 1; d >= 0; d--) {
+        jrp.dims.push_back(prb.nodes[d].n);
+        jrp.src_strides.push_back(static_cast<size_t>(prb.nodes[d].is));
+        jrp.dst_strides.push_back(static_cast<size_t>(prb.nodes[d].os));
+        jrp.scale_strides.push_back(prb.scale_type == tr::scale_type_t::MANY ? static_cast<size_t>(prb.nodes[d].ss) : 0);
+    }
+    jrp.src_offset = static_cast<size_t>(prb.ioff);
+    jrp.dst_offset = static_cast<size_t>(prb.ooff);
+    jrp.src_dt = static_cast<memory::data_type>(prb.itype);
+    jrp.dst_dt = static_cast<memory::data_type>(prb.otype);
+    jrp.with_scales = prb.scale_type != tr::scale_type_t::NONE;
+
+    // the outer loops run in parallel until there is enough work for the threads, the kernel runs at least one loop
+    const size_t n_max = 3;
+    const size_t threads = static_cast<size_t>(mkldnn_get_max_threads());
+    size_t work_amount = 1;
+    while (jrp.n < n_max && jrp.n + 1 < jrp.dims.size() && work_amount < 4 * threads)
+        work_amount *= jrp.dims[jrp.n++];
+
+    if (mayiuse(cpu::avx512_common)) {
+        reorder_kernel.reset(new jit_uni_reorder_kernel_f32<cpu::avx512_common>(jrp));
+    } else if (mayiuse(cpu::avx2)) {
+        reorder_kernel.reset(new jit_uni_reorder_kernel_f32<cpu::avx2>(jrp));
+    } else {
+        reorder_kernel.reset(new jit_uni_reorder_kernel_f32<cpu::sse42>(jrp));
+    }
+    return true;
+}
+
+void MKLDNNReorderNode::executeReorderKernel() {
+    const auto &jrp = reorder_kernel->jrp;
+    const size_t src_data_size = MKLDNNExtensionUtils::sizeOfDataType(jrp.src_dt);
+    const size_t dst_data_size = MKLDNNExtensionUtils::sizeOfDataType(jrp.dst_dt);
+
+    auto src_data = reinterpret_cast<const uint8_t *>(getParentEdgeAt(0)->getMemory().GetData()) + jrp.src_offset * src_data_size;
+    auto dst_data = reinterpret_cast<uint8_t *>(getChildEdgeAt(0)->getMemory().GetData()) + jrp.dst_offset * dst_data_size;
+    const float *scales_data = scales.empty() ? nullptr : scales.data();
+
+    auto run = [&](size_t src_off, size_t dst_off, size_t scale_off, size_t work_amount) {
+        auto arg = jit_args_reorder();
+        arg.src = src_data + src_off * src_data_size;
+        arg.dst = dst_data + dst_off * dst_data_size;
+        arg.scales = scales_data ? scales_data + scale_off : nullptr;
+        arg.work_amount = work_amount;
+        (*reorder_kernel)(&arg);
+    };
+
+    const auto &dims = jrp.dims;
+    const auto &ss = jrp.scale_strides;
+    const auto &is = jrp.src_strides;
+    const auto &os = jrp.dst_strides;
+    switch (jrp.n) {
+        case 0:
+            parallel_nt(0, [&](const int ithr, const int nthr) {
+                size_t start = 0, end = 0;
+                splitter(dims[0], nthr, ithr, start, end);
+                if (start < end)
+                    run(start * is[0], start * os[0], start * ss[0], end - start);
+            });
+            break;
+        case 1:
+            parallel_for(dims[0], [&](size_t i0) {
+                run(i0 * is[0], i0 * os[0], i0 * ss[0], dims[1]);
+            });
+            break;
+        case 2:
+            parallel_for2d(dims[0], dims[1], [&](size_t i0, size_t i1) {
+                run(i0 * is[0] + i1 * is[1], i0 * os[0] + i1 * os[1], i0 * ss[0] + i1 * ss[1], dims[2]);
+            });
+            break;
+        case 3:
+            parallel_for3d(dims[0], dims[1], dims[2], [&](size_t i0, size_t i1, size_t i2) {
+                run(i0 * is[0] + i1 * is[1] + i2 * is[2], i0 * os[0] + i1 * os[1] + i2 * os[2],
+                    i0 * ss[0] + i1 * ss[1] + i2 * ss[2], dims[3]);
+            });
+            break;
+    }
+}
+
+bool MKLDNNReorderNode::isReference() const {
+    const auto *selected_pd = getSelectedPrimitiveDescriptor();
+    return selected_pd != nullptr && (selected_pd->getImplementationType() & impl_desc_type::ref) == impl_desc_type::ref;
+}
+
 const std::vector<impl_desc_type>& MKLDNNReorderNode::getPrimitivesPriority() {
     implPriorities = {impl_desc_type::reorder};
     return implPriorities;
@@ -148,6 +540,11 @@ bool MKLDNNReorderNode::created() const {
 }
 
 void MKLDNNReorderNode::execute(mkldnn::stream strm) {
+    if (reorder_kernel) {
+        executeReorderKernel();
+        return;
+    }
+
     src_blocked->GetPrimitivePtr()->set_data_handle(getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle());
     dst_blocked->GetPrimitivePtr()->set_data_handle(getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle());
 
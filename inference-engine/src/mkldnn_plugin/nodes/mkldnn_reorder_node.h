@@ -12,6 +12,42 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_reorder_conf_t {
+    // loops of the reorder from the outermost one, the neighbours which are dense in both memories are collapsed
+    InferenceEngine::SizeVector dims;
+    InferenceEngine::SizeVector src_strides;
+    InferenceEngine::SizeVector dst_strides;
+    // steps of the output scales, zeros for the loops which do not move along the channels
+    InferenceEngine::SizeVector scale_strides;
+    // number of the outer loops the node runs in parallel, the kernel runs the rest
+    size_t n = 0;
+    size_t src_offset = 0;
+    size_t dst_offset = 0;
+
+    mkldnn::memory::data_type src_dt;
+    mkldnn::memory::data_type dst_dt;
+    bool with_scales = false;
+};
+
+struct jit_args_reorder {
+    const void* src;
+    void* dst;
+    const float* scales;
+    // iterations of the outermost loop of the kernel
+    size_t work_amount;
+};
+
+struct jit_uni_reorder_kernel {
+    void (*ker_)(const jit_args_reorder *);
+
+    void operator()(const jit_args_reorder *args) { assert(ker_); ker_(args); }
+
+    jit_reorder_conf_t jrp;
+
+    explicit jit_uni_reorder_kernel(jit_reorder_conf_t jrp) : ker_(nullptr), jrp(jrp) {}
+    virtual ~jit_uni_reorder_kernel() {}
+};
+
 class MKLDNNReorderNode : public MKLDNNNode {
 public:
     MKLDNNReorderNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket);
@@ -38,6 +74,12 @@ public:
     const InferenceEngine::TensorDesc& getInput() { return input; }
     const InferenceEngine::TensorDesc& getOutput() { return output; }
 
+    /**
+     * @brief Whether the reorder runs on the reference code of MKLDNN, i.e. neither MKLDNN nor the plugin have
+     * a JIT kernel for the pair of the formats and the precisions
+     */
+    bool isReference() const;
+
     /**
      * @brief A pointer to a scales blob
      */
@@ -50,7 +92,12 @@ private:
     MKLDNNMemoryPtr dst_blocked;
     MKLDNNMemoryPtr src_blocked;
 
+    std::shared_ptr<jit_uni_reorder_kernel> reorder_kernel;
+    std::vector<float> scales;
+
     void createReorderPrimitive(const mkldnn::memory::desc &srcDesc, void* srcPtr, const mkldnn::memory::desc &dstDesc, void* dstPtr);
+    bool createReorderKernel(const mkldnn::primitive_attr &attr);
+    void executeReorderKernel();
 };
 
 }  // namespace MKLDNNPlugin
@@ -83,8 +83,8 @@ void MKLDNNSoftMaxNode::createPrimitive() {
         itpd++;
     }
 
-    prim.reset(new softmax_forward(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
-                                getChildEdgeAt(0)->getMemory().GetPrimitive()));
+    createCachedPrimitive<softmax_forward>(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                                        getChildEdgeAt(0)->getMemory().GetPrimitive());
 }
 
 bool MKLDNNSoftMaxNode::created() const {
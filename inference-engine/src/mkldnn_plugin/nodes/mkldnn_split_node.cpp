@@ -116,7 +116,9 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
     }
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, outFormats);
 
-    if ((numOfDim != 4 && numOfDim != 5) || axis != 1)
+    // The outputs are views on the blocked input along any axis: the channel blocks stay whole if the channels
+    // of every output are aligned to the block, the other axes split the input between the blocks.
+    if (numOfDim != 4 && numOfDim != 5)
         return;
 
     order.push_back(1);
@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <ie_memcpy.h>
@@ -49,10 +50,38 @@ static LayerConfig make_plain_config(const CNNLayerPtr &layer) {
     return config;
 }
 
+/* Checks that two descriptors address all elements in the same way, so one buffer can be read through another.
+ * Strides of dimensions equal to 1 do not matter, that allows to match a slice of a plain tensor with a dense one. */
+static bool isSameView(const mkldnn::memory::desc &lhs, const mkldnn::memory::desc &rhs) {
+    const auto &l = lhs.data, &r = rhs.data;
+    if (l.ndims != r.ndims || l.data_type != r.data_type || l.format == mkldnn_format_undef ||
+            r.format == mkldnn_format_undef || l.layout_desc.blocking.offset_padding != r.layout_desc.blocking.offset_padding)
+        return false;
+
+    for (int i = 0; i < l.ndims; i++) {
+        const auto &lb = l.layout_desc.blocking, &rb = r.layout_desc.blocking;
+        if (l.dims[i] != r.dims[i] || lb.block_dims[i] != 1 || rb.block_dims[i] != 1 ||
+                lb.padding_dims[i] != l.dims[i] || rb.padding_dims[i] != r.dims[i])
+            return false;
+        if (l.dims[i] != 1 && lb.strides[0][i] != rb.strides[0][i])
+            return false;
+    }
+    return true;
+}
+
+static void setDataHandle(std::vector<mkldnn::memory> &mems, void *ptr) {
+    for (auto &mem : mems)
+        mem.set_data_handle(ptr);
+}
+
+/* Maps a tensor of the TensorIterator (full) to a tensor of the body (part).
+ * If the body tensor can be moved (see getMovableAliases) and the slice has the same layout, the body
+ * reads and writes the outer tensor directly, otherwise the data is copied by reorders. */
 class PortIteratorHelper : public PortMapHelper {
 public:
-    PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to,
-            bool as_input, const TensorIterator::PortMap &port_map, const mkldnn::engine& eng, int n_iter) : as_input(as_input) {
+    PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool as_input,
+            const TensorIterator::PortMap &port_map, const mkldnn::engine& eng, int n_iter,
+            const std::vector<mkldnn::memory> &part_aliases) : as_input(as_input) {
         const auto &full_blob = as_input ? from : to;
         const auto &part_blob = !as_input ? from : to;
 
@@ -62,11 +91,16 @@ public:
         auto full_dims = full_blob->GetDims();
         auto part_dims = part_blob->GetDims();
 
-        bool simple_copy = port_map.axis == -1;
+        mem_holder.push_back(full_blob->GetPrimitive());
+        iter_count = n_iter;
+
         if (port_map.axis == -1) {
             // simple copy mode. No iteration through this tensor
-            reorders.emplace_back(from->GetPrimitive(), to->GetPrimitive());
-            iter_count = n_iter;
+            if (!part_aliases.empty() && isSameView(full_blob->GetDescriptor(), part_blob->GetDescriptor())) {
+                aliases = part_aliases;
+            } else {
+                reorders.emplace_back(from->GetPrimitive(), to->GetPrimitive());
+            }
         } else {
             auto abs_stride = std::abs(stride);
             auto sign_of_stride = stride < 0.0f ? -1 : 1;
@@ -76,26 +110,25 @@ public:
             full_dims[axis] = abs_stride;
             IE_ASSERT(full_dims == part_dims) << "Shape mismatch for tensor iterator port";
 
-            iter_count = n_iter;
-
             // make chunk view
             auto chunk_desc =  full_blob->GetDescriptor();
-            chunk_desc.data.dims[axis] = 1;
-            chunk_desc.data.layout_desc.blocking.padding_dims[axis] = 1;  // TODO: asamption that plain tensor
+            chunk_desc.data.dims[axis] = abs_stride;
+            chunk_desc.data.layout_desc.blocking.padding_dims[axis] = abs_stride;  // TODO: asamption that plain tensor
 
-            mem_holder.push_back(full_blob->GetPrimitive());
             auto full_mem_handler = full_blob->GetPrimitive().get_data_handle();
             mem_holder.emplace_back(mkldnn::memory::primitive_desc(chunk_desc, eng), full_mem_handler);
             auto &chunk_mem_prim = mem_holder.back();
 
             auto elem_size = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(chunk_desc.data.data_type));
 
-            // TODO: only stride 1
-            chunk_stride_in_byte = chunk_desc.data.layout_desc.blocking.strides[0][axis] * elem_size;
+            // a partially unrolled body takes several slices at once
+            chunk_stride_in_byte = chunk_desc.data.layout_desc.blocking.strides[0][axis] * elem_size * abs_stride;
             chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
             chunk_stride_in_byte *= sign_of_stride;
 
-            if (as_input) {
+            if (!part_aliases.empty() && isSameView(chunk_desc, part_blob->GetDescriptor())) {
+                aliases = part_aliases;
+            } else if (as_input) {
                 reorders.emplace_back(chunk_mem_prim, to->GetPrimitive());
             } else {
                 reorders.emplace_back(from->GetPrimitive(), chunk_mem_prim);
@@ -103,15 +136,28 @@ public:
         }
     }
 
+    /* In this mode the mapper has to be executed before the iteration, even for output ports. */
+    bool isZeroCopy() const {
+        return !aliases.empty();
+    }
+
     void execute(int n_iter, mkldnn::stream strm) override {
-        if (chunk_stride_in_byte != 0) {
+        // the outer tensor may be moved between inferences, so its address is taken every time
+        auto full_ptr = static_cast<uint8_t *>(mem_holder[FULL_DATA].get_data_handle());
+
+        if (isZeroCopy()) {
+            if (chunk_stride_in_byte != 0) {
+                IE_ASSERT(n_iter < iter_count);
+                setDataHandle(aliases, full_ptr + chunk_offset_in_byte + chunk_stride_in_byte * n_iter);
+            } else if (n_iter == 0) {
+                setDataHandle(aliases, full_ptr);
+            }
+        } else if (chunk_stride_in_byte != 0) {
             IE_ASSERT(n_iter < iter_count);
 
-            auto full_mem = mem_holder[FULL_DATA];
             auto chunk_mem = mem_holder[CHUNK_DATA];
 
-            chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
-                    chunk_offset_in_byte + chunk_stride_in_byte * n_iter);
+            chunk_mem.set_data_handle(full_ptr + chunk_offset_in_byte + chunk_stride_in_byte * n_iter);
 
             strm.submit({reorders.begin(), reorders.end()});
         } else {
@@ -124,30 +170,55 @@ private:
     bool as_input;
     ptrdiff_t chunk_stride_in_byte = 0;
     ptrdiff_t chunk_offset_in_byte = 0;
+    std::vector<mkldnn::memory> aliases;
 
     const int FULL_DATA = 0;
     const int CHUNK_DATA = 1;
 };
 
+/* Passes the body output to the body input of the next iteration.
+ * If both tensors can be moved and have the same layout, their buffers are swapped instead of copying. */
 class BackEdgePortHelper : public PortMapHelper {
 public:
-    BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng, int n_iter) {
-        auto mem_desc =  from->GetDescriptor();
-
-
-        mem_holder.emplace_back(mkldnn::memory::primitive_desc(mem_desc, eng));
-        auto &temp_mem = mem_holder.back();
-
-        reorders.emplace_back(from->GetPrimitive(), to->GetPrimitive());
+    BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng, int n_iter,
+            const std::vector<mkldnn::memory> &from_aliases, const std::vector<mkldnn::memory> &to_aliases) {
+        if (!from_aliases.empty() && !to_aliases.empty() &&
+                isSameView(from->GetDescriptor(), to->GetDescriptor())) {
+            from_mems = from_aliases;
+            to_mems = to_aliases;
+            from_ptr = from->GetData();
+            to_ptr = to->GetData();
+        } else {
+            reorders.emplace_back(from->GetPrimitive(), to->GetPrimitive());
+        }
 
         iter_count = n_iter;
     }
 
+    void reset() override {
+        if (!from_mems.empty()) {
+            setDataHandle(from_mems, from_ptr);
+            setDataHandle(to_mems, to_ptr);
+        }
+    }
+
     void execute(int n_iter, mkldnn::stream strm) override {
         if (n_iter < iter_count - 1) {
-            strm.submit({reorders.begin(), reorders.end()});
+            if (!from_mems.empty()) {
+                // the input of the finished iteration is not needed anymore and becomes the next output
+                void *output = from_mems[0].get_data_handle();
+                setDataHandle(from_mems, to_mems[0].get_data_handle());
+                setDataHandle(to_mems, output);
+            } else {
+                strm.submit({reorders.begin(), reorders.end()});
+            }
         }
     };
+
+private:
+    std::vector<mkldnn::memory> from_mems, to_mems;
+    void *from_ptr = nullptr;
+    void *to_ptr = nullptr;
 };
 
 }  // namespace MKLDNNPlugin
@@ -162,6 +233,8 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
 
     n_iter = getNumIteration(*ti);
     MKLDNNGraph::ApplyUnrollPasses(ti->body);
+    // body inputs and outputs get own buffers, so they can be bound to outer tensors or swapped
+    sub_graph.reuse_io_tensors = false;
     sub_graph.CreateGraph(ti->body, ext_mng, this->whichSocket());
 
     // Try to detect inputs and outputs by indexes
@@ -197,17 +270,80 @@ void MKLDNNTensorIteratorNode::initSupportedPrimitiveDescriptors() {
 }
 
 
+std::vector<mkldnn::memory> MKLDNNTensorIteratorNode::getMovableAliases(const MKLDNNMemoryPtr &mem) {
+    const void *data = mem->GetData();
+
+    // All edges of a body input or output cluster point to the same data, other tensors never
+    // overlap with it since the body graph doesn't reuse I/O tensors.
+    std::vector<mkldnn::memory> aliases;
+    MKLDNNNodePtr producer;
+    for (auto &edge : sub_graph.graphEdges) {
+        if (edge->getMemoryPtr()->GetData() != data)
+            continue;
+
+        auto parent = edge->getParent();
+        auto child = edge->getChild();
+        if (producer && producer != parent)
+            return {};
+        // in-place nodes access the same data through views with offsets
+        if (parent->isConstant() || parent->isInplace() || child->isInplace())
+            return {};
+        producer = parent;
+        aliases.push_back(edge->getMemoryPtr()->GetPrimitive());
+    }
+    return aliases;
+}
+
 void MKLDNNTensorIteratorNode::createPrimitive() {
     auto ti = dynamic_cast<class TensorIterator*>(getCnnLayer().get());
     if (ti == nullptr)
         THROW_IE_EXCEPTION << "Cannot convert to TensorIterator layer.";
 
+    // every body tensor can be moved by a single mapper only
+    std::set<const MKLDNNMemory*> moved;
+    auto getAliases = [&](const MKLDNNMemoryPtr &mem) {
+        if (moved.count(mem.get()))
+            return std::vector<mkldnn::memory>();
+        auto aliases = getMovableAliases(mem);
+        if (!aliases.empty())
+            moved.insert(mem.get());
+        return aliases;
+    };
+
+    // back edges are resolved first, since their tensors are moved on every iteration.
+    // A tensor shared by several back edges is copied, since a swap would change it for the others.
+    std::map<const MKLDNNMemory*, int> back_edge_uses;
+    for (auto map_rule : ti->back_edges) {
+        back_edge_uses[output_mem[map_rule.from].get()]++;
+        back_edge_uses[input_mem[map_rule.to].get()]++;
+    }
+
+    std::vector<std::shared_ptr<PortMapHelper>> back_edge_mappers;
+    for (auto map_rule : ti->back_edges) {
+        auto from_mem = output_mem[map_rule.from];
+        auto to_mem = input_mem[map_rule.to];
+
+        std::vector<mkldnn::memory> from_aliases, to_aliases;
+        if (back_edge_uses[from_mem.get()] == 1 && back_edge_uses[to_mem.get()] == 1) {
+            from_aliases = getMovableAliases(from_mem);
+            to_aliases = getMovableAliases(to_mem);
+        }
+        // tensors of back edges are never bound to outer ones, even if they are copied
+        moved.insert(from_mem.get());
+        moved.insert(to_mem.get());
+
+        auto mapper = std::shared_ptr<PortMapHelper>(
+                new BackEdgePortHelper(from_mem, to_mem, getEngine(), n_iter, from_aliases, to_aliases));
+
+        back_edge_mappers.push_back(mapper);
+    }
+
     for (auto map_rule : ti->input_port_map) {
         auto &extr_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &intr_mem = input_mem[map_rule.to];
 
         auto mapper = std::shared_ptr<PortMapHelper>(
-                new PortIteratorHelper (extr_mem, intr_mem, true, map_rule, getEngine(), n_iter));
+                new PortIteratorHelper (extr_mem, intr_mem, true, map_rule, getEngine(), n_iter, getAliases(intr_mem)));
 
         in_port_mappers.push_back(mapper);
     }
@@ -216,26 +352,25 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         auto &extr_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &intr_mem = output_mem[map_rule.to];
 
-        auto mapper = std::shared_ptr<PortMapHelper>(
-                new PortIteratorHelper (intr_mem, extr_mem, false, map_rule, getEngine(), n_iter));
+        auto mapper = std::make_shared<PortIteratorHelper>(
+                intr_mem, extr_mem, false, map_rule, getEngine(), n_iter, getAliases(intr_mem));
 
-        out_port_mappers.push_back(mapper);
+        // body output has to be redirected to the outer tensor before the iteration
+        if (mapper->isZeroCopy())
+            in_port_mappers.push_back(mapper);
+        else
+            out_port_mappers.push_back(mapper);
     }
 
-    for (auto map_rule : ti->back_edges) {
-        auto from_mem = output_mem[map_rule.from];
-        auto to_mem = input_mem[map_rule.to];
-
-        auto mapper = std::shared_ptr<PortMapHelper>(
-                new BackEdgePortHelper(from_mem, to_mem, getEngine(), n_iter));
-
-        out_port_mappers.push_back(mapper);
-    }
+    out_port_mappers.insert(out_port_mappers.end(), back_edge_mappers.begin(), back_edge_mappers.end());
 }
 
 void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
     sub_graph.ResetInferCount();
 
+    for (auto &mapper : out_port_mappers)
+        mapper->reset();
+
     for (int i = 0; i < n_iter; i++) {
         // copy data to subgraph iteration
         for (auto &mapper : in_port_mappers)
@@ -17,6 +17,8 @@ class PortMapHelper {
 public:
     virtual ~PortMapHelper() = default;
     virtual void execute(int n_iter, mkldnn::stream strm) = 0;
+    // called once before the first iteration of every inference
+    virtual void reset() {}
 protected:
     std::vector<mkldnn::reorder> reorders;
     std::vector<mkldnn::memory> mem_holder;
@@ -36,12 +38,17 @@ public:
 
     void setExtManager(const MKLDNNExtensionManager::Ptr& extMgr) { ext_mng = extMgr; }
 private:
+    /* Returns memory primitives of all body edges which share the data with mem, so they all can be
+     * redirected to another buffer at once. Empty if the data is also accessed through in-place views. */
+    std::vector<mkldnn::memory> getMovableAliases(const MKLDNNMemoryPtr &mem);
+
     int n_iter = 0;
 
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
 
+    // mappers executed before and after every iteration of the body
     std::vector<std::shared_ptr<PortMapHelper>> in_port_mappers, out_port_mappers;
 };
 
@@ -12,11 +12,15 @@
 #include <algorithm>
 #include <utility>
 #include "ie_parallel.hpp"
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+template <mkldnn::impl::cpu::cpu_isa_t T>
 class NonMaxSuppressionImpl: public ExtLayerBase {
 public:
     explicit NonMaxSuppressionImpl(const CNNLayer* layer) {
@@ -94,39 +98,26 @@ public:
         }
     }
 
-    static float intersectionOverUnion(float* boxesI, float* boxesJ, bool center_point_box) {
-        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
+    struct Box {
+        float ymin, xmin, ymax, xmax;
+    };
+
+    static Box getBox(const float* box, bool center_point_box) {
+        Box result;
         if (center_point_box) {
             //  box format: x_center, y_center, width, height
-            yminI = boxesI[1] - boxesI[3] / 2.f;
-            xminI = boxesI[0] - boxesI[2] / 2.f;
-            ymaxI = boxesI[1] + boxesI[3] / 2.f;
-            xmaxI = boxesI[0] + boxesI[2] / 2.f;
-            yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-            xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-            ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-            xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
+            result.ymin = box[1] - box[3] / 2.f;
+            result.xmin = box[0] - box[2] / 2.f;
+            result.ymax = box[1] + box[3] / 2.f;
+            result.xmax = box[0] + box[2] / 2.f;
         } else {
             //  box format: y1, x1, y2, x2
-            yminI = (std::min)(boxesI[0], boxesI[2]);
-            xminI = (std::min)(boxesI[1], boxesI[3]);
-            ymaxI = (std::max)(boxesI[0], boxesI[2]);
-            xmaxI = (std::max)(boxesI[1], boxesI[3]);
-            yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-            xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-            ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-            xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
+            result.ymin = (std::min)(box[0], box[2]);
+            result.xmin = (std::min)(box[1], box[3]);
+            result.ymax = (std::max)(box[0], box[2]);
+            result.xmax = (std::max)(box[1], box[3]);
         }
-
-        float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-        float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
-        if (areaI <= 0.f || areaJ <= 0.f)
-            return 0.f;
-
-        float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
-        return intersection_area / (areaI + areaJ - intersection_area);
+        return result;
     }
 
     typedef struct {
@@ -170,44 +161,60 @@ public:
         // scores shape: {num_batches, num_classes, num_boxes}
         int num_batches = static_cast<int>(scores_dims[0]);
         int num_classes = static_cast<int>(scores_dims[1]);
-        std::vector<filteredBoxes> fb;
 
-        for (int batch = 0; batch < num_batches; batch++) {
-            float *boxesPtr = boxes + batch * boxesStrides[0];
-            for (int class_idx = 0; class_idx < num_classes; class_idx++) {
-                float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
-                std::vector<std::pair<float, int> > scores_vector;
-                for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                    if (scoresPtr[box_idx] > score_threshold)
-                        scores_vector.push_back(std::make_pair(scoresPtr[box_idx], box_idx));
+        // corners are computed once per box instead of once per compared pair
+        std::vector<Box> batchBoxes(static_cast<size_t>(num_batches) * num_boxes);
+        parallel_for2d(num_batches, num_boxes, [&](int batch, int box_idx) {
+            batchBoxes[batch * num_boxes + box_idx] = getBox(boxes + batch * boxesStrides[0] + box_idx * 4, center_point_box);
+        });
+
+        // (batch, class) pairs are independent, their results are concatenated in the same order as before;
+        // the number of the candidates differs a lot between the classes, so the pairs are taken dynamically
+        std::vector<std::vector<filteredBoxes>> classResults(static_cast<size_t>(num_batches) * num_classes);
+        parallel_for2d_dynamic(num_batches, num_classes, 1, [&](int batch, int class_idx) {
+            const Box* boxesPtr = &batchBoxes[batch * num_boxes];
+            const float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
+            std::vector<filteredBoxes>& result = classResults[batch * num_classes + class_idx];
+
+            std::vector<std::pair<float, int> > scores_vector;
+            for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
+                if (scoresPtr[box_idx] > score_threshold)
+                    scores_vector.push_back(std::make_pair(scoresPtr[box_idx], box_idx));
+            }
+            if (scores_vector.empty())
+                return;
+
+            // ties are broken by box index, so the order does not depend on the sort implementation
+            auto greater = [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                return l.first > r.first || (l.first == r.first && l.second < r.second);
+            };
+
+            // usually only a few of the best candidates are visited before max_output_boxes_per_class boxes
+            // are selected, so candidates are sorted by growing chunks instead of sorting all of them at once
+            size_t sorted = 0;
+            size_t chunk = (std::max)(static_cast<size_t>(max_output_boxes_per_class) * 2, static_cast<size_t>(64));
+            KeptBoxes selected;
+            // the best box is always selected
+            for (size_t candidate = 0; candidate < scores_vector.size() && (selected.size() == 0 ||
+                    static_cast<int>(selected.size()) < max_output_boxes_per_class); candidate++) {
+                if (candidate == sorted) {
+                    sorted = (std::min)(scores_vector.size(), sorted + chunk);
+                    std::partial_sort(scores_vector.begin() + candidate, scores_vector.begin() + sorted, scores_vector.end(), greater);
+                    chunk *= 2;
                 }
 
-                if (scores_vector.size()) {
-                    parallel_sort(scores_vector.begin(), scores_vector.end(),
-                        [](const std::pair<float, int>& l, const std::pair<float, int>& r) { return l.first > r.first; });
-
-                    int io_selection_size = 1;
-                    fb.push_back({ scores_vector[0].first, batch, class_idx, scores_vector[0].second });
-                    for (int box_idx = 1; (box_idx < static_cast<int>(scores_vector.size()) && io_selection_size < max_output_boxes_per_class); box_idx++) {
-                        bool box_is_selected = true;
-                        for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[scores_vector[box_idx].second * 4],
-                                             &boxesPtr[scores_vector[idx].second * 4], center_point_box);
-                            if (iou > iou_threshold) {
-                                box_is_selected = false;
-                                break;
-                            }
-                        }
-
-                        if (box_is_selected) {
-                            scores_vector[io_selection_size] = scores_vector[box_idx];
-                            io_selection_size++;
-                            fb.push_back({ scores_vector[box_idx].first, batch, class_idx, scores_vector[box_idx].second });
-                        }
-                    }
-                }
+                const Box& box = boxesPtr[scores_vector[candidate].second];
+                if (selected.overlaps(box.xmin, box.ymin, box.xmax, box.ymax, iou_threshold))
+                    continue;
+
+                selected.push(box.xmin, box.ymin, box.xmax, box.ymax);
+                result.push_back({ scores_vector[candidate].first, batch, class_idx, scores_vector[candidate].second });
             }
-        }
+        });
+
+        std::vector<filteredBoxes> fb;
+        for (const auto& result : classResults)
+            fb.insert(fb.end(), result.begin(), result.end());
 
         if (sort_result_descending) {
             parallel_sort(fb.begin(), fb.end(), [](const filteredBoxes& l, const filteredBoxes& r) { return l.score > r.score; });
@@ -242,7 +249,15 @@ private:
     bool sort_result_descending = true;
 };
 
-REG_FACTORY_FOR(ImplFactory<NonMaxSuppressionImpl>, NonMaxSuppression);
+#ifdef HAVE_AVX512F
+REG_FACTORY_FOR_TYPE(avx512_common, ImplFactory<NonMaxSuppressionImpl<mkldnn::impl::cpu::cpu_isa_t::avx512_common>>, NonMaxSuppression);
+#elif defined HAVE_AVX2
+REG_FACTORY_FOR_TYPE(avx2, ImplFactory<NonMaxSuppressionImpl<mkldnn::impl::cpu::cpu_isa_t::avx2>>, NonMaxSuppression);
+#elif defined HAVE_SSE
+REG_FACTORY_FOR_TYPE(sse42, ImplFactory<NonMaxSuppressionImpl<mkldnn::impl::cpu::cpu_isa_t::sse42>>, NonMaxSuppression);
+#else
+REG_FACTORY_FOR_TYPE(isa_any, ImplFactory<NonMaxSuppressionImpl<mkldnn::impl::cpu::cpu_isa_t::isa_any>>, NonMaxSuppression);
+#endif
 
 }  // namespace Cpu
 }  // namespace Extensions
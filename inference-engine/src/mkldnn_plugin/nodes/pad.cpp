@@ -5,6 +5,7 @@
 #include "list.hpp"
 #include "base.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include <vector>
@@ -62,33 +63,45 @@ public:
                 src_o_dms.push_back(src_dims[i] + pads_begin[i]);
 
             addConfig(layer, { DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
+            if (src_dims.size() > 1 && pads_begin[1] == 0 && pads_end[1] == 0) {
+                const auto blk_layout = getChannelBlockedLayout(layer->insData[0].lock());
+                if (blk_layout != ConfLayout::PLN)
+                    addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
     }
 
+    StatusCode init(LayerConfig& config, ResponseDesc *resp) noexcept override {
+        StatusCode rc = ExtLayerBase::init(config, resp);
+        if (rc != OK)
+            return rc;
+
+        // the blocked tensors are padded as the planar ones of their block dims, the channels are not padded
+        const BlockingDesc& srcBlocking = config.inConfs[0].desc.getBlockingDesc();
+        const BlockingDesc& dstBlocking = config.outConfs[0].desc.getBlockingDesc();
+        if (srcBlocking.getBlockDims().size() > src_dims.size()) {
+            src_dims = srcBlocking.getBlockDims();
+            dst_dims = dstBlocking.getBlockDims();
+            pads_begin.resize(src_dims.size(), 0);
+            srcStrides = srcBlocking.getStrides();
+            dstStrides = dstBlocking.getStrides();
+            work_amount = dst_dims[0] * dstStrides[0];
+            src_o_dms.clear();
+            for (size_t i = 0; i < src_dims.size(); i++)
+                src_o_dms.push_back(src_dims[i] + pads_begin[i]);
+        }
+        return OK;
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const float *src_data = inputs[0]->cbuffer().as<const float *>() +
             inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
         float* dst_data = outputs[0]->cbuffer().as<float *>() +
             outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
-        switch (padMode) {
-            case CONSTANT:
-                pad_constant(src_data, dst_data);
-                break;
-            case EDGE:
-                pad_edge(src_data, dst_data);
-                break;
-            case REFLECT:
-                pad_reflect(src_data, dst_data);
-                break;
-            case SYMMETRIC:
-                pad_symmetric(src_data, dst_data);
-                break;
-            default:
-                return GENERAL_ERROR;
-        }
+        pad_rows(src_data, dst_data);
         return OK;
     }
 
@@ -100,10 +113,9 @@ private:
         SYMMETRIC = 3
     };
 
-    void pad_constant(const float *src_data, float* dst_data);
-    void pad_edge(const float *src_data, float* dst_data);
-    void pad_reflect(const float *src_data, float* dst_data);
-    void pad_symmetric(const float *src_data, float* dst_data);
+    // the source index the index of the output along the dimension i reads, -1 for the constant
+    inline int src_index(size_t i, size_t counter) const;
+    void pad_rows(const float *src_data, float* dst_data);
 
     PadMode padMode = CONSTANT;
     float pad_value = 0.f;
@@ -133,120 +145,73 @@ inline void parallel_step(size_t size, std::vector<size_t> &counters, std::vecto
     }
 }
 
-void PadImpl::pad_constant(const float *src_data, float* dst_data) {
-    int offset = 0;
-    for (size_t i = 0; i < srcStrides.size(); ++i)
-        offset += pads_begin[i] * srcStrides[i];
-
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        size_t start = 0, end = 0;
-        SizeVector counters(dst_dims.size(), 0);
-        splitter(work_amount, nthr, ithr, start, end);
-
-        parallel_init(start, dst_dims.size(), counters, dst_dims);
-        for (size_t iwork = start; iwork < end; ++iwork) {
-            int srcIdx = 1;
-            int dstIdx = 0;
-            for (size_t i = 0; i < dstStrides.size(); ++i)
-                dstIdx += counters[i] * dstStrides[i];
-
-            for (size_t i = 0; i < counters.size(); ++i) {
-                if (counters[i] < pads_begin[i] || counters[i] >= src_o_dms[i]) {
-                    dst_data[dstIdx] = pad_value;
-                    srcIdx = 0;
-                    break;
-                }
-            }
-            if (srcIdx) {
-                int srcIdx = 0;
-                for (size_t i = 0; i < srcStrides.size(); ++i)
-                    srcIdx += counters[i] * srcStrides[i];
-                dst_data[dstIdx] = src_data[srcIdx - offset];
-            }
-            parallel_step(dst_dims.size(), counters, dst_dims);
-        }
-    });
-}
-
-void PadImpl::pad_edge(const float *src_data, float* dst_data) {
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        size_t start = 0, end = 0;
-        SizeVector counters(dst_dims.size(), 0);
-        splitter(work_amount, nthr, ithr, start, end);
-
-        parallel_init(start, dst_dims.size(), counters, dst_dims);
-        for (size_t iwork = start; iwork < end; ++iwork) {
-            int srcIdx = 0;
-            int dstIdx = 0;
-            for (size_t i = 0; i < dstStrides.size(); ++i)
-                dstIdx += counters[i] * dstStrides[i];
-
-            for (size_t i = 0; i < srcStrides.size(); ++i) {
-                int idx = (counters[i] < pads_begin[i]) ? 0 :
-                    ((counters[i] >= src_o_dms[i]) ? (src_dims[i] - 1) : (counters[i] - pads_begin[i]));
-                srcIdx += idx * srcStrides[i];
-            }
-
-            dst_data[dstIdx] = src_data[srcIdx];
-            parallel_step(dst_dims.size(), counters, dst_dims);
-        }
-    });
+inline int PadImpl::src_index(size_t i, size_t counter) const {
+    const size_t begin = pads_begin[i];
+    if (counter >= begin && counter < src_o_dms[i])
+        return static_cast<int>(counter - begin);
+
+    switch (padMode) {
+        case EDGE:
+            return counter < begin ? 0 : static_cast<int>(src_dims[i] - 1);
+        case REFLECT:
+            return counter < begin ? static_cast<int>(begin - counter) :
+                   static_cast<int>(src_dims[i] + src_o_dms[i] - 2 - counter);
+        case SYMMETRIC:
+            return counter < begin ? static_cast<int>(begin - 1 - counter) :
+                   static_cast<int>(src_dims[i] + src_o_dms[i] - 1 - counter);
+        default:
+            return -1;
+    }
 }
 
-void PadImpl::pad_reflect(const float *src_data, float* dst_data) {
-    SizeVector src_2;
-    for (size_t i = 0; i < src_dims.size(); i++)
-        src_2.push_back(src_dims[i] + src_o_dms[i] - 2);
+void PadImpl::pad_rows(const float *src_data, float* dst_data) {
+    // the output is processed by the rows of its innermost dimension, which is dense in both tensors: the points read
+    // from the source row are copied at once and only the padding of the row is computed point by point
+    const size_t outer = dst_dims.size() - 1;
+    SizeVector rows_dims(dst_dims.begin(), dst_dims.begin() + outer);
+    const size_t row = dst_dims[outer];
+    const size_t src_row = src_dims[outer];
+    const size_t begin = pads_begin[outer];
+    if (row == 0)
+        return;
+    const size_t rows = work_amount / row;
 
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start = 0, end = 0;
-        SizeVector counters(dst_dims.size(), 0);
-        splitter(work_amount, nthr, ithr, start, end);
-
-        parallel_init(start, dst_dims.size(), counters, dst_dims);
-        for (size_t iwork = start; iwork < end; ++iwork) {
-            int srcIdx = 0;
-            int dstIdx = 0;
-            for (size_t i = 0; i < dstStrides.size(); ++i)
+        SizeVector counters(rows_dims.size(), 0);
+        splitter(rows, nthr, ithr, start, end);
+
+        parallel_init(start, rows_dims.size(), counters, rows_dims);
+        for (size_t irow = start; irow < end; ++irow) {
+            size_t dstIdx = 0;
+            size_t srcIdx = 0;
+            bool is_constant = false;
+            for (size_t i = 0; i < outer; ++i) {
                 dstIdx += counters[i] * dstStrides[i];
-
-            for (size_t i = 0; i < srcStrides.size(); ++i) {
-                int idx = (counters[i] < pads_begin[i]) ? (pads_begin[i] - counters[i]) :
-                    ((counters[i] >= src_o_dms[i]) ? (src_2[i] - counters[i]) : (counters[i] - pads_begin[i]));
-                srcIdx += idx * srcStrides[i];
+                const int idx = src_index(i, counters[i]);
+                if (idx < 0) {
+                    is_constant = true;
+                } else {
+                    srcIdx += idx * srcStrides[i];
+                }
             }
 
-            dst_data[dstIdx] = src_data[srcIdx];
-            parallel_step(dst_dims.size(), counters, dst_dims);
-        }
-    });
-}
-
-void PadImpl::pad_symmetric(const float *src_data, float* dst_data) {
-    SizeVector src_2;
-    for (size_t i = 0; i < src_dims.size(); i++)
-        src_2.push_back(src_dims[i] + src_o_dms[i] - 1);
-
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        size_t start = 0, end = 0;
-        SizeVector counters(dst_dims.size(), 0);
-        splitter(work_amount, nthr, ithr, start, end);
-
-        parallel_init(start, dst_dims.size(), counters, dst_dims);
-        for (size_t iwork = start; iwork < end; ++iwork) {
-            int srcIdx = 0;
-            int dstIdx = 0;
-            for (size_t i = 0; i < dstStrides.size(); ++i)
-                dstIdx += counters[i] * dstStrides[i];
-
-            for (size_t i = 0; i < srcStrides.size(); ++i) {
-                int idx = (counters[i] < pads_begin[i]) ? (pads_begin[i] - 1 - counters[i]) :
-                    ((counters[i] >= src_o_dms[i]) ? (src_2[i] - counters[i]) : (counters[i] - pads_begin[i]));
-                srcIdx += idx * srcStrides[i];
+            float* dst_row = dst_data + dstIdx;
+            if (is_constant) {
+                std::fill_n(dst_row, row, pad_value);
+            } else {
+                const float* src_row_data = src_data + srcIdx;
+                for (size_t j = 0; j < begin; ++j) {
+                    const int idx = src_index(outer, j);
+                    dst_row[j] = idx < 0 ? pad_value : src_row_data[idx];
+                }
+                std::copy_n(src_row_data, src_row, dst_row + begin);
+                for (size_t j = begin + src_row; j < row; ++j) {
+                    const int idx = src_index(outer, j);
+                    dst_row[j] = idx < 0 ? pad_value : src_row_data[idx];
+                }
             }
-
-            dst_data[dstIdx] = src_data[srcIdx];
-            parallel_step(dst_dims.size(), counters, dst_dims);
+            parallel_step(rows_dims.size(), counters, rows_dims);
         }
     });
 }
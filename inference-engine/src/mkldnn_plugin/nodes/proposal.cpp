@@ -10,9 +10,6 @@
 #include <vector>
 #include <utility>
 #include <algorithm>
-#if defined(HAVE_AVX2)
-#include <immintrin.h>
-#endif
 #include "ie_parallel.hpp"
 
 namespace InferenceEngine {
@@ -174,130 +171,6 @@ static void unpack_boxes(const float* p_proposals, float* unpacked_boxes, int pr
     }
 }
 
-static
-void nms_cpu(const int num_boxes, int is_dead[],
-             const float* boxes, int index_out[], int* const num_out,
-             const int base_index, const float nms_thresh, const int max_num_out,
-             float coordinates_offset) {
-    const int num_proposals = num_boxes;
-    int count = 0;
-
-    const float* x0 = boxes + 0 * num_proposals;
-    const float* y0 = boxes + 1 * num_proposals;
-    const float* x1 = boxes + 2 * num_proposals;
-    const float* y1 = boxes + 3 * num_proposals;
-
-    memset(is_dead, 0, num_boxes * sizeof(int));
-
-#if defined(HAVE_AVX2)
-    __m256  vc_fone = _mm256_set1_ps(coordinates_offset);
-    __m256i vc_ione = _mm256_set1_epi32(1);
-    __m256  vc_zero = _mm256_set1_ps(0.0f);
-
-    __m256 vc_nms_thresh = _mm256_set1_ps(nms_thresh);
-#endif
-
-    for (int box = 0; box < num_boxes; ++box) {
-        if (is_dead[box])
-            continue;
-
-        index_out[count++] = base_index + box;
-        if (count == max_num_out)
-            break;
-
-        int tail = box + 1;
-
-#if defined(HAVE_AVX2)
-        __m256 vx0i = _mm256_set1_ps(x0[box]);
-        __m256 vy0i = _mm256_set1_ps(y0[box]);
-        __m256 vx1i = _mm256_set1_ps(x1[box]);
-        __m256 vy1i = _mm256_set1_ps(y1[box]);
-
-        __m256 vA_width  = _mm256_sub_ps(vx1i, vx0i);
-        __m256 vA_height = _mm256_sub_ps(vy1i, vy0i);
-        __m256 vA_area   = _mm256_mul_ps(_mm256_add_ps(vA_width, vc_fone), _mm256_add_ps(vA_height, vc_fone));
-
-        for (; tail <= num_boxes - 8; tail += 8) {
-            __m256i *pdst = reinterpret_cast<__m256i*>(is_dead + tail);
-            __m256i  vdst = _mm256_loadu_si256(pdst);
-
-            __m256 vx0j = _mm256_loadu_ps(x0 + tail);
-            __m256 vy0j = _mm256_loadu_ps(y0 + tail);
-            __m256 vx1j = _mm256_loadu_ps(x1 + tail);
-            __m256 vy1j = _mm256_loadu_ps(y1 + tail);
-
-            __m256 vx0 = _mm256_max_ps(vx0i, vx0j);
-            __m256 vy0 = _mm256_max_ps(vy0i, vy0j);
-            __m256 vx1 = _mm256_min_ps(vx1i, vx1j);
-            __m256 vy1 = _mm256_min_ps(vy1i, vy1j);
-
-            __m256 vwidth  = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), vc_fone);
-            __m256 vheight = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), vc_fone);
-            __m256 varea = _mm256_mul_ps(_mm256_max_ps(vc_zero, vwidth), _mm256_max_ps(vc_zero, vheight));
-
-            __m256 vB_width  = _mm256_sub_ps(vx1j, vx0j);
-            __m256 vB_height = _mm256_sub_ps(vy1j, vy0j);
-            __m256 vB_area   = _mm256_mul_ps(_mm256_add_ps(vB_width, vc_fone), _mm256_add_ps(vB_height, vc_fone));
-
-            __m256 vdivisor = _mm256_sub_ps(_mm256_add_ps(vA_area, vB_area), varea);
-            __m256 vintersection_area = _mm256_div_ps(varea, vdivisor);
-
-            __m256 vcmp_0 = _mm256_cmp_ps(vx0i, vx1j, _CMP_LE_OS);
-            __m256 vcmp_1 = _mm256_cmp_ps(vy0i, vy1j, _CMP_LE_OS);
-            __m256 vcmp_2 = _mm256_cmp_ps(vx0j, vx1i, _CMP_LE_OS);
-            __m256 vcmp_3 = _mm256_cmp_ps(vy0j, vy1i, _CMP_LE_OS);
-            __m256 vcmp_4 = _mm256_cmp_ps(vc_nms_thresh, vintersection_area, _CMP_LT_OS);
-
-            vcmp_0 = _mm256_and_ps(vcmp_0, vcmp_1);
-            vcmp_2 = _mm256_and_ps(vcmp_2, vcmp_3);
-            vcmp_4 = _mm256_and_ps(vcmp_4, vcmp_0);
-            vcmp_4 = _mm256_and_ps(vcmp_4, vcmp_2);
-
-            _mm256_storeu_si256(pdst, _mm256_blendv_epi8(vdst, vc_ione, _mm256_castps_si256(vcmp_4)));
-        }
-#endif
-
-        for (; tail < num_boxes; ++tail) {
-            float res = 0.0f;
-
-            const float x0i = x0[box];
-            const float y0i = y0[box];
-            const float x1i = x1[box];
-            const float y1i = y1[box];
-
-            const float x0j = x0[tail];
-            const float y0j = y0[tail];
-            const float x1j = x1[tail];
-            const float y1j = y1[tail];
-
-            if (x0i <= x1j && y0i <= y1j && x0j <= x1i && y0j <= y1i) {
-                // overlapped region (= box)
-                const float x0 = std::max<float>(x0i, x0j);
-                const float y0 = std::max<float>(y0i, y0j);
-                const float x1 = std::min<float>(x1i, x1j);
-                const float y1 = std::min<float>(y1i, y1j);
-
-                // intersection area
-                const float width  = std::max<float>(0.0f,  x1 - x0 + coordinates_offset);
-                const float height = std::max<float>(0.0f,  y1 - y0 + coordinates_offset);
-                const float area   = width * height;
-
-                // area of A, B
-                const float A_area = (x1i - x0i + coordinates_offset) * (y1i - y0i + coordinates_offset);
-                const float B_area = (x1j - x0j + coordinates_offset) * (y1j - y0j + coordinates_offset);
-
-                // IoU
-                res = area / (A_area + B_area - area);
-            }
-
-            if (nms_thresh < res)
-                is_dead[tail] = 1;
-        }
-    }
-
-    *num_out = count;
-}
-
 static
 void retrieve_rois_cpu(const int num_rois, const int item_index,
                               const int num_proposals,
@@ -396,6 +269,7 @@ public:
             }
             generate_anchors(base_size_, &ratios[0], &scales[0], ratios.size(), scales.size(), &anchors_[0],
                              coordinates_offset, shift_anchors, round_ratios);
+            kept_boxes_.offset = coordinates_offset;
 
             roi_indices_.resize(post_nms_topn_);
 
@@ -463,17 +337,12 @@ public:
             //   num_proposals = num_anchors * H * W
             //   (x1, y1, x2, y2, score) for each proposal
             // NOTE: for bottom, only foreground scores are passed
-            struct ProposalBox {
-                float x0;
-                float y0;
-                float x1;
-                float y1;
-                float score;
-            };
-            std::vector<ProposalBox> proposals_(num_proposals);
+            // the buffers are kept between the calls, they are reallocated only when the input shape grows
+            if (proposals_.size() < static_cast<size_t>(num_proposals))
+                proposals_.resize(num_proposals);
             const int unpacked_boxes_buffer_size = store_prob ? 5 * pre_nms_topn : 4 * pre_nms_topn;
-            std::vector<float> unpacked_boxes(unpacked_boxes_buffer_size);
-            std::vector<int> is_dead(pre_nms_topn);
+            if (unpacked_boxes_.size() < static_cast<size_t>(unpacked_boxes_buffer_size))
+                unpacked_boxes_.resize(unpacked_boxes_buffer_size);
 
             // Execute
             int nn = inputs[0]->getTensorDesc().getDims()[0];
@@ -485,17 +354,21 @@ public:
                                         min_box_H, min_box_W, feat_stride_,
                                         box_coordinate_scale_, box_size_scale_,
                                         coordinates_offset, initial_clip, swap_xy, clip_before_nms);
-                std::partial_sort(proposals_.begin(), proposals_.begin() + pre_nms_topn, proposals_.end(),
-                                  [](const ProposalBox &struct1, const ProposalBox &struct2) {
-                                      return (struct1.score > struct2.score);
-                                  });
-
-                unpack_boxes(reinterpret_cast<float *>(&proposals_[0]), &unpacked_boxes[0], pre_nms_topn, store_prob);
-                nms_cpu(pre_nms_topn, &is_dead[0], &unpacked_boxes[0], &roi_indices_[0], &num_rois, 0, nms_thresh_,
-                        post_nms_topn_, coordinates_offset);
+                // the top-n proposals are selected in linear time and only they are sorted
+                auto greater = [](const ProposalBox &struct1, const ProposalBox &struct2) {
+                    return (struct1.score > struct2.score);
+                };
+                auto proposals_end = proposals_.begin() + num_proposals;
+                auto top_end = proposals_.begin() + pre_nms_topn;
+                if (pre_nms_topn > 0 && top_end != proposals_end)
+                    std::nth_element(proposals_.begin(), top_end - 1, proposals_end, greater);
+                parallel_sort(proposals_.begin(), top_end, greater);
+
+                unpack_boxes(reinterpret_cast<float *>(&proposals_[0]), &unpacked_boxes_[0], pre_nms_topn, store_prob);
+                nms(pre_nms_topn, &unpacked_boxes_[0], &roi_indices_[0], &num_rois, nms_thresh_, post_nms_topn_);
 
                 float* p_probs = store_prob ? p_prob_item + n * post_nms_topn_ : nullptr;
-                retrieve_rois_cpu(num_rois, n, pre_nms_topn, &unpacked_boxes[0], &roi_indices_[0],
+                retrieve_rois_cpu(num_rois, n, pre_nms_topn, &unpacked_boxes_[0], &roi_indices_[0],
                                   p_roi_item + n * post_nms_topn_ * 5,
                                   post_nms_topn_, normalize_, img_H, img_W, clip_after_nms, p_probs);
             }
@@ -511,6 +384,35 @@ public:
     }
 
 private:
+    struct ProposalBox {
+        float x0;
+        float y0;
+        float x1;
+        float y1;
+        float score;
+    };
+
+    void nms(const int num_boxes, const float* boxes, int index_out[], int* const num_out,
+             const float nms_thresh, const int max_num_out) {
+        const float* x0 = boxes + 0 * num_boxes;
+        const float* y0 = boxes + 1 * num_boxes;
+        const float* x1 = boxes + 2 * num_boxes;
+        const float* y1 = boxes + 3 * num_boxes;
+
+        // the boxes are sorted by their scores, so a box is kept if it does not overlap the kept ones
+        int count = 0;
+        kept_boxes_.clear();
+        for (int box = 0; box < num_boxes && count < max_num_out; ++box) {
+            if (kept_boxes_.overlaps(x0[box], y0[box], x1[box], y1[box], nms_thresh))
+                continue;
+
+            kept_boxes_.push(x0[box], y0[box], x1[box], y1[box]);
+            index_out[count++] = box;
+        }
+
+        *num_out = count;
+    }
+
     size_t feat_stride_;
     size_t base_size_;
     size_t min_size_;
@@ -526,6 +428,9 @@ private:
     size_t anchors_shape_0;
     std::vector<float> anchors_;
     std::vector<int> roi_indices_;
+    std::vector<ProposalBox> proposals_;
+    std::vector<float> unpacked_boxes_;
+    KeptBoxes kept_boxes_;
 
     // Framework specific parameters
     float coordinates_offset;
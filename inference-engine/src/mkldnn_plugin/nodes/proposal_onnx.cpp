@@ -295,6 +295,15 @@ public:
             coordinates_offset = 0.0f;
 
             roi_indices_.resize(post_nms_topn_);
+
+            // the proposals and the boxes of the execution are kept in the scratchpad
+            const SizeVector& deltas_dims = layer->insData[INPUT_DELTAS].lock()->getTensorDesc().getDims();
+            const SizeVector& scores_dims = layer->insData[INPUT_SCORES].lock()->getTensorDesc().getDims();
+            if (deltas_dims.size() < 3 || scores_dims.empty())
+                THROW_IE_EXCEPTION << "Incorrect shape of input blobs!";
+            const size_t num_proposals = scores_dims[0] * deltas_dims[1] * deltas_dims[2];
+            const size_t pre_nms_topn = std::min<size_t>(num_proposals, pre_nms_topn_);
+            scratchpadSize = num_proposals * sizeof(ProposalBox) + pre_nms_topn * (5 * sizeof(float) + sizeof(int));
             addConfig(layer,
                       {DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN),
                        DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN)},
@@ -365,16 +374,9 @@ public:
         //   num_proposals = num_anchors * H * W
         //   (x1, y1, x2, y2, score) for each proposal
         // NOTE: for bottom, only foreground scores are passed
-        struct ProposalBox {
-            float x0;
-            float y0;
-            float x1;
-            float y1;
-            float score;
-        };
-        std::vector<ProposalBox> proposals_(num_proposals);
-        std::vector<float> unpacked_boxes(5 * pre_nms_topn);
-        std::vector<int> is_dead(pre_nms_topn);
+        ProposalBox* proposals_ = getScratchpad<ProposalBox>();
+        float* unpacked_boxes = reinterpret_cast<float *>(proposals_ + num_proposals);
+        int* is_dead = reinterpret_cast<int *>(unpacked_boxes + 5 * pre_nms_topn);
 
         // Execute
         int batch_size = 1;  // inputs[INPUT_DELTAS]->getTensorDesc().getDims()[0];
@@ -385,7 +387,7 @@ public:
                            min_box_H, min_box_W,
                            static_cast<const float>(log(1000. / 16.)),
                            1.0f);
-            std::partial_sort(proposals_.begin(), proposals_.begin() + pre_nms_topn, proposals_.end(),
+            std::partial_sort(proposals_, proposals_ + pre_nms_topn, proposals_ + num_proposals,
                               [](const ProposalBox& struct1, const ProposalBox& struct2) {
                                   return (struct1.score > struct2.score);
                               });
@@ -401,6 +403,14 @@ public:
     }
 
 private:
+    struct ProposalBox {
+        float x0;
+        float y0;
+        float x1;
+        float y1;
+        float score;
+    };
+
     float min_size_;
     int pre_nms_topn_;
     int post_nms_topn_;
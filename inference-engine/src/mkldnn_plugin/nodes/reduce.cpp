@@ -11,8 +11,12 @@
 #include <string>
 #include <vector>
 #include <cassert>
+#include <algorithm>
 #include <ie_util_internal.hpp>
 #include "ie_parallel.hpp"
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -141,6 +145,8 @@ public:
         auto compare = getPrecisionMask(inputs[REDUCE_DATA]->getTensorDesc().getPrecision(), outputs[0]->getTensorDesc().getPrecision());
         switch (compare) {
             case getPrecisionMask(Precision::FP32, Precision::FP32):
+                if (reduce_fp32(inputs, outputs, reduced_dims_work_amount, axes_for_reduction))
+                    return OK;
                 return reduce_type<float , float>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims);
             case getPrecisionMask(Precision::I32, Precision::I64):
                 return reduce_type<int32_t , int64_t>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims);
@@ -162,6 +168,76 @@ public:
     }
 
 private:
+#if defined(HAVE_AVX512F)
+    static const int block_size = 16;
+    typedef __m512 vec_type_f;
+#elif defined(HAVE_AVX2)
+    static const int block_size = 8;
+    typedef __m256 vec_type_f;
+#elif defined(HAVE_SSE)
+    static const int block_size = 4;
+    typedef __m128 vec_type_f;
+#endif
+    // the rows of the outer axis reductions are accumulated by the chunks fitting L1 cache
+    static const size_t chunk_size = 1024;
+
+    struct sum_op {
+        static inline float init() { return 0.f; }
+        static inline float apply(float acc, float x) { return acc + x; }
+        static inline float combine(float a, float b) { return a + b; }
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        static inline vec_type_f apply(vec_type_f acc, vec_type_f x) { return _mm_uni_add_ps(acc, x); }
+        static inline vec_type_f combine(vec_type_f a, vec_type_f b) { return _mm_uni_add_ps(a, b); }
+#endif
+    };
+
+    struct sum_square_op : public sum_op {
+        static inline float apply(float acc, float x) { return acc + x * x; }
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        static inline vec_type_f apply(vec_type_f acc, vec_type_f x) { return _mm_uni_add_ps(acc, _mm_uni_mul_ps(x, x)); }
+#endif
+    };
+
+    struct sum_abs_op : public sum_op {
+        static inline float apply(float acc, float x) { return acc + (std::abs)(x); }
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        static inline vec_type_f apply(vec_type_f acc, vec_type_f x) {
+            return _mm_uni_add_ps(acc, _mm_uni_and_ps(x, _mm_uni_castsi_ps(_mm_uni_set1_epi32(0x7fffffff))));
+        }
+#endif
+    };
+
+    struct max_op {
+        static inline float init() { return std::numeric_limits<float>::lowest(); }
+        static inline float apply(float acc, float x) { return (std::max)(acc, x); }
+        static inline float combine(float a, float b) { return (std::max)(a, b); }
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        static inline vec_type_f apply(vec_type_f acc, vec_type_f x) { return _mm_uni_max_ps(acc, x); }
+        static inline vec_type_f combine(vec_type_f a, vec_type_f b) { return _mm_uni_max_ps(a, b); }
+#endif
+    };
+
+    struct min_op {
+        static inline float init() { return (std::numeric_limits<float>::max)(); }
+        static inline float apply(float acc, float x) { return (std::min)(acc, x); }
+        static inline float combine(float a, float b) { return (std::min)(a, b); }
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        static inline vec_type_f apply(vec_type_f acc, vec_type_f x) { return _mm_uni_min_ps(acc, x); }
+        static inline vec_type_f combine(vec_type_f a, vec_type_f b) { return _mm_uni_min_ps(a, b); }
+#endif
+    };
+
+    bool reduce_fp32(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, size_t reduced_dims_work_amount,
+                     const SizeVector& axes_for_reduction);
+    template <typename Op>
+    void reduce_fp32(const float *src_data, float* dst_data, size_t outer, size_t reduced, size_t inner);
+    template <typename Op>
+    static float reduce_row(const float *src_data, size_t len);
+    template <typename Op>
+    static void accumulate_rows(const float *src_data, float* dst_data, size_t rows, size_t stride, size_t len);
+    template <typename Op>
+    static void combine_partials(std::vector<float>& partials, size_t parts, size_t size, float* dst_data);
+
     template <typename src_d, typename dst_t, typename F1, typename F2>
     void reduce(const src_d *src_data, dst_t* dst_data, size_t work_amount_dst, size_t reduced_dims_work_amount,
         SizeVector axes_for_reduction, SizeVector dst_dims, dst_t init_value, F1 func1, F2 func2);
@@ -180,6 +256,169 @@ private:
     SizeVector srcStrides;
 };
 
+bool ReduceImpl::reduce_fp32(
+        std::vector<Blob::Ptr>& inputs,
+        std::vector<Blob::Ptr>& outputs,
+        size_t            reduced_dims_work_amount,
+        const SizeVector& axes_for_reduction
+) {
+    // the adjacent reduced axes are folded, so the data is viewed as [outer, reduced, inner]
+    if (axes_for_reduction.empty() ||
+        axes_for_reduction.back() - axes_for_reduction.front() + 1 != axes_for_reduction.size())
+        return false;
+
+    size_t outer = 1, inner = 1;
+    for (size_t i = 0; i < axes_for_reduction.front(); i++)
+        outer *= src_dims[i];
+    for (size_t i = axes_for_reduction.back() + 1; i < src_dims.size(); i++)
+        inner *= src_dims[i];
+
+    const float *src_data = inputs[REDUCE_DATA]->cbuffer().as<const float *>() +
+                            inputs[REDUCE_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    float* dst_data = outputs[0]->cbuffer().as<float *>() +
+                      outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    const size_t work_amount_dst = outer * inner;
+
+    switch (reduceMode) {
+        case Reduce::Sum:
+            reduce_fp32<sum_op>(src_data, dst_data, outer, reduced_dims_work_amount, inner);
+            break;
+        case Reduce::Mean:
+            reduce_fp32<sum_op>(src_data, dst_data, outer, reduced_dims_work_amount, inner);
+            parallel_for(work_amount_dst, [&](size_t i) {
+                dst_data[i] /= static_cast<float>(reduced_dims_work_amount);
+            });
+            break;
+        case Reduce::SumSquare:
+            reduce_fp32<sum_square_op>(src_data, dst_data, outer, reduced_dims_work_amount, inner);
+            break;
+        case Reduce::L2:
+            reduce_fp32<sum_square_op>(src_data, dst_data, outer, reduced_dims_work_amount, inner);
+            parallel_for(work_amount_dst, [&](size_t i) {
+                dst_data[i] = sqrtf(dst_data[i]);
+            });
+            break;
+        case Reduce::L1:
+            reduce_fp32<sum_abs_op>(src_data, dst_data, outer, reduced_dims_work_amount, inner);
+            break;
+        case Reduce::Max:
+            reduce_fp32<max_op>(src_data, dst_data, outer, reduced_dims_work_amount, inner);
+            break;
+        case Reduce::Min:
+            reduce_fp32<min_op>(src_data, dst_data, outer, reduced_dims_work_amount, inner);
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+template <typename Op>
+void ReduceImpl::reduce_fp32(const float *src_data, float* dst_data, size_t outer, size_t reduced, size_t inner) {
+    const size_t nthr = parallel_get_max_threads();
+    if (inner == 1) {
+        // inner axis reduction: every output is reduced from a contiguous row
+        if (outer >= nthr || reduced < nthr * chunk_size) {
+            parallel_for(outer, [&](size_t o) {
+                dst_data[o] = reduce_row<Op>(src_data + o * reduced, reduced);
+            });
+        } else {
+            // few long rows: each of them is split between the threads
+            std::vector<float> partials(nthr * outer, Op::init());
+            parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int nthr) {
+                size_t start = 0, end = 0;
+                splitter(reduced, nthr, ithr, start, end);
+                if (start < end) {
+                    for (size_t o = 0; o < outer; o++)
+                        partials[ithr * outer + o] = reduce_row<Op>(src_data + o * reduced + start, end - start);
+                }
+            });
+            combine_partials<Op>(partials, nthr, outer, dst_data);
+        }
+    } else {
+        // outer axis reduction: the rows of the inner size are accumulated into the output row
+        const size_t chunks = (inner + chunk_size - 1) / chunk_size;
+        if (outer * chunks >= nthr || reduced < nthr) {
+            parallel_for2d(outer, chunks, [&](size_t o, size_t c) {
+                const size_t len = (std::min)(chunk_size, inner - c * chunk_size);
+                float* dst_row = dst_data + o * inner + c * chunk_size;
+                std::fill(dst_row, dst_row + len, Op::init());
+                accumulate_rows<Op>(src_data + o * reduced * inner + c * chunk_size, dst_row, reduced, inner, len);
+            });
+        } else {
+            // few output rows: the reduced axis is split between the threads, which accumulate own partial rows
+            std::vector<float> partials(nthr * outer * inner, Op::init());
+            parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int nthr) {
+                size_t start = 0, end = 0;
+                splitter(reduced, nthr, ithr, start, end);
+                for (size_t o = 0; o < outer && start < end; o++) {
+                    for (size_t c = 0; c < chunks; c++) {
+                        const size_t len = (std::min)(chunk_size, inner - c * chunk_size);
+                        accumulate_rows<Op>(src_data + (o * reduced + start) * inner + c * chunk_size,
+                                            &partials[(ithr * outer + o) * inner + c * chunk_size], end - start, inner, len);
+                    }
+                }
+            });
+            combine_partials<Op>(partials, nthr, outer * inner, dst_data);
+        }
+    }
+}
+
+template <typename Op>
+float ReduceImpl::reduce_row(const float *src_data, size_t len) {
+    float result = Op::init();
+    size_t i = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    if (len >= static_cast<size_t>(block_size)) {
+        // independent accumulators hide the latency of the vector operations
+        vec_type_f acc0 = _mm_uni_set1_ps(Op::init()), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        for (; i + 4 * block_size <= len; i += 4 * block_size) {
+            acc0 = Op::apply(acc0, _mm_uni_loadu_ps(src_data + i));
+            acc1 = Op::apply(acc1, _mm_uni_loadu_ps(src_data + i + block_size));
+            acc2 = Op::apply(acc2, _mm_uni_loadu_ps(src_data + i + 2 * block_size));
+            acc3 = Op::apply(acc3, _mm_uni_loadu_ps(src_data + i + 3 * block_size));
+        }
+        for (; i + block_size <= len; i += block_size)
+            acc0 = Op::apply(acc0, _mm_uni_loadu_ps(src_data + i));
+        acc0 = Op::combine(Op::combine(acc0, acc1), Op::combine(acc2, acc3));
+
+        float lanes[block_size];
+        _mm_uni_storeu_ps(lanes, acc0);
+        for (int k = 0; k < block_size; k++)
+            result = Op::combine(result, lanes[k]);
+    }
+#endif
+    for (; i < len; i++)
+        result = Op::apply(result, src_data[i]);
+    return result;
+}
+
+template <typename Op>
+void ReduceImpl::accumulate_rows(const float *src_data, float* dst_data, size_t rows, size_t stride, size_t len) {
+    for (size_t r = 0; r < rows; r++) {
+        const float *src_row = src_data + r * stride;
+        size_t i = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        for (; i + block_size <= len; i += block_size)
+            _mm_uni_storeu_ps(dst_data + i, Op::apply(_mm_uni_loadu_ps(dst_data + i), _mm_uni_loadu_ps(src_row + i)));
+#endif
+        for (; i < len; i++)
+            dst_data[i] = Op::apply(dst_data[i], src_row[i]);
+    }
+}
+
+template <typename Op>
+void ReduceImpl::combine_partials(std::vector<float>& partials, size_t parts, size_t size, float* dst_data) {
+    // the partial results of the threads are combined pairwise, so the rounding errors do not pile up
+    parallel_for(size, [&](size_t i) {
+        for (size_t step = 1; step < parts; step *= 2) {
+            for (size_t p = 0; p + step < parts; p += 2 * step)
+                partials[p * size + i] = Op::combine(partials[p * size + i], partials[(p + step) * size + i]);
+        }
+        dst_data[i] = partials[i];
+    });
+}
+
 template <typename src_d, typename dst_t>
 StatusCode ReduceImpl::reduce_type(
         std::vector<Blob::Ptr>& inputs,
@@ -53,7 +53,8 @@ public:
             auto blk_layout = ConfLayout::BLK8;
 #endif
             addConfig(layer, {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
-            if (type == "caffe.ResampleParameter.NEAREST")
+            // U8 data is in NHWC, the blocked kernels are FP32 only
+            if (type == "caffe.ResampleParameter.NEAREST" && layer->outData[0]->getTensorDesc().getPrecision() == Precision::FP32)
                 addConfig(layer, {DataConfigurator(blk_layout)}, {DataConfigurator(blk_layout)});
 
             // WA to enable the implementation only for equal input and output precisions
@@ -126,7 +127,10 @@ public:
                     Upsample_Nearest_BLK<2>(src_data, dst_data, IN, IC, ID, IH, IW, ndims);
                 }
             } else {
-                if (layout == NCHW || layout == NCDHW) {
+                if (precision == Precision::U8) {
+                    NearestNeighborKernel_NHWC_8u(reinterpret_cast<const uint8_t*>(src_data), reinterpret_cast<uint8_t*>(dst_data),
+                                                  IN, IC, IH, IW, fx, fy, OH, OW);
+                } else if (layout == NCHW || layout == NCDHW) {
                     NearestNeighborKernel_PLN(src_data, dst_data, IN, IC, ID, IH, IW, fx, fy, fz, OD, OH, OW);
                 } else {
                     NearestNeighborKernel_BLK(src_data, dst_data, IN, IC, ID, IH, IW, fx, fy, fz, OD, OH, OW);
@@ -135,6 +139,12 @@ public:
         } else if (type == "caffe.ResampleParameter.LINEAR") {
             size_t kernel_width = 2;
 
+            if (precision == Precision::U8) {
+                InterpolationKernel_NHWC_8u(reinterpret_cast<const uint8_t*>(src_data), IW, IH, fx, fy,
+                                            reinterpret_cast<uint8_t*>(dst_data), OW, OH, IC, IN, kernel_width, isDownsample && antialias);
+                return OK;
+            }
+
 #if defined(HAVE_SSE) || defined(HAVE_AVX2)
             if (!isDownsample && fx == 0.25f && fy == 0.25f)
                 Upsample4x_TriangleInterpolation(src_data, IW, IH, fx, fy, dst_data, OW, OH, IC, IN);
@@ -146,124 +156,225 @@ public:
     }
 
 private:
+    // The source positions and the normalized weights of the linear interpolation along an axis,
+    // every output position has the same number of taps, the unused ones have zero weights
+    struct linear_table {
+        size_t taps = 0;
+        std::vector<int> idx;
+        std::vector<float> weights;
+    };
+
     std::string type;
     bool antialias;
 
+    // The tables depend only on the shapes, so they are computed on the first inference and by the reshapes
+    std::vector<size_t> nearest_key;
+    std::vector<size_t> nearest_x;
+    std::vector<size_t> nearest_y;
+    std::vector<size_t> nearest_z;
+    std::vector<size_t> linear_key;
+    linear_table linear_x;
+    linear_table linear_y;
+
     static inline float triangleCoeff(float x) {
         return (std::max)(0.0f, 1 - std::abs(x));
     }
 
-    static void InterpolationKernel(const float *in_ptr_,
-                                    const size_t iw, const size_t ih,
-                                    const float fx, const float fy,
-                                    float *out_ptr_,
-                                    const size_t ow, const size_t oh, const size_t channels, const size_t batch,
-                                    size_t kernel_width, bool antialias) {
-        for (size_t b = 0; b < batch; b++) {
-            for (size_t c = 0; c < channels; c++) {
-                const float *in_ptr = in_ptr_ + iw * ih * channels * b + iw * ih * c;
-                float *out_ptr = out_ptr_ + ow * oh * channels * b + ow * oh * c;
-
-                for (size_t oy = 0; oy < oh; oy++) {
-                    for (size_t ox = 0; ox < ow; ox++) {
-                        float ix = ox * fx + fx / 2.0f - 0.5f;
-                        float iy = oy * fy + fy / 2.0f - 0.5f;
-
-                        int ix_r = static_cast<int>(round(ix));
-                        int iy_r = static_cast<int>(round(iy));
-
-                        float sum = 0;
-                        float wsum = 0;
+    static void fill_nearest_table(std::vector<size_t> &table, float f, int O) {
+        table.resize(O);
+        for (int o = 0; o < O; o++) {
+            float i = o * f + f / 2.0f - 0.5f;
+            table[o] = static_cast<size_t>(round(i));
+        }
+    }
 
-                        float ax = 1.0f / (antialias ? fx : 1.0f);
-                        float ay = 1.0f / (antialias ? fy : 1.0f);
+    void prepare_nearest_tables(int ID, int IH, int IW, float fx, float fy, float fz, int OD, int OH, int OW) {
+        std::vector<size_t> key = {static_cast<size_t>(ID), static_cast<size_t>(IH), static_cast<size_t>(IW),
+                                   static_cast<size_t>(OD), static_cast<size_t>(OH), static_cast<size_t>(OW)};
+        if (key == nearest_key)
+            return;
 
-                        int rx = (fx < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / ax));
-                        int ry = (fy < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / ay));
+        fill_nearest_table(nearest_x, fx, OW);
+        fill_nearest_table(nearest_y, fy, OH);
+        fill_nearest_table(nearest_z, fz, OD);
+        nearest_key = key;
+    }
 
-                        for (int y = iy_r - ry; y <= iy_r + ry; y++) {
-                            for (int x = ix_r - rx; x <= ix_r + rx; x++) {
-                                if (y < 0 || x < 0 || y >= static_cast<int>(ih) || x >= static_cast<int>(iw))
-                                    continue;
+    // The weights of the triangle filter are separable and so is their sum, which is normalized per axis:
+    // an output with no input in the support of the filter along any axis gets the zero weights
+    static void fill_linear_table(linear_table &table, size_t I, float f, size_t O, size_t kernel_width, bool antialias) {
+        float a = 1.0f / (antialias ? f : 1.0f);
+        int r = (f < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / a));
+
+        std::vector<std::vector<std::pair<int, float>>> taps(O);
+        table.taps = 0;
+        for (size_t o = 0; o < O; o++) {
+            float i = o * f + f / 2.0f - 0.5f;
+            int i_r = static_cast<int>(round(i));
+
+            float wsum = 0.0f;
+            for (int x = i_r - r; x <= i_r + r; x++) {
+                if (x < 0 || x >= static_cast<int>(I))
+                    continue;
+                float w = a * triangleCoeff(a * (i - x));
+                if (w == 0.0f)
+                    continue;
+                taps[o].emplace_back(x, w);
+                wsum += w;
+            }
+            for (auto &tap : taps[o])
+                tap.second /= wsum;
+            table.taps = (std::max)(table.taps, taps[o].size());
+        }
 
-                                float dx = ix - x;
-                                float dy = iy - y;
+        table.idx.assign(O * table.taps, 0);
+        table.weights.assign(O * table.taps, 0.0f);
+        for (size_t o = 0; o < O; o++) {
+            for (size_t t = 0; t < taps[o].size(); t++) {
+                table.idx[o * table.taps + t] = taps[o][t].first;
+                table.weights[o * table.taps + t] = taps[o][t].second;
+            }
+        }
+    }
 
-                                float w = ax * triangleCoeff(ax * dx) * ay * triangleCoeff(ay * dy);
+    void prepare_linear_tables(const size_t iw, const size_t ih, const float fx, const float fy,
+                               const size_t ow, const size_t oh, size_t kernel_width, bool antialias) {
+        std::vector<size_t> key = {iw, ih, ow, oh, kernel_width, static_cast<size_t>(antialias)};
+        if (key == linear_key)
+            return;
 
-                                sum += w * in_ptr[y * iw + x];
-                                wsum += w;
-                            }
-                        }
+        fill_linear_table(linear_x, iw, fx, ow, kernel_width, antialias);
+        fill_linear_table(linear_y, ih, fy, oh, kernel_width, antialias);
+        linear_key = key;
+    }
 
-                        out_ptr[oy * ow + ox] = (!wsum) ? 0 : (sum / wsum);
-                    }
+    void InterpolationKernel(const float *in_ptr_,
+                             const size_t iw, const size_t ih,
+                             const float fx, const float fy,
+                             float *out_ptr_,
+                             const size_t ow, const size_t oh, const size_t channels, const size_t batch,
+                             size_t kernel_width, bool antialias) {
+        prepare_linear_tables(iw, ih, fx, fy, ow, oh, kernel_width, antialias);
+
+        parallel_for3d(batch, channels, oh, [&](size_t b, size_t c, size_t oy) {
+            const float *in_ptr = in_ptr_ + iw * ih * channels * b + iw * ih * c;
+            float *out_ptr = out_ptr_ + ow * oh * channels * b + ow * oh * c + ow * oy;
+
+            for (size_t ox = 0; ox < ow; ox++)
+                out_ptr[ox] = 0.0f;
+
+            for (size_t ty = 0; ty < linear_y.taps; ty++) {
+                const float wy = linear_y.weights[oy * linear_y.taps + ty];
+                if (wy == 0.0f)
+                    continue;
+                const float *in_row = in_ptr + linear_y.idx[oy * linear_y.taps + ty] * iw;
+
+                for (size_t ox = 0; ox < ow; ox++) {
+                    const int *idx = &linear_x.idx[ox * linear_x.taps];
+                    const float *wx = &linear_x.weights[ox * linear_x.taps];
+                    float sum = 0.0f;
+                    for (size_t tx = 0; tx < linear_x.taps; tx++)
+                        sum += wx[tx] * in_row[idx[tx]];
+                    out_ptr[ox] += wy * sum;
                 }
             }
-        }
+        });
     }
 
-    static void NearestNeighborKernel_PLN(const float *in_ptr_, float *out_ptr_, int B, int C, int ID, int IH, int IW,
-                                          float fx, float fy, float fz, int OD, int OH, int OW) {
-        for (int b = 0; b < B; b++) {
-            for (int c = 0; c < C; c++) {
-                const float *in_ptr = in_ptr_ + IW * IH * ID * C * b + IW * IH * ID * c;
-                float *out_ptr = out_ptr_ + OW * OH * OD * C * b + OW * OH * OD * c;
-
-                for (int oz = 0; oz < OD; oz++) {
-                    for (int oy = 0; oy < OH; oy++) {
-                        for (int ox = 0; ox < OW; ox++) {
-                            float ix = ox * fx + fx / 2.0f - 0.5f;
-                            float iy = oy * fy + fy / 2.0f - 0.5f;
-                            float iz = oz * fz + fz / 2.0f - 0.5f;
-
-                            size_t ix_r = static_cast<size_t>(round(ix));
-                            size_t iy_r = static_cast<size_t>(round(iy));
-                            size_t iz_r = static_cast<size_t>(round(iz));
-
-                            out_ptr[oz * OH * OW + oy * OW + ox] = in_ptr[iz_r * IH * IW + iy_r * IW + ix_r];
+    // U8 version for the NHWC layout, the channels of a pixel are interpolated together
+    void InterpolationKernel_NHWC_8u(const uint8_t *in_ptr_,
+                                     const size_t iw, const size_t ih,
+                                     const float fx, const float fy,
+                                     uint8_t *out_ptr_,
+                                     const size_t ow, const size_t oh, const size_t channels, const size_t batch,
+                                     size_t kernel_width, bool antialias) {
+        prepare_linear_tables(iw, ih, fx, fy, ow, oh, kernel_width, antialias);
+
+        parallel_for2d(batch, oh, [&](size_t b, size_t oy) {
+            const uint8_t *in_ptr = in_ptr_ + iw * ih * channels * b;
+            uint8_t *out_ptr = out_ptr_ + ow * oh * channels * b + ow * channels * oy;
+
+            std::vector<float> sum(channels);
+            for (size_t ox = 0; ox < ow; ox++) {
+                std::fill(sum.begin(), sum.end(), 0.0f);
+
+                for (size_t ty = 0; ty < linear_y.taps; ty++) {
+                    const float wy = linear_y.weights[oy * linear_y.taps + ty];
+                    for (size_t tx = 0; tx < linear_x.taps; tx++) {
+                        const float w = wy * linear_x.weights[ox * linear_x.taps + tx];
+                        if (w == 0.0f)
+                            continue;
+
+                        const uint8_t *in_pixel = in_ptr + (linear_y.idx[oy * linear_y.taps + ty] * iw +
+                                                            linear_x.idx[ox * linear_x.taps + tx]) * channels;
+                        for (size_t c = 0; c < channels; c++) {
+                            sum[c] += w * in_pixel[c];
                         }
                     }
                 }
+
+                for (size_t c = 0; c < channels; c++) {
+                    out_ptr[ox * channels + c] = static_cast<uint8_t>((std::min)((std::max)(sum[c] + 0.5f, 0.0f), 255.0f));
+                }
             }
-        }
+        });
+    }
+
+    static void NearestNeighborKernel_NHWC_8u(const uint8_t *in_ptr_, uint8_t *out_ptr_, int B, int C, int IH, int IW,
+                                              float fx, float fy, int OH, int OW) {
+        parallel_for2d(B, OH, [&](size_t b, size_t oy) {
+            const uint8_t *in_ptr = in_ptr_ + IW * IH * C * b;
+            uint8_t *out_ptr = out_ptr_ + OW * OH * C * b + OW * C * oy;
+
+            float iy = oy * fy + fy / 2.0f - 0.5f;
+            size_t iy_r = static_cast<size_t>(round(iy));
+
+            for (int ox = 0; ox < OW; ox++) {
+                float ix = ox * fx + fx / 2.0f - 0.5f;
+                size_t ix_r = static_cast<size_t>(round(ix));
+
+                memcpy(out_ptr + ox * C, in_ptr + (iy_r * IW + ix_r) * C, C);
+            }
+        });
+    }
+
+    void NearestNeighborKernel_PLN(const float *in_ptr_, float *out_ptr_, int B, int C, int ID, int IH, int IW,
+                                   float fx, float fy, float fz, int OD, int OH, int OW) {
+        prepare_nearest_tables(ID, IH, IW, fx, fy, fz, OD, OH, OW);
+
+        parallel_for4d(B, C, OD, OH, [&](int b, int c, int oz, int oy) {
+            const float *in_ptr = in_ptr_ + IW * IH * ID * C * b + IW * IH * ID * c +
+                                  nearest_z[oz] * IH * IW + nearest_y[oy] * IW;
+            float *out_ptr = out_ptr_ + OW * OH * OD * C * b + OW * OH * OD * c + oz * OH * OW + oy * OW;
+
+            for (int ox = 0; ox < OW; ox++) {
+                out_ptr[ox] = in_ptr[nearest_x[ox]];
+            }
+        });
     }
 
-    static void NearestNeighborKernel_BLK(const float *in_ptr_, float *out_ptr_, int B, int C, int ID, int IH, int IW,
-                                          float fx, float fy, float fz, int OD, int OH, int OW) {
+    void NearestNeighborKernel_BLK(const float *in_ptr_, float *out_ptr_, int B, int C, int ID, int IH, int IW,
+                                   float fx, float fy, float fz, int OD, int OH, int OW) {
 #if defined(HAVE_AVX512F)
-        auto blk_size = 16;
+        const int blk_size = 16;
 #else
-        auto blk_size = 8;
+        const int blk_size = 8;
 #endif
         int CB = div_up(C, blk_size);
 
-        for (int b = 0; b < B; b++) {
-            for (int cb = 0; cb < CB; cb++) {
-                const float *in_ptr = in_ptr_ + IW * IH * ID * CB * blk_size * b + IW * IH * ID * cb * blk_size;
-                float *out_ptr = out_ptr_ + OW * OH * OD * CB * blk_size * b + OW * OH * OD * cb * blk_size;
-
-                for (int oz = 0; oz < OD; oz++) {
-                    for (int oy = 0; oy < OH; oy++) {
-                        for (int ox = 0; ox < OW; ox++) {
-                            float ix = ox * fx + fx / 2.0f - 0.5f;
-                            float iy = oy * fy + fy / 2.0f - 0.5f;
-                            float iz = oz * fz + fz / 2.0f - 0.5f;
-
-                            size_t ix_r = static_cast<size_t>(round(ix));
-                            size_t iy_r = static_cast<size_t>(round(iy));
-                            size_t iz_r = static_cast<size_t>(round(iz));
+        prepare_nearest_tables(ID, IH, IW, fx, fy, fz, OD, OH, OW);
 
-                            for (int c = 0; c < blk_size; c++) {
-                                float value = in_ptr[iz_r * IH * IW * blk_size + iy_r * IW * blk_size + ix_r * blk_size + c];
+        parallel_for4d(B, CB, OD, OH, [&](int b, int cb, int oz, int oy) {
+            const float *in_ptr = in_ptr_ + IW * IH * ID * CB * blk_size * b + IW * IH * ID * cb * blk_size +
+                                  nearest_z[oz] * IH * IW * blk_size + nearest_y[oy] * IW * blk_size;
+            float *out_ptr = out_ptr_ + OW * OH * OD * CB * blk_size * b + OW * OH * OD * cb * blk_size +
+                             oz * OH * OW * blk_size + oy * OW * blk_size;
 
-                                out_ptr[oz * OH * OW * blk_size + oy * OW * blk_size + ox * blk_size + c] = value;
-                            }
-                        }
-                    }
-                }
+            // the block is a couple of vector registers, the copy of the constant size is inlined
+            for (int ox = 0; ox < OW; ox++) {
+                memcpy(out_ptr + ox * blk_size, in_ptr + nearest_x[ox] * blk_size, blk_size * sizeof(float));
             }
-        }
+        });
     }
 
     template <typename T, int factor>
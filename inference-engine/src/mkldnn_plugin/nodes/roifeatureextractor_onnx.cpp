@@ -129,107 +129,6 @@ void pre_calc_for_bilinear_interpolate(
   }
 }
 
-template <typename T>
-void ROIAlignForward_cpu_kernel(
-    const int nthreads,
-    const T* bottom_data,
-    const T& spatial_scale,
-    const int channels,
-    const int height,
-    const int width,
-    const int pooled_height,
-    const int pooled_width,
-    const int sampling_ratio,
-    const T* bottom_rois,
-    T* top_data) {
-  int roi_cols = 4;
-
-  int n_rois = nthreads / channels / pooled_width / pooled_height;
-  // (n, c, ph, pw) is an element in the pooled output
-  parallel_for(n_rois, [&](size_t n) {
-    int index_n = n * channels * pooled_width * pooled_height;
-
-    // roi could have 4 or 5 columns
-    const T* offset_bottom_rois = bottom_rois + n * roi_cols;
-    int roi_batch_ind = 0;
-    if (roi_cols == 5) {
-      roi_batch_ind = static_cast<int>(offset_bottom_rois[0]);
-      offset_bottom_rois++;
-    }
-
-    // Do not using rounding; this implementation detail is critical
-    T roi_start_w = offset_bottom_rois[0] * spatial_scale;
-    T roi_start_h = offset_bottom_rois[1] * spatial_scale;
-    T roi_end_w = offset_bottom_rois[2] * spatial_scale;
-    T roi_end_h = offset_bottom_rois[3] * spatial_scale;
-
-    // Force malformed ROIs to be 1x1
-    T roi_width = (std::max)(roi_end_w - roi_start_w, (T)1.);
-    T roi_height = (std::max)(roi_end_h - roi_start_h, (T)1.);
-    T bin_size_h = static_cast<T>(roi_height) / static_cast<T>(pooled_height);
-    T bin_size_w = static_cast<T>(roi_width) / static_cast<T>(pooled_width);
-
-    // We use roi_bin_grid to sample the grid and mimic integral
-    int roi_bin_grid_h = (sampling_ratio > 0)
-        ? sampling_ratio
-        : static_cast<int>(ceil(roi_height / pooled_height));  // e.g., = 2
-    int roi_bin_grid_w =
-        (sampling_ratio > 0) ? sampling_ratio : static_cast<int>(ceil(roi_width / pooled_width));
-
-    // We do average (integral) pooling inside a bin
-    const T count = static_cast<T>(roi_bin_grid_h * roi_bin_grid_w);  // e.g. = 4
-
-    // we want to precalculate indeces and weights shared by all chanels,
-    // this is the key point of optimiation
-    std::vector<PreCalc<T>> pre_calc(
-        roi_bin_grid_h * roi_bin_grid_w * pooled_width * pooled_height);
-    pre_calc_for_bilinear_interpolate(
-        height,
-        width,
-        pooled_height,
-        pooled_width,
-        roi_bin_grid_h,
-        roi_bin_grid_w,
-        roi_start_h,
-        roi_start_w,
-        bin_size_h,
-        bin_size_w,
-        roi_bin_grid_h,
-        roi_bin_grid_w,
-        pre_calc);
-
-    for (int c = 0; c < channels; c++) {
-      int index_n_c = index_n + c * pooled_width * pooled_height;
-      const T* offset_bottom_data =
-          bottom_data + (roi_batch_ind * channels + c) * height * width;
-      int pre_calc_index = 0;
-
-      for (int ph = 0; ph < pooled_height; ph++) {
-        for (int pw = 0; pw < pooled_width; pw++) {
-          int index = index_n_c + ph * pooled_width + pw;
-
-          T output_val = 0.;
-          for (int iy = 0; iy < roi_bin_grid_h; iy++) {
-            for (int ix = 0; ix < roi_bin_grid_w; ix++) {
-              PreCalc<T> pc = pre_calc[pre_calc_index];
-              output_val += pc.w1 * offset_bottom_data[pc.pos1] +
-                  pc.w2 * offset_bottom_data[pc.pos2] +
-                  pc.w3 * offset_bottom_data[pc.pos3] +
-                  pc.w4 * offset_bottom_data[pc.pos4];
-
-              pre_calc_index += 1;
-            }
-          }
-          output_val /= count;
-
-          top_data[index] = output_val;
-        }  // for pw
-      }  // for ph
-    }  // for c
-  });
-}
-
-
 void redistribute_rois(const float* rois, int* level_ids,
                        const int num_rois, const int levels_num) {
     const float canonical_scale = 224.0f;
@@ -328,6 +227,15 @@ public:
             std::vector<DataConfigurator> inputs_layouts(layer->insData.size(), DataConfigurator(ConfLayout::PLN));
             std::vector<DataConfigurator> outputs_layouts(layer->outData.size(), DataConfigurator(ConfLayout::PLN));
             addConfig(layer, inputs_layouts, outputs_layouts);
+
+            // the sampling points are shared by all the channels, so the blocked features are sampled a block at once
+            const auto blk_layout = getChannelBlockedLayout(layer->insData[INPUT_FEATURES_START].lock());
+            if (blk_layout != ConfLayout::PLN) {
+                for (size_t i = INPUT_FEATURES_START; i < inputs_layouts.size(); i++)
+                    inputs_layouts[i] = DataConfigurator(blk_layout);
+                outputs_layouts[OUTPUT_ROI_FEATURES] = DataConfigurator(blk_layout);
+                addConfig(layer, inputs_layouts, outputs_layouts);
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -339,6 +247,9 @@ public:
         const int num_rois = inputs[INPUT_ROIS]->getTensorDesc().getDims()[0];
         const int channels_num = inputs[INPUT_FEATURES_START]->getTensorDesc().getDims()[1];
         const int feaxels_per_roi = pooled_height_ * pooled_width_ * channels_num;
+        // the features of a ROI are contiguous in both layouts, so the ROIs are reordered the same way
+        const auto &features_blk = inputs[INPUT_FEATURES_START]->getTensorDesc().getBlockingDesc().getBlockDims();
+        const int c_block = features_blk.size() == 5 ? static_cast<int>(features_blk[4]) : 1;
 
         auto *input_rois = inputs[INPUT_ROIS]->buffer().as<const float *>();
         auto *output_rois_features = outputs[OUTPUT_ROI_FEATURES]->buffer().as<float *>();
@@ -365,16 +276,14 @@ public:
                 auto *featuremap = inputs[INPUT_FEATURES_START + i]->buffer().as<const float *>();
                 const int featuremap_height = inputs[INPUT_FEATURES_START + i]->getTensorDesc().getDims()[2];
                 const int featuremap_width = inputs[INPUT_FEATURES_START + i]->getTensorDesc().getDims()[3];
-                ROIAlignForward_cpu_kernel<float>(feaxels_per_roi * level_rois_num,
-                    featuremap,
+                roi_align(featuremap,
                     1.0f / pyramid_scales_[i],
                     channels_num,
                     featuremap_height,
                     featuremap_width,
-                    pooled_height_,
-                    pooled_width_,
-                    sampling_ratio_,
                     &reordered_rois[4 * level_rois_offset],
+                    level_rois_num,
+                    c_block,
                     &output_rois_features_temp[feaxels_per_roi * level_rois_offset]);
             }
         }
@@ -390,6 +299,122 @@ public:
     }
 
 private:
+#if defined(HAVE_AVX512F)
+    static const int vec_size = 16;
+#elif defined(HAVE_AVX2)
+    static const int vec_size = 8;
+#elif defined(HAVE_SSE)
+    static const int vec_size = 4;
+#endif
+
+    // The work is balanced over the pairs of ROIs and the channels of the planar layout or the channel blocks
+    // of the blocked one. A thread gets a contiguous range of them and precalculates the sampling points only
+    // when the ROI changes
+    void roi_align(const float *bottom_data, const float spatial_scale, const int channels,
+                   const int height, const int width, const float *bottom_rois, const int n_rois,
+                   const int c_block, float *top_data) {
+        const int pooled_size = pooled_height_ * pooled_width_;
+        const int c_groups = channels / c_block;
+        const size_t work_amount = static_cast<size_t>(n_rois) * c_groups;
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(work_amount, nthr, ithr, start, end);
+
+            std::vector<PreCalc<float>> pre_calc;
+            int current_roi = -1;
+            int samples_per_bin = 0;
+            float count = 0.0f;
+
+            for (size_t iwork = start; iwork < end; iwork++) {
+                const int n = static_cast<int>(iwork / c_groups);
+                const int cg = static_cast<int>(iwork % c_groups);
+
+                if (n != current_roi) {
+                    const float *offset_bottom_rois = bottom_rois + n * 4;
+
+                    // Do not using rounding; this implementation detail is critical
+                    float roi_start_w = offset_bottom_rois[0] * spatial_scale;
+                    float roi_start_h = offset_bottom_rois[1] * spatial_scale;
+                    float roi_end_w = offset_bottom_rois[2] * spatial_scale;
+                    float roi_end_h = offset_bottom_rois[3] * spatial_scale;
+
+                    // Force malformed ROIs to be 1x1
+                    float roi_width = (std::max)(roi_end_w - roi_start_w, 1.0f);
+                    float roi_height = (std::max)(roi_end_h - roi_start_h, 1.0f);
+                    float bin_size_h = roi_height / static_cast<float>(pooled_height_);
+                    float bin_size_w = roi_width / static_cast<float>(pooled_width_);
+
+                    // We use roi_bin_grid to sample the grid and mimic integral
+                    int roi_bin_grid_h = (sampling_ratio_ > 0)
+                        ? sampling_ratio_
+                        : static_cast<int>(ceil(roi_height / pooled_height_));  // e.g., = 2
+                    int roi_bin_grid_w =
+                        (sampling_ratio_ > 0) ? sampling_ratio_ : static_cast<int>(ceil(roi_width / pooled_width_));
+
+                    // We do average (integral) pooling inside a bin
+                    samples_per_bin = roi_bin_grid_h * roi_bin_grid_w;
+                    count = static_cast<float>(samples_per_bin);  // e.g. = 4
+
+                    pre_calc.resize(samples_per_bin * pooled_size);
+                    pre_calc_for_bilinear_interpolate(height, width, pooled_height_, pooled_width_,
+                        roi_bin_grid_h, roi_bin_grid_w, roi_start_h, roi_start_w, bin_size_h, bin_size_w,
+                        roi_bin_grid_h, roi_bin_grid_w, pre_calc);
+                    current_roi = n;
+                }
+
+                const float *offset_bottom_data = bottom_data + cg * c_block * height * width;
+                float *offset_top_data = top_data + n * channels * pooled_size + cg * c_block * pooled_size;
+
+                for (int p = 0; p < pooled_size; p++) {
+                    const PreCalc<float> *pc = &pre_calc[p * samples_per_bin];
+                    float *dst = offset_top_data + p * c_block;
+
+                    if (c_block == 1) {
+                        float output_val = 0.f;
+                        for (int s = 0; s < samples_per_bin; s++) {
+                            output_val += pc[s].w1 * offset_bottom_data[pc[s].pos1] +
+                                pc[s].w2 * offset_bottom_data[pc[s].pos2] +
+                                pc[s].w3 * offset_bottom_data[pc[s].pos3] +
+                                pc[s].w4 * offset_bottom_data[pc[s].pos4];
+                        }
+                        dst[0] = output_val / count;
+                        continue;
+                    }
+
+                    int c = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                    for (; c + vec_size <= c_block; c += vec_size) {
+                        auto vec_out = _mm_uni_setzero_ps();
+                        for (int s = 0; s < samples_per_bin; s++) {
+                            const float *src = offset_bottom_data + c;
+                            vec_out = _mm_uni_add_ps(vec_out, _mm_uni_mul_ps(_mm_uni_set1_ps(pc[s].w1),
+                                                                             _mm_uni_loadu_ps(src + pc[s].pos1 * c_block)));
+                            vec_out = _mm_uni_add_ps(vec_out, _mm_uni_mul_ps(_mm_uni_set1_ps(pc[s].w2),
+                                                                             _mm_uni_loadu_ps(src + pc[s].pos2 * c_block)));
+                            vec_out = _mm_uni_add_ps(vec_out, _mm_uni_mul_ps(_mm_uni_set1_ps(pc[s].w3),
+                                                                             _mm_uni_loadu_ps(src + pc[s].pos3 * c_block)));
+                            vec_out = _mm_uni_add_ps(vec_out, _mm_uni_mul_ps(_mm_uni_set1_ps(pc[s].w4),
+                                                                             _mm_uni_loadu_ps(src + pc[s].pos4 * c_block)));
+                        }
+                        _mm_uni_storeu_ps(dst + c, _mm_uni_div_ps(vec_out, _mm_uni_set1_ps(count)));
+                    }
+#endif
+                    for (; c < c_block; c++) {
+                        float output_val = 0.f;
+                        for (int s = 0; s < samples_per_bin; s++) {
+                            output_val += pc[s].w1 * offset_bottom_data[pc[s].pos1 * c_block + c] +
+                                pc[s].w2 * offset_bottom_data[pc[s].pos2 * c_block + c] +
+                                pc[s].w3 * offset_bottom_data[pc[s].pos3 * c_block + c] +
+                                pc[s].w4 * offset_bottom_data[pc[s].pos4 * c_block + c];
+                        }
+                        dst[c] = output_val / count;
+                    }
+                }
+            }
+        });
+    }
+
     int output_dim_ = 0;
     int pooled_height_ = 0;
     int pooled_width_ = 0;
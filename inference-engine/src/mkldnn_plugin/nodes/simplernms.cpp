@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -21,16 +22,6 @@ struct simpler_nms_roi_t {
         return (std::max)(v_min, (std::min)(v, v_max));
     }
 
-    float area() const { return std::max<float>(0, y1 - y0 + 1) * std::max<float>(0, x1 - x0 + 1); }
-
-    simpler_nms_roi_t intersect(simpler_nms_roi_t other) const {
-        return {
-            (std::max)(x0, other.x0),
-            (std::max)(y0, other.y0),
-            (std::min)(x1, other.x1),
-            (std::min)(y1, other.y1)
-        };
-    }
     simpler_nms_roi_t clamp(simpler_nms_roi_t other) const {
         return {
             clamp_v(x0, other.x0, other.x1),
@@ -130,34 +121,6 @@ void GenerateAnchors(unsigned int base_size, const std::vector<float>& ratios,
     }
 }
 
-std::vector<simpler_nms_roi_t> simpler_nms_perform_nms(
-        const std::vector<simpler_nms_proposal_t>& proposals,
-        float iou_threshold,
-        size_t top_n) {
-    std::vector<simpler_nms_roi_t> res;
-    res.reserve(top_n);
-    for (const auto & prop : proposals) {
-        const auto bbox = prop.roi;
-        const float area = bbox.area();
-
-        // For any realistic WL, this condition is true for all top_n values anyway
-        if (prop.confidence > 0) {
-            bool overlaps = std::any_of(res.begin(), res.end(), [&](const simpler_nms_roi_t& res_bbox) {
-                float interArea = bbox.intersect(res_bbox).area();
-                float unionArea = res_bbox.area() + area - interArea;
-                return interArea > iou_threshold * unionArea;
-            });
-
-            if (!overlaps) {
-                res.push_back(bbox);
-                if (res.size() == top_n) break;
-            }
-        }
-    }
-
-    return res;
-}
-
 inline void sort_and_keep_at_most_top_n(
         std::vector<simpler_nms_proposal_t>& proposals,
         size_t top_n) {
@@ -166,12 +129,13 @@ inline void sort_and_keep_at_most_top_n(
         return a.confidence > b.confidence || (a.confidence == b.confidence && a.ord > b.ord);
     };
 
+    // the order is total, so selecting the top_n in linear time before sorting them gives the same result
     if (proposals.size() > top_n) {
-        std::partial_sort(proposals.begin(), proposals.begin() + top_n, proposals.end(), cmp_fn);
+        if (top_n > 0)
+            std::nth_element(proposals.begin(), proposals.begin() + top_n - 1, proposals.end(), cmp_fn);
         proposals.resize(top_n);
-    } else {
-        std::sort(proposals.begin(), proposals.end(), cmp_fn);
     }
+    parallel_sort(proposals.begin(), proposals.end(), cmp_fn);
 }
 
 inline simpler_nms_roi_t simpler_nms_gen_bbox(
@@ -269,57 +233,82 @@ public:
 
         int scaled_min_bbox_size = min_box_size_ * IS;
 
-        std::vector<simpler_nms_proposal_t> sorted_proposals_confidence;
-
-        for (auto y = 0; y < H; ++y) {
+        // the proposals of the locations are generated in parallel, each one to its own slot
+        candidates_.resize(SZ * anchors_num);
+        parallel_for2d(H, W, [&](int y, int x) {
             int anchor_shift_y = y * feat_stride_;
+            int anchor_shift_x = x * feat_stride_;
+            int location_index = y * W + x;
 
-            for (auto x = 0; x < W; ++x) {
-                int anchor_shift_x = x * feat_stride_;
-                int location_index = y * W + x;
+            // we assume proposals are grouped by window location
+            for (int anchor_index = 0; anchor_index < anchors_num ; anchor_index++) {
+                float dx0 = delta_pred[location_index + SZ * (anchor_index * 4 + 0)];
+                float dy0 = delta_pred[location_index + SZ * (anchor_index * 4 + 1)];
+                float dx1 = delta_pred[location_index + SZ * (anchor_index * 4 + 2)];
+                float dy1 = delta_pred[location_index + SZ * (anchor_index * 4 + 3)];
 
-                // we assume proposals are grouped by window location
-                for (int anchor_index = 0; anchor_index < anchors_num ; anchor_index++) {
-                    float dx0 = delta_pred[location_index + SZ * (anchor_index * 4 + 0)];
-                    float dy0 = delta_pred[location_index + SZ * (anchor_index * 4 + 1)];
-                    float dx1 = delta_pred[location_index + SZ * (anchor_index * 4 + 2)];
-                    float dy1 = delta_pred[location_index + SZ * (anchor_index * 4 + 3)];
+                simpler_nms_delta_t bbox_delta { dx0, dy0, dx1, dy1 };
 
-                    simpler_nms_delta_t bbox_delta { dx0, dy0, dx1, dy1 };
+                float proposal_confidence =
+                        cls_scores[location_index + SZ * (anchor_index + anchors_num * 1)];
 
-                    float proposal_confidence =
-                            cls_scores[location_index + SZ * (anchor_index + anchors_num * 1)];
+                simpler_nms_roi_t tmp_roi = simpler_nms_gen_bbox(anchors[anchor_index], bbox_delta, anchor_shift_x, anchor_shift_y);
+                simpler_nms_roi_t roi = tmp_roi.clamp({ 0, 0, static_cast<float>(IW - 1), static_cast<float>(IH - 1)});
 
-                    simpler_nms_roi_t tmp_roi = simpler_nms_gen_bbox(anchors[anchor_index], bbox_delta, anchor_shift_x, anchor_shift_y);
-                    simpler_nms_roi_t roi = tmp_roi.clamp({ 0, 0, static_cast<float>(IW - 1), static_cast<float>(IH - 1)});
+                int bbox_w = static_cast<int>(roi.x1 - roi.x0) + 1;
+                int bbox_h = static_cast<int>(roi.y1 - roi.y0) + 1;
 
-                    int bbox_w = static_cast<int>(roi.x1 - roi.x0) + 1;
-                    int bbox_h = static_cast<int>(roi.y1 - roi.y0) + 1;
-
-                    if (bbox_w >= scaled_min_bbox_size && bbox_h >= scaled_min_bbox_size) {
-                        simpler_nms_proposal_t proposal { roi, proposal_confidence, sorted_proposals_confidence.size() };
-                        sorted_proposals_confidence.push_back(proposal);
-                    }
-                }
+                candidate& c = candidates_[location_index * anchors_num + anchor_index];
+                c.proposal = { roi, proposal_confidence, 0 };
+                c.valid = bbox_w >= scaled_min_bbox_size && bbox_h >= scaled_min_bbox_size;
+            }
+        });
+
+        // the proposals keep the order of the serial enumeration, it breaks the ties of their confidences
+        sorted_proposals_confidence_.clear();
+        for (const auto& c : candidates_) {
+            if (c.valid) {
+                sorted_proposals_confidence_.push_back(c.proposal);
+                sorted_proposals_confidence_.back().ord = sorted_proposals_confidence_.size() - 1;
             }
         }
 
-        sort_and_keep_at_most_top_n(sorted_proposals_confidence, pre_nms_topn_);
-        auto res = simpler_nms_perform_nms(sorted_proposals_confidence, iou_threshold_, post_nms_topn_);
+        sort_and_keep_at_most_top_n(sorted_proposals_confidence_, pre_nms_topn_);
+        const auto& res = perform_nms(sorted_proposals_confidence_, iou_threshold_, post_nms_topn_);
 
         size_t res_num_rois = res.size();
 
         for (size_t i = 0; i < res_num_rois; ++i) {
             dst[5 * i + 0] = 0;    // roi_batch_ind, always zero on test time
-            dst[5 * i + 1] = res[i].x0;
-            dst[5 * i + 2] = res[i].y0;
-            dst[5 * i + 3] = res[i].x1;
-            dst[5 * i + 4] = res[i].y1;
+            dst[5 * i + 1] = res.x0[i];
+            dst[5 * i + 2] = res.y0[i];
+            dst[5 * i + 3] = res.x1[i];
+            dst[5 * i + 4] = res.y1[i];
         }
         return OK;
     }
 
 private:
+    struct candidate {
+        simpler_nms_proposal_t proposal;
+        bool valid;
+    };
+
+    const KeptBoxes& perform_nms(const std::vector<simpler_nms_proposal_t>& proposals, float iou_threshold, size_t top_n) {
+        kept_boxes_.clear();
+        for (const auto & prop : proposals) {
+            // For any realistic WL, this condition is true for all top_n values anyway
+            if (prop.confidence > 0) {
+                const auto& bbox = prop.roi;
+                if (!kept_boxes_.overlaps(bbox.x0, bbox.y0, bbox.x1, bbox.y1, iou_threshold)) {
+                    kept_boxes_.push(bbox.x0, bbox.y0, bbox.x1, bbox.y1);
+                    if (kept_boxes_.size() == top_n) break;
+                }
+            }
+        }
+        return kept_boxes_;
+    }
+
     int min_box_size_;
     int feat_stride_;
     int pre_nms_topn_;
@@ -330,6 +319,10 @@ private:
     std::vector<float> ratios;
 
     std::vector<simpler_nms_anchor> anchors_;
+
+    std::vector<candidate> candidates_;
+    std::vector<simpler_nms_proposal_t> sorted_proposals_confidence_;
+    KeptBoxes kept_boxes_ = KeptBoxes(1.f);
 };
 
 REG_FACTORY_FOR(ImplFactory<SimplerNMSImpl>, SimplerNMS);
@@ -141,54 +141,95 @@ public:
             prev_segment_id = cur_segment_id;
         }
 
-        // zero output buffer
-        std::memset(output_ptr, 0, output_dims[0] * num_elements_in_slice * sizeof(float));
+        // zero the tail of the output after the last segment
+        if (num_segments < output_dims[0]) {
+            std::memset(output_ptr + num_segments * num_elements_in_slice, 0,
+                        (output_dims[0] - num_segments) * num_elements_in_slice * sizeof(float));
+        }
 
-        // compute the result for each segment in parallel
-        parallel_for(num_segments, [&](size_t segment_id) {
+        // compute the result for each segment in parallel, the segments have different lengths,
+        // so they are taken dynamically instead of in even chunks
+        parallel_for_dynamic(num_segments, 4, [&](size_t segment_id) {
             float *segment_ptr = output_ptr + segment_id * num_elements_in_slice;
             size_t start = segment_starts[segment_id];
             size_t end = (segment_id == (num_segments - 1)) ? num_indices : segment_starts[segment_id + 1];
+            std::fill_n(segment_ptr, num_elements_in_slice, 0.0f);
 
-            // scatter data and reduce for one segment
+            // gather data and reduce for one segment
             for (size_t idx = start; idx < end; idx++) {
-                size_t indice = input_indices_ptr[idx];
-                std::transform(segment_ptr, segment_ptr + num_elements_in_slice,
-                    input_data_ptr + indice * num_elements_in_slice,
-                    segment_ptr, std::plus<float>());
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                // the rows of the data are gathered randomly, so the following ones are requested in advance
+                if (idx + prefetch_distance < end) {
+                    size_t next_indice = static_cast<size_t>(input_indices_ptr[idx + prefetch_distance]);
+                    prefetch_row(input_data_ptr + next_indice * num_elements_in_slice, num_elements_in_slice);
+                }
+#endif
+                size_t indice = static_cast<size_t>(input_indices_ptr[idx]);
+                accumulate_row(segment_ptr, input_data_ptr + indice * num_elements_in_slice, num_elements_in_slice);
+            }
+
+            // the segment is scaled while it is still in the cache
+            float divisor = 1.0f;
+            if (reduction_op == ReducedOp::mean) {
+                divisor = static_cast<float>(end - start);
+            } else if (reduction_op == ReducedOp::sqrtn) {
+                divisor = sqrtf(static_cast<float>(end - start));
+            }
+            if (divisor > 0.0f && divisor != 1.0f) {
+                scale_row(segment_ptr, 1.0f / divisor, num_elements_in_slice);
             }
         });
 
-        if (reduction_op == ReducedOp::mean) {
-            parallel_for(num_segments, [&](size_t segment_id) {
-                float *segment_ptr = output_ptr + segment_id * num_elements_in_slice;
-                size_t start = segment_starts[segment_id];
-                size_t end = (segment_id == (num_segments - 1)) ? num_indices : segment_starts[segment_id + 1];
-                float num_adds = static_cast<float>(end - start);
-                if (num_adds > 0) {
-                    std::transform(segment_ptr, segment_ptr + num_elements_in_slice, segment_ptr,
-                        [num_adds](float elem) { return elem / num_adds; });
-                }
-            });
+        return OK;
+    }
+
+private:
+#if defined(HAVE_AVX512F)
+    static const int block_size = 16;
+#elif defined(HAVE_AVX2)
+    static const int block_size = 8;
+#elif defined(HAVE_SSE)
+    static const int block_size = 4;
+#endif
+
+    static inline void accumulate_row(float *dst, const float *src, size_t size) {
+        size_t ind = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        for (; ind + block_size <= size; ind += block_size) {
+            _mm_uni_storeu_ps(dst + ind, _mm_uni_add_ps(_mm_uni_loadu_ps(dst + ind), _mm_uni_loadu_ps(src + ind)));
+        }
+#endif
+        for (; ind < size; ind++) {
+            dst[ind] += src[ind];
         }
+    }
 
-        if (reduction_op == ReducedOp::sqrtn) {
-            parallel_for(num_segments, [&](size_t segment_id) {
-                float *segment_ptr = output_ptr + segment_id * num_elements_in_slice;
-                size_t start = segment_starts[segment_id];
-                size_t end = (segment_id == (num_segments - 1)) ? num_indices : segment_starts[segment_id + 1];
-                float sqrtn = sqrtf(static_cast<float>(end - start));
-                if (sqrtn > 0) {
-                    std::transform(segment_ptr, segment_ptr + num_elements_in_slice, segment_ptr,
-                        [sqrtn](float elem) { return elem / sqrtn; });
-                }
-            });
+    static inline void scale_row(float *dst, float scale, size_t size) {
+        size_t ind = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        auto vec_scale = _mm_uni_set1_ps(scale);
+        for (; ind + block_size <= size; ind += block_size) {
+            _mm_uni_storeu_ps(dst + ind, _mm_uni_mul_ps(_mm_uni_loadu_ps(dst + ind), vec_scale));
+        }
+#endif
+        for (; ind < size; ind++) {
+            dst[ind] *= scale;
         }
+    }
 
-        return OK;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    static inline void prefetch_row(const float *row, size_t size) {
+        // the hardware prefetcher follows the long rows after their first lines
+        const size_t prefetch_size = size < max_prefetch_size ? size : max_prefetch_size;
+        for (size_t ind = 0; ind < prefetch_size; ind += cache_line_size / sizeof(float))
+            _mm_prefetch(reinterpret_cast<const char *>(row + ind), _MM_HINT_T0);
     }
 
-private:
+    static const size_t prefetch_distance = 8;
+    static const size_t cache_line_size = 64;
+    static const size_t max_prefetch_size = 256;
+#endif
+
     const size_t INPUT_DATA_PORT = 0;
     const size_t INPUT_INDICES_PORT = 1;
     const size_t INPUT_SEGMENT_IDS_PORT = 2;
@@ -106,35 +106,38 @@ public:
         int *output_ptr = outputs[OUTPUT_PORT]->cbuffer().as<int *>() +
             inputs[OUTPUT_PORT]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
+        // compute strides of the dense tensor once instead of for every value
+        std::vector<size_t> dense_strides(dense_tensor_rank, 1);
         size_t output_num_values = 1;
-        for (size_t ind = 0; ind < dense_tensor_rank; ind++) {
+        for (size_t ind = dense_tensor_rank; ind-- > 0;) {
+            dense_strides[ind] = output_num_values;
             output_num_values *= input_dense_shape_ptr[ind];
         }
 
         // fill the output tensor with the default value
-        for (size_t ind = 0; ind < output_num_values; ind++) {
-            output_ptr[ind] = default_value;
-        }
-
-        // walkthrough all indices and fill the output tensor with corresponding values
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(output_num_values, nthr, ithr, start, end);
+            std::fill(output_ptr + start, output_ptr + end, default_value);
+        });
+
+        // walkthrough all indices and fill the output tensor with corresponding values,
+        // the values are written in order since the last one of a repeated index wins
         for (size_t ind = 0; ind < input_num_values; ind++) {
-            int value = input_values_ptr[ind];
             size_t placement = 0;
             const int *tmp_indice_ptr = input_indices_ptr + ind * dense_tensor_rank;
-            size_t num_values_in_slice = output_num_values;
             for (size_t subindice_ind = 0; subindice_ind < dense_tensor_rank; subindice_ind++) {
-                num_values_in_slice /= input_dense_shape_ptr[subindice_ind];
                 size_t subindice = static_cast<size_t>(tmp_indice_ptr[subindice_ind]);
-                if (subindice >= input_dense_shape_ptr[subindice_ind]) {
+                if (subindice >= static_cast<size_t>(input_dense_shape_ptr[subindice_ind])) {
                     if (resp) {
                         std::string errorMsg = "Value of index is out of bound!";
                         errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
                     }
                     return GENERAL_ERROR;
                 }
-                placement += subindice * num_values_in_slice;
+                placement += subindice * dense_strides[subindice_ind];
             }
-            output_ptr[placement] = value;
+            output_ptr[placement] = input_values_ptr[ind];
         }
 
         return OK;
@@ -22,7 +22,7 @@ namespace Cpu {
 class ExperimentalSparseWeightedReduceImpl : public ExtLayerBase {
 private:
     // supported operations for the reduction
-    enum ReducedOp {sum};
+    enum ReducedOp {sum, mean};
 
 public:
     explicit ExperimentalSparseWeightedReduceImpl(const CNNLayer* layer) {
@@ -37,6 +37,7 @@ public:
             // check operation by which it reduces
             std::string reduce_mode = layer->type;
             if (reduce_mode == "ExperimentalSparseWeightedSum") reduction_op = ReducedOp::sum;
+            else if (reduce_mode == "ExperimentalSparseWeightedMean") reduction_op = ReducedOp::mean;
             else
                 THROW_IE_EXCEPTION << layer->name << " Incorrect ExperimentalSparseWeightedReduce layer type!";
 
@@ -163,47 +164,107 @@ public:
             inputs[OUTPUT_PORT]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
         // fill the output tensor with default values
-        for (size_t batch_ind = 0; batch_ind < output_batch_size; batch_ind++) {
-            const float *param_elem_ptr = input_parameters_table_ptr + input_default_value * output_elem_size;
-            float *output_elem_ptr = output_ptr + batch_ind * output_elem_size;
-            for (size_t ind = 0; ind < output_elem_size; ind++) {
-                output_elem_ptr[ind] = param_elem_ptr[ind];
+        const float *default_elem_ptr = input_parameters_table_ptr + input_default_value * output_elem_size;
+        parallel_for(output_batch_size, [&](size_t batch_ind) {
+            std::copy_n(default_elem_ptr, output_elem_size, output_ptr + batch_ind * output_elem_size);
+        });
+
+        // find the segments: the values of an output slice are consecutive
+        std::vector<size_t> segment_starts;
+        bool are_segments_unique = true;
+        for (size_t curr_value_ind = 0; curr_value_ind < input_num_values; curr_value_ind++) {
+            int indice_x = input_indices_i32_ptr[2 * curr_value_ind];
+            if (curr_value_ind == 0 || indice_x != input_indices_i32_ptr[2 * (curr_value_ind - 1)]) {
+                if (curr_value_ind != 0 && indice_x < input_indices_i32_ptr[2 * (curr_value_ind - 1)])
+                    are_segments_unique = false;
+                segment_starts.push_back(curr_value_ind);
             }
         }
-
-        // initialize a vector with segment number values
-        std::vector<float> segment_nums(output_batch_size, 0.0f);
+        segment_starts.push_back(input_num_values);
 
         // compute the output tensor
-        int prev_indice_x = -1;
-        for (size_t curr_value_ind = 0; curr_value_ind < input_num_values; curr_value_ind++) {
-            int indice_x = 0;
-            size_t value = 0;
-            indice_x = input_indices_i32_ptr[2 * curr_value_ind];
-            value = static_cast<size_t>(input_values_i32_ptr[curr_value_ind]);
-            const float *param_elem_ptr = input_parameters_table_ptr + value * output_elem_size;
-            float *output_elem_ptr = output_ptr + indice_x * output_elem_size;
-            if (prev_indice_x != indice_x) {
-                // zero a slice
-                prev_indice_x = indice_x;
-                for (size_t ind = 0; ind < output_elem_size; ind++) {
-                    output_elem_ptr[ind] = 0.0f;
+        auto reduce_segment = [&](size_t segment) {
+            const size_t begin = segment_starts[segment];
+            const size_t end = segment_starts[segment + 1];
+            float *output_elem_ptr = output_ptr + input_indices_i32_ptr[2 * begin] * output_elem_size;
+            std::fill_n(output_elem_ptr, output_elem_size, 0.0f);
+
+            float weights_sum = 0.0f;
+            for (size_t curr_value_ind = begin; curr_value_ind < end; curr_value_ind++) {
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                // the rows of the table are gathered randomly, so the following ones are requested in advance
+                if (curr_value_ind + prefetch_distance < input_num_values) {
+                    size_t next_value = static_cast<size_t>(input_values_i32_ptr[curr_value_ind + prefetch_distance]);
+                    prefetch_row(input_parameters_table_ptr + next_value * output_elem_size, output_elem_size);
                 }
+#endif
+                size_t value = static_cast<size_t>(input_values_i32_ptr[curr_value_ind]);
+                const float *param_elem_ptr = input_parameters_table_ptr + value * output_elem_size;
+                float weight = 1.0f;
+                if (with_weights) {
+                    weight = input_weights_ptr[curr_value_ind];
+                }
+                weights_sum += weight;
+                accumulate_row(output_elem_ptr, param_elem_ptr, weight, output_elem_size);
             }
-            float weight = 1.0f;
-            if (with_weights) {
-                weight = input_weights_ptr[curr_value_ind];
-            }
-            segment_nums[indice_x] += weight;
-            for (size_t ind = 0; ind < output_elem_size; ind++) {
-                output_elem_ptr[ind] += param_elem_ptr[ind] * weight;
+
+            if (reduction_op == ReducedOp::mean && weights_sum != 0.0f) {
+                for (size_t ind = 0; ind < output_elem_size; ind++) {
+                    output_elem_ptr[ind] /= weights_sum;
+                }
             }
+        };
+
+        const size_t num_segments = segment_starts.size() - 1;
+        if (are_segments_unique) {
+            // the segments have different lengths, so they are taken dynamically instead of in even chunks
+            parallel_for_dynamic(num_segments, 4, reduce_segment);
+        } else {
+            // the last segment of a repeated output slice overrides the previous ones
+            for (size_t segment = 0; segment < num_segments; segment++)
+                reduce_segment(segment);
         }
 
         return OK;
     }
 
 private:
+#if defined(HAVE_AVX512F)
+    static const int block_size = 16;
+#elif defined(HAVE_AVX2)
+    static const int block_size = 8;
+#elif defined(HAVE_SSE)
+    static const int block_size = 4;
+#endif
+
+    static inline void accumulate_row(float *dst, const float *src, float weight, size_t size) {
+        size_t ind = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        auto vec_weight = _mm_uni_set1_ps(weight);
+        for (; ind + block_size <= size; ind += block_size) {
+            auto vec_dst = _mm_uni_loadu_ps(dst + ind);
+            vec_dst = _mm_uni_add_ps(vec_dst, _mm_uni_mul_ps(_mm_uni_loadu_ps(src + ind), vec_weight));
+            _mm_uni_storeu_ps(dst + ind, vec_dst);
+        }
+#endif
+        for (; ind < size; ind++) {
+            dst[ind] += src[ind] * weight;
+        }
+    }
+
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    static inline void prefetch_row(const float *row, size_t size) {
+        // the hardware prefetcher follows the long rows after their first lines
+        const size_t prefetch_size = size < max_prefetch_size ? size : max_prefetch_size;
+        for (size_t ind = 0; ind < prefetch_size; ind += cache_line_size / sizeof(float))
+            _mm_prefetch(reinterpret_cast<const char *>(row + ind), _MM_HINT_T0);
+    }
+
+    static const size_t prefetch_distance = 8;
+    static const size_t cache_line_size = 64;
+    static const size_t max_prefetch_size = 256;
+#endif
+
     const size_t INPUT_INDICES_PORT = 0;
     const size_t INPUT_VALUES_PORT = 1;
     const size_t INPUT_DENSE_SHAPE_PORT = 2;
@@ -227,6 +288,7 @@ private:
 };
 
 REG_FACTORY_FOR(ImplFactory<ExperimentalSparseWeightedReduceImpl>, ExperimentalSparseWeightedSum);
+REG_FACTORY_FOR(ImplFactory<ExperimentalSparseWeightedReduceImpl>, ExperimentalSparseWeightedMean);
 
 }  // namespace Cpu
 }  // namespace Extensions
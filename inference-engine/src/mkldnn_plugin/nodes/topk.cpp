@@ -12,6 +12,9 @@
 #include <vector>
 #include <cassert>
 #include <functional>
+#include <algorithm>
+#include <utility>
+#include <new>
 #include "ie_parallel.hpp"
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
@@ -21,6 +24,7 @@ namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+template <mkldnn::impl::cpu::cpu_isa_t T>
 class TopKImpl: public ExtLayerBase {
 public:
     explicit TopKImpl(const CNNLayer* layer) {
@@ -72,6 +76,9 @@ public:
             else
                 mode_max = false;
 
+            // set by the graph optimizer for the softmax input along the same axis
+            fused_softmax = layer->GetParamAsBool("fused_softmax", false);
+
             if (layer->GetParamAsString("sort", "index") == "value")
                 sort_value = true;
             else
@@ -97,6 +104,10 @@ public:
             dim = static_cast<int>(src_dims[axis]);
             before_num = count(src_dims, 0, axis);
 
+            // k of the execution is the one of the output, the buffers of the iterations come from the scratchpad
+            const size_t k = dst_dims[axis];
+            scratchpadSize = (std::max)((k + 1) * (sizeof(float) + sizeof(int)), k * sizeof(std::pair<float, int>));
+
             if (layer->outData.size() == 1) {
                 addConfig(layer, { DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN) },
                     { DataConfigurator(ConfLayout::PLN) });
@@ -306,14 +317,10 @@ public:
 #if defined(HAVE_AVX512F)
                             if (vmask)
                                 vswap_func(i3, i3 - 1);
-                            else
-                                break;
 #else
                             int swap = _mm_uni_movemask_ps(vmask);
                             if (swap)
                                 vswap_func(i3, i3 - 1);
-                            else
-                                break;
 #endif
                         }
                     }
@@ -332,8 +339,8 @@ public:
 #endif
         int rest = after_num - first_index;
         parallel_for2d(before_num, rest, [&](int i0, int i1) {
-            std::vector<float> max_values(src_k + 1);
-            std::vector<int> max_indexes(src_k + 1);
+            float* max_values = getScratchpad<float>();
+            int* max_indexes = reinterpret_cast<int*>(max_values + src_k + 1);
             float tmp_value;
             int tmp_index;
             int s_index = i0 * dim * after_num + first_index + i1;
@@ -394,8 +401,8 @@ public:
     template <template <typename> class Compare>
     void topk(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
         parallel_for(before_num, [&](int i0) {
-            std::vector<float> max_values(src_k + 1);
-            std::vector<int> max_indexes(src_k + 1);
+            float* max_values = getScratchpad<float>();
+            int* max_indexes = reinterpret_cast<int*>(max_values + src_k + 1);
             float tmp_value;
             int tmp_index;
             int s_index = i0 * dim;
@@ -453,6 +460,75 @@ public:
         });
     }
 
+    // Keeps the best src_k elements in a heap with the worst of them on top, so the rest of the axis is only
+    // compared with it. Large axes with small k take one SIMD pass, since few elements get into the heap.
+    template <class Compare1, template <typename> class Compare2>
+    void topk_heap(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
+        // the same order as in topk(): better value first, the smaller index first for equal values
+        auto better = [](const std::pair<float, int>& a, const std::pair<float, int>& b) {
+            return Compare2<float>()(a.first, b.first) || (a.first == b.first && a.second < b.second);
+        };
+
+        parallel_for(before_num, [&](int i0) {
+            const float* psrc = src_data + i0 * dim;
+            std::pair<float, int>* heap = getScratchpad<std::pair<float, int>>();
+            for (int i1 = 0; i1 < src_k; i1++)
+                new (heap + i1) std::pair<float, int>(psrc[i1], i1);
+            std::make_heap(heap, heap + src_k, better);
+
+            // replaces the worst element and sifts the new one down
+            auto push = [&](int i1) {
+                std::pair<float, int> item(psrc[i1], i1);
+                int pos = 0;
+                for (int child = 1; child < src_k; child = 2 * pos + 1) {
+                    if (child + 1 < src_k && better(heap[child], heap[child + 1]))
+                        child++;
+                    if (!better(item, heap[child]))
+                        break;
+                    heap[pos] = heap[child];
+                    pos = child;
+                }
+                heap[pos] = item;
+            };
+
+            // elements come in order of indexes, so an element equal to the worst one is never better
+            int i1 = src_k;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+            for (; i1 + block_size <= dim; i1 += block_size) {
+                vmask_type vmask = Compare1::cmp_ps(_mm_uni_loadu_ps(psrc + i1), _mm_uni_set1_ps(heap[0].first));
+#if defined(HAVE_AVX512F)
+                int mask = vmask;
+#else
+                int mask = _mm_uni_movemask_ps(vmask);
+#endif
+                for (int i2 = 0; mask; i2++, mask >>= 1) {
+                    if ((mask & 1) && Compare2<float>()(psrc[i1 + i2], heap[0].first))
+                        push(i1 + i2);
+                }
+            }
+#endif
+            for (; i1 < dim; i1++) {
+                if (Compare2<float>()(psrc[i1], heap[0].first))
+                    push(i1);
+            }
+
+            std::sort_heap(heap, heap + src_k, better);
+            if (!sort_value) {
+                std::sort(heap, heap + src_k, [](const std::pair<float, int>& a, const std::pair<float, int>& b) {
+                    return a.second < b.second;
+                });
+            }
+            if (dst_data) {
+                for (int i2 = 0; i2 < src_k; i2++)
+                    dst_data[i0 * src_k + i2] = heap[i2].first;
+            }
+            if (dst_idx) {
+                for (int i2 = 0; i2 < src_k; i2++)
+                    dst_idx[i0 * src_k + i2] = heap[i2].second;
+            }
+        });
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const float *src = inputs[TOPK_DATA]->cbuffer().as<float *>() +
             inputs[TOPK_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -504,10 +580,18 @@ public:
 
         if (src_dims[axis] < static_cast<size_t>(src_k))
             src_k = src_dims[axis];
+        // nothing is selected, the outputs are empty
+        if (src_k == 0)
+            return OK;
 
         SizeVector in_dims = inputs[TOPK_DATA]->getTensorDesc().getDims();
 
-        if (src_k == 1) {
+        if (is_last_dim && dim >= src_k * heap_min_ratio) {
+            if (mode_max)
+                topk_heap<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
+            else
+                topk_heap<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
+        } else if (src_k == 1) {
             if (is_last_dim) {
                 if (mode_max)
                     top1<std::greater>(src, dst_data, dst_idx, in_dims);
@@ -533,10 +617,33 @@ public:
             }
         }
 
+        if (fused_softmax && dst_data)
+            softmax_values(src, dst_data, in_dims);
+
         return OK;
     }
 
 private:
+    // Turns the selected values into the probabilities of the softmax along the axis, the input is read once more
+    // for the normalization but the probabilities of the not selected elements are not computed
+    void softmax_values(const float* src_data, float* dst_data, SizeVector in_dims) {
+        int after_num = count(in_dims, axis + 1, in_dims.size());
+        parallel_for2d(before_num, after_num, [&](int i0, int i1) {
+            const float* src = src_data + i0 * dim * after_num + i1;
+            float max_val = src[0];
+            for (int i2 = 1; i2 < dim; i2++)
+                max_val = (std::max)(max_val, src[i2 * after_num]);
+
+            float sum = 0.0f;
+            for (int i2 = 0; i2 < dim; i2++)
+                sum += std::exp(src[i2 * after_num] - max_val);
+
+            float* dst = dst_data + i0 * src_k * after_num + i1;
+            for (int i2 = 0; i2 < src_k; i2++)
+                dst[i2 * after_num] = std::exp(dst[i2 * after_num] - max_val) / sum;
+        });
+    }
+
     const size_t TOPK_DATA = 0;
     const size_t TOPK_K = 1;
     const size_t TOPK_VALUE = 0;
@@ -552,9 +659,13 @@ private:
 
     bool sort_value = false;
     bool mode_max = true;
+    bool fused_softmax = false;
 
     int dim, before_num;
 
+    // topk_heap() is used for axes at least this many times longer than k
+    const int heap_min_ratio = 16;
+
 #if defined(HAVE_AVX512F)
     const int count_vec = 32;
 #elif defined(HAVE_SSE) || defined(HAVE_AVX2)
@@ -573,7 +684,15 @@ private:
     }
 };
 
-REG_FACTORY_FOR(ImplFactory<TopKImpl>, TopK);
+#ifdef HAVE_AVX512F
+REG_FACTORY_FOR_TYPE(avx512_common, ImplFactory<TopKImpl<mkldnn::impl::cpu::cpu_isa_t::avx512_common>>, TopK);
+#elif defined HAVE_AVX2
+REG_FACTORY_FOR_TYPE(avx2, ImplFactory<TopKImpl<mkldnn::impl::cpu::cpu_isa_t::avx2>>, TopK);
+#elif defined HAVE_SSE
+REG_FACTORY_FOR_TYPE(sse42, ImplFactory<TopKImpl<mkldnn::impl::cpu::cpu_isa_t::sse42>>, TopK);
+#else
+REG_FACTORY_FOR_TYPE(isa_any, ImplFactory<TopKImpl<mkldnn::impl::cpu::cpu_isa_t::isa_any>>, TopK);
+#endif
 
 }  // namespace Cpu
 }  // namespace Extensions
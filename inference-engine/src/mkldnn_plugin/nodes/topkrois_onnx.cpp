@@ -6,6 +6,7 @@
 #include "base.hpp"
 #include <algorithm>
 #include <cassert>
+#include <numeric>
 #include <vector>
 
 
@@ -37,6 +38,8 @@ public:
                 THROW_IE_EXCEPTION << "Unsupported shape of input blobs!";
 
             max_rois_num_ = layer->GetParamAsInt("max_rois", 0);
+            // the order of the rois is sorted in the scratchpad
+            scratchpadSize = layer->insData[INPUT_ROIS].lock()->getTensorDesc().getDims()[0] * sizeof(size_t);
 
             addConfig(layer,
                       {DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN)},
@@ -55,10 +58,10 @@ public:
         auto *input_probs = inputs[INPUT_PROBS]->buffer().as<const float *>();
         auto *output_rois = outputs[OUTPUT_ROIS]->buffer().as<float *>();
 
-        std::vector<size_t> idx(input_rois_num);
-        iota(idx.begin(), idx.end(), 0);
+        size_t* idx = getScratchpad<size_t>();
+        std::iota(idx, idx + input_rois_num, 0);
         // FIXME. partial_sort is enough here.
-        sort(idx.begin(), idx.end(), [&input_probs](size_t i1, size_t i2) {return input_probs[i1] > input_probs[i2];});
+        std::sort(idx, idx + input_rois_num, [&input_probs](size_t i1, size_t i2) {return input_probs[i1] > input_probs[i2];});
 
         for (int i = 0; i < top_rois_num; ++i) {
             std::memcpy(output_rois + 4 * i, input_rois + 4 * idx[i], 4 * sizeof(float));
@@ -132,65 +132,130 @@ public:
                 outputs[cur_output_port]->getTensorDesc().getBlockingDesc().getOffsetPadding();
         }
 
-        // create a copy since input can be changed by sorting
-        std::vector<float> input_copy(num_elements);
-        std::copy(input_ptr, input_ptr + num_elements, input_copy.begin());
+        size_t num_unique_elements = sorted ?
+            unique_sorted(input_ptr, output_uniques_ptr, output_indices_ptr, output_counts_ptr) :
+            unique_unsorted(input_ptr, output_uniques_ptr, output_indices_ptr, output_counts_ptr);
+
+        // fill a tail with the latest unique element used as an end mark
+        if (num_unique_elements > 0 && (num_elements - num_unique_elements) > 0) {
+            std::fill(output_uniques_ptr + num_unique_elements,
+                output_uniques_ptr + num_elements,
+                output_uniques_ptr[num_unique_elements - 1]);
+        }
 
-        // sort elements in the input copy
-        if (sorted) {
-            parallel_sort(input_copy.begin(), input_copy.end(), std::less<float>());
+        // fill a tail for output buffer with counts
+        if (return_counts && (num_elements - num_unique_elements) > 0) {
+                std::fill(output_counts_ptr + num_unique_elements,
+                    output_counts_ptr + num_elements, 0.f);
         }
 
-        // walk through elements and save them along with its indice and occurences
-        std::unordered_map<float, float> indices;
-        for (size_t i = 0, num_unique_elements = 0; i < num_elements; i++) {
-            auto it = indices.find(input_copy[i]);
-            if (it == indices.end()) {
-                indices.insert(std::make_pair(input_copy[i], static_cast<float>(num_unique_elements)));
+        return OK;
+    }
+
+private:
+    // the sorted unique elements are adjacent, so they are found without hashing
+    // and the index of an element is found by a binary search
+    size_t unique_sorted(const float *input_ptr, float *output_uniques_ptr, float *output_indices_ptr, float *output_counts_ptr) {
+        // create a copy since input can be changed by sorting
+        std::vector<float> input_copy(input_ptr, input_ptr + num_elements);
+        parallel_sort(input_copy.begin(), input_copy.end(), std::less<float>());
+
+        size_t num_unique_elements = 0;
+        for (size_t i = 0; i < num_elements; i++) {
+            if (num_unique_elements == 0 || input_copy[i] != output_uniques_ptr[num_unique_elements - 1]) {
                 output_uniques_ptr[num_unique_elements] = input_copy[i];
-                if (return_inverse && !sorted) {
-                    output_indices_ptr[i] = static_cast<float>(num_unique_elements);
-                }
                 if (return_counts) {
                     output_counts_ptr[num_unique_elements] = 1.0f;
                 }
                 num_unique_elements++;
-            } else {
-                if (return_inverse && !sorted) {
-                    output_indices_ptr[i] = it->second;
-                }
-                if (return_counts) {
-                    output_counts_ptr[static_cast<size_t>(it->second)] += 1.0f;
-                }
+            } else if (return_counts) {
+                output_counts_ptr[num_unique_elements - 1] += 1.0f;
             }
         }
 
-        // compute indices individually when unique elements are known
-        if (sorted && return_inverse) {
-            for (size_t i = 0; i < num_elements; i++) {
-                auto it = indices.find(input_ptr[i]);
-                output_indices_ptr[i] = it->second;
-            }
+        if (return_inverse) {
+            parallel_for(num_elements, [&](size_t i) {
+                const float *it = std::lower_bound(output_uniques_ptr, output_uniques_ptr + num_unique_elements, input_ptr[i]);
+                output_indices_ptr[i] = static_cast<float>(it - output_uniques_ptr);
+            });
         }
 
-        // fill a tail with the latest unique element used as an end mark
-        size_t num_unique_elements = indices.size();
-        if ((num_elements - num_unique_elements) > 0) {
-            std::fill(output_uniques_ptr + num_unique_elements,
-                output_uniques_ptr + num_elements,
-                output_uniques_ptr[num_unique_elements - 1]);
+        return num_unique_elements;
+    }
+
+    // every thread finds the unique elements of its chunk in the order of their first occurrence,
+    // then the chunks are merged in their order, so the order of the first occurrences is kept
+    size_t unique_unsorted(const float *input_ptr, float *output_uniques_ptr, float *output_indices_ptr, float *output_counts_ptr) {
+        struct chunk_uniques {
+            size_t start = 0, end = 0;
+            std::unordered_map<float, size_t> local_indices;
+            std::vector<float> values;
+            std::vector<size_t> counts;
+            std::vector<size_t> global_indices;
+        };
+
+        const int nthr = static_cast<int>(std::max<size_t>(1, std::min<size_t>(parallel_get_max_threads(),
+                                                                                 num_elements / min_elements_per_thread)));
+        std::vector<chunk_uniques> chunks(nthr);
+        std::vector<size_t> local_inverse(return_inverse ? num_elements : 0);
+
+        parallel_nt(nthr, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(num_elements, nthr, ithr, start, end);
+            auto &chunk = chunks[ithr];
+            chunk.start = start;
+            chunk.end = end;
+            chunk.local_indices.reserve(end - start);
+            for (size_t i = start; i < end; i++) {
+                auto it = chunk.local_indices.emplace(input_ptr[i], chunk.values.size());
+                if (it.second) {
+                    chunk.values.push_back(input_ptr[i]);
+                    chunk.counts.push_back(1);
+                } else {
+                    chunk.counts[it.first->second]++;
+                }
+                if (return_inverse) {
+                    local_inverse[i] = it.first->second;
+                }
+            }
+        });
+
+        size_t num_unique_elements = 0;
+        std::unordered_map<float, size_t> indices;
+        indices.reserve(chunks[0].values.size());
+        for (auto &chunk : chunks) {
+            chunk.global_indices.resize(chunk.values.size());
+            for (size_t j = 0; j < chunk.values.size(); j++) {
+                auto it = indices.emplace(chunk.values[j], num_unique_elements);
+                if (it.second) {
+                    output_uniques_ptr[num_unique_elements] = chunk.values[j];
+                    if (return_counts) {
+                        output_counts_ptr[num_unique_elements] = static_cast<float>(chunk.counts[j]);
+                    }
+                    num_unique_elements++;
+                } else if (return_counts) {
+                    output_counts_ptr[it.first->second] += static_cast<float>(chunk.counts[j]);
+                }
+                chunk.global_indices[j] = it.first->second;
+            }
         }
 
-        // fill a tail for output buffer with counts
-        if (return_counts && (num_elements - num_unique_elements) > 0) {
-                std::fill(output_counts_ptr + num_unique_elements,
-                    output_counts_ptr + num_elements, 0.f);
+        if (return_inverse) {
+            // the chunks keep their bounds, since the threads of the second region may be split differently
+            parallel_for(chunks.size(), [&](size_t c) {
+                const auto &chunk = chunks[c];
+                for (size_t i = chunk.start; i < chunk.end; i++) {
+                    output_indices_ptr[i] = static_cast<float>(chunk.global_indices[local_inverse[i]]);
+                }
+            });
         }
 
-        return OK;
+        return num_unique_elements;
     }
 
-private:
+    // smaller chunks don't pay off the merge of their unique elements
+    static const size_t min_elements_per_thread = 4096;
+
     // attributes
     bool sorted;
     bool return_inverse;
@@ -4,13 +4,56 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief Log2 histogram of execution times: bucket 0 counts the times shorter than 1 us, bucket i the ones
+ * in [2^(i-1), 2^i) us. It is written by the stream executing the node and read by GetMetric without locks.
+ */
+class PerfHistogram {
+public:
+    static constexpr size_t bucketsNumber = 32;
+
+    PerfHistogram() {
+        for (auto& bucket : buckets)
+            bucket.store(0, std::memory_order_relaxed);
+    }
+
+    void add(uint64_t us) {
+        size_t bucket = 0;
+        while (us != 0 && bucket < bucketsNumber - 1) {
+            us >>= 1;
+            bucket++;
+        }
+        buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool empty() const {
+        for (auto& bucket : buckets)
+            if (bucket.load(std::memory_order_relaxed) != 0) return false;
+        return true;
+    }
+
+    /// @brief Adds the counts of the buckets to the ones of the result
+    void accumulate(std::vector<uint64_t>& result) const {
+        result.resize(bucketsNumber, 0);
+        for (size_t i = 0; i < bucketsNumber; i++)
+            result[i] += buckets[i].load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> buckets[bucketsNumber];
+};
+
 class PerfCount {
     uint64_t duration;
     uint32_t num;
+    PerfHistogram hist;
 
     std::chrono::high_resolution_clock::time_point __start;
     std::chrono::high_resolution_clock::time_point __finish;
@@ -20,6 +63,8 @@ public:
 
     uint64_t avg() { return (num == 0) ? 0 : duration / num; }
 
+    const PerfHistogram& histogram() const { return hist; }
+
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
@@ -28,8 +73,10 @@ private:
     void finish_itr() {
         __finish = std::chrono::high_resolution_clock::now();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        const uint64_t us = std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        duration += us;
         num++;
+        hist.add(us);
     }
 
     friend class PerfHelper;
@@ -37,13 +84,18 @@ private:
 
 class PerfHelper {
     PerfCount &counter;
+    const bool enabled;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    PerfHelper(PerfCount &count, bool enabled): counter(count), enabled(enabled) {
+        if (enabled) counter.start_itr();
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() {
+        if (enabled) counter.finish_itr();
+    }
 };
 
 }  // namespace MKLDNNPlugin
 
-#define PERF(_counter) PerfHelper __helper##__counter (_counter->PerfCounter());
+#define PERF(_counter, _enabled) PerfHelper __helper##__counter (_counter->PerfCounter(), _enabled);
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_convert.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "details/ie_exception.hpp"
+#include "ie_parallel.hpp"
+
+namespace MKLDNNPlugin {
+
+using namespace InferenceEngine;
+
+template <typename T>
+static void convert(const Blob::Ptr& src, float* dst) {
+    const TBlob<T>* t_blob = dynamic_cast<const TBlob<T>*>(src.get());
+    if (t_blob == nullptr)
+        THROW_IE_EXCEPTION << "input type is " << src->getTensorDesc().getPrecision() << " but input is not "
+                           << typeid(T).name();
+
+    const T* srcPtr = t_blob->readOnly();
+    if (srcPtr == nullptr)
+        THROW_IE_EXCEPTION << "Input data was not allocated.";
+
+    // blocks are big enough to amortize scheduling, while the inner loop is trivially vectorized by compiler
+    const size_t size = t_blob->size();
+    const size_t blockSize = 16 * 1024;
+    parallel_for((size + blockSize - 1) / blockSize, [&](size_t block) {
+        const size_t start = block * blockSize;
+        const size_t end = (std::min)(size, start + blockSize);
+        for (size_t i = start; i < end; i++)
+            dst[i] = static_cast<float>(srcPtr[i]);
+    });
+}
+
+void convertToFloat(const Blob::Ptr& src, float* dst) {
+    switch (src->getTensorDesc().getPrecision()) {
+        case Precision::U16:
+            convert<uint16_t>(src, dst);
+            break;
+        case Precision::I16:
+            convert<int16_t>(src, dst);
+            break;
+        case Precision::U8:
+            convert<uint8_t>(src, dst);
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Conversion to FP32 is not supported for precision "
+                               << src->getTensorDesc().getPrecision();
+    }
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,19 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_blob.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * Converts the data of U16, I16 or U8 blob to FP32 for the inputs which cannot be consumed by primitives directly.
+ * The work is split between threads of the current arena.
+ * @param src blob to convert
+ * @param dst buffer of at least src->size() floats
+ */
+void convertToFloat(const InferenceEngine::Blob::Ptr& src, float* dst);
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,525 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+
+#include "ie_preprocess_gapi_kernels.hpp"
+#include "ie_preprocess_gapi_kernels_impl.hpp"
+#include "ie_preprocess_gapi_kernels_avx2.hpp"
+
+#include <immintrin.h>
+
+namespace InferenceEngine {
+namespace gapi {
+namespace kernels {
+namespace avx {
+
+//------------------------------------------------------------------------------
+
+// NB: all loops below process the last incomplete chunk of a row by moving it
+// left so that it overlaps with the previous one, so rows must be not shorter
+// than a single chunk
+
+namespace {
+
+// s1 + (s0 - s1)*a, where a is Q0.15 weight of s0
+static inline __m256i v_blend(const __m256i& s0, const __m256i& s1, const __m256i& a) {
+    return _mm256_add_epi16(_mm256_mulhrs_epi16(_mm256_sub_epi16(s0, s1), a), s1);
+}
+
+// 16 x int16 -> 16 x uint8 with saturation
+static inline __m128i v_pack_u8(const __m256i& v) {
+    return _mm_packus_epi16(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+}
+
+// 8 x int32 and 8 x int32 -> 16 x int16 with saturation, order is kept
+static inline __m256i v_pack_s16(const __m256i& lo, const __m256i& hi) {
+    return _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+}
+
+// Byte masks of the 2nd and 3rd items of 3-channel pixels within each 16 bytes
+static inline __m256i v_mask_c1() {
+    return _mm256_setr_epi8(0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0,
+                            0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0);
+}
+
+static inline __m256i v_mask_c2() {
+    return _mm256_setr_epi8(0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0,
+                            0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0);
+}
+
+// Load 32 3-channel pixels and split them into planes
+static inline void v_load_deinterleave(const uint8_t* ptr, __m256i& a, __m256i& b, __m256i& c) {
+    // let each 128-bit lane keep 16 subsequent pixels
+    const __m128i* src = reinterpret_cast<const __m128i*>(ptr);
+    __m256i s0 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(src + 0)), _mm_loadu_si128(src + 3), 1);
+    __m256i s1 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(src + 1)), _mm_loadu_si128(src + 4), 1);
+    __m256i s2 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(src + 2)), _mm_loadu_si128(src + 5), 1);
+
+    const __m256i m1 = v_mask_c1();
+    const __m256i m2 = v_mask_c2();
+
+    // collect items of every channel in a register...
+    __m256i a0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s0, s1, m2), s2, m1);
+    __m256i b0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s1, s0, m1), s2, m2);
+    __m256i c0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s2, s0, m2), s1, m1);
+
+    // ...and put them in order
+    const __m256i sh_a = _mm256_setr_epi8(0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13,
+                                          0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13);
+    const __m256i sh_b = _mm256_setr_epi8(1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14,
+                                          1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14);
+    const __m256i sh_c = _mm256_setr_epi8(2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15,
+                                          2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15);
+    a = _mm256_shuffle_epi8(a0, sh_a);
+    b = _mm256_shuffle_epi8(b0, sh_b);
+    c = _mm256_shuffle_epi8(c0, sh_c);
+}
+
+// Merge 3 planes of 32 pixels and store them as 3-channel pixels
+static inline void v_store_interleave(uint8_t* ptr, const __m256i& a, const __m256i& b, const __m256i& c) {
+    const __m256i sh_a = _mm256_setr_epi8(0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5,
+                                          0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5);
+    const __m256i sh_b = _mm256_setr_epi8(5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10,
+                                          5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10);
+    const __m256i sh_c = _mm256_setr_epi8(10, 5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15,
+                                          10, 5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15);
+    __m256i a0 = _mm256_shuffle_epi8(a, sh_a);
+    __m256i b0 = _mm256_shuffle_epi8(b, sh_b);
+    __m256i c0 = _mm256_shuffle_epi8(c, sh_c);
+
+    const __m256i m1 = v_mask_c1();
+    const __m256i m2 = v_mask_c2();
+
+    // each 128-bit lane of p0, p1, p2 keeps 1st, 2nd and 3rd 16 bytes of 16 subsequent pixels
+    __m256i p0 = _mm256_blendv_epi8(_mm256_blendv_epi8(a0, b0, m1), c0, m2);
+    __m256i p1 = _mm256_blendv_epi8(_mm256_blendv_epi8(b0, c0, m1), a0, m2);
+    __m256i p2 = _mm256_blendv_epi8(_mm256_blendv_epi8(c0, a0, m1), b0, m2);
+
+    __m256i* dst = reinterpret_cast<__m256i*>(ptr);
+    _mm256_storeu_si256(dst + 0, _mm256_permute2x128_si256(p0, p1, 0x20));
+    _mm256_storeu_si256(dst + 1, _mm256_permute2x128_si256(p2, p0, 0x30));
+    _mm256_storeu_si256(dst + 2, _mm256_permute2x128_si256(p1, p2, 0x31));
+}
+
+// vertical pass: dst[w] = src0[w]*beta + src1[w]*(1 - beta)
+static void calcRowLinear_8U_vertical(uint8_t dst[], const uint8_t src0[], const uint8_t src1[],
+                                      short beta, int length) {
+    GAPI_DbgAssert(length >= 16);
+    const __m256i b = _mm256_set1_epi16(beta);
+
+    for (int w = 0; w < length; ) {
+        for (; w <= length - 16; w += 16) {
+            __m256i s0 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src0[w])));
+            __m256i s1 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src1[w])));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[w]), v_pack_u8(v_blend(s0, s1, b)));
+        }
+
+        if (w < length) {
+            w = length - 16;
+        }
+    }
+}
+
+// load 16 pairs of pixels src[index[k]], src[index[k] + 1] as uint16
+static inline __m256i v_gather_pairs(const uint8_t src[], const short index[]) {
+    auto pair = [&](int k) { return *reinterpret_cast<const uint16_t*>(&src[index[k]]); };
+    return _mm256_setr_epi16(pair(0), pair(1), pair(2),  pair(3),  pair(4),  pair(5),  pair(6),  pair(7),
+                             pair(8), pair(9), pair(10), pair(11), pair(12), pair(13), pair(14), pair(15));
+}
+
+// horizontal pass: dst[x] = src[sx]*alpha[x] + src[sx + 1]*(1 - alpha[x]), where sx = mapsx[x]
+static void calcRowLinear_8UC1_horizontal(uint8_t dst[], const uint8_t src[], const short alpha[],
+                                          const short mapsx[], int length) {
+    GAPI_DbgAssert(length >= 16);
+    const __m256i mask = _mm256_set1_epi16(0xFF);
+
+    for (int x = 0; x < length; ) {
+        for (; x <= length - 16; x += 16) {
+            __m256i pairs = v_gather_pairs(src, &mapsx[x]);
+            __m256i t0 = _mm256_and_si256(pairs, mask);
+            __m256i t1 = _mm256_srli_epi16(pairs, 8);
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&alpha[x]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[x]), v_pack_u8(v_blend(t0, t1, a)));
+        }
+
+        if (x < length) {
+            x = length - 16;
+        }
+    }
+}
+
+// vertical pass of 4 rows at once, the result is stored interleaved: tmp[4*w + l] is w'th pixel of l'th row
+static void calcRowLinear_8UC1_vertical4(uint8_t tmp[], const uint8_t *src0[], const uint8_t *src1[],
+                                         const short beta[], bool yRatioEq1, int length) {
+    GAPI_DbgAssert(length >= 16);
+    __m256i b[4];
+    for (int l = 0; l < 4; l++) {
+        b[l] = _mm256_set1_epi16(beta[l]);
+    }
+
+    for (int w = 0; w < length; ) {
+        for (; w <= length - 16; w += 16) {
+            __m128i r[4];
+            for (int l = 0; l < 4; l++) {
+                __m128i s0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src0[l][w]));
+                if (yRatioEq1) {
+                    r[l] = s0;
+                } else {
+                    __m128i s1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src1[l][w]));
+                    r[l] = v_pack_u8(v_blend(_mm256_cvtepu8_epi16(s0), _mm256_cvtepu8_epi16(s1), b[l]));
+                }
+            }
+
+            __m128i r01lo = _mm_unpacklo_epi8(r[0], r[1]);
+            __m128i r01hi = _mm_unpackhi_epi8(r[0], r[1]);
+            __m128i r23lo = _mm_unpacklo_epi8(r[2], r[3]);
+            __m128i r23hi = _mm_unpackhi_epi8(r[2], r[3]);
+
+            __m128i* dst = reinterpret_cast<__m128i*>(&tmp[4*w]);
+            _mm_storeu_si128(dst + 0, _mm_unpacklo_epi16(r01lo, r23lo));
+            _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(r01lo, r23lo));
+            _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(r01hi, r23hi));
+            _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(r01hi, r23hi));
+        }
+
+        if (w < length) {
+            w = length - 16;
+        }
+    }
+}
+
+// horizontal pass of chanNum-channel pixels into chanNum planes:
+// dst[c][x] = src[sx][c]*alpha[x] + src[sx + 1][c]*(1 - alpha[x]), where sx = mapsx[x]
+// (4 rows interleaved by calcRowLinear_8UC1_vertical4() are processed as 4-channel pixels)
+template<int chanNum>
+static void calcRowLinear_8UC_horizontal(uint8_t *dst[], const uint8_t src[], const short alpha[],
+                                         const short mapsx[], int length) {
+    static_assert(chanNum == 3 || chanNum == 4, "unsupported number of channels");
+    GAPI_DbgAssert(length >= 16);
+
+    // qword at pixel sx keeps both sx and sx + 1 pixels, for 3 channels it is taken 2 bytes before
+    // the pixel not to read beyond the end of the row (src follows other scratch data in memory)
+    const int offset = chanNum == 3 ? -2 : 0;
+    const __m256i pairs = chanNum == 3 ?
+        _mm256_setr_epi8(2, 5, 10, 13, 3, 6, 11, 14, 4, 7, 12, 15, -1, -1, -1, -1,
+                         2, 5, 10, 13, 3, 6, 11, 14, 4, 7, 12, 15, -1, -1, -1, -1) :
+        _mm256_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+                         0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+
+    const __m256i mask = _mm256_set1_epi16(0xFF);
+
+    for (int x = 0; x < length; ) {
+        for (; x <= length - 16; x += 16) {
+            // let c'th dword of j'th lane of v[k] keep pixel pairs of c'th channel for outputs 8j + 2k and
+            // 8j + 2k + 1, so that the transpose below puts the outputs of every channel in order
+            auto pixels = [&](int k) {
+                return *reinterpret_cast<const int64_t*>(&src[chanNum * mapsx[x + k] + offset]);
+            };
+            __m256i v[4];
+            for (int k = 0; k < 4; k++) {
+                v[k] = _mm256_shuffle_epi8(_mm256_setr_epi64x(pixels(2*k),     pixels(2*k + 1),
+                                                              pixels(2*k + 8), pixels(2*k + 9)), pairs);
+            }
+
+            __m256i v01lo = _mm256_unpacklo_epi32(v[0], v[1]);
+            __m256i v01hi = _mm256_unpackhi_epi32(v[0], v[1]);
+            __m256i v23lo = _mm256_unpacklo_epi32(v[2], v[3]);
+            __m256i v23hi = _mm256_unpackhi_epi32(v[2], v[3]);
+
+            __m256i chans[4] = {_mm256_unpacklo_epi64(v01lo, v23lo), _mm256_unpackhi_epi64(v01lo, v23lo),
+                                _mm256_unpacklo_epi64(v01hi, v23hi), _mm256_unpackhi_epi64(v01hi, v23hi)};
+
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&alpha[x]));
+            for (int c = 0; c < chanNum; c++) {
+                __m256i t0 = _mm256_and_si256(chans[c], mask);
+                __m256i t1 = _mm256_srli_epi16(chans[c], 8);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[c][x]), v_pack_u8(v_blend(t0, t1, a)));
+            }
+        }
+
+        if (x < length) {
+            x = length - 16;
+        }
+    }
+}
+
+template<int chanNum>
+static void calcRowLinear_8UC_Impl(std::array<std::array<uint8_t*, 4>, chanNum> &dst,
+                             const uint8_t *src0[],
+                             const uint8_t *src1[],
+                             const short    alpha[],
+                             const short    mapsx[],
+                             const short    beta[],
+                                   uint8_t  tmp[],
+                             const Size    &inSz,
+                             const Size    &outSz,
+                                   int      lpi) {
+    const int length = inSz.width * chanNum;
+
+    for (int l = 0; l < lpi; l++) {
+        uint8_t* row = tmp + l * length;
+        if (inSz.height == outSz.height) {
+            memcpy(row, src0[l], length);
+        } else {
+            calcRowLinear_8U_vertical(row, src0[l], src1[l], beta[l], length);
+        }
+
+        uint8_t* planes[chanNum];
+        for (int c = 0; c < chanNum; c++) {
+            planes[c] = dst[c][l];
+        }
+        calcRowLinear_8UC_horizontal<chanNum>(planes, row, alpha, mapsx, outSz.width);
+    }
+}
+
+// 2 x int16 planes of even and odd pixels -> uint8 plane
+static inline __m256i v_pack_even_odd(const __m256i& even, const __m256i& odd) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i max = _mm256_set1_epi16(255);
+    __m256i e = _mm256_min_epi16(_mm256_max_epi16(even, zero), max);
+    __m256i o = _mm256_min_epi16(_mm256_max_epi16(odd,  zero), max);
+    return _mm256_or_si256(e, _mm256_slli_epi16(o, 8));
+}
+
+static const int ITUR_BT_601_CY = 1220542;
+static const int ITUR_BT_601_CUB = 2116026;
+static const int ITUR_BT_601_CUG = -409993;
+static const int ITUR_BT_601_CVG = -852492;
+static const int ITUR_BT_601_CVR = 1673527;
+static const int ITUR_BT_601_SHIFT = 20;
+
+// (y - 16)*CY + uv >> SHIFT for 16 pixels, uv coefficients are for two halves of them
+static inline __m256i v_yuv_to_channel(const __m256i& y, const __m256i& uv0, const __m256i& uv1) {
+    const __m256i cy = _mm256_set1_epi32(ITUR_BT_601_CY);
+    __m256i y0 = _mm256_mullo_epi32(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(y)), cy);
+    __m256i y1 = _mm256_mullo_epi32(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(y, 1)), cy);
+    return v_pack_s16(_mm256_srai_epi32(_mm256_add_epi32(y0, uv0), ITUR_BT_601_SHIFT),
+                      _mm256_srai_epi32(_mm256_add_epi32(y1, uv1), ITUR_BT_601_SHIFT));
+}
+
+static inline void uvToRGBuv(const uchar u, const uchar v, int& ruv, int& guv, int& buv) {
+    int uu, vv;
+    uu = static_cast<int>(u) - 128;
+    vv = static_cast<int>(v) - 128;
+
+    ruv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVR * vv;
+    guv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVG * vv + ITUR_BT_601_CUG * uu;
+    buv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CUB * uu;
+}
+
+static inline void yRGBuvToRGB(const uchar vy, const int ruv, const int guv, const int buv,
+                                uchar& r, uchar& g, uchar& b) {
+    int yy = static_cast<int>(vy);
+    int y = std::max(0, yy - 16) * ITUR_BT_601_CY;
+    r = saturate_cast<uchar>((y + ruv) >> ITUR_BT_601_SHIFT);
+    g = saturate_cast<uchar>((y + guv) >> ITUR_BT_601_SHIFT);
+    b = saturate_cast<uchar>((y + buv) >> ITUR_BT_601_SHIFT);
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+// Resize (bi-linear, 8U)
+void calcRowLinear_8UC1(uint8_t *dst[],
+                  const uint8_t *src0[],
+                  const uint8_t *src1[],
+                  const short    alpha[],
+                  const short    mapsx[],
+                  const short    beta[],
+                        uint8_t  tmp[],
+                  const Size   & inSz,
+                  const Size   & outSz,
+                        int      lpi) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    if (4 == lpi && !xRatioEq1) {
+        calcRowLinear_8UC1_vertical4(tmp, src0, src1, beta, yRatioEq1, inSz.width);
+        calcRowLinear_8UC_horizontal<4>(dst, tmp, alpha, mapsx, outSz.width);
+        return;
+    }
+
+    for (int l = 0; l < lpi; l++) {
+        // vertical pass goes directly to the destination if there is nothing to do horizontally,
+        // otherwise the row is kept in the temporary buffer
+        uint8_t* row = xRatioEq1 ? dst[l] : tmp + l * inSz.width;
+        if (yRatioEq1) {
+            memcpy(row, src0[l], inSz.width);
+        } else {
+            calcRowLinear_8U_vertical(row, src0[l], src1[l], beta[l], inSz.width);
+        }
+
+        if (!xRatioEq1) {
+            calcRowLinear_8UC1_horizontal(dst[l], row, alpha, mapsx, outSz.width);
+        }
+    }
+}
+
+// Resize (bi-linear, 8UC3)
+void calcRowLinear_8UC(std::array<std::array<uint8_t*, 4>, 3> &dst,
+                  const uint8_t *src0[],
+                  const uint8_t *src1[],
+                  const short    alpha[],
+                  const short    mapsx[],
+                  const short    beta[],
+                        uint8_t  tmp[],
+                  const Size    &inSz,
+                  const Size    &outSz,
+                        int      lpi) {
+    calcRowLinear_8UC_Impl<3>(dst, src0, src1, alpha, mapsx, beta, tmp, inSz, outSz, lpi);
+}
+
+// Resize (bi-linear, 8UC4)
+void calcRowLinear_8UC(std::array<std::array<uint8_t*, 4>, 4> &dst,
+                  const uint8_t *src0[],
+                  const uint8_t *src1[],
+                  const short    alpha[],
+                  const short    mapsx[],
+                  const short    beta[],
+                        uint8_t  tmp[],
+                  const Size    &inSz,
+                  const Size    &outSz,
+                        int      lpi) {
+    calcRowLinear_8UC_Impl<4>(dst, src0, src1, alpha, mapsx, beta, tmp, inSz, outSz, lpi);
+}
+
+//------------------------------------------------------------------------------
+
+void mergeRow_8UC3(const uint8_t in0[],
+                   const uint8_t in1[],
+                   const uint8_t in2[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    if (length >= 32) {
+        for (; l < length; ) {
+            for (; l <= length - 32; l += 32) {
+                __m256i r0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in0[l]));
+                __m256i r1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in1[l]));
+                __m256i r2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in2[l]));
+                v_store_interleave(&out[3*l], r0, r1, r2);
+            }
+
+            if (l < length) {
+                l = length - 32;
+            }
+        }
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void splitRow_8UC3(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                         uint8_t out2[],
+                             int length) {
+    int l = 0;
+
+    if (length >= 32) {
+        for (; l < length; ) {
+            for (; l <= length - 32; l += 32) {
+                __m256i r0, r1, r2;
+                v_load_deinterleave(&in[3*l], r0, r1, r2);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out0[l]), r0);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out1[l]), r1);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out2[l]), r2);
+            }
+
+            if (l < length) {
+                l = length - 32;
+            }
+        }
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void calculate_nv12_to_rgb(const  uchar **srcY,
+                           const  uchar *srcUV,
+                                  uchar **dstRGBx,
+                                    int width) {
+    int i = 0;
+
+    const __m256i mask = _mm256_set1_epi16(0xFF);
+    const __m256i v16  = _mm256_set1_epi16(16);
+    const __m256i v128 = _mm256_set1_epi16(128);
+
+    const __m256i vshift = _mm256_set1_epi32(1 << (ITUR_BT_601_SHIFT - 1));
+    const __m256i vr = _mm256_set1_epi32(ITUR_BT_601_CVR);
+    const __m256i vg = _mm256_set1_epi32(ITUR_BT_601_CVG);
+    const __m256i ug = _mm256_set1_epi32(ITUR_BT_601_CUG);
+    const __m256i ub = _mm256_set1_epi32(ITUR_BT_601_CUB);
+
+    // 16 (u, v) pairs and 2 rows of 32 pixels per iteration
+    for ( ; i <= width - 32; i += 32) {
+        __m256i uv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(srcUV + i));
+        __m256i u = _mm256_sub_epi16(_mm256_and_si256(uv, mask), v128);
+        __m256i v = _mm256_sub_epi16(_mm256_srli_epi16(uv, 8), v128);
+
+        __m256i uu[2] = {_mm256_cvtepi16_epi32(_mm256_castsi256_si128(u)),
+                         _mm256_cvtepi16_epi32(_mm256_extracti128_si256(u, 1))};
+        __m256i vv[2] = {_mm256_cvtepi16_epi32(_mm256_castsi256_si128(v)),
+                         _mm256_cvtepi16_epi32(_mm256_extracti128_si256(v, 1))};
+
+        __m256i ruv[2], guv[2], buv[2];
+        for (int k = 0; k < 2; k++) {
+            ruv[k] = _mm256_add_epi32(vshift, _mm256_mullo_epi32(vr, vv[k]));
+            guv[k] = _mm256_add_epi32(_mm256_add_epi32(vshift, _mm256_mullo_epi32(vg, vv[k])),
+                                      _mm256_mullo_epi32(ug, uu[k]));
+            buv[k] = _mm256_add_epi32(vshift, _mm256_mullo_epi32(ub, uu[k]));
+        }
+
+        for (int y = 0; y < 2; y++) {
+            // even and odd pixels share (u, v) pair, max(0, y - 16) as uint16
+            __m256i py = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(srcY[y] + i));
+            __m256i ye = _mm256_subs_epu16(_mm256_and_si256(py, mask), v16);
+            __m256i yo = _mm256_subs_epu16(_mm256_srli_epi16(py, 8), v16);
+
+            __m256i r = v_pack_even_odd(v_yuv_to_channel(ye, ruv[0], ruv[1]), v_yuv_to_channel(yo, ruv[0], ruv[1]));
+            __m256i g = v_pack_even_odd(v_yuv_to_channel(ye, guv[0], guv[1]), v_yuv_to_channel(yo, guv[0], guv[1]));
+            __m256i b = v_pack_even_odd(v_yuv_to_channel(ye, buv[0], buv[1]), v_yuv_to_channel(yo, buv[0], buv[1]));
+
+            v_store_interleave(dstRGBx[y] + 3*i, r, g, b);
+        }
+    }
+
+    for (; i < width; i += 2) {
+        uchar u = srcUV[i];
+        uchar v = srcUV[i + 1];
+        int ruv, guv, buv;
+        uvToRGBuv(u, v, ruv, guv, buv);
+
+        for (int y = 0; y < 2; y++) {
+            for (int x = 0; x < 2; x++) {
+                uchar vy = srcY[y][i + x];
+                uchar r, g, b;
+                yRGBuvToRGB(vy, ruv, guv, buv, r, g, b);
+
+                dstRGBx[y][3*(i + x)]     = r;
+                dstRGBx[y][3*(i + x) + 1] = g;
+                dstRGBx[y][3*(i + x) + 2] = b;
+            }
+        }
+    }
+}
+
+}  // namespace avx
+}  // namespace kernels
+}  // namespace gapi
+}  // namespace InferenceEngine
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_preprocess_gapi_kernels.hpp"
+#include "ie_preprocess_gapi_kernels_impl.hpp"
+
+#include <array>
+
+namespace InferenceEngine {
+namespace gapi {
+namespace kernels {
+namespace avx {
+
+// Minimal width of input and output rows supported by the resize code below
+constexpr int resizeMinWidth = 16;
+
+//----------------------------------------------------------------------
+
+// Resize (bi-linear, 8U)
+void calcRowLinear_8UC1(uint8_t *dst[],
+                  const uint8_t *src0[],
+                  const uint8_t *src1[],
+                  const short    alpha[],
+                  const short    mapsx[],
+                  const short    beta[],
+                        uint8_t  tmp[],
+                  const Size   & inSz,
+                  const Size   & outSz,
+                        int      lpi);
+
+// Resize (bi-linear, 8UC3)
+void calcRowLinear_8UC(std::array<std::array<uint8_t*, 4>, 3> &dst,
+                  const uint8_t *src0[],
+                  const uint8_t *src1[],
+                  const short    alpha[],
+                  const short    mapsx[],
+                  const short    beta[],
+                        uint8_t  tmp[],
+                  const Size    &inSz,
+                  const Size    &outSz,
+                        int      lpi);
+
+// Resize (bi-linear, 8UC4)
+void calcRowLinear_8UC(std::array<std::array<uint8_t*, 4>, 4> &dst,
+                  const uint8_t *src0[],
+                  const uint8_t *src1[],
+                  const short    alpha[],
+                  const short    mapsx[],
+                  const short    beta[],
+                        uint8_t  tmp[],
+                  const Size    &inSz,
+                  const Size    &outSz,
+                        int      lpi);
+
+//----------------------------------------------------------------------
+
+void mergeRow_8UC3(const uint8_t in0[],
+                   const uint8_t in1[],
+                   const uint8_t in2[],
+                         uint8_t out[],
+                             int length);
+
+void splitRow_8UC3(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                         uint8_t out2[],
+                             int length);
+
+void calculate_nv12_to_rgb(const  uchar **srcY,
+                           const  uchar *srcUV,
+                                  uchar **dstRGBx,
+                                    int width);
+
+}  // namespace avx
+}  // namespace kernels
+}  // namespace gapi
+}  // namespace InferenceEngine
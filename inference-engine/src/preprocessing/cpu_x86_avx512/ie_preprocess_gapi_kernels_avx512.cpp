@@ -0,0 +1,527 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+
+#include "ie_preprocess_gapi_kernels.hpp"
+#include "ie_preprocess_gapi_kernels_impl.hpp"
+#include "ie_preprocess_gapi_kernels_avx512.hpp"
+
+#include <immintrin.h>
+
+namespace InferenceEngine {
+namespace gapi {
+namespace kernels {
+namespace avx512 {
+
+//------------------------------------------------------------------------------
+
+// NB: all loops below process the last incomplete chunk of a row by moving it
+// left so that it overlaps with the previous one, so rows must be not shorter
+// than a single chunk
+
+namespace {
+
+// s1 + (s0 - s1)*a, where a is Q0.15 weight of s0
+static inline __m512i v_blend(const __m512i& s0, const __m512i& s1, const __m512i& a) {
+    return _mm512_add_epi16(_mm512_mulhrs_epi16(_mm512_sub_epi16(s0, s1), a), s1);
+}
+
+// 32 x int16 -> 32 x uint8, values are expected to be in range already (as blending of uint8 is)
+static inline __m256i v_pack_u8(const __m512i& v) {
+    return _mm512_cvtepi16_epi8(v);
+}
+
+static inline __m512i v_load_u8(const uint8_t* ptr) {
+    return _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));
+}
+
+static inline __m512i v_combine(const __m256i& lo, const __m256i& hi) {
+    return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+}
+
+// Byte masks of the 2nd and 3rd items of 3-channel pixels within each 16 bytes
+static const __mmask64 mask_c1 = 0x2492249224922492;
+static const __mmask64 mask_c2 = 0x4924492449244924;
+
+static inline __m512i v_shuffle(const __m512i& v, const __m128i& mask) {
+    return _mm512_shuffle_epi8(v, _mm512_broadcast_i32x4(mask));
+}
+
+// Load 64 3-channel pixels and split them into planes
+static inline void v_load_deinterleave(const uint8_t* ptr, __m512i& a, __m512i& b, __m512i& c) {
+    const __m512i* src = reinterpret_cast<const __m512i*>(ptr);
+    __m512i r0 = _mm512_loadu_si512(src + 0);
+    __m512i r1 = _mm512_loadu_si512(src + 1);
+    __m512i r2 = _mm512_loadu_si512(src + 2);
+
+    // let each 128-bit lane keep 16 subsequent pixels:
+    // s0, s1, s2 are made of 16-byte chunks 0, 3, 6, 9 / 1, 4, 7, 10 / 2, 5, 8, 11 of the input
+    __m512i s0 = _mm512_permutex2var_epi64(r0, _mm512_setr_epi64(0, 1, 6, 7, 12, 13, 0, 0), r1);
+    __m512i s1 = _mm512_permutex2var_epi64(r0, _mm512_setr_epi64(2, 3, 8, 9, 14, 15, 0, 0), r1);
+    __m512i s2 = _mm512_permutex2var_epi64(r0, _mm512_setr_epi64(4, 5, 10, 11, 0, 0, 0, 0), r1);
+    s0 = _mm512_mask_permutexvar_epi64(s0, 0xC0, _mm512_setr_epi64(0, 0, 0, 0, 0, 0, 2, 3), r2);
+    s1 = _mm512_mask_permutexvar_epi64(s1, 0xC0, _mm512_setr_epi64(0, 0, 0, 0, 0, 0, 4, 5), r2);
+    s2 = _mm512_mask_permutexvar_epi64(s2, 0xF0, _mm512_setr_epi64(0, 0, 0, 0, 0, 1, 6, 7), r2);
+
+    // collect items of every channel in a register...
+    __m512i a0 = _mm512_mask_blend_epi8(mask_c1, _mm512_mask_blend_epi8(mask_c2, s0, s1), s2);
+    __m512i b0 = _mm512_mask_blend_epi8(mask_c2, _mm512_mask_blend_epi8(mask_c1, s1, s0), s2);
+    __m512i c0 = _mm512_mask_blend_epi8(mask_c1, _mm512_mask_blend_epi8(mask_c2, s2, s0), s1);
+
+    // ...and put them in order
+    a = v_shuffle(a0, _mm_setr_epi8(0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13));
+    b = v_shuffle(b0, _mm_setr_epi8(1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14));
+    c = v_shuffle(c0, _mm_setr_epi8(2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15));
+}
+
+// Merge 3 planes of 64 pixels and store them as 3-channel pixels
+static inline void v_store_interleave(uint8_t* ptr, const __m512i& a, const __m512i& b, const __m512i& c) {
+    __m512i a0 = v_shuffle(a, _mm_setr_epi8(0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5));
+    __m512i b0 = v_shuffle(b, _mm_setr_epi8(5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10));
+    __m512i c0 = v_shuffle(c, _mm_setr_epi8(10, 5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15));
+
+    // each 128-bit lane of p0, p1, p2 keeps 1st, 2nd and 3rd 16 bytes of 16 subsequent pixels
+    __m512i p0 = _mm512_mask_blend_epi8(mask_c2, _mm512_mask_blend_epi8(mask_c1, a0, b0), c0);
+    __m512i p1 = _mm512_mask_blend_epi8(mask_c2, _mm512_mask_blend_epi8(mask_c1, b0, c0), a0);
+    __m512i p2 = _mm512_mask_blend_epi8(mask_c2, _mm512_mask_blend_epi8(mask_c1, c0, a0), b0);
+
+    // put the lanes back in the order of p0, p1, p2 for every 16 pixels
+    __m512i r0 = _mm512_permutex2var_epi64(p0, _mm512_setr_epi64(0, 1, 8, 9, 0, 0, 2, 3), p1);
+    __m512i r1 = _mm512_permutex2var_epi64(p0, _mm512_setr_epi64(10, 11, 0, 0, 4, 5, 12, 13), p1);
+    __m512i r2 = _mm512_permutex2var_epi64(p0, _mm512_setr_epi64(0, 0, 6, 7, 14, 15, 0, 0), p1);
+    r0 = _mm512_mask_permutexvar_epi64(r0, 0x30, _mm512_setr_epi64(0, 0, 0, 0, 0, 1, 0, 0), p2);
+    r1 = _mm512_mask_permutexvar_epi64(r1, 0x0C, _mm512_setr_epi64(0, 0, 2, 3, 0, 0, 0, 0), p2);
+    r2 = _mm512_mask_permutexvar_epi64(r2, 0xC3, _mm512_setr_epi64(4, 5, 0, 0, 0, 0, 6, 7), p2);
+
+    __m512i* dst = reinterpret_cast<__m512i*>(ptr);
+    _mm512_storeu_si512(dst + 0, r0);
+    _mm512_storeu_si512(dst + 1, r1);
+    _mm512_storeu_si512(dst + 2, r2);
+}
+
+// vertical pass: dst[w] = src0[w]*beta + src1[w]*(1 - beta)
+static void calcRowLinear_8U_vertical(uint8_t dst[], const uint8_t src0[], const uint8_t src1[],
+                                      short beta, int length) {
+    GAPI_DbgAssert(length >= 32);
+    const __m512i b = _mm512_set1_epi16(beta);
+
+    for (int w = 0; w < length; ) {
+        for (; w <= length - 32; w += 32) {
+            __m512i s0 = v_load_u8(&src0[w]);
+            __m512i s1 = v_load_u8(&src1[w]);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[w]), v_pack_u8(v_blend(s0, s1, b)));
+        }
+
+        if (w < length) {
+            w = length - 32;
+        }
+    }
+}
+
+// load 16 pairs of pixels src[index[k]], src[index[k] + 1] as uint16
+static inline __m256i v_gather_pairs(const uint8_t src[], const short index[]) {
+    auto pair = [&](int k) { return *reinterpret_cast<const uint16_t*>(&src[index[k]]); };
+    return _mm256_setr_epi16(pair(0), pair(1), pair(2),  pair(3),  pair(4),  pair(5),  pair(6),  pair(7),
+                             pair(8), pair(9), pair(10), pair(11), pair(12), pair(13), pair(14), pair(15));
+}
+
+// horizontal pass: dst[x] = src[sx]*alpha[x] + src[sx + 1]*(1 - alpha[x]), where sx = mapsx[x]
+static void calcRowLinear_8UC1_horizontal(uint8_t dst[], const uint8_t src[], const short alpha[],
+                                          const short mapsx[], int length) {
+    GAPI_DbgAssert(length >= 32);
+    const __m512i mask = _mm512_set1_epi16(0xFF);
+
+    for (int x = 0; x < length; ) {
+        for (; x <= length - 32; x += 32) {
+            __m512i pairs = v_combine(v_gather_pairs(src, &mapsx[x]), v_gather_pairs(src, &mapsx[x + 16]));
+            __m512i t0 = _mm512_and_si512(pairs, mask);
+            __m512i t1 = _mm512_srli_epi16(pairs, 8);
+            __m512i a = _mm512_loadu_si512(&alpha[x]);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[x]), v_pack_u8(v_blend(t0, t1, a)));
+        }
+
+        if (x < length) {
+            x = length - 32;
+        }
+    }
+}
+
+// vertical pass of 4 rows at once, the result is stored interleaved: tmp[4*w + l] is w'th pixel of l'th row
+static void calcRowLinear_8UC1_vertical4(uint8_t tmp[], const uint8_t *src0[], const uint8_t *src1[],
+                                         const short beta[], bool yRatioEq1, int length) {
+    GAPI_DbgAssert(length >= 32);
+    __m512i b[4];
+    for (int l = 0; l < 4; l++) {
+        b[l] = _mm512_set1_epi16(beta[l]);
+    }
+
+    for (int w = 0; w < length; ) {
+        for (; w <= length - 32; w += 32) {
+            __m256i r[4];
+            for (int l = 0; l < 4; l++) {
+                if (yRatioEq1) {
+                    r[l] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src0[l][w]));
+                } else {
+                    r[l] = v_pack_u8(v_blend(v_load_u8(&src0[l][w]), v_load_u8(&src1[l][w]), b[l]));
+                }
+            }
+
+            // unpacking goes within 128-bit lanes, so i'th result keeps pixels 4i..4i + 3 and 16 + 4i..16 + 4i + 3
+            __m256i r01lo = _mm256_unpacklo_epi8(r[0], r[1]);
+            __m256i r01hi = _mm256_unpackhi_epi8(r[0], r[1]);
+            __m256i r23lo = _mm256_unpacklo_epi8(r[2], r[3]);
+            __m256i r23hi = _mm256_unpackhi_epi8(r[2], r[3]);
+
+            __m256i q0 = _mm256_unpacklo_epi16(r01lo, r23lo);
+            __m256i q1 = _mm256_unpackhi_epi16(r01lo, r23lo);
+            __m256i q2 = _mm256_unpacklo_epi16(r01hi, r23hi);
+            __m256i q3 = _mm256_unpackhi_epi16(r01hi, r23hi);
+
+            __m256i* dst = reinterpret_cast<__m256i*>(&tmp[4*w]);
+            _mm256_storeu_si256(dst + 0, _mm256_permute2x128_si256(q0, q1, 0x20));
+            _mm256_storeu_si256(dst + 1, _mm256_permute2x128_si256(q2, q3, 0x20));
+            _mm256_storeu_si256(dst + 2, _mm256_permute2x128_si256(q0, q1, 0x31));
+            _mm256_storeu_si256(dst + 3, _mm256_permute2x128_si256(q2, q3, 0x31));
+        }
+
+        if (w < length) {
+            w = length - 32;
+        }
+    }
+}
+
+// horizontal pass of chanNum-channel pixels into chanNum planes:
+// dst[c][x] = src[sx][c]*alpha[x] + src[sx + 1][c]*(1 - alpha[x]), where sx = mapsx[x]
+// (4 rows interleaved by calcRowLinear_8UC1_vertical4() are processed as 4-channel pixels)
+template<int chanNum>
+static void calcRowLinear_8UC_horizontal(uint8_t *dst[], const uint8_t src[], const short alpha[],
+                                         const short mapsx[], int length) {
+    static_assert(chanNum == 3 || chanNum == 4, "unsupported number of channels");
+    GAPI_DbgAssert(length >= 32);
+
+    // qword at pixel sx keeps both sx and sx + 1 pixels, for 3 channels it is taken 2 bytes before
+    // the pixel not to read beyond the end of the row (src follows other scratch data in memory)
+    const int offset = chanNum == 3 ? -2 : 0;
+    const __m512i pairs = _mm512_broadcast_i32x4(chanNum == 3 ?
+        _mm_setr_epi8(2, 5, 10, 13, 3, 6, 11, 14, 4, 7, 12, 15, -1, -1, -1, -1) :
+        _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15));
+
+    const __m512i mask = _mm512_set1_epi16(0xFF);
+
+    for (int x = 0; x < length; ) {
+        for (; x <= length - 32; x += 32) {
+            // let c'th dword of j'th lane of v[k] keep pixel pairs of c'th channel for outputs 8j + 2k and
+            // 8j + 2k + 1, so that the transpose below puts the outputs of every channel in order
+            auto pixels = [&](int k) {
+                return *reinterpret_cast<const int64_t*>(&src[chanNum * mapsx[x + k] + offset]);
+            };
+            __m512i v[4];
+            for (int k = 0; k < 4; k++) {
+                v[k] = _mm512_shuffle_epi8(_mm512_setr_epi64(pixels(2*k),      pixels(2*k + 1),
+                                                             pixels(2*k + 8),  pixels(2*k + 9),
+                                                             pixels(2*k + 16), pixels(2*k + 17),
+                                                             pixels(2*k + 24), pixels(2*k + 25)), pairs);
+            }
+
+            __m512i v01lo = _mm512_unpacklo_epi32(v[0], v[1]);
+            __m512i v01hi = _mm512_unpackhi_epi32(v[0], v[1]);
+            __m512i v23lo = _mm512_unpacklo_epi32(v[2], v[3]);
+            __m512i v23hi = _mm512_unpackhi_epi32(v[2], v[3]);
+
+            __m512i chans[4] = {_mm512_unpacklo_epi64(v01lo, v23lo), _mm512_unpackhi_epi64(v01lo, v23lo),
+                                _mm512_unpacklo_epi64(v01hi, v23hi), _mm512_unpackhi_epi64(v01hi, v23hi)};
+
+            __m512i a = _mm512_loadu_si512(&alpha[x]);
+            for (int c = 0; c < chanNum; c++) {
+                __m512i t0 = _mm512_and_si512(chans[c], mask);
+                __m512i t1 = _mm512_srli_epi16(chans[c], 8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[c][x]), v_pack_u8(v_blend(t0, t1, a)));
+            }
+        }
+
+        if (x < length) {
+            x = length - 32;
+        }
+    }
+}
+
+template<int chanNum>
+static void calcRowLinear_8UC_Impl(std::array<std::array<uint8_t*, 4>, chanNum> &dst,
+                             const uint8_t *src0[],
+                             const uint8_t *src1[],
+                             const short    alpha[],
+                             const short    mapsx[],
+                             const short    beta[],
+                                   uint8_t  tmp[],
+                             const Size    &inSz,
+                             const Size    &outSz,
+                                   int      lpi) {
+    const int length = inSz.width * chanNum;
+
+    for (int l = 0; l < lpi; l++) {
+        uint8_t* row = tmp + l * length;
+        if (inSz.height == outSz.height) {
+            memcpy(row, src0[l], length);
+        } else {
+            calcRowLinear_8U_vertical(row, src0[l], src1[l], beta[l], length);
+        }
+
+        uint8_t* planes[chanNum];
+        for (int c = 0; c < chanNum; c++) {
+            planes[c] = dst[c][l];
+        }
+        calcRowLinear_8UC_horizontal<chanNum>(planes, row, alpha, mapsx, outSz.width);
+    }
+}
+
+// 2 x int16 planes of even and odd pixels -> uint8 plane
+static inline __m512i v_pack_even_odd(const __m512i& even, const __m512i& odd) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i max = _mm512_set1_epi16(255);
+    __m512i e = _mm512_min_epi16(_mm512_max_epi16(even, zero), max);
+    __m512i o = _mm512_min_epi16(_mm512_max_epi16(odd,  zero), max);
+    return _mm512_or_si512(e, _mm512_slli_epi16(o, 8));
+}
+
+static const int ITUR_BT_601_CY = 1220542;
+static const int ITUR_BT_601_CUB = 2116026;
+static const int ITUR_BT_601_CUG = -409993;
+static const int ITUR_BT_601_CVG = -852492;
+static const int ITUR_BT_601_CVR = 1673527;
+static const int ITUR_BT_601_SHIFT = 20;
+
+// (y - 16)*CY + uv >> SHIFT for 32 pixels, uv coefficients are for two halves of them
+static inline __m512i v_yuv_to_channel(const __m512i& y, const __m512i& uv0, const __m512i& uv1) {
+    const __m512i cy = _mm512_set1_epi32(ITUR_BT_601_CY);
+    __m512i y0 = _mm512_mullo_epi32(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(y)), cy);
+    __m512i y1 = _mm512_mullo_epi32(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(y, 1)), cy);
+    return v_combine(_mm512_cvtsepi32_epi16(_mm512_srai_epi32(_mm512_add_epi32(y0, uv0), ITUR_BT_601_SHIFT)),
+                     _mm512_cvtsepi32_epi16(_mm512_srai_epi32(_mm512_add_epi32(y1, uv1), ITUR_BT_601_SHIFT)));
+}
+
+static inline void uvToRGBuv(const uchar u, const uchar v, int& ruv, int& guv, int& buv) {
+    int uu, vv;
+    uu = static_cast<int>(u) - 128;
+    vv = static_cast<int>(v) - 128;
+
+    ruv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVR * vv;
+    guv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVG * vv + ITUR_BT_601_CUG * uu;
+    buv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CUB * uu;
+}
+
+static inline void yRGBuvToRGB(const uchar vy, const int ruv, const int guv, const int buv,
+                                uchar& r, uchar& g, uchar& b) {
+    int yy = static_cast<int>(vy);
+    int y = std::max(0, yy - 16) * ITUR_BT_601_CY;
+    r = saturate_cast<uchar>((y + ruv) >> ITUR_BT_601_SHIFT);
+    g = saturate_cast<uchar>((y + guv) >> ITUR_BT_601_SHIFT);
+    b = saturate_cast<uchar>((y + buv) >> ITUR_BT_601_SHIFT);
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+// Resize (bi-linear, 8U)
+void calcRowLinear_8UC1(uint8_t *dst[],
+                  const uint8_t *src0[],
+                  const uint8_t *src1[],
+                  const short    alpha[],
+                  const short    mapsx[],
+                  const short    beta[],
+                        uint8_t  tmp[],
+                  const Size   & inSz,
+                  const Size   & outSz,
+                        int      lpi) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    if (4 == lpi && !xRatioEq1) {
+        calcRowLinear_8UC1_vertical4(tmp, src0, src1, beta, yRatioEq1, inSz.width);
+        calcRowLinear_8UC_horizontal<4>(dst, tmp, alpha, mapsx, outSz.width);
+        return;
+    }
+
+    for (int l = 0; l < lpi; l++) {
+        // vertical pass goes directly to the destination if there is nothing to do horizontally,
+        // otherwise the row is kept in the temporary buffer
+        uint8_t* row = xRatioEq1 ? dst[l] : tmp + l * inSz.width;
+        if (yRatioEq1) {
+            memcpy(row, src0[l], inSz.width);
+        } else {
+            calcRowLinear_8U_vertical(row, src0[l], src1[l], beta[l], inSz.width);
+        }
+
+        if (!xRatioEq1) {
+            calcRowLinear_8UC1_horizontal(dst[l], row, alpha, mapsx, outSz.width);
+        }
+    }
+}
+
+// Resize (bi-linear, 8UC3)
+void calcRowLinear_8UC(std::array<std::array<uint8_t*, 4>, 3> &dst,
+                  const uint8_t *src0[],
+                  const uint8_t *src1[],
+                  const short    alpha[],
+                  const short    mapsx[],
+                  const short    beta[],
+                        uint8_t  tmp[],
+                  const Size    &inSz,
+                  const Size    &outSz,
+                        int      lpi) {
+    calcRowLinear_8UC_Impl<3>(dst, src0, src1, alpha, mapsx, beta, tmp, inSz, outSz, lpi);
+}
+
+// Resize (bi-linear, 8UC4)
+void calcRowLinear_8UC(std::array<std::array<uint8_t*, 4>, 4> &dst,
+                  const uint8_t *src0[],
+                  const uint8_t *src1[],
+                  const short    alpha[],
+                  const short    mapsx[],
+                  const short    beta[],
+                        uint8_t  tmp[],
+                  const Size    &inSz,
+                  const Size    &outSz,
+                        int      lpi) {
+    calcRowLinear_8UC_Impl<4>(dst, src0, src1, alpha, mapsx, beta, tmp, inSz, outSz, lpi);
+}
+
+//------------------------------------------------------------------------------
+
+void mergeRow_8UC3(const uint8_t in0[],
+                   const uint8_t in1[],
+                   const uint8_t in2[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    if (length >= 64) {
+        for (; l < length; ) {
+            for (; l <= length - 64; l += 64) {
+                __m512i r0 = _mm512_loadu_si512(&in0[l]);
+                __m512i r1 = _mm512_loadu_si512(&in1[l]);
+                __m512i r2 = _mm512_loadu_si512(&in2[l]);
+                v_store_interleave(&out[3*l], r0, r1, r2);
+            }
+
+            if (l < length) {
+                l = length - 64;
+            }
+        }
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void splitRow_8UC3(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                         uint8_t out2[],
+                             int length) {
+    int l = 0;
+
+    if (length >= 64) {
+        for (; l < length; ) {
+            for (; l <= length - 64; l += 64) {
+                __m512i r0, r1, r2;
+                v_load_deinterleave(&in[3*l], r0, r1, r2);
+                _mm512_storeu_si512(&out0[l], r0);
+                _mm512_storeu_si512(&out1[l], r1);
+                _mm512_storeu_si512(&out2[l], r2);
+            }
+
+            if (l < length) {
+                l = length - 64;
+            }
+        }
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void calculate_nv12_to_rgb(const  uchar **srcY,
+                           const  uchar *srcUV,
+                                  uchar **dstRGBx,
+                                    int width) {
+    int i = 0;
+
+    const __m512i mask = _mm512_set1_epi16(0xFF);
+    const __m512i v16  = _mm512_set1_epi16(16);
+    const __m512i v128 = _mm512_set1_epi16(128);
+
+    const __m512i vshift = _mm512_set1_epi32(1 << (ITUR_BT_601_SHIFT - 1));
+    const __m512i vr = _mm512_set1_epi32(ITUR_BT_601_CVR);
+    const __m512i vg = _mm512_set1_epi32(ITUR_BT_601_CVG);
+    const __m512i ug = _mm512_set1_epi32(ITUR_BT_601_CUG);
+    const __m512i ub = _mm512_set1_epi32(ITUR_BT_601_CUB);
+
+    // 32 (u, v) pairs and 2 rows of 64 pixels per iteration
+    for ( ; i <= width - 64; i += 64) {
+        __m512i uv = _mm512_loadu_si512(srcUV + i);
+        __m512i u = _mm512_sub_epi16(_mm512_and_si512(uv, mask), v128);
+        __m512i v = _mm512_sub_epi16(_mm512_srli_epi16(uv, 8), v128);
+
+        __m512i uu[2] = {_mm512_cvtepi16_epi32(_mm512_castsi512_si256(u)),
+                         _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(u, 1))};
+        __m512i vv[2] = {_mm512_cvtepi16_epi32(_mm512_castsi512_si256(v)),
+                         _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(v, 1))};
+
+        __m512i ruv[2], guv[2], buv[2];
+        for (int k = 0; k < 2; k++) {
+            ruv[k] = _mm512_add_epi32(vshift, _mm512_mullo_epi32(vr, vv[k]));
+            guv[k] = _mm512_add_epi32(_mm512_add_epi32(vshift, _mm512_mullo_epi32(vg, vv[k])),
+                                      _mm512_mullo_epi32(ug, uu[k]));
+            buv[k] = _mm512_add_epi32(vshift, _mm512_mullo_epi32(ub, uu[k]));
+        }
+
+        for (int y = 0; y < 2; y++) {
+            // even and odd pixels share (u, v) pair, max(0, y - 16) as uint16
+            __m512i py = _mm512_loadu_si512(srcY[y] + i);
+            __m512i ye = _mm512_subs_epu16(_mm512_and_si512(py, mask), v16);
+            __m512i yo = _mm512_subs_epu16(_mm512_srli_epi16(py, 8), v16);
+
+            __m512i r = v_pack_even_odd(v_yuv_to_channel(ye, ruv[0], ruv[1]), v_yuv_to_channel(yo, ruv[0], ruv[1]));
+            __m512i g = v_pack_even_odd(v_yuv_to_channel(ye, guv[0], guv[1]), v_yuv_to_channel(yo, guv[0], guv[1]));
+            __m512i b = v_pack_even_odd(v_yuv_to_channel(ye, buv[0], buv[1]), v_yuv_to_channel(yo, buv[0], buv[1]));
+
+            v_store_interleave(dstRGBx[y] + 3*i, r, g, b);
+        }
+    }
+
+    for (; i < width; i += 2) {
+        uchar u = srcUV[i];
+        uchar v = srcUV[i + 1];
+        int ruv, guv, buv;
+        uvToRGBuv(u, v, ruv, guv, buv);
+
+        for (int y = 0; y < 2; y++) {
+            for (int x = 0; x < 2; x++) {
+                uchar vy = srcY[y][i + x];
+                uchar r, g, b;
+                yRGBuvToRGB(vy, ruv, guv, buv, r, g, b);
+
+                dstRGBx[y][3*(i + x)]     = r;
+                dstRGBx[y][3*(i + x) + 1] = g;
+                dstRGBx[y][3*(i + x) + 2] = b;
+            }
+        }
+    }
+}
+
+}  // namespace avx512
+}  // namespace kernels
+}  // namespace gapi
+}  // namespace InferenceEngine
@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <algorithm>
+#include <chrono>
 
 namespace InferenceEngine {
 
@@ -750,6 +751,38 @@ void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorith
 
 using namespace Resize;
 
+namespace {
+
+// Converts the planar blob to FP32 subtracting mean and applying scale of each channel
+template<typename T>
+void normalize(const Blob::Ptr &src, Blob::Ptr &dst, const PreProcessInfo &info) {
+    const auto &dims = dst->getTensorDesc().getDims();
+    const size_t N = dims[0], C = dims[1], HW = dims[2] * dims[3];
+    const bool nhwc = dst->getTensorDesc().getLayout() == NHWC;
+    const bool with_info = info.getNumberOfChannels() == C;
+
+    const T *in = src->cbuffer().as<const T*>();
+    float *out = dst->buffer().as<float*>();
+
+    for (size_t n = 0; n < N; n++) {
+        for (size_t c = 0; c < C; c++) {
+            const float scale = with_info ? info[c]->stdScale : 1.f;
+            const float mean_value = with_info && info.getMeanVariant() == MEAN_VALUE ? info[c]->meanValue : 0.f;
+            const float *mean_image = with_info && info.getMeanVariant() == MEAN_IMAGE ?
+                                      info[c]->meanData->cbuffer().as<const float*>() : nullptr;
+
+            const T *in_plane = in + (n * C + c) * HW;
+            for (size_t i = 0; i < HW; i++) {
+                const float mean = mean_image ? mean_image[i] : mean_value;
+                const size_t out_idx = nhwc ? (n * HW + i) * C + c : (n * C + c) * HW + i;
+                out[out_idx] = (static_cast<float>(in_plane[i]) - mean) * scale;
+            }
+        }
+    }
+}
+
+}  // namespace
+
 
 /**
  * @brief This class stores pre-process information for exact input
@@ -771,18 +804,30 @@ class PreProcessData : public IPreProcessData {
     InferenceEngine::ProfilingTask perf_resize {"Resize"};
     InferenceEngine::ProfilingTask perf_reorder_before {"Reorder before"};
     InferenceEngine::ProfilingTask perf_reorder_after {"Reorder after"};
+    InferenceEngine::ProfilingTask perf_normalize {"Normalize"};
     InferenceEngine::ProfilingTask perf_preprocessing {"Preprocessing"};
 
+    // timing of the last execute() call, reported to the performance counters
+    bool _executed = false;
+    bool _executedWithGAPI = false;
+    long long _lastExecTime_uSec = 0;
+
+    bool executeImpl(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize, bool normalize);
+
 public:
     void setRoiBlob(const Blob::Ptr &blob) override;
 
     Blob::Ptr getRoiBlob() const override;
 
-    void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) override;
+    void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1,
+                 bool normalize = false) override;
 
     void Release() noexcept override;
 
     void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) override;
+
+    void getPerformanceCounts(const std::string &name,
+                              std::map<std::string, InferenceEngineProfileInfo> &perfMap) const override;
 };
 
 StatusCode CreatePreProcessData(IPreProcessData *& data, ResponseDesc */*resp*/) noexcept {
@@ -803,13 +848,24 @@ Blob::Ptr PreProcessData::getRoiBlob() const {
 }
 
 void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial,
-        int batchSize) {
+        int batchSize, bool normalize) {
     IE_PROFILING_AUTO_SCOPE_TASK(perf_preprocessing)
 
+    const auto start = std::chrono::high_resolution_clock::now();
+    _executedWithGAPI = executeImpl(outBlob, info, serial, batchSize, normalize);
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    _lastExecTime_uSec = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    _executed = true;
+}
+
+// returns true if the input has been pre-processed with G-API
+bool PreProcessData::executeImpl(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial,
+        int batchSize, bool normalize) {
     auto algorithm = info.getResizeAlgorithm();
     auto fmt = info.getColorFormat();
 
-    if (algorithm == NO_RESIZE && fmt == ColorFormat::RAW) {
+    if (algorithm == NO_RESIZE && fmt == ColorFormat::RAW && !info.hasROI()) {
        THROW_IE_EXCEPTION << "Input pre-processing is called without the pre-processing info set: "
                              "there's nothing to be done";
     }
@@ -823,8 +879,18 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
     if (!_preproc) {
         _preproc.reset(new PreprocEngine);
     }
-    if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, fmt, serial, batchSize)) {
-        return;
+    const ROI *roi = info.hasROI() ? &info.getROI() : nullptr;
+    const PreProcessInfo *norm_info = normalize ? &info : nullptr;
+    const float pad_value = info.getLetterboxPadValue();
+    const float *letterbox_pad = info.hasLetterbox() ? &pad_value : nullptr;
+    if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, fmt, serial, batchSize, roi, norm_info,
+                                     letterbox_pad)) {
+        return true;
+    }
+
+    if (info.hasLetterbox()) {
+        THROW_IE_EXCEPTION << "Letterbox resize is unsupported in this mode. "
+                              "Use G-API pre-processing instead to letterbox inputs.";
     }
 
     if (batchSize > 1) {
@@ -838,29 +904,39 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
                               "formats.";
     }
 
+    if (algorithm == NO_RESIZE) {
+        THROW_IE_EXCEPTION << "ROI without resize is unsupported in this mode. "
+                              "Use default pre-processing instead to crop inputs.";
+    }
+
+    // the resize code below works with strides, so it reads only the region of a ROI blob
+    Blob::Ptr src = roi ? make_shared_blob(_roiBlob, *roi) : _roiBlob;
+
     Blob::Ptr res_in, res_out;
-    if (_roiBlob->getTensorDesc().getLayout() == NHWC) {
-        if (!_tmp1 || _tmp1->size() != _roiBlob->size()) {
-            if (_roiBlob->getTensorDesc().getPrecision() == Precision::FP32) {
-                _tmp1 = make_shared_blob<float>({Precision::FP32, _roiBlob->getTensorDesc().getDims(), Layout::NCHW});
+    if (src->getTensorDesc().getLayout() == NHWC) {
+        if (!_tmp1 || _tmp1->size() != src->size()) {
+            if (src->getTensorDesc().getPrecision() == Precision::FP32) {
+                _tmp1 = make_shared_blob<float>({Precision::FP32, src->getTensorDesc().getDims(), Layout::NCHW});
             } else {
-                _tmp1 = make_shared_blob<uint8_t>({Precision::U8, _roiBlob->getTensorDesc().getDims(), Layout::NCHW});
+                _tmp1 = make_shared_blob<uint8_t>({Precision::U8, src->getTensorDesc().getDims(), Layout::NCHW});
             }
             _tmp1->allocate();
         }
 
         {
             IE_PROFILING_AUTO_SCOPE_TASK(perf_reorder_before)
-            blob_copy(_roiBlob, _tmp1);
+            blob_copy(src, _tmp1);
         }
         res_in = _tmp1;
     } else {
-        res_in = _roiBlob;
+        res_in = src;
     }
 
-    if (outBlob->getTensorDesc().getLayout() == NHWC) {
-        if (!_tmp2 || _tmp2->size() != outBlob->size()) {
-            if (outBlob->getTensorDesc().getPrecision() == Precision::FP32) {
+    // normalization is done as a separate pass over the resized input in this mode
+    const auto res_precision = normalize ? src->getTensorDesc().getPrecision() : outBlob->getTensorDesc().getPrecision();
+    if (outBlob->getTensorDesc().getLayout() == NHWC || normalize) {
+        if (!_tmp2 || _tmp2->size() != outBlob->size() || _tmp2->getTensorDesc().getPrecision() != res_precision) {
+            if (res_precision == Precision::FP32) {
                 _tmp2 = make_shared_blob<float>({Precision::FP32, outBlob->getTensorDesc().getDims(), Layout::NCHW});
             } else {
                 _tmp2 = make_shared_blob<uint8_t>({Precision::U8, outBlob->getTensorDesc().getDims(), Layout::NCHW});
@@ -877,10 +953,47 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
         resize(res_in, res_out, algorithm);
     }
 
-    if (res_out == _tmp2) {
+    if (normalize) {
+        IE_PROFILING_AUTO_SCOPE_TASK(perf_normalize)
+        if (res_precision == Precision::FP32) {
+            InferenceEngine::normalize<float>(_tmp2, outBlob, info);
+        } else {
+            InferenceEngine::normalize<uint8_t>(_tmp2, outBlob, info);
+        }
+    } else if (res_out == _tmp2) {
         IE_PROFILING_AUTO_SCOPE_TASK(perf_reorder_after)
         blob_copy(_tmp2, outBlob);
     }
+    return false;
+}
+
+void PreProcessData::getPerformanceCounts(const std::string &name,
+                                          std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
+    if (_executed) {
+        InferenceEngineProfileInfo &pc = perfMap[name + "_preprocessing"];
+        pc.status = InferenceEngineProfileInfo::EXECUTED;
+        pc.realTime_uSec = pc.cpu_uSec = _lastExecTime_uSec;
+        pc.execution_index = 0;
+        std::string execType = _executedWithGAPI ? std::string("gapi_") + PreprocEngine::kernelsISA() : "legacy";
+        execType.copy(pc.exec_type, sizeof(pc.exec_type) - 1, 0);
+        std::string("Preprocessing").copy(pc.layer_type, sizeof(pc.layer_type) - 1, 0);
+    }
+
+    // cache counters are available only if G-API pre-processing was used
+    if (!_preproc || !PreprocEngine::useGAPI()) {
+        return;
+    }
+
+    std::size_t hits = 0, misses = 0;
+    _preproc->getCacheStats(hits, misses);
+
+    InferenceEngineProfileInfo &pc = perfMap[name + "_preprocessing_cache"];
+    pc.status = InferenceEngineProfileInfo::EXECUTED;
+    pc.realTime_uSec = pc.cpu_uSec = 0;
+    pc.execution_index = 0;
+    std::string execType = "hits: " + std::to_string(hits) + ", misses: " + std::to_string(misses);
+    execType.copy(pc.exec_type, sizeof(pc.exec_type) - 1, 0);
+    std::string("Preprocessing").copy(pc.layer_type, sizeof(pc.layer_type) - 1, 0);
 }
 
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
@@ -52,10 +52,24 @@ public:
      * @param info pre-processing info that specifies resize algorithm and color format.
      * @param serial disable OpenMP threading if the value set to true.
      * @param batchSize batch size for pre-processing.
+     * @param normalize convert the output to FP32 subtracting the mean and applying the scale from the
+     * pre-processing info. The output blob must be FP32 then.
      */
-    virtual void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) = 0;
+    virtual void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1,
+                         bool normalize = false) = 0;
 
     virtual void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) = 0;
+
+    /**
+     * @brief Adds pre-processing counters of an input to the performance counters map.
+     * Time of the last pre-processing call is reported as "<input name>_preprocessing" entry with
+     * the execution type naming the path taken (e.g. "gapi_avx2"), usage of the compiled graphs
+     * cache is reported as "<input name>_preprocessing_cache" entry.
+     * @param name input name the pre-processing is done for.
+     * @param perfMap performance counters map.
+     */
+    virtual void getPerformanceCounts(const std::string &name,
+                                      std::map<std::string, InferenceEngineProfileInfo> &perfMap) const = 0;
 };
 
 INFERENCE_PRERPOC_PLUGIN_API(StatusCode) CreatePreProcessData(IPreProcessData *& data, ResponseDesc *resp) noexcept;
@@ -76,6 +76,7 @@ inline int get_cv_depth(const TensorDesc &ie_desc) {
     switch (ie_desc.getPrecision()) {
     case Precision::U8:   return CV_8U;
     case Precision::FP32: return CV_32F;
+    case Precision::FP16: return CV_16S;  // FP16 values are kept as 16-bit words, written by normalization only
     default: THROW_IE_EXCEPTION << "Unsupported data type";
     }
 }
@@ -224,6 +225,26 @@ std::vector<cv::GMat> merge(const std::vector<cv::GMat>& inputs,
     return interleaved;
 }
 
+// convert planes to FP32 (or FP16) subtracting the mean (either a value or an image) and applying the scale
+std::vector<cv::GMat> normalize(const std::vector<cv::GMat>& planes,
+                                const std::vector<cv::GMat>& mean_images,
+                                const std::vector<float>& mean_values,
+                                const std::vector<float>& scales,
+                                int depth) {
+    std::vector<cv::GMat> normalized;
+    normalized.reserve(planes.size());
+    for (size_t c = 0; c < planes.size(); c++) {
+        const float scale = scales.empty() ? 1.f : scales[c];
+        if (!mean_images.empty()) {
+            normalized.emplace_back(gapi::NormalizePlaneImage::on(planes[c], mean_images[c], scale, depth));
+        } else {
+            const float mean = mean_values.empty() ? 0.f : mean_values[c];
+            normalized.emplace_back(gapi::NormalizePlane::on(planes[c], mean, scale, depth));
+        }
+    }
+    return normalized;
+}
+
 // validate input/output ColorFormat-related parameters
 void validateColorFormats(const G::Desc &in_desc,
                           const G::Desc &out_desc,
@@ -349,6 +370,112 @@ void validateBlob(const I420Blob::Ptr &inBlob) {
     validateTensorDesc(v_blob->getTensorDesc());
 }
 
+bool is_yuv420(ColorFormat fmt) {
+    return fmt == ColorFormat::NV12 || fmt == ColorFormat::I420;
+}
+
+void validateROI(const ROI &roi, const G::Desc &in_desc, ColorFormat in_fmt) {
+    if (roi.sizeX == 0 || roi.sizeY == 0
+        || roi.posX + roi.sizeX > static_cast<size_t>(in_desc.d.W)
+        || roi.posY + roi.sizeY > static_cast<size_t>(in_desc.d.H)) {
+        THROW_IE_EXCEPTION << "ROI [" << roi.posX << ", " << roi.posY << ", "
+                           << roi.sizeX << "x" << roi.sizeY << "] "
+                           << "does not fit into the input blob of size " << in_desc.d.W << "x" << in_desc.d.H;
+    }
+    // chroma planes of YUV420 images are sub-sampled by 2 in both dimensions
+    if (is_yuv420(in_fmt) && (roi.posX % 2 || roi.posY % 2 || roi.sizeX % 2 || roi.sizeY % 2)) {
+        THROW_IE_EXCEPTION << "ROI of " << in_fmt << " input blob must have even coordinates and sizes";
+    }
+}
+
+// Narrows down the input planes to the region of interest, so the graph reads only its pixels
+void cropToROI(std::vector<std::vector<cv::gapi::own::Mat>> &batched_plane_mats, const ROI &roi,
+               ColorFormat in_fmt) {
+    using cv::gapi::own::Rect;
+    const Rect rect {static_cast<int>(roi.posX),  static_cast<int>(roi.posY),
+                     static_cast<int>(roi.sizeX), static_cast<int>(roi.sizeY)};
+    const Rect half {rect.x / 2, rect.y / 2, rect.width / 2, rect.height / 2};
+
+    for (auto &planes : batched_plane_mats) {
+        for (size_t i = 0; i < planes.size(); i++) {
+            const bool subsampled = i > 0 && is_yuv420(in_fmt);
+            planes[i] = planes[i](subsampled ? half : rect);
+        }
+    }
+}
+
+void cropToLetterbox(std::vector<cv::gapi::own::Mat> &plane_mats, const LetterboxInfo &box) {
+    using cv::gapi::own::Rect;
+    const Rect rect {static_cast<int>(box.posX),  static_cast<int>(box.posY),
+                     static_cast<int>(box.sizeX), static_cast<int>(box.sizeY)};
+    for (auto &plane : plane_mats) {
+        plane = plane(rect);
+    }
+}
+
+// Fills the network's input around the letterboxed image. The pad value goes through the same
+// normalization as the image does, so the padding looks as if it was a part of the input.
+void padLetterbox(const std::vector<std::vector<cv::gapi::own::Mat>> &batched_plane_mats,
+                  const LetterboxInfo &box, float pad_value, MeanVariant mean_variant,
+                  const std::vector<float> &mean_values, const std::vector<float> &scales,
+                  const std::vector<cv::gapi::own::Mat> &mean_images, int batch_size, bool omp_serial) {
+    const int rows = batched_plane_mats[0][0].rows;
+    const int cols = batched_plane_mats[0][0].cols;
+    const int box_x0 = static_cast<int>(box.posX), box_x1 = static_cast<int>(box.posX + box.sizeX);
+    const int box_y0 = static_cast<int>(box.posY), box_y1 = static_cast<int>(box.posY + box.sizeY);
+
+    const auto value = [&](int c, int y, int x) {
+        float mean = 0.f;
+        if (mean_variant == MEAN_VALUE) {
+            mean = mean_values[c];
+        } else if (mean_variant == MEAN_IMAGE) {
+            mean = reinterpret_cast<const float*>(mean_images[c].ptr(y))[x];
+        }
+        return (pad_value - mean) * (scales.empty() ? 1.f : scales[c]);
+    };
+
+    const auto pad_row = [&](int i, int y) {
+        std::vector<float> values;
+        const auto& planes = batched_plane_mats[i];
+        for (size_t p = 0; p < planes.size(); p++) {
+            auto plane = planes[p];
+            const int chan = plane.channels();
+            const int first_chan = chan == 1 ? static_cast<int>(p) : 0;  // planar or interleaved
+            const auto pad = [&](int from, int to) {
+                if (from >= to) return;
+                values.resize((to - from) * chan);
+                for (int x = from; x < to; x++) {
+                    for (int c = 0; c < chan; c++) {
+                        values[(x - from) * chan + c] = value(first_chan + c, y, x);
+                    }
+                }
+                gapi::padRow(values.data(), plane.ptr(y, from), plane.depth(), (to - from) * chan);
+            };
+            if (y < box_y0 || y >= box_y1) {
+                pad(0, cols);
+            } else {
+                pad(0, box_x0);
+                pad(box_x1, cols);
+            }
+        }
+    };
+
+#if IE_THREAD == IE_THREAD_OMP
+    if (omp_serial) {
+        for (int i = 0; i < batch_size; i++) {
+            for (int y = 0; y < rows; y++) {
+                pad_row(i, y);
+            }
+        }
+        return;
+    }
+#endif
+    // to suppress unused warnings
+    (void)(omp_serial);
+
+    parallel_for2d(batch_size, rows, pad_row);
+}
+
 const std::pair<const TensorDesc&, Layout> getTensorDescAndLayout(const MemoryBlob::Ptr &blob) {
     const auto& desc =  blob->getTensorDesc();
     return {desc, desc.getLayout()};
@@ -542,7 +669,11 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
                             ColorFormat output_color_format,
-                            int precision) {
+                            int precision,
+                            int out_precision,
+                            MeanVariant mean_variant,
+                            const std::vector<float>& mean_values,
+                            const std::vector<float>& scales) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
@@ -554,6 +685,19 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         inputs.resize(in_desc.d.C);
     }
 
+    // mean images are passed as additional (planar) inputs following the image ones
+    std::vector<cv::GMat> mean_images(mean_variant == MEAN_IMAGE ? out_desc.d.C : 0);
+
+    // normalization (or just conversion to FP32/FP16) is done by the last step before merging
+    // the planes, so the result is written to the network's input once
+    const bool convert = out_precision != precision;
+    const bool with_normalization = convert || mean_variant != NONE || !scales.empty();
+    const auto graph_inputs = [&]() {
+        std::vector<cv::GMat> all_inputs = inputs;
+        all_inputs.insert(all_inputs.end(), mean_images.begin(), mean_images.end());
+        return all_inputs;
+    };
+
     // specific pre-processing case:
     // 1. Requires interleaved image of type CV_8UC3/CV_8UC4 (except for NV12/I420 input)
     // 2. Supports bilinear resize only
@@ -602,13 +746,17 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             std::reverse(planes.begin(), planes.end());
         }
 
+        if (with_normalization) {
+            planes = normalize(planes, mean_images, mean_values, scales, out_precision);
+        }
+
         std::vector<cv::GMat> outputs;
         if (out_layout == NHWC) {
             outputs.emplace_back(gapi::Merge3::on(planes[0], planes[1], planes[2]));
         } else {
             outputs = planes;
         }
-        return cv::GComputation(inputs, outputs);
+        return cv::GComputation(graph_inputs(), outputs);
     }
 
     auto planes = convertColorPlanar(inputs, in_desc, in_layout, out_layout,
@@ -630,6 +778,8 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             switch (ar) {
             case RESIZE_AREA:     return cv::INTER_AREA;
             case RESIZE_BILINEAR: return cv::INTER_LINEAR;
+            case RESIZE_NEAREST:  return cv::INTER_NEAREST;
+            case RESIZE_CUBIC:    return cv::INTER_CUBIC;
             default: THROW_IE_EXCEPTION << "Unsupported resize operation";
             }
         } (algorithm);
@@ -645,40 +795,44 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         outputs = planes;
     }
 
+    if (with_normalization) {
+        outputs = normalize(outputs, mean_images, mean_values, scales, out_precision);
+    }
+
     // convert to interleaved if NHWC is required as output
     if (out_layout == NHWC) {
         outputs = merge(outputs, out_desc.d.C);
     }
 
-    return cv::GComputation(inputs, outputs);
+    return cv::GComputation(graph_inputs(), outputs);
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+constexpr std::size_t PreprocEngine::_maxCacheSize;
+
+PreprocEngine::PreprocEngine() = default;
 
-PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
+PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &lastCall, const CallDesc &newCallOrig) {
     // Given our knowledge about Fluid, full graph rebuild is required
     // if and only if:
-    // 0. This is the first call ever
     // 1. precision has changed (affects kernel versions)
     // 2. layout has changed (affects graph topology)
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
-    if (!_lastCall) {
-        return Update::REBUILD;
-    }
-
+    // 6. normalization has changed (mean and scale values are kernels' parameters)
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    NormDesc last_norm;
+    std::tie(last_in, last_out, last_algo, last_norm) = lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    NormDesc new_norm;
+    std::tie(new_in, new_out, new_algo, new_norm) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -694,7 +848,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo || last_norm != new_norm) {
         return Update::REBUILD;
     }
 
@@ -736,6 +890,10 @@ bool PreprocEngine::useGAPI() {
     return !NO_GAPI;
 }
 
+const char* PreprocEngine::kernelsISA() {
+    return gapi::preprocKernelsISA();
+}
+
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
@@ -772,6 +930,11 @@ void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr
     }
 }
 
+void PreprocEngine::getCacheStats(std::size_t &hits, std::size_t &misses) const {
+    hits = _cacheHits;
+    misses = _cacheMisses;
+}
+
 int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
     if (batch == 0) {
         THROW_IE_EXCEPTION << "Input pre-processing is called with invalid batch size " << batch;
@@ -792,7 +955,19 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
     return batch;
 }
 
+PreprocEngine::Tiling PreprocEngine::getTiling(int batch_size, int threads) {
+    // Whole items are the cheapest tiles since Fluid does not process the rows shared by
+    // neighbouring slices twice then. Take as many item groups as the batch allows, such that
+    // all threads get the same number of row slices.
+    int item_groups = std::max(std::min(batch_size, threads), 1);
+    while (threads % item_groups != 0) {
+        item_groups--;
+    }
+    return Tiling{item_groups, std::max(threads / item_groups, 1)};
+}
+
 void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+    std::vector<cv::GCompiled>& compiledTiles, const Tiling& tiling,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
     std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
     Update update) {
@@ -806,69 +981,79 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     // to suppress unused warnings
     (void)(omp_serial);
 
-    // Split the whole graph into `total_slices` slices, where
-    // `total_slices` is provided by the parallel runtime and assumed
-    // to be number of threads used.  However it is not guaranteed
-    // that an actual number of threads will be as assumed, so it
-    // possible that all slices are processed by the same thread.
-    //
-    parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
-        IE_PROFILING_AUTO_SCOPE_TASK(_perf_exec_tile);
+    IE_ASSERT(compiledTiles.size() == static_cast<size_t>(tiling.tiles()));
 
-        auto& compiled = _lastComp[slice_n];
-        if (Update::REBUILD == update || Update::RESHAPE == update) {
-            //  need to compile (or reshape) own object for a particular ROI
-            IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_compiling);
+    // Split the whole batch into `tiling.tiles()` tiles, where the number of tiles is
+    // assumed to be the number of threads used. However it is not guaranteed that an
+    // actual number of threads will be as assumed, so every thread processes each
+    // `total_threads`-th tile (possibly all tiles are processed by the same thread).
+    //
+    parallel_nt_static(thread_num, [&, this](int thread_n, const int total_threads) {
+        for (int tile_n = thread_n; tile_n < tiling.tiles(); tile_n += total_threads) {
+            IE_PROFILING_AUTO_SCOPE_TASK(_perf_exec_tile);
 
-            using cv::gapi::own::Rect;
+            const int group_n = tile_n / tiling.row_slices;
+            const int slice_n = tile_n % tiling.row_slices;
+            if (group_n >= batch_size) continue;  // no job for current tile
 
             // current design implies all images in batch are equal
-            const auto& input_plane_mats = batched_input_plane_mats[0];
-            const auto& output_plane_mats = batched_output_plane_mats[0];
+            const auto& output_rows = batched_output_plane_mats[0][0].rows;
 
-            auto lines_per_thread = output_plane_mats[0].rows / total_slices;
-            const auto remainder = output_plane_mats[0].rows % total_slices;
+            auto lines_per_slice = output_rows / tiling.row_slices;
+            const auto remainder = output_rows % tiling.row_slices;
 
-            // remainder shows how many threads must calculate 1 additional row. now these additions
+            // remainder shows how many slices must calculate 1 additional row. now these additions
             // must also be addressed in rect's Y coordinate:
             int roi_y = 0;
             if (slice_n < remainder) {
-                lines_per_thread++;  // 1 additional row
-                roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
+                lines_per_slice++;  // 1 additional row
+                roi_y = slice_n * lines_per_slice;  // all previous rois have lines+1 rows
             } else {
                 // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
                 roi_y =
-                    remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
+                    remainder * (lines_per_slice + 1) + (slice_n - remainder) * lines_per_slice;
             }
 
-            if (lines_per_thread <= 0) return;  // no job for current thread
+            if (lines_per_slice <= 0) continue;  // no job for current tile
 
-            auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
-            std::vector<Rect> rois(output_plane_mats.size(), roi);
+            auto& compiled = compiledTiles[tile_n];
+            if (Update::REBUILD == update || Update::RESHAPE == update) {
+                //  need to compile (or reshape) own object for a particular ROI
+                IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_compiling);
 
-            // TODO: make a ROI a runtime argument to avoid
-            // recompilations
-            auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
-            if (Update::REBUILD == update) {
-                auto& computation = lastComputation.value();
-                compiled = computation.compile(descrs_of(input_plane_mats), std::move(args));
-            } else {
-                IE_ASSERT(compiled);
-                compiled.reshape(descrs_of(input_plane_mats), std::move(args));
+                using cv::gapi::own::Rect;
+
+                const auto& input_plane_mats = batched_input_plane_mats[0];
+                const auto& output_plane_mats = batched_output_plane_mats[0];
+
+                auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_slice};
+                std::vector<Rect> rois(output_plane_mats.size(), roi);
+
+                // TODO: make a ROI a runtime argument to avoid
+                // recompilations
+                auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
+                if (Update::REBUILD == update) {
+                    auto& computation = lastComputation.value();
+                    compiled = computation.compile(descrs_of(input_plane_mats), std::move(args));
+                } else {
+                    IE_ASSERT(compiled);
+                    compiled.reshape(descrs_of(input_plane_mats), std::move(args));
+                }
             }
-        }
 
-        for (int i = 0; i < batch_size; ++i) {
-            const auto& input_plane_mats = batched_input_plane_mats[i];
-            auto& output_plane_mats = batched_output_plane_mats[i];
+            // the items of the group are processed with the same compiled object one after another
+            for (int i = group_n; i < batch_size; i += tiling.item_groups) {
+                const auto& input_plane_mats = batched_input_plane_mats[i];
+                auto& output_plane_mats = batched_output_plane_mats[i];
 
-            cv::GRunArgs call_ins;
-            cv::GRunArgsP call_outs;
-            for (const auto & m : input_plane_mats) { call_ins.emplace_back(m);}
-            for (auto & m : output_plane_mats) { call_outs.emplace_back(&m);}
+                cv::GRunArgs call_ins;
+                cv::GRunArgsP call_outs;
+                for (const auto & m : input_plane_mats) { call_ins.emplace_back(m);}
+                for (auto & m : output_plane_mats) { call_outs.emplace_back(&m);}
 
-            IE_PROFILING_AUTO_SCOPE_TASK(_perf_exec_graph);
-            compiled(std::move(call_ins), std::move(call_outs));
+                IE_PROFILING_AUTO_SCOPE_TASK(_perf_exec_graph);
+                compiled(std::move(call_ins), std::move(call_outs));
+            }
         }
     });
 }
@@ -876,7 +1061,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 template<typename BlobTypePtr>
 bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
     ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    int batch_size, const ROI *roi, const PreProcessInfo *norm_info, const float *letterbox_pad) {
 
     validateBlob(inBlob);
 
@@ -893,9 +1078,34 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
     const auto out_layout = out_desc_ie.getLayout();
 
     // For YUV420, check batch via Y plane descriptor
-    const G::Desc
-        in_desc =  G::decompose(in_desc_ie),
-        out_desc = G::decompose(out_desc_ie);
+    G::Desc in_desc = G::decompose(in_desc_ie);
+    G::Desc out_desc = G::decompose(out_desc_ie);
+    const int out_height = out_desc.d.H, out_width = out_desc.d.W;
+
+    // The region of interest is processed as if it was the whole input
+    auto in_dims = in_desc_ie.getDims();
+    if (roi) {
+        validateROI(*roi, in_desc, in_fmt);
+        in_desc.d.H = static_cast<int>(roi->sizeY);
+        in_desc.d.W = static_cast<int>(roi->sizeX);
+        in_dims[2] = roi->sizeY;
+        in_dims[3] = roi->sizeX;
+    }
+
+    // The letterboxed image is written to its region of the network's input, so the graph is built
+    // as if the region was the whole output
+    auto out_dims = out_desc_ie.getDims();
+    LetterboxInfo box {};
+    if (letterbox_pad) {
+        if (algorithm == NO_RESIZE) {
+            THROW_IE_EXCEPTION << "Letterbox resize of the input requires a resize algorithm to be set";
+        }
+        box = PreProcessInfo::getLetterboxInfo(in_desc.d.W, in_desc.d.H, out_width, out_height);
+        out_desc.d.H = static_cast<int>(box.sizeY);
+        out_desc.d.W = static_cast<int>(box.sizeX);
+        out_dims[2] = box.sizeY;
+        out_dims[3] = box.sizeX;
+    }
 
     // according to the IE's current design, input blob batch size _must_ match networks's expected
     // batch size, even if the actual processing batch size (set on infer request) is different.
@@ -910,21 +1120,99 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                             << batch_size << " > " << out_desc.d.N << " (expected by network)";
     }
 
+    // Network's input precision differs from the input's one only if the output is normalized
+    // (or just converted) to FP32 or FP16 within the graph
+    const auto in_precision  = in_desc_ie.getPrecision();
+    const auto out_precision = out_desc_ie.getPrecision();
+    if (in_precision != Precision::U8 && in_precision != Precision::FP32) {
+        THROW_IE_EXCEPTION << "Unsupported input blob precision " << in_precision;
+    }
+    if (out_precision != in_precision && out_precision != Precision::FP32 && out_precision != Precision::FP16) {
+        THROW_IE_EXCEPTION << "Unsupported network's input precision " << out_precision
+                           << " for the input blob of precision " << in_precision;
+    }
+
+    NormDesc norm {NONE, {}, {}};
+    std::vector<cv::gapi::own::Mat> mean_images;
+    if (norm_info && norm_info->getNumberOfChannels() != 0) {
+        if (out_precision != Precision::FP32 && out_precision != Precision::FP16) {
+            THROW_IE_EXCEPTION << "Normalization of the input is supported only with FP32 or FP16 output, got "
+                               << out_precision;
+        }
+        const auto channels = norm_info->getNumberOfChannels();
+        if (channels != static_cast<size_t>(out_desc.d.C)) {
+            THROW_IE_EXCEPTION << "Number of channels in pre-processing info (" << channels
+                               << ") != network's expected number of channels (" << out_desc.d.C << ")";
+        }
+
+        std::get<0>(norm) = norm_info->getMeanVariant();
+        for (size_t c = 0; c < channels; c++) {
+            const auto& channel = (*norm_info)[c];
+            std::get<2>(norm).push_back(channel->stdScale);
+            if (std::get<0>(norm) == MEAN_VALUE) {
+                std::get<1>(norm).push_back(channel->meanValue);
+            } else if (std::get<0>(norm) == MEAN_IMAGE) {
+                const auto& mean = channel->meanData;
+                if (!mean || mean->getTensorDesc().getPrecision() != Precision::FP32
+                    || mean->size() != static_cast<size_t>(out_height * out_width)) {
+                    THROW_IE_EXCEPTION << "Mean image of channel " << c << " is not provided or "
+                                       << "is not an FP32 image of the network's input size";
+                }
+                mean_images.emplace_back(out_height, out_width, CV_32FC1,
+                                         static_cast<uint8_t*>(mean->buffer()), out_width * sizeof(float));
+            }
+        }
+    }
+
     CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
                                             in_layout,
-                                            in_desc_ie.getDims(),
+                                            in_dims,
                                             in_fmt },
                                   BlobDesc{ out_desc_ie.getPrecision(),
                                             out_layout,
-                                            out_desc_ie.getDims(),
+                                            out_dims,
                                             out_fmt },
-                                  algorithm };
-    const Update update = needUpdate(thisCall);
+                                  algorithm,
+                                  norm };
+
+    const int threads =
+#if IE_THREAD == IE_THREAD_OMP
+        omp_serial ? 1 :
+#endif
+        parallel_get_max_threads();
+    const auto tiling = getTiling(batch_size, threads);
+
+    // Look for the graph compiled for exactly the same call. If there is no such one, the least
+    // recently used graph is reshaped (if the new call allows this) or replaced once the cache is full.
+    Update update = Update::NOTHING;
+    auto entry = std::find_if(_cache.begin(), _cache.end(), [&](const CacheEntry &e) {
+        return e.call == thisCall;
+    });
+    if (entry != _cache.end()) {
+        _cacheHits++;
+    } else {
+        _cacheMisses++;
+        if (_cache.size() < _maxCacheSize) {
+            update = Update::REBUILD;
+            entry = _cache.emplace(_cache.end(),
+                                   CacheEntry{thisCall, tiling, std::vector<cv::GCompiled>(tiling.tiles())});
+        } else {
+            entry = std::prev(_cache.end());
+            update = needUpdate(entry->call, thisCall);
+            entry->call = std::move(thisCall);
+        }
+    }
+    // the compiled objects are bound to the tiles, so a different tiling (e.g. the batch size
+    // has changed) needs them to be compiled again
+    if (!(entry->tiling == tiling)) {
+        update = Update::REBUILD;
+        entry->tiling = tiling;
+        entry->compiled.assign(tiling.tiles(), cv::GCompiled{});
+    }
+    _cache.splice(_cache.begin(), _cache, entry);
 
     Opt<cv::GComputation> _lastComputation;
     if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
-
         if (Update::REBUILD == update) {
             //  rebuild the graph
             IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_building);
@@ -938,21 +1226,54 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                            algorithm,
                            in_fmt,
                            out_fmt,
-                           get_cv_depth(in_desc_ie)));
+                           get_cv_depth(in_desc_ie),
+                           get_cv_depth(out_desc_ie),
+                           std::get<0>(norm),
+                           std::get<1>(norm),
+                           std::get<2>(norm)));
         }
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
+    if (roi) {
+        cropToROI(batched_input_plane_mats, *roi, in_fmt);
+    }
+    // the graph processes the letterbox region of the output (and of the mean image) only
+    const auto whole_output_plane_mats = batched_output_plane_mats;
+    auto graph_mean_images = mean_images;
+    if (letterbox_pad) {
+        for (auto &output_plane_mats : batched_output_plane_mats) {
+            cropToLetterbox(output_plane_mats, box);
+        }
+        cropToLetterbox(graph_mean_images, box);
+    }
+    for (auto &input_plane_mats : batched_input_plane_mats) {
+        input_plane_mats.insert(input_plane_mats.end(), graph_mean_images.begin(), graph_mean_images.end());
+    }
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
-        omp_serial, update);
+    try {
+        executeGraph(_lastComputation, entry->compiled, entry->tiling, batched_input_plane_mats,
+            batched_output_plane_mats, batch_size, omp_serial, update);
+    } catch (...) {
+        // the entry may keep partially compiled graph
+        if (Update::NOTHING != update) {
+            _cache.erase(entry);
+        }
+        throw;
+    }
+
+    if (letterbox_pad) {
+        padLetterbox(whole_output_plane_mats, box, *letterbox_pad, std::get<0>(norm), std::get<1>(norm),
+                     std::get<2>(norm), mean_images, batch_size, omp_serial);
+    }
 
     return true;
 }
 
 bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const ROI *roi, const PreProcessInfo *norm_info, const float *letterbox_pad) {
     if (!useGAPI()) {
         return false;
     }
@@ -976,7 +1297,7 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
                                 << ": expected NV12Blob";
         }
         return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, roi, norm_info, letterbox_pad);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -985,7 +1306,7 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
                                 << ": expected I420Blob";
         }
         return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, roi, norm_info, letterbox_pad);
     }
 
     default:
@@ -995,7 +1316,7 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
                                 << ": expected MemoryBlob";
         }
         return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, roi, norm_info, letterbox_pad);
     }
 }
 }  // namespace InferenceEngine
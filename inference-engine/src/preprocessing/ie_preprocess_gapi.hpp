@@ -8,6 +8,7 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <list>
 #include <tuple>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
@@ -22,11 +23,34 @@ namespace InferenceEngine {
 
 class PreprocEngine {
     using BlobDesc = std::tuple<Precision, Layout, SizeVector, ColorFormat>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    // Mean variant, per-channel mean values and scales the output is normalized with
+    using NormDesc = std::tuple<MeanVariant, std::vector<float>, std::vector<float>>;
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, NormDesc>;
     template<typename T> using Opt = cv::util::optional<T>;
 
-    Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
+    // The batch is processed as tiles in one parallel region: items are split into `item_groups`
+    // groups and the rows of every item into `row_slices` slices, each tile having own compiled graph.
+    struct Tiling {
+        int item_groups;
+        int row_slices;
+        int tiles() const { return item_groups * row_slices; }
+        bool operator==(const Tiling &other) const {
+            return item_groups == other.item_groups && row_slices == other.row_slices;
+        }
+    };
+    static Tiling getTiling(int batch_size, int threads);
+
+    // Graphs compiled for the recent calls, one per tile of the output processed in parallel.
+    // The cache is kept in the most recently used first order.
+    struct CacheEntry {
+        CallDesc call;
+        Tiling tiling;
+        std::vector<cv::GCompiled> compiled;
+    };
+    static constexpr std::size_t _maxCacheSize = 4;
+    std::list<CacheEntry> _cache;
+    std::size_t _cacheHits = 0;
+    std::size_t _cacheMisses = 0;
 
     ProfilingTask _perf_graph_building {"Preproc Graph Building"};
     ProfilingTask _perf_exec_tile  {"Preproc Calc Tile"};
@@ -34,9 +58,11 @@ class PreprocEngine {
     ProfilingTask _perf_graph_compiling {"Preproc Graph compiling"};
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
-    Update needUpdate(const CallDesc &newCall) const;
+    static Update needUpdate(const CallDesc &lastCall, const CallDesc &newCall);
 
     void executeGraph(Opt<cv::GComputation>& lastComputation,
+                      std::vector<cv::GCompiled>& compiled,
+                      const Tiling& tiling,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
@@ -46,15 +72,33 @@ class PreprocEngine {
     template<typename BlobTypePtr>
     bool preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+        int batch_size, const ROI *roi, const PreProcessInfo *norm_info, const float *letterbox_pad);
 
 public:
     PreprocEngine();
     static bool useGAPI();
+    /**
+     * @brief Gets the name of the instruction set the pre-processing kernels use on this CPU.
+     */
+    static const char* kernelsISA();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
+    /**
+     * @brief Pre-processes the input blob into the output one, if G-API pre-processing is enabled.
+     * If normalization info is given, the output is converted to FP32 with the mean subtracted and
+     * the scale applied per channel within the same graph.
+     * If the letterbox pad value is given, the input is resized keeping its aspect ratio and the rest
+     * of the output is filled with the (normalized) pad value, see PreProcessInfo::getLetterboxInfo.
+     */
     bool preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, bool omp_serial, int batch_size = -1, const ROI *roi = nullptr,
+        const PreProcessInfo *norm_info = nullptr, const float *letterbox_pad = nullptr);
+
+    /**
+     * @brief Gets the number of calls which reused a cached compiled graph and the ones which needed
+     * to compile (or reshape) a graph.
+     */
+    void getCacheStats(std::size_t &hits, std::size_t &misses) const;
 };
 
 }  // namespace InferenceEngine
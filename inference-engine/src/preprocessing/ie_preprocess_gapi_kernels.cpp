@@ -12,11 +12,23 @@
   #include "ie_preprocess_gapi_kernels_sse42.hpp"
 #endif
 
+#ifdef HAVE_AVX2
+  #include "ie_preprocess_gapi_kernels_avx2.hpp"
+#endif
+
+#ifdef HAVE_AVX512
+  #include "ie_preprocess_gapi_kernels_avx512.hpp"
+#endif
+
+#include "precision_utils.h"
+
 #include <opencv2/gapi/opencv_includes.hpp>
 #include <opencv2/gapi/fluid/gfluidkernel.hpp>
 #include <opencv2/gapi/gcompoundkernel.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -28,6 +40,24 @@ namespace kernels {
 
 template<typename T, int chs> static
 void mergeRow(const std::array<const uint8_t*, chs>& ins, uint8_t* out, int length) {
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (std::is_same<T, uint8_t>::value && chs == 3) {
+            avx512::mergeRow_8UC3(ins[0], ins[1], ins[2], out, length);
+            return;
+        }
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value && chs == 3) {
+            avx::mergeRow_8UC3(ins[0], ins[1], ins[2], out, length);
+            return;
+        }
+    }
+#endif
+
 #if MANUAL_SIMD
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value && chs == 2) {
@@ -86,6 +116,24 @@ void mergeRow(const std::array<const uint8_t*, chs>& ins, uint8_t* out, int leng
 
 template<typename T, int chs> static
 void splitRow(const uint8_t* in, std::array<uint8_t*, chs>& outs, int length) {
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (std::is_same<T, uint8_t>::value && chs == 3) {
+            avx512::splitRow_8UC3(in, outs[0], outs[1], outs[2], length);
+            return;
+        }
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value && chs == 3) {
+            avx::splitRow_8UC3(in, outs[0], outs[1], outs[2], length);
+            return;
+        }
+    }
+#endif
+
 #if MANUAL_SIMD
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value && chs == 2) {
@@ -152,7 +200,9 @@ GAPI_FLUID_KERNEL(FMerge2, Merge2, false) {
     static void run(const cv::gapi::fluid::View& a,
                     const cv::gapi::fluid::View& b,
                           cv::gapi::fluid::Buffer& out) {
-        const auto rowFunc = (a.meta().depth == CV_8U) ? &mergeRow<uint8_t, 2> : &mergeRow<float, 2>;
+        const auto rowFunc = (a.meta().depth == CV_8U)  ? &mergeRow<uint8_t, 2> :
+                             (a.meta().depth == CV_16S) ? &mergeRow<int16_t, 2> :
+                                                          &mergeRow<float  , 2>;
         for (int l = 0; l < out.lpi(); l++) {
             rowFunc({a.InLineB(l), b.InLineB(l)}, out.OutLineB(l), a.length());
         }
@@ -166,7 +216,9 @@ GAPI_FLUID_KERNEL(FMerge3, Merge3, false) {
                     const cv::gapi::fluid::View& b,
                     const cv::gapi::fluid::View& c,
                           cv::gapi::fluid::Buffer& out) {
-        const auto rowFunc = (a.meta().depth == CV_8U) ? &mergeRow<uint8_t, 3> : &mergeRow<float, 3>;
+        const auto rowFunc = (a.meta().depth == CV_8U)  ? &mergeRow<uint8_t, 3> :
+                             (a.meta().depth == CV_16S) ? &mergeRow<int16_t, 3> :
+                                                          &mergeRow<float  , 3>;
         for (int l = 0; l < out.lpi(); l++) {
             rowFunc({a.InLineB(l), b.InLineB(l), c.InLineB(l)}, out.OutLineB(l), a.length());
         }
@@ -181,13 +233,82 @@ GAPI_FLUID_KERNEL(FMerge4, Merge4, false) {
                     const cv::gapi::fluid::View& c,
                     const cv::gapi::fluid::View& d,
                           cv::gapi::fluid::Buffer& out) {
-        const auto rowFunc = (a.meta().depth == CV_8U) ? &mergeRow<uint8_t, 4> : &mergeRow<float, 4>;
+        const auto rowFunc = (a.meta().depth == CV_8U)  ? &mergeRow<uint8_t, 4> :
+                             (a.meta().depth == CV_16S) ? &mergeRow<int16_t, 4> :
+                                                          &mergeRow<float  , 4>;
         for (int l = 0; l < out.lpi(); l++) {
             rowFunc({a.InLineB(l), b.InLineB(l), c.InLineB(l), d.InLineB(l)}, out.OutLineB(l), a.length());
         }
     }
 };
 
+template<typename T>
+static void normalizeRow(const T in[], const float mean[], float meanValue, float scale,
+                         float out[], int length) {
+    if (mean) {
+        for (int x = 0; x < length; x++) {
+            out[x] = (static_cast<float>(in[x]) - mean[x]) * scale;
+        }
+    } else {
+        for (int x = 0; x < length; x++) {
+            out[x] = (static_cast<float>(in[x]) - meanValue) * scale;
+        }
+    }
+}
+
+// FP16 output goes through a small FP32 buffer, so the row is still read and written once
+template<typename T>
+static void normalizeRow(const T in[], const float mean[], float meanValue, float scale,
+                         ie_fp16 out[], int length) {
+    constexpr int chunk = 256;
+    float tmp[chunk];
+    for (int x = 0; x < length; x += chunk) {
+        const int n = std::min(chunk, length - x);
+        normalizeRow(in + x, mean ? mean + x : nullptr, meanValue, scale, tmp, n);
+        PrecisionUtils::f32tof16Arrays(out + x, tmp, n);
+    }
+}
+
+template<typename T>
+static void normalizeRow(const cv::gapi::fluid::View& in, const float mean[], float meanValue, float scale,
+                         cv::gapi::fluid::Buffer& out, int l) {
+    if (out.meta().depth == CV_16S) {
+        normalizeRow(in.InLine<T>(l), mean, meanValue, scale, out.OutLine<ie_fp16>(l), in.length());
+    } else {
+        normalizeRow(in.InLine<T>(l), mean, meanValue, scale, out.OutLine<float>(l), in.length());
+    }
+}
+
+GAPI_FLUID_KERNEL(FNormalizePlane, NormalizePlane, false) {
+    static const int LPI = 4;
+    static const int Window = 1;
+    static void run(const cv::gapi::fluid::View& in, float mean, float scale, int /*depth*/,
+                          cv::gapi::fluid::Buffer& out) {
+        for (int l = 0; l < out.lpi(); l++) {
+            if (in.meta().depth == CV_8U) {
+                normalizeRow<uint8_t>(in, nullptr, mean, scale, out, l);
+            } else {
+                normalizeRow<float>(in, nullptr, mean, scale, out, l);
+            }
+        }
+    }
+};
+
+GAPI_FLUID_KERNEL(FNormalizePlaneImage, NormalizePlaneImage, false) {
+    static const int LPI = 4;
+    static const int Window = 1;
+    static void run(const cv::gapi::fluid::View& in, const cv::gapi::fluid::View& mean, float scale,
+                    int /*depth*/, cv::gapi::fluid::Buffer& out) {
+        for (int l = 0; l < out.lpi(); l++) {
+            if (in.meta().depth == CV_8U) {
+                normalizeRow<uint8_t>(in, mean.InLine<float>(l), 0.f, scale, out, l);
+            } else {
+                normalizeRow<float>(in, mean.InLine<float>(l), 0.f, scale, out, l);
+            }
+        }
+    }
+};
+
 GAPI_FLUID_KERNEL(FSplit2, Split2, false) {
     static const int LPI = 4;
     static const int Window = 1;
@@ -380,10 +501,47 @@ G_TYPED_KERNEL(ScalePlaneArea32f, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie
     }
 };
 
+G_TYPED_KERNEL(ScalePlaneNearest, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie.scale_plane_nearest") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const Size &sz, int) {
+        GAPI_DbgAssert((in.depth == CV_8U || in.depth == CV_32F) && in.chan == 1);
+        return in.withSize(sz);
+    }
+};
+
+// Bi-cubic resize is split into three steps, as a Resize kernel gets only the input rows the output
+// rows are projected to, while the cubic filter needs one row above and two rows below them:
+// 1. ScalePlaneCubicH resizes rows horizontally (into 32F, to keep the precision),
+// 2. CubicRows makes four copies of the plane shifted by -1, 0, +1 and +2 rows (replicating borders),
+// 3. ScalePlaneCubicV takes the projected row from every copy and combines them.
+G_TYPED_KERNEL(ScalePlaneCubicH, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie.scale_plane_cubic_h") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const Size &sz, int) {
+        GAPI_DbgAssert((in.depth == CV_8U || in.depth == CV_32F) && in.chan == 1);
+        return in.withType(CV_32F, 1).withSize(Size(sz.width, in.size.height));
+    }
+};
+
+G_TYPED_KERNEL_M(CubicRows, <GMat4(cv::GMat)>, "com.intel.ie.cubic_rows") {
+    static std::tuple<cv::GMatDesc, cv::GMatDesc, cv::GMatDesc, cv::GMatDesc> outMeta(const cv::GMatDesc &in) {
+        GAPI_DbgAssert(in.depth == CV_32F && in.chan == 1);
+        return std::make_tuple(in, in, in, in);
+    }
+};
+
+G_TYPED_KERNEL(ScalePlaneCubicV, <cv::GMat(cv::GMat, cv::GMat, cv::GMat, cv::GMat, Size, int)>,
+               "com.intel.ie.scale_plane_cubic_v") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const cv::GMatDesc &, const cv::GMatDesc &,
+                                const cv::GMatDesc &, const Size &sz, int depth) {
+        GAPI_DbgAssert(in.depth == CV_32F && in.chan == 1);
+        GAPI_DbgAssert(in.size.width == sz.width);
+        return in.withType(depth, 1).withSize(sz);
+    }
+};
+
 GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
     static cv::GMat expand(cv::GMat in, int type, const Size& szIn, const Size& szOut, int interp) {
         GAPI_DbgAssert(CV_8UC1 == type || CV_32FC1 == type);
-        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
+        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp ||
+                       cv::INTER_NEAREST == interp || cv::INTER_CUBIC == interp);
 
         if (cv::INTER_AREA == interp) {
             bool upscale = szIn.width < szOut.width || szIn.height < szOut.height;
@@ -410,6 +568,16 @@ GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
             }
         }
 
+        if (cv::INTER_NEAREST == interp) {
+            return ScalePlaneNearest::on(in, szOut, interp);
+        }
+
+        if (cv::INTER_CUBIC == interp) {
+            cv::GMat row0, row1, row2, row3;
+            std::tie(row0, row1, row2, row3) = CubicRows::on(ScalePlaneCubicH::on(in, szOut, interp));
+            return ScalePlaneCubicV::on(row0, row1, row2, row3, szOut, CV_MAT_DEPTH(type));
+        }
+
         GAPI_Assert(!"unsupported parameters");
         return {};
     }
@@ -576,6 +744,42 @@ static void calcRowLinear(const cv::gapi::fluid::View  & in,
         dst[l] = out.OutLine<T>(l);
     }
 
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (std::is_same<T, uint8_t>::value) {
+            if (inSz.width >= avx512::resizeMinWidth && outSz.width >= avx512::resizeMinWidth) {
+                avx512::calcRowLinear_8UC1(reinterpret_cast<uint8_t**>(dst),
+                                           reinterpret_cast<const uint8_t**>(src0),
+                                           reinterpret_cast<const uint8_t**>(src1),
+                                           reinterpret_cast<const short*>(alpha),
+                                           reinterpret_cast<const short*>(mapsx),
+                                           reinterpret_cast<const short*>(beta),
+                                           reinterpret_cast<uint8_t*>(tmp),
+                                           inSz, outSz, lpi);
+                return;
+            }
+        }
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value) {
+            if (inSz.width >= avx::resizeMinWidth && outSz.width >= avx::resizeMinWidth) {
+                avx::calcRowLinear_8UC1(reinterpret_cast<uint8_t**>(dst),
+                                        reinterpret_cast<const uint8_t**>(src0),
+                                        reinterpret_cast<const uint8_t**>(src1),
+                                        reinterpret_cast<const short*>(alpha),
+                                        reinterpret_cast<const short*>(mapsx),
+                                        reinterpret_cast<const short*>(beta),
+                                        reinterpret_cast<uint8_t*>(tmp),
+                                        inSz, outSz, lpi);
+                return;
+            }
+        }
+    }
+#endif
+
 #if MANUAL_SIMD
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value) {
@@ -664,6 +868,42 @@ static void calcRowLinearC(const cv::gapi::fluid::View  & in,
         }
     }
 
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (std::is_same<T, uint8_t>::value) {
+            if (inSz.width >= avx512::resizeMinWidth && outSz.width >= avx512::resizeMinWidth) {
+                avx512::calcRowLinear_8UC(dst,
+                                          reinterpret_cast<const uint8_t**>(src0),
+                                          reinterpret_cast<const uint8_t**>(src1),
+                                          reinterpret_cast<const short*>(alpha),
+                                          reinterpret_cast<const short*>(mapsx),
+                                          reinterpret_cast<const short*>(beta),
+                                          reinterpret_cast<uint8_t*>(tmp),
+                                          inSz, outSz, lpi);
+                return;
+            }
+        }
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value) {
+            if (inSz.width >= avx::resizeMinWidth && outSz.width >= avx::resizeMinWidth) {
+                avx::calcRowLinear_8UC(dst,
+                                       reinterpret_cast<const uint8_t**>(src0),
+                                       reinterpret_cast<const uint8_t**>(src1),
+                                       reinterpret_cast<const short*>(alpha),
+                                       reinterpret_cast<const short*>(mapsx),
+                                       reinterpret_cast<const short*>(beta),
+                                       reinterpret_cast<uint8_t*>(tmp),
+                                       inSz, outSz, lpi);
+                return;
+            }
+        }
+    }
+#endif
+
 #if MANUAL_SIMD
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value) {
@@ -1558,6 +1798,234 @@ GAPI_FLUID_KERNEL(FScalePlaneArea8u, ScalePlaneArea8u, true) {
     }
 };
 
+//----------------------------------------------------------------------
+
+namespace nearest {
+// Maps output coordinate to the input one the same way Fluid maps output rows to the input
+// rows given to a Resize kernel, so the row picked is always available in the kernel's view
+static inline int map(double ratio, int outCoord, int inSz) {
+    return (std::min)(static_cast<int>(outCoord * ratio + 1e-3), inSz - 1);
+}
+}  // namespace nearest
+
+template<typename T>
+static void calcRowNearest(const cv::gapi::fluid::View  & in,
+                                 cv::gapi::fluid::Buffer& out,
+                                 cv::gapi::fluid::Buffer& scratch) {
+    const auto  inSz =  in.meta().size;
+    const auto outSz = out.meta().size;
+    const double vRatio = ratio(inSz.height, outSz.height);
+
+    const auto *mapsx = scratch.OutLine<int>();
+
+    for (int l = 0; l < out.lpi(); l++) {
+        const int sy = nearest::map(vRatio, out.y() + l, inSz.height);
+        const T *src = in.InLine<T>(sy - in.y());
+        T *dst = out.OutLine<T>(l);
+
+        for (int x = 0; x < outSz.width; x++) {
+            dst[x] = src[mapsx[x]];
+        }
+    }
+}
+
+GAPI_FLUID_KERNEL(FScalePlaneNearest, ScalePlaneNearest, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in,
+                            Size outSz, int /*interp*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        cv::GMatDesc desc;
+        desc.chan  = 1;
+        desc.depth = CV_8UC1;
+        desc.size  = Size(static_cast<int>(outSz.width * sizeof(int)), 1);
+
+        cv::gapi::fluid::Buffer buffer(desc);
+        scratch = std::move(buffer);
+
+        const double hRatio = ratio(in.size.width, outSz.width);
+        auto *mapsx = scratch.OutLine<int>();
+        for (int x = 0; x < outSz.width; x++) {
+            mapsx[x] = nearest::map(hRatio, x, in.size.width);
+        }
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size /*sz*/, int /*interp*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        const auto rowFunc = (in.meta().depth == CV_8U) ? &calcRowNearest<uint8_t> : &calcRowNearest<float>;
+        rowFunc(in, out, scratch);
+    }
+};
+
+//----------------------------------------------------------------------
+
+namespace cubic {
+// The same filter as used by OpenCV's INTER_CUBIC
+static inline void coeffs(float x, float c[4]) {
+    constexpr float A = -0.75f;
+
+    c[0] = ((A*(x + 1) - 5*A)*(x + 1) + 8*A)*(x + 1) - 4*A;
+    c[1] = ((A + 2)*x - (A + 3))*x*x + 1;
+    c[2] = ((A + 2)*(1 - x) - (A + 3))*(1 - x)*(1 - x) + 1;
+    c[3] = 1.f - c[0] - c[1] - c[2];
+}
+
+// Projects output pixel's center onto the input, returns index of the input pixel
+// on the left of the projection and fills in the filter coefficients
+static inline int map(double ratio, int outCoord, float c[4]) {
+    const double inCoord = (outCoord + 0.5) * ratio - 0.5;
+    const int index = static_cast<int>(std::floor(inCoord));
+    coeffs(static_cast<float>(inCoord - index), c);
+    return index;
+}
+
+template<typename T> static inline T cast(float v);
+template<> inline float   cast(float v) { return v; }
+template<> inline uint8_t cast(float v) { return saturate_cast<uint8_t>(static_cast<int>(std::rint(v))); }
+}  // namespace cubic
+
+template<typename T>
+static void calcRowCubicH(const cv::gapi::fluid::View  & in,
+                                cv::gapi::fluid::Buffer& out,
+                                cv::gapi::fluid::Buffer& scratch) {
+    const int length = out.length();
+
+    // see initScratch of FScalePlaneCubicH for the layout
+    const auto *alpha = scratch.OutLine<float>();
+    const auto *mapsx = reinterpret_cast<const int*>(alpha + 4*length);
+
+    for (int l = 0; l < out.lpi(); l++) {
+        const T *src = in.InLine<T>(l);
+        float *dst = out.OutLine<float>(l);
+
+        for (int x = 0; x < length; x++) {
+            const float *a = &alpha[4*x];
+            const int   *i = &mapsx[4*x];
+            dst[x] = a[0]*src[i[0]] + a[1]*src[i[1]] + a[2]*src[i[2]] + a[3]*src[i[3]];
+        }
+    }
+}
+
+GAPI_FLUID_KERNEL(FScalePlaneCubicH, ScalePlaneCubicH, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in,
+                            Size outSz, int /*interp*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        // four coefficients followed by four input indices per output pixel
+        cv::GMatDesc desc;
+        desc.chan  = 1;
+        desc.depth = CV_8UC1;
+        desc.size  = Size(static_cast<int>(outSz.width * 4 * (sizeof(float) + sizeof(int))), 1);
+
+        cv::gapi::fluid::Buffer buffer(desc);
+        scratch = std::move(buffer);
+
+        auto *alpha = scratch.OutLine<float>();
+        auto *mapsx = reinterpret_cast<int*>(alpha + 4*outSz.width);
+
+        const double hRatio = ratio(in.size.width, outSz.width);
+        for (int x = 0; x < outSz.width; x++) {
+            const int sx = cubic::map(hRatio, x, &alpha[4*x]);
+            for (int k = 0; k < 4; k++) {
+                mapsx[4*x + k] = (std::min)((std::max)(sx + k - 1, 0), in.size.width - 1);
+            }
+        }
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size /*sz*/, int /*interp*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        const auto rowFunc = (in.meta().depth == CV_8U) ? &calcRowCubicH<uint8_t> : &calcRowCubicH<float>;
+        rowFunc(in, out, scratch);
+    }
+};
+
+GAPI_FLUID_KERNEL(FCubicRows, CubicRows, false) {
+    static const int Window = 5;
+
+    static void run(const cv::gapi::fluid::View& in,
+                    cv::gapi::fluid::Buffer& out0,
+                    cv::gapi::fluid::Buffer& out1,
+                    cv::gapi::fluid::Buffer& out2,
+                    cv::gapi::fluid::Buffer& out3) {
+        const auto rowSize = out0.length() * sizeof(float);
+        std::copy_n(in.InLineB(-1), rowSize, out0.OutLineB());
+        std::copy_n(in.InLineB( 0), rowSize, out1.OutLineB());
+        std::copy_n(in.InLineB( 1), rowSize, out2.OutLineB());
+        std::copy_n(in.InLineB( 2), rowSize, out3.OutLineB());
+    }
+
+    static cv::gapi::fluid::Border getBorder(const cv::GMatDesc& /*in*/) {
+        return cv::gapi::fluid::Border(cv::BORDER_REPLICATE, cv::gapi::own::Scalar{});
+    }
+};
+
+template<typename T>
+static void calcRowCubicV(const std::array<std::reference_wrapper<const cv::gapi::fluid::View>, 4>& in,
+                                cv::gapi::fluid::Buffer& out) {
+    const auto  inSz = in[0].get().meta().size;
+    const auto outSz = out.meta().size;
+    const double vRatio = ratio(inSz.height, outSz.height);
+
+    const int inY = in[0].get().y();
+
+    for (int l = 0; l < out.lpi(); l++) {
+        float beta[4];
+        int sy = cubic::map(vRatio, out.y() + l, beta);
+
+        // k-th input keeps (y + k - 1)-th rows, so the taps of the top output rows
+        // which go over the border are moved to the replicated first row
+        if (sy < 0) {
+            GAPI_DbgAssert(sy == -1);
+            beta[0] += beta[1] + beta[2];
+            beta[2]  = beta[3];
+            beta[1]  = beta[3] = 0.f;
+            sy = 0;
+        }
+        // Fluid's window may start one row below the projection when
+        // ratio is close to unity, so stick to the rows available
+        sy = (std::max)(sy, inY);
+
+        const float *src[4];
+        for (int k = 0; k < 4; k++) {
+            src[k] = in[k].get().InLine<float>(sy - inY);
+        }
+        T *dst = out.OutLine<T>(l);
+
+        for (int x = 0; x < outSz.width; x++) {
+            dst[x] = cubic::cast<T>(beta[0]*src[0][x] + beta[1]*src[1][x] +
+                                    beta[2]*src[2][x] + beta[3]*src[3][x]);
+        }
+    }
+}
+
+GAPI_FLUID_KERNEL(FScalePlaneCubicV, ScalePlaneCubicV, false) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void run(const cv::gapi::fluid::View& in0,
+                    const cv::gapi::fluid::View& in1,
+                    const cv::gapi::fluid::View& in2,
+                    const cv::gapi::fluid::View& in3,
+                    Size /*sz*/, int /*depth*/,
+                    cv::gapi::fluid::Buffer& out) {
+        std::array<std::reference_wrapper<const cv::gapi::fluid::View>, 4> in = {in0, in1, in2, in3};
+        const auto rowFunc = (out.meta().depth == CV_8U) ? &calcRowCubicV<uint8_t> : &calcRowCubicV<float>;
+        rowFunc(in, out);
+    }
+};
+
 static const int ITUR_BT_601_CY = 1220542;
 static const int ITUR_BT_601_CUB = 2116026;
 static const int ITUR_BT_601_CUG = -409993;
@@ -1647,6 +2115,20 @@ GAPI_FLUID_KERNEL(FNV12toRGB, NV12toRGB, false) {
 
         int buf_width = out.length();
 
+        #ifdef HAVE_AVX512
+            if (with_cpu_x86_avx512_core()) {
+                avx512::calculate_nv12_to_rgb(y_rows, uv_row, out_rows, buf_width);
+                return;
+            }
+        #endif
+
+        #ifdef HAVE_AVX2
+            if (with_cpu_x86_avx2()) {
+                avx::calculate_nv12_to_rgb(y_rows, uv_row, out_rows, buf_width);
+                return;
+            }
+        #endif
+
         #if MANUAL_SIMD
             calculate_nv12_to_rgb(y_rows, uv_row, out_rows, buf_width);
         #else
@@ -1697,6 +2179,10 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FUpscalePlaneArea32f
         , FScalePlaneArea8u
         , FScalePlaneArea32f
+        , FScalePlaneNearest
+        , FScalePlaneCubicH
+        , FCubicRows
+        , FScalePlaneCubicV
         , FMerge2
         , FMerge3
         , FMerge4
@@ -1705,8 +2191,50 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FSplit4
         , FNV12toRGB
         , FI420toRGB
+        , FNormalizePlane
+        , FNormalizePlaneImage
         >();
 }
 
+void padRow(const float values[], uint8_t row[], int depth, int length) {
+    switch (depth) {
+    case CV_8U:
+        for (int x = 0; x < length; x++) {
+            row[x] = saturate_cast<uchar>(static_cast<int>(std::rint(values[x])));
+        }
+        break;
+    case CV_32F:
+        std::copy_n(values, length, reinterpret_cast<float*>(row));
+        break;
+    case CV_16S:
+        PrecisionUtils::f32tof16Arrays(reinterpret_cast<ie_fp16*>(row), values, length);
+        break;
+    default:
+        GAPI_Assert(!"unsupported depth of the padded row");
+    }
+}
+
+const char* preprocKernelsISA() {
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        return "avx512";
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        return "avx2";
+    }
+#endif
+
+#if MANUAL_SIMD
+    if (with_cpu_x86_sse42()) {
+        return "sse42";
+    }
+#endif
+
+    return "ref";
+}
+
 }  // namespace gapi
 }  // namespace InferenceEngine
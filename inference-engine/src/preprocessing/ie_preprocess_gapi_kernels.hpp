@@ -143,7 +143,38 @@ namespace gapi {
         }
     };
 
+    // Converts the plane to the given depth computing (in - mean) * scale. The depth is either
+    // CV_32F or CV_16S, the latter means FP16 values (there is no half float depth in G-API)
+    G_TYPED_KERNEL(NormalizePlane, <cv::GMat(cv::GMat, float, float, int)>, "com.intel.ie.normalize_plane") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc &in, float /*mean*/, float /*scale*/, int depth) {
+            GAPI_Assert(in.chan == 1);
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_32F);
+            GAPI_Assert(depth == CV_32F || depth == CV_16S);
+            return in.withType(depth, 1);
+        }
+    };
+
+    // Same as NormalizePlane, mean is a 32F plane of the same size
+    G_TYPED_KERNEL(NormalizePlaneImage, <cv::GMat(cv::GMat, cv::GMat, float, int)>,
+                   "com.intel.ie.normalize_plane_image") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc &in, const cv::GMatDesc &mean, float /*scale*/, int depth) {
+            GAPI_Assert(in.chan == 1 && mean.chan == 1);
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_32F);
+            GAPI_Assert(mean.depth == CV_32F);
+            GAPI_Assert(in.size == mean.size);
+            GAPI_Assert(depth == CV_32F || depth == CV_16S);
+            return in.withType(depth, 1);
+        }
+    };
+
     cv::gapi::GKernelPackage preprocKernels();
 
+    // Writes the values to a row of the depth (CV_8U, CV_32F or CV_16S standing for FP16), used to pad
+    // the network's input around the letterboxed image
+    void padRow(const float values[], uint8_t row[], int depth, int length);
+
+    // Name of the widest instruction set the kernels dispatch to on this CPU ("ref" if none)
+    const char* preprocKernelsISA();
+
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -37,6 +37,12 @@ struct StageMetaInfo final {
 
     int execOrder = -1;
     float execTime = 0;
+
+    // Resources the stage is compiled with: the timings are not split by the device,
+    // so the bytes the stage accesses in each memory tell if it is bandwidth bound
+    int numShaves = 0;
+    size_t ddrBytes = 0;
+    size_t cmxBytes = 0;
 };
 
 struct DataMetaInfo final {
@@ -54,7 +60,8 @@ struct GraphMetaInfo final {
 
 VPU_DECLARE_ENUM(PerfReport,
     PerLayer,
-    PerStage
+    PerStage,
+    PerStageDetailed
 )
 
 std::map<std::string, ie::InferenceEngineProfileInfo> parsePerformanceReport(
@@ -7,9 +7,31 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <sstream>
+#include <iomanip>
 
 namespace vpu {
 
+namespace {
+
+std::string detailedExecType(const StageMetaInfo& stageMeta, float timeMS) {
+    std::ostringstream execType;
+    execType << stageMeta.stageType
+             << " shaves:" << stageMeta.numShaves
+             << " DDR:" << stageMeta.ddrBytes << "B"
+             << " CMX:" << stageMeta.cmxBytes << "B";
+
+    if (timeMS > 0) {
+        // bytes per millisecond to GB per second
+        execType << std::fixed << std::setprecision(2)
+                 << " DDR:" << stageMeta.ddrBytes / timeMS / 1e6 << "GB/s";
+    }
+
+    return execType.str();
+}
+
+}  // namespace
+
 std::map<std::string, ie::InferenceEngineProfileInfo> parsePerformanceReport(
         const std::vector<StageMetaInfo>& stagesMeta,
         const float* deviceTimings,
@@ -45,7 +67,8 @@ std::map<std::string, ie::InferenceEngineProfileInfo> parsePerformanceReport(
         profInfo.realTime_uSec = static_cast<long long int>(timeMS * 1000);
 
         stageMeta.layerType.copy(profInfo.layer_type, sizeof(profInfo.layer_type) / sizeof(profInfo.layer_type[0]), 0);
-        stageMeta.stageType.copy(profInfo.exec_type, sizeof(profInfo.exec_type) / sizeof(profInfo.exec_type[0]), 0);
+        const auto execType = perfReport == PerfReport::PerStageDetailed ? detailedExecType(stageMeta, timeMS) : stageMeta.stageType;
+        execType.copy(profInfo.exec_type, sizeof(profInfo.exec_type) / sizeof(profInfo.exec_type[0]) - 1, 0);
 
         if (stageMeta.stageType == "<Receive-Tensor>") {
             profInfo.execution_index = 0;
@@ -54,7 +77,7 @@ std::map<std::string, ie::InferenceEngineProfileInfo> parsePerformanceReport(
             execIndex++;
         }
 
-        if (perfReport == PerfReport::PerStage) {
+        if (perfReport == PerfReport::PerStage || perfReport == PerfReport::PerStageDetailed) {
             outPerfMap[stageMeta.displayStageName] = profInfo;
         } else if (perfReport == PerfReport::PerLayer) {
             auto it = outPerfMap.find(stageMeta.layerName);
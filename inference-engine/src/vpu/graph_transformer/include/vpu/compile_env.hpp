@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <functional>
+
 #include <vpu/graph_transformer.hpp>
 #include <vpu/model/model.hpp>
 #include <vpu/utils/logger.hpp>
@@ -43,6 +46,13 @@ public:
     static void updateConfig(const CompilationConfig& config);
     static void free();
 
+    /**
+     * @brief Runs func(i) for every i in [0, count) in parallel, the calls see the environment
+     * of the calling thread, which must not be changed meanwhile.
+     * The first exception thrown by the calls is rethrown once all of them are done.
+     */
+    static void parallelFor(std::size_t count, const std::function<void(std::size_t)>& func);
+
 private:
     inline CompileEnv() = default;
 };
@@ -105,6 +105,7 @@ private:
 
     int _maxShaves = 0;
     int _stageNumInputs = -1;
+    int _kernelId = -1;
 
     SmallVector<KernelParam> _kernelParams;
     SmallVector<std::string> _globalSizeRules;
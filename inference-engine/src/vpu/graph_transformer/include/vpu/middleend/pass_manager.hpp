@@ -107,6 +107,7 @@ public:
     Pass::Ptr mergeHwStages();
     Pass::Ptr splitHwDepthConv();
     Pass::Ptr splitHwConvAndPool();
+    Pass::Ptr mergeHwConvBatch();
     Pass::Ptr hwPadding();
 
     //
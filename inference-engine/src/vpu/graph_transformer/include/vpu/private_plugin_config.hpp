@@ -32,6 +32,7 @@ DECLARE_VPU_CONFIG_KEY(FORCE_DEPRECATED_CNN_CONVERSION);
 DECLARE_VPU_CONFIG_KEY(PERF_REPORT_MODE);
 DECLARE_VPU_CONFIG_VALUE(PER_LAYER);
 DECLARE_VPU_CONFIG_VALUE(PER_STAGE);
+DECLARE_VPU_CONFIG_VALUE(PER_STAGE_DETAILED);
 
 //
 // Debug options
@@ -83,5 +84,39 @@ DECLARE_VPU_MYRIAD_CONFIG_KEY(PLUGIN_LOG_FILE_PATH);
 
 DECLARE_VPU_MYRIAD_CONFIG_KEY(DEVICE_CONNECT_TIMEOUT);
 
+/**
+ * @brief The number of devices the network is loaded to, requests are routed to the least loaded one. Default = 1
+ */
+DECLARE_VPU_MYRIAD_CONFIG_KEY(NUMBER_OF_DEVICES);
+
+/**
+ * @brief The number of inferences the input and output FIFOs of the graph hold, so the transfers of the next
+ * inferences overlap the execution of the current ones. By default it is selected by the number of executors and
+ * the protocol, deeper on USB where the transfers take longer
+ */
+DECLARE_VPU_MYRIAD_CONFIG_KEY(FIFO_DEPTH);
+
+/**
+ * @brief The directory LoadNetwork keeps compiled blobs in, keyed by the network, the config and the device platform,
+ * so loading the same network again skips its compilation. The cache is not used
+ * if per-layer performance counters are enabled, since the layers are not named in the blob. Default = "" (disabled)
+ */
+DECLARE_VPU_MYRIAD_CONFIG_KEY(BLOB_CACHE_DIR);
+
+/**
+ * @brief The flag to connect to the devices booted before, e.g. by a process keeping them warm, instead of booting
+ * the firmware: CONFIG_VALUE(YES) or CONFIG_VALUE(NO) (default). The booted devices are not reset on the start
+ * and the watchdog is disabled for the attached ones. The unbooted devices are booted if no booted one is free.
+ * This is a plugin scope option, which takes effect if it is set before the first device is opened
+ */
+DECLARE_VPU_MYRIAD_CONFIG_KEY(ATTACH_BOOTED_DEVICES);
+
+/**
+ * @brief The size of the largest USB bulk transfer the data of the devices is split into, in bytes, a positive
+ * multiple of 1024. The larger transfers take fewer round-trips of libusb. This is a plugin scope option, which
+ * takes effect if it is set before the first device is opened. Default = XLINK_USB_CHUNK_SIZE of the XLink build
+ */
+DECLARE_VPU_MYRIAD_CONFIG_KEY(USB_CHUNK_SIZE);
+
 }  // namespace VPUConfigParams
 }  // namespace InferenceEngine
@@ -54,6 +54,11 @@ std::string stageDotName(const Stage& stage) {
     return ostr.str();
 }
 
+// The copies the allocator adds to move datas, which do not fit CMX, to DDR
+bool isCmxSpill(const Stage& stage) {
+    return stage->attrs().getOrDefault<bool>("CMX-to-DDR", false);
+}
+
 void dumpStageToDot(DotSerializer& out, const Stage& stage, int stageExecIdx) {
     std::string stageColor = "gold";
     if (stageExecIdx < 0) {
@@ -77,6 +82,22 @@ void dumpStageToDot(DotSerializer& out, const Stage& stage, int stageExecIdx) {
             lbl.appendPair("origLayer", stage->origLayer());
         }
         lbl.appendPair("numSHAVEs", stage->numSHAVEs());
+
+        SmallVector<DataLocation> inputLocations;
+        for (const auto& input : stage->inputs()) {
+            inputLocations.push_back(input->location());
+        }
+        SmallVector<DataLocation> outputLocations;
+        for (const auto& output : stage->outputs()) {
+            outputLocations.push_back(output->location());
+        }
+        lbl.appendPair("inputLocations", inputLocations);
+        lbl.appendPair("outputLocations", outputLocations);
+
+        if (isCmxSpill(stage)) {
+            lbl.appendPair("spillBytes", stage->input(0)->totalByteSize());
+        }
+
         if (!stage->attrs().empty()) {
             lbl.appendPair("extraAttrs", stage->attrs());
         }
@@ -108,6 +129,15 @@ void BackEnd::dumpModelToDot(
         {
             DotLabel lbl("Graph " + model->name(), out);
             lbl.appendPair("batchSize", model->batchSize());
+
+            int spillBytes = 0;
+            for (const auto& stage : model->getStages()) {
+                if (isCmxSpill(stage)) {
+                    spillBytes += stage->input(0)->totalByteSize();
+                }
+            }
+            lbl.appendPair("spillBytes", spillBytes);
+
             if (!model->attrs().empty()) {
                 lbl.appendPair("extraAttrs", model->attrs());
             }
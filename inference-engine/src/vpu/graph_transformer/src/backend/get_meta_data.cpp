@@ -80,6 +80,27 @@ void BackEnd::getMetaData(
             stageMeta.stageType += "]";
         }
 
+        stageMeta.numShaves = stage->numSHAVEs();
+
+        const auto addDataBytes = [&stageMeta](const Data& data) {
+            if (data->location() == DataLocation::CMX) {
+                stageMeta.cmxBytes += data->totalByteSize();
+            } else if (data->location() != DataLocation::None) {
+                stageMeta.ddrBytes += data->totalByteSize();
+            }
+        };
+        for (const auto& accessedStage : {stage, stage->injectedStage()}) {
+            if (accessedStage == nullptr) {
+                continue;
+            }
+            for (const auto& input : accessedStage->inputs()) {
+                addDataBytes(input);
+            }
+            for (const auto& output : accessedStage->outputs()) {
+                addDataBytes(output);
+            }
+        }
+
         if (stage->origLayer() == nullptr) {
             stageMeta.layerName = "<Extra>";
             stageMeta.layerType = "<Extra>";
@@ -7,6 +7,7 @@
 #include <climits>
 
 #include <map>
+#include <mutex>
 #include <fstream>
 #include <streambuf>
 #include <tuple>
@@ -23,6 +24,9 @@
 # include <windows.h>
 #endif
 
+#include <sys/types.h>
+#include <sys/stat.h>
+
 #include <bitset>
 
 #include <description_buffer.hpp>
@@ -315,6 +319,82 @@ int32_t getKernelId(
     return -1;
 }
 
+//
+// Kernel binaries are shared by all networks compiled in the process, so a model with several custom layers
+// reads and parses the ELF files once instead of on every compilation. An entry is valid while the sizes and
+// the modification times of its source files are the same.
+//
+
+struct KernelBinary final {
+    std::string binary;
+    std::vector<std::pair<uint32_t, uint32_t>> addresses;
+    SmallVector<std::string> parameters;
+    int id = -1;
+    std::string stamp;
+};
+
+std::string sourceStamp(const std::string& fileName) {
+#ifdef _WIN32
+    struct _stat64 info = {};
+    if (_stat64(fileName.c_str(), &info) != 0) {
+#else
+    struct stat info = {};
+    if (stat(fileName.c_str(), &info) != 0) {
+#endif
+        VPU_THROW_EXCEPTION << "Couldn't open kernel file " << fileName;
+    }
+    return std::to_string(info.st_size) + ":" + std::to_string(info.st_mtime);
+}
+
+std::shared_ptr<const KernelBinary> loadKernelBinary(
+        const std::vector<std::string>& fileNames,
+        const std::string& kernelEntry) {
+    static std::mutex cacheMutex;
+    static std::map<std::string, std::shared_ptr<const KernelBinary>> cache;
+
+    std::string key = kernelEntry;
+    std::string stamp;
+    for (const auto& fileName : fileNames) {
+        key += "|" + fileName;
+        stamp += sourceStamp(fileName) + "|";
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto it = cache.find(key);
+        if (it != cache.end() && it->second->stamp == stamp) {
+            return it->second;
+        }
+    }
+
+    auto kernel = std::make_shared<KernelBinary>();
+    kernel->stamp = stamp;
+    for (const auto& fileName : fileNames) {
+        std::ifstream inputFile(fileName, std::ios::binary);
+        if (!inputFile.is_open()) {
+            VPU_THROW_EXCEPTION << "Couldn't open kernel file " << fileName;
+        }
+
+        std::ostringstream contentStream;
+        contentStream << inputFile.rdbuf();
+        kernel->binary.append(contentStream.str());
+    }
+
+    const auto address = getKernelEntry(&kernel->binary[0], kernelEntry);
+    kernel->addresses.emplace_back(1, address);
+    kernel->parameters = deduceKernelParameters(&kernel->binary[0], address);
+    kernel->id = getKernelId(&kernel->binary[0], address);
+
+    auto vecInfo = deduceVectorized(&kernel->binary[0], address);
+    if (vecInfo.first != 0) {
+        kernel->addresses.emplace_back(vecInfo);
+    }
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    cache[key] = kernel;
+    return kernel;
+}
+
 }  // namespace
 
 ie::details::caseless_map<std::string, std::vector<CustomLayer::Ptr>> CustomLayer::loadFromFile(
@@ -405,8 +485,7 @@ uint32_t CustomLayer::kernelAddress(int idx) const {
 }
 
 int CustomLayer::kernelId() const {
-    uint32_t kernelAddress = getKernelEntry(&_kernelBinary[0], _kernelEntry);
-    return getKernelId(&_kernelBinary[0], kernelAddress);
+    return _kernelId;
 }
 
 void CustomLayer::loadSingleLayer(const pugi::xml_node& node) {
@@ -466,27 +545,18 @@ void CustomLayer::processKernelNode(const pugi::xml_node& node) {
         VPU_THROW_EXCEPTION << "No Kernel entry in custom layer";
     }
 
-    _kernelBinary.clear();
+    std::vector<std::string> fileNames;
     for (auto sourceNode = node.child("Source"); !sourceNode.empty(); sourceNode = sourceNode.next_sibling("Source")) {
-        auto fileName = _configDir + "/" + XMLParseUtils::GetStrAttr(sourceNode, "filename", "");
-
-        std::ifstream inputFile(fileName, std::ios::binary);
-        if (!inputFile.is_open()) {
-            VPU_THROW_EXCEPTION << "Couldn't open kernel file " << fileName;
-        }
-
-        std::ostringstream contentStream;
-        contentStream << inputFile.rdbuf();
-        _kernelBinary.append(contentStream.str());
+        fileNames.push_back(_configDir + "/" + XMLParseUtils::GetStrAttr(sourceNode, "filename", ""));
     }
 
-    _kernelAddress[1] = getKernelEntry(&_kernelBinary[0], _kernelEntry);
+    const auto kernel = loadKernelBinary(fileNames, _kernelEntry);
 
-    _parameters = deduceKernelParameters(&_kernelBinary[0], _kernelAddress[1]);
-
-    auto vecInfo = deduceVectorized(&_kernelBinary[0], _kernelAddress[1]);
-    if (vecInfo.first != 0) {
-        _kernelAddress[vecInfo.first] = vecInfo.second;
+    _kernelBinary = kernel->binary;
+    _kernelId = kernel->id;
+    _parameters = kernel->parameters;
+    for (const auto& address : kernel->addresses) {
+        _kernelAddress[address.first] = address.second;
     }
 }
 
@@ -97,6 +97,7 @@ FrontEnd::FrontEnd(StageBuilder::Ptr stageBuilder)
         {"ReduceMean",                               LAYER_PARSER(parseReduce)},
         {"TensorIterator",                           LAYER_PARSER(parseTensorIterator)},
         {"OneHot",                                   LAYER_PARSER(parseOneHot)},
+        {"FakeQuantize",                             LAYER_PARSER(parseFakeQuantize)},
     }} {}
 
 ModelPtr FrontEnd::buildInitialModel(ie::ICNNNetwork& network) {
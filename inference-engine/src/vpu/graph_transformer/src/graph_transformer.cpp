@@ -25,6 +25,8 @@
 #include <sstream>
 #include <iomanip>
 #include <atomic>
+#include <mutex>
+#include <exception>
 
 #include <precision_utils.h>
 #include <details/caseless.hpp>
@@ -32,6 +34,7 @@
 #include <description_buffer.hpp>
 #include <xml_parse_utils.h>
 #include <ie_util_internal.hpp>
+#include <ie_parallel.hpp>
 
 #include <vpu/parsed_config.hpp>
 #include <vpu/compile_env.hpp>
@@ -150,6 +153,34 @@ void CompileEnv::free() {
     g_compileEnv = nullptr;
 }
 
+void CompileEnv::parallelFor(std::size_t count, const std::function<void(std::size_t)>& func) {
+    const auto env = g_compileEnv;
+
+    std::mutex exceptionMutex;
+    std::exception_ptr exception;
+
+    ie::parallel_for(count, [&](std::size_t i) {
+        // the worker threads have no environment of their own, the calling thread may run some calls too
+        const auto prevEnv = g_compileEnv;
+        g_compileEnv = env;
+
+        try {
+            func(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (exception == nullptr) {
+                exception = std::current_exception();
+            }
+        }
+
+        g_compileEnv = prevEnv;
+    });
+
+    if (exception != nullptr) {
+        std::rethrow_exception(exception);
+    }
+}
+
 //
 // compileNetwork
 //
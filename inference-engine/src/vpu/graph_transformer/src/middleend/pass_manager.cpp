@@ -168,6 +168,9 @@ PassSet::Ptr PassManager::buildMiddleEnd() {
 
         ADD_PASS(splitHwConvAndPool);
         ADD_DUMP_PASS("splitHwConvAndPool");
+
+        ADD_PASS(mergeHwConvBatch);
+        ADD_DUMP_PASS("mergeHwConvBatch");
     }
 
     ADD_PASS(hwPadding);
@@ -5,7 +5,6 @@
 #include <vpu/middleend/pass_manager.hpp>
 
 #include <algorithm>
-#include <queue>
 #include <set>
 #include <memory>
 #include <string>
@@ -390,7 +389,7 @@ void PassImpl::packDataInCmx(const Model& model) {
     // Collect candidates
     //
 
-    std::queue<Data> candidatesForCMX;
+    DataVector candidatesForCMX;
 
     auto& visitedDatas = allocator.getCandidatesForCMX();
     visitedDatas.clear();
@@ -419,7 +418,7 @@ void PassImpl::packDataInCmx(const Model& model) {
 
             if (producer->getSHAVEsRequirements() != StageSHAVEsRequirements::NeedMax) {
                 if (visitedDatas.count(topParent) == 0) {
-                    candidatesForCMX.push(topParent);
+                    candidatesForCMX.push_back(topParent);
                     visitedDatas.insert(topParent);
                 }
             }
@@ -427,14 +426,40 @@ void PassImpl::packDataInCmx(const Model& model) {
     }
 
     //
-    // Try candidates one by one -> if allocation cycle is successfull, leave the data in CMX
+    // Order candidates by the DDR traffic they save per CMX they occupy: the data is written once and read
+    // by every consumer, while it holds CMX from its producer to the last consumer.
+    // So frequently read short-living datas go first and long-living ones do not block them.
     //
 
-    while (!candidatesForCMX.empty()) {
-        auto curCandidate = candidatesForCMX.front();
-        candidatesForCMX.pop();
+    DataMap<float> cmxPriorities;
+    for (const auto& candidate : candidatesForCMX) {
+        const auto producerInd = candidate->producer()->index();
+
+        int numAccesses = 1;
+        int lastConsumerInd = producerInd;
+        loopOverData(candidate, [&numAccesses, &lastConsumerInd](const Data& subData) {
+            for (const auto& consumer : subData->consumers()) {
+                ++numAccesses;
+                lastConsumerInd = std::max(lastConsumerInd, consumer->index());
+            }
+            return DataLoopStatus::NextChild;
+        });
+
+        const auto lifetime = std::max(lastConsumerInd - producerInd, 1);
+        cmxPriorities.emplace(candidate, static_cast<float>(numAccesses) / static_cast<float>(lifetime));
+    }
+
+    std::stable_sort(candidatesForCMX.begin(), candidatesForCMX.end(),
+        [&cmxPriorities](const Data& left, const Data& right) {
+            return cmxPriorities.at(left) > cmxPriorities.at(right);
+        });
+
+    //
+    // Try candidates one by one -> if allocation cycle is successfull, leave the data in CMX
+    //
 
-        env.log->trace("Try use CMX for Data [%s]", curCandidate->name());
+    for (const auto& curCandidate : candidatesForCMX) {
+        env.log->trace("Try use CMX for Data [%s] with priority %f", curCandidate->name(), cmxPriorities.at(curCandidate));
         VPU_LOGGER_SECTION(env.log);
 
         IE_ASSERT(curCandidate->parentDataEdge() == nullptr);
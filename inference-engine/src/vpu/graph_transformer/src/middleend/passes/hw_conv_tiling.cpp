@@ -8,6 +8,7 @@
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -34,6 +35,14 @@ private:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    std::vector<Stage> hwStages;
+    std::vector<HWTilingNS::ConvolutionOptions> convolutionOptions;
+    std::vector<HWTilingNS::ConvolutionOptions> optionsWithoutPool;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubConv) {
             continue;
@@ -47,19 +56,9 @@ void PassImpl::run(const Model& model) {
         const HWConvStageOptions stageOptions(origStage);
         const HWConvStageIO stageIO(origStage, origStage->output(0));
 
-        //
-        // Unsupported paddings
-        //
-
-        //
-        // Try to find "best" tiling
-        //
-
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+        hwStages.push_back(origStage);
 
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
+        convolutionOptions.emplace_back(
             origStage->name(),
             stageIO.origInput->desc().dims(),
             stageIO.origOutput->desc().dims(),
@@ -71,34 +70,47 @@ void PassImpl::run(const Model& model) {
             stageOptions.padRight,
             stageOptions.padTop,
             stageOptions.padBottom,
-            stageOptions.withPool
-        };
-
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
-
-
-        const HWTilingNS::HWConvolutionTiler& tiler = [&] {
-            if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
-                const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
-                    false
-                };
-
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
-            } else {
-                return tiler1stAttempt;
-            }
-        }();
+            stageOptions.withPool);
+
+        optionsWithoutPool.emplace_back(
+            origStage->name(),
+            stageIO.origInput->desc().dims(),
+            stageIO.origOutputDesc.dims(),
+            stageIO.origOutputDesc.dims(),
+            stageOptions.kernelSizeX,
+            stageOptions.kernelSizeY,
+            stageOptions.kernelStride,
+            stageOptions.padLeft,
+            stageOptions.padRight,
+            stageOptions.padTop,
+            stageOptions.padBottom,
+            false);
+    }
+
+    //
+    // Try to find "best" tiling: the search depends on the options of the stage only,
+    // so the stages are searched in parallel and the model is changed afterwards
+    //
+
+    std::vector<std::unique_ptr<HWTilingNS::HWConvolutionTiler>> tilers(hwStages.size());
+
+    CompileEnv::parallelFor(hwStages.size(), [&](std::size_t i) {
+        std::unique_ptr<HWTilingNS::HWConvolutionTiler> tiler(
+            new HWTilingNS::HWConvolutionTiler(convolutionOptions[i], direction, tilingsCount));
+
+        if (!tiler->isTilingPossible() && tiler->withPool()) {
+            tiler.reset(new HWTilingNS::HWConvolutionTiler(optionsWithoutPool[i], direction, tilingsCount));
+        }
+
+        tilers[i] = std::move(tiler);
+    });
+
+    for (std::size_t i = 0; i < hwStages.size(); i++) {
+        const auto& origStage = hwStages[i];
+        const auto& tiler = *tilers[i];
+
+        const HWConvStageOptions stageOptions(origStage);
+        const HWConvStageIO stageIO(origStage, origStage->output(0));
 
         //
         // Use SW stage if tiling optimization failed
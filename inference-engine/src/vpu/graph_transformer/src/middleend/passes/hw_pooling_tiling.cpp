@@ -9,7 +9,9 @@
 #include <string>
 #include <utility>
 #include <memory>
+#include <vector>
 
+#include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 #include <vpu/middleend/hw/pooling_tiling/hw_pooling_tiler.hpp>
@@ -32,6 +34,14 @@ private:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwPoolTiling);
 
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction =
+            HWTilingNS::Direction::INPUT_TO_OUTPUT;
+    // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    std::vector<Stage> hwStages;
+    std::vector<HWTilingNS::ConvolutionOptions> convolutionOptions;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubMaxPool &&
             origStage->type() != StageType::StubAvgPool) {
@@ -46,16 +56,9 @@ void PassImpl::run(const Model& model) {
         const HWPoolStageOptions stageOptions(origStage);
         const HWPoolStageIO stageIO(origStage, origStage->output(0));
 
-        //
-        // Try to find "best" tiling
-        //
-
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction =
-                HWTilingNS::Direction::INPUT_TO_OUTPUT;
-        // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+        hwStages.push_back(origStage);
 
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
+        convolutionOptions.emplace_back(
             origStage->name(),
             stageIO.origInput->desc().dims(),
             stageIO.origOutput->desc().dims(),
@@ -67,9 +70,25 @@ void PassImpl::run(const Model& model) {
             stageOptions.padRight,
             stageOptions.padTop,
             stageOptions.padBottom,
-            false};
+            false);
+    }
 
-        const HWTilingNS::HWPoolingTiler tiler(convolutionOptions, direction, tilingsCount);
+    //
+    // Try to find "best" tiling of every stage in parallel, the model is changed afterwards
+    //
+
+    std::vector<std::unique_ptr<HWTilingNS::HWPoolingTiler>> tilers(hwStages.size());
+
+    CompileEnv::parallelFor(hwStages.size(), [&](std::size_t i) {
+        tilers[i].reset(new HWTilingNS::HWPoolingTiler(convolutionOptions[i], direction, tilingsCount));
+    });
+
+    for (std::size_t i = 0; i < hwStages.size(); i++) {
+        const auto& origStage = hwStages[i];
+        const auto& tiler = *tilers[i];
+
+        const HWPoolStageOptions stageOptions(origStage);
+        const HWPoolStageIO stageIO(origStage, origStage->output(0));
 
         if (!tiler.isTilingPossible()) {
             origStage->attrs().set<bool>("tryHW", false);
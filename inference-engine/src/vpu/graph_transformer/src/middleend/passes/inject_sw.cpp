@@ -4,6 +4,7 @@
 
 #include <vpu/middleend/pass_manager.hpp>
 
+#include <cstdlib>
 #include <vector>
 #include <algorithm>
 #include <unordered_set>
@@ -126,6 +127,17 @@ void PassImpl::run(const Model& model) {
             }
         }
 
+        //
+        // Try the closest SW stages first: their datas are alive around the HW stage anyway,
+        // so e.g. the eltwise with residual of the previous HW stage overlaps the next one
+        // without extending the life of the datas and taking the memory from the rest of the candidates
+        //
+
+        const auto hwInd = hwStage->index();
+        std::stable_sort(swCandidates.begin(), swCandidates.end(), [hwInd](const Stage& left, const Stage& right) {
+            return std::abs(left->index() - hwInd) < std::abs(right->index() - hwInd);
+        });
+
         for (const auto& swStage : swCandidates) {
             //
             // Try to inject and check allocation, if it is failed -> revert
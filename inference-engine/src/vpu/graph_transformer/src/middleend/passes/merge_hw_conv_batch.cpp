@@ -0,0 +1,161 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/middleend/pass_manager.hpp>
+
+#include <memory>
+
+namespace vpu {
+
+namespace {
+
+//
+// HW convolution with batch is executed in the per-item loop of adjustDataBatch, which reloads
+// the weights for every item. 1x1 convolution with unit stride and no padding doesn't mix
+// neighbouring pixels, so the batch can be merged into the height instead:
+//
+//   [W, H, C, N] -> permute -> [W, H, N, C] -> reshape -> [W, H * N, C, 1]
+//
+// and the output is split back the same way. The permutes are SW copies, so the batch is merged
+// only for the weights bound convolutions, where the weights are larger than the item input.
+//
+
+bool isBatchMergeable(const Stage& stage) {
+    if (stage->type() != StageType::StubConv) {
+        return false;
+    }
+    if (!stage->attrs().getOrDefault<bool>("tryHW", false)) {
+        return false;
+    }
+    if (stage->attrs().getOrDefault<bool>("withPool", false)) {
+        return false;
+    }
+
+    const auto input = stage->input(0);
+    const auto weights = stage->input(1);
+    const auto output = stage->output(0);
+
+    if (input->desc().numDims() != 4 || input->desc().dim(Dim::N, 1) == 1) {
+        return false;
+    }
+
+    const auto kernelSizeX = stage->attrs().get<int>("kernelSizeX");
+    const auto kernelSizeY = stage->attrs().get<int>("kernelSizeY");
+    const auto kernelStrideX = stage->attrs().get<int>("kernelStrideX");
+    const auto kernelStrideY = stage->attrs().get<int>("kernelStrideY");
+    const auto padLeft = stage->attrs().get<int>("padLeft");
+    const auto padRight = stage->attrs().get<int>("padRight");
+    const auto padTop = stage->attrs().get<int>("padTop");
+    const auto padBottom = stage->attrs().get<int>("padBottom");
+    const auto groupSize = stage->attrs().get<int>("groupSize");
+
+    if (kernelSizeX != 1 || kernelSizeY != 1 || kernelStrideX != 1 || kernelStrideY != 1 ||
+        padLeft != 0 || padRight != 0 || padTop != 0 || padBottom != 0 || groupSize != 1) {
+        return false;
+    }
+
+    if (output->desc().dim(Dim::W) != input->desc().dim(Dim::W) ||
+        output->desc().dim(Dim::H) != input->desc().dim(Dim::H)) {
+        return false;
+    }
+
+    const auto itemInputSize = input->desc().totalDimSize() / input->desc().dim(Dim::N);
+    return weights->desc().totalDimSize() >= itemInputSize;
+}
+
+class PassImpl final : public Pass {
+public:
+    explicit PassImpl(const StageBuilder::Ptr& stageBuilder) : _stageBuilder(stageBuilder) {}
+
+    void run(const Model& model) override;
+
+private:
+    StageBuilder::Ptr _stageBuilder;
+};
+
+void PassImpl::run(const Model& model) {
+    VPU_PROFILE(mergeHwConvBatch);
+
+    for (const auto& stage : model->getStages()) {
+        if (!isBatchMergeable(stage)) {
+            continue;
+        }
+
+        const auto input = stage->input(0);
+        const auto output = stage->output(0);
+
+        const auto batch = input->desc().dim(Dim::N);
+        const auto width = input->desc().dim(Dim::W);
+        const auto height = input->desc().dim(Dim::H);
+        const auto inputC = input->desc().dim(Dim::C);
+        const auto outputC = output->desc().dim(Dim::C);
+
+        const DimValues_<Dim> swapBatchAndChannels{{Dim::W, Dim::W}, {Dim::H, Dim::H}, {Dim::C, Dim::N}, {Dim::N, Dim::C}};
+
+        const auto permutedInput = model->duplicateData(
+            input,
+            "@permute-batch",
+            DataDesc{width, height, batch, inputC});
+
+        _stageBuilder->addPermuteStage(
+            model,
+            permutedInput->name(),
+            stage->origLayer(),
+            input,
+            permutedInput,
+            swapBatchAndChannels);
+
+        const auto convInput = model->duplicateData(
+            input,
+            "@merge-batch",
+            DataDesc{width, height * batch, inputC, 1});
+
+        _stageBuilder->addReshapeStage(
+            model,
+            convInput->name(),
+            stage->origLayer(),
+            permutedInput,
+            convInput);
+
+        const auto convOutput = model->duplicateData(
+            output,
+            "@merge-batch",
+            DataDesc{width, height * batch, outputC, 1});
+
+        const auto permutedOutput = model->duplicateData(
+            output,
+            "@permute-batch",
+            DataDesc{width, height, batch, outputC});
+
+        _stageBuilder->addReshapeStage(
+            model,
+            permutedOutput->name(),
+            stage->origLayer(),
+            convOutput,
+            permutedOutput);
+
+        _stageBuilder->addPermuteStage(
+            model,
+            output->name() + "@split-batch",
+            stage->origLayer(),
+            permutedOutput,
+            output,
+            swapBatchAndChannels);
+
+        model->replaceStageInput(stage->inputEdge(0), convInput);
+        model->replaceStageOutput(stage->outputEdge(0), convOutput);
+
+        if (stage->attrs().has("origConvOutput")) {
+            stage->attrs().set("origConvOutput", convOutput->desc());
+        }
+    }
+}
+
+}  // namespace
+
+Pass::Ptr PassManager::mergeHwConvBatch() {
+    return std::make_shared<PassImpl>(_stageBuilder);
+}
+
+}  // namespace vpu
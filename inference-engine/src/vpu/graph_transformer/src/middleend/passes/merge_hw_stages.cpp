@@ -8,6 +8,9 @@
 #include <memory>
 #include <unordered_set>
 
+#include <precision_utils.h>
+#include <ie_parallel.hpp>
+
 #include <vpu/compile_env.hpp>
 #include <vpu/middleend/hw/utility.hpp>
 #include <vpu/middleend/sw/utility.hpp>
@@ -16,6 +19,110 @@ namespace vpu {
 
 namespace {
 
+// Biases of the convolution with the next per-channel Scale or ScaleShift folded into it:
+//   scale * (conv + biases) + shift = scale * conv + (scale * biases + shift)
+// The convolution output might be already scaled by the factor, so the shift is scaled too.
+class FoldedScaleBiasesContent final : public CalculatedDataContent {
+public:
+    FoldedScaleBiasesContent(
+            const DataContent::Ptr& biasesContent,
+            const DataContent::Ptr& scalesContent,
+            const DataContent::Ptr& shiftsContent,
+            float scaleFactor) :
+            CalculatedDataContent({biasesContent, scalesContent, shiftsContent}), _scaleFactor(scaleFactor) {
+    }
+
+protected:
+    void fillTempBuf(const SmallVector<DataContent::Ptr, 2>& baseContents, void* tempBuf) const override {
+        VPU_PROFILE(FoldedScaleBiasesContent);
+
+        IE_ASSERT(baseContents.size() == 3);
+        IE_ASSERT(baseContents[1] != nullptr);
+
+        const auto biasesPtr = baseContents[0] != nullptr ? baseContents[0]->get<fp16_t>() : nullptr;
+        const auto scalesPtr = baseContents[1]->get<fp16_t>();
+        const auto shiftsPtr = baseContents[2] != nullptr ? baseContents[2]->get<fp16_t>() : nullptr;
+
+        auto dstPtr = static_cast<fp16_t*>(tempBuf);
+
+        ie::parallel_for(desc().totalDimSize(), [this, biasesPtr, scalesPtr, shiftsPtr, dstPtr](int i) {
+            const auto bias = biasesPtr != nullptr ? ie::PrecisionUtils::f16tof32(biasesPtr[i]) : 0.0f;
+            const auto shift = shiftsPtr != nullptr ? ie::PrecisionUtils::f16tof32(shiftsPtr[i]) : 0.0f;
+            dstPtr[i] = ie::PrecisionUtils::f32tof16(
+                ie::PrecisionUtils::f16tof32(scalesPtr[i]) * bias + shift * _scaleFactor);
+        });
+    }
+
+private:
+    float _scaleFactor = 1.0f;
+};
+
+Stage getNextScaleStage(const Stage& stage) {
+    auto nextScale = getOneOfSingleNextStage(stage, {StageType::Scale, StageType::ScaleShift});
+    if (nextScale == nullptr || nextScale->input(0) != stage->output(0)) {
+        return nullptr;
+    }
+
+    const auto numChannels = stage->output(0)->desc().dim(Dim::C);
+
+    const auto isPerChannelConst = [numChannels](const Data& data) {
+        return data->usage() == DataUsage::Const &&
+               data->desc().type() == DataType::FP16 &&
+               data->desc().totalDimSize() == numChannels;
+    };
+
+    for (int i = 1; i < nextScale->numInputs(); ++i) {
+        if (!isPerChannelConst(nextScale->input(i))) {
+            return nullptr;
+        }
+    }
+
+    const auto weights = stage->input(1);
+    const auto biases = stage->input(2);
+    if (weights->usage() != DataUsage::Const ||
+        weights->desc().numDims() != 4 || weights->desc().dim(Dim::N) != numChannels ||
+        (biases->usage() != DataUsage::Fake && !isPerChannelConst(biases))) {
+        return nullptr;
+    }
+
+    return nextScale;
+}
+
+void foldScaleStage(const Model& model, const Stage& stage, const Stage& scaleStage) {
+    const auto weights = stage->input(1);
+    const auto biases = stage->input(2);
+
+    const auto scales = scaleStage->input(1);
+    const auto shifts = scaleStage->type() == StageType::ScaleShift ? scaleStage->input(2) : nullptr;
+
+    const auto scaleFactor = stage->attrs().getOrDefault<float>("scaleFactor", 1.0f);
+
+    const auto foldedWeights = model->duplicateData(
+        weights,
+        "@scaled",
+        weights->desc(),
+        scaledChannelContent(weights->content(), scales->content()));
+    model->replaceStageInput(stage->inputEdge(1), foldedWeights);
+
+    if (biases->usage() != DataUsage::Fake || shifts != nullptr) {
+        const auto foldedBiases = model->addConstData(
+            stage->name() + "@biases@scaled",
+            DataDesc({stage->output(0)->desc().dim(Dim::C)}),
+            std::make_shared<FoldedScaleBiasesContent>(
+                biases->usage() != DataUsage::Fake ? biases->content() : nullptr,
+                scales->content(),
+                shifts != nullptr ? shifts->content() : nullptr,
+                scaleFactor));
+        model->replaceStageInput(stage->inputEdge(2), foldedBiases);
+    }
+
+    const auto output = scaleStage->output(0);
+
+    model->disconnectStage(scaleStage);
+    model->replaceStageOutput(stage->outputEdge(0), output);
+    model->removeStage(scaleStage);
+}
+
 Stage getNextPoolStage(const Stage& stage, const Data& output) {
     auto input = stage->input(0);
 
@@ -100,6 +207,18 @@ void PassImpl::run(const Model& model) {
             stage->attrs().set("origConvOutput", output->desc());
         }
 
+        //
+        // Try to fold next per-channel Scale or ScaleShift into the convolution weights and biases,
+        // so the post-op after it could be merged as well (e.g. Conv -> ScaleShift -> Clamp)
+        //
+
+        if (stage->type() == StageType::StubConv) {
+            if (auto nextScaleStage = getNextScaleStage(stage)) {
+                foldScaleStage(model, stage, nextScaleStage);
+                output = stage->output(0);
+            }
+        }
+
         //
         // Try to merge next ReLU layer or Clamp
         //
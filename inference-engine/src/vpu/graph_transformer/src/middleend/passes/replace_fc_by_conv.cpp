@@ -123,6 +123,12 @@ void PassImpl::run(const Model& model) {
                 break;
             }
         }
+        // Other batches are merged into the width, so the weights are loaded once for the whole batch
+        // and not once per item of the batch loop
+        if (batchStepW == 1 && inBatch > 1 && inBatch <= 100) {
+            batchStepW = inBatch;
+            batchStepH = 1;
+        }
 
         Data convInput;
         if (batchStepW == 1 && batchStepH == 1) {
@@ -265,8 +265,9 @@ protected:
             for (int c = 0; c < numC; c++) {
                for (int h = 0; h < numH; h++) {
                    for (int w = 0; w < numW; w++) {
-                       dstPtr[n * numC * numH * numW + c * numH * numW + h * numW + w] =
-                               srcPtr[n * numC * numH * numW + c * numH * numW + h * numW + w] * scale[n];
+                       const auto ind = n * numC * numH * numW + c * numH * numW + h * numW + w;
+                       dstPtr[ind] = ie::PrecisionUtils::f32tof16(
+                               ie::PrecisionUtils::f16tof32(srcPtr[ind]) * ie::PrecisionUtils::f16tof32(scale[n]));
                    }
                }
             }
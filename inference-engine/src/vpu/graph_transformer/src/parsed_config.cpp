@@ -107,6 +107,7 @@ void ParsedConfig::parse(const std::map<std::string, std::string>& config) {
     static const std::unordered_map<std::string, PerfReport> perfReports {
         { VPU_CONFIG_VALUE(PER_LAYER), PerfReport::PerLayer },
         { VPU_CONFIG_VALUE(PER_STAGE), PerfReport::PerStage },
+        { VPU_CONFIG_VALUE(PER_STAGE_DETAILED), PerfReport::PerStageDetailed },
     };
 
     static const auto parseStrides = [](const std::string& src) {
@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/frontend/frontend.hpp>
+
+#include <precision_utils.h>
+
+#include <memory>
+#include <string>
+
+namespace vpu {
+
+namespace {
+
+float getScalarRange(const ie::CNNLayerPtr& layer, const Data& range, const char* name) {
+    VPU_THROW_UNLESS(range->usage() == DataUsage::Const,
+        "FakeQuantize layer %v with name %v: %v must be constant",
+        layer->type, layer->name, name);
+    VPU_THROW_UNLESS(range->desc().totalDimSize() == 1,
+        "FakeQuantize layer %v with name %v: only per-tensor %v is supported, got %v values",
+        layer->type, layer->name, name, range->desc().totalDimSize());
+
+    return ie::PrecisionUtils::f16tof32(range->content()->get<fp16_t>()[0]);
+}
+
+}  // namespace
+
+//
+// The device has no quantized compute, so FakeQuantize on activations is executed in FP16
+// as the clamp to the input range followed by the linear mapping to the output range.
+// The rounding to the quantization levels is omitted, which keeps the result within
+// half of the quantization step of the reference.
+// FakeQuantize on weights is folded into the weights by moveConstInputsToBlobs.
+//
+
+void FrontEnd::parseFakeQuantize(const Model& model, const ie::CNNLayerPtr& layer, const DataVector& inputs, const DataVector& outputs) const {
+    VPU_THROW_UNLESS(inputs.size() == 5,
+        "FakeQuantize layer %v with name %v must have 5 inputs, actually provided %v",
+        layer->type, layer->name, inputs.size());
+    VPU_THROW_UNLESS(outputs.size() == 1,
+        "FakeQuantize layer %v with name %v must have 1 output, actually provided %v",
+        layer->type, layer->name, outputs.size());
+
+    const auto levels = layer->GetParamAsInt("levels");
+    VPU_THROW_UNLESS(levels >= 2,
+        "FakeQuantize layer %v with name %v has invalid levels %v",
+        layer->type, layer->name, levels);
+
+    const auto inputLow   = getScalarRange(layer, inputs[1], "input_low");
+    const auto inputHigh  = getScalarRange(layer, inputs[2], "input_high");
+    const auto outputLow  = getScalarRange(layer, inputs[3], "output_low");
+    const auto outputHigh = getScalarRange(layer, inputs[4], "output_high");
+
+    VPU_THROW_UNLESS(inputLow < inputHigh,
+        "FakeQuantize layer %v with name %v has empty input range [%v, %v]",
+        layer->type, layer->name, inputLow, inputHigh);
+
+    auto input = inputs[0];
+    auto output = outputs[0];
+
+    const auto scale = (outputHigh - outputLow) / (inputHigh - inputLow);
+    const auto bias = outputLow - inputLow * scale;
+
+    if (scale == 1.0f && bias == 0.0f) {
+        _stageBuilder->addClampStage(model, layer->name, layer, inputLow, inputHigh, input, output);
+        return;
+    }
+
+    auto clampOutput = model->duplicateData(output, "@clamp");
+
+    _stageBuilder->addClampStage(model, layer->name + "@clamp", layer, inputLow, inputHigh, input, clampOutput);
+    _stageBuilder->addPowerStage(model, layer->name, layer, scale, 1.0f, bias, clampOutput, output);
+}
+
+}  // namespace vpu
@@ -3,6 +3,7 @@
 //
 
 #include <memory>
+#include <utility>
 #include "myriad_async_infer_request.h"
 #include <vpu/utils/profiling.hpp>
 
@@ -11,15 +12,23 @@ using namespace InferenceEngine;
 
 MyriadAsyncInferRequest::MyriadAsyncInferRequest(MyriadInferRequest::Ptr request,
                                                  const InferenceEngine::ITaskExecutor::Ptr &taskExecutorStart,
-                                                 const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
-                                                 const InferenceEngine::ITaskExecutor::Ptr &taskExecutorGetResult)
+                                                 const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor)
 : InferenceEngine::AsyncInferRequestThreadSafeDefault(request, taskExecutorStart, callbackExecutor),
-    _request(request), _taskExecutorGetResult(taskExecutorGetResult) {
+    _request(request) {
+        // the result is read on the executor of the device the inference is routed to
+        struct GetResultExecutor : public ITaskExecutor {
+            explicit GetResultExecutor(MyriadInferRequest* request) : _request(request) {}
+            void run(Task task) override {
+                _request->getResultExecutor()->run(std::move(task));
+            }
+            MyriadInferRequest* _request;
+        };
+
         _pipeline = {
             {_requestExecutor, [this] {
                 _request->InferAsync();
             }},
-            {_taskExecutorGetResult, [this] {
+            {std::make_shared<GetResultExecutor>(_request.get()), [this] {
                 _request->GetResult();
             }}
         };
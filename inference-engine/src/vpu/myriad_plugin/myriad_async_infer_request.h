@@ -14,13 +14,11 @@ class MyriadAsyncInferRequest : virtual public InferenceEngine::AsyncInferReques
 public:
     MyriadAsyncInferRequest(MyriadInferRequest::Ptr request,
                                 const InferenceEngine::ITaskExecutor::Ptr &taskExecutorStart,
-                                const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
-                                const InferenceEngine::ITaskExecutor::Ptr &taskExecutorGetResult);
+                                const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
 
     ~MyriadAsyncInferRequest() override;
 private:
     MyriadInferRequest::Ptr _request;
-    InferenceEngine::ITaskExecutor::Ptr _taskExecutorGetResult;
 };
 
 }  // namespace MyriadPlugin
@@ -44,6 +44,11 @@ IE_SUPPRESS_DEPRECATED_START
 
         VPU_MYRIAD_CONFIG_KEY(PLUGIN_LOG_FILE_PATH),
         VPU_MYRIAD_CONFIG_KEY(DEVICE_CONNECT_TIMEOUT),
+        VPU_MYRIAD_CONFIG_KEY(NUMBER_OF_DEVICES),
+        VPU_MYRIAD_CONFIG_KEY(FIFO_DEPTH),
+        VPU_MYRIAD_CONFIG_KEY(BLOB_CACHE_DIR),
+        VPU_MYRIAD_CONFIG_KEY(ATTACH_BOOTED_DEVICES),
+        VPU_MYRIAD_CONFIG_KEY(USB_CHUNK_SIZE),
     });
 IE_SUPPRESS_DEPRECATED_END
 
@@ -106,6 +111,11 @@ IE_SUPPRESS_DEPRECATED_END
     setOption(_deviceConnectTimeout, config, VPU_MYRIAD_CONFIG_KEY(DEVICE_CONNECT_TIMEOUT), parseSeconds);
     setOption(_powerConfig, powerConfigs, config, VPU_MYRIAD_CONFIG_KEY(POWER_MANAGEMENT));
     setOption(_numExecutors, config, VPU_MYRIAD_CONFIG_KEY(THROUGHPUT_STREAMS), parseInt);
+    setOption(_numDevices, config, VPU_MYRIAD_CONFIG_KEY(NUMBER_OF_DEVICES), parseInt);
+    setOption(_fifoDepth, config, VPU_MYRIAD_CONFIG_KEY(FIFO_DEPTH), parseInt);
+    setOption(_blobCacheDir, config, VPU_MYRIAD_CONFIG_KEY(BLOB_CACHE_DIR));
+    setOption(_attachBootedDevices, switches, config, VPU_MYRIAD_CONFIG_KEY(ATTACH_BOOTED_DEVICES));
+    setOption(_usbChunkSize, config, VPU_MYRIAD_CONFIG_KEY(USB_CHUNK_SIZE), parseInt);
 
 IE_SUPPRESS_DEPRECATED_START
     setOption(_forceReset, switches, config, VPU_CONFIG_KEY(FORCE_RESET));
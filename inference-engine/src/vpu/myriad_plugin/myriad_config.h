@@ -28,6 +28,8 @@ VPU_DECLARE_ENUM(PowerConfig,
 class MyriadConfig final : public ParsedConfig {
 public:
     static constexpr int UNDEFINED_THROUGHPUT_STREAMS = -1;
+    static constexpr int UNDEFINED_FIFO_DEPTH = 0;
+    static constexpr int UNDEFINED_USB_CHUNK_SIZE = 0;
 
 public:
     const std::string& pluginLogFilePath() const {
@@ -62,10 +64,30 @@ public:
         return _numExecutors;
     }
 
+    int numDevices() const {
+        return _numDevices;
+    }
+
+    int fifoDepth() const {
+        return _fifoDepth;
+    }
+
     const std::string& deviceName() const {
         return _deviceName;
     }
 
+    const std::string& blobCacheDir() const {
+        return _blobCacheDir;
+    }
+
+    bool attachBootedDevices() const {
+        return _attachBootedDevices;
+    }
+
+    int usbChunkSize() const {
+        return _usbChunkSize;
+    }
+
 protected:
     const std::unordered_set<std::string>& getCompileOptions() const override;
     const std::unordered_set<std::string>& getRunTimeOptions() const override;
@@ -81,7 +103,12 @@ private:
     std::chrono::milliseconds _watchdogInterval = std::chrono::milliseconds(1000);
     std::chrono::seconds _deviceConnectTimeout = std::chrono::seconds(15);
     int _numExecutors = UNDEFINED_THROUGHPUT_STREAMS;
+    int _numDevices = 1;
+    int _fifoDepth = UNDEFINED_FIFO_DEPTH;
     std::string _deviceName;
+    std::string _blobCacheDir;
+    bool _attachBootedDevices = false;
+    int _usbChunkSize = UNDEFINED_USB_CHUNK_SIZE;
 };
 
 }  // namespace MyriadPlugin
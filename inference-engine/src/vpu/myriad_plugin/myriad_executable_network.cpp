@@ -3,12 +3,15 @@
 //
 
 #include <algorithm>
+#include <cstdio>
+#include <string>
 #include <utility>
 
 #include <ie_metric_helpers.hpp>
 #include "cnn_network_impl.hpp"
 #include "exec_graph_info.hpp"
 #include <myriad_executable_network.h>
+#include <ie_compiled_network_cache.hpp>
 #include <vpu/blob_reader.hpp>
 #include <vpu/utils/profiling.hpp>
 #include <details/ie_cnn_network_tools.h>
@@ -45,6 +48,23 @@ static void selectNumberOfExecutors(const ncDevicePlatform_t& platform,
     }
 }
 
+static int selectFifoDepth(const DeviceDesc& device, int numExecutors, int fifoDepth) {
+    if (fifoDepth == MyriadConfig::UNDEFINED_FIFO_DEPTH) {
+        // every executor runs an inference while the next one is transferred,
+        // on USB the transfers may take longer than the execution, so one more inference per executor is queued
+        fifoDepth = (device._platform == NC_MYRIAD_2 && numExecutors == 1) ? 4 : 2 * numExecutors;
+        if (device._protocol == NC_USB) {
+            fifoDepth += numExecutors;
+        }
+    }
+
+    if (fifoDepth < 1) {
+        THROW_IE_EXCEPTION << "FIFO depth must be not less than 1, " << fifoDepth << " provided";
+    }
+
+    return fifoDepth;
+}
+
 ExecutableNetwork::ExecutableNetwork(
         std::vector<DevicePtr>& devicePool,
         const MyriadConfig& config) :
@@ -56,8 +76,32 @@ ExecutableNetwork::ExecutableNetwork(
         _config.logLevel(),
         defaultOutput(_config.pluginLogFilePath()));
 
-    _executor = std::make_shared<MyriadExecutor>(_config.forceReset(), _config.logLevel(), _log);
+    if (_config.numDevices() < 1) {
+        THROW_IE_EXCEPTION << "Number of devices must be not less than 1, " << _config.numDevices() << " provided";
+    }
+
+    _executor = std::make_shared<MyriadExecutor>(_config.forceReset(), _config.attachBootedDevices(),
+                                                 _config.usbChunkSize(), _config.logLevel(), _log);
     _device = _executor->openDevice(devicePool, _config);
+    _devices = {_device};
+
+    while (static_cast<int>(_devices.size()) < _config.numDevices() && _device->isBooted()) {
+        auto device = _executor->openDevice(devicePool, _config);
+        const auto isUsable = device->isBooted() && device->_platform == _device->_platform &&
+                              std::find(_devices.begin(), _devices.end(), device) == _devices.end();
+        if (!isUsable) {
+            // there are no more suitable devices in the pool, the one opened is given back
+            GraphDesc notAllocatedGraph;
+            _executor->deallocateGraph(device, notAllocatedGraph);
+            break;
+        }
+        _devices.push_back(device);
+    }
+
+    if (static_cast<int>(_devices.size()) < _config.numDevices()) {
+        _log->warning("%d of %d requested devices are available for the network",
+                      _devices.size(), _config.numDevices());
+    }
 
     _supportedMetrics = {
         METRIC_KEY(NETWORK_NAME),
@@ -70,7 +114,8 @@ ExecutableNetwork::ExecutableNetwork(
 
 ExecutableNetwork::ExecutableNetwork(
         ICNNNetwork& network, std::vector<DevicePtr>& devicePool,
-        const MyriadConfig& config) :
+        const MyriadConfig& config,
+        const std::string& blobCacheKey) :
             ExecutableNetwork(devicePool, config) {
     VPU_PROFILE(ExecutableNetwork);
 
@@ -81,6 +126,28 @@ ExecutableNetwork::ExecutableNetwork(
 
     if (_device == nullptr)
         THROW_IE_EXCEPTION << "No device was detected";
+
+    char networkName[1024] = {};
+    network.getName(networkName, sizeof(networkName));
+
+    // the blob is compiled for the platform of the device, which is known once it is opened
+    const ie::details::CompiledNetworkCache cache(_config.blobCacheDir());
+    const auto cacheEntry = blobCacheKey.empty() ? std::string() :
+        blobCacheKey + (_device->_platform == NC_MYRIAD_2 ? "_myriad2" : "_myriadx");
+
+    if (!cacheEntry.empty() && _device->isBooted() && cache.contains(cacheEntry)) {
+        try {
+            std::ifstream blobFile(cache.getBlobPath(cacheEntry), std::ios::binary);
+            Import(blobFile, networkName);
+            return;
+        } catch (const ie::details::InferenceEngineException& e) {
+            // the entry is broken or produced by an incompatible plugin build, so it is compiled again
+            _log->warning("Cached blob %s can not be loaded: %s", cache.getBlobPath(cacheEntry), e.what());
+            cache.remove(cacheEntry);
+            _graphBlob.clear();
+        }
+    }
+
     auto compiledGraph = compileNetwork(
         network,
         static_cast<Platform>(_device->_platform),
@@ -96,28 +163,55 @@ ExecutableNetwork::ExecutableNetwork(
     _inputInfo  = std::move(compiledGraph->inputInfo);
     _outputInfo = std::move(compiledGraph->outputInfo);
 
+    if (!cacheEntry.empty()) {
+        const auto tempPath = cache.getTempBlobPath(cacheEntry);
+        std::ofstream blobFile(tempPath, std::ios::out | std::ios::binary);
+        Export(blobFile);
+        blobFile.close();
+        if (!blobFile.fail()) {
+            cache.commit(tempPath, cacheEntry);
+        } else {
+            std::remove(tempPath.c_str());
+            _log->warning("Compiled blob can not be written to the %s cache directory", _config.blobCacheDir());
+        }
+    }
+
     if (!_device->isBooted()) {
         return;
     }
 
-    char networkName[1024] = {};
-    network.getName(networkName, sizeof(networkName));
-    _executor->allocateGraph(_device, _graphDesc, _graphBlob, compiledGraph->blobHeader, compiledGraph->numActiveStages, networkName, _actualNumExecutors);
+    allocateGraphs(compiledGraph->blobHeader, compiledGraph->numActiveStages, networkName);
     if (_config.exclusiveAsyncRequests()) {
         ExecutorManager *executorManager = ExecutorManager::getInstance();
         _taskExecutor = executorManager->getExecutor("MYRIAD");
     }
+}
+
+void ExecutableNetwork::allocateGraphs(const std::pair<const char*, size_t> &graphHeaderDesc,
+                                       size_t numStages,
+                                       const char* networkName) {
+    std::vector<DeviceGraph::Ptr> graphs;
+    for (auto& device : _devices) {
+        auto graph = std::make_shared<DeviceGraph>();
+        graph->_device = device;
+        graph->_fifoDepth = selectFifoDepth(*device, _actualNumExecutors, _config.fifoDepth());
+        _executor->allocateGraph(graph->_device, graph->_graphDesc, _graphBlob, graphHeaderDesc, numStages,
+                                 networkName, _actualNumExecutors, graph->_fifoDepth);
 
-    for (size_t i = 0; i < _maxTaskExecutorGetResultCount; i++) {
         std::stringstream idStream;
-        idStream << networkName << "_TaskExecutorGetResult" << i;
-        _taskExecutorGetResultIds.emplace(idStream.str());
+        idStream << networkName << "_TaskExecutorGetResult" << graphs.size();
+        graph->_getResultExecutor = ExecutorManager::getInstance()->getExecutor(idStream.str());
+
+        std::stringstream queueIdStream;
+        queueIdStream << networkName << "_TaskExecutorQueue" << graphs.size();
+        graph->_batcher = std::make_shared<InferenceBatcher>(_executor, graph->_graphDesc, graph->_fifoDepth,
+            ExecutorManager::getInstance()->getExecutor(queueIdStream.str()));
+        graphs.push_back(graph);
     }
+    _router = std::make_shared<GraphRouter>(std::move(graphs));
 }
 
-void ExecutableNetwork::Import(std::istream& strm,
-                               std::vector<DevicePtr> &devicePool,
-                               const MyriadConfig& config) {
+void ExecutableNetwork::Import(std::istream& strm, const char* networkName) {
     std::ostringstream blobContentStream;
     blobContentStream << strm.rdbuf();
     const std::string& blobContentString = blobContentStream.str();
@@ -127,9 +221,6 @@ void ExecutableNetwork::Import(std::istream& strm,
         return;
     }
 
-    // TODO: better name
-    char networkName[1024] = "importedNetwork";
-
     BlobReader blobReader;
     blobReader.parse(_graphBlob);
 
@@ -144,7 +235,7 @@ void ExecutableNetwork::Import(std::istream& strm,
     _inputInfo  = blobReader.getInputInfo();
     _outputInfo = blobReader.getOutputInfo();
 
-    _executor->allocateGraph(_device, _graphDesc, _graphBlob, blobHeader, numStages, networkName, _actualNumExecutors);
+    allocateGraphs(blobHeader, numStages, networkName);
 
     _graphMetaData.stagesMeta.resize(numStages);
     for (auto &meta : _graphMetaData.stagesMeta) {
@@ -156,12 +247,6 @@ void ExecutableNetwork::Import(std::istream& strm,
         ExecutorManager *executorManager = ExecutorManager::getInstance();
         _taskExecutor = executorManager->getExecutor("MYRIAD");
     }
-
-    for (size_t i = 0; i < _maxTaskExecutorGetResultCount; i++) {
-        std::stringstream idStream;
-        idStream << networkName << "_TaskExecutorGetResult" << i;
-        _taskExecutorGetResultIds.emplace(idStream.str());
-    }
 }
 
 ExecutableNetwork::ExecutableNetwork(std::istream& strm,
@@ -169,7 +254,8 @@ ExecutableNetwork::ExecutableNetwork(std::istream& strm,
                                const MyriadConfig& config) :
     ExecutableNetwork(devicePool, config) {
     VPU_PROFILE(ExecutableNetwork);
-    Import(strm, devicePool, config);
+    // TODO: better name
+    Import(strm, "importedNetwork");
 }
 
 ExecutableNetwork::ExecutableNetwork(
@@ -179,18 +265,29 @@ ExecutableNetwork::ExecutableNetwork(
     ExecutableNetwork(devicePool, config) {
     VPU_PROFILE(ExecutableNetwork);
     std::ifstream blobFile{blobFilename, std::ios::binary};
-    Import(blobFile, devicePool, config);
+    // TODO: better name
+    Import(blobFile, "importedNetwork");
 }
 
 void ExecutableNetwork::GetMetric(const std::string &name, Parameter &result, ResponseDesc *resp) const {
     if (name == METRIC_KEY(NETWORK_NAME)) {
-        result = IE_SET_METRIC(NETWORK_NAME, _graphDesc._name);
+        result = IE_SET_METRIC(NETWORK_NAME,
+            _router != nullptr ? _router->graphs().front()->_graphDesc._name : std::string());
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         result = IE_SET_METRIC(SUPPORTED_METRICS, _supportedMetrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, std::vector<std::string>());
     } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
-        result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(2u * _actualNumExecutors));
+        // every device gets own requests, as many as its FIFOs hold to keep the transfers overlapped with the execution
+        unsigned int optimalNumOfRequests = 0;
+        if (_router != nullptr) {
+            for (const auto& graph : _router->graphs()) {
+                optimalNumOfRequests += std::max(2 * _actualNumExecutors, graph->_fifoDepth);
+            }
+        } else {
+            optimalNumOfRequests = static_cast<unsigned int>(2u * _actualNumExecutors * _devices.size());
+        }
+        result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, optimalNumOfRequests);
     } else if (name == METRIC_KEY(DEVICE_THERMAL)) {
         result = IE_SET_METRIC(DEVICE_THERMAL, _executor->GetThermal(_device));
     } else {
@@ -255,7 +352,7 @@ InferenceEngine::ICNNNetwork::Ptr ExecutableNetwork::buildRuntimeGraph(GraphMeta
     // Write performance counts
     //
 
-    auto perfInfo = _executor->getPerfTimeInfo(_graphDesc._graphHandle);
+    auto perfInfo = _executor->getPerfTimeInfo(graphHandle());
 
     const auto deviceTimings = perfInfo.data();
     auto deviceTimingsCount = perfInfo.size();
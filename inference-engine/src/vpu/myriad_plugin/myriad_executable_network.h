@@ -9,7 +9,7 @@
 #include <vector>
 #include <map>
 #include <unordered_map>
-#include <queue>
+#include <utility>
 #include <sstream>
 #include <fstream>
 
@@ -32,9 +32,14 @@ class ExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDef
 public:
     typedef std::shared_ptr<ExecutableNetwork> Ptr;
 
+    /**
+     * @param blobCacheKey - the key of the network and its config in the blob cache directory of the config,
+     * if it is empty the network is always compiled
+     */
     explicit ExecutableNetwork(InferenceEngine::ICNNNetwork &network,
                                std::vector<DevicePtr> &devicePool,
-                               const MyriadConfig& config);
+                               const MyriadConfig& config,
+                               const std::string& blobCacheKey = std::string());
 
     explicit ExecutableNetwork(std::istream& strm,
                                std::vector<DevicePtr> &devicePool,
@@ -47,7 +52,11 @@ public:
 
     virtual ~ExecutableNetwork() {
         try {
-            _executor->deallocateGraph(_device, _graphDesc);
+            if (_router != nullptr) {
+                for (const auto& graph : _router->graphs()) {
+                    _executor->deallocateGraph(graph->_device, graph->_graphDesc);
+                }
+            }
         }
         catch (...) {
             std::cerr << "ERROR ~ExecutableNetwork():\n"
@@ -62,7 +71,7 @@ public:
                                << _device->_platform;
         }
 
-        return std::make_shared<MyriadInferRequest>(_graphDesc, networkInputs, networkOutputs,
+        return std::make_shared<MyriadInferRequest>(_router, networkInputs, networkOutputs,
                                                     _inputInfo, _outputInfo,
                                                     _graphMetaData.stagesMeta, _config, _log, _executor);
     }
@@ -73,14 +82,13 @@ public:
                                << _device->_platform;
         }
 
-        auto syncRequestImpl = std::make_shared<MyriadInferRequest>(_graphDesc, _networkInputs, _networkOutputs,
+        auto syncRequestImpl = std::make_shared<MyriadInferRequest>(_router, _networkInputs, _networkOutputs,
                                                                     _inputInfo, _outputInfo,
                                                                     _graphMetaData.stagesMeta, _config, _log,
                                                                     _executor);
         syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
-        auto taskExecutorGetResult = getNextTaskExecutor();
         auto asyncTreadSafeImpl = std::make_shared<MyriadAsyncInferRequest>(
-                syncRequestImpl, _taskExecutor, _callbackExecutor, taskExecutorGetResult);
+                syncRequestImpl, _taskExecutor, _callbackExecutor);
         asyncRequest.reset(new InferenceEngine::InferRequestBase<InferenceEngine::AsyncInferRequestThreadSafeDefault>(
                            asyncTreadSafeImpl),
                            [](InferenceEngine::IInferRequest *p) { p->Release(); });
@@ -110,16 +118,16 @@ public:
         THROW_IE_EXCEPTION << "GetMappedTopology is not implemented\n";
     }
 
-    void Import(std::istream& strm,
-                std::vector<DevicePtr> &devicePool,
-                const MyriadConfig& config);
+    void Import(std::istream& strm, const char* networkName);
 
 private:
     Logger::Ptr _log;
     MyriadExecutorPtr _executor;
     std::vector<char> _graphBlob;
-    GraphDesc _graphDesc;
     DevicePtr _device;
+    // the devices the network is loaded to, the first one is _device
+    std::vector<DevicePtr> _devices;
+    GraphRouter::Ptr _router;
     GraphMetaInfo _graphMetaData;
     MyriadConfig _config;
     int _actualNumExecutors = 0;
@@ -128,22 +136,15 @@ private:
     DataInfo _inputInfo;
     DataInfo _outputInfo;
 
-    const size_t _maxTaskExecutorGetResultCount = 1;
-    std::queue<std::string> _taskExecutorGetResultIds;
-
     ExecutableNetwork(std::vector<DevicePtr> &devicePool,
                       const MyriadConfig& config);
 
-    InferenceEngine::ITaskExecutor::Ptr getNextTaskExecutor() {
-        std::string id = _taskExecutorGetResultIds.front();
-
-        _taskExecutorGetResultIds.pop();
-        _taskExecutorGetResultIds.push(id);
-
-        InferenceEngine::ExecutorManager *executorManager = InferenceEngine::ExecutorManager::getInstance();
-        InferenceEngine::ITaskExecutor::Ptr taskExecutor = executorManager->getExecutor(id);
+    void allocateGraphs(const std::pair<const char*, size_t> &graphHeaderDesc,
+                        size_t numStages,
+                        const char* networkName);
 
-        return taskExecutor;
+    ncGraphHandle_t* graphHandle() const {
+        return _router != nullptr ? _router->graphs().front()->_graphDesc._graphHandle : nullptr;
     }
 
     InferenceEngine::ICNNNetwork::Ptr buildRuntimeGraph(GraphMetaInfo& graphMetaInfo);
@@ -8,6 +8,7 @@
 #include <mutex>
 #include <map>
 #include <algorithm>
+#include <iterator>
 #include <utility>
 #include <chrono>
 #include <memory>
@@ -36,7 +37,8 @@ using namespace vpu;
 
 static std::mutex device_mutex;
 
-MyriadExecutor::MyriadExecutor(bool forceReset, const LogLevel& vpuLogLevel, const Logger::Ptr& log) : _log(log) {
+MyriadExecutor::MyriadExecutor(bool forceReset, bool attachBootedDevices, int usbChunkSize,
+                               const LogLevel& vpuLogLevel, const Logger::Ptr& log) : _log(log) {
     VPU_PROFILE(MyriadExecutor);
     _mvnc = std::make_shared<Mvnc>();
     int ncResetAll = forceReset;
@@ -47,6 +49,23 @@ MyriadExecutor::MyriadExecutor(bool forceReset, const LogLevel& vpuLogLevel, con
             ncResetAll, ncStatusToStr(nullptr, status));
     }
 
+    int ncAttachBooted = attachBootedDevices;
+    status = ncGlobalSetOption(NC_RW_ATTACH_BOOTED_DEVICES, &ncAttachBooted, sizeof(ncAttachBooted));
+    if (status != NC_OK) {
+        _log->warning(
+            "Failed to set NC_RW_ATTACH_BOOTED_DEVICES flag to %d: %s\n",
+            ncAttachBooted, ncStatusToStr(nullptr, status));
+    }
+
+    if (usbChunkSize != MyriadConfig::UNDEFINED_USB_CHUNK_SIZE) {
+        status = ncGlobalSetOption(NC_RW_USB_CHUNK_SIZE, &usbChunkSize, sizeof(usbChunkSize));
+        if (status != NC_OK) {
+            _log->warning(
+                "Failed to set NC_RW_USB_CHUNK_SIZE to %d: %s\n",
+                usbChunkSize, ncStatusToStr(nullptr, status));
+        }
+    }
+
     int ncLogLevel = NC_LOG_FATAL;
     switch (vpuLogLevel) {
     case LogLevel::Warning:
@@ -299,7 +318,7 @@ void MyriadExecutor::closeDevices(std::vector<DevicePtr> &devicePool) {
 void MyriadExecutor::allocateGraph(DevicePtr &device, GraphDesc &graphDesc,
                                    const std::vector<char> &graphFileContent,
                                    const std::pair<const char*, size_t> &graphHeaderDesc,
-                                   size_t numStages, const char* networkName, int executors) {
+                                   size_t numStages, const char* networkName, int executors, int fifoDepth) {
     VPU_PROFILE(allocateGraph);
     _numStages = numStages;
     graphDesc._name = networkName;
@@ -362,7 +381,7 @@ void MyriadExecutor::allocateGraph(DevicePtr &device, GraphDesc &graphDesc,
         THROW_IE_EXCEPTION << "Failed to get output description: " << ncStatusToStr(graphDesc._graphHandle, status);
     }
 
-    unsigned int fifo_elements = (device->_platform == NC_MYRIAD_2 && executors == 1) ? 4 : 2 * executors;
+    const auto fifo_elements = static_cast<unsigned int>(fifoDepth);
 
     status = ncFifoCreate("input", NC_FIFO_HOST_WO, &graphDesc._inputFifoHandle);
     if (status != NC_OK) {
@@ -385,33 +404,27 @@ void MyriadExecutor::allocateGraph(DevicePtr &device, GraphDesc &graphDesc,
     }
 }
 
-void MyriadExecutor::queueInference(GraphDesc &graphDesc, void *input_data, size_t input_bytes,
-                    void *result_data, size_t result_bytes) {
-    VPU_PROFILE(queueInference);
+void MyriadExecutor::queueInferences(GraphDesc &graphDesc, const std::vector<const void*> &inputs) {
+    VPU_PROFILE(queueInferences);
 #ifndef NDEBUG
     if (auto dumpFileName = std::getenv("IE_VPU_DUMP_INPUT_FILE_NAME")) {
         std::ofstream file(dumpFileName, std::ios_base::binary | std::ios_base::out);
         if (!file.is_open()) {
             THROW_IE_EXCEPTION << "[VPU] Cannot open file " << dumpFileName << " for writing";
         }
-        file.write(static_cast<const char*>(input_data), input_bytes);
+        file.write(static_cast<const char*>(inputs.back()), graphDesc._inputDesc.totalSize);
     }
 #endif
 
-    if (graphDesc._inputDesc.totalSize != input_bytes) {
-        THROW_IE_EXCEPTION << "Input has unexpected size " << input_bytes << ", expected "
-                           << graphDesc._inputDesc.totalSize;
-    }
-
-    ncStatus_t status = ncGraphQueueInferenceWithFifoElem(graphDesc._graphHandle,
+    std::vector<const void*> inputTensors(inputs);
+    unsigned int inputBytes = graphDesc._inputDesc.totalSize;
+    ncStatus_t status = ncGraphQueueInferencesWithFifoElems(graphDesc._graphHandle,
                                 graphDesc._inputFifoHandle, graphDesc._outputFifoHandle,
-                                input_data, &graphDesc._inputDesc.totalSize, nullptr);
+                                inputTensors.data(), &inputBytes, nullptr,
+                                static_cast<unsigned int>(inputTensors.size()));
     if (status != NC_OK) {
-        THROW_IE_EXCEPTION << "Failed to queue inference: " << ncStatusToStr(graphDesc._graphHandle, status);
-    }
-
-    if (result_data != nullptr && result_bytes != 0) {
-        getResult(graphDesc, result_data, result_bytes);
+        THROW_IE_EXCEPTION << "Failed to queue " << inputs.size() << " inferences: "
+                           << ncStatusToStr(graphDesc._graphHandle, status);
     }
 }
 
@@ -506,6 +519,107 @@ float MyriadExecutor::GetThermal(const DevicePtr& device) {
     }
 }
 
+int MyriadExecutor::GetThrottlingLevel(const DevicePtr& device) {
+    int throttlingLevel = 0;
+    unsigned int dataLength = sizeof(throttlingLevel);
+    ncStatus_t status = ncDeviceGetOption(device->_deviceHandle,
+                                          NC_RO_DEVICE_THERMAL_THROTTLING_LEVEL,
+                                          reinterpret_cast<void *>(&throttlingLevel),
+                                          &dataLength);
+
+    return status == NC_OK ? std::max(0, std::min(throttlingLevel, 2)) : 0;
+}
+
+InferenceBatcher::InferenceBatcher(const MyriadExecutorPtr& executor, GraphDesc& graphDesc, int maxBatch,
+                                   const InferenceEngine::ITaskExecutor::Ptr& queueExecutor)
+    : _executor(executor), _graphDesc(graphDesc), _maxBatch(static_cast<size_t>(std::max(maxBatch, 1))),
+      _queueExecutor(queueExecutor) {
+}
+
+std::shared_future<void> InferenceBatcher::queue(const void* input, size_t inputBytes) {
+    if (_graphDesc._inputDesc.totalSize != inputBytes) {
+        THROW_IE_EXCEPTION << "Input has unexpected size " << inputBytes << ", expected "
+                           << _graphDesc._inputDesc.totalSize;
+    }
+
+    std::shared_future<void> queued;
+    bool startFlush = false;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending.push_back({input, std::promise<void>()});
+        queued = _pending.back()._queued.get_future().share();
+        startFlush = !_flushing;
+        _flushing = true;
+    }
+    if (startFlush) {
+        auto self = shared_from_this();
+        _queueExecutor->run([self] { self->flush(); });
+    }
+    return queued;
+}
+
+void InferenceBatcher::flush() {
+    for (;;) {
+        std::vector<Pending> batch;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_pending.empty()) {
+                _flushing = false;
+                return;
+            }
+            // the batch is written to the input FIFO at once, so it is not longer than the FIFO
+            const auto count = std::min(_pending.size(), _maxBatch);
+            std::move(_pending.begin(), _pending.begin() + count, std::back_inserter(batch));
+            _pending.erase(_pending.begin(), _pending.begin() + count);
+        }
+
+        std::vector<const void*> inputs;
+        for (const auto& pending : batch) {
+            inputs.push_back(pending._input);
+        }
+        try {
+            _executor->queueInferences(_graphDesc, inputs);
+            for (auto& pending : batch) {
+                pending._queued.set_value();
+            }
+        } catch (...) {
+            for (auto& pending : batch) {
+                pending._queued.set_exception(std::current_exception());
+            }
+        }
+    }
+}
+
+DeviceGraph::Ptr GraphRouter::acquire() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    IE_ASSERT(!_graphs.empty());
+
+    if (_graphs.size() > 1) {
+        // the devices heat up and cool down slowly, so the level is refreshed once a second
+        const auto now = std::chrono::steady_clock::now();
+        for (auto& graph : _graphs) {
+            if (now - graph->_throttlingChecked >= std::chrono::seconds(1)) {
+                graph->_throttlingLevel = MyriadExecutor::GetThrottlingLevel(graph->_device);
+                graph->_throttlingChecked = now;
+            }
+        }
+    }
+
+    const auto load = [](const DeviceGraph::Ptr& graph) {
+        return (graph->_inferRequests + 1) << graph->_throttlingLevel;
+    };
+    auto graph = *std::min_element(_graphs.begin(), _graphs.end(),
+        [&load](const DeviceGraph::Ptr& lhs, const DeviceGraph::Ptr& rhs) { return load(lhs) < load(rhs); });
+
+    graph->_inferRequests++;
+    return graph;
+}
+
+void GraphRouter::release(const DeviceGraph::Ptr& graph) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    graph->_inferRequests--;
+}
+
 std::vector<float> MyriadExecutor::getPerfTimeInfo(ncGraphHandle_t *graphHandle) {
     return getGraphInfo<float>(graphHandle, NC_RO_GRAPH_TIME_TAKEN, _numStages + 2);
 }
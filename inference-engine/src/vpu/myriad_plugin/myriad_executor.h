@@ -10,11 +10,16 @@
 #include <map>
 #include <iomanip>
 #include <utility>
+#include <chrono>
+#include <deque>
+#include <future>
+#include <mutex>
 
 #include <mvnc.h>
 #include "myriad_mvnc_wraper.h"
 
 #include <ie_parameter.hpp>
+#include <cpp_interfaces/ie_itask_executor.hpp>
 
 #include <myriad_config.h>
 
@@ -73,7 +78,8 @@ class MyriadExecutor {
     unsigned int _numStages = 0;
 
 public:
-    MyriadExecutor(bool forceReset, const LogLevel& vpuLogLevel, const Logger::Ptr& log);
+    MyriadExecutor(bool forceReset, bool attachBootedDevices, int usbChunkSize,
+                   const LogLevel& vpuLogLevel, const Logger::Ptr& log);
     ~MyriadExecutor() = default;
 
     /**
@@ -90,12 +96,16 @@ public:
                        const std::pair<const char*, size_t> &graphHeaderDesc,
                        size_t numStages,
                        const char* networkName,
-                       int executors);
+                       int executors,
+                       int fifoDepth);
 
     void deallocateGraph(DevicePtr &device, GraphDesc &graphDesc);
 
-    void queueInference(GraphDesc &graphDesc, void *input_data, size_t input_bytes,
-                        void *result_data, size_t result_bytes);
+    /**
+     * @brief Writes the inputs of the graph input size to its input FIFO and queues their inferences in one batch,
+     * which waits for the responses of the device once
+     */
+    void queueInferences(GraphDesc &graphDesc, const std::vector<const void*> &inputs);
 
     void getResult(GraphDesc &graphDesc, void *result_data, unsigned int result_bytes);
 
@@ -107,6 +117,12 @@ public:
 
     static float GetThermal(const DevicePtr& device);
 
+    /**
+     * @brief Get the thermal throttling level of the device: 0 - not throttled, 1 - lower temperature limit reached,
+     * 2 - higher temperature limit reached; 0 if the level cannot be read
+     */
+    static int GetThrottlingLevel(const DevicePtr& device);
+
     template<typename T>
     static std::vector<T> getGraphInfo(
             ncGraphHandle_t* graphHandle,
@@ -134,5 +150,87 @@ private:
 
 typedef std::shared_ptr<MyriadExecutor> MyriadExecutorPtr;
 
+/**
+ * @brief Queues the inferences of a graph on its queue executor, the inferences queued while the previous batch
+ * is sent to the device are sent together in the next one
+ */
+class InferenceBatcher : public std::enable_shared_from_this<InferenceBatcher> {
+public:
+    typedef std::shared_ptr<InferenceBatcher> Ptr;
+
+    InferenceBatcher(const MyriadExecutorPtr& executor, GraphDesc& graphDesc, int maxBatch,
+                     const InferenceEngine::ITaskExecutor::Ptr& queueExecutor);
+
+    /**
+     * @brief Queues the inference of the input, which is read until the returned future is ready.
+     * The future rethrows the error if the inference cannot be queued
+     */
+    std::shared_future<void> queue(const void* input, size_t inputBytes);
+
+private:
+    struct Pending {
+        const void* _input;
+        std::promise<void> _queued;
+    };
+
+    void flush();
+
+    MyriadExecutorPtr _executor;
+    GraphDesc& _graphDesc;
+    size_t _maxBatch;
+    InferenceEngine::ITaskExecutor::Ptr _queueExecutor;
+
+    std::mutex _mutex;
+    std::deque<Pending> _pending;
+    bool _flushing = false;
+};
+
+/**
+ * @brief The graph of a network allocated on one of its devices
+ */
+struct DeviceGraph {
+    typedef std::shared_ptr<DeviceGraph> Ptr;
+
+    DevicePtr _device;
+    GraphDesc _graphDesc;
+    int _fifoDepth = 0;
+    InferenceBatcher::Ptr _batcher;
+    // results of the graph are read in the order the inferences are queued on
+    InferenceEngine::ITaskExecutor::Ptr _getResultExecutor;
+
+    int _inferRequests = 0;
+    int _throttlingLevel = 0;
+    std::chrono::steady_clock::time_point _throttlingChecked;
+};
+
+/**
+ * @brief Routes the inferences of a network loaded to several devices to the least loaded device,
+ * a throttled device gets twice less inferences per throttling level
+ */
+class GraphRouter {
+public:
+    typedef std::shared_ptr<GraphRouter> Ptr;
+
+    explicit GraphRouter(std::vector<DeviceGraph::Ptr> graphs) : _graphs(std::move(graphs)) {}
+
+    /**
+     * @brief Selects the graph for the next inference and counts the inference as queued on it
+     */
+    DeviceGraph::Ptr acquire();
+
+    /**
+     * @brief Counts the inference on the graph as done, once its result is read
+     */
+    void release(const DeviceGraph::Ptr& graph);
+
+    const std::vector<DeviceGraph::Ptr>& graphs() const {
+        return _graphs;
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<DeviceGraph::Ptr> _graphs;
+};
+
 }  // namespace MyriadPlugin
 }  // namespace vpu
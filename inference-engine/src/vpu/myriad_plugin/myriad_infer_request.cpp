@@ -25,7 +25,7 @@ using namespace InferenceEngine;
 
 #define MEMCPY(dst, src, bytes) std::copy_n((src), (bytes), (dst))
 
-MyriadInferRequest::MyriadInferRequest(GraphDesc &graphDesc,
+MyriadInferRequest::MyriadInferRequest(const GraphRouter::Ptr &router,
                                        InferenceEngine::InputsDataMap networkInputs,
                                        InferenceEngine::OutputsDataMap networkOutputs,
                                        DataInfo& compilerInputsInfo,
@@ -37,7 +37,7 @@ MyriadInferRequest::MyriadInferRequest(GraphDesc &graphDesc,
         InferRequestInternal(networkInputs, networkOutputs), _executor(executor),
         _log(log), _stagesMetaData(blobMetaData), _config(myriadConfig),
         _inputInfo(compilerInputsInfo), _outputInfo(compilerOutputsInfo),
-        _graphDesc(graphDesc) {
+        _router(router) {
     VPU_PROFILE(MyriadInferRequest);
 
     const auto& ioStrides = _config.compileConfig().ioStrides;
@@ -115,6 +115,29 @@ void MyriadInferRequest::InferAsync() {
         return foundBlob;
     };
 
+    auto queueInference = [this] (void* inputData) {
+        _graph = _router->acquire();
+        try {
+            _queued = _graph->_batcher->queue(inputData, _inputInfo.totalSize);
+        } catch (...) {
+            _router->release(_graph);
+            throw;
+        }
+    };
+
+    // the only input which already is in the VPU layout is sent straight from the user memory,
+    // GetResult waits for the FIFO element to be written, so the blob is not used once the inference is done
+    if (_inputs.size() == 1) {
+        const auto& name = _inputs.begin()->first;
+        const auto& blob = _inputs.begin()->second;
+
+        if (getOffset(name) == 0 && blob->byteSize() == _inputInfo.totalSize &&
+            blob->getTensorDesc().getLayout() == getNetInputInfo(name)->second->getTensorDesc().getLayout()) {
+            queueInference(blob->buffer().as<uint8_t*>());
+            return;
+        }
+    }
+
     for (const auto& input : _inputs) {
         const auto& name = input.first;
         const auto& blob = input.second;
@@ -138,13 +161,26 @@ void MyriadInferRequest::InferAsync() {
         }
     }
 
-    _executor->queueInference(_graphDesc, inputBuffer.data(),
-                              _inputInfo.totalSize, nullptr, 0);
+    queueInference(inputBuffer.data());
 }
 
 void MyriadInferRequest::GetResult() {
     VPU_PROFILE(GetResult);
 
+    IE_ASSERT(_graph != nullptr) << "MyriadInferRequest::GetResult()\n"
+                                 << "No inference is queued.";
+    struct GraphRelease {
+        ~GraphRelease() {
+            router.release(graph);
+        }
+        GraphRouter& router;
+        DeviceGraph::Ptr graph;
+    } release {*_router, _graph};
+    auto& graphDesc = _graph->_graphDesc;
+
+    // the inference may be sent to the device in a batch with the ones queued after it, the error is rethrown here
+    _queued.get();
+
     auto networkOutputs = _networkOutputs;
     const auto getVpuLayout = [&networkOutputs] (const std::string& name){
         const auto foundBlob = networkOutputs.find(name);
@@ -159,12 +195,12 @@ void MyriadInferRequest::GetResult() {
         const auto& blob = (*it).second;
 
         if (blob->getTensorDesc().getLayout() == getVpuLayout(name)) {
-            _executor->getResult(_graphDesc, blob->buffer(), blob->byteSize());
+            _executor->getResult(graphDesc, blob->buffer(), blob->byteSize());
             return;
         }
     }
 
-    _executor->getResult(_graphDesc, resultBuffer.data(), resultBuffer.size());
+    _executor->getResult(graphDesc, resultBuffer.data(), resultBuffer.size());
 
     for (const auto& output : _outputs) {
         const auto& name = output.first;
@@ -191,8 +227,14 @@ void MyriadInferRequest::GetResult() {
     }
 }
 
+InferenceEngine::ITaskExecutor::Ptr MyriadInferRequest::getResultExecutor() const {
+    return (_graph != nullptr ? _graph : _router->graphs().front())->_getResultExecutor;
+}
+
 void MyriadInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
-    auto perfInfo = _executor->getPerfTimeInfo(_graphDesc._graphHandle);
+    // the counters are of the device the last inference is run on
+    const auto& graph = _graph != nullptr ? _graph : _router->graphs().front();
+    auto perfInfo = _executor->getPerfTimeInfo(graph->_graphDesc._graphHandle);
 
     if (_log->isActive(LogLevel::Info)) {
         if (!perfInfo.empty()) {
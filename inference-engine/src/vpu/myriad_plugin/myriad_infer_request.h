@@ -31,14 +31,16 @@ class MyriadInferRequest : public InferenceEngine::InferRequestInternal {
     const DataInfo _inputInfo;
     const DataInfo _outputInfo;
 
-    GraphDesc _graphDesc;
+    GraphRouter::Ptr _router;
+    DeviceGraph::Ptr _graph;
+    std::shared_future<void> _queued;
     std::vector<uint8_t> resultBuffer;
     std::vector<uint8_t> inputBuffer;
 
 public:
     typedef std::shared_ptr<MyriadInferRequest> Ptr;
 
-    explicit MyriadInferRequest(GraphDesc &_graphDesc,
+    explicit MyriadInferRequest(const GraphRouter::Ptr &router,
                                 InferenceEngine::InputsDataMap networkInputs,
                                 InferenceEngine::OutputsDataMap networkOutputs,
                                 DataInfo& compilerInputsInfo,
@@ -52,6 +54,11 @@ public:
     void InferAsync();
     void GetResult();
 
+    /**
+     * @brief The executor which reads the results of the device the last inference is queued on
+     */
+    InferenceEngine::ITaskExecutor::Ptr getResultExecutor() const;
+
     void
     GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 };
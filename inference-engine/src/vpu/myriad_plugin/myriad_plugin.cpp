@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 #include <tuple>
 #include <utility>
@@ -12,6 +14,7 @@
 #include <cnn_network_ngraph_impl.hpp>
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
 #include <cpp_interfaces/impl/ie_executable_network_internal.hpp>
+#include <ie_compiled_network_cache.hpp>
 
 #include <vpu/vpu_plugin_config.hpp>
 #include <vpu/parsed_config.hpp>
@@ -34,7 +37,20 @@ ExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(
     auto parsedConfigCopy = _parsedConfig;
     parsedConfigCopy.update(config);
 
-    return std::make_shared<ExecutableNetwork>(network, _devicePool, parsedConfigCopy);
+    // the layers are not named in the blob, so it is always compiled to report per-layer performance counters
+    std::string blobCacheKey;
+    if (!parsedConfigCopy.blobCacheDir().empty() && !parsedConfigCopy.perfCount()) {
+        auto fullConfig = _config;
+        for (const auto& entry : config) {
+            fullConfig[entry.first] = entry.second;
+        }
+        fullConfig.erase(VPU_MYRIAD_CONFIG_KEY(BLOB_CACHE_DIR));
+
+        blobCacheKey = ie::details::CompiledNetworkCache::computeHash(
+            network, _pluginName, fullConfig, *GetInferenceEngineVersion());
+    }
+
+    return std::make_shared<ExecutableNetwork>(network, _devicePool, parsedConfigCopy, blobCacheKey);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
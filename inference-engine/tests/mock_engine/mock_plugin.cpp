@@ -34,7 +34,7 @@ void MockPlugin::SetLogCallback(InferenceEngine::IErrorListener &listener) noexc
 }
 
 void MockPlugin::GetVersion(const Version *&versionInfo) noexcept {
-
+    IF_NOT_NULL(GetVersion(versionInfo));
 }
 
 StatusCode MockPlugin::AddExtension(IExtensionPtr extension, InferenceEngine::ResponseDesc *resp) noexcept {
@@ -49,7 +49,7 @@ StatusCode MockPlugin::SetConfig(const std::map<std::string, std::string> &_conf
 StatusCode
 MockPlugin::ImportNetwork(IExecutableNetwork::Ptr &ret, const std::string &modelFileName,
                           const std::map<std::string, std::string> &config, ResponseDesc *resp) noexcept {
-    return NOT_IMPLEMENTED;
+    return ACTION_IF_NOT_NULL(ImportNetwork(ret, modelFileName, config, resp));
 }
 
 InferenceEngine::IInferencePlugin *__target = nullptr;
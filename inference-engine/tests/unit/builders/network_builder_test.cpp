@@ -1003,6 +1003,42 @@ TEST_F(NetworkBuilderTest, CreateFullyConnectedWithoutBiases) {
     ASSERT_NO_THROW(std::shared_ptr<InferenceEngine::ICNNNetwork> cnnNetwork = InferenceEngine::Builder::convertToICNNNetwork(builder.build()));
 }
 
+TEST_F(NetworkBuilderTest, AddLayersGeneratesUniqueIdsAndNames) {
+    Builder::Network builder("network");
+    idx_t inputId = builder.addLayer(Builder::InputLayer("input").setPort(Port({1, 16})));
+
+    std::vector<Builder::Layer> layers = {Builder::ReLULayer("relu"), Builder::ReLULayer("relu"),
+                                          Builder::OutputLayer("")};
+    auto ids = builder.addLayers(std::move(layers));
+    ASSERT_EQ(3, ids.size());
+    ASSERT_NE(inputId, ids[0]);
+    ASSERT_NE(ids[0], ids[1]);
+    ASSERT_NE(ids[1], ids[2]);
+    ASSERT_EQ("relu", builder.getLayer(ids[0])->getName());
+    ASSERT_NE(builder.getLayer(ids[0])->getName(), builder.getLayer(ids[1])->getName());
+    ASSERT_EQ("id" + std::to_string(ids[2]), builder.getLayer(ids[2])->getName());
+
+    builder.connect({inputId}, {ids[0]});
+    builder.connect({ids[0]}, {ids[1]});
+    builder.connect({ids[1]}, {ids[2]});
+    ASSERT_NO_THROW(InferenceEngine::Builder::convertToICNNNetwork(builder.build()));
+}
+
+TEST_F(NetworkBuilderTest, ConvertedNetworkSharesWeightsOfBuilder) {
+    Builder::Network builder("network");
+    auto weights = generateBlob(Precision::FP32, {16, 16}, Layout::NC);
+
+    idx_t layerId = builder.addLayer(Builder::InputLayer("input").setPort(Port({1, 16})));
+    idx_t weightsId = builder.addLayer(Builder::ConstLayer("weights").setData(weights));
+    layerId = builder.addLayer({{layerId}, {weightsId}}, Builder::FullyConnectedLayer("fc").setOutputNum(16));
+    builder.addLayer({layerId}, Builder::OutputLayer("output"));
+
+    auto cnnNetwork = InferenceEngine::CNNNetwork(InferenceEngine::Builder::convertToICNNNetwork(builder.build()));
+    auto fc = std::dynamic_pointer_cast<FullyConnectedLayer>(cnnNetwork.getLayerByName("fc"));
+    ASSERT_NE(nullptr, fc);
+    ASSERT_EQ(weights.get(), fc->_weights.get());
+}
+
 TEST_F(NetworkBuilderTest, CreateAndConvertNetworkWithoutWeightsWithConst) {
     Builder::Network builder("network");
 
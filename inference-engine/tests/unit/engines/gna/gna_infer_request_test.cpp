@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpp/ie_cnn_net_reader.h>
+#include <gna/gna_config.hpp>
+#include "gna_infer_request.hpp"
+#include "gna_plugin.hpp"
+#include "test_irs.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace GNAPluginNS;
+
+class GNAInferRequestTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        // a single request slot, so the second request queued without waiting for the first one is busy
+        plugin = std::make_shared<GNAPlugin>(std::map<std::string, std::string>{
+            {GNA_CONFIG_KEY(DEVICE_MODE), GNA_CONFIG_VALUE(SW_FP32)},
+            {GNA_CONFIG_KEY(LIB_N_THREADS), "1"}});
+
+        const auto model = GNATestIRs::TanhActivationModel();
+        CNNNetReader reader;
+        reader.ReadNetwork(model.data(), model.length());
+        network = reader.getNetwork();
+        plugin->LoadNetwork(network);
+    }
+
+    std::unique_ptr<GNAInferRequest> createRequest() {
+        return std::unique_ptr<GNAInferRequest>(
+            new GNAInferRequest(plugin, network.getInputsInfo(), network.getOutputsInfo()));
+    }
+
+    static void fill(GNAInferRequest &request, float value) {
+        Blob::Ptr input;
+        request.GetBlob("input_1", input);
+        auto data = input->buffer().as<float *>();
+        for (size_t i = 0; i < input->size(); i++) {
+            data[i] = value * (i + 1);
+        }
+    }
+
+    static std::vector<float> output(GNAInferRequest &request) {
+        Blob::Ptr out;
+        request.GetBlob("Tanh_Activation", out);
+        auto data = out->cbuffer().as<const float *>();
+        return std::vector<float>(data, data + out->size());
+    }
+
+    std::shared_ptr<GNAPlugin> plugin;
+    CNNNetwork network;
+};
+
+TEST_F(GNAInferRequestTest, startAsyncReadsInputsBeforeReturning) {
+    auto reference = createRequest();
+    fill(*reference, 0.1f);
+    reference->Infer();
+    const auto expected = output(*reference);
+    reference.reset();
+
+    auto request = createRequest();
+    fill(*request, 0.1f);
+    request->StartAsync();
+    // the import may not have started yet, but it reads the inputs passed to StartAsync
+    fill(*request, -0.3f);
+    ASSERT_EQ(OK, request->Wait(IInferRequest::WaitMode::RESULT_READY));
+
+    EXPECT_EQ(expected, output(*request));
+}
+
+TEST_F(GNAInferRequestTest, waitRethrowsErrorOfQueuedRequest) {
+    auto first = createRequest();
+    auto second = createRequest();
+    fill(*first, 0.1f);
+    fill(*second, 0.2f);
+
+    first->StartAsync();
+    // the only request slot is kept by the first request until it is waited for
+    second->StartAsync();
+
+    ASSERT_THROW(second->Wait(IInferRequest::WaitMode::RESULT_READY), InferenceEngineException);
+    ASSERT_EQ(OK, first->Wait(IInferRequest::WaitMode::RESULT_READY));
+
+    // the slot is free again, so the second request is queued once restarted
+    second->StartAsync();
+    ASSERT_EQ(OK, second->Wait(IInferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(GNAInferRequestTest, destructorJoinsQueuedImport) {
+    auto request = createRequest();
+    fill(*request, 0.1f);
+    request->StartAsync();
+    ASSERT_NO_THROW(request.reset());
+
+    // the destroyed request has not been waited for, so it still keeps the only slot
+    auto next = createRequest();
+    fill(*next, 0.1f);
+    next->StartAsync();
+    ASSERT_THROW(next->Wait(IInferRequest::WaitMode::RESULT_READY), InferenceEngineException);
+}
+
+TEST_F(GNAInferRequestTest, failedImportReleasesReservedRequest) {
+    auto request = createRequest();
+    BlobMap outputs = {{"Tanh_Activation", plugin->GetOutputBlob("Tanh_Activation", Precision::FP32)}};
+
+    // the slot is reserved before the inputs are imported, the unknown input fails the import
+    BlobMap unknownInputs = {{"unknown", plugin->GetInputBlob("input_1", Precision::FP32)}};
+    ASSERT_THROW(plugin->QueueInference(unknownInputs, outputs), InferenceEngineException);
+
+    // so the reservation is dropped and the only slot can be taken
+    BlobMap inputs = {{"input_1", plugin->GetInputBlob("input_1", Precision::FP32)}};
+    uint32_t idx = 0;
+    ASSERT_NO_THROW(idx = plugin->QueueInference(inputs, outputs));
+    ASSERT_NO_THROW(plugin->Wait(idx));
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "cldnn_stream_graphs.h"
+
+using namespace ::testing;
+using namespace CLDNNPlugin;
+
+namespace {
+
+struct StubGraph {
+    explicit StubGraph(int id) : id(id) {}
+    int id;
+};
+
+std::vector<std::shared_ptr<StubGraph>> makeGraphs(size_t count, int firstId) {
+    std::vector<std::shared_ptr<StubGraph>> graphs;
+    for (size_t i = 0; i < count; i++)
+        graphs.push_back(std::make_shared<StubGraph>(firstId + static_cast<int>(i)));
+    return graphs;
+}
+
+}  // namespace
+
+TEST(CLDNNStreamGraphsTests, replacesGraphsOfAllStreams) {
+    CLDNNStreamGraphs<StubGraph> graphs(makeGraphs(2, 0));
+
+    ASSERT_TRUE(graphs.Replace(makeGraphs(2, 10)));
+    EXPECT_EQ(10, graphs.Get(0)->id);
+    EXPECT_EQ(11, graphs.Get(1)->id);
+}
+
+TEST(CLDNNStreamGraphsTests, keepsGraphsIfReplacementHasOtherStreamsCount) {
+    CLDNNStreamGraphs<StubGraph> graphs(makeGraphs(2, 0));
+
+    // e.g. the memory budget let only one stream be built for the tuned kernels
+    ASSERT_FALSE(graphs.Replace(makeGraphs(1, 10)));
+    ASSERT_EQ(2, graphs.Size());
+    EXPECT_EQ(0, graphs.Get(0)->id);
+    EXPECT_EQ(1, graphs.Get(1)->id);
+}
+
+TEST(CLDNNStreamGraphsTests, snapshotKeepsReplacedGraphs) {
+    CLDNNStreamGraphs<StubGraph> graphs(makeGraphs(2, 0));
+    const auto snapshot = graphs.Snapshot();
+    std::weak_ptr<StubGraph> replaced = snapshot.front();
+
+    ASSERT_TRUE(graphs.Replace(makeGraphs(2, 10)));
+    ASSERT_FALSE(replaced.expired());
+    EXPECT_EQ(0, snapshot[0]->id);
+    EXPECT_EQ(1, snapshot[1]->id);
+}
+
+TEST(CLDNNStreamGraphsTests, streamsGetTheirGraphsWhileReplaced) {
+    const size_t streams = 4;
+    CLDNNStreamGraphs<StubGraph> graphs(makeGraphs(streams, 0));
+
+    std::atomic<bool> stop{false};
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> readers;
+    for (size_t stream = 0; stream < streams; stream++) {
+        readers.emplace_back([&, stream] {
+            while (!stop) {
+                try {
+                    auto graph = graphs.Get(static_cast<uint16_t>(stream));
+                    if (!graph || graph->id % 100 != static_cast<int>(stream))
+                        failed = true;
+                } catch (...) {
+                    failed = true;
+                }
+            }
+        });
+    }
+
+    for (int generation = 1; generation <= 100; generation++)
+        graphs.Replace(makeGraphs(streams, generation * 100));
+    stop = true;
+    for (auto&& reader : readers) reader.join();
+
+    ASSERT_FALSE(failed);
+    EXPECT_EQ(10000, graphs.Get(0)->id);
+}
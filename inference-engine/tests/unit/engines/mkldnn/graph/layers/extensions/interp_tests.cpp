@@ -253,4 +253,5 @@ INSTANTIATE_TEST_CASE_P(
         ::testing::Values(
                 interp_test_params{{1, 256, 1, 1}, {33, 65}, 0, 0, 1, MKLDNNPlugin::impl_desc_type::unknown },
                 interp_test_params{{6, 128, 320, 320}, {23, 38}, 0, 0, 1, MKLDNNPlugin::impl_desc_type::unknown },
-                interp_test_params{{1, 2, 33, 65}, {33, 65}, 0, 0, 1, MKLDNNPlugin::impl_desc_type::unknown }));
+                interp_test_params{{1, 2, 33, 65}, {33, 65}, 0, 0, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{2, 20, 13, 17}, {40, 50}, 0, 0, 1, MKLDNNPlugin::impl_desc_type::unknown }));
@@ -319,3 +319,133 @@ INSTANTIATE_TEST_CASE_P(
                 math_test_params{ "Softsign",{ 3 },{ -1, 0, 1 },{},{},{},{ -0.5f, 0.f, 0.5f } },
                 math_test_params{ "Tan",{ 3 },{ -1, 0, 1 },{},{},{},{ -1.55740774f, 0.0f, 1.55740774f } }
             ));
+
+extern InferenceEngine::IExtensionPtr make_FakeExtensions();
+
+class MKLDNNCPUExtMathBlockedTests: public TestsCommon, public WithParamInterface<std::string> {
+    std::string model_t = R"V0G0N(
+<net Name="Math_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="Input" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>32</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="fakeLayer" id="2" type="FakeLayerBLK" precision="FP32">
+            <input>
+                <port id="2">
+                    <dim>2</dim>
+                    <dim>32</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>2</dim>
+                    <dim>32</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="math" id="3" type="_MATH_FUNCTION_" precision="FP32">
+            <input>
+                <port id="4">
+                    <dim>2</dim>
+                    <dim>32</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </input>
+            <output>
+                <port id="5">
+                    <dim>2</dim>
+                    <dim>32</dim>
+                    <dim>5</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="2"/>
+        <edge from-layer="2" from-port="3" to-layer="3" to-port="4"/>
+    </edges>
+</net>
+)V0G0N";
+
+protected:
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            std::string math_function = ::testing::WithParamInterface<std::string>::GetParam();
+            std::string model = model_t;
+            REPLACE_WITH_STR(model, "_MATH_FUNCTION_", math_function);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            auto defaultExtensions = std::make_shared<InferenceEngine::Extensions::Cpu::MKLDNNExtensions<mkldnn::impl::cpu::cpu_isa_t::isa_any>>();
+            extMgr->AddExtension(defaultExtensions);
+            extMgr->AddExtension(make_FakeExtensions());
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            // the blocked layout of the fake layer is kept, the only reorders are the ones of the input and output
+            for (auto &node : graph.getNodes()) {
+                if (node->getName() == "math") {
+                    ASSERT_EQ(2, node->getSupportedPrimitiveDescriptors().size());
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(InferenceEngine::Layout::BLOCKED,
+                              node->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getLayout());
+                }
+            }
+            ASSERT_EQ(6, graph.getNodes().size());
+
+            InferenceEngine::SizeVector dims = {2, 32, 5, 7};
+            InferenceEngine::Blob::Ptr srcData = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32, dims, InferenceEngine::NCHW });
+            srcData->allocate();
+            fill_data_sine(srcData->buffer(), srcData->size(), 0.f, 0.9f, 1.f);
+            auto * srcDataPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(srcData.get());
+            if (srcDataPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_math(math_function, *srcDataPtr, {}, {}, {}, dst_ref);
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("Input", srcData));
+
+            graph.Infer(srcs, outputBlobs);
+            compare(*output, dst_ref, 0.00001f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtMathBlockedTests, TestsMathBlocked) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsMathBlocked, MKLDNNCPUExtMathBlockedTests,
+            ::testing::Values("Abs", "Cos", "Softplus", "Tan"));
@@ -526,6 +526,25 @@ static std::vector<float> boxes = { 0.0, 0.0, 1.0, 1.0, 0.0, 0.1, 1.0, 1.1, 0.0,
 static std::vector<float> scores = { 0.9f, 0.75f, 0.6f, 0.95f, 0.5f, 0.3f };
 static std::vector<int> reference = { 0,0,3,0,0,0,0,0,5 };
 
+// 8x8 grid of overlapping unit boxes with distinct scores, big enough for several SIMD blocks of selected boxes
+static std::vector<float> gridBoxes() {
+    std::vector<float> result;
+    for (int i = 0; i < 64; i++) {
+        float y = (i % 8) * 0.6f, x = (i / 8) * 0.6f;
+        result.insert(result.end(), { y, x, y + 1.0f, x + 1.0f });
+    }
+    return result;
+}
+
+static std::vector<float> gridScores(int num_classes) {
+    std::vector<float> result;
+    for (int c = 0; c < num_classes; c++) {
+        for (int i = 0; i < 64; i++)
+            result.push_back(((i * 37 + c * 11) % 64) / 64.f + c / 256.f);
+    }
+    return result;
+}
+
 INSTANTIATE_TEST_CASE_P(
         TestsNonMaxSuppression, MKLDNNCPUExtNonMaxSuppressionTFTests,
         ::testing::Values(
@@ -567,5 +586,9 @@ INSTANTIATE_TEST_CASE_P(
 
             nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, { 3 }, {}, {}, 3, { 0,0,3,0,0,0,0,0,1 } }, /*nonmaxsuppression_no_iou_threshold_and_score_threshold*/
 
-            nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, {}, {}, {}, 3, {} } /*nonmaxsuppression_no_max_output_boxes_per_class_and_iou_threshold_and_score_threshold*/
+            nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, {}, {}, {}, 3, {} }, /*nonmaxsuppression_no_max_output_boxes_per_class_and_iou_threshold_and_score_threshold*/
+
+            nmsTF_test_params{ 0, 1, { 1,3,64 }, gridBoxes(), gridScores(3), { 64 }, { 0.5f }, { 0.1f }, 192, {} }, /*nonmaxsuppression_grid_no_suppression*/
+
+            nmsTF_test_params{ 0, 1, { 1,3,64 }, gridBoxes(), gridScores(3), { 40 }, { 0.2f }, { 0.0f }, 192, {} } /*nonmaxsuppression_grid_suppress_by_IOU*/
 ));
@@ -534,5 +534,11 @@ INSTANTIATE_TEST_CASE_P(
                 reduce_test_params{ "ReduceSumSquare", true,{ 10, 10, 2 },"FP32",{},{ 2 },{ 10, 10, 1 },{} },
                 reduce_test_params{ "ReduceSumSquare", true, { 3, 2, 2 },"FP32",{},{ 1 },{ 3, 1, 2 },{ 10, 20, 74, 100, 202, 244 } },
                 reduce_test_params{ "ReduceSumSquare", false, { 3, 2, 2 },"FP32",{},{ 1 },{ 3, 2 },{ 10, 20, 74, 100, 202, 244 } },
-                reduce_test_params{ "ReduceSumSquare", false, { 3, 2, 2 },"FP32",{},{ 0, 1, 2 },{ },{ 650 } }
+                reduce_test_params{ "ReduceSumSquare", false, { 3, 2, 2 },"FP32",{},{ 0, 1, 2 },{ },{ 650 } },
+                // inner and outer axis reductions of the vectorized kernels, with the tails of the vectors
+                reduce_test_params{ "ReduceL1", false,{ 4, 2003 },"FP32",{},{ 1 },{ 4 },{} },
+                reduce_test_params{ "ReduceMax", true,{ 2, 20000 },"FP32",{},{ 1 },{ 2, 1 },{} },
+                reduce_test_params{ "ReduceMean", true,{ 1, 64, 7, 7 },"FP32",{},{ 2, 3 },{ 1, 64, 1, 1 },{} },
+                reduce_test_params{ "ReduceMin", false,{ 2, 300, 1029 },"FP32",{},{ 1 },{ 2, 1029 },{} },
+                reduce_test_params{ "ReduceSum", true,{ 2, 300, 45 },"FP32",{},{ 1 },{ 2, 1, 45 },{} }
 ));
@@ -402,6 +402,13 @@ std::vector<float>          swr_output_value_ref_case2 = { 3.0f, 2.0f, 1.0f,
                                                            34.0f, 38.0f, 42.0f };
 
 
+// case 2 - ExperimentalSparseWeightedMean, I32, the model with weights input
+std::string                 swr_reduce_operation_case3 = "ExperimentalSparseWeightedMean";
+std::vector<float>          swr_output_value_ref_case3 = { 3.0f, 2.0f, 1.0f,
+                                                           4.4f, 5.0f, 5.6f,
+                                                           1.0f, 2.0f, 3.0f,
+                                                           8.5f, 9.5f, 10.5f };
+
 INSTANTIATE_TEST_CASE_P(
     TestsExperimentalSparseWeightedReduce, MKLDNNCPUExtExperimentalSparseWeightedReduceTests,
     ::testing::Values(
@@ -415,5 +422,16 @@ INSTANTIATE_TEST_CASE_P(
             swr_input_weights_shape_case2, swr_input_weights_case2,
             swr_output_shape_case2, swr_output_value_ref_case2,
             1, MKLDNNPlugin::impl_desc_type::unknown
+        },
+        sparse_weighted_reduce_test_params{
+            swr_model1, swr_precision_case2, swr_reduce_operation_case3, swr_with_weights_case2,
+            swr_input_indices_shape_case2, swr_input_indices_case2,
+            swr_input_values_shape_case2, swr_input_values_case2,
+            swr_input_dense_shape_shape_case2, swr_input_dense_shape_case2,
+            swr_input_params_table_shape_case2, swr_input_params_table_case2,
+            swr_input_default_value_case2,
+            swr_input_weights_shape_case2, swr_input_weights_case2,
+            swr_output_shape_case2, swr_output_value_ref_case3,
+            1, MKLDNNPlugin::impl_desc_type::unknown
         }
 ));
@@ -345,7 +345,15 @@ INSTANTIATE_TEST_CASE_P(
                 topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "index", "max",{ 1, 18, 129, 129 },{},{} },
                 topk_test_params{ { 1, 20, 32, 32 },{}, 1,{ 18 }, "index", "min",{ 1, 18, 32, 32 },{},{} },
                 topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "index", "min",{ 1, 18, 129, 129 },{},{} },
-                topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "none", "min",{ 1, 18, 129, 129 },{},{} }
+                topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "none", "min",{ 1, 18, 129, 129 },{},{} },
+                // large axes with small k
+                topk_test_params{ { 8, 32000 },{}, -1,{ 4 }, "value", "max",{ 8, 4 },{},{} },
+                topk_test_params{ { 4, 50257 },{}, -1,{ 10 }, "value", "min",{ 4, 10 },{},{} },
+                topk_test_params{ { 4, 32000 },{}, -1,{ 1 }, "value", "max",{ 4, 1 },{},{} },
+                topk_test_params{ { 2, 4, 1003 },{}, -1,{ 5 }, "index", "max",{ 2, 4, 5 },{},{} },
+                topk_test_params{ { 1, 40 },{ 1,15,3,25,2,35,0,4,5,11,13,21,12,10,14,22,16,23,31,20,
+                                              30,17,32,39,34,24,36,37,38,6,19,8,7,26,33,27,18,28,9,29 },
+                                  -1,{ 3 }, "value", "max",{ 1, 3 },{ 39,38,37 },{ 23,28,27 } }
             ));
 
 
@@ -11,6 +11,8 @@
 #include "single_layer_common.hpp"
 #include <mkldnn_extension_utils.h>
 #include <cnn_network_impl.hpp>
+#include <ie_util_internal.hpp>
+#include "mkldnn_subpixel_deconv.h"
 #include "ir_gen_helper.hpp"
 #include "tests_common.hpp"
 
@@ -528,3 +530,166 @@ INSTANTIATE_TEST_CASE_P(
                 deconv_test_params{{4, 17, 3, 3}, {4, 3}, {2, 2}, {0, 0}, {0, 0}, 2, 1, false, "", 3, {MKLDNNPlugin::impl_desc_type::gemm, MKLDNNPlugin::impl_desc_type::jit} },
                 deconv_test_params{{2, 8, 5, 5}, {4, 4}, {2, 2}, {1, 1}, {0, 0}, 8, 2, false, "", 3, {MKLDNNPlugin::impl_desc_type::gemm}} ));
 #endif
+
+struct subpixel_deconv_test_params {
+    // Formats: NCHW
+    vector<size_t> dims;
+    // Formats: WH
+    vector<size_t> kernel;
+    vector<size_t> strides;
+    vector<size_t> pads_begin;
+    vector<size_t> pads_end;
+    // the points added to the end of the output
+    vector<size_t> output_padding;
+
+    size_t out_c;
+    size_t grp_c;
+
+    // whether the deconvolution is rewritten and the pixel shuffle ends with the Crop
+    bool converted;
+    bool with_crop;
+};
+
+// Compares the graphs of the network with the deconvolution and with its rewrite into the sub-pixel convolution
+// the plugin does with KEY_CPU_SUBPIXEL_DECONVOLUTION
+class MKLDNNGraphSubPixelDeconvolutionTests: public TestsCommon,
+                                             public WithParamInterface<subpixel_deconv_test_params> {
+    std::string layers_t = R"V0G0N(
+        <layer name="deconv1" id="1" type="Deconvolution" precision="FP32">
+            <deconvolution kernel="_K_" pads_begin="_PB_" pads_end="_PE_" strides="_KS_" output="_OC_" group="_GC_"/>
+
+            <weights offset="0" size="_S1_" />
+            <biases offset="_S1_" size="_S2_" />
+
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_OC_</dim>
+                    <dim>_OH_</dim>
+                    <dim>_OW_</dim>
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string edges_t = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+)V0G0N";
+
+protected:
+    size_t weightsSize(const subpixel_deconv_test_params &p) {
+        return p.out_c * (p.dims[1] / p.grp_c) * p.kernel[X_AXIS] * p.kernel[Y_AXIS];
+    }
+
+    std::string getModel(const subpixel_deconv_test_params &p) {
+        std::string model = layers_t;
+        REPLACE_WITH_NUM(model, "_IN_", p.dims[0]);
+        REPLACE_WITH_NUM(model, "_IC_", p.dims[1]);
+        REPLACE_WITH_NUM(model, "_IH_", p.dims[2]);
+        REPLACE_WITH_NUM(model, "_IW_", p.dims[3]);
+        REPLACE_WITH_NUM(model, "_OH_", p.strides[Y_AXIS] * (p.dims[2] - 1) + p.kernel[Y_AXIS] -
+                                        p.pads_begin[Y_AXIS] - p.pads_end[Y_AXIS] + p.output_padding[Y_AXIS]);
+        REPLACE_WITH_NUM(model, "_OW_", p.strides[X_AXIS] * (p.dims[3] - 1) + p.kernel[X_AXIS] -
+                                        p.pads_begin[X_AXIS] - p.pads_end[X_AXIS] + p.output_padding[X_AXIS]);
+        REPLACE_WITH_NUM_VECTOR_REVERSE(model, "_K_", p.kernel);
+        REPLACE_WITH_NUM_VECTOR_REVERSE(model, "_KS_", p.strides);
+        REPLACE_WITH_NUM_VECTOR_REVERSE(model, "_PB_", p.pads_begin);
+        REPLACE_WITH_NUM_VECTOR_REVERSE(model, "_PE_", p.pads_end);
+        REPLACE_WITH_NUM(model, "_GC_", p.grp_c);
+        REPLACE_WITH_NUM(model, "_OC_", p.out_c);
+        REPLACE_WITH_NUM(model, "_S1_", weightsSize(p) * sizeof(float));
+        REPLACE_WITH_NUM(model, "_S2_", p.out_c * sizeof(float));
+
+        return IRTemplateGenerator::getIRTemplate("SubPixelDeconvolution", p.dims, "FP32", model, edges_t);
+    }
+
+    static InferenceEngine::TBlob<float>::Ptr infer(MKLDNNGraphTestClass &graph, const InferenceEngine::ICNNNetwork &network,
+                                                   const InferenceEngine::Blob::Ptr &src) {
+        InferenceEngine::BlobMap srcs = {{"in1", src}};
+        InferenceEngine::OutputsDataMap out;
+        network.getOutputsInfo(out);
+        auto item = *out.begin();
+
+        auto output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        InferenceEngine::BlobMap outputBlobs = {{item.first, output}};
+        graph.Infer(srcs, outputBlobs);
+        return output;
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            subpixel_deconv_test_params p = ::testing::WithParamInterface<subpixel_deconv_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            const size_t blobsSize = (weightsSize(p) + p.out_c) * sizeof(float);
+            InferenceEngine::TBlob<uint8_t>::Ptr weights = InferenceEngine::make_shared_blob<uint8_t>({
+                    InferenceEngine::Precision::U8, {blobsSize}, InferenceEngine::C });
+            weights->allocate();
+            fill_data(weights->buffer().as<float*>(), weights->size() / sizeof(float));
+            net_reader.SetWeights(weights);
+
+            InferenceEngine::CNNNetwork network = net_reader.getNetwork();
+            auto subPixelNetwork = cloneNet(network);
+            ASSERT_EQ(p.converted ? 1 : 0, MKLDNNPlugin::ConvertSubPixelDeconvolutions(*subPixelNetwork));
+            InferenceEngine::CNNLayerPtr crop;
+            InferenceEngine::ResponseDesc resp;
+            ASSERT_EQ(p.with_crop, subPixelNetwork->getLayerByName("deconv1/SubPixelCrop", crop, &resp) == InferenceEngine::OK);
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(
+                    {InferenceEngine::Precision::FP32, p.dims, InferenceEngine::NCHW});
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(network);
+            auto output = infer(graph, network, src);
+
+            MKLDNNGraphTestClass subPixelGraph;
+            subPixelGraph.CreateGraph(*subPixelNetwork);
+            auto subPixelOutput = infer(subPixelGraph, *subPixelNetwork, src);
+
+            ASSERT_EQ(output->getTensorDesc().getDims(), subPixelOutput->getTensorDesc().getDims());
+            compare(*subPixelOutput, *output, 0.0002f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphSubPixelDeconvolutionTests, TestsSubPixelDeconvolution) {}
+
+INSTANTIATE_TEST_CASE_P(
+    TestSubPixelDeconvolution, MKLDNNGraphSubPixelDeconvolutionTests,
+    ::testing::Values(
+        // stride 2
+        subpixel_deconv_test_params{{1, 8, 5, 5}, {4, 4}, {2, 2}, {1, 1}, {1, 1}, {0, 0}, 8, 1, true, false},
+        subpixel_deconv_test_params{{2, 16, 7, 6}, {2, 2}, {2, 2}, {0, 0}, {0, 0}, {0, 0}, 8, 1, true, false},
+        subpixel_deconv_test_params{{1, 4, 6, 6}, {4, 4}, {2, 2}, {0, 0}, {1, 1}, {0, 0}, 5, 1, true, true},
+        // the odd outputs of the 3x3 kernel end with the Crop, the output padding makes them even
+        subpixel_deconv_test_params{{1, 8, 5, 7}, {3, 3}, {2, 2}, {1, 1}, {1, 1}, {0, 0}, 16, 1, true, true},
+        subpixel_deconv_test_params{{1, 8, 5, 7}, {3, 3}, {2, 2}, {1, 1}, {1, 1}, {1, 1}, 16, 1, true, false},
+        subpixel_deconv_test_params{{1, 8, 5, 7}, {3, 3}, {2, 2}, {1, 1}, {1, 1}, {1, 0}, 16, 1, true, true},
+        // stride 3
+        subpixel_deconv_test_params{{1, 6, 4, 5}, {3, 3}, {3, 3}, {0, 0}, {0, 0}, {0, 0}, 4, 1, true, false},
+        subpixel_deconv_test_params{{1, 6, 4, 5}, {6, 6}, {3, 3}, {1, 1}, {1, 1}, {0, 0}, 4, 1, true, true},
+        subpixel_deconv_test_params{{1, 6, 4, 5}, {6, 6}, {3, 3}, {2, 2}, {2, 2}, {2, 1}, 4, 1, true, true},
+        // different strides, kernels and pads along the axes
+        subpixel_deconv_test_params{{2, 4, 5, 6}, {6, 4}, {3, 2}, {0, 1}, {1, 1}, {0, 0}, 3, 1, true, true},
+        // the grouped and the stride 1 deconvolutions are kept
+        subpixel_deconv_test_params{{1, 8, 5, 5}, {4, 4}, {2, 2}, {1, 1}, {1, 1}, {0, 0}, 8, 2, false, false},
+        subpixel_deconv_test_params{{1, 8, 5, 5}, {4, 4}, {2, 2}, {1, 1}, {1, 1}, {0, 0}, 8, 8, false, false},
+        subpixel_deconv_test_params{{1, 8, 5, 5}, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {0, 0}, 8, 1, false, false}
+    ));
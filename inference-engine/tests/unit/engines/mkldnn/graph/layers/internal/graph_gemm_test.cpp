@@ -11,6 +11,7 @@
 #include "single_layer_common.hpp"
 #include <mkldnn_extension_utils.h>
 #include <cnn_network_impl.hpp>
+#include <cpu_isa_traits.hpp>
 #include "tests_common.hpp"
 
 using namespace ::testing;
@@ -660,3 +661,255 @@ INSTANTIATE_TEST_CASE_P(
                 gemm_test_params{{1, 3, 1, 3, 1, 1, 1, 3}, 7, 4, 3, 2, 3, true, true, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
                 gemm_test_params{{1, 3, 1, 1, 1, 1, 1, 3}, 7, 4, 3, 2, 3, true, true, 1, MKLDNNPlugin::impl_desc_type::gemm_any}
         ));
+
+struct gemm_int8_test_params {
+    InferenceEngine::Precision src0Precision;
+
+    size_t C;
+    size_t M;
+    size_t N;
+    size_t K;
+
+    float alpha;
+    bool transposeB;
+
+    // the dequantization ScaleShift after the gemm, fused into the int8 gemm
+    bool withScaleShift;
+};
+
+class MKLDNNGraphInt8GemmTests: public TestsCommon,
+                                public WithParamInterface<gemm_int8_test_params> {
+    std::string model_t = R"V0G0N(
+<net name="gemmInt8" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="_P0_" id="1">
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                    <dim>_M_</dim>
+                    <dim>_K_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in2" type="Input" precision="I8" id="2">
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                    <dim>_M_B_</dim>
+                    <dim>_N_B_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="gemm" id="3" type="GEMM" precision="FP32">
+            <data alpha="_A_" transpose_a="0" transpose_b="_TB_"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                    <dim>_M_</dim>
+                    <dim>_K_</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                    <dim>_M_B_</dim>
+                    <dim>_N_B_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                    <dim>_M_</dim>
+                    <dim>_N_</dim>
+                </port>
+            </output>
+        </layer>_SCALE_SHIFT_
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="1" to-layer="3" to-port="2"/>_SCALE_SHIFT_EDGE_
+    </edges>
+</net>
+)V0G0N";
+
+    std::string scale_shift_t = R"V0G0N(
+        <layer name="dequantize" id="4" type="ScaleShift" precision="FP32">
+            <weights offset="0" size="_S_"/>
+            <biases offset="_S_" size="_S_"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                    <dim>_M_</dim>
+                    <dim>_N_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                    <dim>_M_</dim>
+                    <dim>_N_</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+
+protected:
+    std::string getModel(gemm_int8_test_params p) {
+        std::string model = model_t;
+        if (p.withScaleShift) {
+            REPLACE_WITH_STR(model, "_SCALE_SHIFT_", scale_shift_t);
+            REPLACE_WITH_STR(model, "_SCALE_SHIFT_EDGE_", "\n        <edge from-layer=\"3\" from-port=\"3\" to-layer=\"4\" to-port=\"1\"/>");
+            REPLACE_WITH_NUM(model, "_S_", p.C * sizeof(float));
+        } else {
+            REPLACE_WITH_STR(model, "_SCALE_SHIFT_", "");
+            REPLACE_WITH_STR(model, "_SCALE_SHIFT_EDGE_", "");
+        }
+
+        REPLACE_WITH_STR(model, "_P0_", p.src0Precision.name());
+        REPLACE_WITH_NUM(model, "_C_", p.C);
+        REPLACE_WITH_NUM(model, "_M_B_", p.transposeB ? p.N : p.K);
+        REPLACE_WITH_NUM(model, "_N_B_", p.transposeB ? p.K : p.N);
+        REPLACE_WITH_NUM(model, "_M_", p.M);
+        REPLACE_WITH_NUM(model, "_N_", p.N);
+        REPLACE_WITH_NUM(model, "_K_", p.K);
+        REPLACE_WITH_NUM(model, "_A_", p.alpha);
+        REPLACE_WITH_NUM(model, "_TB_", p.transposeB);
+
+        return model;
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            gemm_int8_test_params p = ::testing::WithParamInterface<gemm_int8_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({InferenceEngine::Precision::U8,
+                {2 * p.C * sizeof(float)}, InferenceEngine::C});
+            weights->allocate();
+            float *scales = weights->data().as<float*>();
+            float *shifts = scales + p.C;
+            for (size_t c = 0; c < p.C; c++) {
+                scales[c] = 0.5f + 0.25f * c;
+                shifts[c] = -1.0f + c;
+            }
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            // the int8 gemm is used on AVX-512 only, elsewhere the inputs are converted to FP32
+            const bool int8 = mkldnn::impl::cpu::mayiuse(mkldnn::impl::cpu::avx512_core);
+            size_t depthwiseNodes = 0;
+            for (auto &node : graph.getNodes()) {
+                if (node->getType() == MKLDNNPlugin::Depthwise)
+                    depthwiseNodes++;
+                if (node->getType() == MKLDNNPlugin::Gemm) {
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    const auto &config = node->getSelectedPrimitiveDescriptor()->getConfig();
+                    ASSERT_EQ(int8 ? p.src0Precision : InferenceEngine::Precision(InferenceEngine::Precision::FP32), config.inConfs[0].desc.getPrecision());
+                    ASSERT_EQ(InferenceEngine::Precision(int8 ? InferenceEngine::Precision::I8 : InferenceEngine::Precision::FP32), config.inConfs[1].desc.getPrecision());
+                }
+            }
+            ASSERT_EQ(p.withScaleShift && !int8 ? 1 : 0, depthwiseNodes);
+
+            InferenceEngine::SizeVector dims_src1 = {1, p.C, p.M, p.K};
+            InferenceEngine::SizeVector dims_src2 = {1, p.C, p.transposeB ? p.N : p.K, p.transposeB ? p.K : p.N};
+
+            InferenceEngine::Blob::Ptr src1;
+            std::vector<float> a(p.C * p.M * p.K);
+            if (p.src0Precision == InferenceEngine::Precision::U8) {
+                src1 = InferenceEngine::make_shared_blob<uint8_t>({InferenceEngine::Precision::U8, dims_src1, InferenceEngine::NCHW});
+                src1->allocate();
+                auto data = src1->buffer().as<uint8_t*>();
+                for (size_t i = 0; i < a.size(); i++) {
+                    data[i] = static_cast<uint8_t>((i * 37) % 251);
+                    a[i] = data[i];
+                }
+            } else {
+                src1 = InferenceEngine::make_shared_blob<int8_t>({InferenceEngine::Precision::I8, dims_src1, InferenceEngine::NCHW});
+                src1->allocate();
+                auto data = src1->buffer().as<int8_t*>();
+                for (size_t i = 0; i < a.size(); i++) {
+                    data[i] = static_cast<int8_t>(static_cast<int>((i * 37) % 251) - 125);
+                    a[i] = data[i];
+                }
+            }
+
+            InferenceEngine::Blob::Ptr src2 = InferenceEngine::make_shared_blob<int8_t>({InferenceEngine::Precision::I8, dims_src2, InferenceEngine::NCHW});
+            src2->allocate();
+            std::vector<float> b(src2->size());
+            auto data2 = src2->buffer().as<int8_t*>();
+            for (size_t i = 0; i < b.size(); i++) {
+                data2[i] = static_cast<int8_t>(static_cast<int>((i * 13) % 255) - 127);
+                b[i] = data2[i];
+            }
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src1));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in2", src2));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            // the products of 8 bit values are summed up exactly in int32, so the reference is computed so as well
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            float *ref = dst_ref.data();
+            for (size_t c = 0; c < p.C; c++) {
+                for (size_t i = 0; i < p.M; i++) {
+                    for (size_t j = 0; j < p.N; j++) {
+                        int32_t acc = 0;
+                        for (size_t k = 0; k < p.K; k++) {
+                            size_t src1_off = p.transposeB ? j * p.K + k : k * p.N + j;
+                            acc += static_cast<int32_t>(a[(c * p.M + i) * p.K + k]) *
+                                   static_cast<int32_t>(b[c * p.K * p.N + src1_off]);
+                        }
+                        float value = p.alpha * acc;
+                        if (p.withScaleShift)
+                            value = value * scales[c] + shifts[c];
+                        ref[(c * p.M + i) * p.N + j] = value;
+                    }
+                }
+            }
+
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphInt8GemmTests, TestsInt8Gemm) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsInt8Gemm, MKLDNNGraphInt8GemmTests,
+        ::testing::Values(
+                gemm_int8_test_params{InferenceEngine::Precision::U8, 1, 4, 5, 7, 1.0f, false, false},
+                gemm_int8_test_params{InferenceEngine::Precision::I8, 1, 4, 5, 7, 1.0f, false, false},
+                gemm_int8_test_params{InferenceEngine::Precision::U8, 3, 8, 16, 33, 0.5f, false, true},
+                gemm_int8_test_params{InferenceEngine::Precision::I8, 3, 8, 16, 33, 0.5f, false, true},
+                gemm_int8_test_params{InferenceEngine::Precision::U8, 2, 5, 9, 64, 1.0f, true, true},
+                gemm_int8_test_params{InferenceEngine::Precision::I8, 2, 5, 9, 64, 2.0f, true, false}
+        ));
@@ -350,6 +350,10 @@ TEST_P(permute_s8, TestsPermute) {}
 #define case_planar_4(prec) test_params_t(Layout::BLOCKED, Layout::BLOCKED, prec, 1, {2, 80, 2, 2, 4, 5}, {0, 1, 4, 2, 5, 3}, {}, {}, {}, {})
 #define case_planar_5(prec) test_params_t(Layout::BLOCKED, Layout::BLOCKED, prec, 1, {2, 8, 30, 3, 4, 5}, {0, 1, 4, 2, 5, 3}, {}, {}, {}, {})
 #define case_planar_6(prec) test_params_t(Layout::BLOCKED, Layout::BLOCKED, prec, 1, {2, 8, 3, 30, 4, 5}, {0, 3, 4, 1, 5, 2}, {}, {}, {}, {})
+#define case_planar_7(prec) test_params_t(Layout::CHW, Layout::CHW, prec, 1, {2, 33, 70}, {2, 1, 0}, {}, {}, {}, {})
+#define case_planar_8(prec) test_params_t(Layout::NCHW, Layout::NCHW, prec, 1 + (prec == Precision::I8), {3, 35, 5, 40}, {0, 3, 2, 1}, {}, {}, {}, {})
+#define case_planar_9(prec) test_params_t(Layout::BLOCKED, Layout::BLOCKED, prec, 1, {1, 4, 2, 2, 6, 7}, {0, 1, 3, 5, 2, 4}, {}, {}, {}, {})
+#define case_planar_10(prec) test_params_t(Layout::NCDHW, Layout::NCDHW, prec, 1 + (prec == Precision::I8), {4, 1, 6, 1, 8}, {0, 3, 2, 1, 4}, {}, {}, {}, {})
 
 #define case_blocked_0(prec) test_params_t(Layout::BLOCKED, Layout::BLOCKED, prec, 3 + (prec == Precision::I8), {2, 32, 10, 20}, {0, 1, 2, 3}, \
 {2, 4, 10, 20, 8}, {0, 1, 2, 3, 1}, {2, 4, 10, 20, 8}, {0, 1, 2, 3, 1})
@@ -424,6 +428,10 @@ test_params_t test_cases_fp32[] = {
         case_planar_4(Precision::FP32),
         case_planar_5(Precision::FP32),
         case_planar_6(Precision::FP32),
+        case_planar_7(Precision::FP32),
+        case_planar_8(Precision::FP32),
+        case_planar_9(Precision::FP32),
+        case_planar_10(Precision::FP32),
 };
 
 test_params_t test_cases_s8[] = {
@@ -434,6 +442,10 @@ test_params_t test_cases_s8[] = {
         case_planar_4(Precision::I8),
         case_planar_5(Precision::I8),
         case_planar_6(Precision::I8),
+        case_planar_7(Precision::I8),
+        case_planar_8(Precision::I8),
+        case_planar_9(Precision::I8),
+        case_planar_10(Precision::I8),
 };
 
 test_params_t test_cases_blocked_fp32[] = {
@@ -10,8 +10,13 @@
 
 #include <mock_error_listener.hpp>
 #include <mkldnn_extension_mngr.h>
+#include <nodes/mkldnn_reorder_node.h>
 #include "tests_common.hpp"
 
+#include <cmath>
+#include <cstring>
+#include <limits>
+
 using namespace ::testing;
 using namespace std;
 using namespace mkldnn;
@@ -259,3 +264,169 @@ TEST_F(MKLDNNGraphReorderTests, CreateInPlaceReorder) {
         ASSERT_EQ(data[i], 4);
     }
 }
+
+struct reorder_kernel_test_params {
+    memory::dims dims;
+    memory::data_type src_dt;
+    memory::format src_fmt;
+    memory::data_type dst_dt;
+    memory::format dst_fmt;
+    bool with_scales;
+};
+
+// Runs a standalone reorder node, which takes the JIT kernel of the plugin over the reorders MKLDNN leaves to
+// the reference code, and compares it against the MKLDNN reorder built for the same memories
+class MKLDNNGraphReorderKernelTests: public TestsCommon,
+                                     public WithParamInterface<reorder_kernel_test_params> {
+protected:
+    mkldnn::engine eng = mkldnn::engine(mkldnn::engine::kind::cpu, 0);
+    // the parent, the reorder and the child nodes with the edges between them
+    std::vector<MKLDNNPlugin::MKLDNNNodePtr> nodes;
+    std::vector<MKLDNNPlugin::MKLDNNEdgePtr> edges;
+
+    static void fill(MKLDNNPlugin::MKLDNNMemory &mem, float scale) {
+        const size_t size = mem.GetSize() / MKLDNNPlugin::MKLDNNExtensionUtils::sizeOfDataType(mem.GetDataType());
+        void *data = mem.GetData();
+        for (size_t i = 0; i < size; i++) {
+            const float value = scale * (static_cast<int>(i % 255) - 127) + 0.25f;
+            switch (mem.GetDataType()) {
+                case memory::f32: static_cast<float *>(data)[i] = value; break;
+                case memory::s32: static_cast<int32_t *>(data)[i] = static_cast<int32_t>(value); break;
+                case memory::s8: static_cast<int8_t *>(data)[i] = static_cast<int8_t>(static_cast<int>(i % 255) - 127); break;
+                case memory::u8: static_cast<uint8_t *>(data)[i] = static_cast<uint8_t>(i % 255); break;
+                default: FAIL() << "Unsupported data type";
+            }
+        }
+    }
+
+    // returns the reorder node with the edges from and to the memories of the descs
+    MKLDNNPlugin::MKLDNNNodePtr createReorder(const memory::desc &srcDesc, const memory::desc &dstDesc,
+                                              const std::vector<float> &scales) {
+        auto createNode = [&](const std::string &name) {
+            InferenceEngine::CNNLayerPtr layer(new InferenceEngine::CNNLayer({name, "Reorder", InferenceEngine::Precision::FP32}));
+            return MKLDNNPlugin::MKLDNNNodePtr(MKLDNNPlugin::MKLDNNNode::CreateNode(layer, eng, {}));
+        };
+        auto parent = createNode("parent");
+        auto reorder = createNode("reorder");
+        auto child = createNode("child");
+        nodes = {parent, reorder, child};
+
+        auto *reorderPtr = dynamic_cast<MKLDNNPlugin::MKLDNNReorderNode *>(reorder.get());
+        reorderPtr->setDescs(MKLDNNPlugin::MKLDNNMemoryDesc(srcDesc), MKLDNNPlugin::MKLDNNMemoryDesc(dstDesc));
+        if (!scales.empty()) {
+            auto scalesBlob = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {scales.size()}, InferenceEngine::C});
+            scalesBlob->allocate();
+            std::copy(scales.begin(), scales.end(), scalesBlob->buffer().as<float *>());
+            reorderPtr->_scales = scalesBlob;
+        }
+
+        edges = {std::make_shared<MKLDNNPlugin::MKLDNNEdge>(parent, reorder),
+                 std::make_shared<MKLDNNPlugin::MKLDNNEdge>(reorder, child)};
+        for (auto &edge : edges)
+            reorder->addEdge(edge);
+        edges[0]->getMemoryPtr().reset(new MKLDNNPlugin::MKLDNNMemory(eng));
+        edges[0]->getMemoryPtr()->Create(srcDesc);
+        edges[1]->getMemoryPtr().reset(new MKLDNNPlugin::MKLDNNMemory(eng));
+        edges[1]->getMemoryPtr()->Create(dstDesc);
+
+        reorder->getSupportedDescriptors();
+        reorder->initSupportedPrimitiveDescriptors();
+        reorder->selectPrimitiveDescriptorByIndex(0);
+        reorder->createPrimitive();
+        // MKLDNN or the plugin run the reorder on a JIT kernel
+        EXPECT_FALSE(reorderPtr->isReference());
+        return reorder;
+    }
+
+    static std::vector<float> channelScales(size_t channels) {
+        std::vector<float> scales(channels);
+        for (size_t c = 0; c < channels; c++)
+            scales[c] = 0.125f * (c + 1);
+        return scales;
+    }
+};
+
+TEST_P(MKLDNNGraphReorderKernelTests, TestsReorderAgainstReference) {
+    auto p = GetParam();
+    memory::desc srcDesc(p.dims, p.src_dt, p.src_fmt);
+    memory::desc dstDesc(p.dims, p.dst_dt, p.dst_fmt);
+    std::vector<float> scales = p.with_scales ? channelScales(static_cast<size_t>(p.dims[1])) : std::vector<float>();
+
+    auto node = createReorder(srcDesc, dstDesc, scales);
+    auto &src = *edges[0]->getMemoryPtr();
+    auto &dst = *edges[1]->getMemoryPtr();
+    fill(src, 0.5f);
+
+    mkldnn::stream strm(mkldnn::stream::kind::eager);
+    node->execute(strm);
+    strm.wait();
+
+    mkldnn::primitive_attr attr;
+    if (!scales.empty()) {
+        attr.set_output_scales(1 << 1, scales);
+        attr.set_int_output_round_mode(round_nearest);
+    }
+    MKLDNNPlugin::MKLDNNMemory ref(eng);
+    ref.Create(dstDesc);
+    reorder::primitive_desc pd(src.GetPrimitiveDescriptor(), ref.GetPrimitiveDescriptor(), attr);
+    mkldnn::stream(mkldnn::stream::kind::eager).submit({mkldnn::reorder(pd, src.GetPrimitive(), ref.GetPrimitive())}).wait();
+
+    ASSERT_EQ(ref.GetSize(), dst.GetSize());
+    ASSERT_EQ(0, std::memcmp(ref.GetData(), dst.GetData(), dst.GetSize()));
+}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsReorderKernel, MKLDNNGraphReorderKernelTests,
+        ::testing::Values(
+                reorder_kernel_test_params{{2, 16, 3, 4, 5}, memory::f32, memory::nCdhw8c, memory::f32, memory::ncdhw, false},
+                reorder_kernel_test_params{{2, 16, 3, 4, 5}, memory::f32, memory::ncdhw, memory::f32, memory::nCdhw8c, false},
+                reorder_kernel_test_params{{1, 24, 7, 3, 9}, memory::u8, memory::nCdhw8c, memory::f32, memory::ncdhw, false},
+                reorder_kernel_test_params{{2, 32, 5, 7}, memory::u8, memory::nChw16c, memory::f32, memory::nhwc, false},
+                reorder_kernel_test_params{{1, 48, 3, 3}, memory::u8, memory::nChw16c, memory::f32, memory::nhwc, false},
+                // per-channel scales
+                reorder_kernel_test_params{{1, 16, 2, 3, 4}, memory::f32, memory::ncdhw, memory::s8, memory::nCdhw8c, true},
+                reorder_kernel_test_params{{2, 16, 3, 4, 5}, memory::f32, memory::nCdhw8c, memory::u8, memory::ncdhw, true},
+                reorder_kernel_test_params{{2, 32, 5, 7}, memory::u8, memory::nChw16c, memory::f32, memory::nhwc, true},
+                // the channels are not a multiple of the vector length, so the vector loops have scalar tails
+                reorder_kernel_test_params{{2, 19, 3, 4, 5}, memory::f32, memory::ndhwc, memory::u8, memory::ndhwc, true},
+                reorder_kernel_test_params{{2, 19, 3, 4, 5}, memory::u8, memory::ndhwc, memory::f32, memory::ncdhw, true},
+                reorder_kernel_test_params{{1, 21, 3, 3}, memory::s8, memory::nhwc, memory::s32, memory::nchw, true}
+        ));
+
+TEST_F(MKLDNNGraphReorderKernelTests, TestsReorderSaturatesToInt32) {
+    const memory::dims dims = {1, 16, 2, 3, 5};
+    memory::desc srcDesc(dims, memory::f32, memory::nCdhw8c);
+    memory::desc dstDesc(dims, memory::s32, memory::ncdhw);
+
+    auto node = createReorder(srcDesc, dstDesc, {});
+    auto &src = *edges[0]->getMemoryPtr();
+    auto &dst = *edges[1]->getMemoryPtr();
+
+    // the values beyond the int32 range are saturated instead of wrapping to INT_MIN
+    const float values[] = {3e9f, -3e9f, 2147483648.f, -2147483648.f, 1e20f, 17.5f, -17.5f};
+    const size_t size = src.GetSize() / sizeof(float);
+    auto *srcData = static_cast<float *>(src.GetData());
+    for (size_t i = 0; i < size; i++)
+        srcData[i] = values[i % (sizeof(values) / sizeof(values[0]))];
+
+    mkldnn::stream strm(mkldnn::stream::kind::eager);
+    node->execute(strm);
+    strm.wait();
+
+    MKLDNNPlugin::MKLDNNMemoryDesc srcMemDesc(srcDesc);
+    MKLDNNPlugin::MKLDNNMemoryDesc dstMemDesc(dstDesc);
+    InferenceEngine::TensorDesc srcTensorDesc = srcMemDesc;
+    InferenceEngine::TensorDesc dstTensorDesc = dstMemDesc;
+    const auto *dstData = static_cast<const int32_t *>(dst.GetData());
+    for (size_t i = 0; i < size; i++) {
+        const float value = srcData[srcTensorDesc.offset(i)];
+        const int32_t result = dstData[dstTensorDesc.offset(i)];
+        if (value >= 2147483520.f) {
+            ASSERT_GE(result, 2147483520) << "at " << i;
+        } else if (value <= -2147483648.f) {
+            ASSERT_EQ(std::numeric_limits<int32_t>::min(), result) << "at " << i;
+        } else {
+            ASSERT_EQ(static_cast<int32_t>(std::nearbyint(value)), result) << "at " << i;
+        }
+    }
+}
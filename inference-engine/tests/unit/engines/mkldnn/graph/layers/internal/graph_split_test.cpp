@@ -396,7 +396,15 @@ INSTANTIATE_TEST_CASE_P(
                 split_test_params {
                         {1, 32, 16, 16, 16},
                         {{1, 8, 16, 16, 16}, {1, 8, 16, 16, 16}, {1, 8, 16, 16, 16}, {1, 8, 16, 16, 16}},
-                        1, 3, MKLDNNPlugin::impl_desc_type::unknown, {}}));
+                        1, 3, MKLDNNPlugin::impl_desc_type::unknown, {}},
+                split_test_params {
+                        {2, 16, 6, 5},
+                        {{2, 16, 4, 5}, {2, 16, 2, 5}},
+                        2, 4, MKLDNNPlugin::impl_desc_type::unknown, {}},
+                split_test_params {
+                        {2, 32, 4, 6, 5},
+                        {{2, 32, 4, 1, 5}, {2, 32, 4, 5, 5}},
+                        3, 4, MKLDNNPlugin::impl_desc_type::unknown, {}}));
 
 class MKLDNNGraphDynBatchSplitTests: public MKLDNNGraphSplitTests {
 protected:
@@ -0,0 +1,361 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_extension_utils.h>
+#include <ie_util_internal.hpp>
+#include <net_pass.h>
+#include "tests_common.hpp"
+
+#include <cstdlib>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct tensor_iterator_test_params {
+    // sequence length
+    size_t T;
+    // channels of a time step
+    size_t C;
+    // the sequence is iterated from the end
+    bool reverse;
+};
+
+// The body sums up the time steps into the state passed over the back edge and doubles it.
+// The input and the doubled output are plain slices of the outer tensors, so the body reads
+// and writes them in place, the state buffers are swapped after every iteration.
+static const char tensor_iterator_model[] = R"V0G0N(
+<net name="TensorIterator" version="4" batch="1">
+    <layers>
+        <layer name="x" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>_T_</dim>
+                    <dim>_C_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="h0" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="ti" type="TensorIterator" precision="FP32" id="2">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>_T_</dim>
+                    <dim>_C_</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>_T_</dim>
+                    <dim>_C_</dim>
+                </port>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>_T_</dim>
+                    <dim>_C_</dim>
+                </port>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                </port>
+            </output>
+            <port_map>
+                <input  external_port_id="0" internal_layer_id="0" internal_port_id="0" axis="1"_ITER_/>
+                <input  external_port_id="1" internal_layer_id="0" internal_port_id="1"/>
+                <output external_port_id="3" internal_layer_id="0" internal_port_id="2" axis="1"_ITER_/>
+                <output external_port_id="4" internal_layer_id="1" internal_port_id="1" axis="1"_ITER_/>
+                <output external_port_id="5" internal_layer_id="0" internal_port_id="2"/>
+            </port_map>
+            <back_edges>
+                <edge from-layer="0" from-port="2" to-layer="0" to-port="1"/>
+            </back_edges>
+            <body>
+                <layers>
+                    <layer name="sum" type="Eltwise" precision="FP32" id="0">
+                        <data operation="sum"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="2">
+                                <dim>1</dim>
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer name="double" type="Power" precision="FP32" id="1">
+                        <data power="1" scale="2" shift="0"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                </layers>
+                <edges>
+                    <edge from-layer="0" from-port="2" to-layer="1" to-port="0"/>
+                </edges>
+            </body>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+static std::string getTensorIteratorModel(const tensor_iterator_test_params &p) {
+    std::string model = tensor_iterator_model;
+    REPLACE_WITH_NUM(model, "_T_", p.T);
+    REPLACE_WITH_NUM(model, "_C_", p.C);
+    REPLACE_WITH_STR(model, "_ITER_", p.reverse ? " start=\"-1\" end=\"0\" stride=\"-1\"" : "");
+    return model;
+}
+
+class MKLDNNGraphTensorIteratorTests: public TestsCommon,
+                                      public WithParamInterface<tensor_iterator_test_params> {
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            tensor_iterator_test_params p = ::testing::WithParamInterface<tensor_iterator_test_params>::GetParam();
+            std::string model = getTensorIteratorModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+            auto network = net_reader.getNetwork();
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(network);
+
+            InferenceEngine::Blob::Ptr x = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                {1, p.T, p.C}, InferenceEngine::CHW});
+            x->allocate();
+            fill_data(x->buffer(), x->size());
+            InferenceEngine::Blob::Ptr h0 = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                {1, 1, p.C}, InferenceEngine::CHW});
+            h0->allocate();
+            fill_data_sine(h0->buffer().as<float *>(), h0->size(), 0.5f, 1.f, 0.3f);
+
+            InferenceEngine::BlobMap srcs;
+            srcs["x"] = x;
+            srcs["h0"] = h0;
+
+            // the outputs in the order of the TensorIterator ports: the states, the doubled states, the last state
+            InferenceEngine::CNNLayerPtr ti = network.getLayerByName("ti");
+            std::vector<InferenceEngine::TBlob<float>::Ptr> outputs;
+            InferenceEngine::BlobMap outputBlobs;
+            for (const auto &data : ti->outData) {
+                auto output = InferenceEngine::make_shared_blob<float>(data->getTensorDesc());
+                output->allocate();
+                outputs.push_back(output);
+                outputBlobs[data->getName()] = output;
+            }
+
+            std::vector<InferenceEngine::TBlob<float>> refs;
+            refs.reserve(outputs.size());
+            for (const auto &output : outputs) {
+                refs.emplace_back(output->getTensorDesc());
+                refs.back().allocate();
+            }
+            const float *x_data = x->cbuffer().as<const float *>();
+            std::vector<float> state(h0->cbuffer().as<const float *>(), h0->cbuffer().as<const float *>() + p.C);
+            for (size_t i = 0; i < p.T; i++) {
+                const size_t t = p.reverse ? p.T - 1 - i : i;
+                for (size_t c = 0; c < p.C; c++) {
+                    state[c] += x_data[t * p.C + c];
+                    refs[0].data()[t * p.C + c] = state[c];
+                    refs[1].data()[t * p.C + c] = 2 * state[c];
+                }
+            }
+            for (size_t c = 0; c < p.C; c++)
+                refs[2].data()[c] = state[c];
+
+            // the second inference starts with the state buffers in their initial places again
+            for (int infer = 0; infer < 2; infer++) {
+                for (auto &output : outputs)
+                    fill_data_const(output->data(), output->size(), -1.f);
+
+                graph.Infer(srcs, outputBlobs);
+
+                for (size_t i = 0; i < outputs.size(); i++) {
+                    compare(*outputs[i], refs[i], 0.0001f, "output " + std::to_string(i) + ", inference " + std::to_string(infer));
+                }
+            }
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphTensorIteratorTests, TestsTensorIterator) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsTensorIterator, MKLDNNGraphTensorIteratorTests,
+        ::testing::Values(
+                // odd and even numbers of the swaps of the state buffers
+                tensor_iterator_test_params{5, 16, false},
+                tensor_iterator_test_params{4, 16, false},
+                tensor_iterator_test_params{1, 16, false},
+                tensor_iterator_test_params{5, 16, true},
+                tensor_iterator_test_params{4, 7, true}
+        ));
+
+struct tensor_iterator_unroll_test_params {
+    tensor_iterator_test_params ti;
+    // the largest number of the layers the iterator is unrolled to, 0 for the default of the plugin
+    size_t max_unrolled_layers;
+    // the time steps one iteration of the remaining TensorIterator takes, 0 if it is unrolled completely
+    size_t steps_per_iteration;
+};
+
+// Compares the unrolled TensorIterator against the one run by the TensorIterator node as is
+class MKLDNNGraphUnrolledTensorIteratorTests: public TestsCommon,
+                                              public WithParamInterface<tensor_iterator_unroll_test_params> {
+protected:
+    static std::vector<InferenceEngine::TBlob<float>::Ptr> infer(InferenceEngine::ICNNNetwork &network,
+                                                                 const InferenceEngine::CNNLayerPtr &ti,
+                                                                 const InferenceEngine::BlobMap &srcs) {
+        MKLDNNGraphTestClass graph;
+        graph.CreateGraph(network);
+
+        std::vector<InferenceEngine::TBlob<float>::Ptr> outputs;
+        InferenceEngine::BlobMap outputBlobs;
+        for (const auto &data : ti->outData) {
+            auto output = InferenceEngine::make_shared_blob<float>(data->getTensorDesc());
+            output->allocate();
+            outputs.push_back(output);
+            outputBlobs[data->getName()] = output;
+        }
+        graph.Infer(srcs, outputBlobs);
+        return outputs;
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            tensor_iterator_unroll_test_params p = ::testing::WithParamInterface<tensor_iterator_unroll_test_params>::GetParam();
+            std::string model = getTensorIteratorModel(p.ti);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+            auto network = net_reader.getNetwork();
+            InferenceEngine::CNNLayerPtr ti = network.getLayerByName("ti");
+
+            auto unrolled = InferenceEngine::cloneNet(network);
+            if (p.max_unrolled_layers) {
+                ASSERT_TRUE(InferenceEngine::NetPass::UnrollTI(*unrolled, p.max_unrolled_layers));
+            } else {
+                MKLDNNPlugin::MKLDNNGraph::ApplyUnrollPasses(static_cast<InferenceEngine::ICNNNetwork &>(*unrolled));
+            }
+
+            std::shared_ptr<InferenceEngine::TensorIterator> unrolledTI;
+            for (const auto &layer : unrolled->allLayers()) {
+                if (layer.second->type == "TensorIterator")
+                    unrolledTI = std::dynamic_pointer_cast<InferenceEngine::TensorIterator>(layer.second);
+            }
+            if (p.steps_per_iteration == 0) {
+                ASSERT_EQ(nullptr, unrolledTI);
+            } else {
+                ASSERT_NE(nullptr, unrolledTI);
+                for (const auto &rule : unrolledTI->input_port_map) {
+                    if (rule.axis != -1)
+                        ASSERT_EQ(p.steps_per_iteration, static_cast<size_t>(std::abs(rule.stride)));
+                }
+                for (const auto &rule : unrolledTI->output_port_map) {
+                    if (rule.axis != -1)
+                        ASSERT_EQ(p.steps_per_iteration, static_cast<size_t>(std::abs(rule.stride)));
+                }
+            }
+
+            InferenceEngine::Blob::Ptr x = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                {1, p.ti.T, p.ti.C}, InferenceEngine::CHW});
+            x->allocate();
+            fill_data(x->buffer(), x->size());
+            InferenceEngine::Blob::Ptr h0 = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                {1, 1, p.ti.C}, InferenceEngine::CHW});
+            h0->allocate();
+            fill_data_sine(h0->buffer().as<float *>(), h0->size(), 0.5f, 1.f, 0.3f);
+
+            InferenceEngine::BlobMap srcs;
+            srcs["x"] = x;
+            srcs["h0"] = h0;
+
+            auto refs = infer(network, ti, srcs);
+            auto outputs = infer(*unrolled, ti, srcs);
+            for (size_t i = 0; i < outputs.size(); i++) {
+                compare(*outputs[i], *refs[i], 0.0001f, "output " + std::to_string(i));
+            }
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphUnrolledTensorIteratorTests, TestsUnrolledTensorIterator) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsUnrolledTensorIterator, MKLDNNGraphUnrolledTensorIteratorTests,
+        ::testing::Values(
+                // the body of two layers is unrolled completely within the limit
+                tensor_iterator_unroll_test_params{{6, 16, false}, 12, 0},
+                tensor_iterator_unroll_test_params{{6, 16, true}, 12, 0},
+                // the body is repeated three times, the back edge connects the copies
+                tensor_iterator_unroll_test_params{{6, 16, false}, 6, 3},
+                tensor_iterator_unroll_test_params{{6, 7, true}, 6, 3},
+                // the prime trip count has no divisor within the limit
+                tensor_iterator_unroll_test_params{{7, 8, false}, 8, 1},
+                // the body above the limit stays a TensorIterator
+                tensor_iterator_unroll_test_params{{8, 8, false}, 1, 1},
+                // the default limit of the plugin
+                tensor_iterator_unroll_test_params{{5, 16, false}, 0, 0},
+                tensor_iterator_unroll_test_params{{100, 8, false}, 0, 50},
+                tensor_iterator_unroll_test_params{{100, 8, true}, 0, 50}
+        ));
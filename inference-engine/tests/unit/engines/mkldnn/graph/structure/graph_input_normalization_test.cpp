@@ -0,0 +1,263 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_graph.h"
+#include "mkldnn_input_normalization.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <cnn_network_impl.hpp>
+#include "tests_common.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct input_normalization_test_params {
+    struct {
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    struct {
+        size_t krn;
+        size_t pad;
+        size_t out_c;
+        size_t grp_c;
+    } conv;
+
+    // a ScaleShift between the input and the convolution, with zero shifts or not
+    bool scaleShift;
+    bool zeroShifts;
+    // the mean values of the pre-processing of the input
+    bool meanValues;
+
+    size_t folded;
+};
+
+class MKLDNNGraphInputNormalizationTests: public TestsCommon,
+                                          public WithParamInterface<input_normalization_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="InputNormalization" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>_SCALE_SHIFT_
+        <layer name="conv" id="2" type="Convolution" precision="FP32">
+            <convolution stride-x="1" stride-y="1"
+                         pad-x="_C_P_"    pad-y="_C_P_"
+                         kernel-x="_C_K_" kernel-y="_C_K_"
+                         output="_C_OC_"  group="_C_GC_"/>
+
+            <weights offset="0" size="_C_S1_" />
+            <biases offset="_C_S1_" size="_C_S2_" />
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>_C_OC_</dim>
+                    <dim>_C_OH_</dim>
+                    <dim>_C_OW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>_EDGES_
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string scale_shift_t = R"V0G0N(
+        <layer name="norm" id="1" type="ScaleShift" precision="FP32">
+            <weights offset="_S_S0_" size="_S_S1_" />
+            <biases offset="_S_S2_" size="_S_S1_" />
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+
+protected:
+    size_t convWeightsSize(const input_normalization_test_params& p) {
+        return p.conv.krn * p.conv.krn * p.conv.out_c * p.in.c / p.conv.grp_c;
+    }
+
+    std::string getModel(const input_normalization_test_params& p) {
+        std::string model = model_t;
+        if (p.scaleShift) {
+            REPLACE_WITH_STR(model, "_SCALE_SHIFT_", scale_shift_t);
+            REPLACE_WITH_STR(model, "_EDGES_", R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>)V0G0N");
+        } else {
+            REPLACE_WITH_STR(model, "_SCALE_SHIFT_", "");
+            REPLACE_WITH_STR(model, "_EDGES_", R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="3"/>)V0G0N");
+        }
+
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+
+        REPLACE_WITH_NUM(model, "_C_K_", p.conv.krn);
+        REPLACE_WITH_NUM(model, "_C_P_", p.conv.pad);
+        REPLACE_WITH_NUM(model, "_C_OC_", p.conv.out_c);
+        REPLACE_WITH_NUM(model, "_C_GC_", p.conv.grp_c);
+        REPLACE_WITH_NUM(model, "_C_OH_", p.in.h + 2 * p.conv.pad - p.conv.krn + 1);
+        REPLACE_WITH_NUM(model, "_C_OW_", p.in.w + 2 * p.conv.pad - p.conv.krn + 1);
+
+        const size_t conv_w_data_size = convWeightsSize(p) * sizeof(float);
+        const size_t conv_b_data_size = p.conv.out_c * sizeof(float);
+        REPLACE_WITH_NUM(model, "_C_S1_", conv_w_data_size);
+        REPLACE_WITH_NUM(model, "_C_S2_", conv_b_data_size);
+
+        REPLACE_WITH_NUM(model, "_S_S0_", conv_w_data_size + conv_b_data_size);
+        REPLACE_WITH_NUM(model, "_S_S1_", p.in.c * sizeof(float));
+        REPLACE_WITH_NUM(model, "_S_S2_", conv_w_data_size + conv_b_data_size + p.in.c * sizeof(float));
+
+        return model;
+    }
+
+    InferenceEngine::CNNNetwork readNetwork(const input_normalization_test_params& p,
+                                            const InferenceEngine::TBlob<uint8_t>::Ptr& weights) {
+        std::string model = getModel(p);
+        InferenceEngine::CNNNetReader net_reader;
+        net_reader.ReadNetwork(model.data(), model.length());
+        net_reader.SetWeights(weights);
+        auto network = net_reader.getNetwork();
+
+        if (p.meanValues) {
+            auto& preProcess = network.getInputsInfo().begin()->second->getPreProcess();
+            preProcess.init(p.in.c);
+            for (size_t c = 0; c < p.in.c; c++) {
+                preProcess[c]->meanValue = 0.25f * c - 0.5f;
+            }
+            preProcess.setVariant(InferenceEngine::MEAN_VALUE);
+        }
+        return network;
+    }
+
+    InferenceEngine::TBlob<float>::Ptr infer(InferenceEngine::CNNNetwork& network, const InferenceEngine::Blob::Ptr& src) {
+        MKLDNNGraphTestClass graph;
+        graph.CreateGraph(network);
+
+        InferenceEngine::BlobMap srcs;
+        srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+        InferenceEngine::OutputsDataMap out = network.getOutputsInfo();
+        std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+        InferenceEngine::TBlob<float>::Ptr output;
+        output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        InferenceEngine::BlobMap outputBlobs;
+        outputBlobs[item.first] = output;
+
+        graph.Infer(srcs, outputBlobs);
+        return output;
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            input_normalization_test_params p = ::testing::WithParamInterface<input_normalization_test_params>::GetParam();
+
+            const size_t conv_w_size = convWeightsSize(p) + p.conv.out_c;
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8,
+                {(conv_w_size + 2 * p.in.c) * sizeof(float)}, InferenceEngine::C });
+            weights->allocate();
+            float *data = weights->buffer().as<float *>();
+            fill_data_sine(data, conv_w_size, 0.f, 0.5f, 0.7f);
+            fill_data_sine(data + conv_w_size, p.in.c, 1.f, 0.5f, 1.3f);
+            if (p.zeroShifts) {
+                fill_data_const(data + conv_w_size + p.in.c, p.in.c, 0.f);
+            } else {
+                fill_data_sine(data + conv_w_size + p.in.c, p.in.c, 0.5f, 1.f, 0.9f);
+            }
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+            auto reference = readNetwork(p, weights_ptr);
+            auto network = readNetwork(p, weights_ptr);
+
+            auto implNet = dynamic_cast<InferenceEngine::details::CNNNetworkImpl *>(&((InferenceEngine::ICNNNetwork&)network));
+            ASSERT_NE(nullptr, implNet) << "Failed to cast ICNNNetwork to CNNNetworkImpl";
+            ASSERT_EQ(p.folded, MKLDNNPlugin::FoldInputNormalization(*implNet));
+
+            // the ScaleShift is folded first, so the mean values are folded only after it
+            const bool scaleShiftFolded = p.scaleShift && p.folded > 0;
+            const bool meanValuesFolded = p.meanValues && p.folded == (p.scaleShift ? 2 : 1);
+            InferenceEngine::CNNLayerPtr layer;
+            ASSERT_EQ(scaleShiftFolded || !p.scaleShift ? InferenceEngine::NOT_FOUND : InferenceEngine::OK,
+                      implNet->getLayerByName("norm", layer, nullptr));
+            ASSERT_EQ(p.meanValues && !meanValuesFolded ? InferenceEngine::MEAN_VALUE : InferenceEngine::NONE,
+                      network.getInputsInfo().begin()->second->getPreProcess().getMeanVariant());
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                {1, p.in.c, p.in.h, p.in.w}, InferenceEngine::NCHW});
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            auto dst_ref = infer(reference, src);
+            auto dst = infer(network, src);
+
+            compare(*dst, *dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphInputNormalizationTests, TestsFoldInputNormalization) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsFoldInputNormalization, MKLDNNGraphInputNormalizationTests,
+        ::testing::Values(
+                // ScaleShift and convolution
+                input_normalization_test_params{{3, 9, 9}, {1, 0, 16, 1}, true, false, false, 1},
+                input_normalization_test_params{{3, 9, 9}, {3, 0, 16, 1}, true, false, false, 1},
+                // mean values and convolution
+                input_normalization_test_params{{3, 9, 9}, {3, 0, 16, 1}, false, false, true, 1},
+                input_normalization_test_params{{3, 9, 9}, {3, 0, 16, 1}, true, false, true, 2},
+                // grouped and depthwise convolutions
+                input_normalization_test_params{{8, 7, 7}, {3, 0, 4, 2}, true, false, true, 2},
+                input_normalization_test_params{{8, 7, 7}, {3, 0, 8, 8}, true, false, false, 1},
+                // the padding reads the zeros of the normalized input, so only the scales are folded
+                input_normalization_test_params{{3, 9, 9}, {3, 1, 16, 1}, true, false, false, 0},
+                input_normalization_test_params{{3, 9, 9}, {3, 1, 16, 1}, false, false, true, 0},
+                input_normalization_test_params{{3, 9, 9}, {3, 1, 16, 1}, true, true, false, 1},
+                input_normalization_test_params{{8, 7, 7}, {3, 1, 8, 8}, true, false, true, 0}
+        ));
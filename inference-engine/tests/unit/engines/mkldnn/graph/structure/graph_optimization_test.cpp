@@ -115,6 +115,231 @@ TEST_F(MKLDNNGraphOptimizationTests, TestNoFuseConvSumWithOneInput) {
     ASSERT_FALSE(fused);
 }
 
+TEST_F(MKLDNNGraphOptimizationTests, TestFuseFullyConnectedAndSoftMax) {
+    std::string model = R"V0G0N(
+<net name="Classifier" version="3" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="fc" type="FullyConnected" precision="FP32" id="1">
+            <fc out-size="10"/>
+            <weights offset="0" size="640"/>
+            <biases offset="640" size="40"/>
+            <input>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>2</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="prob" type="SoftMax" precision="FP32" id="2">
+            <data axis="1"/>
+            <input>
+                <port id="3">
+                    <dim>2</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>2</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {680}, InferenceEngine::C });
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    for (auto &node : graph.getNodes()) {
+        ASSERT_NE(MKLDNNPlugin::SoftMax, node->getType());
+    }
+
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {2, 16}, InferenceEngine::NC});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    const float *src_data = src->buffer().as<const float *>();
+    const float *w = weights->buffer().as<const float *>();
+    const float *b = w + 160;
+    const float *dst_data = output->buffer().as<const float *>();
+    for (size_t n = 0; n < 2; n++) {
+        std::vector<float> ref(10);
+        for (size_t oc = 0; oc < 10; oc++) {
+            ref[oc] = b[oc];
+            for (size_t ic = 0; ic < 16; ic++)
+                ref[oc] += src_data[n * 16 + ic] * w[oc * 16 + ic];
+        }
+        float max_val = *std::max_element(ref.begin(), ref.end());
+        float sum = 0.0f;
+        for (auto &r : ref) {
+            r = std::exp(r - max_val);
+            sum += r;
+        }
+        for (size_t oc = 0; oc < 10; oc++)
+            ASSERT_NEAR(ref[oc] / sum, dst_data[n * 10 + oc], 1e-5f);
+    }
+}
+
+TEST_F(MKLDNNGraphOptimizationTests, TestFusePadAndConvolution) {
+    std::string model = R"V0G0N(
+<net name="PadConv" version="3" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="pad" type="Pad" precision="FP32" id="1">
+            <data pads_begin="0,0,1,0" pads_end="0,0,0,2" pad_mode="constant" pad_value="0"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>6</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="2">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="3" kernel-y="3" output="3" group="1"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>6</dim>
+                    <dim>7</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+            <weights offset="0" size="216"/>
+            <biases offset="216" size="12"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {228}, InferenceEngine::C });
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    for (auto &node : graph.getNodes()) {
+        ASSERT_NE("Pad", node->getTypeStr());
+    }
+
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, 2, 5, 5}, InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    // the input padded by one row on the top and two columns on the right
+    const float *src_data = src->buffer().as<const float *>();
+    const float *w = weights->buffer().as<const float *>();
+    const float *b = w + 54;
+    const float *dst_data = output->buffer().as<const float *>();
+    for (int oc = 0; oc < 3; oc++) {
+        for (int oh = 0; oh < 4; oh++) {
+            for (int ow = 0; ow < 5; ow++) {
+                float ref = b[oc];
+                for (int ic = 0; ic < 2; ic++) {
+                    for (int kh = 0; kh < 3; kh++) {
+                        for (int kw = 0; kw < 3; kw++) {
+                            const int ih = oh + kh - 1, iw = ow + kw;
+                            if (ih < 0 || ih >= 5 || iw >= 5)
+                                continue;
+                            ref += src_data[(ic * 5 + ih) * 5 + iw] * w[((oc * 2 + ic) * 3 + kh) * 3 + kw];
+                        }
+                    }
+                }
+                ASSERT_NEAR(ref, dst_data[(oc * 4 + oh) * 5 + ow], 1e-4f);
+            }
+        }
+    }
+}
+
 TEST_F(MKLDNNGraphOptimizationTests, DISABLED_TestNoCrashForFuseConvSumAndInput) {
     std::string model = R"V0G0N(
 <net name="AlexNet" version="2" batch="1">
@@ -438,3 +663,429 @@ TEST_F(MKLDNNGraphOptimizationTests, TestNoFuseCustomActivation) {
     }
     ASSERT_FALSE(fused);
 }
+
+TEST_F(MKLDNNGraphOptimizationTests, TestFuseTileAndConsumers) {
+    // the tile of the axis of size 1 is read in place by the two eltwise nodes and by the batch axes of the gemm
+    std::string model = R"V0G0N(
+<net name="TileConsumers" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="other1" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="other2" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="mat" type="Input" precision="FP32" id="3">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>6</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="tile" type="Tile" precision="FP32" id="4">
+            <data axis="1" tiles="3"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="5">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="prod" type="Eltwise" precision="FP32" id="6">
+            <elementwise_data operation="prod"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="gemm" type="GEMM" precision="FP32" id="7">
+            <data alpha="1" beta="0" transpose_a="false" transpose_b="false"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>6</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>6</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="4" to-port="0"/>
+        <edge from-layer="4" from-port="1" to-layer="5" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="5" to-port="1"/>
+        <edge from-layer="4" from-port="1" to-layer="6" to-port="0"/>
+        <edge from-layer="2" from-port="0" to-layer="6" to-port="1"/>
+        <edge from-layer="4" from-port="1" to-layer="7" to-port="0"/>
+        <edge from-layer="3" from-port="0" to-layer="7" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    for (auto &node : graph.getNodes()) {
+        ASSERT_NE(MKLDNNPlugin::Tile, node->getType());
+    }
+
+    InferenceEngine::BlobMap srcs;
+    std::map<std::string, InferenceEngine::Blob::Ptr> inputs;
+    for (const auto& input : net_reader.getNetwork().getInputsInfo()) {
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(input.second->getTensorDesc());
+        src->allocate();
+        fill_data_sine(src->buffer(), src->size(), 0.5f, 1.0f, 0.3f + 0.1f * inputs.size());
+        inputs[input.first] = src;
+        srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>(input.first, src));
+    }
+
+    InferenceEngine::BlobMap outputBlobs;
+    for (const auto& item : net_reader.getNetwork().getOutputsInfo()) {
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        outputBlobs[item.first] = output;
+    }
+    ASSERT_EQ(3u, outputBlobs.size());
+
+    graph.Infer(srcs, outputBlobs);
+
+    const float *data = inputs["data"]->buffer().as<const float *>();
+    const float *other1 = inputs["other1"]->buffer().as<const float *>();
+    const float *other2 = inputs["other2"]->buffer().as<const float *>();
+    const float *mat = inputs["mat"]->buffer().as<const float *>();
+    const float *sum = outputBlobs["sum"]->buffer().as<const float *>();
+    const float *prod = outputBlobs["prod"]->buffer().as<const float *>();
+    const float *gemm = outputBlobs["gemm"]->buffer().as<const float *>();
+    for (size_t c = 0; c < 3; c++) {
+        for (size_t i = 0; i < 20; i++) {
+            ASSERT_NEAR(data[i] + other1[c * 20 + i], sum[c * 20 + i], 1e-5f);
+            ASSERT_NEAR(data[i] * other2[c * 20 + i], prod[c * 20 + i], 1e-5f);
+        }
+        for (size_t m = 0; m < 4; m++) {
+            for (size_t n = 0; n < 6; n++) {
+                float ref = 0.0f;
+                for (size_t k = 0; k < 5; k++)
+                    ref += data[m * 5 + k] * mat[(c * 5 + k) * 6 + n];
+                ASSERT_NEAR(ref, gemm[(c * 4 + m) * 6 + n], 1e-5f);
+            }
+        }
+    }
+}
+
+TEST_F(MKLDNNGraphOptimizationTests, TestFuseBroadcastOfMultiOutputParent) {
+    // the broadcast reads the second output of the split, so both of its consumers must be connected to that port
+    // after the broadcast is dropped
+    std::string model = R"V0G0N(
+<net name="BroadcastOfSplit" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="other" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="shape" type="Const" precision="I32" id="2">
+            <output>
+                <port id="0">
+                    <dim>4</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="0" size="16"/>
+            </blobs>
+        </layer>
+        <layer name="split" type="Split" precision="FP32" id="3">
+            <split_data axis="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scale" type="Power" precision="FP32" id="4">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="broadcast" type="Broadcast" precision="FP32" id="5">
+            <data/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+                <port id="1">
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="6">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="prod" type="Eltwise" precision="FP32" id="7">
+            <elementwise_data operation="prod"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="3" from-port="1" to-layer="4" to-port="0"/>
+        <edge from-layer="3" from-port="2" to-layer="5" to-port="0"/>
+        <edge from-layer="2" from-port="0" to-layer="5" to-port="1"/>
+        <edge from-layer="5" from-port="2" to-layer="6" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="6" to-port="1"/>
+        <edge from-layer="5" from-port="2" to-layer="7" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="7" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {16}, InferenceEngine::C });
+    weights->allocate();
+    int32_t *shape = weights->buffer().as<int32_t *>();
+    shape[0] = 1;
+    shape[1] = 3;
+    shape[2] = 4;
+    shape[3] = 5;
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    for (auto &node : graph.getNodes()) {
+        ASSERT_FALSE(node->getType() == MKLDNNPlugin::Generic && node->getTypeStr() == "Broadcast");
+    }
+
+    InferenceEngine::BlobMap srcs;
+    std::map<std::string, InferenceEngine::Blob::Ptr> inputs;
+    for (const auto& input : net_reader.getNetwork().getInputsInfo()) {
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(input.second->getTensorDesc());
+        src->allocate();
+        fill_data_sine(src->buffer(), src->size(), 0.5f, 1.0f, 0.3f + 0.1f * inputs.size());
+        inputs[input.first] = src;
+        srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>(input.first, src));
+    }
+
+    InferenceEngine::BlobMap outputBlobs;
+    for (const auto& item : net_reader.getNetwork().getOutputsInfo()) {
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        outputBlobs[item.first] = output;
+    }
+    ASSERT_EQ(3u, outputBlobs.size());
+
+    graph.Infer(srcs, outputBlobs);
+
+    const float *data = inputs["data"]->buffer().as<const float *>();
+    const float *other = inputs["other"]->buffer().as<const float *>();
+    const float *scale = outputBlobs["scale"]->buffer().as<const float *>();
+    const float *sum = outputBlobs["sum"]->buffer().as<const float *>();
+    const float *prod = outputBlobs["prod"]->buffer().as<const float *>();
+    for (size_t i = 0; i < 20; i++)
+        ASSERT_NEAR(2.0f * data[i], scale[i], 1e-5f);
+    for (size_t c = 0; c < 3; c++) {
+        for (size_t i = 0; i < 20; i++) {
+            ASSERT_NEAR(data[20 + i] + other[c * 20 + i], sum[c * 20 + i], 1e-5f);
+            ASSERT_NEAR(data[20 + i] * other[c * 20 + i], prod[c * 20 + i], 1e-5f);
+        }
+    }
+}
@@ -4,11 +4,14 @@
 
 #include <gtest/gtest.h>
 #include "mkldnn_exec_network.h"
+#include "mkldnn_primitive_cache.h"
 
 #include <mkldnn_extension_utils.h>
 #include "tests_common.hpp"
 #include "../test_graph.hpp"
 #include <ie_ir_reader.hpp>
+#include <cpu/cpu_config.hpp>
+#include <thread>
 
 // to fix compilation in Debug mode
 IE_SUPPRESS_DEPRECATED_START
@@ -6819,3 +6822,1469 @@ TEST_F(MKLDNNGraphStructureTests, TestConcatWithFourInputs) {
 
     IE_SUPPRESS_DEPRECATED_END
 }
+
+TEST_F(MKLDNNGraphStructureTests, TestParallelBranchesGiveSameResult) {
+    std::string model = R"V0G0N(
+<?xml version="1.0" ?>
+<net batch="1" name="model" version="2">
+	<layers>
+		<layer id="0" name="data" precision="FP32" type="Input">
+			<output>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="1" name="branch1_1" precision="FP32" type="Power">
+			<power_data power="1" scale="2" shift="1"/>
+			<input>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</input>
+			<output>
+				<port id="1">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="2" name="branch1_2" precision="FP32" type="Power">
+			<power_data power="1" scale="-1" shift="0"/>
+			<input>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</input>
+			<output>
+				<port id="1">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="3" name="branch2_1" precision="FP32" type="Power">
+			<power_data power="1" scale="0.5" shift="-1"/>
+			<input>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</input>
+			<output>
+				<port id="1">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="4" name="branch2_2" precision="FP32" type="Power">
+			<power_data power="1" scale="3" shift="0.5"/>
+			<input>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</input>
+			<output>
+				<port id="1">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="5" name="sum" precision="FP32" type="Eltwise">
+			<elementwise_data operation="sum"/>
+			<input>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+				<port id="1">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</input>
+			<output>
+				<port id="2">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</output>
+		</layer>
+	</layers>
+	<edges>
+		<edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+		<edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+		<edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+		<edge from-layer="3" from-port="1" to-layer="4" to-port="0"/>
+		<edge from-layer="2" from-port="1" to-layer="5" to-port="0"/>
+		<edge from-layer="4" from-port="1" to-layer="5" to-port="1"/>
+	</edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = src;
+
+    auto infer = [&](bool parallelBranches) {
+        MKLDNNGraphTestClass graph;
+        graph.setProperty({{InferenceEngine::CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES,
+                            parallelBranches ? InferenceEngine::PluginConfigParams::YES
+                                             : InferenceEngine::PluginConfigParams::NO}});
+        graph.CreateGraph(net_reader.getNetwork());
+
+        InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+        std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+
+        InferenceEngine::BlobMap outputBlobs;
+        outputBlobs[item.first] = output;
+        // run twice to make sure reused memory doesn't corrupt results of the next inference
+        graph.Infer(srcs, outputBlobs);
+        graph.Infer(srcs, outputBlobs);
+        return output;
+    };
+
+    auto reference = infer(false);
+    auto output = infer(true);
+
+    compare(*output, *reference);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestZeroCopyPortsMatchUserBlobLayout) {
+    std::string model = R"V0G0N(
+<net name="ZeroCopy" version="2" batch="1">
+	<layers>
+		<layer id="0" name="data" precision="FP32" type="Input">
+			<output>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="1" name="power" precision="FP32" type="Power">
+			<power_data power="1" scale="2" shift="0"/>
+			<input>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</input>
+			<output>
+				<port id="1">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</output>
+		</layer>
+	</layers>
+	<edges>
+		<edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+	</edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), {}, {}));
+    InferenceEngine::InputsDataMap _networkInputs = net_reader.getNetwork().getInputsInfo();
+    InferenceEngine::OutputsDataMap _networkOutputs = net_reader.getNetwork().getOutputsInfo();
+    execNetwork->setNetworkInputs(_networkInputs);
+    execNetwork->setNetworkOutputs(_networkOutputs);
+    InferenceEngine::IInferRequest::Ptr inferRequest;
+    execNetwork->CreateInferRequest(inferRequest);
+
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(
+            _networkOutputs["power"]->getTensorDesc());
+    output->allocate();
+
+    InferenceEngine::ResponseDesc resp;
+    InferenceEngine::StatusCode sts = inferRequest->SetBlob("power", output, &resp);
+    ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+
+    auto getZeroCopyPorts = [&]() {
+        InferenceEngine::Parameter result;
+        execNetwork->GetMetric(CPU_METRIC(ZERO_COPY_PORTS), result, &resp);
+        return result.as<std::vector<std::string>>();
+    };
+
+    // the blob has the same layout as the network input, so both ports work on the user memory
+    InferenceEngine::TensorDesc nchwDesc(InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr nchwSrc = InferenceEngine::make_shared_blob<float>(nchwDesc);
+    nchwSrc->allocate();
+    fill_data(nchwSrc->buffer(), nchwSrc->size());
+
+    sts = inferRequest->SetBlob("data", nchwSrc, &resp);
+    ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+    sts = inferRequest->Infer(&resp);
+    ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+
+    ASSERT_EQ(std::vector<std::string>({"data", "power"}), getZeroCopyPorts());
+    const float* src = nchwSrc->cbuffer().as<const float*>();
+    for (size_t i = 0; i < output->size(); i++) {
+        ASSERT_FLOAT_EQ(2.f * src[i], output->data()[i]);
+    }
+
+    // the blob in another layout has to be reordered into the internal tensor
+    InferenceEngine::TensorDesc nhwcDesc(InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NHWC);
+    InferenceEngine::Blob::Ptr nhwcSrc = InferenceEngine::make_shared_blob<float>(nhwcDesc);
+    nhwcSrc->allocate();
+    fill_data(nhwcSrc->buffer(), nhwcSrc->size());
+
+    sts = inferRequest->SetBlob("data", nhwcSrc, &resp);
+    ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+    sts = inferRequest->Infer(&resp);
+    ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+
+    ASSERT_EQ(std::vector<std::string>({"power"}), getZeroCopyPorts());
+    src = nhwcSrc->cbuffer().as<const float*>();
+    for (size_t c = 0; c < 3; c++) {
+        for (size_t hw = 0; hw < 16; hw++) {
+            ASSERT_FLOAT_EQ(2.f * src[hw * 3 + c], output->data()[c * 16 + hw]);
+        }
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestDynamicShapesInferNewInputDims) {
+    std::string model = R"V0G0N(
+<net name="DynamicShapes" version="2" batch="1">
+	<layers>
+		<layer id="0" name="data" precision="FP32" type="Input">
+			<output>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="1" name="power" precision="FP32" type="Power">
+			<power_data power="1" scale="2" shift="1"/>
+			<input>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</input>
+			<output>
+				<port id="1">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>4</dim>
+					<dim>4</dim>
+				</port>
+			</output>
+		</layer>
+	</layers>
+	<edges>
+		<edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+	</edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    MKLDNNPlugin::Config config;
+    config.readProperties({{InferenceEngine::CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES, InferenceEngine::PluginConfigParams::YES}});
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), config, {}));
+    InferenceEngine::InputsDataMap _networkInputs = net_reader.getNetwork().getInputsInfo();
+    InferenceEngine::OutputsDataMap _networkOutputs = net_reader.getNetwork().getOutputsInfo();
+    execNetwork->setNetworkInputs(_networkInputs);
+    execNetwork->setNetworkOutputs(_networkOutputs);
+    InferenceEngine::IInferRequest::Ptr inferRequest;
+    execNetwork->CreateInferRequest(inferRequest);
+
+    InferenceEngine::ResponseDesc resp;
+    for (size_t size : {8, 4, 6, 8}) {
+        InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, size, size}, InferenceEngine::NCHW);
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+        src->allocate();
+        fill_data(src->buffer(), src->size());
+
+        InferenceEngine::StatusCode sts = inferRequest->SetBlob("data", src, &resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+        sts = inferRequest->Infer(&resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+
+        InferenceEngine::Blob::Ptr output;
+        sts = inferRequest->GetBlob("power", output, &resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+        ASSERT_EQ(desc.getDims(), output->getTensorDesc().getDims());
+
+        const float* srcData = src->cbuffer().as<const float*>();
+        const float* dstData = output->cbuffer().as<const float*>();
+        for (size_t i = 0; i < output->size(); i++) {
+            ASSERT_FLOAT_EQ(2.f * srcData[i] + 1.f, dstData[i]);
+        }
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestPrimitivesAreReusedAfterNetworkIsDestroyed) {
+    std::string model = R"V0G0N(
+<net name="PrimitiveCache" version="2" batch="1">
+	<layers>
+		<layer id="0" name="data" precision="FP32" type="Input">
+			<output>
+				<port id="0">
+					<dim>1</dim>
+					<dim>8</dim>
+					<dim>16</dim>
+					<dim>16</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="1" name="pool" precision="FP32" type="Pooling">
+			<pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="2" stride-y="2" rounding-type="ceil" pool-method="max"/>
+			<input>
+				<port id="0">
+					<dim>1</dim>
+					<dim>8</dim>
+					<dim>16</dim>
+					<dim>16</dim>
+				</port>
+			</input>
+			<output>
+				<port id="1">
+					<dim>1</dim>
+					<dim>8</dim>
+					<dim>8</dim>
+					<dim>8</dim>
+				</port>
+			</output>
+		</layer>
+	</layers>
+	<edges>
+		<edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+	</edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 8, 16, 16}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    auto infer = [&]() {
+        MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), {}, {}));
+        InferenceEngine::InputsDataMap _networkInputs = net_reader.getNetwork().getInputsInfo();
+        InferenceEngine::OutputsDataMap _networkOutputs = net_reader.getNetwork().getOutputsInfo();
+        execNetwork->setNetworkInputs(_networkInputs);
+        execNetwork->setNetworkOutputs(_networkOutputs);
+        InferenceEngine::IInferRequest::Ptr inferRequest;
+        execNetwork->CreateInferRequest(inferRequest);
+
+        InferenceEngine::ResponseDesc resp;
+        InferenceEngine::StatusCode sts = inferRequest->SetBlob("data", src, &resp);
+        EXPECT_EQ(InferenceEngine::OK, sts) << resp.msg;
+        sts = inferRequest->Infer(&resp);
+        EXPECT_EQ(InferenceEngine::OK, sts) << resp.msg;
+
+        InferenceEngine::Blob::Ptr output;
+        sts = inferRequest->GetBlob("pool", output, &resp);
+        EXPECT_EQ(InferenceEngine::OK, sts) << resp.msg;
+        const float* data = output->cbuffer().as<const float*>();
+        return std::vector<float>(data, data + output->size());
+    };
+
+    auto cache = MKLDNNPlugin::MKLDNNPrimitiveCache::getInstance();
+    std::vector<float> first = infer();
+    uint64_t hits = cache->getHits();
+    std::vector<float> second = infer();
+
+    ASSERT_LT(hits, cache->getHits());
+    ASSERT_EQ(first, second);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestEltwiseChainFusing) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data0" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="data1" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="data2" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="mul" type="Eltwise" precision="FP32" id="3">
+            <data operation="prod"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sigmoid" type="Logistic" precision="FP32" id="4">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="swish" type="Eltwise" precision="FP32" id="5">
+            <data operation="prod"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="add" type="Eltwise" precision="FP32" id="6">
+            <data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="7">
+            <data power="1" scale="0.5" shift="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="3" from-port="2" to-layer="4" to-port="0"/>
+        <edge from-layer="3" from-port="2" to-layer="5" to-port="0"/>
+        <edge from-layer="4" from-port="1" to-layer="5" to-port="1"/>
+        <edge from-layer="5" from-port="2" to-layer="6" to-port="0"/>
+        <edge from-layer="2" from-port="0" to-layer="6" to-port="1"/>
+        <edge from-layer="6" from-port="2" to-layer="7" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    net_reader.ReadNetwork(model.data(), model.length());
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    // Swish and the following operations with a broadcasted input are fused into the first eltwise
+    size_t eltwiseNodes = 0;
+    for (const auto& node : graph.getNodes()) {
+        ASSERT_NE(node->getType(), MKLDNNPlugin::Type::Activation);
+        ASSERT_NE(node->getType(), MKLDNNPlugin::Type::Power);
+        if (node->getType() == MKLDNNPlugin::Type::Eltwise) {
+            eltwiseNodes++;
+            ASSERT_EQ(4, node->getFusedWith().size());
+            ASSERT_TRUE(node->isFusedWith(MKLDNNPlugin::Type::Activation));
+            ASSERT_TRUE(node->isFusedWith(MKLDNNPlugin::Type::Eltwise));
+            ASSERT_TRUE(node->isFusedWith(MKLDNNPlugin::Type::Power));
+        }
+    }
+    ASSERT_EQ(1, eltwiseNodes);
+
+    InferenceEngine::BlobMap srcs;
+    std::vector<InferenceEngine::Blob::Ptr> inputs;
+    std::vector<std::vector<size_t>> inputDims = {{1, 16, 8, 8}, {1, 16, 8, 8}, {1, 16, 1, 1}};
+    for (size_t i = 0; i < inputDims.size(); i++) {
+        InferenceEngine::TensorDesc src_desc(InferenceEngine::Precision::FP32, inputDims[i], InferenceEngine::NCHW);
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(src_desc);
+        src->allocate();
+        float* sdata = src->buffer().as<float *>();
+        for (size_t j = 0; j < src->size(); j++) {
+            sdata[j] = static_cast<float>(static_cast<int>((j + i) % (7 + i)) - 3) * 0.25f;
+        }
+        inputs.push_back(src);
+        srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data" + std::to_string(i), src));
+    }
+
+    const float* src0 = inputs[0]->buffer().as<const float *>();
+    const float* src1 = inputs[1]->buffer().as<const float *>();
+    const float* src2 = inputs[2]->buffer().as<const float *>();
+    std::vector<float> refDst(inputs[0]->size());
+    for (size_t i = 0; i < refDst.size(); i++) {
+        float mul = src0[i] * src1[i];
+        float swish = mul / (1.0f + std::exp(-mul));
+        refDst[i] = 0.5f * (swish + src2[i / 64]) + 1.0f;
+    }
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+
+    InferenceEngine::BlobMap outputBlobs;
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::TBlob<float>::Ptr output;
+    output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float>::Ptr dstOut = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc(), refDst.data());
+
+    compare(*output, *dstOut);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestMultiHeadAttentionFusing) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="query" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>5</dim>
+                    <dim>2</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="key" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>5</dim>
+                    <dim>2</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="value" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>5</dim>
+                    <dim>2</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="mask" type="Input" precision="FP32" id="3">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="query_permute" type="Permute" precision="FP32" id="4">
+            <data order="0,2,1,3"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>5</dim>
+                    <dim>2</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="key_permute" type="Permute" precision="FP32" id="5">
+            <data order="0,2,3,1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>5</dim>
+                    <dim>2</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>8</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scores" type="Gemm" precision="FP32" id="6">
+            <data alpha="1" beta="1" transpose_a="0" transpose_b="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>8</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scale" type="Power" precision="FP32" id="7">
+            <data power="1" scale="0.35" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="masked" type="Eltwise" precision="FP32" id="8">
+            <data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="probs" type="SoftMax" precision="FP32" id="9">
+            <data axis="3"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="value_permute" type="Permute" precision="FP32" id="10">
+            <data order="0,2,1,3"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>5</dim>
+                    <dim>2</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="context" type="Gemm" precision="FP32" id="11">
+            <data alpha="1" beta="1" transpose_a="0" transpose_b="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="context_permute" type="Permute" precision="FP32" id="12">
+            <data order="0,2,1,3"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>5</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>5</dim>
+                    <dim>2</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="4" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="5" to-port="0"/>
+        <edge from-layer="4" from-port="1" to-layer="6" to-port="0"/>
+        <edge from-layer="5" from-port="1" to-layer="6" to-port="1"/>
+        <edge from-layer="6" from-port="2" to-layer="7" to-port="0"/>
+        <edge from-layer="7" from-port="1" to-layer="8" to-port="0"/>
+        <edge from-layer="3" from-port="0" to-layer="8" to-port="1"/>
+        <edge from-layer="8" from-port="2" to-layer="9" to-port="0"/>
+        <edge from-layer="2" from-port="0" to-layer="10" to-port="0"/>
+        <edge from-layer="9" from-port="1" to-layer="11" to-port="0"/>
+        <edge from-layer="10" from-port="1" to-layer="11" to-port="1"/>
+        <edge from-layer="11" from-port="2" to-layer="12" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    net_reader.ReadNetwork(model.data(), model.length());
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    size_t attentionNodes = 0;
+    for (const auto& node : graph.getNodes()) {
+        ASSERT_NE(node->getType(), MKLDNNPlugin::Type::Permute);
+        ASSERT_NE(node->getType(), MKLDNNPlugin::Type::Gemm);
+        ASSERT_NE(node->getType(), MKLDNNPlugin::Type::SoftMax);
+        if (node->getType() == MKLDNNPlugin::Type::MultiHeadAttention)
+            attentionNodes++;
+    }
+    ASSERT_EQ(1, attentionNodes);
+
+    const size_t B = 1, S = 5, H = 2, D = 8;
+    InferenceEngine::BlobMap srcs;
+    std::vector<InferenceEngine::Blob::Ptr> inputs;
+    std::vector<std::string> inputNames = {"query", "key", "value", "mask"};
+    for (size_t i = 0; i < inputNames.size(); i++) {
+        InferenceEngine::SizeVector dims = i == 3 ? InferenceEngine::SizeVector{B, 1, 1, S}
+                                                  : InferenceEngine::SizeVector{B, S, H, D};
+        InferenceEngine::TensorDesc src_desc(InferenceEngine::Precision::FP32, dims, InferenceEngine::NCHW);
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(src_desc);
+        src->allocate();
+        float* sdata = src->buffer().as<float *>();
+        for (size_t j = 0; j < src->size(); j++) {
+            sdata[j] = i == 3 ? (j == S - 1 ? -10000.0f : 0.0f)
+                              : static_cast<float>(static_cast<int>((j * (i + 3)) % 11) - 5) * 0.2f;
+        }
+        inputs.push_back(src);
+        srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>(inputNames[i], src));
+    }
+
+    const float* query = inputs[0]->buffer().as<const float *>();
+    const float* key = inputs[1]->buffer().as<const float *>();
+    const float* value = inputs[2]->buffer().as<const float *>();
+    const float* mask = inputs[3]->buffer().as<const float *>();
+    std::vector<float> refDst(B * S * H * D);
+    for (size_t h = 0; h < H; h++) {
+        for (size_t i = 0; i < S; i++) {
+            std::vector<float> scores(S);
+            float max = -std::numeric_limits<float>::infinity();
+            for (size_t j = 0; j < S; j++) {
+                float dot = 0.0f;
+                for (size_t d = 0; d < D; d++)
+                    dot += query[(i * H + h) * D + d] * key[(j * H + h) * D + d];
+                scores[j] = 0.35f * dot + mask[j];
+                max = std::max(max, scores[j]);
+            }
+            float sum = 0.0f;
+            for (size_t j = 0; j < S; j++) {
+                scores[j] = std::exp(scores[j] - max);
+                sum += scores[j];
+            }
+            for (size_t d = 0; d < D; d++) {
+                float acc = 0.0f;
+                for (size_t j = 0; j < S; j++)
+                    acc += scores[j] / sum * value[(j * H + h) * D + d];
+                refDst[(i * H + h) * D + d] = acc;
+            }
+        }
+    }
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+
+    InferenceEngine::BlobMap outputBlobs;
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::TBlob<float>::Ptr output;
+    output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float>::Ptr dstOut = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc(), refDst.data());
+
+    compare(*output, *dstOut);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestLayoutAssignmentEliminatesReorders) {
+    // the greedy selection keeps the sum in the planar layout of the inputs, so each of the convolutions needs its own
+    // reorder to the blocked one, while the global assignment moves the sum to the blocked layout for two reorders of the inputs
+    std::string model = R"V0G0N(
+<net name="LayoutAssignment" version="2" batch="1">
+    <layers>
+        <layer name="data1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="data2" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="2">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="3">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="16" group="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="9216"/>
+            <biases offset="9216" size="64"/>
+        </layer>
+        <layer name="pool1" type="Pooling" precision="FP32" id="4">
+            <pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="2" stride-y="2" rounding-type="ceil" pool-method="max"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv2" type="Convolution" precision="FP32" id="5">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="16" group="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="9280" size="9216"/>
+            <biases offset="18496" size="64"/>
+        </layer>
+        <layer name="pool2" type="Pooling" precision="FP32" id="6">
+            <pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="2" stride-y="2" rounding-type="ceil" pool-method="max"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv3" type="Convolution" precision="FP32" id="7">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="16" group="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="18560" size="9216"/>
+            <biases offset="27776" size="64"/>
+        </layer>
+        <layer name="pool3" type="Pooling" precision="FP32" id="8">
+            <pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="2" stride-y="2" rounding-type="ceil" pool-method="max"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="concat" type="Concat" precision="FP32" id="9">
+            <concat_data axis="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>48</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+        <edge from-layer="3" from-port="1" to-layer="4" to-port="0"/>
+        <edge from-layer="4" from-port="1" to-layer="9" to-port="0"/>
+        <edge from-layer="2" from-port="2" to-layer="5" to-port="0"/>
+        <edge from-layer="5" from-port="1" to-layer="6" to-port="0"/>
+        <edge from-layer="6" from-port="1" to-layer="9" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="7" to-port="0"/>
+        <edge from-layer="7" from-port="1" to-layer="8" to-port="0"/>
+        <edge from-layer="8" from-port="1" to-layer="9" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {27840}, InferenceEngine::C });
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+    net_reader.SetWeights(weights_ptr);
+
+    InferenceEngine::BlobMap srcs;
+    for (const auto& name : {"data1", "data2"}) {
+        InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 16, 8, 8}, InferenceEngine::NCHW);
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+        src->allocate();
+        fill_data(src->buffer(), src->size());
+        srcs[name] = src;
+    }
+
+    auto infer = [&](bool layoutAssignment, size_t& eliminated, size_t& reorders) {
+        MKLDNNGraphTestClass graph;
+        graph.setProperty({{InferenceEngine::CPUConfigParams::KEY_CPU_LAYOUT_ASSIGNMENT,
+                            layoutAssignment ? InferenceEngine::PluginConfigParams::YES
+                                             : InferenceEngine::PluginConfigParams::NO}});
+        graph.CreateGraph(net_reader.getNetwork());
+
+        eliminated = graph.GetEliminatedReorders();
+        reorders = 0;
+        for (const auto& node : graph.getNodes()) {
+            if (node->getType() == MKLDNNPlugin::Type::Reorder)
+                reorders++;
+        }
+
+        InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+        std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+
+        InferenceEngine::BlobMap outputBlobs;
+        outputBlobs[item.first] = output;
+        graph.Infer(srcs, outputBlobs);
+        return output;
+    };
+
+    size_t referenceEliminated = 0, referenceReorders = 0;
+    auto reference = infer(false, referenceEliminated, referenceReorders);
+    size_t eliminated = 0, reorders = 0;
+    auto output = infer(true, eliminated, reorders);
+
+    ASSERT_EQ(0u, referenceEliminated);
+    ASSERT_GT(eliminated, 0u);
+    ASSERT_LT(reorders, referenceReorders);
+
+    compare(*output, *reference);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestConcurrentLoadWithSharedWeights) {
+    // the convolutions of a level are created in parallel, the first three of them and the ones of the other graphs
+    // reorder the same weights into the shared cache at the same time
+    std::string model = R"V0G0N(
+<net name="ConcurrentLoad" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="8" group="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="2304"/>
+            <biases offset="2304" size="32"/>
+        </layer>
+        <layer name="conv2" type="Convolution" precision="FP32" id="2">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="8" group="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="2304"/>
+            <biases offset="2304" size="32"/>
+        </layer>
+        <layer name="conv3" type="Convolution" precision="FP32" id="3">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="8" group="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="2304"/>
+            <biases offset="2304" size="32"/>
+        </layer>
+        <layer name="conv4" type="Convolution" precision="FP32" id="4">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="8" group="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="2336" size="2304"/>
+            <biases offset="4640" size="32"/>
+        </layer>
+        <layer name="concat" type="Concat" precision="FP32" id="5">
+            <concat_data axis="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>32</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="5" to-port="0"/>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="2" from-port="1" to-layer="5" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="3" from-port="1" to-layer="5" to-port="2"/>
+        <edge from-layer="0" from-port="0" to-layer="4" to-port="0"/>
+        <edge from-layer="4" from-port="1" to-layer="5" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {4672}, InferenceEngine::C });
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+    net_reader.SetWeights(weights_ptr);
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 8, 8, 8}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = src;
+
+    auto infer = [&]() {
+        MKLDNNGraphTestClass graph;
+        graph.CreateGraph(net_reader.getNetwork());
+
+        InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+        std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+
+        InferenceEngine::BlobMap outputBlobs;
+        outputBlobs[item.first] = output;
+        graph.Infer(srcs, outputBlobs);
+        const float* data = output->cbuffer().as<const float*>();
+        return std::vector<float>(data, data + output->size());
+    };
+
+    // the reference graph is destroyed before the others are loaded, so they don't find its weights in the cache
+    const std::vector<float> reference = infer();
+
+    const size_t threadsNum = 4;
+    std::vector<std::vector<float>> outputs(threadsNum);
+    std::vector<std::string> errors(threadsNum);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadsNum; t++) {
+        threads.emplace_back([&, t]() {
+            try {
+                outputs[t] = infer();
+            } catch (const std::exception& e) {
+                errors[t] = e.what();
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    for (size_t t = 0; t < threadsNum; t++) {
+        ASSERT_EQ("", errors[t]) << "thread " << t;
+        ASSERT_EQ(reference, outputs[t]) << "thread " << t;
+    }
+}
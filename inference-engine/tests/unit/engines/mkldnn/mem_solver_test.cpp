@@ -253,3 +253,121 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, BestFitStrategy) {
+
+    int n = 0;
+    std::vector<Box> boxes{
+            {1, 2, 11, n++},
+            {6, 7, 4, n++},
+            {1, 7, 10, n++},
+            {7, 8, 5, n++},
+            {3, 7, 3, n++},
+            {1, 8, 7, n++},
+            {0, 3, 9, n++},
+    };
+
+    MemorySolver ms(boxes);
+    EXPECT_EQ(ms.solve(MemorySolver::Strategy::FirstFit), 40);
+    EXPECT_EQ(ms.solve(MemorySolver::Strategy::BestFit), 37);
+    EXPECT_EQ(ms.solve(MemorySolver::Strategy::Auto), 37);
+
+    auto no_overlap = [&](Box box1, Box box2) -> bool {
+        int off1 = ms.getOffset(box1.id);
+        int off2 = ms.getOffset(box2.id);
+        return box1.finish < box2.start || box1.start > box2.finish ||
+               off1 + box1.size <= off2 || off1 >= off2 + box2.size;
+    };
+
+    for (int i = 0; i < n; i++)
+        for (int j = i+1; j < n; j++)
+            ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
+}
+
+TEST(MemSolverTest, Fragmentation) {
+    int n = 0;
+    std::vector<Box> boxes{   //  |
+            {n, ++n, 2},      //  |      ____
+            {n, ++n, 2},      //  |   __|____|__
+            {n, ++n, 2},      //  |__|____||____|__
+    };                        //      0  1  2  3
+
+    MemorySolver ms(boxes);
+    EXPECT_THROW(ms.fragmentation(), InferenceEngine::details::InferenceEngineException);
+    EXPECT_EQ(ms.solve(), ms.maxDepth());
+    EXPECT_DOUBLE_EQ(ms.fragmentation(), 0.);
+
+    std::vector<Box> boxes_with_hole{
+            {1, 2, 11},
+            {6, 7, 4},
+            {1, 7, 10},
+            {7, 8, 5},
+            {3, 7, 3},
+            {1, 8, 7},
+            {0, 3, 9},
+    };
+
+    MemorySolver ms_with_hole(boxes_with_hole);
+    int64_t size = ms_with_hole.solve();
+    EXPECT_GT(size, ms_with_hole.maxDepth());
+    EXPECT_DOUBLE_EQ(ms_with_hole.fragmentation(), 1. - static_cast<double>(ms_with_hole.maxDepth()) / size);
+}
+
+TEST(MemSolverTest, PartialOrderConcurrentBranches) {
+    //        1
+    //   0 <     > 3
+    //        2
+    std::vector<std::vector<int>> dependencies {{1, 2}, {3}, {3}, {}};
+
+    std::vector<Box> boxes {
+            {1, 1, 2, 0},   // scratch of node 1
+            {2, 2, 2, 1},   // scratch of node 2
+    };
+
+    // steps 1 and 2 may be executed at once, so boxes can't share memory
+    MemorySolver ms(boxes, dependencies);
+    EXPECT_EQ(ms.solve(), 4);
+    EXPECT_EQ(ms.maxDepth(), 2);
+    EXPECT_EQ(ms.maxTopDepth(), 1);
+
+    // in linear order they are executed one by one
+    MemorySolver ms_linear(boxes);
+    EXPECT_EQ(ms_linear.solve(), 2);
+}
+
+TEST(MemSolverTest, PartialOrderReuseAfterJoin) {
+    std::vector<std::vector<int>> dependencies {{1, 2}, {3}, {3}, {4}, {}};
+
+    std::vector<Box> boxes {
+            {0, 1, 2, 0},    // 0 -> 1
+            {0, 2, 2, 1},    // 0 -> 2
+            {1, 3, 1, 2},    // 1 -> 3
+            {2, 3, 1, 3},    // 2 -> 3
+            {3, 4, 4, 4},    // 3 -> 4
+    };
+
+    MemorySolver ms(boxes, dependencies);
+    EXPECT_EQ(ms.solve(), 6);
+    EXPECT_EQ(ms.maxDepth(), 6);
+    // the output of node 3 reuses memory of the inputs of nodes 1 and 2
+    EXPECT_LT(ms.getOffset(4), 4);
+}
+
+TEST(MemSolverTest, PartialOrderToEndBox) {
+    std::vector<std::vector<int>> dependencies {{1, 2}, {3}, {3}, {}};
+
+    std::vector<Box> boxes {
+            {1, -1, 2, 0},
+            {3, 3, 2, 1},
+    };
+
+    MemorySolver ms(boxes, dependencies);
+    EXPECT_EQ(ms.solve(), 4);
+}
+
+TEST(MemSolverTest, PartialOrderThrowsOnWrongDependencies) {
+    std::vector<Box> boxes {{0, 1, 2, 0}};
+
+    EXPECT_THROW(MemorySolver(boxes, {{1}, {0}}), InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(MemorySolver(boxes, {{}}), InferenceEngine::details::InferenceEngineException);
+}
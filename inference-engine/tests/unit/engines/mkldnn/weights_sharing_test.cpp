@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <mkldnn_plugin.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+uint64_t referenceCRC(const unsigned char* data, size_t size) {
+    uint64_t crc = 0;
+    for (size_t idx = 0; idx < size; idx++) {
+        crc ^= data[idx];
+        for (int j = 0; j < 8; j++)
+            crc = (crc & 1) ? (crc >> 1) ^ 0xc96c5795d7870f42 : (crc >> 1);
+    }
+    return ~crc;
+}
+
+Blob::Ptr createWeights(size_t size, float value) {
+    auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, {size}, Layout::C));
+    blob->allocate();
+    for (size_t i = 0; i < size; i++)
+        blob->buffer().as<float*>()[i] = value + i;
+    return blob;
+}
+
+}  // namespace
+
+TEST(MKLDNNWeightsSharingTests, hashMatchesBytewiseCRC) {
+    std::vector<unsigned char> data(77);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<unsigned char>(i * 37 + 11);
+
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    for (size_t size = 0; size <= data.size(); size++) {
+        ASSERT_EQ(referenceCRC(data.data(), size), hashFunc.hash(data.data(), size)) << "size: " << size;
+    }
+}
+
+TEST(MKLDNNWeightsSharingTests, keyDependsOnDataAndTargetLayout) {
+    auto weights = createWeights(16 * 16, 1.f);
+    auto sameWeights = createWeights(16 * 16, 1.f);
+    auto otherWeights = createWeights(16 * 16, 2.f);
+
+    MKLDNNMemoryDesc plain({16, 16, 1, 1}, mkldnn::memory::f32, mkldnn::memory::oihw);
+    MKLDNNMemoryDesc blocked({16, 16, 1, 1}, mkldnn::memory::f32, mkldnn::memory::OIhw8i8o);
+
+    EXPECT_EQ(MKLDNNWeightsSharing::GetKey(weights, plain), MKLDNNWeightsSharing::GetKey(sameWeights, plain));
+    EXPECT_NE(MKLDNNWeightsSharing::GetKey(weights, plain), MKLDNNWeightsSharing::GetKey(otherWeights, plain));
+    EXPECT_NE(MKLDNNWeightsSharing::GetKey(weights, plain), MKLDNNWeightsSharing::GetKey(weights, blocked));
+}
+
+TEST(MKLDNNWeightsSharingTests, keyDependsOnSourceLayout) {
+    auto weights = createWeights(16 * 16, 1.f);
+    // the same bytes seen as another tensor are reordered into other target data
+    auto reshaped = make_shared_blob<float>(TensorDesc(Precision::FP32, {16, 16, 1, 1}, Layout::NCHW),
+                                            weights->buffer().as<float*>());
+    auto transposed = make_shared_blob<float>(TensorDesc(Precision::FP32, {16, 16, 1, 1}, Layout::NHWC),
+                                              weights->buffer().as<float*>());
+
+    MKLDNNMemoryDesc plain({16, 16, 1, 1}, mkldnn::memory::f32, mkldnn::memory::oihw);
+
+    EXPECT_NE(MKLDNNWeightsSharing::GetKey(weights, plain), MKLDNNWeightsSharing::GetKey(reshaped, plain));
+    EXPECT_NE(MKLDNNWeightsSharing::GetKey(reshaped, plain), MKLDNNWeightsSharing::GetKey(transposed, plain));
+}
+
+TEST(MKLDNNWeightsSharingTests, findOrCreateSharesAliveEntries) {
+    MKLDNNWeightsSharing sharing;
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    int created = 0;
+    auto create = [&]() {
+        created++;
+        MKLDNNMemoryPtr memory(new MKLDNNMemory(eng));
+        memory->Create(MKLDNNMemoryDesc({16}, mkldnn::memory::f32, mkldnn::memory::x));
+        return memory;
+    };
+
+    auto first = sharing.findOrCreate("key", create);
+    auto second = sharing.findOrCreate("key", create);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1, created);
+
+    first.reset();
+    second.reset();
+    sharing.findOrCreate("key", create);
+    EXPECT_EQ(2, created);
+}
+
+TEST(MKLDNNWeightsSharingTests, findOrCreateReturnsOneEntryToRacingCallers) {
+    MKLDNNWeightsSharing sharing;
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    std::atomic<int> created(0);
+    auto create = [&]() {
+        created++;
+        MKLDNNMemoryPtr memory(new MKLDNNMemory(eng));
+        memory->Create(MKLDNNMemoryDesc({16}, mkldnn::memory::f32, mkldnn::memory::x));
+        return memory;
+    };
+
+    // the entries are created without the lock, so the racing callers may create their own copies,
+    // but all of them get the one which is stored
+    const size_t threadsNum = 8;
+    std::vector<MKLDNNMemoryPtr> results(threadsNum);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadsNum; t++) {
+        threads.emplace_back([&, t]() {
+            results[t] = sharing.findOrCreate("key", create);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_GE(created, 1);
+    for (const auto& result : results)
+        EXPECT_EQ(results[0], result);
+    EXPECT_EQ(results[0], sharing.findOrCreate("key", create));
+}
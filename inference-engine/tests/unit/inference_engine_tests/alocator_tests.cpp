@@ -5,7 +5,10 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
 
+#include <cstdint>
+
 #include "ie_allocator.hpp"
+#include "system_allocator.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -14,6 +17,8 @@ using namespace InferenceEngine;
 class SystemAllocatorTests: public ::testing::Test {
 protected:
     virtual void TearDown() {
+        details::SetSystemAllocatorPoolSize(0);
+        details::SetSystemAllocatorHugePages(false);
     }
 
     virtual void SetUp() {
@@ -44,3 +49,50 @@ TEST_F(SystemAllocatorTests, canLockAllocatedMemory) {
     allocator->unlock(ptr);
     allocator->free(handle);
 }
+
+TEST_F(SystemAllocatorTests, memoryIsAligned) {
+    for (size_t size : {1, 100, 5000, 3 * 1024 * 1024}) {
+        void* handle = allocator->alloc(size);
+        ASSERT_NE(nullptr, handle);
+        ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(handle) % SystemMemoryAllocator::alignment);
+        if (size >= SystemMemoryAllocator::largeBlockSize)
+            ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(handle) % 4096);
+        allocator->free(handle);
+    }
+}
+
+TEST_F(SystemAllocatorTests, freedBlocksAreReusedByPool) {
+    details::SetSystemAllocatorPoolSize(1024 * 1024);
+    void* handle = allocator->alloc(10000);
+    allocator->free(handle);
+    ASSERT_LT(0u, details::GetSystemAllocatorPooledBytes());
+
+    // the close size falls into the same size class
+    void* reused = allocator->alloc(9999);
+    ASSERT_EQ(handle, reused);
+    ASSERT_EQ(0u, details::GetSystemAllocatorPooledBytes());
+    allocator->free(reused);
+
+    details::SetSystemAllocatorPoolSize(0);
+    ASSERT_EQ(0u, details::GetSystemAllocatorPooledBytes());
+}
+
+TEST_F(SystemAllocatorTests, poolKeepsNoMoreThanItsSize) {
+    details::SetSystemAllocatorPoolSize(16 * 1024);
+    void* first = allocator->alloc(10000);
+    void* second = allocator->alloc(10000);
+    allocator->free(first);
+    allocator->free(second);
+    ASSERT_GE(16u * 1024, details::GetSystemAllocatorPooledBytes());
+}
+
+TEST_F(SystemAllocatorTests, canUseHugePages) {
+    details::SetSystemAllocatorHugePages(true);
+    const size_t size = 5 * 1024 * 1024;
+    char* ptr = static_cast<char*>(allocator->lock(allocator->alloc(size)));
+    ASSERT_NE(nullptr, ptr);
+    ptr[0] = 1;
+    ptr[size - 1] = 2;
+    ASSERT_EQ(2, ptr[size - 1]);
+    allocator->free(ptr);
+}
@@ -0,0 +1,244 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "tests_common.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpp/ie_cnn_net_reader.h>
+#include "details/ie_so_loader.h"
+#include "mock_iasync_infer_request.hpp"
+#include "mock_inference_engine.hpp"
+#include "mock_iexecutable_network.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+using namespace InferenceEngine::PluginConfigParams;
+
+IE_SUPPRESS_DEPRECATED_START
+
+class AutoBatchingTests : public TestsCommon {
+protected:
+    static std::string model(const std::string& outputLayer) {
+        return R"V0G0N(
+<net name="Batched" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+)V0G0N" + outputLayer + R"V0G0N(
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+    }
+
+    const std::string _relu = R"V0G0N(
+        <layer name="out" type="ReLU" precision="FP32" id="1">
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    // gathers the batch into the inner dimension, as DetectionOutput does
+    const std::string _flatten = R"V0G0N(
+        <layer name="out" type="Reshape" precision="FP32" id="1">
+            <data dim="1,1,-1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>48</dim>
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    void SetUp() override {
+        TestsCommon::SetUp();
+        sharedObjectLoader.reset(new SharedObjectLoader(get_mock_engine_name().c_str()));
+        auto inject = reinterpret_cast<void (*)(IInferencePlugin*)>(sharedObjectLoader->get_symbol("InjectProxyEngine"));
+        inject(&engine);
+
+        version.apiVersion = {2, 1};
+        version.buildNumber = "auto_batching_test";
+        version.description = "mock";
+        ON_CALL(engine, GetVersion(_)).WillByDefault(SetArgReferee<0>(&version));
+
+        executableNetwork = std::make_shared<NiceMock<MockIExecutableNetwork>>();
+        ON_CALL(*executableNetwork, GetMetric(_, _, _)).WillByDefault(Return(NOT_IMPLEMENTED));
+        ON_CALL(*executableNetwork, CreateInferRequest(_, _)).WillByDefault(
+            DoAll(SetArgReferee<0>(createBatchedRequest()), Return(OK)));
+        ON_CALL(engine, LoadNetwork(_, _, _, _)).WillByDefault(DoAll(SetArgReferee<0>(executableNetwork), Return(OK)));
+
+        core.reset(new Core());
+        core->RegisterPlugin(std::string("mock_engine") + IE_BUILD_POSTFIX, "MOCK");
+    }
+
+    void TearDown() override {
+        core.reset();
+        for (auto&& thread : callbackThreads) {
+            if (thread.joinable()) thread.join();
+        }
+        TestsCommon::TearDown();
+    }
+
+    CNNNetwork readNetwork(const std::string& outputLayer) {
+        const auto xml = model(outputLayer);
+        CNNNetReader reader;
+        reader.ReadNetwork(xml.data(), xml.length());
+        return reader.getNetwork();
+    }
+
+    // completes every started batch from another thread a bit later, as an accelerator does
+    std::shared_ptr<MockIInferRequest> createBatchedRequest() {
+        batchedRequest = std::make_shared<NiceMock<MockIInferRequest>>();
+        auto request = batchedRequest.get();
+        for (auto&& name : {"data", "out"}) {
+            auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, {2, 3, 4, 4}, Layout::NCHW));
+            blob->allocate();
+            batchedBlobs[name] = blob;
+        }
+        ON_CALL(*request, GetBlob(_, _, _)).WillByDefault(Invoke([this](const char* name, Blob::Ptr& blob,
+                                                                        ResponseDesc*) {
+            blob = batchedBlobs.at(name);
+            return OK;
+        }));
+        ON_CALL(*request, SetUserData(_, _)).WillByDefault(Invoke([this](void* data, ResponseDesc*) {
+            userData = data;
+            return OK;
+        }));
+        ON_CALL(*request, GetUserData(_, _)).WillByDefault(Invoke([this](void** data, ResponseDesc*) {
+            *data = userData;
+            return OK;
+        }));
+        ON_CALL(*request, SetCompletionCallback(_)).WillByDefault(Invoke([this](IInferRequest::CompletionCallback cb) {
+            callback = cb;
+            return OK;
+        }));
+        ON_CALL(*request, StartAsync(_)).WillByDefault(Invoke([this, request](ResponseDesc*) {
+            startedBatches++;
+            // the batch is the real output of the batched request
+            auto out = batchedBlobs.at("out")->buffer().as<float*>();
+            auto in = batchedBlobs.at("data")->cbuffer().as<const float*>();
+            std::copy(in, in + batchedBlobs.at("data")->size(), out);
+            callbackThreads.emplace_back([this, request] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                callback(IInferRequest::Ptr(request, [](IInferRequest*) {}), OK);
+                completedBatches++;
+            });
+            return OK;
+        }));
+        return batchedRequest;
+    }
+
+    std::unique_ptr<SharedObjectLoader> sharedObjectLoader;
+    NiceMock<MockInferenceEngine> engine;
+    Version version = {};
+    std::unique_ptr<Core> core;
+    std::shared_ptr<NiceMock<MockIExecutableNetwork>> executableNetwork;
+    std::shared_ptr<NiceMock<MockIInferRequest>> batchedRequest;
+    std::map<std::string, Blob::Ptr> batchedBlobs;
+    void* userData = nullptr;
+    IInferRequest::CompletionCallback callback = nullptr;
+    std::vector<std::thread> callbackThreads;
+    std::atomic<int> startedBatches{0};
+    std::atomic<int> completedBatches{0};
+};
+
+TEST_F(AutoBatchingTests, refusesOutputWithoutOuterBatch) {
+    EXPECT_CALL(engine, LoadNetwork(_, _, _, _)).Times(0);
+
+    ASSERT_THROW(core->LoadNetwork(readNetwork(_flatten), "MOCK", {{CONFIG_KEY(AUTO_BATCH_SIZE), "2"}}),
+                 InferenceEngineException);
+}
+
+TEST_F(AutoBatchingTests, loadsBatchedNetworkForOuterBatch) {
+    EXPECT_CALL(engine, LoadNetwork(_, _, _, _)).Times(1);
+
+    ASSERT_NO_THROW(core->LoadNetwork(readNetwork(_relu), "MOCK", {{CONFIG_KEY(AUTO_BATCH_SIZE), "2"}}));
+}
+
+TEST_F(AutoBatchingTests, copiesRequestsToAndFromTheirBatchPositions) {
+    auto network = core->LoadNetwork(readNetwork(_relu), "MOCK", {{CONFIG_KEY(AUTO_BATCH_SIZE), "2"},
+                                                                  {CONFIG_KEY(AUTO_BATCH_TIMEOUT), "1000"}});
+    std::vector<InferRequest> requests = {network.CreateInferRequest(), network.CreateInferRequest()};
+    for (std::size_t i = 0; i < requests.size(); i++) {
+        auto input = requests[i].GetBlob("data");
+        auto data = input->buffer().as<float*>();
+        for (std::size_t j = 0; j < input->size(); j++)
+            data[j] = static_cast<float>(i * 100 + j);
+    }
+
+    for (auto&& request : requests) request.StartAsync();
+    for (auto&& request : requests) ASSERT_EQ(OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+
+    ASSERT_EQ(1, startedBatches);
+    for (std::size_t i = 0; i < requests.size(); i++) {
+        auto output = requests[i].GetBlob("out");
+        auto data = output->cbuffer().as<const float*>();
+        for (std::size_t j = 0; j < output->size(); j++)
+            ASSERT_EQ(static_cast<float>(i * 100 + j), data[j]) << "request " << i << " element " << j;
+    }
+}
+
+TEST_F(AutoBatchingTests, drainsStartedBatchesOnDestruction) {
+    {
+        auto network = core->LoadNetwork(readNetwork(_relu), "MOCK", {{CONFIG_KEY(AUTO_BATCH_SIZE), "2"},
+                                                                      {CONFIG_KEY(AUTO_BATCH_TIMEOUT), "1"}});
+        auto request = network.CreateInferRequest();
+        request.StartAsync();
+        // the request and the network are released without waiting for the batch
+    }
+
+    ASSERT_EQ(1, startedBatches);
+    // the callback has stopped using the network before it was destroyed, only the counter is left
+    for (auto&& thread : callbackThreads) thread.join();
+    ASSERT_EQ(1, completedBatches);
+}
+
+IE_SUPPRESS_DEPRECATED_END
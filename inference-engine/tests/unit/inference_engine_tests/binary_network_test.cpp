@@ -0,0 +1,283 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <details/ie_cnn_network_tools.h>
+#include <ie_util_internal.hpp>
+#include "ie_binary_network.hpp"
+#include "tests_common.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class BinaryNetworkTests : public TestsCommon {
+protected:
+    std::string model = R"V0G0N(
+<net name="BinaryNetwork" version="6" precision="FP32" batch="1">
+    <layers>
+        <layer id="0" name="data" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="conv" precision="FP32" type="Convolution">
+            <data dilations="1,1" group="1" kernel="3,3" output="4" pads_begin="1,1" pads_end="1,1" strides="1,1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="432"/>
+            <biases offset="432" size="16"/>
+        </layer>
+        <layer id="2" name="relu" precision="FP32" type="ReLU">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    void SetUp() override {
+        TestsCommon::SetUp();
+        std::string plugins_path;
+#ifndef _WIN32
+        plugins_path = "lib/";
+#endif
+        plugins_path += "plugins.xml";
+        pluginsXml = testing::FileUtils::makePath(getIELibraryPath(), plugins_path);
+
+        auto weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {448}, Layout::C));
+        weights->allocate();
+        fill_data(weights->buffer().as<float*>(), weights->size() / sizeof(float));
+
+        Core ie(pluginsXml);
+        network = ie.ReadNetwork(model, weights);
+        auto& preProcess = network.getInputsInfo().begin()->second->getPreProcess();
+        preProcess.init(3);
+        for (size_t c = 0; c < 3; c++) {
+            preProcess[c]->meanValue = 0.5f * c;
+        }
+        preProcess.setVariant(MEAN_VALUE);
+        network.serialize(fileName);
+    }
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+        TestsCommon::TearDown();
+    }
+
+    std::vector<char> readFile() const {
+        std::ifstream file(fileName, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    void writeFile(const std::vector<char>& content) const {
+        std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+        file.write(content.data(), content.size());
+    }
+
+    // Walks the topology section written by NetworkSerializer::serializeBinary to the fields the tests corrupt
+    struct TopologyWalker {
+        std::vector<char>& content;
+        size_t pos;
+
+        template <typename T>
+        T& at(size_t offset) {
+            return *reinterpret_cast<T*>(&content[offset]);
+        }
+
+        uint32_t next() {
+            auto value = at<uint32_t>(pos);
+            pos += sizeof(uint32_t);
+            return value;
+        }
+
+        void skipString() {
+            pos += next();
+        }
+
+        // returns the position of the dimensions count of the desc
+        size_t skipDesc() {
+            pos += 2 * sizeof(int32_t);
+            size_t dimsPos = pos;
+            pos += next() * sizeof(uint64_t);
+            return dimsPos;
+        }
+    };
+
+    TopologyWalker walker(std::vector<char>& content) {
+        details::BinaryNetworkHeader header;
+        std::memcpy(&header, content.data(), sizeof(header));
+        TopologyWalker topology{content, static_cast<size_t>(header.topologyOffset)};
+        topology.skipString();
+        topology.pos += sizeof(int32_t);
+        return topology;
+    }
+
+    std::string fileName = "BinaryNetworkTests.ienb";
+    std::string pluginsXml;
+    CNNNetwork network;
+};
+
+TEST_F(BinaryNetworkTests, readsBackSerializedNetwork) {
+    ASSERT_TRUE(details::IsBinaryNetwork(fileName));
+
+    Core ie(pluginsXml);
+    CNNNetwork restored = ie.ReadNetwork(fileName);
+    ASSERT_EQ(network.getName(), restored.getName());
+
+    auto layers = details::CNNNetSortTopologically(network);
+    auto restoredLayers = details::CNNNetSortTopologically(restored);
+    ASSERT_EQ(layers.size(), restoredLayers.size());
+    for (size_t i = 0; i < layers.size(); i++) {
+        const auto& layer = layers[i];
+        const auto& restoredLayer = restoredLayers[i];
+        ASSERT_EQ(layer->name, restoredLayer->name);
+        ASSERT_EQ(layer->type, restoredLayer->type);
+        ASSERT_EQ(layer->precision, restoredLayer->precision);
+        ASSERT_EQ(layer->params, restoredLayer->params) << layer->name;
+        ASSERT_EQ(layer->outData.size(), restoredLayer->outData.size());
+        for (size_t o = 0; o < layer->outData.size(); o++) {
+            ASSERT_EQ(layer->outData[o]->getName(), restoredLayer->outData[o]->getName());
+            ASSERT_EQ(layer->outData[o]->getTensorDesc(), restoredLayer->outData[o]->getTensorDesc());
+        }
+
+        ASSERT_EQ(layer->blobs.size(), restoredLayer->blobs.size()) << layer->name;
+        for (const auto& blob : layer->blobs) {
+            ASSERT_EQ(1u, restoredLayer->blobs.count(blob.first)) << layer->name << " " << blob.first;
+            const auto& restoredBlob = restoredLayer->blobs[blob.first];
+            ASSERT_EQ(blob.second->getTensorDesc(), restoredBlob->getTensorDesc());
+            ASSERT_EQ(0, std::memcmp(blob.second->cbuffer().as<const void*>(), restoredBlob->cbuffer().as<const void*>(),
+                                     blob.second->byteSize())) << layer->name << " " << blob.first;
+        }
+    }
+
+    auto outputs = network.getOutputsInfo();
+    auto restoredOutputs = restored.getOutputsInfo();
+    ASSERT_EQ(outputs.size(), restoredOutputs.size());
+    for (const auto& output : outputs) {
+        ASSERT_EQ(1u, restoredOutputs.count(output.first));
+        ASSERT_EQ(output.second->getTensorDesc(), restoredOutputs[output.first]->getTensorDesc());
+    }
+
+    const auto& preProcess = restored.getInputsInfo().begin()->second->getPreProcess();
+    ASSERT_EQ(MEAN_VALUE, preProcess.getMeanVariant());
+    ASSERT_EQ(3u, preProcess.getNumberOfChannels());
+    for (size_t c = 0; c < 3; c++) {
+        ASSERT_FLOAT_EQ(0.5f * c, preProcess[c]->meanValue);
+    }
+}
+
+TEST_F(BinaryNetworkTests, throwsOnTruncatedFile) {
+    auto content = readFile();
+    content.resize(content.size() / 2);
+    writeFile(content);
+
+    Core ie(pluginsXml);
+    ASSERT_THROW(ie.ReadNetwork(fileName), details::InferenceEngineException);
+}
+
+TEST_F(BinaryNetworkTests, throwsOnTruncatedTopology) {
+    auto content = readFile();
+    details::BinaryNetworkHeader header;
+    std::memcpy(&header, content.data(), sizeof(header));
+    header.topologySize /= 2;
+    std::memcpy(content.data(), &header, sizeof(header));
+    writeFile(content);
+
+    Core ie(pluginsXml);
+    ASSERT_THROW(ie.ReadNetwork(fileName), details::InferenceEngineException);
+}
+
+TEST_F(BinaryNetworkTests, throwsOnOversizedDimsCount) {
+    auto content = readFile();
+    auto topology = walker(content);
+    ASSERT_GT(topology.next(), 0u);
+    topology.skipString();
+    // the dims count of the first data is far beyond the rest of the section
+    topology.at<uint32_t>(topology.skipDesc()) = 0x40000000;
+    writeFile(content);
+
+    Core ie(pluginsXml);
+    ASSERT_THROW(ie.ReadNetwork(fileName), details::InferenceEngineException);
+}
+
+TEST_F(BinaryNetworkTests, throwsOnDescLargerThanBlob) {
+    auto content = readFile();
+    auto topology = walker(content);
+    const auto datasNum = topology.next();
+    for (uint32_t d = 0; d < datasNum; d++) {
+        topology.skipString();
+        topology.skipDesc();
+    }
+
+    // finds the first blob of the layers and doubles its first dimension, keeping its size
+    const auto layersNum = topology.next();
+    bool corrupted = false;
+    for (uint32_t l = 0; l < layersNum && !corrupted; l++) {
+        topology.skipString();
+        topology.skipString();
+        topology.pos += sizeof(int32_t);
+        const auto paramsNum = topology.next();
+        for (uint32_t p = 0; p < 2 * paramsNum; p++) topology.skipString();
+        topology.pos += topology.next() * sizeof(uint32_t);
+        topology.pos += topology.next() * sizeof(uint32_t);
+        if (topology.next() > 0) {
+            topology.skipString();
+            const size_t dimsPos = topology.skipDesc();
+            ASSERT_GT(topology.at<uint32_t>(dimsPos), 0u);
+            topology.at<uint64_t>(dimsPos + sizeof(uint32_t)) *= 2;
+            corrupted = true;
+        }
+    }
+    ASSERT_TRUE(corrupted);
+    writeFile(content);
+
+    Core ie(pluginsXml);
+    ASSERT_THROW(ie.ReadNetwork(fileName), details::InferenceEngineException);
+}
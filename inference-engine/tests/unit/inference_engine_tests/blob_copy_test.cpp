@@ -9,6 +9,7 @@
 
 #include <cpp/ie_cnn_net_reader.h>
 #include <blob_transform.hpp>
+#include <precision_utils.h>
 
 using namespace ::testing;
 using namespace InferenceEngine;
@@ -299,3 +300,76 @@ INSTANTIATE_TEST_CASE_P(accuracy, BlobCopyTest,
                            ::testing::ValuesIn(BlobCopy_PrecisionParams)));
 
 
+
+//  The precision may be changed along with the layout for 4d blobs
+float GetElemAsFloat(Blob::Ptr& blob, SizeVector idx) {
+    switch (blob->getTensorDesc().getPrecision())
+    {
+        case InferenceEngine::Precision::FP32:
+            return GetElem<float>(blob, idx);
+        case InferenceEngine::Precision::FP16:
+            return PrecisionUtils::f16tof32(GetElem<ie_fp16>(blob, idx));
+        case InferenceEngine::Precision::U8:
+            return GetElem<uint8_t>(blob, idx);
+        default:
+            THROW_IE_EXCEPTION << "Unsupported precision";
+    }
+}
+
+class BlobCopyConvertTest : public ::testing::TestWithParam <std::tuple<IsInterleaved, IsInterleaved, BatchNum, ChannelNum, Dims, PrecisionType, PrecisionType >> {
+};
+
+TEST_P (BlobCopyConvertTest, BlobCopyWithPrecisionConversion) {
+    IsInterleaved srcIsInterleaved = get<0>(GetParam());
+    IsInterleaved dstIsInterleaved = get<1>(GetParam());
+    BatchNum batchNum = get<2>(GetParam());
+    ChannelNum channelNum = get<3>(GetParam());
+    Dims dims = get<4>(GetParam());
+    PrecisionType srcPrecision = get<5>(GetParam());
+    PrecisionType dstPrecision = get<6>(GetParam());
+
+    SizeVector blobDims = SetDimVector(batchNum, channelNum, dims);
+
+    Blob::Ptr srcBlob = createBlob(srcPrecision, blobDims, setLayout(srcIsInterleaved, dims.size()));
+    Blob::Ptr dstBlob = createBlob(dstPrecision, blobDims, setLayout(dstIsInterleaved, dims.size()));
+
+    srcBlob->allocate();
+    dstBlob->allocate();
+
+    FillBlob(srcBlob);
+
+    blob_copy(srcBlob, dstBlob);
+
+    for (int experimentsNum = SetExperimentsNum(srcBlob->size()); experimentsNum > 0; --experimentsNum) {
+        SizeVector randomElemIdx = GenerateRandomVector(blobDims);
+        float expected = GetElemAsFloat(srcBlob, randomElemIdx);
+        if (srcPrecision == InferenceEngine::Precision::FP32 && dstPrecision == InferenceEngine::Precision::FP16) {
+            expected = PrecisionUtils::f16tof32(PrecisionUtils::f32tof16(expected));
+        }
+        ASSERT_EQ(expected, GetElemAsFloat(dstBlob, randomElemIdx));
+    }
+}
+
+//  The width is big enough for the vectored row kernels to process most of every row
+static std::vector<Dims> BlobCopyConvert_Dims = {
+        {{67, 100}},
+        {{5, 7}},
+};
+
+INSTANTIATE_TEST_CASE_P(accuracy_u8_to_fp32, BlobCopyConvertTest,
+                        ::testing::Combine(::testing::ValuesIn(BlobCopy_srcLayoutParam),
+                           ::testing::ValuesIn(BlobCopy_dstLayoutParam),
+                           ::testing::ValuesIn(BlobCopy_BatchNum),
+                           ::testing::ValuesIn(BlobCopy_ChannelNum),
+                           ::testing::ValuesIn(BlobCopyConvert_Dims),
+                           ::testing::Values(InferenceEngine::Precision::U8),
+                           ::testing::Values(InferenceEngine::Precision::FP32, InferenceEngine::Precision::FP16)));
+
+INSTANTIATE_TEST_CASE_P(accuracy_fp16_fp32, BlobCopyConvertTest,
+                        ::testing::Combine(::testing::ValuesIn(BlobCopy_srcLayoutParam),
+                           ::testing::ValuesIn(BlobCopy_dstLayoutParam),
+                           ::testing::ValuesIn(BlobCopy_BatchNum),
+                           ::testing::ValuesIn(BlobCopy_ChannelNum),
+                           ::testing::ValuesIn(BlobCopyConvert_Dims),
+                           ::testing::Values(InferenceEngine::Precision::FP16, InferenceEngine::Precision::FP32),
+                           ::testing::Values(InferenceEngine::Precision::FP32, InferenceEngine::Precision::FP16)));
@@ -0,0 +1,184 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "tests_common.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+#include <ie_core.hpp>
+#include <cpp/ie_cnn_net_reader.h>
+#include "details/ie_so_loader.h"
+#include "mock_inference_engine.hpp"
+#include "mock_iexecutable_network.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+IE_SUPPRESS_DEPRECATED_START
+
+class CompiledNetworkCacheTests : public TestsCommon {
+protected:
+    std::string _model = R"V0G0N(
+<net name="Cached" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="1">
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    void SetUp() override {
+        TestsCommon::SetUp();
+        // Core creates the mock plugin from the same library, which forwards the calls to the injected engine
+        sharedObjectLoader.reset(new SharedObjectLoader(get_mock_engine_name().c_str()));
+        auto inject = reinterpret_cast<void (*)(IInferencePlugin*)>(sharedObjectLoader->get_symbol("InjectProxyEngine"));
+        inject(&engine);
+
+        version.apiVersion = {2, 1};
+        version.buildNumber = "cache_test";
+        version.description = "mock";
+        ON_CALL(engine, GetVersion(_)).WillByDefault(SetArgReferee<0>(&version));
+
+        ON_CALL(engine, LoadNetwork(_, _, _, _)).WillByDefault(DoAll(SetArgReferee<0>(createExecutableNetwork()),
+                                                                     Return(OK)));
+        ON_CALL(engine, ImportNetwork(_, _, _, _)).WillByDefault(DoAll(SetArgReferee<0>(createExecutableNetwork()),
+                                                                       Return(OK)));
+
+        core.reset(new Core());
+        core->RegisterPlugin(std::string("mock_engine") + IE_BUILD_POSTFIX, "MOCK");
+        core->SetConfig({{CONFIG_KEY(CACHE_DIR), "."}});
+
+        CNNNetReader reader;
+        reader.ReadNetwork(_model.data(), _model.length());
+        network = reader.getNetwork();
+    }
+
+    void TearDown() override {
+        core.reset();
+        for (const auto& entry : entries) std::remove(entry.c_str());
+        TestsCommon::TearDown();
+    }
+
+    std::shared_ptr<MockIExecutableNetwork> createExecutableNetwork(bool canExport = true) {
+        auto executableNetwork = std::make_shared<NiceMock<MockIExecutableNetwork>>();
+        if (canExport) {
+            ON_CALL(*executableNetwork, Export(_, _)).WillByDefault(Invoke([this](const std::string& path, ResponseDesc*) {
+                std::ofstream(path) << "blob";
+                // the temporary file is renamed into the entry with the same name before the suffix
+                entries.insert(path.substr(0, path.rfind(".blob") + 5));
+                return OK;
+            }));
+        } else {
+            ON_CALL(*executableNetwork, Export(_, _)).WillByDefault(Return(NOT_IMPLEMENTED));
+        }
+        return executableNetwork;
+    }
+
+    std::unique_ptr<SharedObjectLoader> sharedObjectLoader;
+    NiceMock<MockInferenceEngine> engine;
+    Version version = {};
+    std::unique_ptr<Core> core;
+    CNNNetwork network;
+    std::set<std::string> entries;
+};
+
+TEST_F(CompiledNetworkCacheTests, compilesAndExportsNetworkOnMiss) {
+    EXPECT_CALL(engine, LoadNetwork(_, _, _, _)).Times(1);
+    EXPECT_CALL(engine, ImportNetwork(_, _, _, _)).Times(0);
+
+    ASSERT_NO_THROW(core->LoadNetwork(network, "MOCK"));
+    ASSERT_EQ(1, entries.size());
+    ASSERT_TRUE(std::ifstream(*entries.begin()).good());
+}
+
+TEST_F(CompiledNetworkCacheTests, importsNetworkOnHit) {
+    EXPECT_CALL(engine, LoadNetwork(_, _, _, _)).Times(1);
+    ASSERT_NO_THROW(core->LoadNetwork(network, "MOCK"));
+    ASSERT_EQ(1, entries.size());
+
+    EXPECT_CALL(engine, ImportNetwork(_, *entries.begin(), _, _)).Times(1);
+    ASSERT_NO_THROW(core->LoadNetwork(network, "MOCK"));
+}
+
+TEST_F(CompiledNetworkCacheTests, recompilesCorruptedEntry) {
+    EXPECT_CALL(engine, LoadNetwork(_, _, _, _)).Times(2);
+    ASSERT_NO_THROW(core->LoadNetwork(network, "MOCK"));
+    ASSERT_EQ(1, entries.size());
+
+    EXPECT_CALL(engine, ImportNetwork(_, _, _, _)).WillOnce(Return(GENERAL_ERROR));
+    ASSERT_NO_THROW(core->LoadNetwork(network, "MOCK"));
+    ASSERT_TRUE(std::ifstream(*entries.begin()).good());
+
+    EXPECT_CALL(engine, ImportNetwork(_, _, _, _)).Times(1);
+    ASSERT_NO_THROW(core->LoadNetwork(network, "MOCK"));
+}
+
+TEST_F(CompiledNetworkCacheTests, bypassesCacheForDeviceWithoutExport) {
+    EXPECT_CALL(engine, LoadNetwork(_, _, _, _)).Times(2).WillRepeatedly(
+        DoAll(SetArgReferee<0>(createExecutableNetwork(false)), Return(OK)));
+    EXPECT_CALL(engine, ImportNetwork(_, _, _, _)).Times(0);
+
+    ASSERT_NO_THROW(core->LoadNetwork(network, "MOCK"));
+    ASSERT_NO_THROW(core->LoadNetwork(network, "MOCK"));
+    ASSERT_TRUE(entries.empty());
+}
+
+TEST_F(CompiledNetworkCacheTests, missesAfterDeviceConfigChange) {
+    EXPECT_CALL(engine, LoadNetwork(_, _, _, _)).Times(2);
+    EXPECT_CALL(engine, ImportNetwork(_, _, _, _)).Times(0);
+
+    ASSERT_NO_THROW(core->LoadNetwork(network, "MOCK"));
+    ASSERT_NO_THROW(core->SetConfig({{"MOCK_KEY", "MOCK_VALUE"}}, "MOCK"));
+    ASSERT_NO_THROW(core->LoadNetwork(network, "MOCK"));
+    ASSERT_EQ(2, entries.size());
+}
+
+TEST_F(CompiledNetworkCacheTests, missesForDifferentLoadConfig) {
+    EXPECT_CALL(engine, LoadNetwork(_, _, _, _)).Times(2);
+    EXPECT_CALL(engine, ImportNetwork(_, _, _, _)).Times(0);
+
+    ASSERT_NO_THROW(core->LoadNetwork(network, "MOCK"));
+    ASSERT_NO_THROW(core->LoadNetwork(network, "MOCK", {{"MOCK_KEY", "MOCK_VALUE"}}));
+    ASSERT_EQ(2, entries.size());
+}
+
+IE_SUPPRESS_DEPRECATED_END
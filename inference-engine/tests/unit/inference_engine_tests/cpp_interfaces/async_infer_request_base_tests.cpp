@@ -121,6 +121,19 @@ TEST_F(InferRequestBaseTests, canCatchUnknownErrorInInfer) {
     ASSERT_EQ(UNEXPECTED, request->Infer(nullptr));
 }
 
+// InferBatch
+TEST_F(InferRequestBaseTests, canForwardInferBatch) {
+    std::vector<BlobMap> inputs(2), outputs(2);
+    EXPECT_CALL(*mock_impl.get(), InferBatch(inputs.data(), outputs.data(), 2)).Times(1);
+    ASSERT_EQ(OK, request->InferBatch(inputs.data(), outputs.data(), 2, &dsc));
+}
+
+TEST_F(InferRequestBaseTests, canReportErrorInInferBatch) {
+    EXPECT_CALL(*mock_impl.get(), InferBatch(_, _, _)).WillOnce(Throw(std::runtime_error("compare")));
+    ASSERT_NE(request->InferBatch(nullptr, nullptr, 0, &dsc), OK);
+    ASSERT_STREQ(dsc.msg, "compare");
+}
+
 // GetPerformanceCounts
 TEST_F(InferRequestBaseTests, canForwardGetPerformanceCounts) {
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> info;
@@ -21,8 +21,9 @@ class TestAsyncInferRequestThreadSafeDefault : public AsyncInferRequestThreadSaf
 public:
     TestAsyncInferRequestThreadSafeDefault(const InferRequestInternal::Ptr &request,
                                            const ITaskExecutor::Ptr &taskExecutor,
-                                           const ITaskExecutor::Ptr &callbackExecutor)
-            : AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor) {}
+                                           const ITaskExecutor::Ptr &callbackExecutor,
+                                           const ITaskExecutor::Ptr &preprocessExecutor = nullptr)
+            : AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor, preprocessExecutor) {}
 
     void setRequestBusy() {
         AsyncInferRequestThreadSafeDefault::setIsRequestBusy(true);
@@ -219,6 +220,45 @@ TEST_F(InferRequestThreadSafeDefaultTests, callbackTakesOKIfAsyncRequestWasOK) {
     testRequest->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
 }
 
+TEST_F(InferRequestThreadSafeDefaultTests, runsPreprocessingStageByPreprocessExecutorBeforeInference) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    auto preprocessExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      nullptr, preprocessExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+
+    testRequest->StartAsync();
+    ASSERT_EQ(1, preprocessExecutor->tasks.size());
+    ASSERT_TRUE(taskExecutor->tasks.empty());
+
+    preprocessExecutor->executeOne();
+    ASSERT_EQ(1, taskExecutor->tasks.size());
+
+    taskExecutor->executeOne();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::STATUS_ONLY));
+}
+
+#ifdef __linux__
+TEST_F(InferRequestThreadSafeDefaultTests, completionFdIsReadableAfterRequestIsCompleted) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+
+    const int fd = testRequest->GetCompletionFd();
+    ASSERT_LE(0, fd);
+    ASSERT_EQ(fd, testRequest->GetCompletionFd());
+
+    uint64_t completed = 0;
+    testRequest->StartAsync();
+    ASSERT_GT(0, read(fd, &completed, sizeof(completed)));
+
+    taskExecutor->executeAll();
+    ASSERT_EQ(sizeof(completed), read(fd, &completed, sizeof(completed)));
+    ASSERT_EQ(1, completed);
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::STATUS_ONLY));
+}
+#endif
+
 TEST_F(InferRequestThreadSafeDefaultTests, callbackIsCalledIfAsyncRequestFailed) {
     auto taskExecutor = std::make_shared<TaskExecutor>();
     testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
@@ -40,3 +40,18 @@ TEST_F(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, _manager.getExecutorsNumber());
 }
+
+TEST_F(ExecutorManagerTests, reserveCoresReturnsVacantCoresFirst) {
+    ASSERT_EQ(0, _manager.reserveCores(4, 8));
+    ASSERT_EQ(4, _manager.reserveCores(2, 8));
+    ASSERT_EQ(6, _manager.reserveCores(2, 8));
+    // all the cores are reserved once, the least reserved range is shared
+    ASSERT_EQ(0, _manager.reserveCores(2, 8));
+}
+
+TEST_F(ExecutorManagerTests, releasedCoresCanBeReservedAgain) {
+    ASSERT_EQ(0, _manager.reserveCores(4, 8));
+    ASSERT_EQ(4, _manager.reserveCores(4, 8));
+    _manager.releaseCores(0, 4);
+    ASSERT_EQ(0, _manager.reserveCores(4, 8));
+}
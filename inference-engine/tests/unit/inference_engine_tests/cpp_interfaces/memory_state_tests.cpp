@@ -6,12 +6,15 @@
 #include <gmock/gmock-spec-builders.h>
 #include <ie_version.hpp>
 #include <cpp/ie_executable_network.hpp>
+#include <cpp/ie_infer_request.hpp>
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
 
 #include <mock_icnn_network.hpp>
 #include <mock_iexecutable_network.hpp>
 #include <cpp_interfaces/interface/mock_imemory_state_internal.hpp>
 #include <cpp_interfaces/base/ie_executable_network_base.hpp>
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include <cpp_interfaces/interface/mock_iasync_infer_request_internal.hpp>
 #include <cpp_interfaces/interface/mock_iexecutable_network_internal.hpp>
 #include <cpp_interfaces/impl/ie_memory_state_internal.hpp>
 
@@ -25,9 +28,17 @@ class MemoryStateTests : public ::testing::Test {
     shared_ptr<MockIExecutableNetworkInternal> mockExeNetworkInternal;
     shared_ptr<MockIMemoryStateInternal> mockMemoryStateInternal;
 
+    shared_ptr<MockIAsyncInferRequestInternal> mockInferRequestInternal;
+
     virtual void SetUp() {
         mockExeNetworkInternal = make_shared<MockIExecutableNetworkInternal>();
         mockMemoryStateInternal = make_shared<MockIMemoryStateInternal>();
+        mockInferRequestInternal = make_shared<MockIAsyncInferRequestInternal>();
+    }
+
+    InferRequest makeInferRequest() {
+        return InferRequest(shared_from_irelease(
+                new InferRequestBase<MockIAsyncInferRequestInternal>(mockInferRequestInternal)));
     }
 };
 
@@ -67,6 +78,27 @@ TEST_F(MemoryStateTests, ExecutableNetworkCanConvert2MemoryStatesFromCPPtoAPI) {
     ASSERT_EQ(state.size(), 2);
 }
 
+TEST_F(MemoryStateTests, InferRequestCanConvert2MemoryStatesFromCPPtoAPI) {
+    auto request = makeInferRequest();
+    std::vector<IMemoryStateInternal::Ptr> toReturn;
+    toReturn.push_back(mockMemoryStateInternal);
+    toReturn.push_back(mockMemoryStateInternal);
+
+    EXPECT_CALL(*mockInferRequestInternal.get(), QueryState()).Times(3).WillRepeatedly(Return(toReturn));
+
+    auto state = request.QueryState();
+    ASSERT_EQ(state.size(), 2);
+}
+
+TEST_F(MemoryStateTests, InferRequestPropagatesNotImplementedQueryState) {
+    auto request = makeInferRequest();
+
+    EXPECT_CALL(*mockInferRequestInternal.get(), QueryState()).WillOnce(
+            Throw(InferenceEngineException(__FILE__, __LINE__) << as_status << NOT_IMPLEMENTED));
+
+    ASSERT_THROW(request.QueryState(), NotImplemented);
+}
+
 TEST_F(MemoryStateTests, MemoryStatePropagatesReset) {
 
     auto net = ExecutableNetwork(make_executable_network(mockExeNetworkInternal));
@@ -176,6 +208,23 @@ TEST_F(MemoryStateTests, MemoryStateCanPropagateSetState) {
     ASSERT_FLOAT_EQ(saver->buffer().as<float*>()[2], 125);
 }
 
+TEST_F(MemoryStateTests, MemoryStateCanPropagateBindState) {
+
+    auto request = makeInferRequest();
+    std::vector<IMemoryStateInternal::Ptr> toReturn;
+    Blob::Ptr bound;
+    toReturn.push_back(mockMemoryStateInternal);
+
+    EXPECT_CALL(*mockInferRequestInternal.get(), QueryState()).WillRepeatedly(Return(toReturn));
+    EXPECT_CALL(*mockMemoryStateInternal.get(), BindState(_)).WillOnce(SaveArg<0>(&bound));
+
+    float data[] = {123, 124, 125};
+    auto stateBlob = make_shared_blob<float>({ Precision::FP32, {3}, C }, data, sizeof(data) / sizeof(*data));
+
+    EXPECT_NO_THROW(request.QueryState().front().BindState(stateBlob));
+    ASSERT_EQ(bound->buffer().as<float*>(), data);
+}
+
 TEST_F(MemoryStateTests, MemoryStateCanPropagateGetLastState) {
 
     auto net = ExecutableNetwork(make_executable_network(mockExeNetworkInternal));
@@ -243,3 +292,12 @@ TEST_F(MemoryStateTests, MemoryStateInternalCanSaveStateByReference) {
     ASSERT_FLOAT_EQ(saver->cbuffer().as<const float *>()[1], 122);
     ASSERT_FLOAT_EQ(saver->cbuffer().as<const float *>()[2], 123);
 }
+
+TEST_F(MemoryStateTests, MemoryStateInternalCannotBeBound) {
+
+    IMemoryStateInternal::Ptr pState(new MemoryStateInternalMockImpl("name"));
+    float data[] = {123, 124, 125};
+    auto stateBlob = make_shared_blob<float>({ Precision::FP32, {3}, C }, data, sizeof(data) / sizeof(*data));
+
+    ASSERT_THROW(pState->BindState(stateBlob), InferenceEngineException);
+}
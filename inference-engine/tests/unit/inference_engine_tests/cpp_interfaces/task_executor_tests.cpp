@@ -185,6 +185,29 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+TEST_P(ASyncTaskExecutorTests, queuedTaskWithHigherPriorityIsStartedFirst) {
+    auto taskExecutor = GetParam()();
+    std::promise<void> blockerStarted;
+    std::promise<void> unblock;
+    auto unblocked = unblock.get_future().share();
+    taskExecutor->run([&blockerStarted, unblocked] {
+        blockerStarted.set_value();
+        unblocked.wait();
+    });
+    blockerStarted.get_future().wait();
+
+    std::mutex m;
+    std::vector<int> order;
+    std::promise<void> lastDone;
+    taskExecutor->runWithPriority([&] {std::lock_guard<std::mutex> l{m}; order.push_back(0); }, 0);
+    taskExecutor->runWithPriority([&] {std::lock_guard<std::mutex> l{m}; order.push_back(1); }, 1);
+    taskExecutor->runWithPriority([&] {std::lock_guard<std::mutex> l{m}; order.push_back(2); lastDone.set_value(); }, -1);
+    unblock.set_value();
+    lastDone.get_future().wait();
+
+    ASSERT_EQ((std::vector<int>{1, 0, 2}), order);
+}
+
 static auto Executors = ::testing::Values(
     [] {
         return std::make_shared<TaskExecutor>("Test Executor");
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "ie_profiling.hpp"
+
+using namespace InferenceEngine;
+
+class LoadProfileTests : public ::testing::Test {
+};
+
+TEST_F(LoadProfileTests, scopesAreNotRecordedWithoutBoundProfile) {
+    ASSERT_EQ(nullptr, LoadProfile::current());
+    LoadProfile profile;
+    {
+        IE_PROFILING_AUTO_SCOPE(LoadProfileTests::unbound)
+    }
+    ASSERT_TRUE(profile.get().empty());
+}
+
+TEST_F(LoadProfileTests, bindIsRestored) {
+    LoadProfile outer, inner;
+    {
+        LoadProfile::Bind bindOuter(&outer);
+        {
+            LoadProfile::Bind bindInner(&inner);
+            ASSERT_EQ(&inner, LoadProfile::current());
+        }
+        ASSERT_EQ(&outer, LoadProfile::current());
+    }
+    ASSERT_EQ(nullptr, LoadProfile::current());
+}
+
+TEST_F(LoadProfileTests, phasesAreReportedInStartOrder) {
+    LoadProfile profile;
+    {
+        LoadProfile::Bind bind(&profile);
+        IE_PROFILING_AUTO_SCOPE(LoadProfileTests::outer)
+        {
+            IE_PROFILING_AUTO_SCOPE(LoadProfileTests::inner)
+        }
+    }
+    auto phases = profile.get();
+    ASSERT_EQ(2u, phases.size());
+    ASSERT_EQ("LoadProfileTests::outer", phases[0].first);
+    ASSERT_EQ("LoadProfileTests::inner", phases[1].first);
+    ASSERT_LE(phases[1].second, phases[0].second);
+}
+
+TEST_F(LoadProfileTests, durationsAreSummedPerThreadAndLongestThreadIsReported) {
+    LoadProfile profile;
+    profile.add("phase", 1.0f);
+    profile.add("phase", 2.0f);
+    std::thread([&] { profile.add("phase", 2.5f); }).join();
+
+    auto phases = profile.get();
+    ASSERT_EQ(1u, phases.size());
+    ASSERT_FLOAT_EQ(3.0f, phases[0].second);
+}
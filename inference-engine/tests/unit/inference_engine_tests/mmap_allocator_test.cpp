@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ie_blob.h>
+#include <mmap_allocator.hpp>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class MmapAllocatorTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        content.resize(4099);
+        for (size_t i = 0; i < content.size(); i++) {
+            content[i] = static_cast<char>(i % 251);
+        }
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(content.data(), content.size());
+    }
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+    }
+
+    std::string fileName = "MmapAllocatorTests.bin";
+    std::vector<char> content;
+};
+
+TEST_F(MmapAllocatorTests, canMapWholeFile) {
+    if (!details::MmapAllocator::isSupported())
+        GTEST_SKIP();
+
+    details::MmapAllocator allocator(fileName);
+    void* handle = allocator.alloc(content.size());
+    ASSERT_NE(nullptr, handle);
+    auto ptr = static_cast<char*>(allocator.lock(handle, LOCK_FOR_READ));
+    for (size_t i = 0; i < content.size(); i++) {
+        ASSERT_EQ(content[i], ptr[i]);
+    }
+    allocator.unlock(ptr);
+    ASSERT_TRUE(allocator.free(handle));
+}
+
+TEST_F(MmapAllocatorTests, failsToMapMoreThanFileSize) {
+    details::MmapAllocator allocator(fileName);
+    ASSERT_EQ(nullptr, allocator.alloc(content.size() + 1));
+}
+
+TEST_F(MmapAllocatorTests, failsToMapMissingFile) {
+    details::MmapAllocator allocator(fileName + ".missing");
+    ASSERT_EQ(nullptr, allocator.alloc(1));
+}
+
+TEST_F(MmapAllocatorTests, mappingIsReadOnly) {
+    if (!details::MmapAllocator::isSupported())
+        GTEST_SKIP();
+
+    details::MmapAllocator allocator(fileName);
+    void* handle = allocator.alloc(content.size());
+    ASSERT_NE(nullptr, handle);
+    auto ptr = static_cast<volatile char*>(allocator.lock(handle, LOCK_FOR_WRITE));
+    EXPECT_DEATH_IF_SUPPORTED(ptr[0] = static_cast<char>(content[0] + 1), "");
+    ASSERT_EQ(content[0], ptr[0]);
+    ASSERT_TRUE(allocator.free(handle));
+}
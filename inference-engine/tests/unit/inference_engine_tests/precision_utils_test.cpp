@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <precision_utils.h>
+
+using namespace InferenceEngine;
+
+class PrecisionUtilsTests : public ::testing::Test {
+protected:
+    // long enough to be split between the threads, with a tail left to the element conversion
+    static constexpr size_t size = 100003;
+
+    void SetUp() override {
+        std::mt19937 gen(7);
+        std::uniform_real_distribution<float> values(-70000.f, 70000.f);
+        floats.resize(size);
+        halves.resize(size);
+        bytes.resize(size);
+        for (size_t i = 0; i < size; i++) {
+            // every other value is an arbitrary bit pattern, so NaN, INF and the denormals are converted too
+            uint32_t bits = static_cast<uint32_t>(gen());
+            if (i % 2) {
+                std::memcpy(&floats[i], &bits, sizeof(float));
+            } else {
+                floats[i] = values(gen) / static_cast<float>(1 << (i % 24));
+            }
+            halves[i] = static_cast<short>(bits);
+            bytes[i] = static_cast<uint8_t>(bits);
+        }
+    }
+
+    static bool sameFloats(float a, float b) {
+        return std::memcmp(&a, &b, sizeof(float)) == 0 || (std::isnan(a) && std::isnan(b));
+    }
+
+    std::vector<float> floats;
+    std::vector<short> halves;
+    std::vector<uint8_t> bytes;
+};
+
+constexpr size_t PrecisionUtilsTests::size;
+
+TEST_F(PrecisionUtilsTests, f32tof16ArraysConvertsAsElements) {
+    std::vector<short> dst(size);
+    PrecisionUtils::f32tof16Arrays(dst.data(), floats.data(), size, 0.5f, 1.f);
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(PrecisionUtils::f32tof16(floats[i] * 0.5f + 1.f), dst[i]) << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, f16tof32ArraysConvertsAsElements) {
+    std::vector<float> dst(size);
+    PrecisionUtils::f16tof32Arrays(dst.data(), halves.data(), size, 2.f, -1.f);
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_TRUE(sameFloats(PrecisionUtils::f16tof32(halves[i]) * 2.f - 1.f, dst[i])) << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, f32tobf16ArraysConvertsAsElements) {
+    std::vector<short> dst(size);
+    PrecisionUtils::f32tobf16Arrays(dst.data(), floats.data(), size);
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(PrecisionUtils::f32tobf16(floats[i]), dst[i]) << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, bf16tof32ArraysConvertsAsElements) {
+    std::vector<float> dst(size);
+    PrecisionUtils::bf16tof32Arrays(dst.data(), halves.data(), size, 0.5f, 3.f);
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_TRUE(sameFloats(PrecisionUtils::bf16tof32(halves[i]) * 0.5f + 3.f, dst[i])) << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, f32tobf16RoundsToNearestEven) {
+    ASSERT_EQ(0x3F80, PrecisionUtils::f32tobf16(1.f));
+    // halfway between 0x3F80 and 0x3F81 goes to the even one, above it goes up
+    float halfway, above;
+    uint32_t halfwayBits = 0x3F808000, aboveBits = 0x3F808001;
+    std::memcpy(&halfway, &halfwayBits, sizeof(float));
+    std::memcpy(&above, &aboveBits, sizeof(float));
+    ASSERT_EQ(0x3F80, PrecisionUtils::f32tobf16(halfway));
+    ASSERT_EQ(0x3F81, PrecisionUtils::f32tobf16(above));
+    ASSERT_TRUE(std::isnan(PrecisionUtils::bf16tof32(PrecisionUtils::f32tobf16(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST_F(PrecisionUtilsTests, u8tof32ArraysScalesValues) {
+    std::vector<float> dst(size);
+    PrecisionUtils::u8tof32Arrays(dst.data(), bytes.data(), size, 0.25f, -3.f);
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_FLOAT_EQ(bytes[i] * 0.25f - 3.f, dst[i]) << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, f32tou8ArraysRoundsAndSaturates) {
+    std::vector<float> src = {-1.f, 0.f, 0.5f, 1.5f, 2.5f, 254.4f, 255.f, 300.f,
+                              std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(),
+                              -std::numeric_limits<float>::infinity(), 17.6f, 3.f, 4.f, 5.f, 6.f, 7.f};
+    std::vector<uint8_t> expected = {0, 0, 0, 2, 2, 254, 255, 255, 0, 255, 0, 18, 3, 4, 5, 6, 7};
+    std::vector<uint8_t> dst(src.size());
+    PrecisionUtils::f32tou8Arrays(dst.data(), src.data(), src.size());
+    ASSERT_EQ(expected, dst);
+}
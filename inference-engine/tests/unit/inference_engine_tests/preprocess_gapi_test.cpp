@@ -0,0 +1,217 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <ie_compound_blob.h>
+#include "ie_preprocess_gapi.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+Blob::Ptr createPlanes(Precision precision, size_t channels, size_t height, size_t width, unsigned seed) {
+    const TensorDesc desc(precision, {1, channels, height, width}, Layout::NCHW);
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, 255);
+    if (precision == Precision::U8) {
+        auto blob = make_shared_blob<uint8_t>(desc);
+        blob->allocate();
+        for (size_t i = 0; i < blob->size(); i++)
+            blob->data()[i] = static_cast<uint8_t>(dist(gen));
+        return blob;
+    }
+    auto blob = make_shared_blob<float>(desc);
+    blob->allocate();
+    for (size_t i = 0; i < blob->size(); i++)
+        blob->data()[i] = static_cast<float>(dist(gen)) / 4.f;
+    return blob;
+}
+
+float valueAt(const Blob::Ptr& blob, size_t idx) {
+    return blob->getTensorDesc().getPrecision() == Precision::U8
+           ? static_cast<float>(blob->cbuffer().as<const uint8_t*>()[idx])
+           : blob->cbuffer().as<const float*>()[idx];
+}
+
+// Reference resize of the [x, x + width) x [y, y + height) region of every plane, the same as
+// OpenCV's INTER_NEAREST and INTER_CUBIC with replicated borders
+std::vector<float> refResize(const Blob::Ptr& in, const ROI& roi, size_t outH, size_t outW,
+                             ResizeAlgorithm algorithm) {
+    const auto& dims = in->getTensorDesc().getDims();
+    const size_t C = dims[1], H = dims[2], W = dims[3];
+    const int inH = static_cast<int>(roi.sizeY), inW = static_cast<int>(roi.sizeX);
+    const double vRatio = 1 / (static_cast<double>(outH) / inH);
+    const double hRatio = 1 / (static_cast<double>(outW) / inW);
+    const bool u8 = in->getTensorDesc().getPrecision() == Precision::U8;
+
+    auto pixel = [&](size_t c, int y, int x) {
+        y = std::min(std::max(y, 0), inH - 1);
+        x = std::min(std::max(x, 0), inW - 1);
+        return valueAt(in, (c * H + roi.posY + y) * W + roi.posX + x);
+    };
+    auto cubic = [](double inCoord, int& index, float k[4]) {
+        constexpr float A = -0.75f;
+        index = static_cast<int>(std::floor(inCoord));
+        const float x = static_cast<float>(inCoord - index);
+        k[0] = ((A*(x + 1) - 5*A)*(x + 1) + 8*A)*(x + 1) - 4*A;
+        k[1] = ((A + 2)*x - (A + 3))*x*x + 1;
+        k[2] = ((A + 2)*(1 - x) - (A + 3))*(1 - x)*(1 - x) + 1;
+        k[3] = 1.f - k[0] - k[1] - k[2];
+    };
+
+    std::vector<float> out(C * outH * outW);
+    for (size_t c = 0; c < C; c++) {
+        for (size_t y = 0; y < outH; y++) {
+            for (size_t x = 0; x < outW; x++) {
+                float value = 0.f;
+                if (algorithm == RESIZE_NEAREST) {
+                    const int sy = std::min(static_cast<int>(y * vRatio + 1e-3), inH - 1);
+                    const int sx = std::min(static_cast<int>(x * hRatio + 1e-3), inW - 1);
+                    value = pixel(c, sy, sx);
+                } else {
+                    int sy, sx;
+                    float ky[4], kx[4];
+                    cubic((y + 0.5) * vRatio - 0.5, sy, ky);
+                    cubic((x + 0.5) * hRatio - 0.5, sx, kx);
+                    for (int i = 0; i < 4; i++) {
+                        float row = 0.f;
+                        for (int j = 0; j < 4; j++)
+                            row += kx[j] * pixel(c, sy + i - 1, sx + j - 1);
+                        value += ky[i] * row;
+                    }
+                    if (u8)
+                        value = std::min(std::max(std::rint(value), 0.f), 255.f);
+                }
+                out[(c * outH + y) * outW + x] = value;
+            }
+        }
+    }
+    return out;
+}
+
+void compareWithRef(const Blob::Ptr& out, const std::vector<float>& ref, float threshold) {
+    ASSERT_EQ(ref.size(), out->size());
+    for (size_t i = 0; i < ref.size(); i++) {
+        ASSERT_NEAR(ref[i], valueAt(out, i), threshold) << "index " << i;
+    }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+// precision, resize algorithm, input size, output size (H x W)
+using ResizeAccuracyParams = std::tuple<Precision, ResizeAlgorithm, std::pair<size_t, size_t>,
+                                        std::pair<size_t, size_t>>;
+
+class PreprocessResizeAccuracyTest : public ::testing::TestWithParam<ResizeAccuracyParams> {};
+
+TEST_P(PreprocessResizeAccuracyTest, matchesReference) {
+    if (!PreprocEngine::useGAPI())
+        GTEST_SKIP();
+
+    Precision precision;
+    ResizeAlgorithm algorithm;
+    std::pair<size_t, size_t> inSz, outSz;
+    std::tie(precision, algorithm, inSz, outSz) = GetParam();
+
+    Blob::Ptr in = createPlanes(precision, 3, inSz.first, inSz.second, 1);
+    Blob::Ptr out = createPlanes(precision, 3, outSz.first, outSz.second, 2);
+
+    PreprocEngine engine;
+    ASSERT_TRUE(engine.preprocessWithGAPI(in, out, algorithm, ColorFormat::RAW, true));
+
+    const ROI whole = {0, 0, 0, inSz.second, inSz.first};
+    const auto ref = refResize(in, whole, outSz.first, outSz.second, algorithm);
+    // the cubic filter sums up the taps in another order, which may round the 8U result differently
+    const float threshold = algorithm == RESIZE_NEAREST ? 0.f : (precision == Precision::U8 ? 1.f : 1e-3f);
+    compareWithRef(out, ref, threshold);
+}
+
+INSTANTIATE_TEST_CASE_P(ResizeAccuracy, PreprocessResizeAccuracyTest,
+                        ::testing::Combine(::testing::Values(Precision::U8, Precision::FP32),
+                                           ::testing::Values(RESIZE_NEAREST, RESIZE_CUBIC),
+                                           ::testing::Values(std::make_pair<size_t, size_t>(48, 64),
+                                                             std::make_pair<size_t, size_t>(75, 100)),
+                                           ::testing::Values(std::make_pair<size_t, size_t>(96, 128),
+                                                             std::make_pair<size_t, size_t>(24, 32),
+                                                             std::make_pair<size_t, size_t>(75, 100),
+                                                             std::make_pair<size_t, size_t>(37, 53))));
+
+//------------------------------------------------------------------------------
+
+class PreprocessROITest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!PreprocEngine::useGAPI())
+            GTEST_SKIP();
+    }
+};
+
+TEST_F(PreprocessROITest, throwsOnROIOutOfInput) {
+    Blob::Ptr in = createPlanes(Precision::U8, 3, 48, 64, 1);
+    Blob::Ptr out = createPlanes(Precision::U8, 3, 16, 16, 2);
+    PreprocEngine engine;
+
+    const ROI wide = {0, 10, 0, 60, 16};
+    ASSERT_THROW(engine.preprocessWithGAPI(in, out, RESIZE_BILINEAR, ColorFormat::RAW, true, -1, &wide),
+                 details::InferenceEngineException);
+    const ROI tall = {0, 0, 40, 16, 16};
+    ASSERT_THROW(engine.preprocessWithGAPI(in, out, RESIZE_BILINEAR, ColorFormat::RAW, true, -1, &tall),
+                 details::InferenceEngineException);
+    const ROI empty = {0, 0, 0, 0, 16};
+    ASSERT_THROW(engine.preprocessWithGAPI(in, out, RESIZE_BILINEAR, ColorFormat::RAW, true, -1, &empty),
+                 details::InferenceEngineException);
+}
+
+TEST_F(PreprocessROITest, throwsOnUnalignedROIOfNV12Input) {
+    auto y = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 48, 64}, Layout::NHWC));
+    auto uv = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 24, 32}, Layout::NHWC));
+    y->allocate();
+    uv->allocate();
+    Blob::Ptr in = make_shared_blob<NV12Blob>(y, uv);
+    Blob::Ptr out = createPlanes(Precision::U8, 3, 16, 16, 2);
+    PreprocEngine engine;
+
+    const ROI unaligned = {0, 1, 2, 16, 16};
+    ASSERT_THROW(engine.preprocessWithGAPI(in, out, RESIZE_BILINEAR, ColorFormat::NV12, true, -1, &unaligned),
+                 details::InferenceEngineException);
+}
+
+TEST_F(PreprocessROITest, cropsInputToROI) {
+    Blob::Ptr in = createPlanes(Precision::U8, 3, 48, 64, 1);
+    const ROI roi = {0, 13, 7, 20, 30};
+    Blob::Ptr out = createPlanes(Precision::U8, 3, roi.sizeY, roi.sizeX, 2);
+    PreprocEngine engine;
+
+    // nearest resize of the region into its own size is its copy
+    ASSERT_TRUE(engine.preprocessWithGAPI(in, out, RESIZE_NEAREST, ColorFormat::RAW, true, -1, &roi));
+    for (size_t c = 0; c < 3; c++) {
+        for (size_t y = 0; y < roi.sizeY; y++) {
+            for (size_t x = 0; x < roi.sizeX; x++) {
+                ASSERT_EQ(valueAt(in, (c * 48 + roi.posY + y) * 64 + roi.posX + x),
+                          valueAt(out, (c * roi.sizeY + y) * roi.sizeX + x)) << c << ", " << y << ", " << x;
+            }
+        }
+    }
+}
+
+TEST_F(PreprocessROITest, resizesOnlyROI) {
+    Blob::Ptr in = createPlanes(Precision::FP32, 3, 48, 64, 1);
+    Blob::Ptr out = createPlanes(Precision::FP32, 3, 40, 32, 2);
+    PreprocEngine engine;
+
+    // another region with the same size is processed with the same compiled graph
+    for (const auto roi : {ROI{0, 13, 7, 20, 30}, ROI{0, 40, 17, 20, 30}}) {
+        ASSERT_TRUE(engine.preprocessWithGAPI(in, out, RESIZE_CUBIC, ColorFormat::RAW, true, -1, &roi));
+        compareWithRef(out, refResize(in, roi, 40, 32, RESIZE_CUBIC), 1e-3f);
+    }
+}
@@ -0,0 +1,303 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "cpu_detector.hpp"
+#include "ie_preprocess_gapi_kernels.hpp"
+#include "ie_preprocess_gapi_kernels_impl.hpp"
+
+#ifdef HAVE_PREPROC_SSE42
+#include "ie_preprocess_gapi_kernels_sse42.hpp"
+#endif
+
+#ifdef HAVE_PREPROC_AVX2
+#include "ie_preprocess_gapi_kernels_avx2.hpp"
+#endif
+
+#ifdef HAVE_PREPROC_AVX512
+#include "ie_preprocess_gapi_kernels_avx512.hpp"
+#endif
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::gapi;
+using namespace InferenceEngine::gapi::kernels;
+
+#ifdef HAVE_PREPROC_SSE42
+
+// The AVX2 and AVX-512 kernels are picked at run time instead of the SSE4.2 ones, so they are run on
+// the same rows and the results must be bit-exact
+namespace {
+
+enum class ISA { AVX2, AVX512 };
+
+bool isaSupported(ISA isa) {
+    switch (isa) {
+    case ISA::AVX2:
+#ifdef HAVE_PREPROC_AVX2
+        return with_cpu_x86_avx2();
+#else
+        return false;
+#endif
+    case ISA::AVX512:
+#ifdef HAVE_PREPROC_AVX512
+        return with_cpu_x86_avx512_core();
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
+std::vector<uint8_t> randomRow(size_t size, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t> row(size);
+    for (auto& value : row)
+        value = static_cast<uint8_t>(dist(gen));
+    return row;
+}
+
+// The same tables as the fluid resize kernel builds in its scratch buffer
+struct LinearTables {
+    std::vector<short> alpha;
+    std::vector<short> clone;
+    std::vector<short> mapsx;
+    std::vector<short> beta;
+    std::vector<short> mapsy0;
+    std::vector<short> mapsy1;
+
+    LinearTables(const Size& inSz, const Size& outSz)
+        : alpha(outSz.width), clone(4 * outSz.width), mapsx(outSz.width),
+          beta(outSz.height), mapsy0(outSz.height), mapsy1(outSz.height) {
+        auto map = [](double ratio, int max, int outCoord, short& alpha0, short& index0, short& index1) {
+            float f = static_cast<float>((outCoord + 0.5f) * ratio - 0.5f);
+            int s = static_cast<int>(std::floor(f));
+            f -= s;
+            index0 = static_cast<short>(std::max(s, 0));
+            index1 = static_cast<short>(((f == 0.0) || s + 1 >= max) ? s : s + 1);
+            alpha0 = saturate_cast<short>(ONE * (1.0f - f));
+        };
+
+        const double hRatio = 1 / (static_cast<double>(outSz.width) / inSz.width);
+        for (int x = 0; x < outSz.width; x++) {
+            short alpha0, index0, index1;
+            map(hRatio, inSz.width, x, alpha0, index0, index1);
+            if (index1 != index0 + 1) {
+                if (index0 < inSz.width - 1) {
+                    alpha0 = saturate_cast<short>(ONE);
+                } else {
+                    alpha0 = 0;
+                    index0--;
+                }
+            }
+            alpha[x] = alpha0;
+            mapsx[x] = index0;
+            std::fill_n(&clone[4 * x], 4, alpha0);
+        }
+
+        const double vRatio = 1 / (static_cast<double>(outSz.height) / inSz.height);
+        for (int y = 0; y < outSz.height; y++) {
+            map(vRatio, inSz.height, y, beta[y], mapsy0[y], mapsy1[y]);
+        }
+    }
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+using ResizeKernelsParams = std::tuple<ISA, int, Size, Size>;  // isa, channels, input size, output size
+
+class ResizeKernelsTest : public ::testing::TestWithParam<ResizeKernelsParams> {};
+
+TEST_P(ResizeKernelsTest, linear8UIsBitExactWithSSE42) {
+    ISA isa;
+    int chan;
+    Size inSz, outSz;
+    std::tie(isa, chan, inSz, outSz) = GetParam();
+    if (!isaSupported(isa))
+        GTEST_SKIP();
+
+    // the kernels fetch the pixel pairs with wider loads, so the rows are followed by some padding
+    const int padding = 64;
+    const auto src = randomRow(static_cast<size_t>(inSz.width * inSz.height * chan + padding), 42);
+    const LinearTables tables(inSz, outSz);
+    const int lpi = 4;
+
+    using Planes = std::vector<std::vector<uint8_t>>;
+    auto run = [&](bool reference) {
+        Planes out(chan, std::vector<uint8_t>(outSz.width * outSz.height + padding));
+        std::vector<uint8_t> tmp(inSz.width * lpi * chan * 2);
+
+        for (int y = 0; y < outSz.height; y += lpi) {
+            const int lines = std::min(lpi, outSz.height - y);
+            const uint8_t* src0[4];
+            const uint8_t* src1[4];
+            std::array<std::array<uint8_t*, 4>, 4> dst = {};
+            for (int l = 0; l < lines; l++) {
+                src0[l] = &src[tables.mapsy0[y + l] * inSz.width * chan];
+                src1[l] = &src[tables.mapsy1[y + l] * inSz.width * chan];
+                for (int c = 0; c < chan; c++)
+                    dst[c][l] = &out[c][(y + l) * outSz.width];
+            }
+            const short* beta = &tables.beta[y];
+
+            if (chan == 1) {
+                if (reference) {
+                    calcRowLinear_8U(dst[0].data(), src0, src1, tables.alpha.data(), tables.clone.data(),
+                                     tables.mapsx.data(), beta, tmp.data(), inSz, outSz, lines);
+#ifdef HAVE_PREPROC_AVX512
+                } else if (isa == ISA::AVX512) {
+                    avx512::calcRowLinear_8UC1(dst[0].data(), src0, src1, tables.alpha.data(), tables.mapsx.data(),
+                                               beta, tmp.data(), inSz, outSz, lines);
+#endif
+#ifdef HAVE_PREPROC_AVX2
+                } else if (isa == ISA::AVX2) {
+                    avx::calcRowLinear_8UC1(dst[0].data(), src0, src1, tables.alpha.data(), tables.mapsx.data(),
+                                            beta, tmp.data(), inSz, outSz, lines);
+#endif
+                }
+            } else if (chan == 3) {
+                std::array<std::array<uint8_t*, 4>, 3> dst3 = {dst[0], dst[1], dst[2]};
+                if (reference) {
+                    calcRowLinear_8UC<3>(dst3, src0, src1, tables.alpha.data(), tables.clone.data(),
+                                         tables.mapsx.data(), beta, tmp.data(), inSz, outSz, lines);
+#ifdef HAVE_PREPROC_AVX512
+                } else if (isa == ISA::AVX512) {
+                    avx512::calcRowLinear_8UC(dst3, src0, src1, tables.alpha.data(), tables.mapsx.data(),
+                                              beta, tmp.data(), inSz, outSz, lines);
+#endif
+#ifdef HAVE_PREPROC_AVX2
+                } else if (isa == ISA::AVX2) {
+                    avx::calcRowLinear_8UC(dst3, src0, src1, tables.alpha.data(), tables.mapsx.data(),
+                                           beta, tmp.data(), inSz, outSz, lines);
+#endif
+                }
+            } else {
+                if (reference) {
+                    calcRowLinear_8UC<4>(dst, src0, src1, tables.alpha.data(), tables.clone.data(),
+                                         tables.mapsx.data(), beta, tmp.data(), inSz, outSz, lines);
+#ifdef HAVE_PREPROC_AVX512
+                } else if (isa == ISA::AVX512) {
+                    avx512::calcRowLinear_8UC(dst, src0, src1, tables.alpha.data(), tables.mapsx.data(),
+                                              beta, tmp.data(), inSz, outSz, lines);
+#endif
+#ifdef HAVE_PREPROC_AVX2
+                } else if (isa == ISA::AVX2) {
+                    avx::calcRowLinear_8UC(dst, src0, src1, tables.alpha.data(), tables.mapsx.data(),
+                                           beta, tmp.data(), inSz, outSz, lines);
+#endif
+                }
+            }
+        }
+        return out;
+    };
+
+    const auto expected = run(true);
+    const auto actual = run(false);
+    for (int c = 0; c < chan; c++) {
+        ASSERT_TRUE(std::equal(expected[c].begin(), expected[c].begin() + outSz.width * outSz.height,
+                               actual[c].begin())) << "channel " << c;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(ResizeKernels, ResizeKernelsTest,
+                        ::testing::Combine(::testing::Values(ISA::AVX2, ISA::AVX512),
+                                           ::testing::Values(1, 3, 4),
+                                           ::testing::Values(Size(1920, 1080), Size(300, 300), Size(64, 37)),
+                                           ::testing::Values(Size(224, 224), Size(416, 251), Size(33, 65))));
+
+//------------------------------------------------------------------------------
+
+class ColorKernelsTest : public ::testing::TestWithParam<std::tuple<ISA, int>> {};  // isa, row length
+
+TEST_P(ColorKernelsTest, mergeRow8UC3IsBitExactWithSSE42) {
+    ISA isa;
+    int length;
+    std::tie(isa, length) = GetParam();
+    if (!isaSupported(isa))
+        GTEST_SKIP();
+
+    const auto in0 = randomRow(length, 1), in1 = randomRow(length, 2), in2 = randomRow(length, 3);
+    std::vector<uint8_t> expected(3 * length), actual(3 * length);
+
+    mergeRow_8UC3(in0.data(), in1.data(), in2.data(), expected.data(), length);
+#ifdef HAVE_PREPROC_AVX512
+    if (isa == ISA::AVX512)
+        avx512::mergeRow_8UC3(in0.data(), in1.data(), in2.data(), actual.data(), length);
+#endif
+#ifdef HAVE_PREPROC_AVX2
+    if (isa == ISA::AVX2)
+        avx::mergeRow_8UC3(in0.data(), in1.data(), in2.data(), actual.data(), length);
+#endif
+
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_P(ColorKernelsTest, splitRow8UC3IsBitExactWithSSE42) {
+    ISA isa;
+    int length;
+    std::tie(isa, length) = GetParam();
+    if (!isaSupported(isa))
+        GTEST_SKIP();
+
+    const auto in = randomRow(3 * length, 4);
+    std::vector<std::vector<uint8_t>> expected(3, std::vector<uint8_t>(length));
+    auto actual = expected;
+
+    splitRow_8UC3(in.data(), expected[0].data(), expected[1].data(), expected[2].data(), length);
+#ifdef HAVE_PREPROC_AVX512
+    if (isa == ISA::AVX512)
+        avx512::splitRow_8UC3(in.data(), actual[0].data(), actual[1].data(), actual[2].data(), length);
+#endif
+#ifdef HAVE_PREPROC_AVX2
+    if (isa == ISA::AVX2)
+        avx::splitRow_8UC3(in.data(), actual[0].data(), actual[1].data(), actual[2].data(), length);
+#endif
+
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_P(ColorKernelsTest, nv12ToRGBIsBitExactWithSSE42) {
+    ISA isa;
+    int length;
+    std::tie(isa, length) = GetParam();
+    if (!isaSupported(isa))
+        GTEST_SKIP();
+
+    // a pair of Y rows shares the row of the interleaved UV samples
+    const int width = length & ~1;
+    const auto y0 = randomRow(width, 5), y1 = randomRow(width, 6), uv = randomRow(width, 7);
+    const uint8_t* srcY[2] = {y0.data(), y1.data()};
+    std::vector<std::vector<uint8_t>> expected(2, std::vector<uint8_t>(3 * width));
+    auto actual = expected;
+    uint8_t* expectedRows[2] = {expected[0].data(), expected[1].data()};
+    uint8_t* actualRows[2] = {actual[0].data(), actual[1].data()};
+
+    calculate_nv12_to_rgb(srcY, uv.data(), expectedRows, width);
+#ifdef HAVE_PREPROC_AVX512
+    if (isa == ISA::AVX512)
+        avx512::calculate_nv12_to_rgb(srcY, uv.data(), actualRows, width);
+#endif
+#ifdef HAVE_PREPROC_AVX2
+    if (isa == ISA::AVX2)
+        avx::calculate_nv12_to_rgb(srcY, uv.data(), actualRows, width);
+#endif
+
+    ASSERT_EQ(expected, actual);
+}
+
+// lengths around the vector widths check the tails
+INSTANTIATE_TEST_CASE_P(ColorKernels, ColorKernelsTest,
+                        ::testing::Combine(::testing::Values(ISA::AVX2, ISA::AVX512),
+                                           ::testing::Values(2, 15, 16, 31, 32, 33, 63, 64, 65, 127, 130, 1920)));
+
+#endif  // HAVE_PREPROC_SSE42
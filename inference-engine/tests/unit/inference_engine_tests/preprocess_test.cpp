@@ -51,3 +51,49 @@ TEST_F(PreProcessTests, noThrowWithCorrectSizeMeanImage) {
     blob->allocate();
     ASSERT_NO_THROW(info.setMeanImage(blob));
 }
+
+TEST_F(PreProcessTests, letterboxIsNotSetByDefault) {
+    InferenceEngine::PreProcessInfo info;
+    ASSERT_FALSE(info.hasLetterbox());
+    info.setLetterbox(114.f);
+    ASSERT_TRUE(info.hasLetterbox());
+    ASSERT_EQ(114.f, info.getLetterboxPadValue());
+    info.resetLetterbox();
+    ASSERT_FALSE(info.hasLetterbox());
+}
+
+TEST_F(PreProcessTests, letterboxCentersWideInput) {
+    auto box = InferenceEngine::PreProcessInfo::getLetterboxInfo(1280, 720, 416, 416);
+    ASSERT_FLOAT_EQ(416.f / 1280, box.scale);
+    ASSERT_EQ(416, box.sizeX);
+    ASSERT_EQ(234, box.sizeY);
+    ASSERT_EQ(0, box.posX);
+    ASSERT_EQ(91, box.posY);
+}
+
+TEST_F(PreProcessTests, letterboxCentersTallInput) {
+    auto box = InferenceEngine::PreProcessInfo::getLetterboxInfo(300, 600, 300, 300);
+    ASSERT_FLOAT_EQ(0.5f, box.scale);
+    ASSERT_EQ(150, box.sizeX);
+    ASSERT_EQ(300, box.sizeY);
+    ASSERT_EQ(75, box.posX);
+    ASSERT_EQ(0, box.posY);
+}
+
+TEST_F(PreProcessTests, throwsOnLetterboxOfEmptyInput) {
+    ASSERT_THROW(InferenceEngine::PreProcessInfo::getLetterboxInfo(0, 600, 300, 300),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(PreProcessTests, roiIsNotSetByDefault) {
+    InferenceEngine::PreProcessInfo info;
+    ASSERT_FALSE(info.hasROI());
+    info.setROI({0, 10, 20, 30, 40});
+    ASSERT_TRUE(info.hasROI());
+    ASSERT_EQ(10, info.getROI().posX);
+    ASSERT_EQ(20, info.getROI().posY);
+    ASSERT_EQ(30, info.getROI().sizeX);
+    ASSERT_EQ(40, info.getROI().sizeY);
+    info.resetROI();
+    ASSERT_FALSE(info.hasROI());
+}
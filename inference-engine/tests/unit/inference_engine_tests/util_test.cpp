@@ -14,6 +14,7 @@
 #include <ie_util_internal.hpp>
 #include <tests_common.hpp>
 #include <graph_transformer.h>
+#include <net_pass.h>
 #include "util_test.hpp"
 #include "graph_tools.hpp"
 #include "gna_graph_tools.hpp"
@@ -119,6 +120,40 @@ TEST(UtilTests, cloneLayers) {
     EXPECT_TRUE(checkLayerCloning<IE::CNNLayer               >());
 }
 
+TEST(UtilTests, getWritableBlobKeepsBlobOwnedByLayer) {
+    IE::WeightableLayer layer(IE::LayerParams{"layer", "dummy", IE::Precision::FP32});
+    auto blob = IE::make_shared_blob<float>(IE::TensorDesc(IE::Precision::FP32, {4}, IE::C));
+    blob->allocate();
+    layer._weights = blob;
+    layer.blobs["weights"] = blob;
+    IE::Blob::Ptr owned = blob;
+    blob.reset();
+
+    EXPECT_EQ(owned, IE::getWritableBlob(layer, "weights"));
+    EXPECT_THROW(IE::getWritableBlob(layer, "biases"), IE::details::InferenceEngineException);
+}
+
+TEST(UtilTests, getWritableBlobCopiesBlobSharedWithClone) {
+    IE::WeightableLayer srclayer(IE::LayerParams{"layer", "dummy", IE::Precision::FP32});
+    auto blob = IE::make_shared_blob<float>(IE::TensorDesc(IE::Precision::FP32, {4}, IE::C));
+    blob->allocate();
+    std::fill_n(blob->buffer().as<float*>(), blob->size(), 1.f);
+    srclayer._weights = blob;
+    srclayer.blobs["weights"] = blob;
+
+    auto cloned = std::dynamic_pointer_cast<IE::WeightableLayer>(IE::clonelayer(srclayer));
+    ASSERT_NE(nullptr, cloned);
+    ASSERT_EQ(srclayer.blobs["weights"], cloned->blobs["weights"]);
+
+    auto writable = IE::getWritableBlob(*cloned, "weights");
+    ASSERT_NE(srclayer.blobs["weights"], writable);
+    EXPECT_EQ(writable, cloned->blobs["weights"]);
+    EXPECT_EQ(writable, cloned->_weights);
+    writable->buffer().as<float*>()[0] = 2.f;
+    EXPECT_EQ(1.f, srclayer._weights->cbuffer().as<const float*>()[0]);
+    EXPECT_EQ(1.f, writable->cbuffer().as<const float*>()[1]);
+}
+
 namespace {
 IE::CNNLayerPtr getLayer(const IE::details::CNNNetworkImplPtr n,
                          const char* name) {
@@ -650,3 +685,44 @@ TEST(UtilTests, replaceLayerWithNewLayer) {
                     layer3Check->insData[1].lock() == data.find("data3")->second);
     }
 }
+
+TEST(UtilTests, pruneOutputs) {
+    //
+    // I1-d1-L1-d2
+    //      \
+    //       L2-d3-L3-d4
+    //
+    auto net = NetBuilder()
+               .data("data1", IE::TensorDesc(IE::Precision::UNSPECIFIED, IE::SizeVector{ 1,1,1 }, IE::Layout::CHW))
+               .data("data2", IE::TensorDesc(IE::Precision::UNSPECIFIED, IE::SizeVector{ 1,1,1 }, IE::Layout::CHW))
+               .data("data3", IE::TensorDesc(IE::Precision::UNSPECIFIED, IE::SizeVector{ 1,1,1 }, IE::Layout::CHW))
+               .data("data4", IE::TensorDesc(IE::Precision::UNSPECIFIED, IE::SizeVector{ 1,1,1 }, IE::Layout::CHW))
+               .layer<IE::CNNLayer>(IE::LayerParams{"input1","Input",IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer1","dummy",IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer2","dummy",IE::Precision::UNSPECIFIED})
+               .layer<IE::CNNLayer>(IE::LayerParams{"layer3","dummy",IE::Precision::UNSPECIFIED})
+
+               .linkToData("input1", "data1")
+               .linkData("data1", "data2", "layer1")
+               .linkData("data1", "data3", "layer2")
+               .linkData("data3", "data4", "layer3")
+               .addInput("data1")
+
+               .finalize();
+
+    ASSERT_THROW(IE::NetPass::PruneOutputs(*net, {"data3"}), IE::details::InferenceEngineException);
+    IE::NetPass::PruneOutputs(*net, {"data2"});
+
+    IE::OutputsDataMap outputs;
+    net->getOutputsInfo(outputs);
+    ASSERT_EQ(1, outputs.size());
+    ASSERT_TRUE(IE::contains(outputs, "data2"));
+    ASSERT_EQ(2, net->layerCount());
+    ASSERT_NE(nullptr, getLayer(net, "input1"));
+    ASSERT_NE(nullptr, getLayer(net, "layer1"));
+    ASSERT_EQ(nullptr, getLayer(net, "layer2"));
+    ASSERT_EQ(nullptr, getLayer(net, "layer3"));
+    auto& consumers = getLayer(net, "input1")->outData[0]->getInputTo();
+    ASSERT_EQ(1, consumers.size());
+    ASSERT_TRUE(IE::contains(consumers, "layer1"));
+}
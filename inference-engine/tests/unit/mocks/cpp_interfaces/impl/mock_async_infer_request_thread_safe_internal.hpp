@@ -60,4 +60,8 @@ public:
 
 	MOCK_METHOD1(SetBatch, void(int));
 	MOCK_METHOD1(SetBatch_ThreadUnsafe, void(int));
+    MOCK_METHOD1(SetPriority_ThreadUnsafe, void(int));
+    MOCK_METHOD0(GetCompletionFd_ThreadUnsafe, int());
+    MOCK_METHOD0(QueryState_ThreadUnsafe, std::vector<IMemoryStateInternal::Ptr>());
+    MOCK_METHOD3(InferBatch_ThreadUnsafe, void(const BlobMap*, BlobMap*, size_t));
 };
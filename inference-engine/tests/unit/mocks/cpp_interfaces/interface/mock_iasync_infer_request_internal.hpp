@@ -24,4 +24,8 @@ public:
     MOCK_CONST_METHOD2(GetPreProcess, void(const char* name, const PreProcessInfo**));
     MOCK_METHOD1(SetCompletionCallback, void(InferenceEngine::IInferRequest::CompletionCallback));
 	MOCK_METHOD1(SetBatch, void(int));
+    MOCK_METHOD1(SetPriority, void(int));
+    MOCK_METHOD0(GetCompletionFd, int());
+    MOCK_METHOD0(QueryState, std::vector<InferenceEngine::IMemoryStateInternal::Ptr>());
+    MOCK_METHOD3(InferBatch, void(const InferenceEngine::BlobMap*, InferenceEngine::BlobMap*, size_t));
 };
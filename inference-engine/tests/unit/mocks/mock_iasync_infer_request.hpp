@@ -30,4 +30,8 @@ public:
     MOCK_QUALIFIED_METHOD3(SetBlob, noexcept, StatusCode(const char*, const Blob::Ptr&, ResponseDesc*));
     MOCK_QUALIFIED_METHOD4(SetBlob, noexcept, StatusCode(const char*, const Blob::Ptr&, const PreProcessInfo&, ResponseDesc*));
 	MOCK_QUALIFIED_METHOD2(SetBatch, noexcept, StatusCode(int batch, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(SetPriority, noexcept, StatusCode(int priority, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(GetCompletionFd, noexcept, StatusCode(int&, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD3(QueryState, noexcept, StatusCode(IMemoryState::Ptr&, size_t, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD4(InferBatch, noexcept, StatusCode(const BlobMap*, BlobMap*, size_t, ResponseDesc*));
 };
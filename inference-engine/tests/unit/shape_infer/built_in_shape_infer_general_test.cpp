@@ -616,6 +616,14 @@ INSTANTIATE_TEST_CASE_P(
                                       MapParams(MapStrStr()),
                                       LayerDataName("data"),
                                       CanInfer(true)),
+                ::testing::make_tuple(LayerType("CTCBeamSearchDecoder"),
+                                      InOutShapes({{{88, 1, 71}, {88, 1}},
+                                                   {{1,  88, 1, 1}}}),
+                                      NewInOutShapes({{{88, 2, 71}, {88, 2}},
+                                                      {{2,  88, 1,  1}}}),
+                                      MapParams(MapStrStr(std::map<std::string, std::string>{{"beam_width", "8"}})),
+                                      LayerDataName("data"),
+                                      CanInfer(true)),
                 ::testing::make_tuple(LayerType("Reshape"),
                                       InOutShapes({{{1, 2}},
                                                    {{1, 1}}}),
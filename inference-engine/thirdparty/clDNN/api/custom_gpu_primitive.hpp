@@ -60,6 +60,7 @@ struct custom_gpu_primitive : public primitive_base<custom_gpu_primitive> {
     /// @param output_layout Output layout declared by the primitive
     /// @param gws Global work sizes
     /// @param lws Local work sizes
+    /// @param tune_local_work_size Search the local work sizes with the on-line tuning, @p lws is used if it is disabled
     custom_gpu_primitive(const primitive_id& id,
                          const std::vector<primitive_id>& input,
                          const std::vector<std::string>& kernels_code,
@@ -68,7 +69,8 @@ struct custom_gpu_primitive : public primitive_base<custom_gpu_primitive> {
                          const std::string& build_options,
                          const layout& output_layout,
                          const std::vector<size_t>& gws = {},
-                         const std::vector<size_t>& lws = {})
+                         const std::vector<size_t>& lws = {},
+                         bool tune_local_work_size = false)
         : primitive_base(id, {input}, output_layout.data_padding),
           kernel_entry_point(kernel_entry_point),
           kernel_arguments(kernel_arguments),
@@ -76,6 +78,7 @@ struct custom_gpu_primitive : public primitive_base<custom_gpu_primitive> {
           output_layout(output_layout),
           gws(gws.size() ? gws : std::vector<size_t>{output_layout.count()}),
           lws(lws),
+          tune_local_work_size(tune_local_work_size),
           kernels_code(kernels_code) {}
 
     /// @brief The name of the entry point function in the kernel
@@ -90,6 +93,8 @@ struct custom_gpu_primitive : public primitive_base<custom_gpu_primitive> {
     const std::vector<size_t> gws;
     /// @brief The local working sizes
     const std::vector<size_t> lws;
+    /// @brief The local working sizes are chosen by the on-line tuning
+    const bool tune_local_work_size;
     /// @brief Source code for the kernel
     const primitive_id_arr kernels_code;
 };
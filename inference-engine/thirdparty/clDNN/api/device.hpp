@@ -51,6 +51,8 @@ struct device_info {
     uint8_t supports_imad;   ///< Does engine support int8 mad.
     uint8_t supports_immad;  ///< Does engine support int8 multi mad.
 
+    uint8_t supports_host_unified_memory;  ///< Does engine share the memory with the host (integrated GPU).
+
     std::string dev_name;     ///< Device ID string
     std::string driver_version;  ///< Version of OpenCL driver
 };
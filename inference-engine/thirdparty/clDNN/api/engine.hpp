@@ -73,6 +73,20 @@ struct engine_configuration {
                                           ///< (switched off for older drivers then NEO).
     uint16_t n_streams;                   ///< Number of queues executed in parallel
     const std::string tuning_cache_path;  ///< Path to tuning kernel cache
+    uint16_t n_compilation_threads;       ///< Number of threads OpenCL programs are built with (0 means hardware concurrency)
+    uint32_t kernels_per_program;         ///< Maximum number of kernels batched into a single OpenCL program
+    const std::string kernels_cache_dir;  ///< Directory the built OpenCL programs are cached in between the runs.
+                                          ///< Empty by default (means no caching).
+    uint64_t kernels_cache_max_size;      ///< Size limit of the kernels cache directory in bytes, the least recently
+                                          ///< used programs are evicted above it (0 means no limit)
+    bool out_of_order_execution;          ///< Synchronizes the primitives with the events of their dependencies instead
+                                          ///< of barriers, so independent primitives overlap (NEO driver only).
+    bool enable_memory_arena;             ///< Places the reusable intermediate buffers of a network at offsets of a single
+                                          ///< allocation, packed by size and lifetime (requires the memory pool).
+    bool lazy_kernels_compilation;        ///< Builds the OpenCL programs in the background after the program is built,
+                                          ///< a kernel which is not built yet is built when it runs for the first time.
+    uint16_t n_host_threads;              ///< Number of threads the primitives implemented on the host run on, so the
+                                          ///< network is enqueued while they wait (0 means they run while it is enqueued)
 
     /// @brief Constructs engine configuration with specified options.
     /// @param profiling Enable per-primitive profiling.
@@ -93,7 +107,15 @@ struct engine_configuration {
         throttle_mode_types throttle_mode = throttle_mode_types::disabled,
         bool memory_pool = true,
         uint16_t n_streams = 1,
-        const std::string& tuning_cache_path = "cache.json")
+        const std::string& tuning_cache_path = "cache.json",
+        uint16_t n_compilation_threads = 0,
+        uint32_t kernels_per_program = 10,
+        const std::string& kernels_cache_dir = std::string(),
+        uint64_t kernels_cache_max_size = 0,
+        bool out_of_order_execution = false,
+        bool memory_arena = false,
+        bool lazy_kernels_compilation = false,
+        uint16_t n_host_threads = 0)
         : enable_profiling(profiling)
         , meaningful_kernels_names(decorate_kernel_names)
         , dump_custom_program(dump_custom_program)
@@ -106,13 +128,32 @@ struct engine_configuration {
         , throttle_mode(throttle_mode)
         , enable_memory_pool(memory_pool)
         , n_streams(n_streams)
-        , tuning_cache_path(tuning_cache_path) {
+        , tuning_cache_path(tuning_cache_path)
+        , n_compilation_threads(n_compilation_threads)
+        , kernels_per_program(kernels_per_program)
+        , kernels_cache_dir(kernels_cache_dir)
+        , kernels_cache_max_size(kernels_cache_max_size)
+        , out_of_order_execution(out_of_order_execution)
+        , enable_memory_arena(memory_arena)
+        , lazy_kernels_compilation(lazy_kernels_compilation)
+        , n_host_threads(n_host_threads) {
         if (n_streams == 0) {
             throw std::invalid_argument("Invalid streams count set in engine config");
         }
+        if (kernels_per_program == 0) {
+            throw std::invalid_argument("Invalid kernels per program count set in engine config");
+        }
     }
 };
 
+/// @brief Statistics of the on-disk cache of built OpenCL programs.
+struct kernels_cache_statistics {
+    uint64_t hits = 0;       ///< Number of programs loaded from the cache.
+    uint64_t misses = 0;     ///< Number of programs built from sources and stored to the cache.
+    uint64_t evictions = 0;  ///< Number of programs removed to keep the cache within its size limit.
+    uint64_t size = 0;       ///< Size of the cache directory in bytes as of the last build.
+};
+
 struct engine_impl;
 
 /// @brief Represents clDNN engine object.
@@ -169,6 +210,9 @@ struct engine {
     /// @brief Returns total size of currently resources allocated using given engine
     uint64_t get_temp_used_device_memory_size() const;
 
+    /// @brief Returns statistics of the on-disk kernels cache set with engine_configuration::kernels_cache_dir.
+    kernels_cache_statistics get_kernels_cache_statistics() const;
+
     /// @brief Returns type of the engine.
     engine_types get_type() const;
 
@@ -53,7 +53,10 @@ enum class shared_mem_type {
     shared_mem_vasurface,
 
     /// @brief Structure describes shared D3D11 buffer
-    shared_mem_dxbuffer
+    shared_mem_dxbuffer,
+
+    /// @brief Structure describes user host memory used in place by the device
+    shared_mem_host_ptr
 };
 
 using shared_handle = void*;
@@ -86,6 +89,14 @@ struct memory {
     /// Create shared memory object on @p engine using user-supplied memory buffer @p buf using specified @p layout
     static memory share_buffer(const engine& engine, const layout& layout, shared_handle buf, uint32_t net_id = 0);
 
+    /// Create memory object on @p engine using user-allocated host memory @p ptr in place (CL_MEM_USE_HOST_PTR).
+    /// The memory is not copied on the devices sharing the memory with the host, if @p ptr is aligned to
+    /// @ref host_ptr_alignment.
+    static memory share_host_ptr(const engine& engine, const layout& layout, void* ptr, uint32_t net_id = 0);
+
+    /// The alignment of the host memory which the integrated devices use without the copy.
+    static constexpr size_t host_ptr_alignment = 4096;
+
     /// Create shared memory object on @p engine using user-supplied 2D image @p img using specified @p layout
     static memory share_image(const engine& engine, const layout& layout, shared_handle img, uint32_t net_id = 0);
 
@@ -113,6 +113,15 @@ struct network {
     /// @brief Provides user-supplied @ref memory for output primitives defined by user in source @ref topology.
     void set_output_memory(const primitive_id& id, const memory& mem) const;
 
+    /// @brief Enqueues a copy of host data to the buffer @p mem allocated by the network's engine, without
+    /// waiting for it. The host data must stay unchanged until the returned event is complete; passing the event
+    /// to @ref execute() makes the network wait for the copy on the device.
+    event copy_from_host(const memory& mem, const void* src) const;
+
+    /// @brief Enqueues a copy of the buffer @p mem to host memory after the @p dependency is complete,
+    /// without waiting for it. The host memory is valid once the returned event is complete.
+    event copy_to_host(const memory& mem, void* dst, const event& dependency) const;
+
     /// @brief Sets learning rate for training primitives.
     void set_learning_rate(const float lr);
 
@@ -125,6 +134,9 @@ struct network {
     /// @brief Return internal network id.
     uint32_t get_id();
 
+    /// @brief Returns peak size of the device memory allocated for this network.
+    uint64_t get_max_used_device_memory_size() const;
+
     std::string get_primitive_info(const primitive_id& id) const;
 
     /// @brief Returns description of final runtime graph
@@ -131,7 +131,8 @@ struct primitive_info {
                    const std::string& layout_str,
                    const std::string& kernel_id,
                    bool is_cpu,
-                   int exec_id)
+                   int exec_id,
+                   const std::vector<std::string>& fused_ops = {})
         : original_id(original_id),
           type_id(type_id),
           c_dependencies(dependencies),
@@ -141,7 +142,8 @@ struct primitive_info {
           layout_str(layout_str),
           kernel_id(kernel_id),
           is_cpu(is_cpu),
-          exec_id(exec_id) {}
+          exec_id(exec_id),
+          c_fused_ops(fused_ops) {}
 
     primitive_id original_id;
     std::string type_id;
@@ -153,6 +155,8 @@ struct primitive_info {
     std::string kernel_id;
     bool is_cpu;
     int exec_id;
+    /// @brief Types of the primitives attached to this one as post-ops, in the order they are applied.
+    std::vector<std::string> c_fused_ops;
 };
 
 #define CLDNN_DEFINE_TYPE_ID(PType)     \
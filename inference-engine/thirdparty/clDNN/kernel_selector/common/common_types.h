@@ -78,7 +78,8 @@ enum class KernelType {
     LSTM_DYNAMIC_INPUT,
     LSTM_DYNAMIC_TIMELOOP,
     REDUCE,
-    GATHER_TREE
+    GATHER_TREE,
+    NON_MAX_SUPPRESSION
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
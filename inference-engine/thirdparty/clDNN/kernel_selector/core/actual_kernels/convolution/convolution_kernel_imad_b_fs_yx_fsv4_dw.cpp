@@ -0,0 +1,114 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "convolution_kernel_imad_b_fs_yx_fsv4_dw.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+#include <vector>
+
+namespace kernel_selector {
+
+namespace {
+    constexpr size_t fsv = 4;
+}  // namespace
+
+ParamsKey ConvolutionKernel_imad_b_fs_yx_fsv4_dw::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::INT8);
+    k.EnableInputDataType(Datatype::UINT8);
+    k.EnableOutputDataType(Datatype::INT8);
+    k.EnableOutputDataType(Datatype::UINT8);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableInputWeightsType(WeightsType::INT8);
+    k.EnableInputLayout(DataLayout::b_fs_yx_fsv4);
+    k.EnableOutputLayout(DataLayout::b_fs_yx_fsv4);
+    k.EnableTensorOffset();
+    k.EnableTensorPitches();
+    k.EnableDilation();
+    k.EnableBiasPerFeature();
+    k.EnableNonBiasTerm();
+    k.EnableBatching();
+    k.EnableQuantization(QuantizationType::SYMMETRIC);
+    k.EnableDifferentTypes();
+    k.EnableDifferentInputWeightsTypes();
+    k.EnableGroupedConvolution();
+    k.EnableDepthwiseSeparableOpt();
+    k.DisableTuning();
+    return k;
+}
+
+bool ConvolutionKernel_imad_b_fs_yx_fsv4_dw::Validate(const Params& p, const optional_params& o) const {
+    if (!Parent::Validate(p, o)) {
+        return false;
+    }
+
+    auto params = dynamic_cast<const convolution_params&>(p);
+
+    // Groups are processed in a single kernel, which reads weights of all the groups at once
+    if (params.groups == 1 || !params.depthwise_separable_opt || params.split != 1)
+        return false;
+
+    return true;
+}
+
+ConvolutionKernelBase::DispatchData ConvolutionKernel_imad_b_fs_yx_fsv4_dw::SetDefault(const convolution_params& cp,
+                                                                                       int /*autoTuneIndex*/) const {
+    DispatchData runInfo = ConvolutionKernelBase::SetDefault(cp);
+
+    std::vector<size_t> global = {cp.output.X().v * cp.output.Y().v,
+                                  CeilDiv(cp.output.Feature().v, fsv),
+                                  cp.output.Batch().v};
+
+    runInfo.gws0 = global[0];
+    runInfo.gws1 = global[1];
+    runInfo.gws2 = global[2];
+
+    auto local = GetOptimalLocalWorkGroupSizes(global, cp.engineInfo);
+    runInfo.lws0 = local[0];
+    runInfo.lws1 = local[1];
+    runInfo.lws2 = local[2];
+
+    runInfo.effiency = FORCE_PRIORITY_2;
+
+    return runInfo;
+}
+
+JitConstants ConvolutionKernel_imad_b_fs_yx_fsv4_dw::GetJitConstants(const convolution_params& params,
+                                                                     const DispatchData& runInfo) const {
+    auto jit = Parent::GetJitConstants(params, runInfo);
+
+    // Depthwise convolution reads the input features of the whole output slice with a single load
+    const bool depthwise = params.weights.IFM().v == 1 && params.weights.OFM().v == 1;
+    jit.AddConstant(MakeJitConstant("DEPTHWISE", depthwise));
+    jit.AddConstant(MakeJitConstant("FILTER_TAPS_NUM", params.weights.IFM().v * params.filterSize.x * params.filterSize.y));
+
+    if (!params.fused_ops.empty()) {
+        auto input_dt = GetActivationType(params);
+        FusedOpsConfiguration conf_scalar = {"", {"b", "of", "y", "x"}, "res", input_dt, 1 };
+        jit.Merge(MakeFusedOpsJitConstants(params, {conf_scalar}));
+    }
+
+    return jit;
+}
+
+KernelsData ConvolutionKernel_imad_b_fs_yx_fsv4_dw::GetKernelsData(const Params& params,
+                                                                   const optional_params& options) const {
+    KernelsData kd = GetTunedKernelsDataByIndex(params, options);
+    if (!kd.empty())
+        kd[0].estimatedTime = FORCE_PRIORITY_2;
+    return kd;
+}
+
+}  // namespace kernel_selector
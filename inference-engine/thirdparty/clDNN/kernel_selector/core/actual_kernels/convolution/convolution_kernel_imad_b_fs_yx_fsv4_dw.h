@@ -0,0 +1,50 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "convolution_kernel_base.h"
+#include <vector>
+
+namespace kernel_selector {
+
+// Depthwise and grouped int8 convolution in b_fs_yx_fsv4 layout.
+// Every work-item calculates one fsv4 slice of output features and accumulates the filter taps with IMAD,
+// four taps at once, so quantized networks don't have to leave the blocked layout at depthwise layers.
+class ConvolutionKernel_imad_b_fs_yx_fsv4_dw : public ConvolutionKernelBase {
+public:
+    using Parent = ConvolutionKernelBase;
+    ConvolutionKernel_imad_b_fs_yx_fsv4_dw() : ConvolutionKernelBase("convolution_gpu_imad_b_fs_yx_fsv4_dw") {}
+    virtual ~ConvolutionKernel_imad_b_fs_yx_fsv4_dw() {}
+
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+protected:
+    bool Validate(const Params& p, const optional_params& o) const override;
+    DispatchData SetDefault(const convolution_params& arg, int autoTuneIndex = -1) const override;
+    JitConstants GetJitConstants(const convolution_params& params, const DispatchData& kd) const override;
+    std::vector<WeightsLayout> GetSupportedWeightLayouts(const convolution_params&) const override {
+        return {
+            WeightsLayout::oiyx,
+        };
+    }
+    std::vector<FusedOpType> GetSupportedFusedOps() const override {
+        return { FusedOpType::ELTWISE,
+                 FusedOpType::QUANTIZE,
+                 FusedOpType::SCALE,
+                 FusedOpType::ACTIVATION };
+    }
+};
+}  // namespace kernel_selector
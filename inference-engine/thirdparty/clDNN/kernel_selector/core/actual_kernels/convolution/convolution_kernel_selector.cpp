@@ -64,6 +64,7 @@
 #include "convolution_kernel_af32_imad_1x1.h"
 #include "convolution_kernel_b_fs_yx_fsv4_1x1.h"
 #include "convolution_kernel_mmad_bfyx_to_b_fs_yx_fsv4.h"
+#include "convolution_kernel_imad_b_fs_yx_fsv4_dw.h"
 #include "convolution_kernel_mmad_b_fs_yx_fsv32.h"
 #include "convolution_kernel_mmad_b_fs_yx_fsv32_dw.h"
 #include "convolution_kernel_mmad_bfyx_b_fs_yx_fsv32.h"
@@ -132,6 +133,7 @@ convolution_kernel_selector::convolution_kernel_selector() {
     Attach<ConvolutionKernel_imad>();
     Attach<ConvolutionKernel_b_fs_yx_fsv4_1x1>();
     Attach<ConvolutionKernel_MMAD_bfyx_to_b_fs_yx_fsv4>();
+    Attach<ConvolutionKernel_imad_b_fs_yx_fsv4_dw>();
 
     // b_fs_yx_fsv32 kernels
     Attach<ConvolutionKernel_MMAD_b_fs_yx_fsv32>();
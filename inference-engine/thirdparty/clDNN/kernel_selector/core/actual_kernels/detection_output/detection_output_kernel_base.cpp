@@ -43,6 +43,9 @@ JitConstants DetectionOutputKernelBase::GetJitConstants(const detection_output_p
         MakeJitConstant("PRIOR_COORD_OFFSET", detectOutParams.prior_coordinates_offset),
         MakeJitConstant("PRIOR_INFO_SIZE", detectOutParams.prior_info_size),
         MakeJitConstant("PRIOR_IS_NORMALIZED", detectOutParams.prior_is_normalized),
+        MakeJitConstant("DECREASE_LABEL_ID", detectOutParams.decrease_label_id),
+        MakeJitConstant("CLIP_BEFORE_NMS", detectOutParams.clip_before_nms),
+        MakeJitConstant("CLIP_AFTER_NMS", detectOutParams.clip_after_nms),
     });
 
     return jit;
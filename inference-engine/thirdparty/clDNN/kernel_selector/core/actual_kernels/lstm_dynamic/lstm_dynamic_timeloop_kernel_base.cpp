@@ -85,7 +85,7 @@ JitConstants LSTM_DynamicTimeloopKernelBase::GetJitConstants(const lstm_dynamic_
 }
 
 LSTM_DynamicTimeloopKernelBase::DispatchData LSTM_DynamicTimeloopKernelBase::SetDefault(
-    const lstm_dynamic_timeloop_params& params) {
+    const lstm_dynamic_timeloop_params& params) const {
     DispatchData kd;
     const auto& out = params.output;
     kd.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
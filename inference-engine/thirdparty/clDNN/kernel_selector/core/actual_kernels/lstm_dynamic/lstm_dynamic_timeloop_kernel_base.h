@@ -102,7 +102,7 @@ public:
 
 protected:
     virtual JitConstants GetJitConstants(const lstm_dynamic_timeloop_params& params) const;
-    static DispatchData SetDefault(const lstm_dynamic_timeloop_params& params);
+    virtual DispatchData SetDefault(const lstm_dynamic_timeloop_params& params) const;
     KernelsData GetCommonKernelsData(const Params& params,
                                      const optional_params& optParams,
                                      float estimated_time) const;
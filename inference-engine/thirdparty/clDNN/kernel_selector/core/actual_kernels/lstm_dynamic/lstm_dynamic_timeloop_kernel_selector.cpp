@@ -16,10 +16,12 @@
 
 #include "lstm_dynamic_timeloop_kernel_selector.h"
 #include "lstm_dynamic_timeloop_ref_kernel.h"
+#include "lstm_dynamic_timeloop_slm_kernel.h"
 
 namespace kernel_selector {
 lstm_dynamic_timeloop_kernel_selector::lstm_dynamic_timeloop_kernel_selector() {
     Attach<LSTM_DynamicTimeloopKernelRef>();
+    Attach<LSTM_DynamicTimeloopKernelSLM>();
 }
 
 KernelsData lstm_dynamic_timeloop_kernel_selector::GetBestKernels(const Params& params,
@@ -0,0 +1,111 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "lstm_dynamic/lstm_dynamic_timeloop_slm_kernel.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+#include <algorithm>
+
+namespace kernel_selector {
+namespace {
+// Each work item keeps the gates and the cell state of that many hidden elements in registers.
+constexpr size_t max_elements_per_item = 8;
+
+size_t GetLocalSize(const lstm_dynamic_timeloop_params& params) {
+    const size_t hidden_size = params.output.X().v;
+    return std::min<size_t>(hidden_size, std::min<size_t>(params.engineInfo.maxWorkGroupSize, 256));
+}
+
+size_t GetHiddenSlmSize(const lstm_dynamic_timeloop_params& params) {
+    return params.output.X().v * sizeof(float);
+}
+
+size_t GetRecurrentSlmSize(const lstm_dynamic_timeloop_params& params) {
+    const size_t hidden_size = params.output.X().v;
+    return 4 * hidden_size * hidden_size * BytesPerElement(params.recurrent.GetDType());
+}
+
+bool RecurrentFitsSlm(const lstm_dynamic_timeloop_params& params) {
+    return GetHiddenSlmSize(params) + GetRecurrentSlmSize(params) <= params.engineInfo.maxLocalMemSize;
+}
+}  // namespace
+
+ParamsKey LSTM_DynamicTimeloopKernelSLM::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+    k.EnableDifferentTypes();
+    k.EnableTensorOffset();
+    k.EnableTensorPitches();
+    k.EnableBatching();
+    k.EnableLSTMEltCell();
+    k.EnableLSTMGEMMHidden();
+    k.EnableLSTMDyanmicOptionalCellOutput();
+    k.EnableLSTMDyanmicOptionalHiddenOutput();
+    return k;
+}
+
+bool LSTM_DynamicTimeloopKernelSLM::Validate(const Params& p, const optional_params& o) const {
+    if (!LSTM_DynamicTimeloopKernelBase::Validate(p, o)) {
+        return false;
+    }
+
+    const lstm_dynamic_timeloop_params& params = static_cast<const lstm_dynamic_timeloop_params&>(p);
+    const size_t hidden_size = params.output.X().v;
+    if (hidden_size == 0 || CeilDiv(hidden_size, GetLocalSize(params)) > max_elements_per_item) {
+        return false;
+    }
+
+    return GetHiddenSlmSize(params) <= params.engineInfo.maxLocalMemSize;
+}
+
+JitConstants LSTM_DynamicTimeloopKernelSLM::GetJitConstants(const lstm_dynamic_timeloop_params& params) const {
+    JitConstants jit = LSTM_DynamicTimeloopKernelBase::GetJitConstants(params);
+
+    const size_t local_size = GetLocalSize(params);
+    jit.AddConstants({
+        MakeJitConstant("LOCAL_SIZE", local_size),
+        MakeJitConstant("ELEMENTS_PER_ITEM", CeilDiv(params.output.X().v, local_size)),
+        MakeJitConstant("RECURRENT_IN_SLM", RecurrentFitsSlm(params)),
+    });
+
+    return jit;
+}
+
+LSTM_DynamicTimeloopKernelBase::DispatchData LSTM_DynamicTimeloopKernelSLM::SetDefault(
+    const lstm_dynamic_timeloop_params& params) const {
+    DispatchData kd;
+    kd.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
+
+    kd.gws0 = GetLocalSize(params);
+    kd.gws1 = params.output.Batch().v;
+    kd.gws2 = static_cast<size_t>(params.direction);
+
+    kd.lws0 = kd.gws0;
+    kd.lws1 = 1;
+    kd.lws2 = 1;
+
+    return kd;
+}
+
+KernelsData LSTM_DynamicTimeloopKernelSLM::GetKernelsData(const Params& params, const optional_params& options) const {
+    return GetCommonKernelsData(params, options, FORCE_PRIORITY_5);
+}
+}  // namespace kernel_selector
@@ -0,0 +1,37 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "lstm_dynamic_timeloop_kernel_base.h"
+
+namespace kernel_selector {
+// One work group runs all the timesteps of a batch and a direction, the hidden state stays in SLM
+// and the recurrent weights are loaded to SLM once when they fit.
+class LSTM_DynamicTimeloopKernelSLM : public LSTM_DynamicTimeloopKernelBase {
+public:
+    LSTM_DynamicTimeloopKernelSLM() : LSTM_DynamicTimeloopKernelBase("lstm_dynamic_timeloop_slm") {}
+
+    virtual ~LSTM_DynamicTimeloopKernelSLM() {}
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+
+protected:
+    ParamsKey GetSupportedKey() const override;
+    JitConstants GetJitConstants(const lstm_dynamic_timeloop_params& params) const override;
+    DispatchData SetDefault(const lstm_dynamic_timeloop_params& params) const override;
+    bool Validate(const Params& p, const optional_params& o) const override;
+};
+}  // namespace kernel_selector
@@ -0,0 +1,191 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "non_max_suppression_kernel_ref.h"
+#include "kernel_selector_utils.h"
+#include <algorithm>
+#include <string>
+
+namespace kernel_selector {
+namespace {
+const std::string merge_kernel_name = "non_max_suppression_gpu_ref_merge";
+
+// Each box sorted in SLM takes its score and its index.
+constexpr size_t sort_item_size = sizeof(float) + sizeof(int32_t);
+
+size_t GetSortSize(const non_max_suppression_params& params) {
+    size_t sort_size = 1;
+    while (sort_size < params.inputs[0].Feature().v)
+        sort_size *= 2;
+    return sort_size;
+}
+
+size_t GetSortLocalSize(const non_max_suppression_params& params) {
+    size_t lws = std::min(GetSortSize(params) / 2, std::min<size_t>(params.engineInfo.maxWorkGroupSize, 256));
+    return std::max<size_t>(lws, 1);
+}
+
+size_t GetMaxSelectedPerClass(const non_max_suppression_params& params) {
+    return std::min(params.inputs[0].Feature().v, params.output.Batch().v);
+}
+
+size_t GetClassesTotal(const non_max_suppression_params& params) {
+    return params.inputs[1].Batch().v * params.inputs[1].Feature().v;
+}
+}  // namespace
+
+ParamsKey NonMaxSuppressionKernelRef::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableInputDataType(Datatype::INT32);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::INT32);
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+    k.EnableBatching();
+    k.EnableDifferentTypes();
+    return k;
+}
+
+bool NonMaxSuppressionKernelRef::Validate(const Params& p, const optional_params& o) const {
+    if (p.GetType() != KernelType::NON_MAX_SUPPRESSION || o.GetType() != KernelType::NON_MAX_SUPPRESSION) {
+        return false;
+    }
+
+    const non_max_suppression_params& params = static_cast<const non_max_suppression_params&>(p);
+    const size_t inputs_num = 2 + params.has_num_select_per_class + params.has_iou_threshold + params.has_score_threshold;
+    if (params.inputs.size() != inputs_num) {
+        return false;
+    }
+
+    // The kernels address the boxes, the scores and the output rows linearly.
+    if (params.inputs[0].PitchesDifferFromLogicalDims() || params.inputs[1].PitchesDifferFromLogicalDims() ||
+        params.output.PitchesDifferFromLogicalDims()) {
+        return false;
+    }
+
+    if (params.inputs[0].Batch().v != params.inputs[1].Batch().v || params.inputs[0].Feature().v == 0 ||
+        params.inputs[0].Feature().v != params.inputs[1].Y().v || params.output.Batch().v == 0) {
+        return false;
+    }
+
+    // The boxes of one class are sorted in SLM, the CPU implementation takes the larger inputs.
+    if (GetSortSize(params) * sort_item_size + 4 * sizeof(int32_t) > params.engineInfo.maxLocalMemSize) {
+        return false;
+    }
+
+    return true;
+}
+
+JitConstants NonMaxSuppressionKernelRef::GetJitConstants(const non_max_suppression_params& params) const {
+    JitConstants jit = MakeBaseParamsJitConstants(params);
+
+    jit.AddConstants({
+        MakeJitConstant("NUM_BATCHES", params.inputs[0].Batch().v),
+        MakeJitConstant("NUM_BOXES", params.inputs[0].Feature().v),
+        MakeJitConstant("NUM_CLASSES", params.inputs[1].Feature().v),
+        MakeJitConstant("SORT_SIZE", GetSortSize(params)),
+        MakeJitConstant("LOCAL_SIZE", GetSortLocalSize(params)),
+        MakeJitConstant("MAX_SELECTED_PER_CLASS", GetMaxSelectedPerClass(params)),
+        MakeJitConstant("NUM_SELECTED_INDICES", params.output.Batch().v),
+        MakeJitConstant("CENTER_POINT_BOX", params.center_point_box),
+    });
+
+    uint32_t input_idx = 2;
+    if (params.has_num_select_per_class) {
+        jit.AddConstant(MakeJitConstant("NUM_SELECT_PER_CLASS_TYPE", "INPUT" + std::to_string(input_idx++) + "_TYPE"));
+    }
+    if (params.has_iou_threshold) {
+        jit.AddConstant(MakeJitConstant("IOU_THRESHOLD_TYPE", "INPUT" + std::to_string(input_idx++) + "_TYPE"));
+    }
+    if (params.has_score_threshold) {
+        jit.AddConstant(MakeJitConstant("SCORE_THRESHOLD_TYPE", "INPUT" + std::to_string(input_idx++) + "_TYPE"));
+    }
+
+    return jit;
+}
+
+KernelsData NonMaxSuppressionKernelRef::GetKernelsData(const Params& params, const optional_params& options) const {
+    if (!Validate(params, options)) {
+        return {};
+    }
+
+    KernelData kd = KernelData::Default<non_max_suppression_params>(params, 2);
+    const non_max_suppression_params& nmsParams = static_cast<const non_max_suppression_params&>(params);
+
+    const size_t classes_total = GetClassesTotal(nmsParams);
+    const size_t selected_total = classes_total * GetMaxSelectedPerClass(nmsParams);
+    // The scores and the indices of the boxes selected in each class, and the number of the selected boxes
+    kd.internalBufferSizes.push_back(selected_total * sizeof(float));
+    kd.internalBufferSizes.push_back(selected_total * sizeof(int32_t));
+    kd.internalBufferSizes.push_back(classes_total * sizeof(int32_t));
+    kd.intenralBufferDataType = Datatype::F32;
+
+    auto cldnnJit = GetJitConstants(nmsParams);
+
+    {
+        CommonDispatchData runInfo;
+        runInfo.fp16UnitUsed = nmsParams.inputs[0].GetDType() == Datatype::F16;
+        runInfo.gws0 = GetSortLocalSize(nmsParams);
+        runInfo.gws1 = nmsParams.inputs[1].Feature().v;
+        runInfo.gws2 = nmsParams.inputs[1].Batch().v;
+        runInfo.lws0 = runInfo.gws0;
+        runInfo.lws1 = 1;
+        runInfo.lws2 = 1;
+
+        auto entryPoint = GetEntryPoint(kernelName, nmsParams.layerID, options);
+        auto jit = CreateJit(kernelName, cldnnJit, entryPoint);
+
+        auto& kernel = kd.kernels[0];
+        FillCLKernelData(kernel, runInfo, params.engineInfo, kernelName, jit, entryPoint);
+        kernel.arguments.clear();
+        for (uint32_t i = 0; i < static_cast<uint32_t>(nmsParams.inputs.size()); i++) {
+            kernel.arguments.push_back({ArgumentDescriptor::Types::INPUT, i});
+        }
+        for (uint32_t i = 0; i < 3; i++) {
+            kernel.arguments.push_back({ArgumentDescriptor::Types::INTERNAL_BUFFER, i});
+        }
+    }
+
+    {
+        // One work item per selected box ranks it, the first NUM_SELECTED_INDICES ones also pad the output.
+        CommonDispatchData runInfo;
+        runInfo.fp16UnitUsed = nmsParams.inputs[0].GetDType() == Datatype::F16;
+        const size_t items = std::max(selected_total, nmsParams.output.Batch().v);
+        runInfo.lws0 = std::min<size_t>(std::min<size_t>(params.engineInfo.maxWorkGroupSize, 256), items);
+        runInfo.gws0 = Align(items, runInfo.lws0);
+        runInfo.gws1 = 1;
+        runInfo.gws2 = 1;
+        runInfo.lws1 = 1;
+        runInfo.lws2 = 1;
+
+        auto entryPoint = GetEntryPoint(merge_kernel_name, nmsParams.layerID, options);
+        auto jit = CreateJit(merge_kernel_name, cldnnJit, entryPoint);
+
+        auto& kernel = kd.kernels[1];
+        FillCLKernelData(kernel, runInfo, params.engineInfo, merge_kernel_name, jit, entryPoint);
+        kernel.arguments.clear();
+        for (uint32_t i = 0; i < 3; i++) {
+            kernel.arguments.push_back({ArgumentDescriptor::Types::INTERNAL_BUFFER, i});
+        }
+        kernel.arguments.push_back({ArgumentDescriptor::Types::OUTPUT, 0});
+    }
+
+    kd.estimatedTime = FORCE_PRIORITY_9;
+
+    return {kd};
+}
+}  // namespace kernel_selector
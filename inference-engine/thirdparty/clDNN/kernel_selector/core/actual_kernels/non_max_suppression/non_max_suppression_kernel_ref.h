@@ -0,0 +1,63 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "common_kernel_base.h"
+
+namespace kernel_selector {
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// non_max_suppression_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct non_max_suppression_params : public base_params {
+    non_max_suppression_params() : base_params(KernelType::NON_MAX_SUPPRESSION),
+    center_point_box(false), has_num_select_per_class(false), has_iou_threshold(false), has_score_threshold(false) {}
+
+    bool center_point_box;
+    // the optional inputs follow the boxes and the scores in this order
+    bool has_num_select_per_class;
+    bool has_iou_threshold;
+    bool has_score_threshold;
+
+    virtual ParamsKey GetParamsKey() const { return base_params::GetParamsKey(); }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// non_max_suppression_optional_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct non_max_suppression_optional_params : optional_params {
+    non_max_suppression_optional_params() : optional_params(KernelType::NON_MAX_SUPPRESSION) {}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// NonMaxSuppressionKernelRef
+//
+// The first kernel runs one work group per class of an image: it sorts the boxes above the score threshold in SLM by
+// the bitonic sort and suppresses the ones overlapping the selected boxes in parallel, keeping the selected boxes of
+// each class in the internal buffers. The second kernel ranks the selected boxes of all classes by their scores and
+// writes the output, so only the selected indices leave the device.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class NonMaxSuppressionKernelRef : public common_kernel_base {
+public:
+    NonMaxSuppressionKernelRef() : common_kernel_base("non_max_suppression_gpu_ref") {}
+    virtual ~NonMaxSuppressionKernelRef() {}
+
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+protected:
+    bool Validate(const Params& p, const optional_params& o) const override;
+    JitConstants GetJitConstants(const non_max_suppression_params& params) const;
+};
+}  // namespace kernel_selector
@@ -14,6 +14,7 @@
 
 
 #include "auto_tuner.h"
+#include <cstdio>
 #include <iostream>
 #include <sstream>
 #include <fstream>
@@ -96,7 +97,10 @@ void AutoTuner::StoreKernel(const std::string& cacheFilePath,
     auto cache = onlineCache->GetObject();
     cache[computeUnitsStr.c_str()].AddMember(hashStr, dataArray, allocator);
 
-    std::ofstream cachedKernelsFile(cacheFilePath);
+    // The file is written under a temporary name and renamed, so the processes using the tuning file
+    // (e.g. the ones serving the network while it is tuned in the background) never read a partial one.
+    const std::string tmpFilePath = cacheFilePath + ".tmp";
+    std::ofstream cachedKernelsFile(tmpFilePath);
     rapidjson::StringBuffer buffer(0, 1024);
     rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
     writer.SetFormatOptions(rapidjson::PrettyFormatOptions::kFormatSingleLineArray);
@@ -104,6 +108,14 @@ void AutoTuner::StoreKernel(const std::string& cacheFilePath,
     auto temp = buffer.GetString();
     cachedKernelsFile << temp;
     cachedKernelsFile.close();
+#ifdef _WIN32
+    // rename does not replace the existing files on Windows
+    std::remove(cacheFilePath.c_str());
+#endif
+    if (std::rename(tmpFilePath.c_str(), cacheFilePath.c_str()) != 0) {
+        std::remove(tmpFilePath.c_str());
+        throw std::runtime_error("Tuning file: " + cacheFilePath + " could not be written!");
+    }
 }
 
 std::tuple<std::string, int> AutoTuner::LoadKernelOffline(std::shared_ptr<rapidjson::Document> deviceCache,
@@ -0,0 +1,142 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/common.cl"
+#include "include/fetch.cl"
+#include "include/imad.cl"
+#include "include/data_types.cl"
+
+// ======================================================================================
+// Host side jit-constants:
+// ======================================================================================
+// DEPTHWISE       { 0, 1 } - one input and one output feature per group, input features
+//                            of the output slice are read with a single load
+// FILTER_TAPS_NUM          - number of input values accumulated into one output value:
+//                            ifm per group * filter size y * filter size x
+// ======================================================================================
+
+#define unroll_for __attribute__((opencl_unroll_hint)) for
+
+#define FSV 4
+
+#define INPUT_TYPE4       MAKE_VECTOR_TYPE(INPUT0_TYPE, 4)
+#define FILTER_TYPE4      MAKE_VECTOR_TYPE(FILTER_TYPE, 4)
+
+// Dispatch dimensions:
+//     spatial (y * x) x f   x b
+// WI: 1               x FSV x 1
+
+KERNEL(convolution_imad_b_fs_yx_fsv4_dw)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output,
+    const __global FILTER_TYPE* weights,
+#if BIAS_TERM
+    const __global BIAS_TYPE* biases,
+#endif
+#if HAS_FUSED_OPS_DECLS
+    FUSED_OPS_DECLS,
+#endif
+    uint split_idx)
+{
+    const uint yx = (uint)get_global_id(0);
+    const uint x = yx % OUTPUT_SIZE_X;
+    const uint y = yx / OUTPUT_SIZE_X;
+    const uint f = (uint)get_global_id(1) * FSV;
+    const uint b = (uint)get_global_id(2);
+
+    const int input_x = x * STRIDE_SIZE_X - PADDING_SIZE_X;
+    const int input_y = y * STRIDE_SIZE_Y - PADDING_SIZE_Y;
+
+    int dotProd[FSV] = { 0 };
+
+    // Four filter taps are accumulated in one iteration - IMAD.
+    for (uint tap = 0; tap < FILTER_TAPS_NUM; tap += FSV) {
+        // in_val[t][fi] is the input value of tap (tap + t) for output feature (f + fi)
+        INPUT_TYPE4 in_val[FSV];
+        uint filter_offset[FSV];
+
+        unroll_for (uint t = 0; t < FSV; ++t) {
+            in_val[t] = (INPUT_TYPE4)0;
+            filter_offset[t] = 0;
+
+            const uint cur_tap = tap + t;
+            if (cur_tap >= FILTER_TAPS_NUM)
+                continue;
+
+            const uint k = cur_tap / (FILTER_SIZE_X * FILTER_SIZE_Y);
+            const uint j = cur_tap / FILTER_SIZE_X % FILTER_SIZE_Y;
+            const uint i = cur_tap % FILTER_SIZE_X;
+            filter_offset[t] = k * FILTER_IFM_PITCH + j * FILTER_Y_PITCH + i * FILTER_X_PITCH;
+
+            const int input_offset_y = input_y + j * DILATION_SIZE_Y;
+            const int input_offset_x = input_x + i * DILATION_SIZE_X;
+            if (input_offset_y < 0 || input_offset_y >= INPUT0_SIZE_Y ||
+                input_offset_x < 0 || input_offset_x >= INPUT0_SIZE_X)
+                continue;
+
+#if DEPTHWISE
+            in_val[t] = vload4(0, input + INPUT0_GET_INDEX(b, f, input_offset_y, input_offset_x));
+#else
+            unroll_for (uint fi = 0; fi < FSV; ++fi) {
+                const uint g = (f + fi) / FILTER_OFM_NUM;
+                if (f + fi < OUTPUT_FEATURE_NUM)
+                    in_val[t][fi] = input[INPUT0_GET_INDEX(b, g * FILTER_IFM_NUM + k, input_offset_y, input_offset_x)];
+            }
+#endif
+        }
+
+        unroll_for (uint fi = 0; fi < FSV; ++fi) {
+            if (f + fi >= OUTPUT_FEATURE_NUM)
+                break;
+
+            INPUT_TYPE4 in_taps;
+            FILTER_TYPE4 wei_taps = (FILTER_TYPE4)0;
+            unroll_for (uint t = 0; t < FSV; ++t) {
+                in_taps[t] = in_val[t][fi];
+                if (tap + t < FILTER_TAPS_NUM)
+                    wei_taps[t] = weights[(f + fi) * FILTER_OFM_PITCH + filter_offset[t]];
+            }
+
+            dotProd[fi] = IMAD(dotProd[fi], in_taps, wei_taps);
+        }
+    }
+
+    unroll_for (uint fi = 0; fi < FSV; ++fi) {
+        const uint of = f + fi;
+        if (of >= OUTPUT_FEATURE_NUM)
+            break;
+
+#if BIAS_TERM
+        float res = (float)dotProd[fi] + biases[of];
+#else
+        float res = (float)dotProd[fi];
+#endif
+
+#if HAS_FUSED_OPS
+        FUSED_OPS;
+        OUTPUT_TYPE out = FINAL_NAME;
+#else
+        OUTPUT_TYPE out = TO_OUTPUT_TYPE(res);
+#endif
+
+        output[OUTPUT_GET_INDEX(b, of, y, x)] = ACTIVATION(out, ACTIVATION_PARAMS);
+    }
+}
+
+#undef unroll_for
+
+#undef FSV
+
+#undef INPUT_TYPE4
+#undef FILTER_TYPE4
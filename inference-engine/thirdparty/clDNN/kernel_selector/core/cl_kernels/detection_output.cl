@@ -26,8 +26,6 @@ KERNEL (detection_output)(__global UNIT_TYPE* input_location, __global UNIT_TYPE
     __local uint scores_size[NUM_CLASSES * NUM_OF_IMAGES];
     __local bool stillSorting;
 
-    uint indexes_class_0[NUM_OF_PRIORS];
-
     int last_bbox_in_class = NUM_OF_ITEMS;
     bool is_last_bbox_in_class = false;
     for (uint it = 0; it < NUM_OF_ITEMS; it ++)
@@ -170,6 +168,13 @@ KERNEL (detection_output)(__global UNIT_TYPE* input_location, __global UNIT_TYPE
                 const uint shared_class = (SHARE_LOCATION)? 0 : idx_class;
                 UNIT_TYPE decoded_bbox[4];
                 FUNC_CALL(get_decoded_bbox)(decoded_bbox, input_location, input_prior_box, bb_idx, shared_class, idx_image);
+                if (CLIP_AFTER_NMS)
+                {
+                    for (uint i = 0; i < PRIOR_BOX_SIZE; i++)
+                    {
+                        decoded_bbox[i] = max((UNIT_TYPE)0, min((UNIT_TYPE)1, decoded_bbox[i]));
+                    }
+                }
 
                 const uint out_idx = (local_id_out + output_offset) * OUTPUT_ROW_SIZE + OUTPUT_OFFSET;
                 output[out_idx] = TO_UNIT_TYPE(idx_image);
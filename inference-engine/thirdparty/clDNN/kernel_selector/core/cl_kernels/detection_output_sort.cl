@@ -74,6 +74,10 @@ KERNEL (detection_output_sort)(__global UNIT_TYPE* input_bboxes, __global UNIT_T
                         {
                             output[out_idx + idx] = input_bboxes[input_idx + idx];
                         }
+                        if (DECREASE_LABEL_ID)
+                        {
+                            output[out_idx + 1] -= 1;
+                        }
 
                         output_count++;
                     }
@@ -87,8 +91,6 @@ KERNEL (detection_output_sort)(__global UNIT_TYPE* input_bboxes, __global UNIT_T
     }
     else
     {
-        uint sorted_output[KEEP_TOP_K * NUM_CLASSES_IN];
-
         for (uint it = 0; it < NUM_OF_ITEMS_SORT; it++)
         {
             indexes[local_id + it] = (local_id + it) * NUM_OF_CLASS_BBOXES;
@@ -145,7 +147,6 @@ KERNEL (detection_output_sort)(__global UNIT_TYPE* input_bboxes, __global UNIT_T
                             uint input_idx = (indexes[it] + image_offset_input) * OUTPUT_ROW_SIZE + INPUT_OFFSET;
                             uint class_idx = input_bboxes[input_idx + 1] - HIDDEN_CLASS;
 
-                            sorted_output[class_idx * KEEP_TOP_K + num_out_per_class[class_idx]] = input_idx;
                             num_out_per_class[class_idx]++;
 
                             indexes[it]++;
@@ -176,9 +177,15 @@ KERNEL (detection_output_sort)(__global UNIT_TYPE* input_bboxes, __global UNIT_T
                 {
 
                     uint out_idx = output_count * OUTPUT_ROW_SIZE + image_offset_output;
+                    // The selected boxes of a class are the first ones of its sorted boxes
+                    const uint input_idx = (i * NUM_OF_CLASS_BBOXES + j + image_offset_input) * OUTPUT_ROW_SIZE + INPUT_OFFSET;
                     for (uint idx = 0; idx < OUTPUT_ROW_SIZE; idx++)
                     {
-                        output[out_idx + idx] = input_bboxes[sorted_output[i * KEEP_TOP_K + j] + idx];
+                        output[out_idx + idx] = input_bboxes[input_idx + idx];
+                    }
+                    if (DECREASE_LABEL_ID)
+                    {
+                        output[out_idx + 1] -= 1;
                     }
                     output_count++;
                 }
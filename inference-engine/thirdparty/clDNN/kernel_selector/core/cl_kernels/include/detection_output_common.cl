@@ -165,7 +165,15 @@ void FUNC(get_decoded_bbox)(UNIT_TYPE* decoded_bbox, __global UNIT_TYPE* input_l
             decoded_bbox[2] = prior_bboxes[2] + input_prior_box[NUM_OF_PRIOR_COMPONENTS + 2] * bbox_xmax * prior_width;
             decoded_bbox[3] = prior_bboxes[3] + input_prior_box[NUM_OF_PRIOR_COMPONENTS + 3] * bbox_ymax * prior_height;
         }
-    } 
+    }
+
+    if (CLIP_BEFORE_NMS)
+    {
+        for (uint i = 0; i < PRIOR_BOX_SIZE; i++)
+        {
+            decoded_bbox[i] = max((UNIT_TYPE)0, min((UNIT_TYPE)1, decoded_bbox[i]));
+        }
+    }
 }
 
 UNIT_TYPE FUNC(get_score)(__global UNIT_TYPE* input_confidence, const uint idx_prior, const uint idx_class, const uint idx_image)
@@ -0,0 +1,154 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+
+#define ACTIVATION_LOGISTIC(input)        (UNIT_VAL_ONE/(UNIT_VAL_ONE + exp(-input)))
+#define ACTIVATION_HYPERBOLIC_TAN(input)  (tanh(input))
+#define GATES_SIZE                        (4 * HIDDEN_SIZE)
+
+#if RECURRENT_IN_SLM
+    // The weights are transposed in SLM, so the work items of the group read the consecutive rows
+    #define RECURRENT_VALUE(row, x)       recurrent_slm[(x) * GATES_SIZE + (row)]
+#else
+    #define RECURRENT_VALUE(row, x)       recurrent[GET_DATA_INDEX(RECURRENT, 0, dir, (row), (x))]
+#endif
+
+// A single work group runs all the timesteps of the batch and the direction, so the whole sequence
+// takes one launch and the hidden state of the previous timestep is read from SLM
+__attribute__((reqd_work_group_size(LOCAL_SIZE, 1, 1)))
+KERNEL(lstm_dynamic_timeloop_slm)(
+    const __global INPUT0_TYPE* input,
+    const __global DYN_LENGTH_TYPE* dyn_lengths,
+    __global OUTPUT_TYPE* output,
+    const __global RECURRENT_TYPE* recurrent
+#if INIT_HIDDEN_TERM
+    , const __global INIT_HIDDEN_TYPE* hidden
+#endif
+#if INIT_CELL_TERM
+    , const __global INIT_CELL_TYPE* cell
+#endif
+#if LAST_HIDDEN_TERM
+    , __global LAST_HIDDEN_TYPE* last_hidden
+#endif
+#if LAST_CELL_TERM
+    , __global LAST_CELL_TYPE* last_cell
+#endif
+    )
+{
+    const uint lid = get_local_id(0);
+    const uint b   = get_global_id(1);
+    const uint dir = get_global_id(2);
+    const uint unroll_timesteps = min((uint)dyn_lengths[b], (uint)MAX_SEQUENCE_LENGTH);
+
+    __local ACCUMULATOR_TYPE hidden_slm[HIDDEN_SIZE];
+#if RECURRENT_IN_SLM
+    __local RECURRENT_TYPE recurrent_slm[GATES_SIZE * HIDDEN_SIZE];
+
+    for (uint i = lid; i < GATES_SIZE * HIDDEN_SIZE; i += LOCAL_SIZE)
+    {
+        const uint row = i / HIDDEN_SIZE;
+        const uint x = i % HIDDEN_SIZE;
+        recurrent_slm[x * GATES_SIZE + row] = recurrent[GET_DATA_INDEX(RECURRENT, 0, dir, row, x)];
+    }
+#endif
+
+    ACCUMULATOR_TYPE cell_vals[ELEMENTS_PER_ITEM];
+    for (uint element_idx = 0; element_idx < ELEMENTS_PER_ITEM; element_idx++)
+    {
+        const uint y = lid + element_idx * LOCAL_SIZE;
+        cell_vals[element_idx] = ACCUMULATOR_TYPE_ZERO;
+        if (y < HIDDEN_SIZE)
+        {
+        #if INIT_HIDDEN_TERM
+            hidden_slm[y] = (ACCUMULATOR_TYPE)hidden[GET_DATA_INDEX(INIT_HIDDEN, b, 0, dir, y)];
+        #else
+            hidden_slm[y] = ACCUMULATOR_TYPE_ZERO;
+        #endif
+        #if INIT_CELL_TERM
+            cell_vals[element_idx] = (ACCUMULATOR_TYPE)cell[GET_DATA_INDEX(INIT_CELL, b, 0, dir, y)];
+        #endif
+        }
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (uint timestep = 0; timestep < unroll_timesteps; timestep++)
+    {
+        OUTPUT_TYPE hidden_vals[ELEMENTS_PER_ITEM];
+        for (uint element_idx = 0; element_idx < ELEMENTS_PER_ITEM; element_idx++)
+        {
+            const uint y = lid + element_idx * LOCAL_SIZE;
+            if (y >= HIDDEN_SIZE)
+                continue;
+
+            // [f, i, z, o]
+            ACCUMULATOR_TYPE ft = input[GET_DATA_INDEX(INPUT0, b, timestep, dir, y + GEMM_OFFSET_F)];
+            ACCUMULATOR_TYPE it = input[GET_DATA_INDEX(INPUT0, b, timestep, dir, y + GEMM_OFFSET_I)];
+            ACCUMULATOR_TYPE zt = input[GET_DATA_INDEX(INPUT0, b, timestep, dir, y + GEMM_OFFSET_Z)];
+            ACCUMULATOR_TYPE ot = input[GET_DATA_INDEX(INPUT0, b, timestep, dir, y + GEMM_OFFSET_O)];
+
+        #if !INIT_HIDDEN_TERM
+            if (timestep > 0)
+        #endif
+            {
+                for (uint x = 0; x < HIDDEN_SIZE; x++)
+                {
+                    const ACCUMULATOR_TYPE h = hidden_slm[x];
+                    ft += h * (ACCUMULATOR_TYPE)RECURRENT_VALUE(y + GEMM_OFFSET_F, x);
+                    it += h * (ACCUMULATOR_TYPE)RECURRENT_VALUE(y + GEMM_OFFSET_I, x);
+                    zt += h * (ACCUMULATOR_TYPE)RECURRENT_VALUE(y + GEMM_OFFSET_Z, x);
+                    ot += h * (ACCUMULATOR_TYPE)RECURRENT_VALUE(y + GEMM_OFFSET_O, x);
+                }
+            }
+
+            // The same eltwise operation as the reference kernel
+            ACCUMULATOR_TYPE eltwise_val = ACTIVATION_LOGISTIC(CLIP(it)) * ACTIVATION_HYPERBOLIC_TAN(CLIP(zt));
+        #if INPUT_FORGET
+            eltwise_val *= ((ACCUMULATOR_TYPE)1 - ft);
+        #endif
+            eltwise_val += cell_vals[element_idx] * ACTIVATION_LOGISTIC(CLIP(ft));
+
+            hidden_vals[element_idx] = (OUTPUT_TYPE)(ACTIVATION_HYPERBOLIC_TAN(eltwise_val) * ACTIVATION_LOGISTIC(ot));
+            cell_vals[element_idx] = (ACCUMULATOR_TYPE)((OUTPUT_TYPE)eltwise_val);
+        }
+
+        // All the work items have to read the previous hidden state before it is replaced
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (uint element_idx = 0; element_idx < ELEMENTS_PER_ITEM; element_idx++)
+        {
+            const uint y = lid + element_idx * LOCAL_SIZE;
+            if (y >= HIDDEN_SIZE)
+                continue;
+
+            hidden_slm[y] = (ACCUMULATOR_TYPE)hidden_vals[element_idx];
+            output[GET_DATA_INDEX(OUTPUT, b, timestep, dir, y)] = hidden_vals[element_idx];
+        #if LAST_HIDDEN_TERM
+            if (timestep == unroll_timesteps - 1)
+                last_hidden[GET_DATA_INDEX(LAST_HIDDEN, b, 0, dir, y)] = hidden_vals[element_idx];
+        #endif
+        #if LAST_CELL_TERM
+            if (timestep == unroll_timesteps - 1)
+                last_cell[GET_DATA_INDEX(LAST_CELL, b, 0, dir, y)] = cell_vals[element_idx];
+        #endif
+        }
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+}
+
+#undef ACTIVATION_LOGISTIC
+#undef ACTIVATION_HYPERBOLIC_TAN
+#undef GATES_SIZE
+#undef RECURRENT_VALUE
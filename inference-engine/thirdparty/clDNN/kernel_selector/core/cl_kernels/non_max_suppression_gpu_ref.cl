@@ -0,0 +1,173 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+
+// The box index marking the suppressed boxes and the padding of the sort
+#define NO_BOX (-1)
+
+inline float4 FUNC(load_box)(const __global INPUT0_TYPE* boxes, const uint batch, const int box)
+{
+    const uint offset = (batch * NUM_BOXES + box) * 4;
+    const float4 coords = (float4)((float)boxes[offset], (float)boxes[offset + 1],
+                                   (float)boxes[offset + 2], (float)boxes[offset + 3]);
+#if CENTER_POINT_BOX
+    const float2 half_size = coords.zw / 2.f;
+    return (float4)(coords.xy - half_size, coords.xy + half_size);
+#else
+    return (float4)(fmin(coords.xy, coords.zw), fmax(coords.xy, coords.zw));
+#endif
+}
+
+inline float FUNC(iou)(const float4 box1, const float4 box2)
+{
+    const float2 inter_min = fmax(box1.xy, box2.xy);
+    const float2 inter_max = fmin(box1.zw, box2.zw);
+    const float2 inter_size = inter_max - inter_min;
+    if (inter_size.x <= 0.f || inter_size.y <= 0.f)
+        return 0.f;
+
+    const float intersection = inter_size.x * inter_size.y;
+    const float union_area = (box1.z - box1.x) * (box1.w - box1.y) + (box2.z - box2.x) * (box2.w - box2.y) - intersection;
+    return union_area <= 0.f ? 0.f : intersection / union_area;
+}
+
+// The order of the sort: the higher scores first, the lower box indices first for the equal scores
+inline bool FUNC(is_before)(const float score1, const int box1, const float score2, const int box2)
+{
+    return score1 > score2 || (score1 == score2 && box1 < box2);
+}
+
+__attribute__((reqd_work_group_size(LOCAL_SIZE, 1, 1)))
+KERNEL(non_max_suppression_gpu_ref)(
+    const __global INPUT0_TYPE* boxes,
+    const __global INPUT1_TYPE* scores,
+#ifdef NUM_SELECT_PER_CLASS_TYPE
+    const __global NUM_SELECT_PER_CLASS_TYPE* num_select_per_class_input,
+#endif
+#ifdef IOU_THRESHOLD_TYPE
+    const __global IOU_THRESHOLD_TYPE* iou_threshold_input,
+#endif
+#ifdef SCORE_THRESHOLD_TYPE
+    const __global SCORE_THRESHOLD_TYPE* score_threshold_input,
+#endif
+    __global float* selected_scores,
+    __global int* selected_boxes,
+    __global int* selected_num)
+{
+    const uint lid = get_local_id(0);
+    const uint class_idx = get_global_id(1);
+    const uint batch = get_global_id(2);
+    const uint class_list = batch * NUM_CLASSES + class_idx;
+
+    __local float sort_scores[SORT_SIZE];
+    __local int sort_boxes[SORT_SIZE];
+    __local int candidates_num;
+
+#ifdef NUM_SELECT_PER_CLASS_TYPE
+    // The same as the CPU implementation, no positive limit selects all the boxes
+    int max_selected = (int)num_select_per_class_input[0];
+    max_selected = max_selected > 0 ? min(max_selected, MAX_SELECTED_PER_CLASS) : MAX_SELECTED_PER_CLASS;
+#else
+    const int max_selected = MAX_SELECTED_PER_CLASS;
+#endif
+#ifdef IOU_THRESHOLD_TYPE
+    const float iou_threshold = (float)iou_threshold_input[0];
+#else
+    const float iou_threshold = 1.f;
+#endif
+#ifdef SCORE_THRESHOLD_TYPE
+    const float score_threshold = (float)score_threshold_input[0];
+#else
+    const float score_threshold = 0.f;
+#endif
+
+    if (lid == 0)
+        candidates_num = 0;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    const __global INPUT1_TYPE* class_scores = scores + class_list * NUM_BOXES;
+    for (uint i = lid; i < SORT_SIZE; i += LOCAL_SIZE)
+    {
+        float score = -INFINITY;
+        int box = NO_BOX;
+        if (i < NUM_BOXES && (float)class_scores[i] > score_threshold)
+        {
+            score = (float)class_scores[i];
+            box = i;
+            atomic_inc(&candidates_num);
+        }
+        sort_scores[i] = score;
+        sort_boxes[i] = box;
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // Bitonic sort, the padding of the scores below the threshold goes to the end
+    for (uint size = 2; size <= SORT_SIZE; size <<= 1)
+    {
+        for (uint stride = size >> 1; stride > 0; stride >>= 1)
+        {
+            for (uint i = lid; i < SORT_SIZE / 2; i += LOCAL_SIZE)
+            {
+                const uint pos = 2 * i - (i & (stride - 1));
+                const uint partner = pos + stride;
+                const bool ascending = (pos & size) == 0;
+                const float score1 = sort_scores[pos];
+                const float score2 = sort_scores[partner];
+                const int box1 = sort_boxes[pos];
+                const int box2 = sort_boxes[partner];
+                if (FUNC_CALL(is_before)(score2, box2, score1, box1) == ascending)
+                {
+                    sort_scores[pos] = score2;
+                    sort_scores[partner] = score1;
+                    sort_boxes[pos] = box2;
+                    sort_boxes[partner] = box1;
+                }
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+    }
+
+    // The greedy selection in the order of the scores, each selected box suppresses the later ones in parallel
+    const int candidates = candidates_num;
+    const uint selected_offset = class_list * MAX_SELECTED_PER_CLASS;
+    int selected = 0;
+    for (int i = 0; i < candidates && selected < max_selected; i++)
+    {
+        const int box = sort_boxes[i];
+        if (box == NO_BOX)
+            continue;
+
+        if (lid == 0)
+        {
+            selected_scores[selected_offset + selected] = sort_scores[i];
+            selected_boxes[selected_offset + selected] = box;
+        }
+        selected++;
+
+        const float4 selected_box = FUNC_CALL(load_box)(boxes, batch, box);
+        for (int j = i + 1 + lid; j < candidates; j += LOCAL_SIZE)
+        {
+            const int other = sort_boxes[j];
+            if (other != NO_BOX && FUNC_CALL(iou)(selected_box, FUNC_CALL(load_box)(boxes, batch, other)) > iou_threshold)
+                sort_boxes[j] = NO_BOX;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (lid == 0)
+        selected_num[class_list] = selected;
+}
+
+#undef NO_BOX
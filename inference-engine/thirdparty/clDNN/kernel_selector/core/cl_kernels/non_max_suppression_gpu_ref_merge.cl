@@ -0,0 +1,80 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+
+#define CLASS_LISTS_NUM (NUM_BATCHES * NUM_CLASSES)
+
+// The number of the scores of the list, sorted from the highest one, which are higher than the score,
+// or not lower than it if the equal scores of the list go first
+inline int FUNC(count_before)(const __global float* list_scores, const int list_size, const float score, const bool ties_before)
+{
+    int begin = 0;
+    int end = list_size;
+    while (begin < end)
+    {
+        const int middle = (begin + end) / 2;
+        const float other = list_scores[middle];
+        if (other > score || (ties_before && other == score))
+            begin = middle + 1;
+        else
+            end = middle;
+    }
+    return begin;
+}
+
+KERNEL(non_max_suppression_gpu_ref_merge)(
+    const __global float* selected_scores,
+    const __global int* selected_boxes,
+    const __global int* selected_num,
+    __global OUTPUT_TYPE* output)
+{
+    const uint idx = get_global_id(0);
+
+    int total = 0;
+    for (uint list = 0; list < CLASS_LISTS_NUM; list++)
+        total += selected_num[list];
+
+    // The rows past the selected boxes are padded the same way as the CPU implementation does
+    if (idx < NUM_SELECTED_INDICES && idx >= total)
+    {
+        output[idx * 3] = TO_OUTPUT_TYPE(-1);
+        output[idx * 3 + 1] = TO_OUTPUT_TYPE(-1);
+        output[idx * 3 + 2] = TO_OUTPUT_TYPE(-1);
+    }
+
+    const uint class_list = idx / MAX_SELECTED_PER_CLASS;
+    const int pos = idx % MAX_SELECTED_PER_CLASS;
+    if (class_list >= CLASS_LISTS_NUM || pos >= selected_num[class_list])
+        return;
+
+    // The rank among all the selected boxes, the equal scores keep the order of the batches and the classes
+    const float score = selected_scores[idx];
+    int rank = pos;
+    for (uint list = 0; list < CLASS_LISTS_NUM && rank < NUM_SELECTED_INDICES; list++)
+    {
+        if (list != class_list)
+            rank += FUNC_CALL(count_before)(selected_scores + list * MAX_SELECTED_PER_CLASS, selected_num[list],
+                                            score, list < class_list);
+    }
+
+    if (rank < NUM_SELECTED_INDICES)
+    {
+        output[rank * 3] = TO_OUTPUT_TYPE(class_list / NUM_CLASSES);
+        output[rank * 3 + 1] = TO_OUTPUT_TYPE(class_list % NUM_CLASSES);
+        output[rank * 3 + 2] = TO_OUTPUT_TYPE(selected_boxes[idx]);
+    }
+}
+
+#undef CLASS_LISTS_NUM
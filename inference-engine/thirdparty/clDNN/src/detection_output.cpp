@@ -65,7 +65,7 @@ layout detection_output_inst::calc_output_layout(detection_output_node const& no
     // Add space for number of output results per image - needed in the next detection output step
     output_size += ((input_layout.size.batch[0] + 15) / 16) * 16;
 
-    if (node.get_program().get_options().get<build_option_type::detection_output_gpu>()->enabled()) {
+    if (node.use_gpu_kernels()) {
         return {input_layout.data_type, cldnn::format::bfyx, cldnn::tensor(1, 1, 1, output_size)};
     } else {
         return {input_layout.data_type,
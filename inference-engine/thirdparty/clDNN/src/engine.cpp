@@ -66,6 +66,10 @@ uint64_t engine::get_temp_used_device_memory_size() const {
     return _impl->get_used_device_memory();
 }
 
+kernels_cache_statistics engine::get_kernels_cache_statistics() const {
+    return _impl->get_context()->get_kernels_cache().get_statistics();
+}
+
 engine_types engine::get_type() const {
     return _impl->type();
 }
@@ -93,6 +97,13 @@ gpu_toolkit_config convert_configuration(const engine_configuration conf) {
     result.throttle_mode = conf.throttle_mode;
     result.queues_num = conf.n_streams;
     result.tuning_cache_path = conf.tuning_cache_path;
+    result.compilation_threads_num = conf.n_compilation_threads;
+    result.kernels_per_program = conf.kernels_per_program;
+    result.kernels_cache_dir = conf.kernels_cache_dir;
+    result.kernels_cache_max_size = conf.kernels_cache_max_size;
+    result.out_of_order_execution = conf.out_of_order_execution;
+    result.lazy_kernels_compilation = conf.lazy_kernels_compilation;
+    result.host_threads_num = conf.n_host_threads;
     return result;
 }
 
@@ -236,8 +247,10 @@ void* engine_impl::get_user_context() const { return static_cast<void*>(_context
 void engine_impl::compile_program(program_impl& program) {
     if (!program.get_options().get<build_option_type::serialize_network>()->serialization_network_name.empty())
         _context->get_kernels_cache().get_context().set_serialization_flag(true);
-    // TODO: better compilation logic instead of a simple 'compile all'?
-    _context->get_kernels_cache().build_all();
+    if (configuration().lazy_kernels_compilation)
+        _context->get_kernels_cache().build_async();
+    else
+        _context->get_kernels_cache().build_all();
 }
 
 bool engine_impl::use_memory_pool() const {
@@ -32,6 +32,13 @@ configuration::configuration()
       priority_mode(priority_mode_types::disabled),
       throttle_mode(throttle_mode_types::disabled),
       queues_num(0),
-      tuning_cache_path("cache.json") {}
+      tuning_cache_path("cache.json"),
+      compilation_threads_num(0),
+      kernels_per_program(10),
+      kernels_cache_dir(""),
+      kernels_cache_max_size(0),
+      out_of_order_execution(false),
+      lazy_kernels_compilation(false),
+      host_threads_num(0) {}
 }  // namespace gpu
 }  // namespace cldnn
@@ -41,6 +41,13 @@ struct configuration {
     throttle_mode_types throttle_mode;
     uint16_t queues_num;
     std::string tuning_cache_path;
+    uint16_t compilation_threads_num;
+    uint32_t kernels_per_program;
+    std::string kernels_cache_dir;
+    uint64_t kernels_cache_max_size;
+    bool out_of_order_execution;
+    bool lazy_kernels_compilation;
+    uint16_t host_threads_num;
 };
 }  // namespace gpu
 }  // namespace cldnn
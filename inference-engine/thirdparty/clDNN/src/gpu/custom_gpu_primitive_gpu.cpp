@@ -23,12 +23,16 @@
 #include "jitter.h"
 #include "error_handler.h"
 #include "register_gpu.hpp"
+#include "kernel_runner.h"
+#include "auto_tuner.h"
 
+#include <algorithm>
 #include <map>
 #include <sstream>
 #include <vector>
 #include <memory>
 #include <string>
+#include <tuple>
 
 using namespace cldnn;
 namespace kernel_selector {
@@ -167,14 +171,14 @@ static void add_layout_to_jit(kernel_selector::jit_constants& mem_consts, const
     mem_consts.AddConstant(kernel_selector::MakeJitConstant(name + "_OFFSET", std::to_string(offset)));
 }
 
-static std::string get_jit_constant(const custom_gpu_primitive_node& outer) {
+static std::string get_jit_constant(const custom_gpu_primitive_node& outer, const std::vector<size_t>& lws) {
     kernel_selector::jit_constants mem_consts{
         kernel_selector::MakeJitConstant("NUM_INPUTS", std::to_string(outer.get_dependencies().size()))};
     const auto primitive = outer.get_primitive().get();
 
     mem_consts.AddConstants({
         kernel_selector::MakeJitConstant("GLOBAL_WORKSIZE", primitive->gws),
-        kernel_selector::MakeJitConstant("LOCAL_WORKSIZE", primitive->lws),
+        kernel_selector::MakeJitConstant("LOCAL_WORKSIZE", lws),
     });
 
     for (size_t i = 0; i < outer.get_dependencies().size(); i++) {
@@ -192,6 +196,100 @@ static std::string get_jit_constant(const custom_gpu_primitive_node& outer) {
     return oss.str();
 }
 
+// The name the tuned local work sizes of the custom kernels are stored under in the tuning cache
+static const char* const tuning_implementation_name = "custom_gpu_primitive";
+
+// The parameters of the buffers the kernel runner allocates for the tuning
+struct custom_tuning_params : public kernel_selector::base_params {
+    custom_tuning_params() : base_params(kernel_selector::KernelType::UNKNOWN) {}
+};
+
+// The local work sizes tried by the tuning, the one chosen by the driver goes first.
+// Each of the other ones takes the power of 2 divisors of the global work sizes which fit the work-group.
+static std::vector<std::vector<size_t>> get_lws_candidates(const std::vector<size_t>& gws, size_t max_work_group_size) {
+    std::vector<std::vector<size_t>> partial = {{}};
+    for (auto global : gws) {
+        std::vector<std::vector<size_t>> extended;
+        for (const auto& lws : partial) {
+            size_t group_size = 1;
+            for (auto local : lws) group_size *= local;
+
+            for (size_t local = 1; local <= global && group_size * local <= max_work_group_size; local *= 2) {
+                if (global % local == 0) {
+                    extended.push_back(lws);
+                    extended.back().push_back(local);
+                }
+            }
+        }
+        partial = std::move(extended);
+    }
+
+    std::vector<std::vector<size_t>> candidates = {{}};
+    candidates.insert(candidates.end(), partial.begin(), partial.end());
+    return candidates;
+}
+
+static std::vector<size_t> get_tuned_lws(const custom_gpu_primitive_node& arg,
+                                         const kernel_selector::cl_kernel_data& cl_kernel) {
+    const auto primitive = arg.get_primitive().get();
+    auto& engine = arg.get_program().get_engine();
+    const auto& tuning_config = arg.get_program().get_options().get<build_option_type::tuning_config>();
+    const auto mode = to_tuning_mode(tuning_config->config.mode);
+    if (mode == kernel_selector::TuningMode::TUNING_DISABLED || primitive->gws.size() > 3) {
+        return primitive->lws;
+    }
+
+    const auto device_info = engine.get_context()->get_device_info();
+    const auto candidates = get_lws_candidates(primitive->gws, device_info.max_work_group_size);
+    const auto& cache_path = tuning_config->config.cache_file_path;
+    const auto& kernel_string = *cl_kernel.kernelString;
+    // The jit of the kernel string is built before the tuning, so it does not depend on the chosen sizes
+    const auto hash = std::to_string(kernel_selector::create_hash(kernel_string.entry_point + kernel_string.options +
+                                                                  kernel_string.jit + kernel_string.str));
+
+    static kernel_selector::AutoTuner auto_tuner;
+    const auto cached = auto_tuner.LoadKernelOnline(mode, cache_path, device_info.compute_units_count, hash);
+    if (std::get<0>(cached) == tuning_implementation_name) {
+        const auto index = std::get<1>(cached);
+        if (index >= 0 && static_cast<size_t>(index) < candidates.size()) {
+            return candidates[index];
+        }
+    }
+
+    if (!std::get<0>(cached).empty() || mode != kernel_selector::TuningMode::TUNING_TUNE_AND_CACHE) {
+        return primitive->lws;
+    }
+
+    auto params = std::make_shared<custom_tuning_params>();
+    params->inputs.clear();
+    for (size_t i = 0; i < arg.get_dependencies().size(); i++) {
+        params->inputs.push_back(convert_data_tensor(arg.input(i).get_output_layout()));
+    }
+    params->output = convert_data_tensor(arg.get_output_layout());
+
+    kernel_selector::KernelsData kernels_data;
+    for (const auto& lws : candidates) {
+        kernel_selector::KernelData kd;
+        kd.params = params;
+        kd.kernels.push_back(cl_kernel);
+        kd.kernels[0].kernelString = std::make_shared<kernel_selector::kernel_string>(kernel_string);
+        kd.kernels[0].kernelString->jit = get_jit_constant(arg, lws);
+        kd.kernels[0].workGroups.local = lws;
+        kernels_data.push_back(kd);
+    }
+
+    gpu::kernel_runner runner(engine);
+    const auto run_times = runner.run_kernels(kernels_data);
+    const auto best = std::min_element(run_times.begin(), run_times.end());
+    if (best == run_times.end() || *best == std::chrono::nanoseconds::max()) {
+        return primitive->lws;
+    }
+
+    const auto best_index = static_cast<int>(std::distance(run_times.begin(), best));
+    auto_tuner.StoreKernel(cache_path, hash, tuning_implementation_name, best_index, device_info.compute_units_count);
+    return candidates[best_index];
+}
+
 static primitive_impl* create(const custom_gpu_primitive_node& arg) {
     const auto primitive = arg.get_primitive().get();
 
@@ -199,7 +297,7 @@ static primitive_impl* create(const custom_gpu_primitive_node& arg) {
     cl_kernel->kernelString = std::make_shared<kernel_selector::kernel_string>();
     cl_kernel->kernelString->entry_point = primitive->kernel_entry_point;
     cl_kernel->kernelString->options = primitive->build_options;
-    cl_kernel->kernelString->jit = get_jit_constant(arg);
+    cl_kernel->kernelString->jit = get_jit_constant(arg, primitive->lws);
     for (const auto& s : primitive->kernels_code) {
         cl_kernel->kernelString->str += s + "\n";
     }
@@ -211,6 +309,12 @@ static primitive_impl* create(const custom_gpu_primitive_node& arg) {
         cl_kernel->arguments.push_back(get_arg(p));
     }
 
+    if (primitive->tune_local_work_size) {
+        const auto lws = get_tuned_lws(arg, *cl_kernel);
+        cl_kernel->kernelString->jit = get_jit_constant(arg, lws);
+        cl_kernel->workGroups.local = lws;
+    }
+
     return new custom_gpu_primitive_gpu(arg, cl_kernel);
 }
 }  // namespace neural
@@ -604,13 +604,7 @@ struct detection_output_cpu : typed_primitive_impl<detection_output> {
         extract_confidences_per_image<dtype>(instance, confidences, num_of_priors);
     }
 
-    event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& events, detection_output_inst& instance) override {
-        for (auto& a : events) {
-            a->wait();
-        }
-
-        auto ev = instance.get_network().get_engine().create_user_event(instance.get_network().get_id(), false);
-
+    void run(detection_output_inst& instance) {
         const int num_of_images = instance.location_memory().get_layout().size.batch[0];  // batch size
 
         std::vector<std::vector<std::vector<bounding_box>>> bboxes(
@@ -627,10 +621,13 @@ struct detection_output_cpu : typed_primitive_impl<detection_output> {
 
             generate_detections<data_type_to_type<data_types::f16>::type>(instance, num_of_images, bboxes, confidences);
         }
+    }
 
-        dynamic_cast<cldnn::user_event*>(ev.get())->set();  // set as complete
-        // TODO: consider refactoring create_user_event() to return cldnn::user_event*
-        return ev;
+    event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& events, detection_output_inst& instance) override {
+        auto& network = instance.get_network();
+        return network.get_engine().get_context()->run_on_host(network.get_id(), events, [this, &instance] {
+            run(instance);
+        });
     }
 
     static primitive_impl* create(const detection_output_node& arg) { return new detection_output_cpu(arg); }
@@ -45,6 +45,9 @@ private:
         detectOutParams.code_type = (int32_t)primitive->code_type;
         detectOutParams.share_location = primitive->share_location;
         detectOutParams.variance_encoded_in_target = primitive->variance_encoded_in_target;
+        detectOutParams.decrease_label_id = primitive->decrease_label_id;
+        detectOutParams.clip_before_nms = primitive->clip_before_nms;
+        detectOutParams.clip_after_nms = primitive->clip_after_nms;
         detectOutParams.nms_threshold = primitive->nms_threshold;
         detectOutParams.eta = primitive->eta;
         detectOutParams.confidence_threshold = primitive->confidence_threshold;
@@ -61,7 +64,7 @@ private:
 
 public:
     static primitive_impl* create(const detection_output_node& arg) {
-        if (!arg.get_program().get_options().get<build_option_type::detection_output_gpu>()->enabled()) {
+        if (!arg.use_gpu_kernels()) {
             return runDetectOutCpu(arg);
         }
 
@@ -107,6 +110,7 @@ private:
             detectOutParams.top_k = primitive->top_k;
             detectOutParams.share_location = primitive->share_location;
             detectOutParams.background_label_id = primitive->background_label_id;
+            detectOutParams.decrease_label_id = primitive->decrease_label_id;
         } else {
             auto primitive = arg.get_primitive();
             detectOutParams.keep_top_k = primitive->keep_top_k;
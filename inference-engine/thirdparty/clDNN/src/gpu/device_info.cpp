@@ -47,8 +47,10 @@ device_info_internal::device_info_internal(const cl::Device& device) {
     max_local_mem_size = static_cast<uint64_t>(device.getInfo<CL_DEVICE_LOCAL_MEM_SIZE>());
     max_global_mem_size = static_cast<uint64_t>(device.getInfo<CL_DEVICE_GLOBAL_MEM_SIZE>());
     max_alloc_mem_size = static_cast<uint64_t>(device.getInfo<CL_DEVICE_MAX_MEM_ALLOC_SIZE>());
+    mem_base_addr_align = static_cast<uint32_t>(device.getInfo<CL_DEVICE_MEM_BASE_ADDR_ALIGN>()) / 8;
 
     supports_image = static_cast<uint8_t>(device.getInfo<CL_DEVICE_IMAGE_SUPPORT>());
+    supports_host_unified_memory = static_cast<uint8_t>(device.getInfo<CL_DEVICE_HOST_UNIFIED_MEMORY>());
     max_image2d_width = static_cast<uint64_t>(device.getInfo<CL_DEVICE_IMAGE2D_MAX_WIDTH>());
     max_image2d_height = static_cast<uint64_t>(device.getInfo<CL_DEVICE_IMAGE2D_MAX_HEIGHT>());
 
@@ -28,6 +28,7 @@ struct device_info_internal : cldnn::device_info {
     std::uint32_t compute_units_count;
     uint32_t dev_type;
     uint32_t vendor_id;
+    uint32_t mem_base_addr_align;  // alignment of sub-buffer origins in bytes
 
     explicit device_info_internal(const cl::Device& device);
 
@@ -46,6 +47,7 @@ struct device_info_internal : cldnn::device_info {
          supports_image,
          supports_imad,
          supports_immad,
+         supports_host_unified_memory,
          dev_name,
          driver_version
         };
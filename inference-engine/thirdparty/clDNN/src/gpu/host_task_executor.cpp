@@ -0,0 +1,105 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "host_task_executor.h"
+#include "ocl_user_event.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace cldnn {
+namespace gpu {
+namespace {
+thread_local bool executor_thread = false;
+}  // namespace
+
+host_task_executor::host_task_executor(const cl::Context& context, const cl::Device& device, size_t threads_num)
+    : _queue(context, device) {
+    threads_num = std::max<size_t>(1, threads_num);
+    for (size_t i = 0; i < threads_num; i++) {
+        _threads.emplace_back(&host_task_executor::worker, this);
+    }
+}
+
+host_task_executor::~host_task_executor() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _work.notify_all();
+    // the queued tasks are still run, the device commands waiting for their events would never complete otherwise
+    for (auto& t : _threads) {
+        t.join();
+    }
+}
+
+bool host_task_executor::on_executor_thread() { return executor_thread; }
+
+void host_task_executor::submit(const std::vector<event_impl::ptr>& deps,
+                                std::function<void()> task,
+                                const event_impl::ptr& done) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tasks.push_back({deps, std::move(task), done});
+    }
+    _work.notify_one();
+}
+
+void host_task_executor::check_error() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_error) {
+        auto error = _error;
+        _error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void host_task_executor::worker() {
+    executor_thread = true;
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _work.wait(lock, [&] { return _stop || !_tasks.empty(); });
+        if (_tasks.empty())
+            return;
+
+        auto current = std::move(_tasks.front());
+        _tasks.pop_front();
+        lock.unlock();
+
+        std::exception_ptr error;
+        try {
+            for (auto& dep : current.deps) {
+                dep->wait();
+            }
+            current.run();
+            // the memory the task has unmapped is up to date for the device commands waiting for its event
+            _queue.finish();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        // the event is set even if the task failed, so the device commands waiting for it do not hang
+        dynamic_cast<cldnn::user_event*>(current.done.get())->set();
+
+        lock.lock();
+        if (error && !_error)
+            _error = error;
+    }
+}
+
+}  // namespace gpu
+}  // namespace cldnn
@@ -0,0 +1,74 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "ocl_toolkit.h"
+#include "event_impl.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cldnn {
+namespace gpu {
+
+// Runs the primitives implemented on the host on a pool of threads, so the thread enqueueing the network does not wait
+// for their inputs and keeps enqueueing the primitives which follow them. The primitives depending on a task wait for
+// its user event on the device.
+class host_task_executor {
+public:
+    host_task_executor(const cl::Context& context, const cl::Device& device, size_t threads_num);
+    ~host_task_executor();
+
+    host_task_executor(const host_task_executor& other) = delete;
+    host_task_executor& operator=(const host_task_executor& other) = delete;
+
+    // Runs the task once the dependencies are complete and sets the user event when it is done.
+    void submit(const std::vector<event_impl::ptr>& deps, std::function<void()> task, const event_impl::ptr& done);
+    // Rethrows the first failure of the tasks run since the previous call.
+    void check_error();
+
+    // The memory is mapped with this queue on the threads of the executor: the commands of the network queues
+    // following the task wait for its event, so a map enqueued to them would not complete before the task does.
+    const cl::CommandQueue& queue() const { return _queue; }
+    static bool on_executor_thread();
+
+private:
+    struct task {
+        std::vector<event_impl::ptr> deps;
+        std::function<void()> run;
+        event_impl::ptr done;
+    };
+
+    cl::CommandQueue _queue;
+    std::mutex _mutex;
+    std::condition_variable _work;
+    std::deque<task> _tasks;
+    std::vector<std::thread> _threads;
+    std::exception_ptr _error;
+    bool _stop = false;
+
+    void worker();
+};
+
+}  // namespace gpu
+}  // namespace cldnn
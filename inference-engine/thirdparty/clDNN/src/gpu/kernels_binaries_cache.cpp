@@ -0,0 +1,213 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "kernels_binaries_cache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <process.h>
+#include <sys/utime.h>
+#define getpid _getpid
+#define utime _utime
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <utime.h>
+#endif
+
+namespace cldnn {
+namespace gpu {
+namespace {
+
+const char binary_extension[] = ".clbin";
+
+struct cache_file {
+    std::string path;
+    uint64_t size;
+    int64_t last_use;
+};
+
+std::vector<cache_file> list_cache_files(const std::string& dir) {
+    std::vector<cache_file> files;
+#ifdef _WIN32
+    WIN32_FIND_DATAA data;
+    HANDLE handle = FindFirstFileA((dir + "*" + binary_extension).c_str(), &data);
+    if (handle == INVALID_HANDLE_VALUE)
+        return files;
+
+    do {
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            continue;
+        const uint64_t size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+        const int64_t last_use = (static_cast<int64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) |
+                                 data.ftLastWriteTime.dwLowDateTime;
+        files.push_back({dir + data.cFileName, size, last_use});
+    } while (FindNextFileA(handle, &data));
+    FindClose(handle);
+#else
+    DIR* handle = opendir(dir.c_str());
+    if (handle == nullptr)
+        return files;
+
+    const std::string extension = binary_extension;
+    while (const dirent* entry = readdir(handle)) {
+        const std::string name = entry->d_name;
+        if (name.size() <= extension.size() ||
+            name.compare(name.size() - extension.size(), extension.size(), extension) != 0)
+            continue;
+
+        struct stat info;
+        const std::string path = dir + name;
+        if (stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode))
+            files.push_back({path, static_cast<uint64_t>(info.st_size), static_cast<int64_t>(info.st_mtime)});
+    }
+    closedir(handle);
+#endif
+    return files;
+}
+
+// FNV-1a, the key only has to be stable between the runs and across the platforms
+void hash_append(uint64_t& hash, const std::string& value) {
+    for (const auto c : value) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ULL;
+    }
+    // separator, so the concatenation of different strings results in different hashes
+    hash ^= 0xff;
+    hash *= 0x100000001b3ULL;
+}
+}  // namespace
+
+kernels_binaries_cache::kernels_binaries_cache(const std::string& dir, uint64_t max_size, const std::string& device_key)
+    : _dir(dir), _max_size(max_size), _device_key(device_key) {
+    if (!_dir.empty() && _dir.back() != '/' && _dir.back() != '\\')
+        _dir += '/';
+}
+
+std::string kernels_binaries_cache::get_key(const std::vector<std::string>& sources, const std::string& options) const {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash_append(hash, _device_key);
+    hash_append(hash, options);
+    for (const auto& s : sources) hash_append(hash, s);
+
+    std::stringstream key;
+    key << std::hex << std::setfill('0') << std::setw(16) << hash;
+    return key.str();
+}
+
+std::string kernels_binaries_cache::get_path(const std::string& key) const {
+    return _dir + key + binary_extension;
+}
+
+bool kernels_binaries_cache::load(const std::string& key, binary_type& binary) const {
+    const auto path = get_path(key);
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.good())
+        return false;
+
+    const auto size = file.tellg();
+    if (size <= 0)
+        return false;
+
+    binary.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(binary.data()), size);
+    if (!file.good())
+        return false;
+
+    // the modification time tracks the last use of the binary for the eviction
+    utime(path.c_str(), nullptr);
+    return true;
+}
+
+void kernels_binaries_cache::store(const std::string& key, const binary_type& binary) const {
+    if (binary.empty())
+        return;
+
+    const auto path = get_path(key);
+    const auto tmp_path = path + "." + std::to_string(getpid()) + "_" +
+                          std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::binary);
+        if (!file.good())
+            return;
+
+        file.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+        if (!file.good()) {
+            file.close();
+            std::remove(tmp_path.c_str());
+            return;
+        }
+    }
+
+    // fails if some other process has already stored the same binary on some platforms, it is fine to drop ours then
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+        std::remove(tmp_path.c_str());
+}
+
+void kernels_binaries_cache::remove(const std::string& key) const {
+    std::remove(get_path(key).c_str());
+}
+
+void kernels_binaries_cache::evict() {
+    auto files = list_cache_files(_dir);
+
+    uint64_t size = 0;
+    for (const auto& f : files) size += f.size;
+
+    if (_max_size != 0 && size > _max_size) {
+        std::sort(files.begin(), files.end(), [](const cache_file& lhs, const cache_file& rhs) {
+            return lhs.last_use < rhs.last_use;
+        });
+
+        for (const auto& f : files) {
+            if (size <= _max_size)
+                break;
+
+            if (std::remove(f.path.c_str()) == 0) {
+                size -= f.size;
+                _evictions++;
+            }
+        }
+    }
+
+    _size = size;
+}
+
+kernels_cache_statistics kernels_binaries_cache::get_statistics() const {
+    kernels_cache_statistics stats;
+    stats.hits = _hits;
+    stats.misses = _misses;
+    stats.evictions = _evictions;
+    stats.size = _size;
+    return stats;
+}
+
+}  // namespace gpu
+}  // namespace cldnn
@@ -0,0 +1,68 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+#include "api/engine.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cldnn {
+namespace gpu {
+
+// On-disk cache of OpenCL program binaries. Files are named after a hash of the program sources, build options,
+// device and driver version, so the binaries of other devices and drivers are never picked up.
+// Every file is written to a temporary name and renamed, so concurrent processes sharing the directory see either
+// a complete binary or none. The least recently used files are evicted once the directory exceeds its size limit.
+class kernels_binaries_cache {
+public:
+    using binary_type = std::vector<unsigned char>;
+
+    kernels_binaries_cache(const std::string& dir, uint64_t max_size, const std::string& device_key);
+
+    bool enabled() const { return !_dir.empty(); }
+    std::string get_key(const std::vector<std::string>& sources, const std::string& options) const;
+
+    // reads the binary stored with the given key, returns false if there is none
+    bool load(const std::string& key, binary_type& binary) const;
+    void store(const std::string& key, const binary_type& binary) const;
+    // removes a binary which failed to load, e.g. the one written by a crashed process
+    void remove(const std::string& key) const;
+
+    void register_hit() { _hits++; }
+    void register_miss() { _misses++; }
+    // removes the least recently used binaries until the directory fits the size limit
+    void evict();
+
+    kernels_cache_statistics get_statistics() const;
+
+private:
+    std::string get_path(const std::string& key) const;
+
+    std::string _dir;
+    uint64_t _max_size;
+    std::string _device_key;
+
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+    std::atomic<uint64_t> _evictions{0};
+    std::atomic<uint64_t> _size{0};
+};
+
+}  // namespace gpu
+}  // namespace cldnn
@@ -19,17 +19,21 @@
 #include "ocl_toolkit.h"
 #include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <exception>
 #include <sstream>
 #include <fstream>
+#include <functional>
 #include <set>
+#include <stdexcept>
 #include <string>
 #include <memory>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "kernel_selector_helper.h"
 
-#define MAX_KERNELS_PER_PROGRAM 10
-
 namespace cldnn {
 namespace gpu {
 
@@ -96,9 +100,165 @@ std::string reorder_options(const std::string& org_options) {
     return options;
 }
 
+// The key of the kernel regardless of its entry point, which is unique for each kernel of each network, so the
+// same kernel of the networks built on the engine is compiled once. The template source is the same for many
+// kernels, so it is kept as its hash while the jit constants are compared as is.
+std::string get_kernel_key(const kernel_selector::kernel_string& kernel_string, bool dump_custom_program,
+                           bool one_time_kernel) {
+    std::string jit = kernel_string.jit;
+    const auto& entry_point = kernel_string.entry_point;
+    if (!entry_point.empty()) {
+        for (size_t pos = jit.find(entry_point); pos != std::string::npos; pos = jit.find(entry_point, pos))
+            jit.erase(pos, entry_point.size());
+    }
+
+    std::string key = std::to_string(std::hash<std::string>{}(kernel_string.str)) + " " + kernel_string.options;
+    if (dump_custom_program)
+        key += " __DUMP_CUSTOM_PROGRAM__";
+    if (one_time_kernel)
+        key += " __ONE_TIME__";
+    return key + "\n" + jit;
+}
+
 inline bool does_options_support_batch_compilation(const std::string& options) {
     return options.find("-D") == std::string::npos && options.find("-I") == std::string::npos;
 }
+
+// A part of a program, i.e. the sources built by a single OpenCL build call independently of the other parts.
+struct program_batch {
+    const kernels_cache::program_code* program;
+    const kernels_cache::source_code* sources;
+    std::string dump_file_name;  // empty if the sources are not dumped
+};
+
+struct program_batch_result {
+    kernels_cache::kernels_map kernels;
+    kernels_binaries_vector binaries;
+    std::string err_log;  // build log, only contains messages if the batch failed to compile
+    std::chrono::duration<double, std::milli> build_time{0};
+    std::exception_ptr error;  // set if the batch failed for other reason than a compilation error
+};
+
+// The prefix of the dump files of the parts of the program, empty if its sources are not dumped.
+std::string get_dump_file_prefix(const configuration& config, const kernels_cache::program_code& program) {
+    static uint32_t current_file_index = 0;
+    if (config.ocl_sources_dumps_dir.empty() && !program.dump_custom_program)
+        return std::string();
+
+    std::string dump_file_name = config.ocl_sources_dumps_dir;
+    if (!dump_file_name.empty() && dump_file_name.back() != '/')
+        dump_file_name += '/';
+
+    return dump_file_name + "clDNN_program_" + std::to_string(current_file_index++) + "_part_";
+}
+
+void create_kernels(cl::Program& program, kernels_cache::kernels_map& kmap) {
+    cl::vector<cl::Kernel> kernels;
+    program.createKernels(&kernels);
+
+    for (auto& k : kernels) {
+        auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
+        kmap.emplace(kernel_name, k);
+    }
+}
+
+// Loads the batch from the on-disk cache, if there is a binary which is accepted by the driver.
+bool load_batch(gpu_toolkit& context, kernels_binaries_cache& binaries_cache, const std::string& cache_key,
+                const program_batch& batch, program_batch_result& result) {
+    kernels_binaries_cache::binary_type binary;
+    if (!binaries_cache.load(cache_key, binary))
+        return false;
+
+    try {
+        cl::Program program(context.context(), {context.device()}, kernels_binaries_vector{binary});
+        program.build({context.device()}, batch.program->options.c_str());
+        create_kernels(program, result.kernels);
+        result.binaries = kernels_binaries_vector{std::move(binary)};
+        return true;
+    } catch (const cl::Error&) {
+        // stale or corrupted binary, it is replaced with the one built from the sources
+        binaries_cache.remove(cache_key);
+        result.kernels.clear();
+        return false;
+    }
+}
+
+// Builds a single batch; runs on the compilation threads, so it never throws and does not touch the shared state.
+program_batch_result build_batch(gpu_toolkit& context, kernels_binaries_cache& binaries_cache,
+                                 const program_batch& batch) {
+    program_batch_result result;
+
+    const bool dump_sources = !batch.dump_file_name.empty();
+    std::ofstream dump_file;
+    if (dump_sources) {
+        dump_file.open(batch.dump_file_name);
+
+        if (dump_file.good()) {
+            for (auto& s : *batch.sources) dump_file << s;
+        }
+    }
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    try {
+        std::string cache_key;
+        if (binaries_cache.enabled()) {
+            cache_key = binaries_cache.get_key(*batch.sources, batch.program->options);
+            if (load_batch(context, binaries_cache, cache_key, batch, result)) {
+                result.build_time = std::chrono::high_resolution_clock::now() - start;
+                binaries_cache.register_hit();
+
+                if (dump_sources && dump_file.good())
+                    dump_file << "\n/* Loaded from the kernels cache: " << cache_key << " */\n";
+                return result;
+            }
+        }
+
+        try {
+            cl::Program program(context.context(), *batch.sources);
+            program.build({context.device()}, batch.program->options.c_str());
+            result.build_time = std::chrono::high_resolution_clock::now() - start;
+            // Store kernels for serialization process.
+            result.binaries = program.getInfo<CL_PROGRAM_BINARIES>();
+
+            if (binaries_cache.enabled() && !result.binaries.empty()) {
+                binaries_cache.store(cache_key, result.binaries.front());
+                binaries_cache.register_miss();
+            }
+
+            if (dump_sources && dump_file.good()) {
+                dump_file << "\n/* Build Log:\n";
+                for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>()) dump_file << p.second << "\n";
+
+                dump_file << "*/\n";
+            }
+
+            create_kernels(program, result.kernels);
+        } catch (const cl::BuildError& err) {
+            result.build_time = std::chrono::high_resolution_clock::now() - start;
+            if (dump_sources && dump_file.good())
+                dump_file << "\n/* Build Log:\n";
+
+            for (auto& p : err.getBuildLog()) {
+                if (dump_sources && dump_file.good())
+                    dump_file << p.second << "\n";
+
+                result.err_log += p.second + '\n';
+            }
+
+            if (dump_sources && dump_file.good())
+                dump_file << "*/\n";
+        }
+    } catch (const cl::Error& err) {
+        result.error = std::make_exception_ptr(ocl_error(err));
+    } catch (...) {
+        result.error = std::current_exception();
+    }
+
+    if (dump_sources && dump_file.good())
+        dump_file << "\n/* Build time: " << result.build_time.count() << " ms */\n";
+
+    return result;
+}
 }  // namespace
 
 kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code& kernels_source_code) const {
@@ -140,11 +300,13 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
             current_bucket.options = options;
         }
 
-        if ((current_bucket.kernels_counter % MAX_KERNELS_PER_PROGRAM) == 0) {
+        if ((current_bucket.kernels_counter % _context.get_configuration().kernels_per_program) == 0) {
             current_bucket.source.push_back({});
+            current_bucket.part_ids.push_back({});
         }
 
         current_bucket.entry_point_to_id[entry_point] = code.second.id;
+        current_bucket.part_ids.back().push_back(code.second.id);
 
         source_code new_source_code = org_source_code;
 
@@ -162,7 +324,22 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
     return std::move(scode);
 }
 
-kernels_cache::kernels_cache(gpu_toolkit& context) : _context(context) {}
+kernels_cache::kernels_cache(gpu_toolkit& context)
+    : _context(context),
+      _binaries_cache(context.get_configuration().kernels_cache_dir,
+                      context.get_configuration().kernels_cache_max_size,
+                      context.get_device_info().dev_name + " " + context.get_device_info().driver_version) {}
+
+kernels_cache::~kernels_cache() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _lazy_stop = true;
+    }
+    _lazy_work.notify_all();
+    for (auto& t : _lazy_threads) {
+        t.join();
+    }
+}
 
 kernels_cache::kernel_id kernels_cache::set_kernel_source(
     const std::shared_ptr<kernel_selector::kernel_string>& kernel_string,
@@ -170,20 +347,26 @@ kernels_cache::kernel_id kernels_cache::set_kernel_source(
     bool one_time_kernel) {
     kernels_cache::kernel_id id;
 
-    // same kernel_string == same kernel
-    const auto key = kernel_string.get()->get_hash();
+    // same kernel_string == same kernel, also when it comes from another program of the engine
+    const auto key = get_kernel_key(*kernel_string, dump_custom_program, one_time_kernel);
 
     std::lock_guard<std::mutex> lock(_mutex);
 
     const auto it = _kernels_code.find(key);
 
-    if (it == _kernels_code.end()) {
+    if (it != _kernels_code.end()) {
+        id = it->second.id;
+    } else if (!one_time_kernel && _kernels_ids.count(key) != 0) {
+        // the kernel is built or handed to the background compilation already
+        id = _kernels_ids.at(key);
+        return id;
+    } else {
         // we need unique id in order to avoid conflict across topologies.
-        const auto kernel_num = _kernels.size() + _kernels_code.size();
+        const auto kernel_num = _kernels.size() + _kernels_code.size() + _lazy_kernels.size();
         id = kernel_string->entry_point + "_" + std::to_string(kernel_num);
         _kernels_code[key] = {kernel_string, id, dump_custom_program, one_time_kernel};
-    } else {
-        id = it->second.id;
+        if (!one_time_kernel)
+            _kernels_ids[key] = id;
     }
 
     assert(_kernels.find(id) == _kernels.end());
@@ -191,118 +374,218 @@ kernels_cache::kernel_id kernels_cache::set_kernel_source(
     return id;
 }
 
-kernels_cache::kernels_map kernels_cache::build_program(const program_code& program_source) const {
-    static uint32_t current_file_index = 0;
-
-    bool dump_sources =
-        !_context.get_configuration().ocl_sources_dumps_dir.empty() || program_source.dump_custom_program;
+kernels_cache::kernel_type kernels_cache::get_kernel(kernel_id id, bool one_time_kernel) {
+    build_all();
 
-    std::string dump_file_name = "";
-    if (dump_sources) {
-        dump_file_name = _context.get_configuration().ocl_sources_dumps_dir;
-        if (!dump_file_name.empty() && dump_file_name.back() != '/')
-            dump_file_name += '/';
+    std::unique_lock<std::mutex> lock(_mutex);
+    const auto lazy = _lazy_kernels.find(id);
+    if (lazy != _lazy_kernels.end()) {
+        const auto part = lazy->second;
+        if (part->status == lazy_part::state::queued)
+            build_lazy_part(lock, part);
+        else
+            _lazy_built.wait(lock, [&] { return part->status == lazy_part::state::built; });
+
+        if (part->error)
+            std::rethrow_exception(part->error);
+    }
 
-        dump_file_name += "clDNN_program_" + std::to_string(current_file_index++) + "_part_";
+    if (one_time_kernel) {
+        return _one_time_kernels.at(id);
+    } else {
+        return _kernels.at(id);
     }
+}
 
-    try {
-        kernels_map kmap;
-        std::string err_log;  // accumulated build log from all program's parts (only contains messages from parts which
-                              // failed to compile)
+void kernels_cache::build_all() {
+    if (!_pending_compilation)
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto sorted_program_code = get_program_source(_kernels_code);
+    const auto& config = _context.get_configuration();
+
+    // Parts of all the programs are independent, so they are split up in batches built concurrently.
+    // The dump files are named upfront, so the names do not depend on the order the batches are built in.
+    std::vector<program_batch> batches;
+    for (const auto& program : sorted_program_code) {
+        const std::string dump_file_name = get_dump_file_prefix(config, program.second);
 
         uint32_t part_idx = 0;
-        for (const auto& sources : program_source.source) {
-            auto current_dump_file_name = dump_file_name + std::to_string(part_idx++) + ".cl";
-            std::ofstream dump_file;
+        for (const auto& sources : program.second.source) {
+            batches.push_back({&program.second, &sources,
+                               dump_file_name.empty() ? std::string() : dump_file_name + std::to_string(part_idx) + ".cl"});
+            part_idx++;
+        }
+    }
 
-            if (dump_sources) {
-                dump_file.open(current_dump_file_name);
+    std::vector<program_batch_result> results(batches.size());
+    size_t threads_num = config.compilation_threads_num != 0 ? config.compilation_threads_num
+                                                             : std::thread::hardware_concurrency();
+    threads_num = std::max<size_t>(1, std::min(threads_num, batches.size()));
 
-                if (dump_file.good()) {
-                    for (auto& s : sources) dump_file << s;
-                }
-            }
+    std::atomic<size_t> next_batch{0};
+    auto build_batches = [&]() {
+        for (size_t i = next_batch++; i < batches.size(); i = next_batch++) {
+            results[i] = build_batch(_context, _binaries_cache, batches[i]);
+        }
+    };
 
-            try {
-                cl::Program program(_context.context(), sources);
-                program.build({_context.device()}, program_source.options.c_str());
-                // Store kernels for serialization process.
-                _context.store_binaries(program.getInfo<CL_PROGRAM_BINARIES>());
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < threads_num; i++) {
+        threads.emplace_back(build_batches);
+    }
+    build_batches();
+    for (auto& t : threads) {
+        t.join();
+    }
 
-                if (dump_sources && dump_file.good()) {
-                    dump_file << "\n/* Build Log:\n";
-                    for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>()) dump_file << p.second << "\n";
+    std::string err_log;  // accumulated build log from all parts (only contains messages from parts which failed
+                          // to compile)
+    for (size_t i = 0; i < batches.size(); i++) {
+        if (results[i].error)
+            std::rethrow_exception(results[i].error);
 
-                    dump_file << "*/\n";
-                }
+        err_log += results[i].err_log;
 
-                cl::vector<cl::Kernel> kernels;
-                program.createKernels(&kernels);
+        if (_context.logging_enabled()) {
+            _context.log(0, "Program batch " + std::to_string(i) + " (" + batches[i].program->options + ") built in " +
+                            std::to_string(results[i].build_time.count()) + " ms using " +
+                            std::to_string(threads_num) + " thread(s)");
+        }
+    }
 
-                for (auto& k : kernels) {
-                    auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
-                    kmap.emplace(kernel_name, k);
-                }
-            } catch (const cl::BuildError& err) {
-                if (dump_sources && dump_file.good())
-                    dump_file << "\n/* Build Log:\n";
+    if (!err_log.empty())
+        throw std::runtime_error("Program build failed:\n" + std::move(err_log));
 
-                for (auto& p : err.getBuildLog()) {
-                    if (dump_sources && dump_file.good())
-                        dump_file << p.second << "\n";
+    _one_time_kernels.clear();
+    for (size_t i = 0; i < batches.size(); i++) {
+        const auto& program = *batches[i].program;
+        _context.store_binaries(std::move(results[i].binaries));
 
-                    err_log += p.second + '\n';
-                }
+        for (auto& k : results[i].kernels) {
+            const auto id = program.entry_point_to_id.find(k.first);
+            if (id == program.entry_point_to_id.end())
+                continue;
 
-                if (dump_sources && dump_file.good())
-                    dump_file << "*/\n";
+            const auto& k_id = id->second;
+            if (program.one_time) {
+                _one_time_kernels[k_id] = k.second;
+            } else {
+                _kernels[k_id] = k.second;
             }
         }
-
-        if (!err_log.empty())
-            throw std::runtime_error("Program build failed:\n" + std::move(err_log));
-
-        return kmap;
-    } catch (const cl::Error& err) {
-        throw ocl_error(err);
     }
-}
 
-kernels_cache::kernel_type kernels_cache::get_kernel(kernel_id id, bool one_time_kernel) {
-    build_all();
-    if (one_time_kernel) {
-        return _one_time_kernels.at(id);
-    } else {
-        return _kernels.at(id);
-    }
+    if (_binaries_cache.enabled())
+        _binaries_cache.evict();
+
+    _kernels_code.clear();
+    _pending_compilation = false;
 }
 
-void kernels_cache::build_all() {
+void kernels_cache::build_async() {
     if (!_pending_compilation)
         return;
 
     std::lock_guard<std::mutex> lock(_mutex);
 
-    auto sorted_program_code = get_program_source(_kernels_code);
+    // the one time kernels are released by the next build, so they stay pending until they run
+    kernels_code lazy_code;
+    for (auto it = _kernels_code.begin(); it != _kernels_code.end();) {
+        if (it->second.one_time_kernel) {
+            ++it;
+        } else {
+            lazy_code.insert(*it);
+            it = _kernels_code.erase(it);
+        }
+    }
+    _pending_compilation = !_kernels_code.empty();
+    if (lazy_code.empty())
+        return;
 
-    _one_time_kernels.clear();
-    for (auto& program : sorted_program_code) {
-        auto kernels = build_program(program.second);
+    const auto& config = _context.get_configuration();
+    const auto programs = std::make_shared<const sorted_code>(get_program_source(lazy_code));
+    for (const auto& program : *programs) {
+        const std::string dump_file_name = get_dump_file_prefix(config, program.second);
+
+        for (size_t part_idx = 0; part_idx < program.second.source.size(); part_idx++) {
+            auto part = std::make_shared<lazy_part>();
+            part->programs = programs;
+            part->program = &program.second;
+            part->sources = &program.second.source[part_idx];
+            part->ids = program.second.part_ids[part_idx];
+            if (!dump_file_name.empty())
+                part->dump_file_name = dump_file_name + std::to_string(part_idx) + ".cl";
+
+            for (const auto& id : part->ids) _lazy_kernels[id] = part;
+            _lazy_queue.push_back(part);
+        }
+    }
 
-        for (auto& k : kernels) {
-            const auto& entry_point = k.first;
-            const auto& k_id = program.second.entry_point_to_id[entry_point];
-            if (program.second.one_time) {
-                _one_time_kernels[k_id] = k.second;
-            } else {
-                _kernels[k_id] = k.second;
-            }
+    if (_lazy_threads.empty()) {
+        size_t threads_num = config.compilation_threads_num != 0 ? config.compilation_threads_num
+                                                                 : std::thread::hardware_concurrency();
+        threads_num = std::max<size_t>(1, threads_num);
+        for (size_t i = 0; i < threads_num; i++) {
+            _lazy_threads.emplace_back(&kernels_cache::lazy_worker, this);
         }
     }
+    _lazy_work.notify_all();
+}
 
-    _kernels_code.clear();
-    _pending_compilation = false;
+void kernels_cache::lazy_worker() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _lazy_work.wait(lock, [&] { return _lazy_stop || !_lazy_queue.empty(); });
+        if (_lazy_stop)
+            return;
+
+        const auto part = _lazy_queue.front();
+        _lazy_queue.pop_front();
+        // the part may have been built already by the thread which needed one of its kernels
+        if (part->status != lazy_part::state::queued)
+            continue;
+
+        build_lazy_part(lock, part);
+        if (_lazy_queue.empty() && _binaries_cache.enabled())
+            _binaries_cache.evict();
+    }
+}
+
+void kernels_cache::build_lazy_part(std::unique_lock<std::mutex>& lock, const std::shared_ptr<lazy_part>& part) {
+    part->status = lazy_part::state::building;
+    lock.unlock();
+    auto result = build_batch(_context, _binaries_cache, {part->program, part->sources, part->dump_file_name});
+    lock.lock();
+
+    if (result.error) {
+        part->error = result.error;
+    } else if (!result.err_log.empty()) {
+        part->error = std::make_exception_ptr(std::runtime_error("Program build failed:\n" + result.err_log));
+    } else {
+        _context.store_binaries(std::move(result.binaries));
+        for (auto& k : result.kernels) {
+            const auto id = part->program->entry_point_to_id.find(k.first);
+            if (id != part->program->entry_point_to_id.end())
+                _kernels[id->second] = k.second;
+        }
+        // the kernels of a failed part stay, so running them reports the build error
+        for (const auto& id : part->ids) _lazy_kernels.erase(id);
+    }
+
+    if (_context.logging_enabled()) {
+        _context.log(0, "Program part (" + part->program->options + ") built lazily in " +
+                        std::to_string(result.build_time.count()) + " ms");
+    }
+
+    part->status = lazy_part::state::built;
+    _lazy_built.notify_all();
+}
+
+kernels_cache_statistics kernels_cache::get_statistics() const {
+    return _binaries_cache.get_statistics();
 }
 
 }  // namespace gpu
@@ -22,6 +22,12 @@
 #include <memory>
 #include <atomic>
 #include <string>
+#include <deque>
+#include <thread>
+#include <exception>
+#include <condition_variable>
+
+#include "kernels_binaries_cache.h"
 
 namespace cl {
 class Kernel;
@@ -51,6 +57,7 @@ public:
         bool dump_custom_program = false;
         bool one_time = false;
         std::map<std::string, std::string> entry_point_to_id;
+        std::vector<std::vector<std::string>> part_ids;  // the kernels of each part of the source
     };
 
     struct kernel_code {
@@ -74,11 +81,36 @@ private:
     std::map<std::string, kernel_type> _kernels;
     std::map<std::string, kernel_type> _one_time_kernels;  // These kernels are intended to be executed only once (can
                                                            // be removed later from the cache).
+    std::map<std::string, kernel_id> _kernels_ids;  // the ids of all the kernels set on the engine, by the kernel key
+    kernels_binaries_cache _binaries_cache;
+
+    // A part of the programs handed to the background compilation. It is built by the first thread claiming it:
+    // one of the background threads, or the thread running one of its kernels before they took it.
+    struct lazy_part {
+        enum class state { queued, building, built };
+
+        std::shared_ptr<const sorted_code> programs;  // keeps the program of the part alive
+        const program_code* program;
+        const source_code* sources;
+        std::vector<std::string> ids;
+        std::string dump_file_name;
+        state status = state::queued;
+        std::exception_ptr error;
+    };
+
+    std::deque<std::shared_ptr<lazy_part>> _lazy_queue;
+    std::map<kernel_id, std::shared_ptr<lazy_part>> _lazy_kernels;  // the kernels of the parts not built yet
+    std::condition_variable _lazy_work;
+    std::condition_variable _lazy_built;
+    std::vector<std::thread> _lazy_threads;
+    bool _lazy_stop = false;
 
     sorted_code get_program_source(const kernels_code& kernels_source_code) const;
+    // builds the part with the lock held, which is released while the part is compiled
+    void build_lazy_part(std::unique_lock<std::mutex>& lock, const std::shared_ptr<lazy_part>& part);
+    void lazy_worker();
     friend class gpu_toolkit;
     explicit kernels_cache(gpu_toolkit& context);
-    kernels_map build_program(const program_code& pcode) const;
 
 public:
     kernel_id set_kernel_source(const std::shared_ptr<kernel_selector::kernel_string>& kernel_string,
@@ -86,8 +118,15 @@ public:
                                 bool one_time_kernel);
     kernel_type get_kernel(kernel_id id, bool one_time_kernel);
     gpu_toolkit& get_context() { return _context; }
-    // forces compilation of all pending kernels/programs
+    ~kernels_cache();
+
+    // forces compilation of all pending kernels/programs; the parts of the programs are built concurrently
+    // on the number of threads set in the engine configuration
     void build_all();
+    // hands the pending kernels over to the background threads and returns at once; a kernel is built by
+    // get_kernel if the background threads did not build it yet. The one time kernels are built on their first use.
+    void build_async();
+    kernels_cache_statistics get_statistics() const;
 };
 
 }  // namespace gpu
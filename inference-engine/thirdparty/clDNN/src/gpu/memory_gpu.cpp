@@ -42,7 +42,7 @@ gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine,
 void* gpu_buffer::lock() {
     std::lock_guard<std::mutex> locker(_mutex);
     if (0 == _lock_count) {
-        _mapped_ptr = _context->queue(_net_id).enqueueMapBuffer(_buffer, CL_TRUE, CL_MAP_WRITE, 0, size());
+        _mapped_ptr = _context->map_queue(_net_id).enqueueMapBuffer(_buffer, CL_TRUE, CL_MAP_WRITE, 0, size());
     }
     _lock_count++;
     return _mapped_ptr;
@@ -52,7 +52,7 @@ void gpu_buffer::unlock() {
     std::lock_guard<std::mutex> locker(_mutex);
     _lock_count--;
     if (0 == _lock_count) {
-        _context->queue(_net_id).enqueueUnmapMemObject(_buffer, _mapped_ptr);
+        _context->map_queue(_net_id).enqueueUnmapMemObject(_buffer, _mapped_ptr);
         _mapped_ptr = nullptr;
     }
 }
@@ -137,7 +137,7 @@ gpu_image2d::gpu_image2d(const refcounted_obj_ptr<engine_impl>& engine,
 void* gpu_image2d::lock() {
     std::lock_guard<std::mutex> locker(_mutex);
     if (0 == _lock_count) {
-        _mapped_ptr = _context->queue(_net_id)
+        _mapped_ptr = _context->map_queue(_net_id)
                           .enqueueMapImage(_buffer,
                                            CL_TRUE,
                                            CL_MAP_WRITE,
@@ -154,7 +154,7 @@ void gpu_image2d::unlock() {
     std::lock_guard<std::mutex> locker(_mutex);
     _lock_count--;
     if (0 == _lock_count) {
-        _context->queue(_net_id).enqueueUnmapMemObject(_buffer, _mapped_ptr);
+        _context->map_queue(_net_id).enqueueUnmapMemObject(_buffer, _mapped_ptr);
         _mapped_ptr = nullptr;
     }
 }
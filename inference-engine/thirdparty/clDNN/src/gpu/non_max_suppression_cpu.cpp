@@ -17,6 +17,7 @@
 #include "non_max_suppression_inst.h"
 #include "primitive_inst.h"
 #include "network_impl.h"
+#include "ocl_toolkit.h"
 #include "register_gpu.hpp"
 #include "cpu_impl_helpers.hpp"
 
@@ -269,16 +270,10 @@ struct non_max_suppression_cpu : typed_primitive_impl<non_max_suppression> {
 
     virtual event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& event,
                                          typed_primitive_inst<non_max_suppression>& instance) {
-        for (auto e : event) {
-            e->wait();
-        }
-
-        auto ev = instance.get_network().get_engine().create_user_event(instance.get_network().get_id(), false);
-
-        run(instance);
-
-        dynamic_cast<cldnn::user_event*>(ev.get())->set();  // set as complete
-        return ev;
+        auto& network = instance.get_network();
+        return network.get_engine().get_context()->run_on_host(network.get_id(), event, [&instance] {
+            run(instance);
+        });
     }
 
     static primitive_impl* create(const non_max_suppression_node&) {
@@ -288,16 +283,10 @@ struct non_max_suppression_cpu : typed_primitive_impl<non_max_suppression> {
 }  // namespace
 
 namespace gpu {
-namespace detail {
-
-attach_non_max_suppression_gpu::attach_non_max_suppression_gpu() {
-    implementation_map<non_max_suppression>::add({
-        {std::make_tuple(engine_types::ocl, data_types::i32, format::bfyx), non_max_suppression_cpu::create},
-        {std::make_tuple(engine_types::ocl, data_types::f16, format::bfyx), non_max_suppression_cpu::create},
-        {std::make_tuple(engine_types::ocl, data_types::f32, format::bfyx), non_max_suppression_cpu::create}
-    });
+
+primitive_impl* runNonMaxSuppressionCpu(const non_max_suppression_node& arg) {
+    return non_max_suppression_cpu::create(arg);
 }
 
-}  // namespace detail
 }  // namespace gpu
 }  // namespace cldnn
@@ -92,6 +92,7 @@ public:
     }
 
     std::shared_ptr<gpu_toolkit> get_context() const { return _ctx; }
+    const std::vector<event_impl::ptr>& get_events() const { return _events; }
 
 private:
     void set_queue_stamp() {
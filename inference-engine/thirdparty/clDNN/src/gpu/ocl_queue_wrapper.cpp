@@ -68,6 +68,19 @@ std::string events_list_to_string(std::vector<cldnn::event_impl::ptr> events) {
 
 namespace cldnn {
 namespace gpu {
+namespace {
+// Collects the OpenCL events the dependencies are signaled with, the grouped events are waited for one by one.
+void collect_ocl_events(std::vector<event_impl::ptr> const& deps, std::vector<cl::Event>& events) {
+    for (auto& dep : deps) {
+        if (auto ocl_ev = dynamic_cast<base_event*>(dep.get())) {
+            if (ocl_ev->get()() != nullptr)
+                events.push_back(ocl_ev->get());
+        } else if (auto ocl_evs = dynamic_cast<base_events*>(dep.get())) {
+            collect_ocl_events(ocl_evs->get_events(), events);
+        }
+    }
+}
+}  // namespace
 
 gpu_queue::gpu_queue(uint32_t id, cl::CommandQueue queue, std::shared_ptr<gpu_toolkit> context)
     : id(id), _context(context), _command_queue(queue), _events_pool(new events_pool()) {}
@@ -76,22 +89,14 @@ event_impl::ptr gpu_queue::enqueue_kernel(cl::Kernel const& kern,
                                           cl::NDRange const& global,
                                           cl::NDRange const& local,
                                           std::vector<event_impl::ptr> const& deps) {
+    const bool out_of_order_execution = context()->out_of_order_execution();
     std::vector<cl::Event> dep_events;
-    auto dep_events_ptr = &dep_events;
-    if (!context()->get_configuration().host_out_of_order) {
-        for (auto& dep : deps)
-            if (auto ocl_ev = dynamic_cast<base_event*>(dep.get()))
-                dep_events.push_back(ocl_ev->get());
-    } else {
-        dep_events_ptr = nullptr;
-
-        sync_events(deps);
-    }
+    auto dep_events_ptr = get_wait_list(deps, dep_events);
 
     cl::Event ret_ev;
 
     try {
-        if (!context()->get_configuration().host_out_of_order || _output_event ||
+        if (out_of_order_execution || !context()->get_configuration().host_out_of_order || _output_event ||
             context()->get_configuration().enable_profiling) {
             _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, &ret_ev);
         } else {
@@ -104,12 +109,59 @@ event_impl::ptr gpu_queue::enqueue_kernel(cl::Kernel const& kern,
     return _events_pool->get_from_base_pool(context(), ret_ev, ++_queue_counter);
 }
 
+event_impl::ptr gpu_queue::enqueue_write_buffer(cl::Buffer const& buffer,
+                                                const void* src,
+                                                size_t size,
+                                                std::vector<event_impl::ptr> const& deps) {
+    std::vector<cl::Event> dep_events;
+    auto dep_events_ptr = get_wait_list(deps, dep_events);
+
+    cl::Event ret_ev;
+    try {
+        _command_queue.enqueueWriteBuffer(buffer, CL_FALSE, 0, size, src, dep_events_ptr, &ret_ev);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+
+    return _events_pool->get_from_base_pool(context(), ret_ev, ++_queue_counter);
+}
+
+event_impl::ptr gpu_queue::enqueue_read_buffer(cl::Buffer const& buffer,
+                                               void* dst,
+                                               size_t size,
+                                               std::vector<event_impl::ptr> const& deps) {
+    std::vector<cl::Event> dep_events;
+    auto dep_events_ptr = get_wait_list(deps, dep_events);
+
+    cl::Event ret_ev;
+    try {
+        _command_queue.enqueueReadBuffer(buffer, CL_FALSE, 0, size, dst, dep_events_ptr, &ret_ev);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+
+    return _events_pool->get_from_base_pool(context(), ret_ev, ++_queue_counter);
+}
+
 event_impl::ptr gpu_queue::enqueue_marker(std::vector<event_impl::ptr> const& deps) {
     if (deps.empty())
         return _events_pool->get_from_user_pool(context(), true);
 
     bool enabled_single_kernel = context()->get_configuration().single_kernel_name == "" ? false : true;
-    if (!context()->get_configuration().host_out_of_order) {
+    if (context()->out_of_order_execution()) {
+        std::vector<cl::Event> dep_events;
+        if (!enabled_single_kernel)
+            collect_ocl_events(deps, dep_events);
+
+        cl::Event ret_ev;
+        try {
+            _command_queue.enqueueMarkerWithWaitList(dep_events.empty() ? nullptr : &dep_events, &ret_ev);
+        } catch (cl::Error const& err) {
+            throw ocl_error(err);
+        }
+
+        return _events_pool->get_from_base_pool(context(), ret_ev, ++_queue_counter);
+    } else if (!context()->get_configuration().host_out_of_order) {
         cl::Event ret_ev;
         if (!enabled_single_kernel) {
             std::vector<cl::Event> dep_events;
@@ -141,6 +193,16 @@ event_impl::ptr gpu_queue::group_events(std::vector<event_impl::ptr> const& deps
     return _events_pool->get_from_group_pool(context(), deps);
 }
 
+void gpu_queue::enqueue_barrier() {
+    try {
+        _command_queue.enqueueBarrierWithWaitList(nullptr, nullptr);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+
+    _last_barrier = ++_queue_counter;
+}
+
 event_impl::ptr gpu_queue::create_user_event(bool set) { return _events_pool->get_from_user_pool(context(), set); }
 
 void gpu_queue::reset_events() { _events_pool->reset_events(); }
@@ -166,21 +228,45 @@ void gpu_queue::release_pending_memory() {
     _mm_free(ptr);
 }
 
+// Returns the wait list a command waits for its dependencies with,
+// or nullptr if they were synchronized with a barrier instead.
+std::vector<cl::Event>* gpu_queue::get_wait_list(std::vector<event_impl::ptr> const& deps,
+                                                 std::vector<cl::Event>& dep_events) {
+    if (context()->out_of_order_execution()) {
+        collect_ocl_events(deps, dep_events);
+    } else if (!context()->get_configuration().host_out_of_order) {
+        for (auto& dep : deps)
+            if (auto ocl_ev = dynamic_cast<base_event*>(dep.get()))
+                dep_events.push_back(ocl_ev->get());
+    } else {
+        sync_events(deps);
+        return nullptr;
+    }
+    return &dep_events;
+}
+
 void gpu_queue::sync_events(std::vector<event_impl::ptr> const& deps) {
     bool needs_barrier = false;
+    // the primitives run on the host threads are not ordered by the barriers, the commands wait for their events
+    std::vector<cl::Event> host_events;
     for (auto& dep : deps) {
         auto* ocl_ev = dynamic_cast<ocl_base_event*>(dep.get());
         if (ocl_ev->get_queue_stamp() > _last_barrier) {
             needs_barrier = true;
         }
+        auto* host_ev = dynamic_cast<user_event*>(dep.get());
+        if (host_ev && !host_ev->is_set()) {
+            host_events.push_back(host_ev->get());
+        }
     }
 
-    if (needs_barrier) {
+    if (needs_barrier || !host_events.empty()) {
+        auto wait_list = host_events.empty() ? nullptr : &host_events;
         try {
             if (_output_event)
-                _command_queue.enqueueBarrierWithWaitList(nullptr, &_last_barrier_ev);
+                _command_queue.enqueueBarrierWithWaitList(wait_list, &_last_barrier_ev);
             else
-                _command_queue.enqueueBarrierWithWaitList(nullptr, nullptr);
+                _command_queue.enqueueBarrierWithWaitList(wait_list, nullptr);
         } catch (cl::Error const& err) {
             throw ocl_error(err);
         }
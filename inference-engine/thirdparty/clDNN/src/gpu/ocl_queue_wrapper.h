@@ -86,13 +86,24 @@ public:
                                    cl::NDRange const& local,
                                    std::vector<event_impl::ptr> const& deps);
     event_impl::ptr enqueue_marker(std::vector<event_impl::ptr> const& deps);
+    event_impl::ptr enqueue_write_buffer(cl::Buffer const& buffer,
+                                         const void* src,
+                                         size_t size,
+                                         std::vector<event_impl::ptr> const& deps);
+    event_impl::ptr enqueue_read_buffer(cl::Buffer const& buffer,
+                                        void* dst,
+                                        size_t size,
+                                        std::vector<event_impl::ptr> const& deps);
     event_impl::ptr group_events(std::vector<event_impl::ptr> const& deps);
+    void enqueue_barrier();
     void reset_events();
     event_impl::ptr create_user_event(bool set);
     void release_events_pool();
     std::shared_ptr<gpu_toolkit> context() { return _context.lock(); }
 
 private:
+    std::vector<cl::Event>* get_wait_list(std::vector<event_impl::ptr> const& deps, std::vector<cl::Event>& dep_events);
+
     uint32_t id;
     std::weak_ptr<gpu_toolkit> _context;
     cl::CommandQueue _command_queue;
@@ -20,6 +20,7 @@
 #include "ocl_user_event.h"
 #include "command_queues_builder.h"
 #include "events_pool.h"
+#include "host_task_executor.h"
 
 #include <cassert>
 #include <iomanip>
@@ -112,6 +113,9 @@ gpu_toolkit::gpu_toolkit(const device_impl& device, const configuration& config)
     device_cache_reader dc_reader(_configuration.tuning_cache_path, _device_info.compute_units_count);
     _device_cache = dc_reader.get();
 
+    if (_configuration.host_threads_num != 0)
+        _host_tasks.reset(new host_task_executor(_context, _device, _configuration.host_threads_num));
+
     _logger = std::unique_ptr<ocl_logger>(new ocl_logger());
     if (logging_enabled()) {
         open_log() << "Engine configuration:\n"
@@ -125,8 +129,14 @@ gpu_toolkit::gpu_toolkit(const device_impl& device, const configuration& config)
                    << "    compiler options: " << _configuration.compiler_options << "\n"
                    << "    single kernel name: " << _configuration.single_kernel_name << "\n"
                    << "    out-of-order: " << std::boolalpha << config.host_out_of_order << "\n"
+                   << "    out-of-order execution: " << std::boolalpha << out_of_order_execution() << "\n"
                    << "    engine log: " << _configuration.log << "\n"
                    << "    sources dumps: " << _configuration.ocl_sources_dumps_dir << "\n"
+                   << "    compilation threads: " << _configuration.compilation_threads_num << "\n"
+                   << "    kernels per program: " << _configuration.kernels_per_program << "\n"
+                   << "    kernels cache: " << _configuration.kernels_cache_dir << "\n"
+                   << "    lazy kernels compilation: " << std::boolalpha << _configuration.lazy_kernels_compilation << "\n"
+                   << "    host threads: " << _configuration.host_threads_num << "\n"
                    << "\nEngine info:\n"
                    << "    cores count: " << _device_info.cores_count << "\n"
                    << "    core frequencey: " << _device_info.core_frequency << "\n"
@@ -138,6 +148,12 @@ gpu_toolkit::gpu_toolkit(const device_impl& device, const configuration& config)
     }
 }
 
+const cl::CommandQueue& gpu_toolkit::map_queue(uint32_t id) {
+    if (_host_tasks && host_task_executor::on_executor_thread())
+        return _host_tasks->queue();
+    return queue(id);
+}
+
 gpu_queue& gpu_toolkit::get_command_queue(uint32_t id) {
     return _command_queues_w.at(id);
 }
@@ -180,6 +196,22 @@ event_impl::ptr gpu_toolkit::enqueue_marker(uint32_t queue_id, std::vector<event
     return get_command_queue(queue_id).enqueue_marker(deps);
 }
 
+event_impl::ptr gpu_toolkit::enqueue_write_buffer(uint32_t queue_id,
+                                                  cl::Buffer const& buffer,
+                                                  const void* src,
+                                                  size_t size,
+                                                  std::vector<event_impl::ptr> const& deps) {
+    return get_command_queue(queue_id).enqueue_write_buffer(buffer, src, size, deps);
+}
+
+event_impl::ptr gpu_toolkit::enqueue_read_buffer(uint32_t queue_id,
+                                                 cl::Buffer const& buffer,
+                                                 void* dst,
+                                                 size_t size,
+                                                 std::vector<event_impl::ptr> const& deps) {
+    return get_command_queue(queue_id).enqueue_read_buffer(buffer, dst, size, deps);
+}
+
 event_impl::ptr gpu_toolkit::group_events(uint32_t queue_id, std::vector<event_impl::ptr> const& deps) {
     return get_command_queue(queue_id).group_events(deps);
 }
@@ -188,10 +220,34 @@ event_impl::ptr gpu_toolkit::create_user_event(uint32_t queue_id, bool set) {
     return get_command_queue(queue_id).create_user_event(set);
 }
 
+event_impl::ptr gpu_toolkit::run_on_host(uint32_t queue_id,
+                                         std::vector<event_impl::ptr> const& deps,
+                                         std::function<void()> const& task) {
+    if (!_host_tasks) {
+        for (auto& dep : deps) {
+            dep->wait();
+        }
+
+        auto ev = create_user_event(queue_id, false);
+        task();
+        dynamic_cast<cldnn::user_event*>(ev.get())->set();  // set as complete
+        return ev;
+    }
+
+    _host_tasks->check_error();
+    auto ev = create_user_event(queue_id, false);
+    _host_tasks->submit(deps, task, ev);
+    // the task waits for the commands it depends on, they have to be submitted to the device
+    flush(queue_id);
+    return ev;
+}
+
 void gpu_toolkit::reset_events(uint32_t queue_id) { get_command_queue(queue_id).reset_events(); }
 
 void gpu_toolkit::release_events_pool(uint32_t queue_id) { get_command_queue(queue_id).release_events_pool(); }
 
+void gpu_toolkit::enqueue_barrier(uint32_t queue_id) { get_command_queue(queue_id).enqueue_barrier(); }
+
 void gpu_toolkit::release_all_events_pools() {
     for (auto& queue : _command_queues_w) {
         queue.second.release_events_pool();
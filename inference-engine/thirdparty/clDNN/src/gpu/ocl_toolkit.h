@@ -26,6 +26,7 @@
 
 #include <memory>
 #include <chrono>
+#include <functional>
 #include <string>
 #include <vector>
 #include <map>
@@ -59,6 +60,8 @@ protected:
     std::shared_ptr<gpu_toolkit> _context;
 };
 
+class host_task_executor;
+
 class gpu_toolkit : public std::enable_shared_from_this<gpu_toolkit> {
     friend class context_holder;
 
@@ -72,6 +75,8 @@ public:
     const cl::Context& context() const { return _context; }
     const cl::Device& device() const { return _device; }
     const cl::CommandQueue& queue(uint32_t id) { return get_command_queue(id).queue(); }
+    // the queue the memory of the network is mapped with on the current thread
+    const cl::CommandQueue& map_queue(uint32_t id);
 
     const configuration& get_configuration() const { return _configuration; }
     device_info_internal get_device_info() const { return _device_info; }
@@ -91,6 +96,9 @@ public:
     std::string single_kernel_name() const { return _configuration.single_kernel_name; }
     bool enabled_single_kernel() const { return single_kernel_name() == "" ? false : true; }
 
+    // the primitives are synchronized with the events of their dependencies on the out-of-order queues
+    bool out_of_order_execution() const { return _configuration.out_of_order_execution && _neo_driver; }
+
     void set_output_event(uint32_t queue_id, bool out_event);
 
     event_impl::ptr enqueue_kernel(uint32_t queue_id,
@@ -99,9 +107,25 @@ public:
                                    cl::NDRange const& local,
                                    std::vector<event_impl::ptr> const& deps);
     event_impl::ptr enqueue_marker(uint32_t queue_id, std::vector<event_impl::ptr> const& deps);
+    event_impl::ptr enqueue_write_buffer(uint32_t queue_id,
+                                         cl::Buffer const& buffer,
+                                         const void* src,
+                                         size_t size,
+                                         std::vector<event_impl::ptr> const& deps);
+    event_impl::ptr enqueue_read_buffer(uint32_t queue_id,
+                                        cl::Buffer const& buffer,
+                                        void* dst,
+                                        size_t size,
+                                        std::vector<event_impl::ptr> const& deps);
     event_impl::ptr group_events(uint32_t queue_id, std::vector<event_impl::ptr> const& deps);
+    void enqueue_barrier(uint32_t queue_id);
     void reset_events(uint32_t queue_id);
     event_impl::ptr create_user_event(uint32_t queue_id, bool set);
+    // Runs a primitive implemented on the host once the dependencies are complete and returns the event it sets.
+    // The primitive runs on the host threads if there are any, otherwise it runs before the function returns.
+    event_impl::ptr run_on_host(uint32_t queue_id,
+                                std::vector<event_impl::ptr> const& deps,
+                                std::function<void()> const& task);
     void release_events_pool(uint32_t queue_id);
     void release_all_events_pools();
 
@@ -132,6 +156,8 @@ private:
 
     struct ocl_logger;
     std::unique_ptr<ocl_logger> _logger;
+    // declared last, so the tasks are finished before the queues and the kernels are destroyed
+    std::unique_ptr<host_task_executor> _host_tasks;
 
     // returns whether a barrier has been added
     std::ofstream& open_log();
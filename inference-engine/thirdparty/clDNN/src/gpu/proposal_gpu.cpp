@@ -378,13 +378,7 @@ struct proposal_gpu : typed_primitive_impl<proposal> {
         }
     }
 
-    event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& events, proposal_inst& instance) override {
-        for (auto& a : events) {
-            a->wait();
-        }
-
-        auto ev = instance.get_network().get_engine().create_user_event(instance.get_network().get_id(), false);
-
+    void run(proposal_inst& instance) {
         if (instance.dependencies().size() == 4) {
             auto &proposal_probabilities = instance.dep_memory(proposal_inst::proposal_probabilities_out);
             if (instance.dep_memory(proposal_inst::cls_scores_index).get_layout().data_type == data_types::f16) {
@@ -401,9 +395,13 @@ struct proposal_gpu : typed_primitive_impl<proposal> {
                 execute<data_type_to_type<data_types::f32>::type>(instance);
             }
         }
+    }
 
-        dynamic_cast<cldnn::user_event*>(ev.get())->set();  // set as complete
-        return ev;
+    event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& events, proposal_inst& instance) override {
+        auto& network = instance.get_network();
+        return network.get_engine().get_context()->run_on_host(network.get_id(), events, [this, &instance] {
+            run(instance);
+        });
     }
 
     static primitive_impl* create(const proposal_node& arg) {
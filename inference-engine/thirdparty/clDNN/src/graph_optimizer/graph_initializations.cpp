@@ -30,6 +30,7 @@
 #include "lstm_dynamic_timeloop_inst.h"
 #include "mutable_data_inst.h"
 #include "arg_max_min_inst.h"
+#include "detection_output_inst.h"
 
 #include <iomanip>
 #include <string>
@@ -243,6 +244,17 @@ void graph_initializations::replace_nodes(program_impl& p) {
     }
 }
 
+// The first part of the GPU detection output sorts the priors of an image in SLM
+static bool detection_output_fits_slm(program_impl& p, const detection_output_node& node) {
+    auto prim = node.get_primitive();
+    auto location_layout = node.location().get_output_layout();
+    const size_t images = static_cast<size_t>(location_layout.size.batch[0]);
+    const size_t loc_classes = prim->share_location ? 1 : static_cast<size_t>(prim->num_classes);
+    const size_t priors = location_layout.count() / (images * loc_classes * PRIOR_BOX_SIZE);
+    const size_t slm_size = sizeof(uint32_t) * (priors + prim->num_classes * images + 1);
+    return slm_size <= p.get_engine().get_device_info().max_local_mem_size;
+}
+
 void graph_initializations::handle_detection_output(program_impl& p) {
     auto itr = p.nodes_map.begin();  // note we need to use iterators since currently processed element can be removed
     while (itr != p.nodes_map.end()) {
@@ -252,8 +264,10 @@ void graph_initializations::handle_detection_output(program_impl& p) {
         if ((p.get_options().get<build_option_type::detection_output_gpu>()->enabled()) &&
             (node.is_type<detection_output>()) &&
             (node.id().find("_pre") ==
-             std::string::npos)) {  // ToDo: this will fail if user will name the primitive with using _pre like do_pre
+             std::string::npos) &&  // ToDo: this will fail if user will name the primitive with using _pre like do_pre
                                     //       we need to use node mark() or some other idea to prevent it
+            detection_output_fits_slm(p, node.as<detection_output>())) {
+            node.as<detection_output>().set_use_gpu_kernels(true);
             // rename detection output
             const primitive_id detect_out_node_name = node.id();
             const primitive_id new_primitive_id = detect_out_node_name + "_pre";
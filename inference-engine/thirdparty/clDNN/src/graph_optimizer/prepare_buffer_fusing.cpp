@@ -35,6 +35,22 @@
 
 using namespace cldnn;
 
+namespace {
+// The size of the block the format splits the features into, 1 for the formats without it
+int get_feature_block_size(format fmt) {
+    for (const auto& block : fmt.block_sizes()) {
+        if (block.first == 1)
+            return block.second;
+    }
+    return 1;
+}
+
+// The blocked formats with the index helpers taking the feature padding into account
+bool is_crop_in_place_blocked_format(format fmt) {
+    return fmt == format::bfyx_f16 || fmt == format::b_fs_yx_fsv32 || fmt == format::fs_b_yx_fsv32;
+}
+}  // namespace
+
 // ToDo remove friendship relation from  program_node
 void prepare_buffer_fusing::run(program_impl& p) {
     bool is_debug = p.get_options().get<build_option_type::debug>()->enabled();
@@ -80,11 +96,14 @@ void prepare_buffer_fusing::run(program_impl& p) {
                 if (output_format != l.format || output_datatype != l.data_type)
                     return;
 
-                if (l.format == format::bfyx_f16 && (l.size.feature[0] % 16 != 0 || node.get_primitive()->axis != concatenation::along_f))
+                // The inputs of the blocked formats start at the feature block boundaries, so each producer
+                // writes whole blocks of its slice
+                if ((l.format == format::bfyx_f16 || l.format == format::b_fs_yx_fsv32 || l.format == format::b_fs_zyx_fsv32) &&
+                    (l.size.feature[0] % get_feature_block_size(l.format) != 0 || node.get_primitive()->axis != concatenation::along_f))
                     return;
 
-                if ((l.format == format::b_fs_yx_fsv32 || l.format == format::b_fs_zyx_fsv32) &&
-                    (l.size.feature[0] % 32 != 0 || node.get_primitive()->axis != concatenation::along_f))
+                if (l.format == format::fs_b_yx_fsv32 && node.get_primitive()->axis == concatenation::along_f &&
+                    l.size.feature[0] % get_feature_block_size(l.format) != 0)
                     return;
 
                 // TODO: If we replace byxf_af32 with byxf we can probably do this optimization, but support in kernels is required
@@ -247,7 +266,16 @@ void prepare_buffer_fusing::run(program_impl& p) {
                         return;
                 }
 
-                if (format == format::bfyx && crop_size.batch[0] == input_layout.size.batch[0] &&
+                // The blocked crop stays in place when its features start at a block boundary,
+                // the users read the padded blocks directly
+                bool blocked_in_place = is_crop_in_place_blocked_format(format) && input_layout.format == format &&
+                                        opt_lower_pad % get_feature_block_size(format) == 0;
+                for (auto& usr : node.get_users()) {
+                    if (!usr->is_type<convolution>() && !usr->is_type<pooling>() && !usr->is_type<eltwise>())
+                        blocked_in_place = false;
+                }
+
+                if ((format == format::bfyx || blocked_in_place) && crop_size.batch[0] == input_layout.size.batch[0] &&
                     crop_size.spatial[0] == input_layout.size.spatial[0] &&
                     crop_size.spatial[1] == input_layout.size.spatial[1] && out_padd.lower_size().feature[0] == 0 &&
                     out_padd.upper_size().feature[0] == 0 && out_padd.lower_size().batch[0] == 0 &&
@@ -408,27 +408,44 @@ void prepare_primitive_fusing::fuse_simple_primitives(program_impl &p) {
             auto parent1 = parents[0];
             auto parent2 = parents[1];
 
-            // We should have at least one convolution node
-            if (!parent1->is_type<convolution>() && !parent2->is_type<convolution>())
+            // Eltwise is attached as a post-op to the convolution, fully_connected or gemm kernel,
+            // so the chains like conv -> scale -> sum -> activation -> quantize end up in a single primitive
+            auto can_fuse_parent = [&](cldnn::program_node* parent) -> bool {
+                if (parent->is_type<convolution>())
+                    return conv_supports_fusings(parent->as<convolution>());
+                if (parent->is_type<fully_connected>())
+                    return fc_supports_fusings(parent->as<fully_connected>());
+                if (parent->is_type<gemm>())
+                    return gemm_supports_fusings(parent->as<gemm>()) &&
+                           parent->get_output_layout().format == format::bfyx;
+                return false;
+            };
+
+            auto is_fusable_type = [](cldnn::program_node* parent) -> bool {
+                return parent->is_type<convolution>() || parent->is_type<fully_connected>() || parent->is_type<gemm>();
+            };
+
+            // We should have at least one convolution, fully_connected or gemm node
+            if (!is_fusable_type(parent1) && !is_fusable_type(parent2))
                 return;
 
-            // Choose a convolution node
-            size_t fused_idx = parent1->is_type<convolution>() ? 0 : 1;
-            size_t peer_idx  = parent1->is_type<convolution>() ? 1 : 0;
+            // Choose a node to fuse to
+            size_t fused_idx = is_fusable_type(parent1) ? 0 : 1;
+            size_t peer_idx  = is_fusable_type(parent1) ? 1 : 0;
 
             int p1_pnum = p.get_processing_order().get_processing_number(parents[fused_idx]);
             int p2_pnum = p.get_processing_order().get_processing_number(parents[peer_idx]);
 
-            if (p1_pnum < p2_pnum && parents[peer_idx]->is_type<convolution>()) {
+            if (p1_pnum < p2_pnum && is_fusable_type(parents[peer_idx])) {
                 std::swap(fused_idx, peer_idx);
             }
 
             auto fused_node = parents[fused_idx];
             auto peer_node = parents[peer_idx];
-            if (parent1->is_type<convolution>() && !conv_supports_fusings(parent1->as<convolution>()))
+            if (is_fusable_type(parent1) && !can_fuse_parent(parent1))
                 return;
 
-            if (parent2->is_type<convolution>() && !conv_supports_fusings(parent2->as<convolution>()))
+            if (is_fusable_type(parent2) && !can_fuse_parent(parent2))
                 return;
 
             // This fusing can be extended to support peer node in any layout and with broadcast
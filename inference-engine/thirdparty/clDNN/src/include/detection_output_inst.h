@@ -38,6 +38,14 @@ public:
     program_node& location() const { return get_dependency(0); }
     program_node& confidence() const { return get_dependency(1); }
     program_node& prior_box() const { return get_dependency(2); }
+
+    // Set by graph_initializations when the build option asks for the GPU kernels and the priors of an image fit SLM,
+    // the output then holds the per-class detections the detection_output_sort node reduces to keep_top_k.
+    bool use_gpu_kernels() const { return gpu_kernels; }
+    void set_use_gpu_kernels(bool value) { gpu_kernels = value; }
+
+private:
+    bool gpu_kernels = false;
 };
 
 using detection_output_node = typed_program_node<detection_output>;
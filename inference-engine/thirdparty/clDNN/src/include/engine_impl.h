@@ -123,12 +123,16 @@ public:
     memory_pool& get_memory_pool() { return _memory_pool; }
 
     uint64_t get_max_used_device_memory() const { return _memory_pool.get_max_peak_device_memory_used(); }
+    uint64_t get_max_used_device_memory(uint32_t net_id) const {
+        return _memory_pool.get_max_peak_device_memory_used(net_id);
+    }
     uint64_t get_used_device_memory() const { return _memory_pool.get_temp_memory_used(); }
 
     void dump_memory_pool(const program_impl& program, std::string& path, std::string& dependencies) {
         _memory_pool.dump_memory_pool(program, path, dependencies);
     }
     bool use_memory_pool() const;
+    bool use_memory_arena() const { return use_memory_pool() && configuration().enable_memory_arena; }
 
 private:
     engine_configuration _configuration;
@@ -26,6 +26,7 @@
 #include <map>
 #include <list>
 #include <string>
+#include <mutex>
 
 namespace cldnn {
 
@@ -66,6 +67,19 @@ struct memory_record {
     memory_record(memory_set users, refcounted_obj_ptr<memory_impl>& memory, uint32_t net_id);
 };
 
+// output buffer of a primitive to be placed in the memory arena of its network
+struct arena_request {
+    primitive_id _id;
+    layout _layout;
+    std::set<primitive_id> _restrictions;  // primitives the buffer must not overlap with
+};
+
+// single allocation the reusable buffers of a network are sub-buffers of
+struct memory_arena {
+    refcounted_obj_ptr<memory_impl> _memory;
+    std::map<primitive_id, size_t> _offsets;
+};
+
 struct padded_pool_comparer {
     bool operator()(const layout& ll, const layout& rl) const {
         if (ll.format != rl.format)
@@ -93,6 +107,9 @@ struct padded_pool_comparer {
 // - images 2d - not implemented yet
 // - images 2d arrays - not implemented yet
 // - immutable - if user request for non reusable resource don't use pool, return
+// - arena - optional, planned by the network before its primitives are allocated. Every requested buffer gets
+//     an offset in a single allocation, the lowest one where it doesn't overlap any buffer it conflicts with
+//     (buffers are placed in decreasing size order). Buffers not planned in the arena fall back to the pools above.
 
 // TODO list:
 // - resolve engine <--> memory_pool circular dependency
@@ -109,9 +126,13 @@ class memory_pool {
     std::multimap<uint64_t, memory_record> _non_padded_pool;
     std::map<layout, std::list<memory_record>, padded_pool_comparer> _padded_pool;
     std::multimap<uint64_t, memory_record> _no_reusable_pool;
+    std::map<uint32_t, memory_arena> _arenas;
     engine_impl* _engine;
     std::atomic<uint64_t> _temp_memory_used;
     uint64_t _max_peak_memory_used;
+    mutable std::mutex _network_memory_mutex;
+    std::map<uint32_t, uint64_t> _network_memory_used;
+    std::map<uint32_t, uint64_t> _network_max_peak_memory_used;
 
 public:
     explicit memory_pool(engine_impl& engine);
@@ -134,14 +155,20 @@ public:
     refcounted_obj_ptr<memory_impl> get_from_across_networks_pool(const layout& layout,
                                                                   const primitive_id& id,
                                                                   uint32_t network_id);
+    refcounted_obj_ptr<memory_impl> get_from_arena(const layout& layout, const primitive_id& id, uint32_t network_id);
+    // places the requested buffers in an arena of the network, the ones which layouts can't be reused are skipped.
+    // Returns false if no arena was created, e.g. when the buffers don't fit in one allocation.
+    bool plan_arena(const std::vector<arena_request>& requests, uint32_t network_id);
+    void release_arena(uint32_t network_id);
     void clear_pool();
     void color_graph(const program_impl&);
     void dump_memory_pool(const program_impl&, std::string&, std::string&);
 
     uint64_t get_temp_memory_used() const { return _temp_memory_used; }
     uint64_t get_max_peak_device_memory_used() const { return _max_peak_memory_used; }
-    void add_memory_used(size_t value);
-    void subtract_memory_used(size_t value);
+    uint64_t get_max_peak_device_memory_used(uint32_t network_id) const;
+    void add_memory_used(size_t value, uint32_t network_id);
+    void subtract_memory_used(size_t value, uint32_t network_id);
 };
 
 }  // namespace cldnn
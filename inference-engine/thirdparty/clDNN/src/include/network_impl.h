@@ -56,6 +56,8 @@ public:
     void reset_execution(bool wait = true);
     void set_input_data(const primitive_id& id, memory_impl& data);
     void set_output_memory(const primitive_id& id, memory_impl& mem);
+    event_impl::ptr copy_from_host(memory_impl& mem, const void* src);
+    event_impl::ptr copy_to_host(memory_impl& mem, void* dst, const std::vector<event_impl::ptr>& deps);
 
     void set_learning_rate(const float lr);
     float get_learning_rate();
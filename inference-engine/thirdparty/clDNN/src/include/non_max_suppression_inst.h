@@ -33,6 +33,10 @@ public:
         : parent(prim, prog)
     {}
 
+    program_node& input() const {
+        return get_dependency(0);
+    }
+
     program_node& input_boxes() const {
         return get_dependency(0);
     }
@@ -107,4 +111,8 @@ public:
 
 using non_max_suppression_inst = typed_primitive_inst<non_max_suppression>;
 
+namespace gpu {
+primitive_impl* runNonMaxSuppressionCpu(const non_max_suppression_node& arg);
+}  // namespace gpu
+
 }  // namespace cldnn
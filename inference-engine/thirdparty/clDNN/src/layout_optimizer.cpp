@@ -467,15 +467,14 @@ format layout_optimizer::imad_case(convolution_node const& node) const {
 
     bool is_grouped = node.get_split() > 1 || node.get_groups() > 1;
     bool is_dw = is_depthwise(node);
+    bool asymmetric_quantization = node.activations_zero_points_term() || node.weights_zero_points_term();
 
     if (dims_count == 5 && is_grouped) {
         return format::bfzyx;
-    } else if (dims_count == 4 && is_grouped && !is_dw) {
+    } else if (dims_count == 4 && is_grouped && !is_dw && asymmetric_quantization) {
         return format::bfyx;
     }
 
-    bool asymmetric_quantization = node.activations_zero_points_term() || node.weights_zero_points_term();
-
     if (asymmetric_quantization && _optimization_attributes.b_fs_zyx_fsv32_network && out_size.feature[0] % 4 == 0) {
         if (dims_count == 5) {
             return format::b_fs_zyx_fsv32;
@@ -488,32 +487,24 @@ format layout_optimizer::imad_case(convolution_node const& node) const {
         return format::bfzyx;
     }
 
-    if (stride.spatial[0] != stride.spatial[1] || out_size.spatial[0] != out_size.spatial[1] ||
-        (weights_dt != data_types::u8 && weights_dt != data_types::i8)) {
+    // Depthwise and grouped convolutions have own IMAD kernel in b_fs_yx_fsv4,
+    // so the quantized network stays in the same blocked layout around them
+    if (is_grouped && node.get_split() == 1 && !asymmetric_quantization && weights_dt == data_types::i8) {
+        return format::b_fs_yx_fsv4;
+    }
+
+    if (is_grouped && !is_dw) {
+        return format::bfyx;
+    } else if (is_dw && node.get_split() > 1) {
         return format::byxf_af32;
     }
 
-    if (node.get_groups() != 1) {  // depthwise parent
-        // use byxf_af32 if there are any depthwise convolutions, else b_fs_yx_fsv4
-        for (auto u : node.get_users()) {
-            if (u->get_dependency(0).is_type<convolution>()) {
-                convolution_node* conv_node = &u->get_dependency(0).as<convolution>();
-                if (conv_node->get_groups() != 1)
-                    return format::byxf_af32;
-            }
-        }
-        return format::b_fs_yx_fsv4;
-    } else {
-        // use bxyf_af32 if every user is a depthwise convolution, else b_fs_yx_fsv4
-        for (auto u : node.get_users()) {
-            if (!u->get_dependency(0).is_type<convolution>())
-                return format::b_fs_yx_fsv4;
-            convolution_node *conv_node = &u->get_dependency(0).as<convolution>();
-            if (conv_node->get_groups() == 1)
-                return format::b_fs_yx_fsv4;
-        }
+    if (stride.spatial[0] != stride.spatial[1] || out_size.spatial[0] != out_size.spatial[1] ||
+        (weights_dt != data_types::u8 && weights_dt != data_types::i8)) {
         return format::byxf_af32;
     }
+
+    return format::b_fs_yx_fsv4;
 }
 
 layout layout_optimizer::get_expected_layout(layout const& current_layout,
@@ -40,6 +40,17 @@ memory memory::share_buffer(const engine& engine, const layout& layout, shared_h
     return memory(engine.get()->reinterpret_handle(layout, &params, net_id).detach());
 }
 
+memory memory::share_host_ptr(const engine& engine, const layout& layout, void* ptr, uint32_t net_id) {
+    shared_mem_params params = { shared_mem_type::shared_mem_host_ptr, nullptr, nullptr, ptr,
+#ifdef WIN32
+        nullptr,
+#else
+        0,
+#endif
+        0 };
+    return memory(engine.get()->reinterpret_handle(layout, &params, net_id).detach());
+}
+
 memory memory::share_image(const engine& engine, const layout& layout, shared_handle img, uint32_t net_id) {
     shared_mem_params params = { shared_mem_type::shared_mem_image, nullptr, nullptr, img,
 #ifdef WIN32
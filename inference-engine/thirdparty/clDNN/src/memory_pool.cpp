@@ -18,6 +18,8 @@
 
 #include <algorithm>
 #include <fstream>
+#include <limits>
+#include <numeric>
 #include <vector>
 
 #include "memory_impl.h"
@@ -40,13 +42,21 @@ memory_record::memory_record(memory_set users,
                              uint32_t net_id)
     : _users(users), _memory(memory), _network_id(net_id) {}
 
+namespace {
+bool can_reuse_buffer(const layout& layout) {
+    return layout.format != format::fs_b_yx_fsv32 &&
+           ((layout.format != format::b_fs_yx_fsv32 && layout.format != format::b_fs_zyx_fsv32) ||
+            (layout.size.feature[0] % 32 == 0));
+}
+}  // namespace
+
 memory_impl::ptr memory_pool::alloc_memory(const layout& layout, uint32_t net_id) {
     auto context = _engine->get_context();
     if (layout.bytes_count() > context->get_device_info().max_alloc_mem_size) {
         throw std::runtime_error("exceeded max size of memory object allocation");
     }
 
-    add_memory_used(layout.bytes_count());
+    add_memory_used(layout.bytes_count(), net_id);
 
     if (_max_peak_memory_used > context->get_device_info().max_global_mem_size) {
         throw std::runtime_error("exceeded global device memory");
@@ -99,6 +109,13 @@ memory_impl::ptr memory_pool::get_memory(const layout& layout, const shared_mem_
                 buf,
                 net_id), false };
             return mem_impl;
+        } else if (params->mem_type == shared_mem_type::shared_mem_host_ptr) {
+            cl::Buffer buf(_engine->get_context()->context(), CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR,
+                           layout.bytes_count(), params->mem);
+            memory_impl::ptr mem_impl{ new gpu::gpu_buffer(engine_impl::ptr(_engine), layout,
+                buf,
+                net_id), false };
+            return mem_impl;
         } else {
             throw std::runtime_error("unknown shared object fromat or type");
         }
@@ -145,9 +162,7 @@ memory_impl::ptr memory_pool::get_from_non_padded_pool(const layout& layout,
     while (it != _non_padded_pool.end()) {
         if (it->second._network_id == network_id &&
             it->second._memory->get_layout().format != format::fs_b_yx_fsv32 &&
-            layout.format != format::fs_b_yx_fsv32 &&
-            ((layout.format != format::b_fs_yx_fsv32 && layout.format != format::b_fs_zyx_fsv32) ||
-             (layout.size.feature[0] % 32 == 0)) &&
+            can_reuse_buffer(layout) &&
             !has_conflict(it->second._users, restrictions, network_id)) {
             it->second._users.insert(memory_user(id, network_id));
             auto ret_mem = _engine->reinterpret_buffer(*it->second._memory, layout);
@@ -226,6 +241,76 @@ memory_impl::ptr memory_pool::get_from_across_networks_pool(const layout& layout
     return mem;
 }
 
+bool memory_pool::plan_arena(const std::vector<arena_request>& requests, uint32_t network_id) {
+    std::vector<size_t> order;
+    for (size_t i = 0; i < requests.size(); i++) {
+        const auto& layout = requests[i]._layout;
+        if (!layout.format.is_image() && layout.data_padding == padding{{0, 0, 0, 0}, 0} && can_reuse_buffer(layout))
+            order.push_back(i);
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return requests[lhs]._layout.bytes_count() > requests[rhs]._layout.bytes_count();
+    });
+
+    auto conflict = [](const arena_request& a, const arena_request& b) {
+        return a._restrictions.count(b._id) != 0 || b._restrictions.count(a._id) != 0;
+    };
+
+    auto device_info = _engine->get_context()->get_device_info();
+    const size_t alignment = std::max<size_t>(device_info.mem_base_addr_align, 1);
+
+    // first fit: every buffer takes the lowest offset where it doesn't overlap the already placed conflicting ones
+    std::vector<size_t> offsets(requests.size(), 0);
+    std::vector<size_t> placed;
+    size_t arena_size = 0;
+    for (auto i : order) {
+        const size_t size = requests[i]._layout.bytes_count();
+        std::vector<std::pair<size_t, size_t>> taken;
+        for (auto j : placed) {
+            if (conflict(requests[i], requests[j]))
+                taken.emplace_back(offsets[j], offsets[j] + requests[j]._layout.bytes_count());
+        }
+        std::sort(taken.begin(), taken.end());
+
+        size_t offset = 0;
+        for (const auto& range : taken) {
+            if (offset + size <= range.first)
+                break;
+            offset = std::max(offset, align_to(range.second, alignment));
+        }
+        offsets[i] = offset;
+        placed.push_back(i);
+        arena_size = std::max(arena_size, offset + size);
+    }
+
+    if (placed.size() < 2 || arena_size > device_info.max_alloc_mem_size ||
+        arena_size > static_cast<size_t>(std::numeric_limits<tensor::value_type>::max()))
+        return false;
+
+    memory_arena arena;
+    arena._memory = alloc_memory({data_types::u8, format::bfyx, {1, 1, static_cast<tensor::value_type>(arena_size), 1}},
+                                 network_id);
+    for (auto i : placed)
+        arena._offsets[requests[i]._id] = offsets[i];
+    _arenas[network_id] = std::move(arena);
+    return true;
+}
+
+memory_impl::ptr memory_pool::get_from_arena(const layout& layout, const primitive_id& id, uint32_t network_id) {
+    const auto& arena = _arenas.at(network_id);
+    cl_buffer_region region = {arena._offsets.at(id), layout.bytes_count()};
+    try {
+        cl::Buffer buffer = dynamic_cast<const gpu::gpu_buffer&>(*arena._memory).get_buffer();
+        cl::Buffer sub_buffer = buffer.createSubBuffer(CL_MEM_READ_WRITE, CL_BUFFER_CREATE_TYPE_REGION, &region);
+        memory_impl::ptr mem_impl{new gpu::gpu_buffer(engine_impl::ptr(_engine), layout, sub_buffer, network_id), false};
+        return mem_impl;
+    } catch (const cl::Error&) {
+        throw std::runtime_error("GPU sub-buffer creation failed");
+    }
+}
+
+void memory_pool::release_arena(uint32_t network_id) { _arenas.erase(network_id); }
+
 memory_impl::ptr memory_pool::get_memory(const layout& layout, uint32_t net_id) {
     return alloc_memory(layout, net_id);
 }
@@ -238,6 +323,9 @@ memory_impl::ptr memory_pool::get_memory(const layout& layout,
     if (reusable_across_network) {
         // reusable within the same network
         if (!layout.format.is_image() && layout.data_padding == padding{{0, 0, 0, 0}, 0}) {
+            auto arena = _arenas.find(network_id);
+            if (arena != _arenas.end() && arena->second._offsets.count(id) != 0)
+                return get_from_arena(layout, id, network_id);
             // non-padded buffers
             return get_from_non_padded_pool(layout, id, network_id, restrictions);
         } else if (!layout.format.is_image()) {
@@ -306,13 +394,32 @@ void memory_pool::color_graph(const program_impl& program) {
     }
 }
 
-void memory_pool::add_memory_used(size_t value) {
+void memory_pool::add_memory_used(size_t value, uint32_t network_id) {
     _temp_memory_used += value;
     if (_temp_memory_used > _max_peak_memory_used) {
         _max_peak_memory_used = _temp_memory_used;
     }
+
+    std::lock_guard<std::mutex> lock(_network_memory_mutex);
+    auto& used = _network_memory_used[network_id];
+    used += value;
+    auto& peak = _network_max_peak_memory_used[network_id];
+    peak = std::max(peak, used);
 }
 
-void memory_pool::subtract_memory_used(size_t value) { _temp_memory_used -= value; }
+void memory_pool::subtract_memory_used(size_t value, uint32_t network_id) {
+    _temp_memory_used -= value;
+
+    std::lock_guard<std::mutex> lock(_network_memory_mutex);
+    auto used = _network_memory_used.find(network_id);
+    if (used != _network_memory_used.end())
+        used->second -= std::min<uint64_t>(used->second, value);
+}
+
+uint64_t memory_pool::get_max_peak_device_memory_used(uint32_t network_id) const {
+    std::lock_guard<std::mutex> lock(_network_memory_mutex);
+    auto peak = _network_max_peak_memory_used.find(network_id);
+    return peak == _network_max_peak_memory_used.end() ? 0 : peak->second;
+}
 
 }  // namespace cldnn
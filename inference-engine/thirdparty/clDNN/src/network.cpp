@@ -22,6 +22,7 @@
 #include "api/data.hpp"
 #include "api/mutable_data.hpp"
 #include "api/input_layout.hpp"
+#include "generic_layer.hpp"
 
 #include "error_handler.h"
 #include "primitive_inst.h"
@@ -32,6 +33,7 @@
 #include <algorithm>
 
 #include "gpu/ocl_toolkit.h"
+#include "gpu/memory_gpu.h"
 #include <string>
 #include <vector>
 #include <memory>
@@ -73,6 +75,14 @@ void network::set_output_memory(const primitive_id& id, const memory& mem) const
     _impl->set_output_memory(id, *mem.get());
 }
 
+event network::copy_from_host(const memory& mem, const void* src) const {
+    return event(_impl->copy_from_host(*mem.get(), src).detach());
+}
+
+event network::copy_to_host(const memory& mem, void* dst, const event& dependency) const {
+    return event(_impl->copy_to_host(*mem.get(), dst, {event_impl::ptr(dependency.get())}).detach());
+}
+
 void network::set_learning_rate(const float lr) {
     _impl->set_learning_rate(lr);
 }
@@ -85,6 +95,10 @@ uint32_t network::get_id() {
     return _impl->get_id();
 }
 
+uint64_t network::get_max_used_device_memory_size() const {
+    return _impl->get_engine().get_max_used_device_memory(_impl->get_id());
+}
+
 std::string network::get_primitive_info(const primitive_id& id) const {
     return _impl->get_primitive_info(id);
 }
@@ -317,6 +331,7 @@ network_impl::~network_impl() {
     if (net_id) {
         auto toolkit = get_engine().get_context();
         toolkit->remove_network(net_id);
+        get_engine().get_memory_pool().release_arena(net_id);
     }
 }
 
@@ -427,13 +442,34 @@ std::shared_ptr<primitive_inst> cldnn::network_impl::find_in_internal_networks(c
     return nullptr;
 }
 
+namespace {
+const cl::Buffer& get_transfer_buffer(const network_impl& network, memory_impl& mem) {
+    auto buffer = dynamic_cast<gpu::gpu_buffer*>(&mem);
+    if (buffer == nullptr || !mem.is_allocated_by(network.get_engine()))
+        throw std::invalid_argument("host memory transfers are supported for the buffers of the network's engine only");
+    return buffer->get_buffer();
+}
+}  // namespace
+
+event_impl::ptr network_impl::copy_from_host(memory_impl& mem, const void* src) {
+    return get_engine().get_context()->enqueue_write_buffer(get_id(), get_transfer_buffer(*this, mem), src,
+                                                            mem.size(), {});
+}
+
+event_impl::ptr network_impl::copy_to_host(memory_impl& mem, void* dst, const std::vector<event_impl::ptr>& deps) {
+    return get_engine().get_context()->enqueue_read_buffer(get_id(), get_transfer_buffer(*this, mem), dst,
+                                                           mem.size(), deps);
+}
+
 void network_impl::set_learning_rate(const float lr) { _learning_rate = lr; }
 
 float network_impl::get_learning_rate() { return _learning_rate; }
 
+// The networks of the streams share the program, so its constant data is used by all of them.
+// The primary stream takes the program's mutable_data buffers over, the secondary ones get own copies.
 bool network_impl::is_primary_stream() {
     auto _nstreams = get_engine().configuration().n_streams;
-    return _nstreams == 1 || (_nstreams > 1 && _stream_id > 0);
+    return _nstreams == 1 || _stream_id == 0;
 }
 
 bool network_impl::is_secondary_stream() {
@@ -465,6 +501,19 @@ void network_impl::allocate_primitives() {
 
     allocate_mutable_data_for_streams(mutable_data_nodes);
 
+    // the outputs primitive_inst::allocate_output takes from the memory pool are planned upfront,
+    // so they can share an allocation regardless of their layouts
+    if (!_internal && get_engine().use_memory_arena()) {
+        std::vector<arena_request> requests;
+        for (auto const& node : nodes_to_allocate) {
+            if (node->can_share_buffer() && !node->can_be_optimized() && !node->is_output() &&
+                !node->is_type<data>() && !node->is_type<mutable_data>() && !node->is_type<input_layout>() &&
+                !node->is_type<generic_layer>())
+                requests.push_back({node->id(), node->get_output_layout(), node->get_memory_dependencies()});
+        }
+        get_engine().get_memory_pool().plan_arena(requests, get_id());
+    }
+
     for (auto const& node : nodes_to_allocate) {
         allocate_primitive_instance(*node);
     }
@@ -492,6 +541,11 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
     // Wait for previous execution completion
     reset_execution(false);
 
+    // The primitives executed out of order only wait for their dependencies, so the ones without dependencies
+    // in execution order could overwrite the buffers the previous execution still uses.
+    if (get_engine().get_context()->out_of_order_execution())
+        get_engine().get_context()->enqueue_barrier(get_id());
+
     // collect all shared media surfaces and enqueue acquire/relese
     auto check_and_add_to_return_vec = [](std::shared_ptr<primitive_inst> prim, std::vector<cl_mem>& return_vec) {
         const auto& mem = prim->output_memory().get_internal_params();
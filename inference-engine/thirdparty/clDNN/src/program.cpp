@@ -1089,6 +1089,11 @@ program_impl::primitives_info program_impl::get_current_stage_info() const {
             }
         }
 
+        std::vector<std::string> fused_ops;
+        for (auto& fused_prim : p->get_fused_primitives()) {
+            fused_ops.push_back(type_to_str(fused_prim.node->get_primitive()));
+        }
+
         primitive_info pi(p->id(),
                           type_to_str(p->get_primitive()),
                           dependencies,
@@ -1098,7 +1103,8 @@ program_impl::primitives_info program_impl::get_current_stage_info() const {
                           fmt_to_str(p->get_output_layout().format),
                           p->selected_impl ? p->selected_impl->get_kernel_name() : "",
                           p->selected_impl ? p->selected_impl->is_cpu() : false,
-                          exec_id++);
+                          exec_id++,
+                          fused_ops);
 
         info.push_back(pi);
     }
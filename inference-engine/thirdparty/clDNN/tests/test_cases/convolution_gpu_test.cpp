@@ -4287,6 +4287,73 @@ TEST(convolution_int8_fw_gpu, quantized_convolution_u8s8f32_symmetric) {
         }
 }
 
+static void test_quantized_grouped_convolution_b_fs_yx_fsv4(int groups, int ifm_per_group, int ofm_per_group) {
+    const auto& engine = get_test_engine();
+
+    const int batch = 2, input_xy = 5, filter_xy = 3, pad = 1, stride = 1;
+    const int input_f = groups * ifm_per_group, output_f = groups * ofm_per_group;
+    const int output_xy = (input_xy + 2 * pad - filter_xy) / stride + 1;
+
+    auto input = memory::allocate(engine, { data_types::u8, format::bfyx, { batch, input_f, input_xy, input_xy } });
+    auto weights = memory::allocate(engine, { data_types::i8, format::bfyx, { output_f, ifm_per_group, filter_xy, filter_xy } });
+    auto biases = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, output_f, 1, 1 } });
+
+    auto input_data = generate_random_1d<uint8_t>(batch * input_f * input_xy * input_xy, 0, 10);
+    auto weights_data = generate_random_1d<int8_t>(output_f * ifm_per_group * filter_xy * filter_xy, -5, 5);
+    auto biases_data = generate_random_1d<float>(output_f, -10, 10);
+    set_values(input, input_data);
+    set_values(weights, weights_data);
+    set_values(biases, biases_data);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("biases", biases),
+        convolution("conv", "input", { "weights" }, { "biases" }, groups,
+                    tensor{ 1, 1, stride, stride }, tensor{ 0, 0, -pad, -pad }, tensor{ 1, 1, 1, 1 }),
+        reorder("out", "conv", format::bfyx, data_types::f32));
+
+    build_options opts;
+    implementation_desc conv_impl = { format::b_fs_yx_fsv4, "convolution_gpu_imad_b_fs_yx_fsv4_dw" };
+    opts.set_option(build_option::force_implementations({ {"conv", conv_impl} }));
+    opts.set_option(build_option::optimize_data(true));
+    network network(engine, topology, opts);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+    auto output_memory = outputs.at("out").get_memory();
+    auto output_ptr = output_memory.pointer<float>();
+
+    for (int b = 0; b < batch; ++b)
+        for (int of = 0; of < output_f; ++of)
+            for (int y = 0; y < output_xy; ++y)
+                for (int x = 0; x < output_xy; ++x) {
+                    const int g = of / ofm_per_group;
+                    float expected = biases_data[of];
+                    for (int k = 0; k < ifm_per_group; ++k)
+                        for (int j = 0; j < filter_xy; ++j)
+                            for (int i = 0; i < filter_xy; ++i) {
+                                const int in_y = y * stride - pad + j;
+                                const int in_x = x * stride - pad + i;
+                                if (in_y < 0 || in_y >= input_xy || in_x < 0 || in_x >= input_xy)
+                                    continue;
+                                const int in_f = g * ifm_per_group + k;
+                                expected += input_data[((b * input_f + in_f) * input_xy + in_y) * input_xy + in_x] *
+                                            weights_data[((of * ifm_per_group + k) * filter_xy + j) * filter_xy + i];
+                            }
+                    EXPECT_NEAR(expected, output_ptr[((b * output_f + of) * output_xy + y) * output_xy + x], 1e-5f)
+                        << " b=" << b << " f=" << of << " y=" << y << " x=" << x;
+                }
+}
+
+TEST(convolution_int8_fw_gpu, quantized_depthwise_convolution_u8s8f32_b_fs_yx_fsv4) {
+    test_quantized_grouped_convolution_b_fs_yx_fsv4(6, 1, 1);
+}
+
+TEST(convolution_int8_fw_gpu, quantized_grouped_convolution_u8s8f32_b_fs_yx_fsv4) {
+    test_quantized_grouped_convolution_b_fs_yx_fsv4(2, 3, 5);
+}
+
 TEST(convolution_int8_fw_gpu, quantized_convolution_u8s8f32_asymmetric_weight_and_activations) {
     const auto& engine = get_test_engine();
 
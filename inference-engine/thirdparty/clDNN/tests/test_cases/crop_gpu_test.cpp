@@ -19,6 +19,8 @@
 #include "api/memory.hpp"
 #include <api/input_layout.hpp>
 #include "api/crop.hpp"
+#include "api/reorder.hpp"
+#include "api/pooling.hpp"
 #include <api/topology.hpp>
 #include <api/network.hpp>
 #include <api/engine.hpp>
@@ -744,6 +746,48 @@ TEST(crop_gpu, basic_in1x4x1x1_split_w_relu) {
         EXPECT_EQ(output_ptr_2[i], out2[i]);
 }
 
+TEST(crop_gpu, in_place_split_bfyx_f16_feature_block_aligned) {
+    // The crop of the blocked input starting at the feature block boundary
+    // is not executed, the pooling reads its features from the input buffer
+    const auto& engine = get_test_engine();
+
+    auto batch_num = 1;
+    auto feature_num = 32;
+    auto x_size = 2;
+    auto y_size = 2;
+    auto crop_feature_num = 16;
+    auto feature_offset = 16;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { tensor(spatial(x_size, y_size), feature(feature_num), batch(batch_num)) } });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(reorder("input_blocked", "input", format::bfyx_f16, data_types::f32));
+    topology.add(crop("crop", "input_blocked", tensor(batch(batch_num), spatial(x_size, y_size), feature(crop_feature_num)), { tensor(feature(feature_offset), spatial(0, 0), batch(0)) }));
+    topology.add(pooling("pool", "crop", pooling_mode::max, { 1, 1, 1, 1 }, { 1, 1, 1, 1 }));
+    topology.add(reorder("output", "pool", format::bfyx, data_types::f32));
+
+    std::vector<float> input_vec = generate_random_input<float>(batch_num, feature_num, y_size, x_size, -10, 10);
+    set_values(input, input_vec);
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+
+    network network(engine, topology, bo);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    EXPECT_EQ(network.get_executed_primitives().count("crop"), 0u);
+
+    auto output = outputs.at("output").get_memory();
+    auto output_ptr = output.pointer<float>();
+    const size_t spatial_size = static_cast<size_t>(x_size * y_size);
+    for (size_t f = 0; f < static_cast<size_t>(crop_feature_num); f++) {
+        for (size_t i = 0; i < spatial_size; i++) {
+            EXPECT_EQ(output_ptr[f * spatial_size + i], input_vec[(f + feature_offset) * spatial_size + i]);
+        }
+    }
+}
+
 TEST(crop_gpu, basic_in3x1x2x2x1_crop_all_bfzyx) {
     //  Reference  : 3x1x2x2x1
     //  Input      : 6x2x4x3x2
@@ -22,6 +22,7 @@
 #include <api/topology.hpp>
 #include <api/network.hpp>
 #include <api/engine.hpp>
+#include <api/reorder.hpp>
 #include "test_utils/test_utils.h"
 
 namespace cldnn
@@ -314,6 +315,59 @@ public:
         check_results(output_prim, 7, "-1 0 0 0 0 0 0");
     }
 
+    void forward_share_location_host_threads()
+    {
+        const bool share_location = true;
+        const int num_loc_classes = share_location ? 1 : this->num_classes;
+        const int keep_top_k = 4;
+        const int background_label_id = 0;
+
+        // The detection output runs on the host threads between the primitives run on the device
+        engine_configuration cfg{ false, false, false, std::string(), std::string(), true, std::string(), std::string(),
+                                  priority_mode_types::disabled, throttle_mode_types::disabled, true, 1, "cache.json",
+                                  0, 10, std::string(), 0, false, false, false, 2 };
+        engine engine{ cfg };
+        cldnn::memory input_location = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx,{ this->num_of_images, this->num_priors * num_loc_classes * 4, 1, 1 } });
+        cldnn::memory input_confidence = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx,{ this->num_of_images, this->num_priors * this->num_classes, 1, 1 } });
+        cldnn::memory input_prior_box = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx,{ 1, 2, 1, this->num_priors * 4 } });
+
+        this->init_buffers(input_prior_box, input_confidence, input_location, share_location);
+
+        topology topology;
+        topology.add(input_layout("input_location", input_location.get_layout()));
+        topology.add(input_layout("input_confidence", input_confidence.get_layout()));
+        topology.add(input_layout("input_prior_box", input_prior_box.get_layout()));
+        topology.add(reorder("location", "input_location", input_location.get_layout()));
+        topology.add(reorder("confidence", "input_confidence", input_confidence.get_layout()));
+
+        topology.add(detection_output("detection_output", "location", "confidence", "input_prior_box", this->num_classes, keep_top_k, share_location, background_label_id, this->nms_threshold));
+        topology.add(reorder("output", "detection_output", format::bfyx, type_to_data_type<T>::value));
+
+        network network(engine, topology);
+        network.set_input_data("input_location", input_location);
+        network.set_input_data("input_confidence", input_confidence);
+        network.set_input_data("input_prior_box", input_prior_box);
+
+        for (int iteration = 0; iteration < 2; iteration++)
+        {
+            auto outputs = network.execute();
+
+            EXPECT_EQ(outputs.size(), size_t(1));
+            EXPECT_EQ(outputs.begin()->first, "output");
+
+            auto output_prim = outputs.begin()->second.get_memory();
+
+            check_results(output_prim, 0, "0 1 1.0 0.15 0.15 0.45 0.45");
+            check_results(output_prim, 1, "0 1 0.8 0.55 0.15 0.85 0.45");
+            check_results(output_prim, 2, "0 1 0.6 0.15 0.55 0.45 0.85");
+            check_results(output_prim, 3, "0 1 0.4 0.55 0.55 0.85 0.85");
+            check_results(output_prim, 4, "1 1 0.6 0.45 0.45 0.75 0.75");
+            check_results(output_prim, 5, "1 1 0.0 0.25 0.25 0.55 0.55");
+            check_results(output_prim, 6, "-1 0 0 0 0 0 0");
+            check_results(output_prim, 7, "-1 0 0 0 0 0 0");
+        }
+    }
+
     void forward_num_detections_greater_than_keep_top_k(bool runOnGPU)
     {
         const bool share_location = true;
@@ -824,6 +878,92 @@ public:
         check_results(output_prim, 7, "-1 0 0 0 0 0 0");
     }
 
+    void forward_gpu_matches_cpu(bool decrease_label_id, bool clip_before_nms, bool clip_after_nms)
+    {
+        const bool share_location = false;
+        const int num_loc_classes = share_location ? 1 : this->num_classes;
+        const int keep_top_k = 6;
+        const int background_label_id = 0;
+        const int top_k = 3;
+
+        const auto& engine = get_test_engine();
+        cldnn::memory input_location = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx,{ this->num_of_images, this->num_priors * num_loc_classes * 4, 1, 1 } });
+        cldnn::memory input_confidence = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx,{ this->num_of_images, this->num_priors * this->num_classes, 1, 1 } });
+        cldnn::memory input_prior_box = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx,{ 1, 2, 1, this->num_priors * 4 } });
+
+        this->init_buffers(input_prior_box, input_confidence, input_location, share_location);
+
+        // The priors are widened beyond the image, so the clipping changes the boxes
+        {
+            auto prior_box_ptr = input_prior_box.pointer<T>();
+            T* prior_data = prior_box_ptr.data();
+            for (int i = 0; i < this->num_priors * 4; ++i)
+            {
+                prior_data[i] = (T)((float)prior_data[i] + (i % 4 < 2 ? -0.3f : 0.3f));
+            }
+        }
+
+        topology topology;
+        topology.add(input_layout("input_location", input_location.get_layout()));
+        topology.add(input_layout("input_confidence", input_confidence.get_layout()));
+        topology.add(input_layout("input_prior_box", input_prior_box.get_layout()));
+
+        topology.add(detection_output("detection_output", "input_location", "input_confidence", "input_prior_box",
+                                      this->num_classes, keep_top_k, share_location, background_label_id, this->nms_threshold, top_k,
+                                      1.f, prior_box_code_type::corner, false, -std::numeric_limits<float>::max(), 4, 0, true, -1, -1,
+                                      decrease_label_id, clip_before_nms, clip_after_nms));
+
+        auto execute = [&](bool runOnGPU)
+        {
+            build_options opts;
+            if (runOnGPU)
+            {
+                opts.set_option(build_option::detection_output_gpu(true));
+            }
+
+            network network(engine, topology, opts);
+            network.set_input_data("input_location", input_location);
+            network.set_input_data("input_confidence", input_confidence);
+            network.set_input_data("input_prior_box", input_prior_box);
+
+            auto outputs = network.execute();
+            EXPECT_EQ(outputs.size(), size_t(1));
+            EXPECT_EQ(outputs.begin()->first, "detection_output");
+
+            auto output_ptr = outputs.begin()->second.get_memory().pointer<T>();
+            return std::vector<T>(output_ptr.begin(), output_ptr.end());
+        };
+
+        const std::vector<T> reference = execute(false);
+        const std::vector<T> output = execute(true);
+
+        ASSERT_EQ(reference.size(), output.size());
+        for (size_t i = 0; i < reference.size(); ++i)
+        {
+            EXPECT_TRUE(floating_point_equal(reference[i], output[i])) << "row " << i / 7 << " item " << i % 7;
+        }
+
+        for (size_t row = 0; row < output.size() / 7; ++row)
+        {
+            const T* item = &output[row * 7];
+            if ((float)item[0] < 0)
+                continue;
+            const int label = static_cast<int>((float)item[1]);
+            if (decrease_label_id)
+            {
+                EXPECT_LT(label, this->num_classes - 1) << "row " << row;
+            }
+            if (clip_after_nms)
+            {
+                for (int i = 3; i < 7; ++i)
+                {
+                    EXPECT_GE((float)item[i], 0.f) << "row " << row;
+                    EXPECT_LE((float)item[i], 1.f) << "row " << row;
+                }
+            }
+        }
+    }
+
     static const int num_of_images = 2;
     static const int num_classes = 2;
     static const int num_priors = 4;
@@ -864,6 +1004,11 @@ TYPED_TEST(detection_output_test, test_forward_share_location_gpu)
     this->forward_share_location(true);
 }
 
+TYPED_TEST(detection_output_test, test_forward_share_location_host_threads)
+{
+    this->forward_share_location_host_threads();
+}
+
 TYPED_TEST(detection_output_test, test_forward_num_detections_greater_than_keep_top_k)
 {
     this->forward_num_detections_greater_than_keep_top_k(false);
@@ -954,6 +1099,26 @@ TYPED_TEST(detection_output_test, test_forward_no_share_location_top_k_faster_rc
     this->test_forward_no_share_location_top_k_faster_rcnn_case(true);
 }
 
+TYPED_TEST(detection_output_test, test_forward_clip_before_nms_gpu)
+{
+    this->forward_gpu_matches_cpu(false, true, false);
+}
+
+TYPED_TEST(detection_output_test, test_forward_clip_after_nms_gpu)
+{
+    this->forward_gpu_matches_cpu(false, false, true);
+}
+
+TYPED_TEST(detection_output_test, test_forward_decrease_label_id_gpu)
+{
+    this->forward_gpu_matches_cpu(true, false, false);
+}
+
+TYPED_TEST(detection_output_test, test_forward_decrease_label_id_clip_gpu)
+{
+    this->forward_gpu_matches_cpu(true, true, true);
+}
+
 TYPED_TEST(detection_output_test, test_detection_output_sort_gpu)
 {
     const bool share_location = false;
@@ -1623,6 +1623,37 @@ INSTANTIATE_TEST_CASE_P(fusings_gpu, fc_int8_scale_activation_quantize_i8,
         bc_test_params{CASE_FC_U8S8_3, 2, 5},
         }), );
 
+class fc_int8_scale_eltwise_activation_quantize_i8 : public WeightsPrimitiveFusingTest {};
+TEST_P(fc_int8_scale_eltwise_activation_quantize_i8, basic) {
+    auto p = GetParam();
+    topology.add(input_layout("input", get_input_layout(p)),
+        data("weights", get_mem(get_weights_layout(p))),
+        data("bias", get_mem(get_bias_layout(p))),
+        data("in_lo", get_mem(get_per_channel_layout(p), min_random, 0)),
+        data("in_hi", get_mem(get_per_channel_layout(p), 1, max_random)),
+        data("out_lo", get_mem(get_single_element_layout(p), -127)),
+        data("out_hi", get_mem(get_single_element_layout(p), 127)),
+        data("scale_data", get_mem(get_per_channel_layout(p), 1.0f / p.kernel.count() / 255)),
+        data("eltwise_data", get_mem(get_output_layout(p))),
+        fully_connected("fc_prim", "input", "weights", "bias", data_types::f32),
+        scale("scale", "fc_prim", "scale_data"),
+        eltwise("sum", { "scale", "eltwise_data" }, eltwise_mode::sum),
+        activation("activation", "sum", activation_func::relu),
+        quantize("quantize", "activation", "in_lo", "in_hi", "out_lo", "out_hi", 255, data_types::i8),
+        reorder("reorder_bfyx", "quantize", p.default_format, data_types::f32)
+    );
+
+    tolerance = 1e-5f;
+    execute(p);
+}
+
+INSTANTIATE_TEST_CASE_P(fusings_gpu, fc_int8_scale_eltwise_activation_quantize_i8,
+    ::testing::ValuesIn(std::vector<bc_test_params>{
+        bc_test_params{CASE_FC_U8S8_1, 2, 6},
+        bc_test_params{CASE_FC_U8S8_2, 2, 6},
+        bc_test_params{CASE_FC_U8S8_3, 2, 6},
+        }), );
+
 class gemm_int8_3in_quantize_i8 : public GemmFusingTest {};
 TEST_P(gemm_int8_3in_quantize_i8, basic) {
     auto p = GetParam();
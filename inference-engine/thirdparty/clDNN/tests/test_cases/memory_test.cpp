@@ -562,3 +562,69 @@ TEST(memory_pool, add_mem_dep_test) {
     EXPECT_EQ(out2_ptr[2], 7.0f);
     EXPECT_EQ(out2_ptr[3], 8.0f);
 }
+
+TEST(memory_pool, arena_relu_and_pooling_pipe) {
+    auto run = [](bool memory_arena, uint64_t& max_used_memory) {
+        engine_configuration cfg{ false, false, false, std::string(), std::string(), true, std::string(), std::string(),
+                                  priority_mode_types::disabled, throttle_mode_types::disabled, true, 1, "cache.json",
+                                  0, 10, std::string(), 0, false, memory_arena };
+        engine engine{ cfg };
+
+        auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 4, 4, 4 } });
+        std::vector<float> input_vec(input.get_layout().count());
+        for (size_t i = 0; i < input_vec.size(); i++)
+            input_vec[i] = (i % 3 == 0) ? -static_cast<float>(i) : static_cast<float>(i);
+        set_values(input, input_vec);
+
+        topology topology;
+        topology.add(input_layout("input", input.get_layout()));
+        topology.add(activation("relu", "input", activation_func::relu));
+        topology.add(activation("relu1", "relu", activation_func::relu));
+        topology.add(pooling("pool1", "relu1", pooling_mode::max, { 1, 1, 3, 3 }, { 1, 1, 2, 2 }));
+        topology.add(activation("relu2", "pool1", activation_func::relu));
+        topology.add(activation("relu3", "relu2", activation_func::relu));
+        topology.add(activation("relu4", "relu3", activation_func::relu));
+
+        build_options bo;
+        bo.set_option(build_option::optimize_data(true));
+
+        network network(engine, topology, bo);
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+        max_used_memory = network.get_max_used_device_memory_size();
+
+        auto output_ptr = outputs.at("relu4").get_memory().pointer<float>();
+        return std::vector<float>(output_ptr.begin(), output_ptr.end());
+    };
+
+    uint64_t pool_memory = 0, arena_memory = 0;
+    auto pool_output = run(false, pool_memory);
+    auto arena_output = run(true, arena_memory);
+
+    EXPECT_EQ(pool_output, arena_output);
+    EXPECT_GT(arena_memory, (uint64_t)0);
+    EXPECT_LE(arena_memory, pool_memory);
+}
+
+TEST(memory_pool, copy_from_and_to_host) {
+    const cldnn::engine engine;
+    auto layout = cldnn::layout(data_types::f32, format::bfyx, { 1, 4, 1, 1 });
+    auto input = memory::allocate(engine, layout);
+
+    topology topology;
+    topology.add(input_layout("input", layout));
+    topology.add(activation("relu", "input", activation_func::relu));
+
+    network network(engine, topology);
+    std::vector<float> input_vec = { -1.f, 2.f, -3.f, 4.f };
+    auto upload = network.copy_from_host(input, input_vec.data());
+    network.set_input_data("input", input);
+    auto outputs = network.execute({ upload });
+
+    std::vector<float> output_vec(input_vec.size());
+    auto output_memory = network.get_output_memory("relu");
+    auto download = network.copy_to_host(output_memory, output_vec.data(), outputs.at("relu").get_event());
+    download.wait();
+
+    EXPECT_EQ(output_vec, std::vector<float>({ 0.f, 2.f, 0.f, 4.f }));
+}
@@ -903,6 +903,8 @@ struct memory: public primitive  {
         gOhIw16o4i = mkldnn_gOhIw16o4i,
         gOhIw8o4i = mkldnn_gOhIw8o4i,
         gOhIw8o4i_s8s8 = mkldnn_gOhIw8o4i_s8s8,
+        gOhIw8o32i = mkldnn_gOhIw8o32i,
+        gOhIw16o32i = mkldnn_gOhIw16o32i,
         goidhw = mkldnn_goidhw,
         gOIdhw16i16o = mkldnn_gOIdhw16i16o,
         gOIdhw16o16i = mkldnn_gOIdhw16o16i,
@@ -453,6 +453,8 @@ typedef enum {
      * multiplied by number of groups and containing the values:
      * O[i:0,G*OC] = -128 * SUM(j:0,IC;h:0,H;w:0,W)(weights(i,j,h,w))*/
     mkldnn_gOhIw8o4i_s8s8,
+    mkldnn_gOhIw8o32i /** blocked weights format */,
+    mkldnn_gOhIw16o32i /** blocked weights format */,
 
     /* weights w/ groups, 6D */
     /** weights format with additional buffer
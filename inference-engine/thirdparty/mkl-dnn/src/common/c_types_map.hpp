@@ -286,6 +286,8 @@ namespace memory_format {
     const memory_format_t gOdhwi16o = mkldnn_gOdhwi16o;
     const memory_format_t gOhIw8o4i = mkldnn_gOhIw8o4i;
     const memory_format_t gOhIw8o4i_s8s8 = mkldnn_gOhIw8o4i_s8s8;
+    const memory_format_t gOhIw8o32i = mkldnn_gOhIw8o32i;
+    const memory_format_t gOhIw16o32i = mkldnn_gOhIw16o32i;
     const memory_format_t OdhIw8o4i = mkldnn_OdhIw8o4i;
     const memory_format_t OdhIw8o4i_s8s8 = mkldnn_OdhIw8o4i_s8s8;
     const memory_format_t gOdhIw8o4i = mkldnn_gOdhIw8o4i;
@@ -224,6 +224,8 @@ DECL_TRAITS(gOIhw4i4o, gwei, _4i4o, 5, 2);
 DECL_TRAITS(gOIhw8i8o, gwei, _8i8o, 5, 2);
 DECL_TRAITS(gOhIw8o4i, gwei, _8o4i, 5, 2);
 DECL_TRAITS(gOhIw8o4i_s8s8, gwei, _8o4i_s8s8, 5, 2);
+DECL_TRAITS(gOhIw8o32i, gwei, _8o32i, 5, 2);
+DECL_TRAITS(gOhIw16o32i, gwei, _16o32i, 5, 2);
 DECL_TRAITS(gOIhw16i16o, gwei, _16i16o, 5, 2);
 DECL_TRAITS(gOIhw4i16o4i, gwei, _4i16o4i, 5, 2);
 DECL_TRAITS(gOIhw4i16o4i_s8s8, gwei, _4i16o4i_s8s8, 5, 2);
@@ -1210,6 +1210,26 @@ status_t fill_gOhIw8o4i(memory_desc_t &md) {
     return fill_contiguous_blocked(md, block_dims, perm);
 }
 
+status_t fill_gOhIw8o32i(memory_desc_t &md) {
+    if (md.ndims != 5) return invalid_arguments;
+
+    const dims_t block_dims = {1, 8, 32, 1, 1};
+    const int perm[] = {
+        0, 1, 3, 2, 4,
+        5, 6, 7, 8, 9};
+    return fill_contiguous_blocked(md, block_dims, perm);
+}
+
+status_t fill_gOhIw16o32i(memory_desc_t &md) {
+    if (md.ndims != 5) return invalid_arguments;
+
+    const dims_t block_dims = {1, 16, 32, 1, 1};
+    const int perm[] = {
+        0, 1, 3, 2, 4,
+        5, 6, 7, 8, 9};
+    return fill_contiguous_blocked(md, block_dims, perm);
+}
+
 status_t fill_Goihw8g(memory_desc_t &md) {
     if (md.ndims != 5) return invalid_arguments;
 
@@ -1532,6 +1552,8 @@ status_t memory_desc_wrapper::compute_blocking(memory_desc_t &memory_desc)
     case gOIhw4i16o4i: return fill_gOIhw4i16o4i(memory_desc);
     case gOhIw8o4i: return fill_gOhIw8o4i(memory_desc);
     case gOhIw8o4i_s8s8: return fill_gOhIw8o4i(memory_desc);
+    case gOhIw8o32i: return fill_gOhIw8o32i(memory_desc);
+    case gOhIw16o32i: return fill_gOhIw16o32i(memory_desc);
     case gOIhw4i16o4i_s8s8: return fill_gOIhw4i16o4i(memory_desc);
     case gOIdhw4i16o4i: return fill_gOIdhw4i16o4i(memory_desc);
     case gOIdhw4i16o4i_s8s8: return fill_gOIdhw4i16o4i(memory_desc);
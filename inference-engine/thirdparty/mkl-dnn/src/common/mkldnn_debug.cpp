@@ -212,6 +212,8 @@ const char *mkldnn_fmt2str(mkldnn_memory_format_t v) {
     if (v == mkldnn_gOdhwi4o) return "gOdhwi4o";
     if (v == mkldnn_gOhIw8o4i) return "gOhIw8o4i";
     if (v == mkldnn_gOhIw8o4i_s8s8) return "gOhIw8o4i_s8s8";
+    if (v == mkldnn_gOhIw8o32i) return "gOhIw8o32i";
+    if (v == mkldnn_gOhIw16o32i) return "gOhIw16o32i";
     if (v == mkldnn_gOIdhw8i8o) return "gOIdhw8i8o";
     if (v == mkldnn_gOIdhw8o8i) return "gOIdhw8o8i";
     if (v == mkldnn_gOdhwi8o) return "gOdhwi8o";
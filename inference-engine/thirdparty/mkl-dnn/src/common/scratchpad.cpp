@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <mutex>
+#include <thread>
+
 #include "mkldnn_thread.hpp"
 #include "utils.hpp"
 
@@ -55,30 +58,53 @@ private:
 */
 
 struct global_scratchpad_t : public scratchpad_t {
-    global_scratchpad_t(size_t size) {
-        if (size > size_) {
-            if (scratchpad_ != nullptr) free(scratchpad_);
-            size_ = size;
-            scratchpad_ = (char *) malloc(size, page_size);
-            assert(scratchpad_ != nullptr);
-        }
+    global_scratchpad_t(size_t size)
+        : requested_size_(size), owner_(std::this_thread::get_id()) {
+        grow(size);
         reference_count_++;
     }
 
     ~global_scratchpad_t() {
+        // the scratchpad is destroyed by the thread which created it, so the
+        // counter of that thread is decremented
         reference_count_--;
         if (reference_count_ == 0) {
             free(scratchpad_);
             scratchpad_ = nullptr;
             size_ = 0;
         }
+        free(private_scratchpad_);
     }
 
     virtual char *get() const {
-        return scratchpad_;
+        if (std::this_thread::get_id() == owner_)
+            return scratchpad_;
+
+        // The primitive is executed by a thread other than the one which
+        // created it (e.g. independent branches of a graph executed
+        // concurrently). The global scratchpad of that thread is neither
+        // counted nor owned here, so a private buffer is used instead
+        std::call_once(private_once_, [this]() {
+            private_scratchpad_ = (char *) malloc(requested_size_, page_size);
+            assert(private_scratchpad_ != nullptr);
+        });
+        return private_scratchpad_;
     }
 
 private:
+    static void grow(size_t size) {
+        if (size > size_) {
+            if (scratchpad_ != nullptr) free(scratchpad_);
+            size_ = size;
+            scratchpad_ = (char *) malloc(size, page_size);
+            assert(scratchpad_ != nullptr);
+        }
+    }
+
+    size_t requested_size_;
+    std::thread::id owner_;
+    mutable std::once_flag private_once_;
+    mutable char *private_scratchpad_ = nullptr;
     thread_local static char *scratchpad_;
     thread_local static size_t size_;
     thread_local static unsigned int reference_count_;
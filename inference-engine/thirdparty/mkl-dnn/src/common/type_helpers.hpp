@@ -221,6 +221,8 @@ inline memory_format_t format_normalize(const memory_format_t fmt) {
             gOIhw8o8i,
             gOhIw8o4i,
             gOhIw8o4i_s8s8,
+            gOhIw8o32i,
+            gOhIw16o32i,
             gOIhw16o16i,
             gIOhw16o16i,
             gOihw4o,
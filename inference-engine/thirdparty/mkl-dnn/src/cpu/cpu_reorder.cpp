@@ -269,6 +269,8 @@ static const rpd_create_f cpu_reorder_impl_list[] = {
 
     REG_SR(bin, any, bin, OhIw8o32i, fmt_order::keep),
     REG_SR(bin, any, bin, OhIw16o32i, fmt_order::keep),
+    REG_SR(bin, any, bin, gOhIw8o32i, fmt_order::keep),
+    REG_SR(bin, any, bin, gOhIw16o32i, fmt_order::keep),
 
     REG_SR(f32, any, s8, hwio_s8s8, fmt_order::keep),
     REG_SR(f32, any, s8, hwigo_s8s8, fmt_order::keep),
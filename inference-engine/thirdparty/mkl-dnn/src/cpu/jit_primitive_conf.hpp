@@ -346,6 +346,7 @@ struct jit_def_conv_conf_t {
     int stride_d, stride_h, stride_w;
     int dilate_d, dilate_h, dilate_w;
     memory_format_t src_fmt;
+    memory_format_t dst_fmt;
     bool with_bias;
     bool with_sum;
     int nthr;
@@ -154,7 +154,7 @@ void jit_uni_bin_conv_fwd_kernel<isa>::apply_filter(int ur_w, int pad_l, int pad
 
         for (int ifm2 = 0; ifm2 < ic_blocks; ifm2++) {
             for (int jj = _start; jj < _end; jj++) {
-                int inp_off = ((ki*dilate_w + jj*stride_w - pad_l)*div_up(jcp.ic, nbits) + ifm2 * div_up(ic_blk, nbits)) * jcp.typesize_in;
+                int inp_off = ((ki*dilate_w + jj*stride_w - pad_l)*div_up(jcp.ic * jcp.ngroups, nbits) + ifm2 * div_up(ic_blk, nbits)) * jcp.typesize_in;
 
                 if (h_padded || jj < jj_start || jj >= jj_end) {
                     uni_vmovups(vmm_src, ptr[reg_table + 8 * vlen]);
@@ -257,7 +257,7 @@ void jit_uni_bin_conv_fwd_kernel<isa>::kh_loop(int ur_w, int pad_l, int pad_r, i
     int dilate_h = jcp.dilate_h + 1;
 
     int nbits = 8;
-    const int inp_mult = dilate_h * div_up(jcp.ic, nbits);
+    const int inp_mult = dilate_h * div_up(jcp.ic * jcp.ngroups, nbits);
 
     Label t_overflow_label, no_t_overflow_label,
           b_overflow_label, no_b_overflow_label;
@@ -512,10 +512,10 @@ void jit_uni_bin_conv_fwd_kernel<isa>::width_blk_step(int ur_w, int pad_l, int p
 
                     if (r == repeats - 1) {
                         if (isa == avx512_common && oc_step > nbits) {
-                            const size_t o_off = (2 * ii + jj * div_up(jcp.oc, nbits));
+                            const size_t o_off = (2 * ii + jj * div_up(jcp.oc * jcp.ngroups, nbits));
                             mov(ptr[reg_output + o_off * jcp.typesize_out], reg_tmp_16);
                         } else {
-                            const size_t o_off = (ii + jj * div_up(jcp.oc, nbits));
+                            const size_t o_off = (ii + jj * div_up(jcp.oc * jcp.ngroups, nbits));
                             mov(ptr[reg_output + o_off * jcp.typesize_out], reg_tmp_8);
                         }
                     }
@@ -591,8 +591,9 @@ inline void jit_uni_bin_conv_fwd_kernel<isa>::solve_common(int oc_blocks, int oc
     int str_w = jcp.stride_w;
 
     int nbits = 8;
-    const int inp_mult = div_up(jcp.ic, nbits);
-    const int out_mult = jcp.with_dw_conv ? jcp.oc_block : jcp.with_binarization ? div_up(jcp.oc, nbits) : jcp.oc;
+    const int inp_mult = div_up(jcp.ic * jcp.ngroups, nbits);
+    const int out_mult = jcp.with_dw_conv ? jcp.oc_block :
+                         jcp.with_binarization ? div_up(jcp.oc * jcp.ngroups, nbits) : jcp.oc * jcp.ngroups;
 
     int l_pad = jcp.l_pad;
     int r_pad = nstl::max(0, (jcp.ow - 1) * str_w + (kw - 1) * dilate_w
@@ -838,9 +839,6 @@ status_t jit_uni_bin_conv_fwd_kernel<isa>::init_conf(jit_bin_conv_conf_t &jcp,
 
     jcp.ngroups = with_groups ? weights_d.dims()[0] : 1;
 
-    if (jcp.ngroups != 1)
-        return status::unimplemented;
-
     jcp.mb = src_d.dims()[0];
 
     int simd_w = isa == avx512_common ? 16 : 8;
@@ -894,10 +892,13 @@ status_t jit_uni_bin_conv_fwd_kernel<isa>::init_conf(jit_bin_conv_conf_t &jcp,
     jcp.with_sum = p.find(primitive_kind::sum, 0, dw_conv_ind) != -1;
     jcp.with_binarization = p.find(primitive_kind::binarization, 0, dw_conv_ind) != -1;
 
-    if (with_groups)
+    // the channels of a group start at the byte boundary of the packed activations and at the block of the
+    // per-channel post-ops arguments only if the groups consist of the whole blocks
+    if (with_groups && (jcp.with_dw_conv || jcp.ic % 32 != 0 || jcp.oc % simd_w != 0))
         return status::unimplemented;
 
-    auto desired_weights_format = isa == avx512_common ? OhIw16o32i : OhIw8o32i;
+    auto desired_weights_format = with_groups ? (isa == avx512_common ? gOhIw16o32i : gOhIw8o32i)
+                                              : (isa == avx512_common ? OhIw16o32i : OhIw8o32i);
     bool args_ok = true
         && src_d.format() == nhwc
         && weights_d.format() == desired_weights_format
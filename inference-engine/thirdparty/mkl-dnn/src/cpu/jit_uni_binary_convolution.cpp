@@ -81,7 +81,7 @@ void jit_uni_binary_convolution_fwd_t<isa>::execute_forward() const {
             }
 
             const int wh = jcp.exclude_pad ? i_t_overflow : 0;
-            int widx = weights_d.blk_off(ocb, 0, wh, 0);
+            int widx = pd()->with_groups() ? weights_d.blk_off(g, ocb, 0, wh, 0) : weights_d.blk_off(ocb, 0, wh, 0);
             par_conv.filt = &weights[widx / nbits];
 
             par_conv.oc_work = nstl::min((ocb + ocb_num) * jcp.oc_block, jcp.oc) - ocb*jcp.oc_block;
@@ -81,7 +81,8 @@ struct jit_uni_binary_convolution_fwd_t: public cpu_primitive_t {
         virtual status_t set_default_params() override {
             using namespace memory_format;
 
-            auto desired_weights_format = isa == avx512_common ? OhIw16o32i : OhIw8o32i;
+            auto desired_weights_format = this->with_groups() ? (isa == avx512_common ? gOhIw16o32i : gOhIw8o32i)
+                                                              : (isa == avx512_common ? OhIw16o32i : OhIw8o32i);
 
             if (this->src_pd_.desc()->format == any)
                 CHECK(this->src_pd_.set_format(nhwc));
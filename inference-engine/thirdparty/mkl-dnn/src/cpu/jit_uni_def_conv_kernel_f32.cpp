@@ -151,6 +151,7 @@ void jit_uni_def_conv_fwd_kernel_f32<isa>::interpolate_input(int ow_step) {
                     Label ic_loop_main;
                     Label ic_loop_tail;
                     Label ic_loop_zeros;
+                    Label ic_loop_zeros_tail;
                     Label loop_end;
                     Label h_sec_opt;
                     Label h_sec_opt_exit;
@@ -158,7 +159,7 @@ void jit_uni_def_conv_fwd_kernel_f32<isa>::interpolate_input(int ow_step) {
                     Label w_sec_opt_exit;
 
                     mov(aux2_reg_input, aux_reg_input);
-                    add(aux2_reg_input, (ow * jcp.stride_w * jcp.ic) * jcp.typesize_in);
+                    add(aux2_reg_input, (ow * jcp.stride_w * src_pixel_stride()) * jcp.typesize_in);
 
                     mov(aux3_reg_input_buffer, aux2_reg_input_buffer);
                     add(aux3_reg_input_buffer, (ow * jcp.kh * jcp.kw * jcp.ic) * jcp.typesize_in);
@@ -366,28 +367,28 @@ void jit_uni_def_conv_fwd_kernel_f32<isa>::interpolate_input(int ow_step) {
 
                         pmovsxdq(xmm_v1_off, xmm_v1_off);
                         movq(reg_tmp_64, xmm_v1_off);
-                        imul(reg_tmp_64, reg_tmp_64, jcp.ic * jcp.typesize_in);
+                        imul(reg_tmp_64, reg_tmp_64, src_pixel_stride() * jcp.typesize_in);
                         add(reg_tmp_64, aux2_reg_input);
                         uni_vmovups(vmm_v1, ptr[reg_tmp_64]);
                         uni_vmulps(vmm_v1, vmm_v1, vmm_w1);
 
                         pmovsxdq(xmm_v2_off, xmm_v2_off);
                         movq(reg_tmp_64, xmm_v2_off);
-                        imul(reg_tmp_64, reg_tmp_64, jcp.ic * jcp.typesize_in);
+                        imul(reg_tmp_64, reg_tmp_64, src_pixel_stride() * jcp.typesize_in);
                         add(reg_tmp_64, aux2_reg_input);
                         uni_vmovups(vmm_v2, ptr[reg_tmp_64]);
                         uni_vmulps(vmm_v2, vmm_v2, vmm_w2);
 
                         pmovsxdq(xmm_v3_off, xmm_v3_off);
                         movq(reg_tmp_64, xmm_v3_off);
-                        imul(reg_tmp_64, reg_tmp_64, jcp.ic * jcp.typesize_in);
+                        imul(reg_tmp_64, reg_tmp_64, src_pixel_stride() * jcp.typesize_in);
                         add(reg_tmp_64, aux2_reg_input);
                         uni_vmovups(vmm_v3, ptr[reg_tmp_64]);
                         uni_vmulps(vmm_v3, vmm_v3, vmm_w3);
 
                         pmovsxdq(xmm_v4_off, xmm_v4_off);
                         movq(reg_tmp_64, xmm_v4_off);
-                        imul(reg_tmp_64, reg_tmp_64, jcp.ic * jcp.typesize_in);
+                        imul(reg_tmp_64, reg_tmp_64, src_pixel_stride() * jcp.typesize_in);
                         add(reg_tmp_64, aux2_reg_input);
                         uni_vmovups(vmm_v4, ptr[reg_tmp_64]);
                         uni_vmulps(vmm_v4, vmm_v4, vmm_w4);
@@ -397,7 +398,7 @@ void jit_uni_def_conv_fwd_kernel_f32<isa>::interpolate_input(int ow_step) {
                         uni_vaddps(vmm_v1, vmm_v1, vmm_v4);
                         uni_vmovups(ptr[aux3_reg_input_buffer + input_buffer_off * jcp.typesize_in], vmm_v1);
 
-                        add(aux2_reg_input, simd_w * jcp.typesize_in);
+                        add(aux2_reg_input, src_channels_step(simd_w) * jcp.typesize_in);
                         add(aux3_reg_input_buffer, simd_w * jcp.typesize_in);
                         sub(reg_ic_iter, simd_w);
                         jmp(ic_loop_main, T_NEAR);
@@ -412,28 +413,28 @@ void jit_uni_def_conv_fwd_kernel_f32<isa>::interpolate_input(int ow_step) {
 
                         pmovsxdq(xmm_v1_off, xmm_v1_off);
                         movq(reg_tmp_64, xmm_v1_off);
-                        imul(reg_tmp_64, reg_tmp_64, jcp.ic * jcp.typesize_in);
+                        imul(reg_tmp_64, reg_tmp_64, src_pixel_stride() * jcp.typesize_in);
                         add(reg_tmp_64, aux2_reg_input);
                         movss(xmm_v1, ptr[reg_tmp_64]);
                         mulss(xmm_v1, xmm_w1);
 
                         pmovsxdq(xmm_v2_off, xmm_v2_off);
                         movq(reg_tmp_64, xmm_v2_off);
-                        imul(reg_tmp_64, reg_tmp_64, jcp.ic * jcp.typesize_in);
+                        imul(reg_tmp_64, reg_tmp_64, src_pixel_stride() * jcp.typesize_in);
                         add(reg_tmp_64, aux2_reg_input);
                         movss(xmm_v2, ptr[reg_tmp_64]);
                         mulss(xmm_v2, xmm_w2);
 
                         pmovsxdq(xmm_v3_off, xmm_v3_off);
                         movq(reg_tmp_64, xmm_v3_off);
-                        imul(reg_tmp_64, reg_tmp_64, jcp.ic * jcp.typesize_in);
+                        imul(reg_tmp_64, reg_tmp_64, src_pixel_stride() * jcp.typesize_in);
                         add(reg_tmp_64, aux2_reg_input);
                         movss(xmm_v3, ptr[reg_tmp_64]);
                         mulss(xmm_v3, xmm_w3);
 
                         pmovsxdq(xmm_v4_off, xmm_v4_off);
                         movq(reg_tmp_64, xmm_v4_off);
-                        imul(reg_tmp_64, reg_tmp_64, jcp.ic * jcp.typesize_in);
+                        imul(reg_tmp_64, reg_tmp_64, src_pixel_stride() * jcp.typesize_in);
                         add(reg_tmp_64, aux2_reg_input);
                         movss(xmm_v4, ptr[reg_tmp_64]);
                         mulss(xmm_v4, xmm_w4);
@@ -453,19 +454,33 @@ void jit_uni_def_conv_fwd_kernel_f32<isa>::interpolate_input(int ow_step) {
 
                     L(init_with_zeros);
 
-                    mov(reg_ic_iter, 0);
+                    Vmm vmm_zero = Vmm(xmm_tmp.getIdx());
+                    uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+                    mov(reg_ic_iter, ic_per_def_group);
                     L(ic_loop_zeros);
                     {
-                        cmp(reg_ic_iter, ic_per_def_group);
-                        je(loop_end, T_NEAR);
+                        cmp(reg_ic_iter, simd_w);
+                        jl(ic_loop_zeros_tail, T_NEAR);
+
+                        size_t input_buffer_off = (size_t) kh * jcp.kw * jcp.ic + kw * jcp.ic;
+
+                        uni_vmovups(ptr[aux3_reg_input_buffer + input_buffer_off * jcp.typesize_in], vmm_zero);
+                        add(aux3_reg_input_buffer, simd_w * jcp.typesize_in);
+                        sub(reg_ic_iter, simd_w);
+                        jmp(ic_loop_zeros, T_NEAR);
+                    }
+
+                    L(ic_loop_zeros_tail);
+                    {
+                        cmp(reg_ic_iter, 1);
+                        jl(loop_end, T_NEAR);
 
                         size_t input_buffer_off = (size_t) kh * jcp.kw * jcp.ic + kw * jcp.ic;
 
-                        pxor(xmm_tmp, xmm_tmp);
                         movss(ptr[aux3_reg_input_buffer + input_buffer_off * jcp.typesize_in], xmm_tmp);
                         add(aux3_reg_input_buffer, jcp.typesize_in);
-                        inc(reg_ic_iter);
-                        jmp(ic_loop_zeros, T_NEAR);
+                        sub(reg_ic_iter, 1);
+                        jmp(ic_loop_zeros_tail, T_NEAR);
                     }
 
                     L(loop_end);
@@ -474,7 +489,7 @@ void jit_uni_def_conv_fwd_kernel_f32<isa>::interpolate_input(int ow_step) {
         }
 
         add(aux_reg_def_off, 2 * jcp.kh * jcp.kw * jcp.oh * jcp.ow * jcp.typesize_off);
-        add(aux_reg_input, ic_per_def_group * jcp.typesize_in);
+        add(aux_reg_input, src_channels_step(ic_per_def_group) * jcp.typesize_in);
         add(aux2_reg_input_buffer, ic_per_def_group * jcp.typesize_in);
         inc(reg_dg_iter);
         jmp(dg_loop, T_NEAR);
@@ -510,19 +525,21 @@ void jit_uni_def_conv_fwd_kernel_f32<isa>::store_output(int ow_step, int oc_bloc
 
     for (int r = 0; r < repeats; r++) {
         int tail_size = isa == sse42 ? nstl::min(jcp.oc_block / 2, oc_step - r * jcp.oc_block / 2) : oc_step;
-        bool is_scalar_store = isa == sse42 ? tail_size < jcp.oc_block / 2 : tail_size < jcp.oc_block;
+        // the blocked output is padded to the whole blocks, the padded channels get the zero weights and biases
+        bool is_scalar_store = is_dst_blocked() ? false :
+                               isa == sse42 ? tail_size < jcp.oc_block / 2 : tail_size < jcp.oc_block;
         if (is_scalar_store) {
             for (int ow = 0; ow < ow_step; ow++) {
                 Vmm vmm_dst = get_vmm_acc(r * jcp.ur_w * jcp.nb_oc_blocking + ow);
                 Xmm xmm_dst = get_xmm_acc(r * jcp.ur_w * jcp.nb_oc_blocking + ow);
 
                 if (isa == avx512_common) {
-                    size_t out_off = (size_t) ow * jcp.oc;
+                    size_t out_off = (size_t) ow * dst_pixel_stride();
 
                     uni_vmovups(ptr[aux_reg_output + out_off * jcp.typesize_out], vmm_dst | ktail_mask);
                 } else {
                     for (int oc = 0; oc < tail_size; oc++) {
-                        size_t out_off = (size_t) ow * jcp.oc + oc + r * (jcp.oc_block / 2);
+                        size_t out_off = (size_t) ow * dst_pixel_stride() + oc + r * (jcp.oc_block / 2);
 
                         movq(reg_tmp_64, xmm_dst);
                         mov(ptr[aux_reg_output + out_off * jcp.typesize_out], reg_tmp_32);
@@ -544,7 +561,7 @@ void jit_uni_def_conv_fwd_kernel_f32<isa>::store_output(int ow_step, int oc_bloc
             for (int ocb = 0; ocb < oc_blocks_step; ocb++) {
                 for (int ow = 0; ow < ow_step; ow++) {
                     Vmm vmm_acc = get_vmm_acc(r * jcp.ur_w * jcp.nb_oc_blocking + ocb * ow_step + ow);
-                    size_t out_off = (size_t) ow * jcp.oc + ocb * jcp.oc_block + r * (jcp.oc_block / 2);
+                    size_t out_off = (size_t) ow * dst_pixel_stride() + ocb * dst_oc_block_stride() + r * (jcp.oc_block / 2);
 
                     uni_vmovups(ptr[aux_reg_output + out_off * jcp.typesize_out], vmm_acc);
                 }
@@ -589,7 +606,7 @@ void jit_uni_def_conv_fwd_kernel_f32<isa>::oc_loop(int ow_step) {
         store_output(ow_step, jcp.nb_oc_blocking, jcp.oc_block);
 
         add(aux_reg_kernel, jcp.nb_oc_blocking * jcp.nb_ic * jcp.kh * jcp.kw * jcp.ic_block * jcp.oc_block * jcp.typesize_in);
-        add(aux_reg_output, jcp.nb_oc_blocking * jcp.oc_block * jcp.typesize_out);
+        add(aux_reg_output, jcp.nb_oc_blocking * dst_oc_block_stride() * jcp.typesize_out);
         add(aux_reg_bias, jcp.nb_oc_blocking * jcp.oc_block * jcp.typesize_bia);
         sub(reg_oc_work, jcp.nb_oc_blocking * jcp.oc_block);
 
@@ -604,7 +621,7 @@ void jit_uni_def_conv_fwd_kernel_f32<isa>::oc_loop(int ow_step) {
         store_output(ow_step, 1, jcp.oc_block);
 
         add(aux_reg_kernel, jcp.nb_ic * jcp.kh * jcp.kw * jcp.ic_block * jcp.oc_block * jcp.typesize_in);
-        add(aux_reg_output, jcp.oc_block * jcp.typesize_out);
+        add(aux_reg_output, dst_oc_block_stride() * jcp.typesize_out);
         add(aux_reg_bias, jcp.oc_block * jcp.typesize_bia);
         sub(reg_oc_work, jcp.oc_block);
 
@@ -634,9 +651,9 @@ void jit_uni_def_conv_fwd_kernel_f32<isa>::ow_loop() {
 
         oc_loop(jcp.ur_w);
 
-        add(reg_input, jcp.ur_w * jcp.stride_w * jcp.ic * jcp.typesize_in);
+        add(reg_input, jcp.ur_w * jcp.stride_w * src_pixel_stride() * jcp.typesize_in);
         add(reg_def_off, jcp.ur_w * jcp.typesize_off);
-        add(reg_output, jcp.ur_w * jcp.oc * jcp.typesize_out);
+        add(reg_output, jcp.ur_w * dst_pixel_stride() * jcp.typesize_out);
 
         add(reg_ow_pos, jcp.ur_w);
         jmp(ow_loop_main, T_NEAR);
@@ -767,15 +784,20 @@ status_t jit_uni_def_conv_fwd_kernel_f32<isa>::init_conf(jit_def_conv_conf_t &jc
     if (!post_ops_ok(jcp, attr))
         return status::unimplemented;
 
+    // the blocked activations are gathered by the whole blocks, so the deformable groups should consist of them
     auto desired_act_fmt = nhwc;
+    auto blocked_act_fmt = isa == avx512_common ? nChw16c : nChw8c;
+    const bool src_can_be_blocked = isa != sse42 && (jcp.ic / jcp.dg) % jcp.ic_block == 0;
+    const bool dst_can_be_blocked = isa != sse42;
     auto desired_off_fmt = nchw;
     auto desired_wei_fmt = with_groups ? isa == avx512_common ? gOIhw16i16o : gOIhw8i8o
                                        : isa == avx512_common ? OIhw16i16o : OIhw8i8o;
 
     if (src_d.format() == any)
         CHECK(src_pd.set_format(desired_act_fmt));
-    if (src_d.format() != desired_act_fmt)
+    if (src_d.format() != desired_act_fmt && !(src_can_be_blocked && src_d.format() == blocked_act_fmt))
         return status::unimplemented;
+    jcp.src_fmt = src_d.format();
 
     if (offsets_d.format() == any)
         CHECK(offsets_pd.set_format(desired_off_fmt));
@@ -796,8 +818,9 @@ status_t jit_uni_def_conv_fwd_kernel_f32<isa>::init_conf(jit_def_conv_conf_t &jc
 
     if (dst_d.format() == any)
         CHECK(dst_pd.set_format(desired_act_fmt));
-    if (dst_d.format() != desired_act_fmt)
+    if (dst_d.format() != desired_act_fmt && !(dst_can_be_blocked && dst_d.format() == blocked_act_fmt))
         return status::unimplemented;
+    jcp.dst_fmt = dst_d.format();
 
     jcp.src_dt = cd.src_descs[0].data_type;
     jcp.off_dt = cd.src_descs[1].data_type;
@@ -96,6 +96,17 @@ private:
     inline Xbyak::Address table_val(int index)
     { return ptr[reg_table + index * vlen]; }
 
+    // the channels of the activations are either the innermost dimension (nhwc) or blocked by jcp.ic_block and
+    // jcp.oc_block (nChw8c/nChw16c), the strides below are in the elements
+    inline bool is_src_blocked() const { return jcp.src_fmt != memory_format::nhwc; }
+    inline bool is_dst_blocked() const { return jcp.dst_fmt != memory_format::nhwc; }
+    inline int src_pixel_stride() const { return is_src_blocked() ? jcp.ic_block : jcp.ic; }
+    inline int src_channels_step(int channels) const {
+        return is_src_blocked() ? channels * jcp.ih * jcp.iw : channels;
+    }
+    inline int dst_pixel_stride() const { return is_dst_blocked() ? jcp.oc_block : jcp.oc; }
+    inline int dst_oc_block_stride() const { return is_dst_blocked() ? jcp.oh * jcp.ow * jcp.oc_block : jcp.oc_block; }
+
     inline Vmm get_vmm_ker(int idx) { return Vmm(idx + 0); }
     inline Vmm get_vmm_src(int idx) { return Vmm(idx + 1); }
     inline Vmm get_vmm_acc(int idx) { return Vmm(idx + jcp.ur_w + 1); }
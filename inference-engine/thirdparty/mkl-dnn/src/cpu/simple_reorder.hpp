@@ -1564,7 +1564,8 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
 template <SIMPLE_REORDER_TEMPL_DECL>
 struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
-typename utils::enable_if<fmt_i == any && (fmt_o == OhIw8o32i || fmt_o == OhIw16o32i) && type_i == mkldnn_bin && type_o == mkldnn_bin>::type>
+typename utils::enable_if<fmt_i == any && (fmt_o == OhIw8o32i || fmt_o == OhIw16o32i || fmt_o == gOhIw8o32i || fmt_o == gOhIw16o32i)
+&& type_i == mkldnn_bin && type_o == mkldnn_bin>::type>
 {
     PLAIN_TO_BLOCKED_IS_APPLICABLE();
 
@@ -1579,7 +1580,7 @@ typename utils::enable_if<fmt_i == any && (fmt_o == OhIw8o32i || fmt_o == OhIw16
             = format_traits<fmt_o>::data_kind == dk::gwei;
         constexpr int is_1d = format_traits<fmt_o>::ndims_sp == 1;
         constexpr int is_3d = format_traits<fmt_o>::ndims_sp == 3;
-        constexpr int blksize_o = fmt_o == OhIw8o32i ? 8 : 16;
+        constexpr int blksize_o = (fmt_o == OhIw8o32i || fmt_o == gOhIw8o32i) ? 8 : 16;
         constexpr int blksize_i = 32;
 
         const auto &dims = input_d.dims();
@@ -1613,9 +1614,10 @@ typename utils::enable_if<fmt_i == any && (fmt_o == OhIw8o32i || fmt_o == OhIw16
 
                         uint8_t bin_val = 0x00;
                         for (int ic = icb*nbits, shift = 0; ic < std::min(IC, (icb + 1)*nbits); ic++, shift++) {
-                            size_t iidx = (i_mult_o * nb_oc + oc) * input_d.blocking_desc().strides[0][0] +
-                                          (i_mult_i * nb_ic + ic) * input_d.blocking_desc().strides[0][1] +
-                                                                h * input_d.blocking_desc().strides[0][2] +
+                            size_t iidx = (w_groups ? g * input_d.blocking_desc().strides[0][0] : 0) +
+                                          (i_mult_o * nb_oc + oc) * input_d.blocking_desc().strides[0][w_groups + 0] +
+                                          (i_mult_i * nb_ic + ic) * input_d.blocking_desc().strides[0][w_groups + 1] +
+                                                                h * input_d.blocking_desc().strides[0][w_groups + 2] +
                                                                 w;
 
                             uint8_t bit = extract_bit(input[iidx / nbits], (uint8_t)(iidx % nbits));
@@ -1638,6 +1640,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 typename utils::enable_if<fmt_i == any
 && block_format_traits<format_traits<fmt_o>::blk_fmt>::blk_ndims == 2
 && fmt_o != OhIw8o4i && fmt_o != gOhIw8o4i && fmt_o != OdhIw8o4i && fmt_o != gOdhIw8o4i && fmt_o != OhIw8o32i && fmt_o != OhIw16o32i
+&& fmt_o != gOhIw8o32i && fmt_o != gOhIw16o32i
 && fmt_o != hwigo && fmt_o != dhwigo>::type>
 {
     PLAIN_TO_BLOCKED_IS_APPLICABLE();
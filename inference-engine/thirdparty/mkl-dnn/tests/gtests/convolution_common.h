@@ -81,9 +81,9 @@
 #define FMT_DATA_BLOCKED nhwc
 #define FMT_DATA_BLOCKED16 nhwc
 #define FMT_WEIGHTS_BLOCKED OhIw8o32i
-#define FMT_WEIGHTS_BLOCKED_G OhIw8o32i
+#define FMT_WEIGHTS_BLOCKED_G gOhIw8o32i
 #define FMT_WEIGHTS_BLOCKED16 OhIw16o32i
-#define FMT_WEIGHTS_BLOCKED16_G OhIw16o32i
+#define FMT_WEIGHTS_BLOCKED16_G gOhIw16o32i
 #define FMT_WEIGHTS_DW_BLOCKED Goihw8g
 #define FMT_WEIGHTS_DW_BLOCKED16 Goihw16g
 #endif
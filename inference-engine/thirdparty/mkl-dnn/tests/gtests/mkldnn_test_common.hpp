@@ -321,6 +321,8 @@ inline mkldnn::memory::desc create_md(mkldnn::memory::dims dims,
     case f::OdhIw8o4i:
     case f::OdhIw8o4i_s8s8:
     case f::gOhIw8o4i_s8s8:
+    case f::gOhIw8o32i:
+    case f::gOhIw16o32i:
     case f::OIdhw4i16o4i:
     case f::OIdhw4i16o4i_s8s8:
         ndims = 5; break;
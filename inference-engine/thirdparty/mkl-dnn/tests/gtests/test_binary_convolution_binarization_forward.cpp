@@ -88,6 +88,20 @@ INST_TEST_CASE(SimpleSmall_Blocked16_1x1_Padded_Channels,
         2, 1, 256, 3, 3, 256, 3, 3, 1, 1, 0, 0, 1, 1)
 );
 
+INST_TEST_CASE(SimpleSmall_Grouped_Blocked,
+    PARAMS_WITH_BINARIZATION(FMT_DATA_BLOCKED, FMT_WEIGHTS_BLOCKED_G, FMT_BIAS, FMT_DATA_BLOCKED,
+        2, 2, 64, 10, 10, 32, 10, 10, 3, 3, 1, 1, 1, 1),
+    PARAMS_WITH_BINARIZATION(FMT_DATA_BLOCKED, FMT_WEIGHTS_BLOCKED_G, FMT_BIAS, FMT_DATA_BLOCKED,
+        2, 4, 128, 3, 3, 64, 3, 3, 1, 1, 0, 0, 1, 1)
+);
+
+INST_TEST_CASE(SimpleSmall_Grouped_Blocked16,
+    PARAMS_WITH_BINARIZATION(FMT_DATA_BLOCKED, FMT_WEIGHTS_BLOCKED16_G, FMT_BIAS, FMT_DATA_BLOCKED,
+        2, 2, 64, 10, 10, 32, 10, 10, 3, 3, 1, 1, 1, 1),
+    PARAMS_WITH_BINARIZATION(FMT_DATA_BLOCKED, FMT_WEIGHTS_BLOCKED16_G, FMT_BIAS, FMT_DATA_BLOCKED,
+        2, 4, 128, 3, 3, 64, 3, 3, 1, 1, 0, 0, 1, 1)
+);
+
 
 //INST_TEST_CASE(SimpleSmall_Depthwise_Blocked_Padded_Channels,
 //    PARAMS_WITH_BINARIZATION(FMT_DATA_BLOCKED, FMT_WEIGHTS_BLOCKED_G, FMT_BIAS, FMT_DATA_BLOCKED,
@@ -100,6 +100,24 @@ INST_TEST_CASE(SimpleSmall_Blocked16_1x1_Padded_Channels,
         2, 1, 111, 13, 13, 71, 13, 13, 1, 1, 0, 0, 1, 1)
 );
 
+INST_TEST_CASE(SimpleSmall_Grouped_Blocked,
+    PARAMS(FMT_DATA_BLOCKED, FMT_WEIGHTS_BLOCKED_G, FMT_BIAS, FMT_DATA_BLOCKED,
+        2, 2, 64, 13, 13, 32, 13, 13, 3, 3, 1, 1, 1, 1),
+    PARAMS(FMT_DATA_BLOCKED, FMT_WEIGHTS_BLOCKED_G, FMT_BIAS, FMT_DATA_BLOCKED,
+        2, 4, 128, 10, 10, 64, 5, 5, 3, 3, 1, 1, 2, 2),
+    PARAMS(FMT_DATA_BLOCKED, FMT_WEIGHTS_BLOCKED_G, FMT_BIAS, FMT_DATA_BLOCKED,
+        2, 2, 64, 7, 7, 96, 7, 7, 1, 1, 0, 0, 1, 1)
+);
+
+INST_TEST_CASE(SimpleSmall_Grouped_Blocked16,
+    PARAMS(FMT_DATA_BLOCKED, FMT_WEIGHTS_BLOCKED16_G, FMT_BIAS, FMT_DATA_BLOCKED,
+        2, 2, 64, 13, 13, 32, 13, 13, 3, 3, 1, 1, 1, 1),
+    PARAMS(FMT_DATA_BLOCKED, FMT_WEIGHTS_BLOCKED16_G, FMT_BIAS, FMT_DATA_BLOCKED,
+        2, 4, 128, 10, 10, 64, 5, 5, 3, 3, 1, 1, 2, 2),
+    PARAMS(FMT_DATA_BLOCKED, FMT_WEIGHTS_BLOCKED16_G, FMT_BIAS, FMT_DATA_BLOCKED,
+        2, 2, 64, 7, 7, 96, 7, 7, 1, 1, 0, 0, 1, 1)
+);
+
 //INST_TEST_CASE(SimpleSmall_Depthwise_Blocked_Padded_Channels,
 //    PARAMS(FMT_DATA_BLOCKED, FMT_WEIGHTS_DW_BLOCKED, FMT_BIAS, FMT_DATA_BLOCKED,
 //        2, 126, 126, 10, 10, 126, 10, 10, 3, 3, 1, 1, 1, 1),
@@ -52,8 +52,9 @@ void compute_ref_bin_conv_fwd(const test_binary_convolution_params_t &p,
     int nbits = 8;
 
     size_t padded_ic = src_d.data.layout_desc.blocking.padding_dims[1];
-    size_t padded_ic_w = weights_d.data.layout_desc.blocking.padding_dims[1];
-    size_t padded_oc_w = weights_d.data.layout_desc.blocking.padding_dims[0];
+    const int with_groups = weights_d.data.ndims == 5;
+    size_t padded_ic_w = weights_d.data.layout_desc.blocking.padding_dims[with_groups + 1];
+    size_t padded_oc_w = weights_d.data.layout_desc.blocking.padding_dims[with_groups + 0];
 
     auto extract_bit = [](uint8_t val, uint8_t bit) -> uint8_t {
         return (uint8_t) ((val >> bit) & 0x0001);
@@ -63,7 +64,7 @@ void compute_ref_bin_conv_fwd(const test_binary_convolution_params_t &p,
         [&](int n, int g, int oc, int oh, int ow) {
             int32_t a = 0;
             int roi = 0;
-            for (int ic = 0; ic < c.ic; ic++) {
+            for (int ic = 0; ic < c.ic / c.ng; ic++) {
                 for (int kh = 0; kh < c.kh; kh++) {
                     for (int kw = 0; kw < c.kw; kw++) {
                         int ih = oh * c.strh - c.padh + kh * (1 + c.dilh);
@@ -85,10 +86,8 @@ void compute_ref_bin_conv_fwd(const test_binary_convolution_params_t &p,
                              s = extract_bit(src_data[iidx/nbits], (uint8_t)(iidx % nbits));
                         }
 
-                        size_t widx = g * padded_oc_w / c.ng * padded_ic_w
-                                      / c.ng * c.kh * c.kw
-                                      + oc * padded_ic_w / c.ng * c.kh * c.kw
-                                      + ic * c.kh * c.kw + kh * c.kw + kw;
+                        size_t widx = ((g * padded_oc_w + oc) * padded_ic_w + ic) * c.kh * c.kw
+                                      + kh * c.kw + kw;
                         widx = map_index(weights_d, widx);
 
                         uint8_t w = extract_bit(weights_data[widx/nbits], (uint8_t)(widx % nbits));
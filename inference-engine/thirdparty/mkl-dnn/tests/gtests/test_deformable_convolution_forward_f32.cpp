@@ -106,4 +106,26 @@ INST_TEST_CASE(SimpleSmall_Blocked16,
         2, 1, 32, 32, 10, 10, 48, 5, 5, 3, 3, 1, 1, 2, 2, 2, 2)
 );
 
+INST_TEST_CASE(SimpleSmall_Blocked8_Activations,
+    PARAMS(nChw8c, nchw, OIhw8i8o, x, nChw8c,
+        2, 1, 1, 16, 10, 10, 24, 10, 10, 1, 1, 0, 0, 1, 1, 1, 1),
+    PARAMS(nChw8c, nchw, OIhw8i8o, x, nChw8c,
+        2, 1, 1, 16, 10, 10, 20, 10, 10, 3, 3, 1, 1, 1, 1, 1, 1),
+    PARAMS(nChw8c, nchw, OIhw8i8o, x, nChw8c,
+        2, 1, 2, 32, 10, 10, 48, 5, 5, 3, 3, 1, 1, 2, 2, 1, 1),
+    PARAMS(nChw8c, nchw, OIhw8i8o, x, nChw8c,
+        2, 1, 4, 64, 10, 10, 48, 5, 5, 3, 3, 1, 1, 2, 2, 2, 2)
+);
+
+INST_TEST_CASE(SimpleSmall_Blocked16_Activations,
+    PARAMS(nChw16c, nchw, OIhw16i16o, x, nChw16c,
+        2, 1, 1, 16, 10, 10, 32, 10, 10, 1, 1, 0, 0, 1, 1, 1, 1),
+    PARAMS(nChw16c, nchw, OIhw16i16o, x, nChw16c,
+        2, 1, 1, 32, 10, 10, 40, 10, 10, 3, 3, 1, 1, 1, 1, 1, 1),
+    PARAMS(nChw16c, nchw, OIhw16i16o, x, nChw16c,
+        2, 1, 2, 32, 10, 10, 48, 5, 5, 3, 3, 1, 1, 2, 2, 1, 1),
+    PARAMS(nChw16c, nchw, OIhw16i16o, x, nChw16c,
+        2, 1, 4, 64, 10, 10, 48, 5, 5, 3, 3, 1, 1, 2, 2, 2, 2)
+);
+
 }
@@ -51,6 +51,16 @@ extern int usbFdRead;
 #define XLINK_USB_DATA_TIMEOUT 0
 #endif
 
+// The largest bulk transfer the data is split into by default, the larger ones take fewer round-trips of libusb
+#ifndef XLINK_USB_CHUNK_SIZE
+#define XLINK_USB_CHUNK_SIZE DEFAULT_CHUNKSZ
+#endif
+
+// The chunks of USB 3 are the multiples of its largest packet, so the reads do not end on a short packet
+#define USB_CHUNK_ALIGNMENT 1024
+
+static int usbChunkSize = XLINK_USB_CHUNK_SIZE;
+
 // ------------------------------------
 // Helpers declaration. Begin.
 // ------------------------------------
@@ -99,6 +109,16 @@ int XLinkPlatformRead(xLinkDeviceHandle_t *deviceHandle, void *data, int size)
     return read_fcts[deviceHandle->protocol](deviceHandle->xLinkFD, data, size);
 }
 
+xLinkPlatformErrorCode_t XLinkPlatformSetUsbChunkSize(unsigned int size)
+{
+    if (size == 0 || size % USB_CHUNK_ALIGNMENT != 0 || size > INT32_MAX) {
+        mvLog(MVLOG_ERROR, "USB chunk size %u is not a positive multiple of %d", size, USB_CHUNK_ALIGNMENT);
+        return X_LINK_PLATFORM_INVALID_PARAMETERS;
+    }
+    usbChunkSize = (int)size;
+    return X_LINK_PLATFORM_SUCCESS;
+}
+
 void* XLinkPlatformAllocateData(uint32_t size, uint32_t alignment)
 {
     void* ret = NULL;
@@ -344,7 +364,7 @@ int pciePlatformRead(void *f, void *data, int size)
 #ifdef USE_USB_VSC
 int usb_read(libusb_device_handle *f, void *data, size_t size)
 {
-    const int chunk_size = DEFAULT_CHUNKSZ;
+    const int chunk_size = usbChunkSize;
     while(size > 0)
     {
         int bt, ss = size;
@@ -365,7 +385,7 @@ int usb_read(libusb_device_handle *f, void *data, size_t size)
 
 int usb_write(libusb_device_handle *f, const void *data, size_t size)
 {
-    const int chunk_size = DEFAULT_CHUNKSZ;
+    const int chunk_size = usbChunkSize;
     while(size > 0)
     {
         int bt, ss = size;
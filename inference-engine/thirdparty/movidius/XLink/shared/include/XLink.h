@@ -97,6 +97,14 @@ XLinkError_t XLinkResetRemote(linkId_t id);
  */
 XLinkError_t XLinkResetAll();
 
+/**
+ * @brief Sets the size of the largest USB bulk transfer the data is split into, the larger ones take fewer
+ * round-trips of libusb. XLINK_USB_CHUNK_SIZE of the build is used by default
+ * @param[in] size – the size in bytes, a positive multiple of 1024
+ * @return Status code of the operation: X_LINK_SUCCESS (0) for success
+ */
+XLinkError_t XLinkSetUsbChunkSize(unsigned int size);
+
 #endif // __PC__
 
 /**
@@ -70,6 +70,10 @@ int XLinkPlatformCloseRemote(xLinkDeviceHandle_t* deviceHandle);
 int XLinkPlatformWrite(xLinkDeviceHandle_t *deviceHandle, void *data, int size);
 int XLinkPlatformRead(xLinkDeviceHandle_t *deviceHandle, void *data, int size);
 
+#ifdef __PC__
+xLinkPlatformErrorCode_t XLinkPlatformSetUsbChunkSize(unsigned int size);
+#endif // __PC__
+
 void* XLinkPlatformAllocateData(uint32_t size, uint32_t alignment);
 void XLinkPlatformDeallocateData(void *ptr, uint32_t size, uint32_t alignment);
 
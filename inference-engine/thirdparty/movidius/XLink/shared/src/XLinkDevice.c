@@ -277,6 +277,11 @@ XLinkError_t XLinkResetAll()
     return X_LINK_SUCCESS;
 }
 
+XLinkError_t XLinkSetUsbChunkSize(unsigned int size)
+{
+    return parsePlatformError(XLinkPlatformSetUsbChunkSize(size));
+}
+
 #endif // __PC__
 
 XLinkError_t XLinkProfStart()
@@ -53,6 +53,11 @@ typedef enum {
     NC_RW_COMMON_TIMEOUT_MSEC = 2,
     NC_RW_DEVICE_OPEN_TIMEOUT_MSEC = 3,
     NC_RW_RESET_ALL = 9000,     // resetAll on initialize
+    NC_RW_ATTACH_BOOTED_DEVICES = 9001, // int, default 0. ncDeviceOpen connects to an already booted device
+                                        // before booting another one, the booted devices are not reset on
+                                        // initialize. Set it before the first ncDeviceOpen
+    NC_RW_USB_CHUNK_SIZE = 9002,        // int, the largest USB bulk transfer in bytes, a multiple of 1024.
+                                        // Write only, the default is XLINK_USB_CHUNK_SIZE of the XLink build
 } ncGlobalOption_t;
 
 typedef enum {
@@ -252,6 +257,17 @@ MVNC_EXPORT_API ncStatus_t ncGraphQueueInferenceWithFifoElem(struct ncGraphHandl
                                                              struct ncFifoHandle_t* fifoOut, const void *inputTensor,
                                                              unsigned int * inputTensorLength, void *userParam);
 
+/**
+ * @brief Writes count input elements of inputTensorLength bytes each and triggers an inference on every one,
+ *        the triggers of the batch share one lock of the device and one wait for the responses
+ * @param userParams - the user parameters of the elements or NULL
+ */
+MVNC_EXPORT_API ncStatus_t ncGraphQueueInferencesWithFifoElems(struct ncGraphHandle_t *graphHandle,
+                                                               struct ncFifoHandle_t* fifoIn,
+                                                               struct ncFifoHandle_t* fifoOut, const void **inputTensors,
+                                                               unsigned int * inputTensorLength, void **userParams,
+                                                               unsigned int count);
+
 #ifdef __cplusplus
 }
 #endif
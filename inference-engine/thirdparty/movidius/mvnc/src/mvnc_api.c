@@ -69,6 +69,7 @@
 
 static int initialized = 0;
 static int reset_all = 1;
+static int attach_booted = 0;
 
 static int g_deviceConnectTimeoutSec = 15;
 
@@ -356,7 +357,8 @@ static ncStatus_t initializeXLink()
     }
 
 #if !(defined(NO_BOOT))
-    if (reset_all) {
+    // The booted devices are kept for attaching to them
+    if (reset_all && !attach_booted) {
         resetAll();
     }
 #endif  // NO_BOOT
@@ -659,6 +661,55 @@ ncStatus_t ncSetDeviceConnectTimeout(int deviceConnectTimeoutSec) {
     return NC_OK;
 }
 
+#if !(defined(NO_BOOT))
+/**
+ * @brief Connects to the first suitable device booted before (e.g. with ncDeviceLoadFirmware by a process which
+ *        keeps the devices warm) and not opened by this process. A device connected to another process refuses
+ *        the connection, so the next one is tried
+ * @return handler of the connected link or NULL
+ */
+static XLinkHandler_t* attachBootedDevice(const deviceDesc_t in_deviceDesc, deviceDesc_t* out_bootedDevice) {
+    deviceDesc_t bootedDevices[NC_MAX_DEVICES] = { { 0 } };
+    unsigned int bootedCount = 0;
+    XLinkFindAllSuitableDevices(X_LINK_BOOTED, in_deviceDesc, bootedDevices,
+                                NC_MAX_DEVICES, &bootedCount);
+
+    unsigned int i;
+    for (i = 0; i < bootedCount; ++i) {
+        int opened = 0;
+        struct _devicePrivate_t *d = devices;
+        while (d) {
+            if (d->dev_addr_booted &&
+                strncmp(d->dev_addr_booted, bootedDevices[i].name, NC_MAX_NAME_SIZE) == 0) {
+                opened = 1;
+                break;
+            }
+            d = d->next;
+        }
+        if (opened) {
+            continue;
+        }
+
+        XLinkHandler_t* handler = calloc(1, sizeof(XLinkHandler_t));
+        if (!handler) {
+            mvLog(MVLOG_ERROR, "Memory allocation failed");
+            return NULL;
+        }
+        handler->protocol = bootedDevices[i].protocol;
+        handler->devicePath = bootedDevices[i].name;
+        if (XLinkConnect(handler) == X_LINK_SUCCESS) {
+            mvLog(MVLOG_INFO, "Attached to booted device %s", bootedDevices[i].name);
+            *out_bootedDevice = bootedDevices[i];
+            handler->devicePath = NULL;
+            return handler;
+        }
+        mvLog(MVLOG_DEBUG, "Booted device %s is busy", bootedDevices[i].name);
+        free(handler);
+    }
+    return NULL;
+}
+#endif  // NO_BOOT
+
 ncStatus_t ncDeviceOpen(struct ncDeviceHandle_t **deviceHandlePtr,
     struct ncDeviceDescr_t in_ncDeviceDesc, int watchdogInterval, const char* customFirmwareDirectory) {
 
@@ -758,6 +809,20 @@ ncStatus_t ncDeviceOpen(struct ncDeviceHandle_t **deviceHandlePtr,
     //      Search for device
 
     XLinkError_t rc = X_LINK_ERROR;
+    XLinkHandler_t* attachedHandler = NULL;
+#if !(defined(NO_BOOT))
+    if (attach_booted) {
+        attachedHandler = attachBootedDevice(in_deviceDesc, &deviceDescToBoot);
+        if (attachedHandler) {
+            rc = X_LINK_SUCCESS;
+            // The device was booted by another process, it is not pinged after this one closes it
+            if (watchdogInterval > 0) {
+                mvLog(MVLOG_INFO, "Watchdog for already booted device would be disabled");
+                watchdogInterval = 0;
+            }
+        }
+    }
+#endif
     double waittm = timeInSeconds() + DEVICE_APPEAR_TIMEOUT_ON_OPEN;
     while ((rc != X_LINK_SUCCESS) && (timeInSeconds() < waittm)) {
         rc = XLinkFindFirstSuitableDevice(state, in_deviceDesc, &deviceDescToBoot);
@@ -796,12 +861,14 @@ ncStatus_t ncDeviceOpen(struct ncDeviceHandle_t **deviceHandlePtr,
         CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&deviceOpenMutex));
         GLOBAL_UNLOCK();
         mvLog(MVLOG_ERROR, "Memory allocation failed");
+        free(attachedHandler);
         free(d);
         free(dH);
         return NC_OUT_OF_MEMORY;
     }
 
     if (d->dev_addr == NULL) {
+        free(attachedHandler);
         destroyDeviceHandle(deviceHandlePtr);
         CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&deviceOpenMutex));
         GLOBAL_UNLOCK();
@@ -811,7 +878,7 @@ ncStatus_t ncDeviceOpen(struct ncDeviceHandle_t **deviceHandlePtr,
     //--------------------------------------------------------
     //      Boot device
 
-    XLinkHandler_t* handler = calloc(1, sizeof(XLinkHandler_t));
+    XLinkHandler_t* handler = attachedHandler ? attachedHandler : calloc(1, sizeof(XLinkHandler_t));
     if (!handler) {
         mvLog(MVLOG_ERROR, "Memory allocation failed");
         destroyDeviceHandle(deviceHandlePtr);
@@ -831,7 +898,11 @@ ncStatus_t ncDeviceOpen(struct ncDeviceHandle_t **deviceHandlePtr,
     handler->devicePath = d->dev_addr_booted;
     rc = XLinkConnect(handler);
 #else
-    if (handler->protocol == X_LINK_PCIE) {                             // PCIe
+    if (attachedHandler) {                                              // Already booted and connected
+        d->protocol_booted = d->protocol;
+        d->dev_addr_booted = mvnc_strdup(d->dev_addr);
+        handler->devicePath = d->dev_addr_booted;
+    } else if (handler->protocol == X_LINK_PCIE) {                      // PCIe
         ncStatus_t sc;
         char mv_cmd_file_path[MAX_PATH_LENGTH] = { 0 };
 
@@ -2543,6 +2614,12 @@ ncStatus_t ncGlobalSetOption(ncGlobalOption_t option, const void *data,
         if (!initialized)
             reset_all = *(int*)data;
         break;
+    case NC_RW_ATTACH_BOOTED_DEVICES:
+        if (initialized && !attach_booted && *(int*)data) {
+            mvLog(MVLOG_WARN, "The booted devices could have been reset on initialize already");
+        }
+        attach_booted = *(int*)data;
+        break;
     case NC_RW_COMMON_TIMEOUT_MSEC: {
         int gTimeout = *(int *) data;
         XLinkError_t rc = XLinkSetCommonTimeOutMsec(gTimeout);
@@ -2561,6 +2638,15 @@ ncStatus_t ncGlobalSetOption(ncGlobalOption_t option, const void *data,
         }
         break;
     }
+    case NC_RW_USB_CHUNK_SIZE: {
+        int chunkSize = *(int *) data;
+        XLinkError_t rc = chunkSize > 0 ? XLinkSetUsbChunkSize((unsigned int) chunkSize) : X_LINK_ERROR;
+        if (rc) {
+            mvLog(MVLOG_ERROR, "Set USB chunk size %d failed, rc = %s\n", chunkSize, XLinkErrorToStr(rc));
+            return NC_INVALID_PARAMETERS;
+        }
+        break;
+    }
     default:
         mvLog(MVLOG_ERROR, "No such option");
         return NC_INVALID_PARAMETERS;
@@ -2587,6 +2673,12 @@ ncStatus_t ncGlobalGetOption(ncGlobalOption_t option, void *data, unsigned int *
         *(int*)data = reset_all;
         *dataLength = sizeof(reset_all);
         break;
+    case NC_RW_ATTACH_BOOTED_DEVICES:
+        *(int*)data = attach_booted;
+        *dataLength = sizeof(attach_booted);
+        break;
+    case NC_RW_USB_CHUNK_SIZE:
+        return NC_UNSUPPORTED_FEATURE;
     default:
         mvLog(MVLOG_ERROR, "No such option");
         return NC_INVALID_PARAMETERS;
@@ -3296,63 +3388,22 @@ static ncStatus_t tensorCompatibility(struct ncTensorDescriptor_t *tens1,
     return NC_OK;
 }
 
-ncStatus_t ncGraphQueueInference(struct ncGraphHandle_t * graphHandle,
-                                 struct ncFifoHandle_t ** fifoIn,
-                                 unsigned int inFifoCount,
-                                 struct ncFifoHandle_t ** fifoOut,
-                                 unsigned int outFifoCount)
+// Checks the graph and the fifos can run an inference, graph_stream_m is locked by the caller
+static ncStatus_t checkTriggerFifos(struct _graphPrivate_t *g,
+                                    struct _fifoPrivate_t *fi,
+                                    struct _fifoPrivate_t *fo)
 {
-    mvLog(MVLOG_DEBUG, "Trigger start");
-    CHECK_HANDLE_CORRECT(graphHandle);
-    CHECK_HANDLE_CORRECT(fifoIn);
-    CHECK_HANDLE_CORRECT(fifoOut);
-
-    if (!fifoIn[0] || !fifoOut[0]) {
-        mvLog(MVLOG_ERROR, "Fifos data are NULL");
-        return NC_INVALID_HANDLE;
-    }
-    if (!inFifoCount || !outFifoCount)
-        return NC_INVALID_PARAMETERS;
-
-    struct _graphPrivate_t *g = graphHandle->private_data;
-
-    if(g) {
-        CHECK_MUTEX_SUCCESS_RC(pthread_mutex_lock(&g->dev->graph_stream_m), NC_ERROR);
-    } else {
-        return NC_NOT_ALLOCATED;
-    }
-
-    if (!g || g->state != NC_GRAPH_ALLOCATED) {
+    if (g->state != NC_GRAPH_ALLOCATED) {
         mvLog(MVLOG_ERROR, "Graph hasn't been allocated");
-        CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
         return NC_NOT_ALLOCATED;
     }
-
-    if (g->input_count != inFifoCount || g->output_count != outFifoCount) {
-        mvLog(MVLOG_ERROR,
-              "number of input or output fifos is not compatible with graph");
-        CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
-        return NC_INVALID_PARAMETERS;
-    }
-
-    if (inFifoCount != 1 || outFifoCount != 1) {
-        mvLog(MVLOG_ERROR,
-              "Currently multiple inputs and outputs are not supported");
-        CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
-        return NC_UNSUPPORTED_FEATURE;
-    }
-    struct _fifoPrivate_t *fi = fifoIn[0]->private_data;
-    struct _fifoPrivate_t *fo = fifoOut[0]->private_data;
-    ncStatus_t rc;
     if (fi->state != NC_FIFO_ALLOCATED || fo->state != NC_FIFO_ALLOCATED) {
         mvLog(MVLOG_ERROR, "ffos hasn't been allocated");
-        CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
         return NC_NOT_ALLOCATED;
     }
     //WO fifos have no graph access
     if (fo->type == NC_FIFO_HOST_WO) {
         //graphs have no access to one of the fifos
-        CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
         return NC_INVALID_PARAMETERS;
     }
     if (tensorCompatibility(&fi->graph_tensor_desc, &g->input_tensor_desc) != NC_OK ||
@@ -3360,17 +3411,17 @@ ncStatus_t ncGraphQueueInference(struct ncGraphHandle_t * graphHandle,
                             &g->output_tensor_desc) != NC_OK) {
         mvLog(MVLOG_WARN,
               "Input/Output tensor shape is not compatible with graph");
-        CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
         return NC_INVALID_PARAMETERS;
     }
+    return NC_OK;
+}
 
-    graphCMDCommand_t cmd;
-    cmd.type = GRAPH_TRIGGER_CMD;
-    cmd.id = g->id;
-    cmd.buffId1 = fi->id;
-    cmd.buffId2 = fo->id;
-
+// Moves the next element of the input fifo to the output one, graph_stream_m is locked by the caller
+static ncStatus_t consumeTriggerElement(struct _fifoPrivate_t *fi,
+                                        struct _fifoPrivate_t *fo)
+{
     void* user_param;
+    ncStatus_t rc;
     CHECK_MUTEX_SUCCESS_RC(pthread_mutex_lock(&fi->fifo_mutex), NC_ERROR);
     fi->consumers_remaining--;
 
@@ -3382,7 +3433,6 @@ ncStatus_t ncGraphQueueInference(struct ncGraphHandle_t * graphHandle,
                 mvLog(MVLOG_ERROR, "Can't read packet, rc: %s", XLinkErrorToStr(rc));
                 CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&fi->fifo_mutex));
                 fi->dev->state = NC_DEVICE_FAILED;
-                CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
                 return parseXLinkError(rc);
             }
             rc = XLinkReleaseData(fi->streamId);
@@ -3390,7 +3440,6 @@ ncStatus_t ncGraphQueueInference(struct ncGraphHandle_t * graphHandle,
                 mvLog(MVLOG_ERROR,"Failed to release data, rc: %s", XLinkErrorToStr(rc));
                 CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&fi->fifo_mutex));
                 fi->dev->state = NC_DEVICE_FAILED;
-                CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
                 return parseXLinkError(rc);
             }
         }
@@ -3401,7 +3450,6 @@ ncStatus_t ncGraphQueueInference(struct ncGraphHandle_t * graphHandle,
     if (fi->write_count <= fi->consumed_by_graph) {
         mvLog(MVLOG_WARN, "No point on triggering graph. There are no more elements in the input FIFO");
         CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&fi->fifo_mutex));
-        CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
         return NC_UNAUTHORIZED;
     }
     fi->consumed_by_graph++;
@@ -3411,11 +3459,77 @@ ncStatus_t ncGraphQueueInference(struct ncGraphHandle_t * graphHandle,
     rc = pushUserParam(fo, user_param , 0);
     if(rc != NC_OK) {
         CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&fo->fifo_mutex));
-        CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
         return rc;
     }
     fo->write_count++;
     CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&fo->fifo_mutex));
+    return NC_OK;
+}
+
+ncStatus_t ncGraphQueueInference(struct ncGraphHandle_t * graphHandle,
+                                 struct ncFifoHandle_t ** fifoIn,
+                                 unsigned int inFifoCount,
+                                 struct ncFifoHandle_t ** fifoOut,
+                                 unsigned int outFifoCount)
+{
+    mvLog(MVLOG_DEBUG, "Trigger start");
+    CHECK_HANDLE_CORRECT(graphHandle);
+    CHECK_HANDLE_CORRECT(fifoIn);
+    CHECK_HANDLE_CORRECT(fifoOut);
+
+    if (!fifoIn[0] || !fifoOut[0]) {
+        mvLog(MVLOG_ERROR, "Fifos data are NULL");
+        return NC_INVALID_HANDLE;
+    }
+    if (!inFifoCount || !outFifoCount)
+        return NC_INVALID_PARAMETERS;
+
+    struct _graphPrivate_t *g = graphHandle->private_data;
+
+    if(g) {
+        CHECK_MUTEX_SUCCESS_RC(pthread_mutex_lock(&g->dev->graph_stream_m), NC_ERROR);
+    } else {
+        return NC_NOT_ALLOCATED;
+    }
+
+    if (g->state != NC_GRAPH_ALLOCATED) {
+        mvLog(MVLOG_ERROR, "Graph hasn't been allocated");
+        CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
+        return NC_NOT_ALLOCATED;
+    }
+
+    if (g->input_count != inFifoCount || g->output_count != outFifoCount) {
+        mvLog(MVLOG_ERROR,
+              "number of input or output fifos is not compatible with graph");
+        CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
+        return NC_INVALID_PARAMETERS;
+    }
+
+    if (inFifoCount != 1 || outFifoCount != 1) {
+        mvLog(MVLOG_ERROR,
+              "Currently multiple inputs and outputs are not supported");
+        CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
+        return NC_UNSUPPORTED_FEATURE;
+    }
+    struct _fifoPrivate_t *fi = fifoIn[0]->private_data;
+    struct _fifoPrivate_t *fo = fifoOut[0]->private_data;
+    ncStatus_t rc = checkTriggerFifos(g, fi, fo);
+    if (rc != NC_OK) {
+        CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
+        return rc;
+    }
+
+    graphCMDCommand_t cmd;
+    cmd.type = GRAPH_TRIGGER_CMD;
+    cmd.id = g->id;
+    cmd.buffId1 = fi->id;
+    cmd.buffId2 = fo->id;
+
+    rc = consumeTriggerElement(fi, fo);
+    if (rc != NC_OK) {
+        CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
+        return rc;
+    }
 
     rc = trySendCommand(g->dev->graph_monitor_stream_id, &cmd, sizeof(cmd));
     if(rc != 0){
@@ -3451,3 +3565,96 @@ ncStatus_t ncGraphQueueInferenceWithFifoElem(struct ncGraphHandle_t *
 
     return ncGraphQueueInference(graphHandle, &fifoIn, 1, &fifoOut, 1);
 }
+
+ncStatus_t ncGraphQueueInferencesWithFifoElems(struct ncGraphHandle_t *
+                                               graphHandle,
+                                               struct ncFifoHandle_t * fifoIn,
+                                               struct ncFifoHandle_t * fifoOut,
+                                               const void **inputTensors,
+                                               unsigned int * inputTensorLength,
+                                               void **userParams,
+                                               unsigned int count)
+{
+    mvLog(MVLOG_DEBUG, "Batched trigger start, %u elements", count);
+    CHECK_HANDLE_CORRECT(graphHandle);
+    CHECK_HANDLE_CORRECT(fifoIn);
+    CHECK_HANDLE_CORRECT(fifoOut);
+    CHECK_HANDLE_CORRECT_RC(inputTensors, NC_INVALID_PARAMETERS);
+    CHECK_HANDLE_CORRECT_RC(inputTensorLength, NC_INVALID_PARAMETERS);
+    if (!count)
+        return NC_INVALID_PARAMETERS;
+
+    struct _graphPrivate_t *g = graphHandle->private_data;
+    struct _fifoPrivate_t *fi = fifoIn->private_data;
+    struct _fifoPrivate_t *fo = fifoOut->private_data;
+    if (!g || !fi || !fo)
+        return NC_NOT_ALLOCATED;
+    if (g->input_count != 1 || g->output_count != 1) {
+        mvLog(MVLOG_ERROR,
+              "Currently multiple inputs and outputs are not supported");
+        return NC_UNSUPPORTED_FEATURE;
+    }
+    if (count > (unsigned int)fi->num_elements) {
+        mvLog(MVLOG_ERROR, "%u elements do not fit the input fifo of %d elements",
+              count, fi->num_elements);
+        return NC_INVALID_PARAMETERS;
+    }
+
+    // The input elements go on the fifo stream, they do not hold the graph monitor stream
+    // the other inferences of the device are triggered on
+    unsigned int i;
+    ncStatus_t rc;
+    for (i = 0; i < count; i++) {
+        unsigned int length = *inputTensorLength;
+        rc = ncFifoWriteElem(fifoIn, inputTensors[i], &length,
+                             userParams ? userParams[i] : NULL);
+        if (rc != NC_OK) {
+            *inputTensorLength = length;
+            return rc;
+        }
+    }
+
+    CHECK_MUTEX_SUCCESS_RC(pthread_mutex_lock(&g->dev->graph_stream_m), NC_ERROR);
+    rc = checkTriggerFifos(g, fi, fo);
+    if (rc != NC_OK) {
+        CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
+        return rc;
+    }
+
+    graphCMDCommand_t cmd;
+    cmd.type = GRAPH_TRIGGER_CMD;
+    cmd.id = g->id;
+    cmd.buffId1 = fi->id;
+    cmd.buffId2 = fo->id;
+
+    // The trigger commands are sent back to back and the responses are collected afterwards,
+    // so the device starts the next inference without waiting for the host to see the previous response.
+    // Every sent command gets its response read, so the graph monitor stream stays in sync on errors.
+    unsigned int sent = 0;
+    for (; sent < count; sent++) {
+        rc = consumeTriggerElement(fi, fo);
+        if (rc != NC_OK)
+            break;
+        rc = trySendCommand(g->dev->graph_monitor_stream_id, &cmd, sizeof(cmd));
+        if (rc != NC_OK) {
+            mvLog(MVLOG_ERROR, "Can't send trigger request");
+            g->dev->state = NC_DEVICE_FAILED;
+            break;
+        }
+    }
+    for (i = 0; i < sent; i++) {
+        if (checkGraphMonitorResponse(g->dev->graph_monitor_stream_id)) {
+            mvLog(MVLOG_ERROR, "Can't get trigger response");
+            g->dev->state = NC_DEVICE_FAILED;
+            rc = NC_ERROR;
+            break;
+        }
+    }
+    CHECK_MUTEX_SUCCESS(pthread_mutex_unlock(&g->dev->graph_stream_m));
+    if (rc != NC_OK)
+        return rc;
+
+    g->started = 1;
+    mvLog(MVLOG_DEBUG, "Batched trigger end");
+    return NC_OK;
+}
@@ -0,0 +1,146 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdlib>
+#include <iostream>
+#include <chrono>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "inference_engine.hpp"
+#include "samples/args_helper.hpp"
+#include "statistics_collector.hpp"
+
+using namespace InferenceEngine;
+
+static constexpr char help_message[] = "Optional. Print the usage message.";
+static constexpr char model_message[] = "Required. Path to the XML file of the FP32 network.";
+static constexpr char images_message[] = "Required. Path to a folder with the images or to an image.";
+static constexpr char device_message[] = "Optional. Device the statistics are collected on. Default value: CPU.";
+static constexpr char streams_message[] = "Optional. Number of the streams of the CPU device.\n"
+"                                             Default value: as many as the device finds optimal.";
+static constexpr char subset_message[] = "Optional. Number of the images the statistics are collected on.\n"
+"                                             Default value: 0, all the images.";
+static constexpr char output_message[] = "Optional. Path to the XML file of the network with the statistics.\n"
+"                                             Default value: <model>_statistics.xml.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(m, "", model_message);
+DEFINE_string(i, "", images_message);
+DEFINE_string(d, "CPU", device_message);
+DEFINE_string(nstreams, "", streams_message);
+DEFINE_uint32(subset, 0, subset_message);
+DEFINE_string(o, "", output_message);
+
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "calibration_tool [OPTIONS]" << std::endl;
+    std::cout << "[OPTIONS]:" << std::endl;
+    std::cout << "    -h                                       "   << help_message    << std::endl;
+    std::cout << "    -m                           <value>     "   << model_message   << std::endl;
+    std::cout << "    -i                           <value>     "   << images_message  << std::endl;
+    std::cout << "    -d                           <value>     "   << device_message  << std::endl;
+    std::cout << "    -nstreams                    <value>     "   << streams_message << std::endl;
+    std::cout << "    -subset                      <value>     "   << subset_message  << std::endl;
+    std::cout << "    -o                           <value>     "   << output_message  << std::endl;
+    std::cout << std::endl;
+}
+
+static bool parseCommandLine(int *argc, char ***argv) {
+    gflags::ParseCommandLineNonHelpFlags(argc, argv, true);
+
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_m.empty()) {
+        throw std::invalid_argument("Path to the model file is required (-m option)");
+    }
+    if (FLAGS_i.empty()) {
+        throw std::invalid_argument("Path to the images is required (-i option)");
+    }
+
+    if (1 < *argc) {
+        std::stringstream message;
+        message << "Unknown arguments: ";
+        for (auto arg = 1; arg < *argc; arg++) {
+            message << (*argv)[arg] << " ";
+        }
+        throw std::invalid_argument(message.str());
+    }
+
+    return true;
+}
+
+static std::string getOutputPath(const std::string& modelPath) {
+    if (!FLAGS_o.empty()) {
+        return FLAGS_o;
+    }
+    const auto pos = modelPath.rfind('.');
+    return (pos == std::string::npos ? modelPath : modelPath.substr(0, pos)) + "_statistics.xml";
+}
+
+int main(int argc, char *argv[]) {
+    try {
+        std::cout << "Inference Engine: " << GetInferenceEngineVersion() << std::endl;
+
+        if (!parseCommandLine(&argc, &argv)) {
+            return EXIT_SUCCESS;
+        }
+
+        std::vector<std::string> images;
+        readInputFilesArguments(images, FLAGS_i);
+        if (images.empty()) {
+            throw std::invalid_argument("No images are found in " + FLAGS_i);
+        }
+        if (FLAGS_subset != 0 && FLAGS_subset < images.size()) {
+            images.resize(FLAGS_subset);
+        }
+
+        std::map<std::string, std::string> config;
+        if (FLAGS_d.find("CPU") != std::string::npos) {
+            config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] =
+                FLAGS_nstreams.empty() ? CONFIG_VALUE(CPU_THROUGHPUT_AUTO) : FLAGS_nstreams;
+        }
+
+        Core core;
+        StatisticsCollector collector(core, FLAGS_m, FLAGS_d, config);
+        std::cout << "Collecting the statistics on " << images.size() << " images with "
+                  << collector.getRequestsNumber() << " infer requests" << std::endl;
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        collector.collect(images);
+        const auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "Collected in " << std::chrono::duration<double, std::milli>(end - start).count()
+                  << " ms" << std::endl;
+
+        // The network without the extra outputs gets the statistics, so the serialized one keeps its outputs
+        CNNNetwork network = core.ReadNetwork(FLAGS_m);
+        ICNNNetworkStats* stats = nullptr;
+        ResponseDesc response;
+        if (static_cast<ICNNNetwork&>(network).getStats(&stats, &response) != StatusCode::OK || stats == nullptr) {
+            throw std::runtime_error("The network cannot keep the statistics: " + std::string(response.msg));
+        }
+        stats->setNodesStats(collector.getStatistics());
+
+        const std::string xmlPath = getOutputPath(FLAGS_m);
+        const std::string binPath = xmlPath.substr(0, xmlPath.rfind('.')) + ".bin";
+        network.serialize(xmlPath, binPath);
+        std::cout << "The network with the statistics is written to " << xmlPath << std::endl;
+    } catch (const std::exception &error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "Unknown/internal exception happened." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,235 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "statistics_collector.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <details/caseless.hpp>
+#include <format_reader_ptr.h>
+
+using namespace InferenceEngine;
+
+StatisticsCollector::StatisticsCollector(Core& core, const std::string& modelPath, const std::string& device,
+                                         const std::map<std::string, std::string>& config) {
+    CNNNetwork network = core.ReadNetwork(modelPath);
+
+    InputsDataMap inputs = network.getInputsInfo();
+    if (inputs.size() != 1) {
+        THROW_IE_EXCEPTION << "Only the networks with one image input are supported, the network has "
+                           << inputs.size() << " inputs";
+    }
+    _inputName = inputs.begin()->first;
+    _inputDims = inputs.begin()->second->getTensorDesc().getDims();
+    if (_inputDims.size() != 4) {
+        THROW_IE_EXCEPTION << "The input " << _inputName << " is not an image";
+    }
+    inputs.begin()->second->setPrecision(Precision::U8);
+    inputs.begin()->second->setLayout(Layout::NCHW);
+
+    // The outputs of every layer disable the fusions of the device, so it computes the same values as the FP32 IR
+    for (const auto& layer : network) {
+        if (details::CaselessEq<std::string>()(layer->type, "Input") || details::CaselessEq<std::string>()(layer->type, "Const") ||
+            layer->outData.empty()) {
+            continue;
+        }
+        network.addOutput(layer->name, 0);
+    }
+    for (auto& output : network.getOutputsInfo()) {
+        output.second->setPrecision(Precision::FP32);
+        auto creator = output.second->getCreatorLayer().lock();
+        if (creator) {
+            _outputLayers[output.first] = creator->name;
+        }
+    }
+
+    _executableNetwork = core.LoadNetwork(network, device, config);
+
+    unsigned int requests = 1;
+    try {
+        requests = _executableNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))
+                       .as<unsigned int>();
+    } catch (const details::InferenceEngineException&) {
+        // The devices without the metric infer one request at a time
+    }
+
+    for (unsigned int i = 0; i < std::max(requests, 1u); i++) {
+        std::unique_ptr<RequestContext> context(new RequestContext);
+        context->request = _executableNetwork.CreateInferRequest();
+        RequestContext* contextPtr = context.get();
+        context->request.SetCompletionCallback([this, contextPtr] {
+            onCompletion(*contextPtr);
+        });
+        _contexts.push_back(std::move(context));
+    }
+}
+
+void StatisticsCollector::collect(const std::vector<std::string>& images) {
+    if (images.empty()) {
+        return;
+    }
+
+    _images = &images;
+    _nextImage = 0;
+    for (auto& context : _contexts) {
+        context->error = nullptr;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _running = _contexts.size();
+    }
+    for (auto& context : _contexts) {
+        bool started = false;
+        try {
+            started = startNext(*context);
+        } catch (...) {
+            context->error = std::current_exception();
+        }
+        if (!started) {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _running--;
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _finished.wait(lock, [this] {
+            return _running == 0;
+        });
+    }
+    _images = nullptr;
+
+    for (auto& context : _contexts) {
+        if (context->error) {
+            std::rethrow_exception(context->error);
+        }
+    }
+}
+
+bool StatisticsCollector::startNext(RequestContext& context) {
+    const size_t batch = _inputDims[0];
+    const size_t firstImage = _nextImage.fetch_add(batch);
+    if (firstImage >= _images->size()) {
+        return false;
+    }
+    fillInput(context, firstImage);
+    context.request.StartAsync();
+    return true;
+}
+
+void StatisticsCollector::onCompletion(RequestContext& context) {
+    bool started = false;
+    try {
+        accumulateOutputs(context);
+        started = startNext(context);
+    } catch (...) {
+        context.error = std::current_exception();
+    }
+
+    if (!started) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (--_running == 0) {
+            _finished.notify_one();
+        }
+    }
+}
+
+void StatisticsCollector::fillInput(RequestContext& context, size_t firstImage) {
+    Blob::Ptr input = context.request.GetBlob(_inputName);
+    const size_t batch = _inputDims[0], channels = _inputDims[1];
+    const size_t height = _inputDims[2], width = _inputDims[3];
+    auto* data = input->buffer().as<uint8_t*>();
+
+    ChannelStats& inputStats = getChannelStats(context, _inputName, channels);
+    for (size_t b = 0; b < batch; b++) {
+        // Repeated images do not change the minimums and the maximums
+        const std::string& image = (*_images)[std::min(firstImage + b, _images->size() - 1)];
+        FormatReader::ReaderPtr reader(image.c_str());
+        if (reader.get() == nullptr) {
+            THROW_IE_EXCEPTION << "Image " << image << " cannot be read";
+        }
+        std::shared_ptr<unsigned char> pixels = reader->getData(width, height);
+        if (pixels == nullptr) {
+            THROW_IE_EXCEPTION << "Image " << image << " cannot be resized to " << width << "x" << height;
+        }
+
+        // The reader gives the interleaved pixels, the input is planar
+        for (size_t c = 0; c < channels; c++) {
+            uint8_t* plane = data + (b * channels + c) * height * width;
+            for (size_t i = 0; i < height * width; i++) {
+                plane[i] = pixels.get()[i * channels + c];
+                inputStats.update(c, plane[i]);
+            }
+        }
+    }
+}
+
+void StatisticsCollector::accumulateOutputs(RequestContext& context) {
+    for (const auto& output : _outputLayers) {
+        Blob::Ptr blob = context.request.GetBlob(output.first);
+        const SizeVector& dims = blob->getTensorDesc().getDims();
+        const size_t batch = dims.empty() ? 1 : dims[0];
+        const size_t channels = dims.size() > 1 ? dims[1] : 1;
+        const size_t spatial = dims.size() > 2 ?
+                               std::accumulate(dims.begin() + 2, dims.end(), size_t(1), std::multiplies<size_t>()) : 1;
+        const bool channelsLast = blob->getTensorDesc().getLayout() == Layout::NHWC ||
+                                  blob->getTensorDesc().getLayout() == Layout::NDHWC;
+        const auto* data = blob->cbuffer().as<const float*>();
+
+        ChannelStats& stats = getChannelStats(context, output.second, channels);
+        for (size_t b = 0; b < batch; b++) {
+            const float* item = data + b * channels * spatial;
+            for (size_t c = 0; c < channels; c++) {
+                float channelMin = std::numeric_limits<float>::max();
+                float channelMax = std::numeric_limits<float>::lowest();
+                for (size_t i = 0; i < spatial; i++) {
+                    const float value = channelsLast ? item[i * channels + c] : item[c * spatial + i];
+                    channelMin = std::min(channelMin, value);
+                    channelMax = std::max(channelMax, value);
+                }
+                stats.update(c, channelMin);
+                stats.update(c, channelMax);
+            }
+        }
+    }
+}
+
+StatisticsCollector::ChannelStats& StatisticsCollector::getChannelStats(RequestContext& context,
+                                                                         const std::string& layerName,
+                                                                         size_t channels) {
+    ChannelStats& stats = context.stats[layerName];
+    if (stats.min.size() != channels) {
+        stats.min.assign(channels, std::numeric_limits<float>::max());
+        stats.max.assign(channels, std::numeric_limits<float>::lowest());
+    }
+    return stats;
+}
+
+NetworkStatsMap StatisticsCollector::getStatistics() const {
+    NetworkStatsMap statistics;
+    for (const auto& context : _contexts) {
+        for (const auto& layer : context->stats) {
+            NetworkNodeStatsPtr& nodeStats = statistics[layer.first];
+            if (!nodeStats) {
+                nodeStats = std::make_shared<NetworkNodeStats>();
+                nodeStats->_minOutputs = layer.second.min;
+                nodeStats->_maxOutputs = layer.second.max;
+                continue;
+            }
+            for (size_t c = 0; c < layer.second.min.size(); c++) {
+                nodeStats->_minOutputs[c] = std::min(nodeStats->_minOutputs[c], layer.second.min[c]);
+                nodeStats->_maxOutputs[c] = std::max(nodeStats->_maxOutputs[c], layer.second.max[c]);
+            }
+        }
+    }
+    return statistics;
+}
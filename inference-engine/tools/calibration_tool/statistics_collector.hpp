@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "inference_engine.hpp"
+
+/**
+ * @brief Collects the per-channel minimums and maximums of the outputs of all the layers of an FP32 network,
+ * in the form CNNNetworkInt8Normalizer takes them from ICNNNetworkStats.
+ *
+ * The images are spread over several infer requests running in the streams of the device. Every request
+ * accumulates the statistics of its own in the completion callback and starts the next images from there,
+ * the accumulators of the requests are merged only when the statistics are taken.
+ */
+class StatisticsCollector {
+public:
+    /**
+     * @brief Reads the network, makes the outputs of all the layers the network outputs and loads it to the device
+     * @param core - Inference Engine core the network is loaded with
+     * @param modelPath - path to the XML file of the FP32 network
+     * @param device - device the network is inferred on
+     * @param config - configuration of the device, e.g. the number of the streams
+     */
+    StatisticsCollector(InferenceEngine::Core& core, const std::string& modelPath, const std::string& device,
+                        const std::map<std::string, std::string>& config);
+
+    /**
+     * @brief Infers the images, the statistics accumulate over the calls
+     * @param images - paths to the images, the last batch is completed with the repeated last image
+     */
+    void collect(const std::vector<std::string>& images);
+
+    /**
+     * @brief Merges the statistics accumulated by the infer requests
+     * @return The minimums and maximums of every channel of the outputs by the layer names
+     */
+    InferenceEngine::NetworkStatsMap getStatistics() const;
+
+    size_t getRequestsNumber() const {
+        return _contexts.size();
+    }
+
+private:
+    struct ChannelStats {
+        std::vector<float> min;
+        std::vector<float> max;
+
+        void update(size_t channel, float value) {
+            min[channel] = std::min(min[channel], value);
+            max[channel] = std::max(max[channel], value);
+        }
+    };
+
+    struct RequestContext {
+        InferenceEngine::InferRequest request;
+        std::map<std::string, ChannelStats> stats;
+        std::exception_ptr error;
+    };
+
+    bool startNext(RequestContext& context);
+
+    void fillInput(RequestContext& context, size_t firstImage);
+
+    void accumulateOutputs(RequestContext& context);
+
+    void onCompletion(RequestContext& context);
+
+    static ChannelStats& getChannelStats(RequestContext& context, const std::string& layerName, size_t channels);
+
+    InferenceEngine::ExecutableNetwork _executableNetwork;
+    std::string _inputName;
+    InferenceEngine::SizeVector _inputDims;
+    // The names of the network outputs and the layers producing them
+    std::map<std::string, std::string> _outputLayers;
+    std::vector<std::unique_ptr<RequestContext>> _contexts;
+
+    const std::vector<std::string>* _images = nullptr;
+    std::atomic<size_t> _nextImage {0};
+    size_t _running = 0;
+    std::mutex _mutex;
+    std::condition_variable _finished;
+};
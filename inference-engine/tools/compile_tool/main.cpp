@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstdio>
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
@@ -18,6 +19,7 @@
 #include <vpu/utils/string.hpp>
 #include "samples/common.hpp"
 #include <dlia/dlia_config.hpp>
+#include <cldnn/cldnn_config.hpp>
 
 static constexpr char help_message[] = "Optional. Print the usage message.";
 static constexpr char model_message[] = "Required. Path to the XML model.";
@@ -50,6 +52,10 @@ static constexpr char iop_message[] = "Optional. Specifies precision for input a
 "                                             Notice that quotes are required.\n"
 "                                             Overwrites precision from ip and op options for specified layers.";
 
+static constexpr char kernels_cache_dir_message[] = "Optional. Path to the directory the compiled OpenCL kernels are stored to,"
+                                                    " so the network is loaded faster\n"
+"                                             with the same CLDNN_KERNELS_CACHE_DIR. Applies to GPU only.";
+
 static constexpr char dla_arch_name[] = "Optional. Specify architecture name used to compile executable network for FPGA device.";
 
 DEFINE_bool(h, false, help_message);
@@ -64,6 +70,7 @@ DEFINE_string(VPU_MYRIAD_PLATFORM, "", platform_message);
 DEFINE_string(VPU_NUMBER_OF_SHAVES, "", number_of_shaves_message);
 DEFINE_string(VPU_NUMBER_OF_CMX_SLICES, "", number_of_cmx_slices_message);
 DEFINE_string(DLA_ARCH_NAME, "", dla_arch_name);
+DEFINE_string(GPU_KERNELS_CACHE_DIR, "", kernels_cache_dir_message);
 
 static void showUsage() {
     std::cout << std::endl;
@@ -82,6 +89,8 @@ static void showUsage() {
     std::cout << "      -VPU_MYRIAD_PLATFORM       <value>     "   << platform_message             << std::endl;
     std::cout << "      -VPU_NUMBER_OF_SHAVES      <value>     "   << number_of_shaves_message     << std::endl;
     std::cout << "      -VPU_NUMBER_OF_CMX_SLICES  <value>     "   << number_of_cmx_slices_message << std::endl;
+    std::cout << "    GPU options:                             "                                   << std::endl;
+    std::cout << "      -GPU_KERNELS_CACHE_DIR     <value>     "   << kernels_cache_dir_message    << std::endl;
     std::cout << "    DLA options:                             "                                   << std::endl;
     std::cout << "      -DLA_ARCH_NAME             <value>     "   << dla_arch_name                << std::endl;
     std::cout << std::endl;
@@ -159,6 +168,10 @@ static std::map<std::string, std::string> configure(const std::string &configFil
         config[DLIA_CONFIG_KEY(ARCH_NAME)] = FLAGS_DLA_ARCH_NAME;
     }
 
+    if (!FLAGS_GPU_KERNELS_CACHE_DIR.empty()) {
+        config[CLDNN_CONFIG_KEY(KERNELS_CACHE_DIR)] = FLAGS_GPU_KERNELS_CACHE_DIR;
+    }
+
     return config;
 }
 
@@ -345,8 +358,20 @@ int main(int argc, char *argv[]) {
         if (outputName.empty()) {
             outputName = getFileNameFromPath(fileNameNoExt(FLAGS_m)) + ".blob";
         }
-        std::ofstream outputFile{outputName};
-        executableNetwork.Export(outputFile);
+        std::ofstream outputFile{outputName, std::ios::out | std::ios::binary};
+        try {
+            executableNetwork.Export(outputFile);
+        } catch (const InferenceEngine::details::InferenceEngineException& error) {
+            // the kernels are already compiled to the cache by the network loading
+            if (FLAGS_GPU_KERNELS_CACHE_DIR.empty() ||
+                std::string::npos == std::string{error.what()}.find("[NOT_IMPLEMENTED]")) {
+                throw;
+            }
+            outputFile.close();
+            std::remove(outputName.c_str());
+            std::cout << FLAGS_d << " does not export networks, the compiled kernels are stored to "
+                      << FLAGS_GPU_KERNELS_CACHE_DIR << std::endl;
+        }
     } catch (const std::exception &error) {
         std::cerr << error.what() << std::endl;
         return EXIT_FAILURE;
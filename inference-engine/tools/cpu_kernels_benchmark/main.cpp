@@ -0,0 +1,470 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <vector>
+#include <string>
+
+#include <gflags/gflags.h>
+
+#include "inference_engine.hpp"
+#include "ie_builders.hpp"
+#include "cpu/cpu_config.hpp"
+#include "cpu_detector.hpp"
+
+using namespace InferenceEngine;
+
+static constexpr char help_message[] = "Optional. Print the usage message.";
+static constexpr char niter_message[] = "Optional. Number of measured inferences of every case. Default value: 100.";
+static constexpr char batch_message[] = "Optional. Comma-separated list of batch sizes the cases are run for. Default value: \"1\".";
+static constexpr char precisions_message[] = "Optional. Comma-separated list of precisions the cases are run in: FP32, BF16.\n"
+"                                             BF16 runs only on the CPUs with AVX-512 BF16. Default value: \"FP32\".";
+static constexpr char filter_message[] = "Optional. Run only the cases which names contain the value, e.g. \"conv\".";
+static constexpr char report_message[] = "Optional. Path to a CSV file the results are appended to, so the runs of different\n"
+"                                             builds can be compared.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_uint32(niter, 100, niter_message);
+DEFINE_string(b, "1", batch_message);
+DEFINE_string(precisions, "FP32", precisions_message);
+DEFINE_string(filter, "", filter_message);
+DEFINE_string(report, "", report_message);
+
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "cpu_kernels_benchmark [OPTIONS]" << std::endl;
+    std::cout << "[OPTIONS]:" << std::endl;
+    std::cout << "    -h                                       "   << help_message       << std::endl;
+    std::cout << "    -niter                       <value>     "   << niter_message      << std::endl;
+    std::cout << "    -b                           <value>     "   << batch_message      << std::endl;
+    std::cout << "    -precisions                  <value>     "   << precisions_message << std::endl;
+    std::cout << "    -filter                      <value>     "   << filter_message     << std::endl;
+    std::cout << "    -report                      <value>     "   << report_message     << std::endl;
+    std::cout << std::endl;
+}
+
+static std::vector<std::string> split(const std::string& value) {
+    std::vector<std::string> items;
+    std::stringstream stream(value);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        items.push_back(item);
+    }
+    return items;
+}
+
+static bool parseCommandLine(int *argc, char ***argv) {
+    gflags::ParseCommandLineNonHelpFlags(argc, argv, true);
+
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_niter == 0) {
+        throw std::invalid_argument("Number of iterations must be positive");
+    }
+
+    for (const auto& precision : split(FLAGS_precisions)) {
+        if (precision != "FP32" && precision != "BF16") {
+            throw std::invalid_argument("Unsupported precision " + precision + ", expected FP32 or BF16");
+        }
+    }
+
+    if (1 < *argc) {
+        std::stringstream message;
+        message << "Unknown arguments: ";
+        for (auto arg = 1; arg < *argc; arg++) {
+            message << (*argv)[arg] << " ";
+        }
+        throw std::invalid_argument(message.str());
+    }
+
+    return true;
+}
+
+static Blob::Ptr makeRandomBlob(const SizeVector& dims, Layout layout) {
+    auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, layout));
+    blob->allocate();
+
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    auto data = blob->buffer().as<float*>();
+    for (size_t i = 0; i < blob->size(); i++) {
+        data[i] = dist(gen);
+    }
+    return blob;
+}
+
+//  A single-layer network and the work its layer does per inference
+struct Case {
+    std::string name;
+    std::string shape;
+    std::string layer;
+    std::function<CNNNetwork(const Core& ie, size_t batch)> build;
+    // multiply-adds count as 2 operations; 0 for the layers which are measured by the bandwidth only
+    std::function<double(size_t batch)> flops;
+    // bytes of the inputs, weights and outputs in FP32
+    std::function<double(size_t batch)> bytes;
+};
+
+static CNNNetwork toCNNNetwork(Builder::Network& network) {
+    return CNNNetwork(Builder::convertToICNNNetwork(network.build()));
+}
+
+struct ConvShape {
+    size_t ic, oc, h, w, kernel, stride, group;
+};
+
+static std::string convShapeName(const ConvShape& s) {
+    return std::to_string(s.ic) + "x" + std::to_string(s.h) + "x" + std::to_string(s.w) + " -> " + std::to_string(s.oc) +
+           " k" + std::to_string(s.kernel) + " s" + std::to_string(s.stride) + (s.group > 1 ? " g" + std::to_string(s.group) : "");
+}
+
+static Case convolutionCase(const ConvShape& s) {
+    const size_t pad = s.kernel / 2;
+    const size_t oh = (s.h + 2 * pad - s.kernel) / s.stride + 1;
+    const size_t ow = (s.w + 2 * pad - s.kernel) / s.stride + 1;
+    const double weights = static_cast<double>(s.oc) * s.ic / s.group * s.kernel * s.kernel;
+
+    Case c;
+    c.name = s.group == s.ic && s.group == s.oc ? "conv_depthwise" : "conv";
+    c.shape = convShapeName(s);
+    c.layer = "conv";
+    c.build = [s, pad](const Core&, size_t batch) {
+        Builder::Network network("conv");
+        auto in = network.addLayer(Builder::InputLayer("in").setPort(Port({batch, s.ic, s.h, s.w})));
+        auto w = network.addLayer(Builder::ConstLayer("weights").setData(
+            makeRandomBlob({s.oc, s.ic / s.group, s.kernel, s.kernel}, Layout::OIHW)));
+        auto b = network.addLayer(Builder::ConstLayer("biases").setData(makeRandomBlob({s.oc}, Layout::C)));
+        auto conv = network.addLayer({{in}, {w}, {b}}, Builder::ConvolutionLayer("conv")
+            .setKernel({s.kernel, s.kernel}).setStrides({s.stride, s.stride})
+            .setPaddingsBegin({pad, pad}).setPaddingsEnd({pad, pad}).setGroup(s.group).setOutDepth(s.oc));
+        network.addLayer({{conv}}, Builder::OutputLayer("out"));
+        return toCNNNetwork(network);
+    };
+    c.flops = [oh, ow, weights](size_t batch) { return 2.0 * batch * oh * ow * weights; };
+    c.bytes = [s, oh, ow, weights](size_t batch) {
+        return 4.0 * (batch * (static_cast<double>(s.ic) * s.h * s.w + static_cast<double>(s.oc) * oh * ow) + weights);
+    };
+    return c;
+}
+
+static Case fullyConnectedCase(size_t ic, size_t oc) {
+    Case c;
+    c.name = "fc";
+    c.shape = std::to_string(ic) + " -> " + std::to_string(oc);
+    c.layer = "fc";
+    c.build = [ic, oc](const Core&, size_t batch) {
+        Builder::Network network("fc");
+        auto in = network.addLayer(Builder::InputLayer("in").setPort(Port({batch, ic})));
+        auto w = network.addLayer(Builder::ConstLayer("weights").setData(makeRandomBlob({oc, ic}, Layout::NC)));
+        auto b = network.addLayer(Builder::ConstLayer("biases").setData(makeRandomBlob({oc}, Layout::C)));
+        auto fc = network.addLayer({{in}, {w}, {b}}, Builder::FullyConnectedLayer("fc").setOutputNum(oc));
+        network.addLayer({{fc}}, Builder::OutputLayer("out"));
+        return toCNNNetwork(network);
+    };
+    c.flops = [ic, oc](size_t batch) { return 2.0 * batch * ic * oc; };
+    c.bytes = [ic, oc](size_t batch) { return 4.0 * (batch * static_cast<double>(ic + oc) + static_cast<double>(ic) * oc); };
+    return c;
+}
+
+static Case poolingCase(const std::string& name, Builder::PoolingLayer::PoolingType type,
+                        size_t channels, size_t size, size_t kernel, size_t stride) {
+    const size_t out = (size - kernel) / stride + 1;
+
+    Case c;
+    c.name = name;
+    c.shape = std::to_string(channels) + "x" + std::to_string(size) + "x" + std::to_string(size) +
+              " k" + std::to_string(kernel) + " s" + std::to_string(stride);
+    c.layer = "pool";
+    c.build = [type, channels, size, kernel, stride](const Core&, size_t batch) {
+        Builder::Network network("pool");
+        auto in = network.addLayer(Builder::InputLayer("in").setPort(Port({batch, channels, size, size})));
+        auto pool = network.addLayer({{in}}, Builder::PoolingLayer("pool").setPoolingType(type)
+            .setKernel({kernel, kernel}).setStrides({stride, stride})
+            .setPaddingsBegin({0, 0}).setPaddingsEnd({0, 0}).setExcludePad(true));
+        network.addLayer({{pool}}, Builder::OutputLayer("out"));
+        return toCNNNetwork(network);
+    };
+    c.flops = [](size_t) { return 0.0; };
+    c.bytes = [channels, size, out](size_t batch) { return 4.0 * batch * channels * (size * size + out * out); };
+    return c;
+}
+
+static Case eltwiseCase(size_t channels, size_t size) {
+    Case c;
+    c.name = "eltwise_sum";
+    c.shape = std::to_string(channels) + "x" + std::to_string(size) + "x" + std::to_string(size);
+    c.layer = "eltwise";
+    c.build = [channels, size](const Core&, size_t batch) {
+        Builder::Network network("eltwise");
+        auto in0 = network.addLayer(Builder::InputLayer("in0").setPort(Port({batch, channels, size, size})));
+        auto in1 = network.addLayer(Builder::InputLayer("in1").setPort(Port({batch, channels, size, size})));
+        auto sum = network.addLayer({{in0}, {in1}}, Builder::EltwiseLayer("eltwise")
+            .setEltwiseType(Builder::EltwiseLayer::SUM));
+        network.addLayer({{sum}}, Builder::OutputLayer("out"));
+        return toCNNNetwork(network);
+    };
+    c.flops = [](size_t) { return 0.0; };
+    c.bytes = [channels, size](size_t batch) { return 3 * 4.0 * batch * channels * size * size; };
+    return c;
+}
+
+static Case reluCase(size_t channels, size_t size) {
+    Case c;
+    c.name = "relu";
+    c.shape = std::to_string(channels) + "x" + std::to_string(size) + "x" + std::to_string(size);
+    c.layer = "relu";
+    c.build = [channels, size](const Core&, size_t batch) {
+        Builder::Network network("relu");
+        auto in = network.addLayer(Builder::InputLayer("in").setPort(Port({batch, channels, size, size})));
+        auto relu = network.addLayer({{in}}, Builder::ReLULayer("relu"));
+        network.addLayer({{relu}}, Builder::OutputLayer("out"));
+        return toCNNNetwork(network);
+    };
+    c.flops = [](size_t) { return 0.0; };
+    c.bytes = [channels, size](size_t batch) { return 2 * 4.0 * batch * channels * size * size; };
+    return c;
+}
+
+static Case softmaxCase(size_t classes) {
+    Case c;
+    c.name = "softmax";
+    c.shape = std::to_string(classes);
+    c.layer = "softmax";
+    c.build = [classes](const Core&, size_t batch) {
+        Builder::Network network("softmax");
+        auto in = network.addLayer(Builder::InputLayer("in").setPort(Port({batch, classes})));
+        auto softmax = network.addLayer({{in}}, Builder::SoftMaxLayer("softmax").setAxis(1));
+        network.addLayer({{softmax}}, Builder::OutputLayer("out"));
+        return toCNNNetwork(network);
+    };
+    c.flops = [](size_t) { return 0.0; };
+    c.bytes = [classes](size_t batch) { return 2 * 4.0 * batch * classes; };
+    return c;
+}
+
+static std::string dimsXml(const SizeVector& dims) {
+    std::string xml;
+    for (const auto dim : dims) {
+        xml += "<dim>" + std::to_string(dim) + "</dim>";
+    }
+    return xml;
+}
+
+//  There is no builder of TopK, so its network is read from an IR with k in a constant input
+static Case topKCase(size_t axisSize, size_t inner, size_t k) {
+    // the kernel keeps a heap of the best k elements of the last axes at least this many times longer than k
+    const size_t heapMinRatio = 16;
+
+    Case c;
+    c.name = inner > 1 ? "topk_axis" : axisSize >= k * heapMinRatio ? "topk_heap" : "topk_sort";
+    c.shape = std::to_string(axisSize) + (inner > 1 ? "x" + std::to_string(inner) : "") + " k" + std::to_string(k);
+    c.layer = "topk";
+    c.build = [axisSize, inner, k](const Core& ie, size_t batch) {
+        SizeVector inDims = {batch, axisSize};
+        SizeVector outDims = {batch, k};
+        if (inner > 1) {
+            inDims.push_back(inner);
+            outDims.push_back(inner);
+        }
+        const std::string model = R"V0G0N(
+<net name="topk" version="7" batch="1">
+    <layers>
+        <layer id="0" name="in" type="Input" precision="FP32">
+            <output><port id="0">)V0G0N" + dimsXml(inDims) + R"V0G0N(</port></output>
+        </layer>
+        <layer id="1" name="k" type="Const" precision="I32">
+            <output><port id="0"><dim>1</dim></port></output>
+            <blobs><custom offset="0" size="4"/></blobs>
+        </layer>
+        <layer id="2" name="topk" type="TopK" precision="FP32">
+            <data axis="1" mode="max" sort="value"/>
+            <input>
+                <port id="0">)V0G0N" + dimsXml(inDims) + R"V0G0N(</port>
+                <port id="1"><dim>1</dim></port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">)V0G0N" + dimsXml(outDims) + R"V0G0N(</port>
+                <port id="3" precision="I32">)V0G0N" + dimsXml(outDims) + R"V0G0N(</port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+        auto weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {sizeof(int32_t)}, Layout::C));
+        weights->allocate();
+        weights->buffer().as<int32_t*>()[0] = static_cast<int32_t>(k);
+        return ie.ReadNetwork(model, weights);
+    };
+    c.flops = [](size_t) { return 0.0; };
+    // the values and the indices of the selected elements are written
+    c.bytes = [axisSize, inner, k](size_t batch) { return 4.0 * batch * inner * (axisSize + 2 * k); };
+    return c;
+}
+
+//  The shapes are taken from the common classification and detection topologies
+static std::vector<Case> makeCases() {
+    std::vector<Case> cases;
+    for (const auto& shape : std::vector<ConvShape>{
+             {3, 64, 224, 224, 7, 2, 1},
+             {64, 64, 56, 56, 3, 1, 1},
+             {64, 256, 56, 56, 1, 1, 1},
+             {128, 128, 28, 28, 3, 1, 1},
+             {256, 1024, 14, 14, 1, 1, 1},
+             {512, 512, 7, 7, 3, 1, 1},
+             {32, 32, 112, 112, 3, 1, 32},
+             {512, 512, 14, 14, 3, 1, 512}}) {
+        cases.push_back(convolutionCase(shape));
+    }
+    cases.push_back(fullyConnectedCase(2048, 1000));
+    cases.push_back(fullyConnectedCase(4096, 4096));
+    cases.push_back(poolingCase("pool_max", Builder::PoolingLayer::MAX, 64, 112, 3, 2));
+    cases.push_back(poolingCase("pool_avg_global", Builder::PoolingLayer::AVG, 2048, 7, 7, 1));
+    cases.push_back(eltwiseCase(256, 56));
+    cases.push_back(reluCase(256, 56));
+    cases.push_back(softmaxCase(1000));
+    // the heap and the sorting paths of TopK at the ratios of the axis to k around the bound between them,
+    // from the vocabularies of the language models to the detection classes
+    for (const auto& shape : std::vector<std::pair<size_t, size_t>>{
+             {50257, 1}, {32000, 10}, {32000, 100}, {1000, 10}, {1000, 50}, {1000, 100}, {256, 32}}) {
+        cases.push_back(topKCase(shape.first, 1, shape.second));
+    }
+    cases.push_back(topKCase(1000, 64, 10));
+    return cases;
+}
+
+struct Result {
+    std::string execType;
+    double avgUs;
+};
+
+static Result runCase(Core& ie, const Case& c, size_t batch, const std::string& precision) {
+    CNNNetwork network = c.build(ie, batch);
+
+    std::map<std::string, std::string> config = {{CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(YES)}};
+    if (precision == "BF16") {
+        config[CPU_CONFIG_KEY(ENFORCE_BF16)] = CONFIG_VALUE(YES);
+    }
+    auto executableNetwork = ie.LoadNetwork(network, "CPU", config);
+    auto request = executableNetwork.CreateInferRequest();
+    for (const auto& input : network.getInputsInfo()) {
+        const auto& dims = input.second->getTensorDesc().getDims();
+        request.SetBlob(input.first, makeRandomBlob(dims, input.second->getTensorDesc().getLayout()));
+    }
+
+    // the first inference creates the primitives and reorders the weights, so it is not measured...
+    request.Infer();
+    // ...but the layer counters are averaged over all the inferences, so they are taken as a difference
+    const auto warmup = request.GetPerformanceCounts();
+    for (uint32_t i = 0; i < FLAGS_niter; i++) {
+        request.Infer();
+    }
+    const auto counters = request.GetPerformanceCounts();
+
+    const auto counter = counters.find(c.layer);
+    if (counter == counters.end()) {
+        THROW_IE_EXCEPTION << "No performance counter of layer " << c.layer;
+    }
+    const double warmupUs = static_cast<double>(warmup.at(c.layer).realTime_uSec);
+    const double avgUs = static_cast<double>(counter->second.realTime_uSec);
+    return {counter->second.exec_type, ((FLAGS_niter + 1) * avgUs - warmupUs) / FLAGS_niter};
+}
+
+static std::string cpuISA() {
+    if (with_cpu_x86_avx512_core()) return "avx512";
+    if (with_cpu_x86_avx2()) return "avx2";
+    if (with_cpu_x86_sse42()) return "sse42";
+    return "ref";
+}
+
+int main(int argc, char *argv[]) {
+    try {
+        const Version* version = GetInferenceEngineVersion();
+        std::cout << "Inference Engine: " << version->apiVersion.major << "." << version->apiVersion.minor
+                  << ", build " << version->buildNumber << std::endl;
+
+        if (!parseCommandLine(&argc, &argv)) {
+            return EXIT_SUCCESS;
+        }
+
+        std::vector<size_t> batches;
+        for (const auto& batch : split(FLAGS_b)) {
+            batches.push_back(std::stoul(batch));
+            if (batches.back() == 0) {
+                throw std::invalid_argument("Batch size must be positive");
+            }
+        }
+
+        std::ofstream report;
+        if (!FLAGS_report.empty()) {
+            const bool exists = std::ifstream(FLAGS_report).good();
+            report.open(FLAGS_report, std::ios::app);
+            if (!report.is_open()) {
+                throw std::runtime_error("Cannot open the report file " + FLAGS_report);
+            }
+            if (!exists) {
+                report << "date,build,cpu_isa,case,shape,batch,precision,exec_type,avg_us,gflops,gbps" << std::endl;
+            }
+        }
+        char date[32];
+        const std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", std::localtime(&now));
+
+        Core ie;
+        std::cout << "CPU ISA: " << cpuISA() << std::endl;
+        std::cout << std::left << std::setw(18) << "case" << std::setw(28) << "shape" << std::setw(7) << "batch"
+                  << std::setw(6) << "prec" << std::setw(22) << "exec type"
+                  << std::right << std::setw(12) << "avg, us" << std::setw(10) << "GFLOPS" << std::setw(10) << "GB/s"
+                  << std::endl;
+
+        for (const auto& c : makeCases()) {
+            if (!FLAGS_filter.empty() && c.name.find(FLAGS_filter) == std::string::npos) {
+                continue;
+            }
+            for (const auto batch : batches) {
+                for (const auto& precision : split(FLAGS_precisions)) {
+                    const auto result = runCase(ie, c, batch, precision);
+                    const double gflops = result.avgUs > 0 ? c.flops(batch) / result.avgUs / 1000.0 : 0.0;
+                    const double gbps = result.avgUs > 0 ? c.bytes(batch) / result.avgUs / 1000.0 : 0.0;
+
+                    std::cout << std::left << std::setw(18) << c.name << std::setw(28) << c.shape << std::setw(7) << batch
+                              << std::setw(6) << precision << std::setw(22) << result.execType
+                              << std::right << std::fixed << std::setprecision(1)
+                              << std::setw(12) << result.avgUs << std::setw(10) << gflops << std::setw(10) << gbps
+                              << std::endl;
+                    if (report.is_open()) {
+                        report << date << "," << version->buildNumber << "," << cpuISA() << "," << c.name << ","
+                               << c.shape << "," << batch << "," << precision << "," << result.execType << ","
+                               << result.avgUs << "," << gflops << "," << gbps << std::endl;
+                    }
+                }
+            }
+        }
+    } catch (const std::exception &error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "Unknown/internal exception happened." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,278 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <map>
+#include <random>
+#include <sstream>
+#include <vector>
+#include <string>
+
+#include <gflags/gflags.h>
+
+#include "inference_engine.hpp"
+#include "ie_compound_blob.h"
+#include "blob_transform.hpp"
+#include "cpu_detector.hpp"
+#include "ie_preprocess_data.hpp"
+
+using namespace InferenceEngine;
+
+static constexpr char help_message[] = "Optional. Print the usage message.";
+static constexpr char niter_message[] = "Optional. Number of measured iterations of every case. Default value: 100.";
+static constexpr char resolutions_message[] = "Optional. Comma-separated list of input resolutions the cases are run for.\n"
+"                                             Default value: \"640x480,1280x720,1920x1080\".";
+static constexpr char output_size_message[] = "Optional. Output resolution of the resize cases. Default value: \"224x224\".";
+static constexpr char serial_message[] = "Optional. Run pre-processing in the calling thread only.";
+static constexpr char filter_message[] = "Optional. Run only the cases which names contain the value, e.g. \"resize\".";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_uint32(niter, 100, niter_message);
+DEFINE_string(res, "640x480,1280x720,1920x1080", resolutions_message);
+DEFINE_string(out, "224x224", output_size_message);
+DEFINE_bool(serial, false, serial_message);
+DEFINE_string(filter, "", filter_message);
+
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "preprocessing_benchmark [OPTIONS]" << std::endl;
+    std::cout << "[OPTIONS]:" << std::endl;
+    std::cout << "    -h                                       "   << help_message        << std::endl;
+    std::cout << "    -niter                       <value>     "   << niter_message       << std::endl;
+    std::cout << "    -res                         <value>     "   << resolutions_message << std::endl;
+    std::cout << "    -out                         <value>     "   << output_size_message << std::endl;
+    std::cout << "    -serial                                  "   << serial_message      << std::endl;
+    std::cout << "    -filter                      <value>     "   << filter_message      << std::endl;
+    std::cout << std::endl;
+}
+
+struct Resolution {
+    size_t width;
+    size_t height;
+};
+
+static Resolution parseResolution(const std::string& value) {
+    const auto pos = value.find('x');
+    if (pos == std::string::npos) {
+        throw std::invalid_argument("Resolution must be set as <width>x<height>, got \"" + value + "\"");
+    }
+    const Resolution res = {std::stoul(value.substr(0, pos)), std::stoul(value.substr(pos + 1))};
+    if (res.width == 0 || res.height == 0) {
+        throw std::invalid_argument("Resolution must not be empty, got \"" + value + "\"");
+    }
+    return res;
+}
+
+static std::vector<Resolution> parseResolutions(const std::string& value) {
+    std::vector<Resolution> resolutions;
+    std::stringstream stream(value);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        resolutions.push_back(parseResolution(item));
+    }
+    return resolutions;
+}
+
+static bool parseCommandLine(int *argc, char ***argv) {
+    gflags::ParseCommandLineNonHelpFlags(argc, argv, true);
+
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_niter == 0) {
+        throw std::invalid_argument("Number of iterations must be positive");
+    }
+
+    if (1 < *argc) {
+        std::stringstream message;
+        message << "Unknown arguments: ";
+        for (auto arg = 1; arg < *argc; arg++) {
+            message << (*argv)[arg] << " ";
+        }
+        throw std::invalid_argument(message.str());
+    }
+
+    return true;
+}
+
+template <typename T>
+static Blob::Ptr makeRandomBlob(const TensorDesc& desc) {
+    auto blob = make_shared_blob<T>(desc);
+    blob->allocate();
+
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<int> dist(0, 255);
+    auto data = blob->buffer().template as<T*>();
+    for (size_t i = 0; i < blob->size(); i++) {
+        data[i] = static_cast<T>(dist(gen));
+    }
+    return blob;
+}
+
+static Blob::Ptr makeBlob(Precision precision, const SizeVector& dims, Layout layout) {
+    const TensorDesc desc(precision, dims, layout);
+    switch (precision) {
+    case Precision::U8:   return makeRandomBlob<uint8_t>(desc);
+    case Precision::FP32: return makeRandomBlob<float>(desc);
+    default: THROW_IE_EXCEPTION << "Unsupported precision " << precision;
+    }
+}
+
+//  A benchmarked kernel; the ISA is known after the first run for the pre-processing cases
+struct Case {
+    std::string name;
+    std::string size;
+    std::function<void()> run;
+    std::function<std::string()> isa;
+};
+
+//  Mirrors the dispatch of the 3-channel row kernels in blob_transform.cpp
+static std::string blobCopyISA(bool haveSSE) {
+    if (with_cpu_x86_avx512_core()) return "avx512";
+    if (with_cpu_x86_avx2()) return "avx2";
+    if (haveSSE && with_cpu_x86_sse42()) return "sse42";
+    return "ref";
+}
+
+static std::string sizeName(const Resolution& in, const Resolution& out) {
+    return std::to_string(in.width) + "x" + std::to_string(in.height) + " -> " +
+           std::to_string(out.width) + "x" + std::to_string(out.height);
+}
+
+static Case preprocessingCase(const std::string& name, const Blob::Ptr& src, Blob::Ptr dst,
+                              const PreProcessInfo& info, const Resolution& in, const Resolution& out) {
+    // every case gets own pre-processing data, so the compiled graphs are not shared between cases
+    auto preproc = std::make_shared<PreProcessDataPtr>(CreatePreprocDataHelper());
+    (*preproc)->setRoiBlob(src);
+
+    Case c;
+    c.name = name;
+    c.size = sizeName(in, out);
+    c.run = [preproc, dst, info]() mutable {
+        (*preproc)->execute(dst, info, FLAGS_serial);
+    };
+    c.isa = [preproc]() {
+        std::map<std::string, InferenceEngineProfileInfo> perfMap;
+        (*preproc)->getPerformanceCounts("input", perfMap);
+        const auto counter = perfMap.find("input_preprocessing");
+        return counter == perfMap.end() ? std::string("n/a") : std::string(counter->second.exec_type);
+    };
+    return c;
+}
+
+static Case blobCopyCase(const std::string& name, const Blob::Ptr& src, const Blob::Ptr& dst,
+                         const Resolution& in, bool haveSSE) {
+    Case c;
+    c.name = name;
+    c.size = sizeName(in, in);
+    c.run = [src, dst]() { blob_copy(src, dst); };
+    c.isa = [haveSSE]() { return blobCopyISA(haveSSE); };
+    return c;
+}
+
+static std::vector<Case> makeCases(const Resolution& in, const Resolution& out) {
+    const SizeVector inDims = {1, 3, in.height, in.width};
+    const SizeVector outDims = {1, 3, out.height, out.width};
+
+    std::vector<Case> cases;
+
+    for (const auto& algorithm : std::vector<std::pair<std::string, ResizeAlgorithm>>{
+             {"bilinear", RESIZE_BILINEAR}, {"area", RESIZE_AREA}, {"nearest", RESIZE_NEAREST}}) {
+        PreProcessInfo info;
+        info.setResizeAlgorithm(algorithm.second);
+        cases.push_back(preprocessingCase("resize_" + algorithm.first + "_u8_nhwc_to_nchw",
+                                          makeBlob(Precision::U8, inDims, NHWC),
+                                          makeBlob(Precision::U8, outDims, NCHW), info, in, out));
+    }
+
+    {
+        PreProcessInfo info;
+        info.setResizeAlgorithm(RESIZE_BILINEAR);
+        cases.push_back(preprocessingCase("resize_bilinear_u8_nhwc_to_fp32_nchw",
+                                          makeBlob(Precision::U8, inDims, NHWC),
+                                          makeBlob(Precision::FP32, outDims, NCHW), info, in, out));
+    }
+
+    {
+        // NV12 planes need even dimensions
+        const size_t width = in.width & ~static_cast<size_t>(1), height = in.height & ~static_cast<size_t>(1);
+        auto y = makeBlob(Precision::U8, {1, 1, height, width}, NHWC);
+        auto uv = makeBlob(Precision::U8, {1, 2, height / 2, width / 2}, NHWC);
+        auto nv12 = make_shared_blob<NV12Blob>(y, uv);
+        PreProcessInfo info;
+        info.setColorFormat(ColorFormat::NV12);
+        cases.push_back(preprocessingCase("color_convert_nv12_to_bgr", nv12,
+                                          makeBlob(Precision::U8, {1, 3, height, width}, NCHW), info,
+                                          {width, height}, {width, height}));
+    }
+
+    cases.push_back(blobCopyCase("split_u8c3", makeBlob(Precision::U8, inDims, NHWC),
+                                 makeBlob(Precision::U8, inDims, NCHW), in, true));
+    cases.push_back(blobCopyCase("merge_u8c3", makeBlob(Precision::U8, inDims, NCHW),
+                                 makeBlob(Precision::U8, inDims, NHWC), in, true));
+    cases.push_back(blobCopyCase("split_f32c3", makeBlob(Precision::FP32, inDims, NHWC),
+                                 makeBlob(Precision::FP32, inDims, NCHW), in, true));
+    cases.push_back(blobCopyCase("layout_copy_u8_nhwc_to_fp32_nchw", makeBlob(Precision::U8, inDims, NHWC),
+                                 makeBlob(Precision::FP32, inDims, NCHW), in, false));
+
+    return cases;
+}
+
+int main(int argc, char *argv[]) {
+    try {
+        std::cout << "Inference Engine: " << GetInferenceEngineVersion() << std::endl;
+
+        if (!parseCommandLine(&argc, &argv)) {
+            return EXIT_SUCCESS;
+        }
+
+        const auto resolutions = parseResolutions(FLAGS_res);
+        const auto outResolution = parseResolution(FLAGS_out);
+
+        std::cout << std::left << std::setw(40) << "case" << std::setw(28) << "size" << std::setw(14) << "isa"
+                  << std::right << std::setw(12) << "avg, ms" << std::setw(12) << "min, ms" << std::endl;
+
+        for (const auto& resolution : resolutions) {
+            for (auto& c : makeCases(resolution, outResolution)) {
+                if (!FLAGS_filter.empty() && c.name.find(FLAGS_filter) == std::string::npos) {
+                    continue;
+                }
+
+                // the first call compiles the pre-processing graph, so it is not measured
+                c.run();
+
+                double total = 0.0, best = std::numeric_limits<double>::max();
+                for (uint32_t i = 0; i < FLAGS_niter; i++) {
+                    const auto start = std::chrono::high_resolution_clock::now();
+                    c.run();
+                    const auto end = std::chrono::high_resolution_clock::now();
+
+                    const double time = std::chrono::duration<double, std::milli>(end - start).count();
+                    total += time;
+                    best = std::min(best, time);
+                }
+
+                std::cout << std::left << std::setw(40) << c.name << std::setw(28) << c.size << std::setw(14) << c.isa()
+                          << std::right << std::fixed << std::setprecision(3)
+                          << std::setw(12) << total / FLAGS_niter << std::setw(12) << best << std::endl;
+            }
+        }
+    } catch (const std::exception &error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "Unknown/internal exception happened." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}